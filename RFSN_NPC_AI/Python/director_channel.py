@@ -0,0 +1,172 @@
+"""
+Director Channel: push delivery of director commands to Unreal
+URfsnDirectorBridge sends its game state once, then only the fields that changed, and keeps
+a long-poll request open that returns as soon as the director issues a command. Compared with
+polling /api/director/control every few seconds, idle periods cost one request per poll timeout
+and commands reach the game without waiting for the next poll.
+
+Endpoints (see add_director_channel_routes):
+    POST /api/director/channel/open       full game state -> {"session", "poll_timeout"}
+    POST /api/director/channel/state      {"session", "changes"} -> {"ok": true}
+    GET  /api/director/channel/commands   ?session=&after=&timeout= -> {"commands": [...]}
+
+Unknown sessions answer 404 so the bridge reopens with its full state.
+"""
+import asyncio
+import time
+import uuid
+from dataclasses import dataclass, field
+from typing import Callable, Dict, List, Optional, Set
+
+# Game state -> command dict ({"command", "alert_modifier", ...}), or None when there is nothing to send
+DecideFn = Callable[[dict], Optional[dict]]
+
+
+@dataclass
+class DirectorSession:
+    """One connected bridge: the merged game state and the commands it hasn't acknowledged."""
+    session_id: str
+    state: dict
+    commands: List[dict] = field(default_factory=list)
+    next_command_id: int = 1
+    next_decision: float = 0.0
+    last_seen: float = 0.0
+    waiters: Set[asyncio.Event] = field(default_factory=set)
+
+
+class DirectorChannelHub:
+    """
+    Sessions for the director push channel.
+
+    The director decides on the same cadence the bridge used to poll (decision_interval_s), plus
+    immediately whenever intensity_state changes. Decisions run inside the long-poll, so no
+    background task is needed: a session without an outstanding poll simply isn't evaluated.
+    Commands stay queued until a later poll acknowledges them with `after`, so a lost response
+    is delivered again.
+    """
+
+    def __init__(self, decide: DecideFn, decision_interval_s: float = 5.0, max_poll_timeout_s: float = 30.0,
+                 session_ttl_s: float = 120.0, max_queued: int = 32,
+                 clock: Callable[[], float] = time.monotonic):
+        self.decide = decide
+        self.decision_interval_s = decision_interval_s
+        self.max_poll_timeout_s = max_poll_timeout_s
+        self.session_ttl_s = session_ttl_s
+        self.max_queued = max_queued
+        self.clock = clock
+        self.sessions: Dict[str, DirectorSession] = {}
+
+    def open(self, state: dict) -> DirectorSession:
+        """Start a session from the bridge's full game state."""
+        now = self.clock()
+        self.prune(now)
+
+        session = DirectorSession(session_id=uuid.uuid4().hex[:12], state=dict(state), next_decision=now,
+                                  last_seen=now)
+        self.sessions[session.session_id] = session
+        return session
+
+    def get(self, session_id: str) -> Optional[DirectorSession]:
+        return self.sessions.get(session_id)
+
+    def prune(self, now: float):
+        """Drop sessions whose bridge stopped polling."""
+        expired = [sid for sid, session in self.sessions.items() if now - session.last_seen > self.session_ttl_s]
+        for sid in expired:
+            del self.sessions[sid]
+
+    def update(self, session: DirectorSession, changes: dict):
+        """Merge a state delta; an intensity change is decided on at once."""
+        session.last_seen = self.clock()
+        intensity_changed = ("intensity_state" in changes and
+                             changes["intensity_state"] != session.state.get("intensity_state"))
+        session.state.update(changes)
+        if intensity_changed:
+            self._decide(session)
+
+    def push(self, session: DirectorSession, command: dict):
+        """Queue a command and wake the session's long-poll."""
+        session.commands.append({"id": session.next_command_id, **command})
+        session.next_command_id += 1
+        if len(session.commands) > self.max_queued:
+            del session.commands[:-self.max_queued]
+
+        for waiter in session.waiters:
+            waiter.set()
+
+    def take(self, session: DirectorSession, after: int) -> List[dict]:
+        """Acknowledge commands up to `after`, run a due decision and return what is pending."""
+        now = self.clock()
+        session.last_seen = now
+        session.commands = [command for command in session.commands if command["id"] > after]
+
+        if not session.commands and now >= session.next_decision:
+            self._decide(session)
+        return list(session.commands)
+
+    async def wait(self, session: DirectorSession, after: int, timeout_s: float) -> List[dict]:
+        """Long-poll: return pending commands as soon as there are any, or [] after timeout_s."""
+        deadline = self.clock() + max(0.0, min(timeout_s, self.max_poll_timeout_s))
+        while True:
+            commands = self.take(session, after)
+            now = self.clock()
+            if commands or now >= deadline:
+                return commands
+
+            # Events are made per wait so they belong to the running loop
+            waiter = asyncio.Event()
+            session.waiters.add(waiter)
+            try:
+                await asyncio.wait_for(waiter.wait(), timeout=min(deadline, session.next_decision) - now)
+            except asyncio.TimeoutError:
+                pass
+            finally:
+                session.waiters.discard(waiter)
+
+    def _decide(self, session: DirectorSession):
+        session.next_decision = self.clock() + self.decision_interval_s
+        command = self.decide(dict(session.state))
+        if command:
+            self.push(session, command)
+
+
+def is_actionable(command: dict) -> bool:
+    """Polling answers every request; the channel only pushes commands that change something."""
+    return command.get("command") != "maintain" or bool(command.get("alert_modifier"))
+
+
+def add_director_channel_routes(app, hub: DirectorChannelHub, prefix: str = "/api/director/channel"):
+    """Mount the channel endpoints on a FastAPI app."""
+    from fastapi import HTTPException, Request
+
+    def find_session(session_id: str) -> DirectorSession:
+        session = hub.get(session_id)
+        if session is None:
+            raise HTTPException(status_code=404, detail="Unknown director session")
+        return session
+
+    @app.post(prefix + "/open")
+    async def director_channel_open(request: Request):
+        try:
+            state = await request.json()
+        except Exception:
+            state = {}
+        session = hub.open(state if isinstance(state, dict) else {})
+        return {"session": session.session_id, "poll_timeout": hub.max_poll_timeout_s}
+
+    @app.post(prefix + "/state")
+    async def director_channel_state(request: Request):
+        try:
+            body = await request.json()
+        except Exception:
+            body = {}
+        session = find_session(body.get("session", ""))
+        changes = body.get("changes") or {}
+        if isinstance(changes, dict):
+            hub.update(session, changes)
+        return {"ok": True}
+
+    @app.get(prefix + "/commands")
+    async def director_channel_commands(session: str, after: int = 0, timeout: float = 25.0):
+        commands = await hub.wait(find_session(session), after, timeout)
+        return {"commands": commands}
@@ -4,22 +4,35 @@ RFSN Mock Server
 Lightweight mock server for offline testing and development.
 Provides canned responses without requiring the full RFSN orchestrator.
 
+Also stands in for the TTS backends (synthetic PCM) and can pace the dialogue
+stream like a real model (each sentence arrives once its tokens would have been
+generated), so the Unreal client stack can be load tested offline.
+
 Usage:
     python mock_server.py [--port 8000]
+    python mock_server.py --tts-ports 8001,8002,8003 --token-rate 25 --latency 0.4 --jitter 0.05
 """
 
 import argparse
 import asyncio
+import io
 import json
+import math
 import random
+import re
+import struct
+import time
+import wave
+from dataclasses import dataclass
 from datetime import datetime
-from typing import AsyncGenerator
+from typing import AsyncGenerator, List, Optional
 
 try:
-    from fastapi import FastAPI, Request
-    from fastapi.responses import StreamingResponse
+    from fastapi import FastAPI, HTTPException, Request
+    from fastapi.responses import Response, StreamingResponse
     from fastapi.middleware.cors import CORSMiddleware
     import uvicorn
+    from director_channel import DirectorChannelHub, add_director_channel_routes, is_actionable
 except ImportError:
     print("Please install dependencies: pip install fastapi uvicorn")
     exit(1)
@@ -55,6 +68,26 @@ RESPONSES = {
 
 ACTIONS = ["Greet", "Answer", "Explain", "Help", "Trade", "Warn"]
 
+# Simulated LLM latency for backstory generation (override with --backstory-latency)
+BACKSTORY_LATENCY_S = 1.5
+
+
+@dataclass
+class StreamTiming:
+    """Pacing of the mock dialogue stream and TTS (all overridable from the command line)."""
+    first_token_latency_s: float = 0.3  # request -> meta event -> first token
+    token_rate: float = 20.0            # tokens per second once streaming
+    jitter_s: float = 0.0               # +/- uniform jitter on every delay
+    tts_latency_s: float = 0.15         # synthesis delay before TTS responds
+    tts_sample_rate: int = 22050        # PCM sample rate for synthetic speech
+
+
+TIMING = StreamTiming()
+
+# Synthetic audio served from /audio/{name} (bounded so long load tests don't grow forever)
+MAX_CACHED_CLIPS = 256
+AUDIO_CACHE: dict = {}
+
 
 def get_response(player_message: str) -> tuple[str, str]:
     """Get canned response based on player message keywords."""
@@ -68,35 +101,101 @@ def get_response(player_message: str) -> tuple[str, str]:
     return random.choice(GREETINGS), "Greet"
 
 
-async def generate_sse_stream(player_message: str, npc_name: str) -> AsyncGenerator[str, None]:
-    """Generate mock SSE stream."""
+def jittered(delay_s: float, timing: Optional[StreamTiming] = None) -> float:
+    """Delay with uniform +/- jitter, never negative."""
+    timing = timing or TIMING
+    if timing.jitter_s <= 0.0:
+        return max(delay_s, 0.0)
+    return max(delay_s + random.uniform(-timing.jitter_s, timing.jitter_s), 0.0)
+
+
+def tokenize(text: str) -> List[str]:
+    """Split text into word tokens, keeping the separating space on the token after it."""
+    words = text.split(" ")
+    return [words[0]] + [" " + word for word in words[1:]] if words else []
+
+
+def split_sentences(text: str) -> List[str]:
+    """Split text after sentence-ending punctuation, as the orchestrator's sentence tokenizer does."""
+    sentences = [sentence.strip() for sentence in re.split(r"(?<=[.!?])\s+", text)]
+    return [sentence for sentence in sentences if sentence] or [text]
+
+
+async def generate_sse_stream(player_message: str, npc_name: str,
+                              timing: Optional[StreamTiming] = None) -> AsyncGenerator[str, None]:
+    """Generate mock SSE stream in the orchestrator's event format."""
     
+    timing = timing or TIMING
+    start = time.perf_counter()
     response_text, action = get_response(player_message)
     
-    # Simulate processing delay
-    await asyncio.sleep(0.3)
+    # Simulate prompt processing
+    await asyncio.sleep(jittered(timing.first_token_latency_s, timing))
     
-    # Meta event
+    # Meta event (top-level fields, same as the orchestrator)
     meta_event = {
         "npc_action": action,
         "player_signal": "neutral",
-        "bandit_key": f"mock_{datetime.now().timestamp()}"
-    }
-    yield f"data: {json.dumps({'type': 'meta', 'data': meta_event})}\n\n"
-    
-    # Simulate typing delay
-    await asyncio.sleep(0.5)
-    
-    # Sentence event
-    sentence_event = {
-        "npc_name": npc_name,
-        "sentence": response_text
+        "bandit_key": f"mock_{datetime.now().timestamp()}",
+        "action_mode": "MOCK",
+        "instant_bark": None,
+        "bark_duration_ms": 0,
     }
-    yield f"data: {json.dumps({'type': 'sentence', 'data': sentence_event})}\n\n"
+    yield f"data: {json.dumps(meta_event)}\n\n"
     
-    # Done event
-    await asyncio.sleep(0.2)
-    yield f"data: {json.dumps({'type': 'done'})}\n\n"
+    # One event per sentence, sent once all its tokens would have been generated at the configured rate
+    sentences = split_sentences(response_text)
+    interval = 1.0 / timing.token_rate if timing.token_rate > 0 else 0.0
+    for index, sentence in enumerate(sentences):
+        tokens = tokenize(sentence)
+        await asyncio.sleep(sum(jittered(interval, timing) for _ in range(len(tokens) - 1)))
+        sentence_event = {
+            "sentence": sentence,
+            "is_final": index == len(sentences) - 1,
+            "latency_ms": (time.perf_counter() - start) * 1000.0,
+        }
+        yield f"data: {json.dumps(sentence_event)}\n\n"
+        if index < len(sentences) - 1:
+            await asyncio.sleep(jittered(interval, timing))
+
+    # Terminal event, so clients can tell a finished reply from a dropped stream
+    done_event = {"done": True, "latency_ms": (time.perf_counter() - start) * 1000.0}
+    yield f"data: {json.dumps(done_event)}\n\n"
+
+def synthesize_pcm(text: str, sample_rate: int, pace: float = 1.0, pitch: float = 1.0) -> bytes:
+    """Speech-shaped 16-bit mono PCM: one voiced syllable per vowel group, short closures between words."""
+    syllable_s = 0.18 / max(pace, 0.1)
+    gap_s = 0.06 / max(pace, 0.1)
+    base_hz = 140.0 * pitch
+
+    samples = bytearray()
+    syllable_len = int(syllable_s * sample_rate)
+    gap = bytes(int(gap_s * sample_rate) * 2)
+
+    for word_index, word in enumerate(text.split() or [""]):
+        syllables = max(1, sum(1 for i, c in enumerate(word.lower())
+                               if c in "aeiouy" and (i == 0 or word[i - 1].lower() not in "aeiouy")))
+        for syllable in range(syllables):
+            # Alternate bright and dark vowels so viseme analysis has something to classify
+            hz = base_hz * (1.0 + 0.5 * ((word_index + syllable) % 3))
+            for n in range(syllable_len):
+                envelope = math.sin(math.pi * n / syllable_len)
+                value = envelope * (0.6 * math.sin(2.0 * math.pi * hz * n / sample_rate)
+                                    + 0.25 * math.sin(2.0 * math.pi * 3.0 * hz * n / sample_rate))
+                samples += struct.pack("<h", int(value * 20000))
+        samples += gap
+
+    return bytes(samples)
+
+
+def pcm_to_wav(pcm: bytes, sample_rate: int) -> bytes:
+    buffer = io.BytesIO()
+    with wave.open(buffer, "wb") as wav:
+        wav.setnchannels(1)
+        wav.setsampwidth(2)
+        wav.setframerate(sample_rate)
+        wav.writeframes(pcm)
+    return buffer.getvalue()
 
 
 # ─────────────────────────────────────────────────────────────
@@ -106,7 +205,20 @@ async def generate_sse_stream(player_message: str, npc_name: str) -> AsyncGenera
 @app.get("/api/health")
 async def health():
     """Health check endpoint."""
-    return {"status": "healthy", "mode": "mock", "timestamp": datetime.now().isoformat()}
+    return {
+        "status": "healthy",
+        "mode": "mock",
+        "timestamp": datetime.now().isoformat(),
+        "token_rate": TIMING.token_rate,
+        "first_token_latency_s": TIMING.first_token_latency_s,
+        "jitter_s": TIMING.jitter_s,
+    }
+
+
+@app.get("/health")
+async def tts_health():
+    """TTS backend health check."""
+    return {"status": "ok", "device": "mock", "full_loaded": True, "turbo_loaded": True}
 
 
 @app.post("/api/dialogue/stream")
@@ -117,8 +229,9 @@ async def dialogue_stream(request: Request):
     except Exception:
         body = {}
     
-    player_message = body.get("player_utterance", "Hello")
-    npc_name = body.get("npc_name", "MockNPC")
+    npc_state = body.get("npc_state") or {}
+    player_message = body.get("user_input") or body.get("player_utterance", "Hello")
+    npc_name = npc_state.get("npc_name") or body.get("npc_name", "MockNPC")
     
     return StreamingResponse(
         generate_sse_stream(player_message, npc_name),
@@ -126,16 +239,10 @@ async def dialogue_stream(request: Request):
     )
 
 
-@app.post("/api/director/control")
-async def director_control(request: Request):
-    """Mock director control endpoint."""
-    try:
-        body = await request.json()
-    except Exception:
-        body = {}
-    
-    alert_level = body.get("alert_level", 0)
-    intensity = body.get("intensity", 0.5)
+def decide_director(state: dict) -> dict:
+    """Mock director decision, shared by polling and the push channel."""
+    alert_level = state.get("alert_level", 0)
+    intensity = state.get("intensity", 0.5)
     
     # Simple mock logic - use intensity to modify decisions
     if alert_level > 80:
@@ -156,15 +263,153 @@ async def director_control(request: Request):
     }
 
 
+@app.post("/api/director/control")
+async def director_control(request: Request):
+    """Mock director control endpoint."""
+    try:
+        body = await request.json()
+    except Exception:
+        body = {}
+    
+    return decide_director(body)
+
+
+def decide_director_push(state: dict) -> Optional[dict]:
+    command = decide_director(state)
+    return command if is_actionable(command) else None
+
+
+# Push channel (URfsnDirectorBridge default); polls decide on the same cadence as /api/director/control
+DIRECTOR_CHANNEL = DirectorChannelHub(decide_director_push)
+add_director_channel_routes(app, DIRECTOR_CHANNEL)
+
+
+@app.post("/api/backstory/generate")
+async def backstory_generate(request: Request):
+    """Mock backstory generation endpoint (simulates LLM generation latency)."""
+    try:
+        body = await request.json()
+    except Exception:
+        body = {}
+
+    npc_id = body.get("npc_id", "npc_mock")
+    npc_name = body.get("npc_name", "MockNPC")
+    occupation = body.get("occupation") or "Survivor"
+    traits = body.get("personality_traits") or ["cautious"]
+
+    await asyncio.sleep(BACKSTORY_LATENCY_S)
+
+    return {
+        "npc_id": npc_id,
+        "summary": (
+            f"{npc_name} washed ashore years ago and never left.\n\n"
+            f"Now a {occupation.lower()}, they keep to themselves."
+        ),
+        "occupation": occupation,
+        "faction_history": "Joined the survivors after the first storm season",
+        "personal_goal": "Find a way off the island",
+        "fear": "The tower lights going dark",
+        "secret": "Hid supplies from the camp",
+        "trait": traits[0],
+        "version": 1,
+        "elements": [
+            {"type": "origin", "description": "Arrived by shipwreck", "importance": 0.8,
+             "public": True, "tags": ["history"]},
+        ],
+    }
+
+
+async def _synthesize(request: Request, model_name: str):
+    """Mock TTS: JSON with an audio path like Chatterbox, or raw PCM with ?format=pcm."""
+    try:
+        body = await request.json()
+    except Exception:
+        body = {}
+
+    text = body.get("text", "")
+    if not text:
+        raise HTTPException(status_code=400, detail="text is required")
+
+    start = time.perf_counter()
+    await asyncio.sleep(jittered(TIMING.tts_latency_s))
+
+    sample_rate = TIMING.tts_sample_rate
+    pcm = synthesize_pcm(text, sample_rate, body.get("pace", 1.0), body.get("pitch", 1.0))
+
+    if request.query_params.get("format") == "pcm":
+        return Response(content=pcm, media_type="application/octet-stream",
+                        headers={"X-Sample-Rate": str(sample_rate)})
+
+    name = f"tts_{model_name}_{int(time.time() * 1000)}_{random.randrange(1 << 16):04x}.wav"
+    AUDIO_CACHE[name] = pcm_to_wav(pcm, sample_rate)
+    while len(AUDIO_CACHE) > MAX_CACHED_CLIPS:
+        AUDIO_CACHE.pop(next(iter(AUDIO_CACHE)))
+
+    return {
+        "audio_path": f"{request.base_url}audio/{name}",
+        "duration_sec": len(pcm) / 2 / sample_rate,
+        "model_used": model_name,
+        "generation_time_ms": (time.perf_counter() - start) * 1000.0,
+    }
+
+
+@app.post("/synthesize/full")
+async def synthesize_full(request: Request):
+    return await _synthesize(request, "full")
+
+
+@app.post("/synthesize/turbo")
+async def synthesize_turbo(request: Request):
+    return await _synthesize(request, "turbo")
+
+
+@app.post("/synthesize")
+async def synthesize_auto(request: Request):
+    return await _synthesize(request, "mock")
+
+
+@app.get("/audio/{name}")
+async def audio(name: str):
+    wav = AUDIO_CACHE.get(name)
+    if wav is None:
+        raise HTTPException(status_code=404, detail="Audio not found")
+    return Response(content=wav, media_type="audio/wav")
+
+
 # ─────────────────────────────────────────────────────────────
 # Main
 # ─────────────────────────────────────────────────────────────
 
+
+async def serve(host: str, ports: List[int]):
+    """Serve the same app on every port (orchestrator + TTS backends)."""
+    servers = [uvicorn.Server(uvicorn.Config(app, host=host, port=port, log_level="warning")) for port in ports]
+    await asyncio.gather(*(server.serve() for server in servers))
+
+
 if __name__ == "__main__":
     parser = argparse.ArgumentParser(description="RFSN Mock Server")
     parser.add_argument("--port", type=int, default=8000, help="Port to run on")
     parser.add_argument("--host", default="0.0.0.0", help="Host to bind to")
+    parser.add_argument("--backstory-latency", type=float, default=BACKSTORY_LATENCY_S,
+                        help="Seconds to delay backstory generation responses")
+    parser.add_argument("--token-rate", type=float, default=TIMING.token_rate,
+                        help="Dialogue tokens streamed per second")
+    parser.add_argument("--latency", type=float, default=TIMING.first_token_latency_s,
+                        help="Seconds before the first dialogue event")
+    parser.add_argument("--jitter", type=float, default=TIMING.jitter_s,
+                        help="Uniform +/- jitter in seconds applied to every delay")
+    parser.add_argument("--tts-latency", type=float, default=TIMING.tts_latency_s,
+                        help="Seconds to delay TTS responses")
+    parser.add_argument("--tts-ports", default="",
+                        help="Extra comma-separated ports to serve TTS on (e.g. 8001,8002,8003)")
     args = parser.parse_args()
+    BACKSTORY_LATENCY_S = args.backstory_latency
+    TIMING.token_rate = args.token_rate
+    TIMING.first_token_latency_s = args.latency
+    TIMING.jitter_s = args.jitter
+    TIMING.tts_latency_s = args.tts_latency
+    tts_ports = [int(port) for port in args.tts_ports.split(",") if port.strip()]
     
     print(f"╔══════════════════════════════════════╗")
     print(f"║     RFSN Mock Server v1.0.0          ║")
@@ -175,6 +420,18 @@ if __name__ == "__main__":
     print(f"  GET  /api/health")
     print(f"  POST /api/dialogue/stream")
     print(f"  POST /api/director/control")
+    print(f"  POST /api/director/channel/open|state, GET /api/director/channel/commands")
+    print(f"  POST /api/backstory/generate")
+    print(f"  POST /synthesize[/full|/turbo]  (?format=pcm for raw PCM)")
+    print(f"  GET  /audio/{{name}}")
+    print()
+    print(f"Stream: {TIMING.token_rate:g} tok/s, {TIMING.first_token_latency_s:g}s first token, "
+          f"±{TIMING.jitter_s:g}s jitter")
+    if tts_ports:
+        print(f"TTS also on ports: {', '.join(str(port) for port in tts_ports)}")
     print()
     
-    uvicorn.run(app, host=args.host, port=args.port, log_level="info")
+    if tts_ports:
+        asyncio.run(serve(args.host, [args.port] + tts_ports))
+    else:
+        uvicorn.run(app, host=args.host, port=args.port, log_level="info")
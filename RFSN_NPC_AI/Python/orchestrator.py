@@ -58,6 +58,7 @@ from memory_governance import MemoryGovernance, GovernedMemory, MemoryType, Memo
 from intent_extraction import IntentGate, IntentExtractor, IntentType, SafetyFlag
 from streaming_pipeline import StreamingPipeline, DropPolicy, TimeoutConfig, BoundedQueue, DropPolicy
 from observability import StructuredLogger, MetricsCollector, TraceContext
+from director_channel import DirectorChannelHub, add_director_channel_routes, is_actionable
 from event_recorder import EventRecorder, EventType
 from state_machine import StateMachine, RFSNStateMachine
 
@@ -1364,8 +1365,13 @@ async def director_control(game_state: DirectorGameState):
     Integration with IslandDirectorSubsystem:
     - Receives current alert_level, intensity_state
     - Returns command and alert_modifier
-    - Used by RfsnDirectorBridge component
+    - Used by RfsnDirectorBridge component when its push channel is down
     """
+    return decide_director(game_state)
+
+
+def decide_director(game_state: DirectorGameState) -> DirectorResponse:
+    """Pacing decision shared by /api/director/control and the push channel"""
     
     # Decision logic based on intensity state
     intensity = game_state.intensity_state.lower()
@@ -1437,6 +1443,21 @@ async def director_control(game_state: DirectorGameState):
     )
 
 
+def decide_director_push(state: dict) -> Optional[dict]:
+    """Push channel decision: the merged state delta, and only commands that change something"""
+    try:
+        game_state = DirectorGameState(**state)
+    except Exception:
+        game_state = DirectorGameState()
+    command = decide_director(game_state).__dict__
+    return dict(command) if is_actionable(command) else None
+
+
+# Push channel for RfsnDirectorBridge (state deltas in, commands out over long-poll)
+director_channel = DirectorChannelHub(decide_director_push)
+add_director_channel_routes(app, director_channel)
+
+
 # ─────────────────────────────────────────────────────────────
 # Backstory Generation (Procedural NPC histories)
 # ─────────────────────────────────────────────────────────────
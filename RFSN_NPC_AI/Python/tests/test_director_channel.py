@@ -0,0 +1,285 @@
+#!/usr/bin/env python3
+"""
+Director Channel Tests
+URfsnDirectorBridge prefers the push channel over polling /api/director/control. These tests replay
+a minute of game state through both modes, counting request bytes the way the bridge does (URL plus
+condensed JSON body), and check that commands arrive sooner and for fewer bytes over the channel.
+"""
+
+import asyncio
+import json
+import sys
+import os
+import time
+
+sys.path.insert(0, os.path.join(os.path.dirname(__file__), '..'))
+
+import pytest
+
+from director_channel import DirectorChannelHub, is_actionable
+
+BASE_URL = "http://127.0.0.1:8000"
+CONTROL_URL = BASE_URL + "/api/director/control"
+CHANNEL_URL = BASE_URL + "/api/director/channel"
+
+# URfsnDirectorBridge defaults
+POLL_INTERVAL_S = 5.0
+STATE_CHECK_INTERVAL_S = 0.5
+ALERT_DELTA_THRESHOLD = 2.0
+LONG_POLL_TIMEOUT_S = 25
+
+
+class FakeClock:
+
+    def __init__(self):
+        self.now = 0.0
+
+    def __call__(self):
+        return self.now
+
+
+def decide(state: dict):
+    """Same shape as the orchestrator: relief when overwhelmed, pressure when calm."""
+    if state.get("intensity_state") == "overwhelmed":
+        return {"command": "respite", "alert_modifier": -15.0}
+    if state.get("alert_level", 0) < 20:
+        return {"command": "escalate", "alert_modifier": 5.0}
+    return None
+
+
+def body_bytes(body: dict) -> int:
+    return len(json.dumps(body, separators=(",", ":")))
+
+
+def game_state(t: float) -> dict:
+    """A minute of play: slow drift around 45, overwhelmed from 31s to 37s."""
+    overwhelmed = 31.0 <= t < 37.0
+    alert = 95.0 if overwhelmed else 45.0 + 1.5 * ((int(t * 2) % 7) / 7.0)
+    return {
+        "alert_level": round(alert, 2),
+        "intensity": round(alert / 100.0, 3),
+        "can_use_tower": True,
+        "can_transmit": t >= 50.0,
+        "intensity_state": "overwhelmed" if overwhelmed else "alerted",
+    }
+
+
+def state_delta(state: dict, sent: dict) -> dict:
+    """Fields URfsnDirectorBridge::SendStateDelta would send."""
+    changes = {}
+    intensity_changed = state["intensity_state"] != sent["intensity_state"]
+    if intensity_changed or abs(state["alert_level"] - sent["alert_level"]) >= ALERT_DELTA_THRESHOLD:
+        changes["alert_level"] = state["alert_level"]
+        changes["intensity"] = state["intensity"]
+    if intensity_changed:
+        changes["intensity_state"] = state["intensity_state"]
+    for flag in ("can_use_tower", "can_transmit"):
+        if state[flag] != sent[flag]:
+            changes[flag] = state[flag]
+    return changes
+
+
+def run_polling(duration_s: float = 60.0):
+    """Returns (bytes sent, seconds from going overwhelmed to receiving respite)."""
+    sent = 0
+    respite_at = None
+    t = 0.0
+    while t < duration_s:
+        state = game_state(t)
+        sent += len(CONTROL_URL) + body_bytes(state)
+        command = decide(state)
+        if respite_at is None and command and command["command"] == "respite":
+            respite_at = t
+        t += POLL_INTERVAL_S
+    return sent, respite_at - 31.0
+
+
+def run_channel(duration_s: float = 60.0):
+    """Replays the bridge's channel traffic against the hub with a fake clock."""
+    clock = FakeClock()
+    hub = DirectorChannelHub(decide, decision_interval_s=POLL_INTERVAL_S, clock=clock)
+
+    state = game_state(0.0)
+    session = hub.open(state)
+    sent_state = dict(state)
+    sent = len(CHANNEL_URL + "/open") + body_bytes(state)
+
+    def poll_url(after):
+        return f"{CHANNEL_URL}/commands?session={session.session_id}&after={after}&timeout={LONG_POLL_TIMEOUT_S}"
+
+    last_id = 0
+    sent += len(poll_url(last_id))
+    poll_started = 0.0
+    respite_at = None
+
+    steps = int(duration_s / STATE_CHECK_INTERVAL_S)
+    for step in range(steps):
+        clock.now = step * STATE_CHECK_INTERVAL_S
+
+        changes = state_delta(game_state(clock.now), sent_state)
+        if changes:
+            sent_state.update(changes)
+            sent += len(CHANNEL_URL + "/state") + body_bytes({"session": session.session_id, "changes": changes})
+            hub.update(session, changes)
+
+        # The outstanding long-poll returns on commands or timeout; the bridge re-polls at once
+        commands = hub.take(session, last_id)
+        if commands or clock.now - poll_started >= LONG_POLL_TIMEOUT_S:
+            for command in commands:
+                last_id = max(last_id, command["id"])
+                if respite_at is None and command["command"] == "respite":
+                    respite_at = clock.now
+            sent += len(poll_url(last_id))
+            poll_started = clock.now
+
+    return sent, respite_at - 31.0
+
+
+class TestDirectorChannelHub:
+
+    def test_deltas_merge_into_session_state(self):
+        hub = DirectorChannelHub(decide, clock=FakeClock())
+        session = hub.open(game_state(0.0))
+        hub.update(session, {"alert_level": 50.0, "can_transmit": True})
+        assert session.state["alert_level"] == 50.0
+        assert session.state["can_transmit"] is True
+        assert session.state["intensity_state"] == "alerted"
+
+    def test_intensity_change_decides_immediately(self):
+        clock = FakeClock()
+        hub = DirectorChannelHub(decide, decision_interval_s=5.0, clock=clock)
+        session = hub.open(game_state(0.0))
+        assert hub.take(session, 0) == []
+
+        clock.now = 1.0
+        hub.update(session, {"intensity_state": "overwhelmed"})
+        commands = hub.take(session, 0)
+        assert [command["command"] for command in commands] == ["respite"]
+
+    def test_commands_stay_queued_until_acknowledged(self):
+        clock = FakeClock()
+        hub = DirectorChannelHub(decide, clock=clock)
+        session = hub.open({"alert_level": 5.0})
+        first = hub.take(session, 0)
+        assert len(first) == 1
+
+        # Response lost: the next poll still carries after=0
+        assert hub.take(session, 0) == first
+        assert hub.take(session, first[0]["id"]) == []
+
+    def test_decisions_follow_the_poll_cadence(self):
+        clock = FakeClock()
+        hub = DirectorChannelHub(decide, decision_interval_s=5.0, clock=clock)
+        session = hub.open({"alert_level": 5.0})
+        last_id = 0
+        issued = 0
+        for step in range(60):
+            clock.now = step * 0.5
+            for command in hub.take(session, last_id):
+                last_id = command["id"]
+                issued += 1
+        assert issued == 6
+
+    def test_queue_is_bounded(self):
+        hub = DirectorChannelHub(decide, max_queued=4, clock=FakeClock())
+        session = hub.open({})
+        for _ in range(10):
+            hub.push(session, {"command": "escalate"})
+        assert [command["id"] for command in session.commands] == [7, 8, 9, 10]
+
+    def test_idle_sessions_expire(self):
+        clock = FakeClock()
+        hub = DirectorChannelHub(decide, session_ttl_s=60.0, clock=clock)
+        stale = hub.open({})
+        clock.now = 61.0
+        hub.open({})
+        assert hub.get(stale.session_id) is None
+
+    def test_maintain_is_not_pushed(self):
+        assert not is_actionable({"command": "maintain", "alert_modifier": 0})
+        assert is_actionable({"command": "maintain", "alert_modifier": 2.0})
+        assert is_actionable({"command": "respite", "alert_modifier": 0})
+
+
+class TestDirectorChannelLongPoll:
+
+    def test_long_poll_wakes_on_command(self):
+        async def scenario():
+            hub = DirectorChannelHub(decide, decision_interval_s=60.0)
+            session = hub.open({"alert_level": 45.0, "intensity_state": "alerted"})
+            assert await hub.wait(session, 0, 0.0) == []
+
+            poll = asyncio.ensure_future(hub.wait(session, 0, 5.0))
+            await asyncio.sleep(0.05)
+            started = time.perf_counter()
+            hub.update(session, {"intensity_state": "overwhelmed"})
+            commands = await poll
+            return commands, time.perf_counter() - started
+
+        commands, latency = asyncio.run(scenario())
+        assert [command["command"] for command in commands] == ["respite"]
+        assert latency < 0.5
+
+    def test_long_poll_times_out_empty(self):
+        async def scenario():
+            hub = DirectorChannelHub(decide, decision_interval_s=60.0)
+            session = hub.open({"alert_level": 45.0})
+            started = time.perf_counter()
+            commands = await hub.wait(session, 0, 0.1)
+            return commands, time.perf_counter() - started
+
+        commands, elapsed = asyncio.run(scenario())
+        assert commands == []
+        assert 0.05 <= elapsed < 1.0
+
+
+class TestChannelVersusPolling:
+
+    def test_bytes_per_minute(self):
+        polling_bytes, _ = run_polling()
+        channel_bytes, _ = run_channel()
+        print(f"\nDirector bytes/min: polling {polling_bytes}, channel {channel_bytes}")
+        assert channel_bytes < polling_bytes * 0.75
+
+    def test_command_latency(self):
+        _, polling_latency = run_polling()
+        _, channel_latency = run_channel()
+        print(f"\nRespite latency: polling {polling_latency:.1f}s, channel {channel_latency:.1f}s")
+        assert channel_latency <= STATE_CHECK_INTERVAL_S
+        assert channel_latency < polling_latency
+
+
+class TestDirectorChannelRoutes:
+    """The stand-in server exposes the channel exactly as the orchestrator does."""
+
+    @pytest.fixture
+    def client(self):
+        pytest.importorskip("fastapi")
+        pytest.importorskip("httpx")
+        from fastapi.testclient import TestClient
+        import mock_server
+        return TestClient(mock_server.app)
+
+    def test_open_push_and_poll(self, client):
+        opened = client.post("/api/director/channel/open", json={"alert_level": 45.0, "intensity": 0.45,
+                                                                  "intensity_state": "alerted"})
+        assert opened.status_code == 200
+        session = opened.json()["session"]
+
+        assert client.post("/api/director/channel/state", json={
+            "session": session,
+            "changes": {"alert_level": 90.0, "intensity": 0.9, "intensity_state": "overwhelmed"},
+        }).status_code == 200
+
+        response = client.get("/api/director/channel/commands",
+                              params={"session": session, "after": 0, "timeout": 1})
+        assert response.status_code == 200
+        commands = response.json()["commands"]
+        assert commands and commands[0]["command"] == "respite"
+        assert commands[0]["id"] == 1
+
+    def test_unknown_session_is_404(self, client):
+        response = client.get("/api/director/channel/commands", params={"session": "missing", "timeout": 0})
+        assert response.status_code == 404
+        response = client.post("/api/director/channel/state", json={"session": "missing", "changes": {}})
+        assert response.status_code == 404
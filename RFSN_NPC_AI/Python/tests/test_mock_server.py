@@ -0,0 +1,105 @@
+#!/usr/bin/env python3
+"""
+RFSN Mock Server Tests
+The mock stands in for the orchestrator and TTS backends during Unreal load tests,
+so its wire format has to match what URfsnNpcClientComponent parses.
+"""
+
+import json
+import sys
+import os
+
+sys.path.insert(0, os.path.join(os.path.dirname(__file__), '..'))
+
+import pytest
+
+pytest.importorskip("fastapi")
+pytest.importorskip("httpx")
+
+from fastapi.testclient import TestClient
+
+import mock_server
+
+
+@pytest.fixture
+def client():
+    """Mock with all pacing disabled so tests run instantly"""
+    saved = (mock_server.TIMING, mock_server.BACKSTORY_LATENCY_S)
+    mock_server.TIMING = mock_server.StreamTiming(first_token_latency_s=0.0, token_rate=0.0, jitter_s=0.0,
+                                                  tts_latency_s=0.0)
+    mock_server.BACKSTORY_LATENCY_S = 0.0
+    yield TestClient(mock_server.app)
+    mock_server.TIMING, mock_server.BACKSTORY_LATENCY_S = saved
+
+
+def read_events(response):
+    return [json.loads(line[5:]) for line in response.text.splitlines() if line.startswith("data:")]
+
+
+class TestMockDialogue:
+
+    def test_health(self, client):
+        response = client.get("/api/health")
+        assert response.status_code == 200
+        assert response.json()["mode"] == "mock"
+
+    def test_stream_matches_orchestrator_format(self, client):
+        response = client.post("/api/dialogue/stream", json={
+            "user_input": "I want to trade",
+            "npc_state": {"npc_name": "Mira"},
+        })
+        assert response.status_code == 200
+
+        events = read_events(response)
+        assert "npc_action" in events[0]
+        assert events[-1]["done"]
+
+        sentences = events[1:-1]
+        assert len(sentences) >= 1
+        assert all("sentence" in event for event in sentences)
+        assert sentences[-1]["is_final"]
+        assert not any(event["is_final"] for event in sentences[:-1])
+        assert " ".join(event["sentence"] for event in sentences) in mock_server.RESPONSES["trade"]
+
+    def test_stream_sends_whole_sentences(self, client):
+        response = client.post("/api/dialogue/stream", json={"user_input": "hello"})
+        sentences = [event["sentence"] for event in read_events(response) if "sentence" in event]
+        assert all(sentence[-1] in ".!?" for sentence in sentences)
+
+    def test_split_sentences(self):
+        assert mock_server.split_sentences("Hello! How can I help you?") == ["Hello!", "How can I help you?"]
+        assert mock_server.split_sentences("No punctuation") == ["No punctuation"]
+
+    def test_jitter_never_negative(self):
+        timing = mock_server.StreamTiming(jitter_s=1.0)
+        assert all(mock_server.jittered(0.1, timing) >= 0.0 for _ in range(200))
+
+
+class TestMockTts:
+
+    def test_synthesize_returns_playable_audio(self, client):
+        response = client.post("/synthesize/turbo", json={"text": "Hello there, traveler."})
+        assert response.status_code == 200
+        data = response.json()
+        assert data["model_used"] == "turbo"
+        assert data["duration_sec"] > 0.5
+
+        name = data["audio_path"].rsplit("/", 1)[-1]
+        audio = client.get(f"/audio/{name}")
+        assert audio.status_code == 200
+        assert audio.content[:4] == b"RIFF"
+
+    def test_synthesize_raw_pcm(self, client):
+        response = client.post("/synthesize?format=pcm", json={"text": "Hello there"})
+        assert response.status_code == 200
+        sample_rate = int(response.headers["X-Sample-Rate"])
+        assert len(response.content) % 2 == 0
+        assert len(response.content) / 2 / sample_rate > 0.3
+
+    def test_synthesize_requires_text(self, client):
+        assert client.post("/synthesize", json={}).status_code == 400
+
+    def test_backstory(self, client):
+        response = client.post("/api/backstory/generate", json={"npc_id": "npc_7", "npc_name": "Mira"})
+        assert response.status_code == 200
+        assert response.json()["npc_id"] == "npc_7"
@@ -86,6 +86,12 @@ public class MyProject : ModuleRules
 			"TraceLog"   // Debug logging
 		});
 
+		// Reads captures back in the Rfsn.Trace automation tests
+		if (Target.bBuildEditor)
+		{
+			PrivateDependencyModuleNames.Add("TraceAnalysis");
+		}
+
 		// ─────────────────────────────────────────────────────────────
 		// Include Paths
 		// ─────────────────────────────────────────────────────────────
@@ -0,0 +1,196 @@
+#include "IslandInteractableRegistry.h"
+#include "IslandInteractableInterface.h"
+#include "Engine/Level.h"
+#include "Engine/World.h"
+#include "EngineUtils.h"
+#include "GameFramework/Actor.h"
+
+void UIslandInteractableRegistry::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	if (UWorld* World = GetWorld())
+	{
+		SpawnedHandle = World->AddOnActorSpawnedHandler(
+			FOnActorSpawned::FDelegate::CreateUObject(this, &UIslandInteractableRegistry::HandleActorSpawned));
+	}
+	LevelAddedHandle =
+		FWorldDelegates::LevelAddedToWorld.AddUObject(this, &UIslandInteractableRegistry::HandleLevelAdded);
+}
+
+void UIslandInteractableRegistry::Deinitialize()
+{
+	if (UWorld* World = GetWorld())
+	{
+		World->RemoveOnActorSpawnedHandler(SpawnedHandle);
+	}
+	FWorldDelegates::LevelAddedToWorld.Remove(LevelAddedHandle);
+
+	TArray<TWeakObjectPtr<AActor>> Actors;
+	EntryIndices.GenerateKeyArray(Actors);
+	for (const TWeakObjectPtr<AActor>& Actor : Actors)
+	{
+		Unregister(Actor.Get());
+	}
+
+	Entries.Empty();
+	EntryIndices.Empty();
+	PendingBounds.Empty();
+	Grid.Reset(Grid.GetCellSize());
+	MaxRadius = 0.0f;
+
+	Super::Deinitialize();
+}
+
+void UIslandInteractableRegistry::OnWorldBeginPlay(UWorld& InWorld)
+{
+	Super::OnWorldBeginPlay(InWorld);
+
+	// Actors loaded with the level never went through the spawn handler
+	for (TActorIterator<AActor> It(&InWorld); It; ++It)
+	{
+		Register(*It);
+	}
+}
+
+void UIslandInteractableRegistry::HandleActorSpawned(AActor* Actor)
+{
+	Register(Actor);
+}
+
+void UIslandInteractableRegistry::HandleLevelAdded(ULevel* Level, UWorld* World)
+{
+	if (!Level || World != GetWorld()) return;
+
+	for (AActor* Actor : Level->Actors)
+	{
+		Register(Actor);
+	}
+}
+
+void UIslandInteractableRegistry::Register(AActor* Actor)
+{
+	if (!IsValid(Actor) || !Actor->GetClass()->ImplementsInterface(UIslandInteractableInterface::StaticClass()))
+		return;
+
+	if (EntryIndices.Contains(Actor)) return;
+
+	// Spawn handlers run before deferred or Blueprint-added components exist, so the bounds are measured later
+	FEntry Entry;
+	Entry.Actor = Actor;
+	Entry.Location = Actor->GetActorLocation();
+
+	USceneComponent* Root = Actor->GetRootComponent();
+	if (Root && Root->Mobility == EComponentMobility::Movable)
+	{
+		Entry.MovedHandle = Root->TransformUpdated.AddUObject(this, &UIslandInteractableRegistry::HandleRootMoved);
+	}
+	Actor->OnDestroyed.AddDynamic(this, &UIslandInteractableRegistry::HandleActorDestroyed);
+	Actor->OnEndPlay.AddDynamic(this, &UIslandInteractableRegistry::HandleActorEndPlay);
+
+	const int32 Index = Entries.Add(MoveTemp(Entry));
+	EntryIndices.Add(Actor, Index);
+	Grid.Add(Index, Entries[Index].Location);
+	PendingBounds.Add(Index);
+}
+
+void UIslandInteractableRegistry::Unregister(AActor* Actor)
+{
+	int32 Index = INDEX_NONE;
+	if (!EntryIndices.RemoveAndCopyValue(Actor, Index)) return;
+
+	FEntry& Entry = Entries[Index];
+	if (Actor)
+	{
+		if (USceneComponent* Root = Actor->GetRootComponent())
+		{
+			Root->TransformUpdated.Remove(Entry.MovedHandle);
+		}
+		Actor->OnDestroyed.RemoveDynamic(this, &UIslandInteractableRegistry::HandleActorDestroyed);
+		Actor->OnEndPlay.RemoveDynamic(this, &UIslandInteractableRegistry::HandleActorEndPlay);
+	}
+
+	Grid.Remove(Index, Entry.Location);
+	Entries.RemoveAt(Index);
+	PendingBounds.RemoveSwap(Index);
+}
+
+void UIslandInteractableRegistry::HandleActorDestroyed(AActor* Actor)
+{
+	Unregister(Actor);
+}
+
+void UIslandInteractableRegistry::HandleActorEndPlay(AActor* Actor, EEndPlayReason::Type EndPlayReason)
+{
+	// Streamed-out actors end play without being destroyed, and come back through HandleLevelAdded
+	Unregister(Actor);
+}
+
+void UIslandInteractableRegistry::ResolvePendingBounds()
+{
+	for (int32 i = PendingBounds.Num() - 1; i >= 0; i--)
+	{
+		const int32 Index = PendingBounds[i];
+		FEntry& Entry = Entries[Index];
+		const AActor* Actor = Entry.Actor.Get();
+		if (!Actor) continue;
+
+		// No collision yet: nothing a trace could hit, so it stays a point until it has some
+		const FBox Bounds = Actor->GetComponentsBoundingBox();
+		if (!Bounds.IsValid) continue;
+
+		const FVector Location = Actor->GetActorLocation();
+		Grid.Move(Index, Entry.Location, Location);
+		Entry.Location = Location;
+		Entry.Radius = FVector::Dist(Bounds.GetCenter(), Location) + Bounds.GetExtent().Size();
+		MaxRadius = FMath::Max(MaxRadius, Entry.Radius);
+		PendingBounds.RemoveAtSwap(i, 1, EAllowShrinking::No);
+	}
+}
+
+void UIslandInteractableRegistry::HandleRootMoved(USceneComponent* Root, EUpdateTransformFlags Flags,
+                                                  ETeleportType Teleport)
+{
+	const int32* Index = Root ? EntryIndices.Find(Root->GetOwner()) : nullptr;
+	if (!Index) return;
+
+	FEntry& Entry = Entries[*Index];
+	const FVector NewLocation = Root->GetComponentLocation();
+	Grid.Move(*Index, Entry.Location, NewLocation);
+	Entry.Location = NewLocation;
+}
+
+bool UIslandInteractableRegistry::AnyInCone(const FVector& Origin, const FVector& Direction, float Range,
+                                            float HalfAngleDegrees)
+{
+	ResolvePendingBounds();
+
+	const float HalfAngle = FMath::DegreesToRadians(HalfAngleDegrees);
+
+	bool bFound = false;
+	Grid.Query(Origin, Range + MaxRadius, [this, &bFound, &Origin, &Direction, Range, HalfAngle](int32 Index)
+	{
+		if (!bFound)
+		{
+			const FEntry& Entry = Entries[Index];
+			bFound = Entry.Actor.IsValid() &&
+			         SphereInCone(Origin, Direction, Range, HalfAngle, Entry.Location, Entry.Radius);
+		}
+	});
+	return bFound;
+}
+
+bool UIslandInteractableRegistry::SphereInCone(const FVector& Origin, const FVector& Direction, float Range,
+                                               float HalfAngleRadians, const FVector& Center, float Radius)
+{
+	const FVector ToCenter = Center - Origin;
+	const double DistSq = ToCenter.SizeSquared();
+	if (DistSq <= FMath::Square(Radius)) return true;
+
+	const double Dist = FMath::Sqrt(DistSq);
+	if (Dist - Radius > Range) return false;
+
+	// Angle to the centre against the half angle widened by the sphere's angular radius
+	const double Angle = FMath::Acos(FMath::Clamp((ToCenter | Direction) / Dist, -1.0, 1.0));
+	return Angle <= HalfAngleRadians + FMath::Asin(Radius / Dist);
+}
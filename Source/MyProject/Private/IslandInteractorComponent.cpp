@@ -1,4 +1,5 @@
 #include "IslandInteractorComponent.h"
+#include "IslandInteractableRegistry.h"
 #include "GameFramework/Actor.h"
 #include "GameFramework/PlayerController.h"
 #include "Camera/PlayerCameraManager.h"
@@ -12,36 +13,49 @@ UIslandInteractorComponent::UIslandInteractorComponent()
 void UIslandInteractorComponent::BeginPlay()
 {
 	Super::BeginPlay();
+
+	Registry = GetWorld() ? GetWorld()->GetSubsystem<UIslandInteractableRegistry>() : nullptr;
+	FocusTraceDelegate.BindUObject(this, &UIslandInteractorComponent::OnFocusTraceDone);
+	bFocusDirty = true;
+	NumFocusTraces = 0;
+	NumPrefilteredTraces = 0;
 }
 
 void UIslandInteractorComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
 {
 	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
 
-	FIslandInteractContext Ctx;
-	FHitResult Hit;
-	if (UpdateFocus(Ctx, Hit))
+	FIslandFocusView View;
+	if (!GetView(View))
 	{
-		FocusedActor = Hit.GetActor();
-		if (FocusedActor && FocusedActor->GetClass()->ImplementsInterface(UIslandInteractableInterface::StaticClass()))
-		{
-			const bool bCan = IIslandInteractableInterface::Execute_CanInteract(FocusedActor, Ctx);
-			FocusedPrompt = bCan ? IIslandInteractableInterface::Execute_GetInteractPrompt(FocusedActor, Ctx) : FText();
-		}
-		else
-		{
-			FocusedPrompt = FText();
-		}
+		ApplyFocus(nullptr);
+		return;
 	}
-	else
+
+	const double Now = GetWorld()->GetTimeSeconds();
+	const bool bExpired = FocusRefreshInterval > 0.0f && Now - LastTraceTime >= FocusRefreshInterval;
+
+	// An async trace in flight is applied next frame, which then re-checks the view against it
+	if (!PendingTrace.IsValid() &&
+		(bFocusDirty || bExpired || View.DiffersFrom(LastTraceView, FocusMoveThreshold, FocusRotateThreshold)))
 	{
-		FocusedActor = nullptr;
-		FocusedPrompt = FText();
+		LastTraceView = View;
+		LastTraceTime = Now;
+		bFocusDirty = false;
+		TraceFocus(View);
 	}
+
+	RefreshPrompt();
 }
 
-bool UIslandInteractorComponent::UpdateFocus(FIslandInteractContext& OutCtx, FHitResult& OutHit)
+bool UIslandInteractorComponent::GetView(FIslandFocusView& OutView) const
 {
+	if (ViewOverride.IsSet())
+	{
+		OutView = ViewOverride.GetValue();
+		return true;
+	}
+
 	AActor* Owner = GetOwner();
 	if (!Owner) return false;
 
@@ -54,25 +68,84 @@ bool UIslandInteractorComponent::UpdateFocus(FIslandInteractContext& OutCtx, FHi
 			PC = Cast<APlayerController>(P->GetController());
 		}
 	}
-	if (!PC) return false;
+	if (!PC || !PC->PlayerCameraManager) return false;
+
+	OutView.Location = PC->PlayerCameraManager->GetCameraLocation();
+	OutView.Rotation = PC->PlayerCameraManager->GetCameraRotation();
+	return true;
+}
+
+void UIslandInteractorComponent::TraceFocus(const FIslandFocusView& View)
+{
+	const FVector CamDir = View.Rotation.Vector();
+	const FVector End = View.Location + CamDir * MaxUseDistance;
+
+	// Nothing interactable in front of the camera: the trace couldn't find a focus
+	if (bUseConePrefilter && Registry &&
+		!Registry->AnyInCone(View.Location, CamDir, MaxUseDistance, PrefilterConeAngle))
+	{
+		NumPrefilteredTraces++;
+		ApplyFocus(nullptr);
+		return;
+	}
 
-	const FVector CamLoc = PC->PlayerCameraManager->GetCameraLocation();
-	const FVector CamDir = PC->PlayerCameraManager->GetActorForwardVector();
-	const FVector End = CamLoc + CamDir * MaxUseDistance;
+	NumFocusTraces++;
 
 	FCollisionQueryParams Params(SCENE_QUERY_STAT(IslandInteractTrace), false);
-	Params.AddIgnoredActor(Owner);
+	Params.AddIgnoredActor(GetOwner());
+
+	if (bAsyncFocusTrace)
+	{
+		PendingTrace = GetWorld()->AsyncLineTraceByChannel(EAsyncTraceType::Single, View.Location, End, TraceChannel,
+			Params, FCollisionResponseParams::DefaultResponseParam, &FocusTraceDelegate);
+		return;
+	}
 
-	bool bHit = GetWorld()->LineTraceSingleByChannel(OutHit, CamLoc, End, TraceChannel, Params);
-	if (!bHit || !OutHit.GetActor()) return false;
+	FHitResult Hit;
+	const bool bHit = GetWorld()->LineTraceSingleByChannel(Hit, View.Location, End, TraceChannel, Params);
+	ApplyFocus(bHit ? &Hit : nullptr);
+}
 
-	AActor* HitActor = OutHit.GetActor();
-	if (!HitActor->GetClass()->ImplementsInterface(UIslandInteractableInterface::StaticClass()))
-		return false;
+void UIslandInteractorComponent::OnFocusTraceDone(const FTraceHandle& Handle, FTraceDatum& Datum)
+{
+	if (Handle != PendingTrace) return;
+	PendingTrace = FTraceHandle();
 
-	OutCtx.Interactor = Owner;
-	OutCtx.HitLocation = OutHit.ImpactPoint;
-	return true;
+	ApplyFocus(Datum.OutHits.FindByPredicate([](const FHitResult& Result) { return Result.bBlockingHit; }));
+}
+
+void UIslandInteractorComponent::ApplyFocus(const FHitResult* Hit)
+{
+	AActor* HitActor = Hit ? Hit->GetActor() : nullptr;
+	if (!HitActor || !HitActor->GetClass()->ImplementsInterface(UIslandInteractableInterface::StaticClass()))
+	{
+		FocusedActor = nullptr;
+		FocusedPrompt = FText();
+		return;
+	}
+
+	FocusedActor = HitActor;
+	FocusHitLocation = Hit->ImpactPoint;
+}
+
+void UIslandInteractorComponent::RefreshPrompt()
+{
+	// Interactability can change without the focus changing (tower powered, fuel used up)
+	if (!IsValid(FocusedActor))
+	{
+		// Destroyed while in focus: look again rather than wait for the camera to move
+		bFocusDirty |= FocusedActor != nullptr;
+		FocusedActor = nullptr;
+		FocusedPrompt = FText();
+		return;
+	}
+
+	FIslandInteractContext Ctx;
+	Ctx.Interactor = GetOwner();
+	Ctx.HitLocation = FocusHitLocation;
+
+	const bool bCan = IIslandInteractableInterface::Execute_CanInteract(FocusedActor, Ctx);
+	FocusedPrompt = bCan ? IIslandInteractableInterface::Execute_GetInteractPrompt(FocusedActor, Ctx) : FText();
 }
 
 bool UIslandInteractorComponent::TryInteract()
@@ -2,6 +2,7 @@
 
 #include "RfsnActionLattice.h"
 #include "RfsnLogging.h"
+#include "RfsnTokenDecoder.h"
 
 // ─────────────────────────────────────────────────────────────
 // FRfsnExpandedAction
@@ -152,7 +153,8 @@ FRfsnExpandedAction URfsnActionLattice::ApplyContextModifiers(ERfsnNpcAction Bas
 	}
 
 	// Mood-based modifiers
-	if (Mood.Contains(TEXT("Hostile")) || Mood.Contains(TEXT("Angry")))
+	const FRfsnMoodToken MoodToken = FRfsnTokenDecoder::DecodeMood(Mood);
+	if (MoodToken.Has(ERfsnMoodFlags::Hostile | ERfsnMoodFlags::Angry))
 	{
 		Result.Intensity = ERfsnActionIntensity::Emphatic;
 		if (BaseAction == ERfsnNpcAction::Help || BaseAction == ERfsnNpcAction::Offer)
@@ -160,7 +162,7 @@ FRfsnExpandedAction URfsnActionLattice::ApplyContextModifiers(ERfsnNpcAction Bas
 			Result.Motive = ERfsnActionMotive::Calculated;
 		}
 	}
-	else if (Mood.Contains(TEXT("Fearful")) || Mood.Contains(TEXT("Cautious")))
+	else if (MoodToken.Has(ERfsnMoodFlags::Fearful | ERfsnMoodFlags::Cautious))
 	{
 		Result.Intensity = ERfsnActionIntensity::Subdued;
 		Result.Motive = ERfsnActionMotive::Guarded;
@@ -208,7 +210,7 @@ TArray<FRfsnExpandedAction> URfsnActionLattice::GetValidActions(const FString& M
 		BaseActions.Add(ERfsnNpcAction::Agree);
 	}
 
-	if (Affinity < 0.0f || Mood.Contains(TEXT("Hostile")))
+	if (Affinity < 0.0f || FRfsnTokenDecoder::DecodeMood(Mood).Has(ERfsnMoodFlags::Hostile))
 	{
 		BaseActions.Add(ERfsnNpcAction::Warn);
 		BaseActions.Add(ERfsnNpcAction::Threaten);
@@ -271,11 +273,12 @@ float URfsnActionLattice::ScoreAction(const FRfsnExpandedAction& Action, const F
 	}
 
 	// Mood alignment
-	if (Mood.Contains(TEXT("Friendly")) && bPositiveAction)
+	const FRfsnMoodToken MoodToken = FRfsnTokenDecoder::DecodeMood(Mood);
+	if (MoodToken.Has(ERfsnMoodFlags::Friendly) && bPositiveAction)
 	{
 		Score += 0.15f;
 	}
-	else if (Mood.Contains(TEXT("Hostile")) && !bPositiveAction)
+	else if (MoodToken.Has(ERfsnMoodFlags::Hostile) && !bPositiveAction)
 	{
 		Score += 0.15f;
 	}
@@ -285,51 +288,7 @@ float URfsnActionLattice::ScoreAction(const FRfsnExpandedAction& Action, const F
 
 FString URfsnActionLattice::ActionToString(ERfsnNpcAction Action)
 {
-	switch (Action)
-	{
-	case ERfsnNpcAction::Greet:
-		return TEXT("Greet");
-	case ERfsnNpcAction::Warn:
-		return TEXT("Warn");
-	case ERfsnNpcAction::Idle:
-		return TEXT("Idle");
-	case ERfsnNpcAction::Flee:
-		return TEXT("Flee");
-	case ERfsnNpcAction::Attack:
-		return TEXT("Attack");
-	case ERfsnNpcAction::Trade:
-		return TEXT("Trade");
-	case ERfsnNpcAction::Offer:
-		return TEXT("Offer");
-	case ERfsnNpcAction::Talk:
-		return TEXT("Talk");
-	case ERfsnNpcAction::Apologize:
-		return TEXT("Apologize");
-	case ERfsnNpcAction::Threaten:
-		return TEXT("Threaten");
-	case ERfsnNpcAction::Explain:
-		return TEXT("Explain");
-	case ERfsnNpcAction::Answer:
-		return TEXT("Answer");
-	case ERfsnNpcAction::Inquire:
-		return TEXT("Inquire");
-	case ERfsnNpcAction::Help:
-		return TEXT("Help");
-	case ERfsnNpcAction::Request:
-		return TEXT("Request");
-	case ERfsnNpcAction::Agree:
-		return TEXT("Agree");
-	case ERfsnNpcAction::Disagree:
-		return TEXT("Disagree");
-	case ERfsnNpcAction::Accept:
-		return TEXT("Accept");
-	case ERfsnNpcAction::Refuse:
-		return TEXT("Refuse");
-	case ERfsnNpcAction::Ignore:
-		return TEXT("Ignore");
-	default:
-		return TEXT("Talk");
-	}
+	return FRfsnTokenDecoder::GetActionName(Action);
 }
 
 FString URfsnActionLattice::IntensityToModifier(ERfsnActionIntensity Intensity)
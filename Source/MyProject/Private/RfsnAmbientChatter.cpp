@@ -3,6 +3,7 @@
 #include "RfsnAmbientChatter.h"
 #include "RfsnNpcClientComponent.h"
 #include "RfsnLogging.h"
+#include "RfsnProximityManager.h"
 #include "Kismet/GameplayStatics.h"
 #include "GameFramework/Character.h"
 
@@ -28,9 +29,30 @@ void URfsnAmbientChatter::BeginPlay()
 		AddChatterLine(TEXT("I need help!"), ERfsnChatterTrigger::LowHealth, 1.0f);
 	}
 
+	if (URfsnProximityManager* Proximity = GetWorld() ? GetWorld()->GetSubsystem<URfsnProximityManager>() : nullptr)
+	{
+		ProximityZone = Proximity->RegisterZone(
+		    GetOwner(), PlayerDetectionRadius,
+		    FRfsnProximityChanged::CreateWeakLambda(this, [this](bool bInside) { bPlayerNearby = bInside; }));
+	}
+
 	StartIdleChatter();
 }
 
+void URfsnAmbientChatter::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	if (ProximityZone != INDEX_NONE)
+	{
+		if (URfsnProximityManager* Proximity = GetWorld() ? GetWorld()->GetSubsystem<URfsnProximityManager>() : nullptr)
+		{
+			Proximity->UnregisterZone(ProximityZone);
+		}
+		ProximityZone = INDEX_NONE;
+	}
+
+	Super::EndPlay(EndPlayReason);
+}
+
 void URfsnAmbientChatter::TickComponent(float DeltaTime, ELevelTick TickType,
                                         FActorComponentTickFunction* ThisTickFunction)
 {
@@ -53,11 +75,10 @@ void URfsnAmbientChatter::TickComponent(float DeltaTime, ELevelTick TickType,
 	}
 
 	// Player nearby check
-	static float LastPlayerCheck = 0.0f;
-	LastPlayerCheck += DeltaTime;
-	if (LastPlayerCheck >= 5.0f) // Check every 5 seconds
+	PlayerCheckTimer += DeltaTime;
+	if (PlayerCheckTimer >= 5.0f) // Check every 5 seconds
 	{
-		LastPlayerCheck = 0.0f;
+		PlayerCheckTimer = 0.0f;
 		if (IsPlayerNearby())
 		{
 			// Small chance to trigger nearby chatter
@@ -173,6 +194,11 @@ void URfsnAmbientChatter::ResetIdleTimer()
 
 bool URfsnAmbientChatter::IsPlayerNearby() const
 {
+	if (ProximityZone != INDEX_NONE)
+	{
+		return bPlayerNearby;
+	}
+
 	APlayerController* PC = UGameplayStatics::GetPlayerController(GetWorld(), 0);
 	if (!PC || !PC->GetPawn())
 	{
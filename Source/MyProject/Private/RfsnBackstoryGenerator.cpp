@@ -89,6 +89,13 @@ void URfsnBackstoryGenerator::GenerateBackstory()
 	// Build JSON
 	FString JsonPayload = BuildRequestJson(Request);
 
+	if (RequestHandler.IsBound())
+	{
+		RFSN_LOG(TEXT("Sending backstory generation request for %s to the request handler"), *Request.NpcId);
+		RequestHandler.Execute(this, JsonPayload);
+		return;
+	}
+
 	// Send HTTP request
 	TSharedRef<IHttpRequest, ESPMode::ThreadSafe> HttpRequest = FHttpModule::Get().CreateRequest();
 	HttpRequest->SetURL(BackstoryEndpoint);
@@ -96,14 +103,22 @@ void URfsnBackstoryGenerator::GenerateBackstory()
 	HttpRequest->SetHeader(TEXT("Content-Type"), TEXT("application/json"));
 	HttpRequest->SetContentAsString(JsonPayload);
 
+	// Weak capture: pregenerated requests can outlive NPCs streamed out during level load
+	TWeakObjectPtr<URfsnBackstoryGenerator> WeakThis(this);
 	HttpRequest->OnProcessRequestComplete().BindLambda(
-	    [this](FHttpRequestPtr Req, FHttpResponsePtr Res, bool bSuccess)
+	    [WeakThis](FHttpRequestPtr Req, FHttpResponsePtr Res, bool bSuccess)
 	    {
 		    FString Response = bSuccess && Res.IsValid() ? Res->GetContentAsString() : TEXT("");
 
 		    // Must run on game thread
 		    AsyncTask(ENamedThreads::GameThread,
-		              [this, bSuccess, Response]() { OnBackstoryRequestComplete(bSuccess, Response); });
+		              [WeakThis, bSuccess, Response]()
+		              {
+			              if (URfsnBackstoryGenerator* Generator = WeakThis.Get())
+			              {
+				              Generator->OnBackstoryRequestComplete(bSuccess, Response);
+			              }
+		              });
 	    });
 
 	HttpRequest->ProcessRequest();
@@ -141,9 +156,11 @@ FString URfsnBackstoryGenerator::BuildRequestJson(const FRfsnBackstoryRequest& R
 void URfsnBackstoryGenerator::OnBackstoryRequestComplete(bool bSuccess, const FString& Response)
 {
 	bIsGenerating = false;
+	bool bGenerated = true;
 
 	if (!bSuccess || Response.IsEmpty())
 	{
+		bGenerated = false;
 		RFSN_ERROR(TEXT("Backstory generation failed, using fallback"));
 		CachedBackstory = GenerateFallbackBackstory();
 		OnBackstoryError.Broadcast(TEXT("Connection failed"));
@@ -152,6 +169,7 @@ void URfsnBackstoryGenerator::OnBackstoryRequestComplete(bool bSuccess, const FS
 	{
 		if (!ParseBackstoryResponse(Response, CachedBackstory))
 		{
+			bGenerated = false;
 			RFSN_ERROR(TEXT("Failed to parse backstory response, using fallback"));
 			CachedBackstory = GenerateFallbackBackstory();
 			OnBackstoryError.Broadcast(TEXT("Parse failed"));
@@ -168,10 +186,19 @@ void URfsnBackstoryGenerator::OnBackstoryRequestComplete(bool bSuccess, const FS
 
 	// Notify listeners
 	OnBackstoryGenerated.Broadcast(CachedBackstory);
+	OnRequestFinished.Broadcast(this, bGenerated);
 
 	RFSN_LOG(TEXT("Backstory generated for %s: %s"), *CachedBackstory.NpcId, *CachedBackstory.Summary.Left(100));
 }
 
+void URfsnBackstoryGenerator::CompleteRequest(bool bSuccess, const FString& Response)
+{
+	if (bIsGenerating)
+	{
+		OnBackstoryRequestComplete(bSuccess, Response);
+	}
+}
+
 bool URfsnBackstoryGenerator::ParseBackstoryResponse(const FString& JsonResponse, FRfsnNpcBackstory& OutBackstory)
 {
 	TSharedPtr<FJsonObject> JsonObj;
@@ -348,8 +375,6 @@ void URfsnBackstoryGenerator::SaveBackstory()
 		return;
 	}
 
-	FString SlotName = GetSaveSlotName();
-
 	// Save as JSON to a file
 	TSharedRef<FJsonObject> JsonObj = MakeShared<FJsonObject>();
 	JsonObj->SetStringField(TEXT("npc_id"), CachedBackstory.NpcId);
@@ -387,7 +412,7 @@ void URfsnBackstoryGenerator::SaveBackstory()
 	TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&OutputString);
 	FJsonSerializer::Serialize(JsonObj, Writer);
 
-	FString SavePath = FPaths::ProjectSavedDir() / TEXT("Backstories") / SlotName + TEXT(".json");
+	FString SavePath = GetSavePath();
 	FFileHelper::SaveStringToFile(OutputString, *SavePath);
 
 	RFSN_LOG(TEXT("Saved backstory to %s"), *SavePath);
@@ -395,8 +420,7 @@ void URfsnBackstoryGenerator::SaveBackstory()
 
 bool URfsnBackstoryGenerator::LoadBackstory()
 {
-	FString SlotName = GetSaveSlotName();
-	FString SavePath = FPaths::ProjectSavedDir() / TEXT("Backstories") / SlotName + TEXT(".json");
+	FString SavePath = GetSavePath();
 
 	FString JsonString;
 	if (!FFileHelper::LoadFileToString(JsonString, *SavePath))
@@ -419,18 +443,14 @@ void URfsnBackstoryGenerator::ClearBackstory()
 	bHasInteracted = false;
 
 	// Delete save file
-	FString SlotName = GetSaveSlotName();
-	FString SavePath = FPaths::ProjectSavedDir() / TEXT("Backstories") / SlotName + TEXT(".json");
-	IFileManager::Get().Delete(*SavePath);
+	IFileManager::Get().Delete(*GetSavePath());
 
 	RFSN_LOG(TEXT("Cleared backstory for %s"), *GetOwner()->GetName());
 }
 
 bool URfsnBackstoryGenerator::DoesSaveExist() const
 {
-	FString SlotName = GetSaveSlotName();
-	FString SavePath = FPaths::ProjectSavedDir() / TEXT("Backstories") / SlotName + TEXT(".json");
-	return FPaths::FileExists(SavePath);
+	return FPaths::FileExists(GetSavePath());
 }
 
 FString URfsnBackstoryGenerator::GetSaveSlotName() const
@@ -439,6 +459,11 @@ FString URfsnBackstoryGenerator::GetSaveSlotName() const
 	return FString::Printf(TEXT("Backstory_%s"), *NpcId);
 }
 
+FString URfsnBackstoryGenerator::GetSavePath() const
+{
+	return FPaths::ProjectSavedDir() / TEXT("Backstories") / GetSaveSlotName() + TEXT(".json");
+}
+
 void URfsnBackstoryGenerator::SeedTemporalMemory(URfsnTemporalMemory* Memory)
 {
 	if (!Memory || !HasBackstory())
@@ -0,0 +1,214 @@
+// RFSN Backstory Pregenerator Implementation
+
+#include "RfsnBackstoryPregenerator.h"
+#include "RfsnBackstoryGenerator.h"
+#include "RfsnLogging.h"
+#include "EngineUtils.h"
+#include "Engine/World.h"
+#include "GameFramework/PlayerStart.h"
+#include "Kismet/GameplayStatics.h"
+#include "TimerManager.h"
+
+void URfsnBackstoryPregenerator::Deinitialize()
+{
+	CancelPregeneration();
+	SetInFlightCheck(false);
+
+	for (const TPair<TWeakObjectPtr<URfsnBackstoryGenerator>, double>& Pair : InFlight)
+	{
+		if (URfsnBackstoryGenerator* Generator = Pair.Key.Get())
+		{
+			Generator->OnRequestFinished.RemoveAll(this);
+		}
+	}
+	InFlight.Empty();
+
+	Super::Deinitialize();
+}
+
+void URfsnBackstoryPregenerator::OnWorldBeginPlay(UWorld& InWorld)
+{
+	Super::OnWorldBeginPlay(InWorld);
+
+	if (bPregenerateOnLevelLoad)
+	{
+		// Wait one tick so every generator has run BeginPlay and loaded its save
+		InWorld.GetTimerManager().SetTimerForNextTick(this, &URfsnBackstoryPregenerator::StartPregeneration);
+	}
+}
+
+void URfsnBackstoryPregenerator::StartPregeneration()
+{
+	UWorld* World = GetWorld();
+	if (!World || IsPregenerating())
+	{
+		return;
+	}
+
+	Stats = FRfsnBackstoryPregenStats();
+	LatencySumMs = 0.0f;
+	PassStartTime = FPlatformTime::Seconds();
+
+	// Collect NPCs with no saved backstory, keyed by distance to the player spawn
+	const FVector Origin = GetPriorityOrigin();
+	TArray<TPair<float, URfsnBackstoryGenerator*>> Candidates;
+
+	for (TActorIterator<AActor> It(World); It; ++It)
+	{
+		URfsnBackstoryGenerator* Generator = It->FindComponentByClass<URfsnBackstoryGenerator>();
+		if (!Generator || Generator->HasBackstory() || Generator->IsGenerating())
+		{
+			continue;
+		}
+
+		Candidates.Emplace(FVector::DistSquared(Origin, It->GetActorLocation()), Generator);
+	}
+
+	// Farthest first so the nearest NPC can be popped off the end
+	Candidates.Sort([](const TPair<float, URfsnBackstoryGenerator*>& A, const TPair<float, URfsnBackstoryGenerator*>& B)
+	                { return A.Key > B.Key; });
+
+	const int32 FirstIndex = MaxQueuedNpcs > 0 ? FMath::Max(0, Candidates.Num() - MaxQueuedNpcs) : 0;
+	PendingQueue.Reset(Candidates.Num() - FirstIndex);
+	for (int32 i = FirstIndex; i < Candidates.Num(); i++)
+	{
+		PendingQueue.Add(Candidates[i].Value);
+	}
+
+	Stats.Queued = PendingQueue.Num();
+
+	if (PendingQueue.Num() == 0)
+	{
+		RFSN_LOG(TEXT("Backstory pregeneration: all NPCs already have backstories"));
+		return;
+	}
+
+	RFSN_LOG(TEXT("Backstory pregeneration: %d NPCs queued (%d skipped by cap), %d concurrent"), Stats.Queued,
+	         FirstIndex, MaxConcurrentRequests);
+
+	PumpQueue();
+}
+
+void URfsnBackstoryPregenerator::CancelPregeneration()
+{
+	Stats.Skipped += PendingQueue.Num();
+	PendingQueue.Empty();
+}
+
+FVector URfsnBackstoryPregenerator::GetPriorityOrigin() const
+{
+	if (APawn* PlayerPawn = UGameplayStatics::GetPlayerPawn(this, 0))
+	{
+		return PlayerPawn->GetActorLocation();
+	}
+
+	if (UWorld* World = GetWorld())
+	{
+		for (TActorIterator<APlayerStart> It(World); It; ++It)
+		{
+			return It->GetActorLocation();
+		}
+	}
+
+	return FVector::ZeroVector;
+}
+
+void URfsnBackstoryPregenerator::PumpQueue()
+{
+	// Release slots held by NPCs destroyed mid-request
+	for (auto It = InFlight.CreateIterator(); It; ++It)
+	{
+		if (!It.Key().IsValid())
+		{
+			Stats.Skipped++;
+			It.RemoveCurrent();
+		}
+	}
+
+	while (InFlight.Num() < MaxConcurrentRequests && PendingQueue.Num() > 0)
+	{
+		URfsnBackstoryGenerator* Generator = PendingQueue.Pop(EAllowShrinking::No).Get();
+
+		// Destroyed, or already served by a lazy OnFirstInteraction request
+		if (!Generator || Generator->HasBackstory() || Generator->IsGenerating())
+		{
+			Stats.Skipped++;
+			continue;
+		}
+
+		Generator->OnRequestFinished.AddUObject(this, &URfsnBackstoryPregenerator::HandleRequestFinished);
+		InFlight.Add(Generator, FPlatformTime::Seconds());
+		Generator->GenerateBackstory();
+	}
+
+	// A destroyed NPC never reports back, so its slot is only found by checking again
+	SetInFlightCheck(InFlight.Num() > 0);
+
+	if (InFlight.Num() == 0 && PendingQueue.Num() == 0)
+	{
+		FinishPass();
+	}
+}
+
+void URfsnBackstoryPregenerator::SetInFlightCheck(bool bEnable)
+{
+	UWorld* World = GetWorld();
+	if (!World)
+	{
+		return;
+	}
+
+	FTimerManager& TimerManager = World->GetTimerManager();
+	if (!bEnable)
+	{
+		TimerManager.ClearTimer(InFlightCheckTimer);
+	}
+	else if (!TimerManager.IsTimerActive(InFlightCheckTimer))
+	{
+		TimerManager.SetTimer(InFlightCheckTimer, this, &URfsnBackstoryPregenerator::PumpQueue, 1.0f, true);
+	}
+}
+
+void URfsnBackstoryPregenerator::HandleRequestFinished(URfsnBackstoryGenerator* Generator, bool bSuccess)
+{
+	Generator->OnRequestFinished.RemoveAll(this);
+
+	double StartTime = 0.0;
+	if (!InFlight.RemoveAndCopyValue(Generator, StartTime))
+	{
+		return;
+	}
+
+	LatencySumMs += static_cast<float>((FPlatformTime::Seconds() - StartTime) * 1000.0);
+
+	if (bSuccess)
+	{
+		Stats.Completed++;
+	}
+	else
+	{
+		Stats.Failed++;
+
+		if (bAbortOnFailure && PendingQueue.Num() > 0)
+		{
+			RFSN_WARNING(TEXT("Backstory pregeneration: request failed, leaving %d NPCs to lazy generation"),
+			             PendingQueue.Num());
+			CancelPregeneration();
+		}
+	}
+
+	const int32 Finished = Stats.Completed + Stats.Failed;
+	Stats.AverageLatencyMs = LatencySumMs / Finished;
+
+	PumpQueue();
+}
+
+void URfsnBackstoryPregenerator::FinishPass()
+{
+	Stats.TotalSeconds = static_cast<float>(FPlatformTime::Seconds() - PassStartTime);
+
+	RFSN_LOG(TEXT("Backstory pregeneration done in %.2fs: %d generated, %d fallback, %d skipped (avg %.0fms)"),
+	         Stats.TotalSeconds, Stats.Completed, Stats.Failed, Stats.Skipped, Stats.AverageLatencyMs);
+
+	OnPregenerationComplete.Broadcast(Stats);
+}
@@ -0,0 +1,626 @@
+// RFSN Shared Bark Libraries Implementation
+
+#include "RfsnBarkLibrary.h"
+#include "Hash/CityHash.h"
+#include "Misc/ScopeLock.h"
+
+// ─────────────────────────────────────────────────────────────
+// FRfsnInstantBarkSet
+// ─────────────────────────────────────────────────────────────
+
+FRfsnInstantBarkSet::FRfsnInstantBarkSet(const FRfsnBarkLibrary& Source)
+{
+	for (int32 i = 0; i < NumCategories; i++)
+	{
+		Buckets[i] = FRfsnBarkLibraryRegistry::GetLibraryBucket(Source, static_cast<ERfsnBarkCategory>(i));
+		Buckets[i].Shrink();
+	}
+}
+
+SIZE_T FRfsnInstantBarkSet::GetAllocatedSize() const
+{
+	SIZE_T Size = sizeof(*this);
+	for (const TArray<FRfsnInstantBarkEntry>& Bucket : Buckets)
+	{
+		Size += Bucket.GetAllocatedSize();
+		for (const FRfsnInstantBarkEntry& Entry : Bucket)
+		{
+			Size += Entry.Text.GetAllocatedSize();
+		}
+	}
+	return Size;
+}
+
+// ─────────────────────────────────────────────────────────────
+// FRfsnNpcBarkSet
+// ─────────────────────────────────────────────────────────────
+
+FRfsnNpcBarkSet::FRfsnNpcBarkSet(const TArray<FRfsnBark>& Source)
+{
+	// Indices are stored as uint16 in per-NPC state
+	const int32 Count = FMath::Min(Source.Num(), static_cast<int32>(MAX_uint16) - 1);
+	ensureMsgf(Count == Source.Num(), TEXT("Bark library truncated to %d entries"), Count);
+
+	// Counting sort by trigger keeps authoring order within each bucket
+	int32 Counts[NumTriggers] = {};
+	for (int32 i = 0; i < Count; i++)
+	{
+		Counts[static_cast<int32>(Source[i].Trigger)]++;
+	}
+
+	BucketStart[0] = 0;
+	for (int32 t = 0; t < NumTriggers; t++)
+	{
+		BucketStart[t + 1] = BucketStart[t] + Counts[t];
+		MaxPriority[t] = 0;
+	}
+
+	Defs.SetNum(Count);
+	int32 Cursor[NumTriggers];
+	FMemory::Memcpy(Cursor, BucketStart, sizeof(Cursor));
+
+	for (int32 i = 0; i < Count; i++)
+	{
+		const FRfsnBark& Bark = Source[i];
+		const int32 Trigger = static_cast<int32>(Bark.Trigger);
+		const int32 Index = Cursor[Trigger]++;
+
+		FRfsnBarkDef& Def = Defs[Index];
+		Def.Trigger = Bark.Trigger;
+		Def.Text = Bark.Text;
+		Def.CustomTag = Bark.CustomTag;
+		Def.Priority = Bark.Priority;
+		Def.Cooldown = Bark.Cooldown;
+
+		MaxPriority[Trigger] = FMath::Max(MaxPriority[Trigger], Bark.Priority);
+
+		if (Bark.Trigger == ERfsnBarkTrigger::Custom)
+		{
+			CustomTagIndex.FindOrAdd(Bark.CustomTag.ToLower()).Add(static_cast<uint16>(Index));
+		}
+	}
+}
+
+const TArray<uint16>* FRfsnNpcBarkSet::FindCustomTag(const FString& CustomTag) const
+{
+	return CustomTagIndex.Find(CustomTag.ToLower());
+}
+
+void FRfsnNpcBarkSet::ToBarks(TArray<FRfsnBark>& OutBarks) const
+{
+	OutBarks.Reset(Defs.Num());
+	for (const FRfsnBarkDef& Def : Defs)
+	{
+		FRfsnBark& Bark = OutBarks.AddDefaulted_GetRef();
+		Bark.Trigger = Def.Trigger;
+		Bark.Text = Def.Text;
+		Bark.CustomTag = Def.CustomTag;
+		Bark.Priority = Def.Priority;
+		Bark.Cooldown = Def.Cooldown;
+	}
+}
+
+SIZE_T FRfsnNpcBarkSet::GetAllocatedSize() const
+{
+	SIZE_T Size = sizeof(*this) + Defs.GetAllocatedSize() + CustomTagIndex.GetAllocatedSize();
+	for (const FRfsnBarkDef& Def : Defs)
+	{
+		Size += Def.Text.GetAllocatedSize() + Def.CustomTag.GetAllocatedSize();
+	}
+	return Size;
+}
+
+// ─────────────────────────────────────────────────────────────
+// FRfsnBarkCooldownState
+// ─────────────────────────────────────────────────────────────
+
+void FRfsnBarkCooldownState::EnsureInitialized(const FRfsnNpcBarkSet& Set, float Now)
+{
+	if (SlotHead.Num() > 0 && Position.Num() == Set.Num())
+	{
+		return;
+	}
+
+	const int32 Count = Set.Num();
+	Order.SetNumUninitialized(Count);
+	Position.SetNumUninitialized(Count);
+	for (int32 i = 0; i < Count; i++)
+	{
+		Order[i] = static_cast<uint16>(i);
+		Position[i] = static_cast<uint16>(i);
+	}
+
+	AvailableCount.SetNumUninitialized(FRfsnNpcBarkSet::NumTriggers);
+	for (int32 t = 0; t < FRfsnNpcBarkSet::NumTriggers; t++)
+	{
+		AvailableCount[t] = static_cast<uint16>(Set.GetBucketSize(static_cast<ERfsnBarkTrigger>(t)));
+	}
+
+	SlotHead.Init(InvalidLink, NumWheelSlots);
+	NextInSlot.Init(InvalidLink, Count);
+	ExpiryTick.Init(0, Count);
+	WheelTick = FMath::FloorToInt(Now / WheelResolution);
+}
+
+void FRfsnBarkCooldownState::Advance(const FRfsnNpcBarkSet& Set, float Now)
+{
+	const int32 NowTick = FMath::FloorToInt(Now / WheelResolution);
+	const int32 Steps = NowTick - WheelTick;
+	if (Steps <= 0)
+	{
+		return;
+	}
+
+	// Sweep only the slots whose tick has passed; a full revolution covers everything
+	const int32 SlotsToSweep = FMath::Min(Steps, NumWheelSlots);
+	for (int32 s = 1; s <= SlotsToSweep; s++)
+	{
+		const int32 Slot = (WheelTick + s) & (NumWheelSlots - 1);
+		uint16* Link = &SlotHead[Slot];
+		while (*Link != InvalidLink)
+		{
+			const uint16 BarkIndex = *Link;
+			if (ExpiryTick[BarkIndex] <= NowTick)
+			{
+				*Link = NextInSlot[BarkIndex];
+				NextInSlot[BarkIndex] = InvalidLink;
+				Release(Set, BarkIndex);
+			}
+			else
+			{
+				Link = &NextInSlot[BarkIndex];
+			}
+		}
+	}
+
+	WheelTick = NowTick;
+}
+
+void FRfsnBarkCooldownState::Release(const FRfsnNpcBarkSet& Set, int32 BarkIndex)
+{
+	const ERfsnBarkTrigger Trigger = Set.GetDef(BarkIndex).Trigger;
+	const int32 TriggerIndex = static_cast<int32>(Trigger);
+
+	// Swap into the first cooling position and grow the available partition
+	const int32 FirstCooling = Set.GetBucketStart(Trigger) + AvailableCount[TriggerIndex];
+	const int32 Pos = Position[BarkIndex];
+	const uint16 Other = Order[FirstCooling];
+
+	Order[Pos] = Other;
+	Position[Other] = static_cast<uint16>(Pos);
+	Order[FirstCooling] = static_cast<uint16>(BarkIndex);
+	Position[BarkIndex] = static_cast<uint16>(FirstCooling);
+
+	AvailableCount[TriggerIndex]++;
+}
+
+void FRfsnBarkCooldownState::Unlink(int32 BarkIndex)
+{
+	uint16* Link = &SlotHead[ExpiryTick[BarkIndex] & (NumWheelSlots - 1)];
+	while (*Link != InvalidLink)
+	{
+		if (*Link == BarkIndex)
+		{
+			*Link = NextInSlot[BarkIndex];
+			NextInSlot[BarkIndex] = InvalidLink;
+			return;
+		}
+		Link = &NextInSlot[*Link];
+	}
+}
+
+bool FRfsnBarkCooldownState::IsAvailable(const FRfsnNpcBarkSet& Set, int32 BarkIndex, float Now)
+{
+	EnsureInitialized(Set, Now);
+	Advance(Set, Now);
+
+	const ERfsnBarkTrigger Trigger = Set.GetDef(BarkIndex).Trigger;
+	return Position[BarkIndex] < Set.GetBucketStart(Trigger) + AvailableCount[static_cast<int32>(Trigger)];
+}
+
+void FRfsnBarkCooldownState::MarkUsed(const FRfsnNpcBarkSet& Set, int32 BarkIndex, float Now)
+{
+	if (!IsAvailable(Set, BarkIndex, Now))
+	{
+		// Forced reuse while cooling: restart the cooldown from now
+		Unlink(BarkIndex);
+		Release(Set, BarkIndex);
+	}
+
+	const FRfsnBarkDef& Def = Set.GetDef(BarkIndex);
+	const int32 Expiry = FMath::CeilToInt((Now + Def.Cooldown) / WheelResolution);
+	if (Expiry <= WheelTick)
+	{
+		return;
+	}
+
+	// Swap out of the available partition
+	const int32 TriggerIndex = static_cast<int32>(Def.Trigger);
+	const int32 LastAvailable = Set.GetBucketStart(Def.Trigger) + AvailableCount[TriggerIndex] - 1;
+	const int32 Pos = Position[BarkIndex];
+	const uint16 Other = Order[LastAvailable];
+
+	Order[Pos] = Other;
+	Position[Other] = static_cast<uint16>(Pos);
+	Order[LastAvailable] = static_cast<uint16>(BarkIndex);
+	Position[BarkIndex] = static_cast<uint16>(LastAvailable);
+
+	AvailableCount[TriggerIndex]--;
+
+	// Push onto the wheel slot for its expiry tick
+	const int32 Slot = Expiry & (NumWheelSlots - 1);
+	ExpiryTick[BarkIndex] = Expiry;
+	NextInSlot[BarkIndex] = SlotHead[Slot];
+	SlotHead[Slot] = static_cast<uint16>(BarkIndex);
+}
+
+int32 FRfsnBarkCooldownState::Pick(const FRfsnNpcBarkSet& Set, ERfsnBarkTrigger Trigger, float Now)
+{
+	EnsureInitialized(Set, Now);
+	Advance(Set, Now);
+
+	const int32 Count = AvailableCount[static_cast<int32>(Trigger)];
+	if (Count == 0)
+	{
+		return INDEX_NONE;
+	}
+
+	const int32 Start = Set.GetBucketStart(Trigger);
+	const int32 MaxPriority = Set.GetMaxPriority(Trigger);
+	if (MaxPriority <= 0)
+	{
+		return Order[Start + Count - 1];
+	}
+
+	// Rejection sampling gives the same distribution as a cumulative priority roll
+	// in expected O(MaxPriority / AveragePriority) draws, independent of bucket size
+	const int32 MaxAttempts = 32;
+	int32 Candidate = INDEX_NONE;
+	for (int32 Attempt = 0; Attempt < MaxAttempts; Attempt++)
+	{
+		Candidate = Order[Start + FMath::RandRange(0, Count - 1)];
+		if (FMath::RandRange(1, MaxPriority) <= Set.GetDef(Candidate).Priority)
+		{
+			break;
+		}
+	}
+
+	return Candidate;
+}
+
+int32 FRfsnBarkCooldownState::PickUniform(const FRfsnNpcBarkSet& Set, ERfsnBarkTrigger Trigger, float Now)
+{
+	EnsureInitialized(Set, Now);
+	Advance(Set, Now);
+
+	const int32 Count = AvailableCount[static_cast<int32>(Trigger)];
+	if (Count == 0)
+	{
+		return INDEX_NONE;
+	}
+
+	return Order[Set.GetBucketStart(Trigger) + FMath::RandRange(0, Count - 1)];
+}
+
+void FRfsnBarkCooldownState::Reset()
+{
+	Order.Empty();
+	Position.Empty();
+	AvailableCount.Empty();
+	SlotHead.Empty();
+	NextInSlot.Empty();
+	ExpiryTick.Empty();
+	WheelTick = 0;
+}
+
+SIZE_T FRfsnBarkCooldownState::GetAllocatedSize() const
+{
+	return Order.GetAllocatedSize() + Position.GetAllocatedSize() + AvailableCount.GetAllocatedSize() +
+	       SlotHead.GetAllocatedSize() + NextInSlot.GetAllocatedSize() + ExpiryTick.GetAllocatedSize();
+}
+
+// ─────────────────────────────────────────────────────────────
+// FRfsnBarkLibraryRegistry
+// ─────────────────────────────────────────────────────────────
+
+namespace RfsnBarkRegistry
+{
+FCriticalSection Lock;
+TMap<uint64, TWeakPtr<const FRfsnInstantBarkSet, ESPMode::ThreadSafe>> InstantSets;
+TMap<uint64, TWeakPtr<const FRfsnNpcBarkSet, ESPMode::ThreadSafe>> NpcSets;
+
+uint64 HashString(const FString& Str, uint64 Seed)
+{
+	return CityHash64WithSeed(reinterpret_cast<const char*>(*Str), Str.Len() * sizeof(TCHAR), Seed);
+}
+
+template <typename T>
+uint64 HashValue(const T& Value, uint64 Seed)
+{
+	return CityHash64WithSeed(reinterpret_cast<const char*>(&Value), sizeof(T), Seed);
+}
+} // namespace RfsnBarkRegistry
+
+FRfsnInstantBarkSetRef FRfsnBarkLibraryRegistry::AcquireInstantBarks(const FRfsnBarkLibrary& Authored)
+{
+	const FRfsnBarkLibrary& Source = IsEmpty(Authored) ? GetDefaultInstantBarks() : Authored;
+	const uint64 Hash = HashLibrary(Source);
+
+	FScopeLock ScopeLock(&RfsnBarkRegistry::Lock);
+
+	if (TWeakPtr<const FRfsnInstantBarkSet, ESPMode::ThreadSafe>* Existing = RfsnBarkRegistry::InstantSets.Find(Hash))
+	{
+		if (TSharedPtr<const FRfsnInstantBarkSet, ESPMode::ThreadSafe> Pinned = Existing->Pin())
+		{
+			return Pinned.ToSharedRef();
+		}
+	}
+
+	FRfsnInstantBarkSetRef NewSet = MakeShared<FRfsnInstantBarkSet, ESPMode::ThreadSafe>(Source);
+	RfsnBarkRegistry::InstantSets.Add(Hash, NewSet);
+	return NewSet;
+}
+
+FRfsnNpcBarkSetRef FRfsnBarkLibraryRegistry::AcquireNpcBarks(const TArray<FRfsnBark>& Authored)
+{
+	const TArray<FRfsnBark>& Source = Authored.Num() == 0 ? GetDefaultNpcBarks() : Authored;
+	const uint64 Hash = HashBarks(Source);
+
+	FScopeLock ScopeLock(&RfsnBarkRegistry::Lock);
+
+	if (TWeakPtr<const FRfsnNpcBarkSet, ESPMode::ThreadSafe>* Existing = RfsnBarkRegistry::NpcSets.Find(Hash))
+	{
+		if (TSharedPtr<const FRfsnNpcBarkSet, ESPMode::ThreadSafe> Pinned = Existing->Pin())
+		{
+			return Pinned.ToSharedRef();
+		}
+	}
+
+	FRfsnNpcBarkSetRef NewSet = MakeShared<FRfsnNpcBarkSet, ESPMode::ThreadSafe>(Source);
+	RfsnBarkRegistry::NpcSets.Add(Hash, NewSet);
+	return NewSet;
+}
+
+int32 FRfsnBarkLibraryRegistry::GetNumLiveSets()
+{
+	FScopeLock ScopeLock(&RfsnBarkRegistry::Lock);
+
+	int32 Live = 0;
+	for (const auto& Pair : RfsnBarkRegistry::InstantSets)
+	{
+		Live += Pair.Value.IsValid() ? 1 : 0;
+	}
+	for (const auto& Pair : RfsnBarkRegistry::NpcSets)
+	{
+		Live += Pair.Value.IsValid() ? 1 : 0;
+	}
+	return Live;
+}
+
+bool FRfsnBarkLibraryRegistry::IsEmpty(const FRfsnBarkLibrary& Library)
+{
+	for (int32 i = 0; i < FRfsnInstantBarkSet::NumCategories; i++)
+	{
+		if (GetLibraryBucket(Library, static_cast<ERfsnBarkCategory>(i)).Num() > 0)
+		{
+			return false;
+		}
+	}
+	return true;
+}
+
+const TArray<FRfsnInstantBarkEntry>& FRfsnBarkLibraryRegistry::GetLibraryBucket(const FRfsnBarkLibrary& Library,
+                                                                               ERfsnBarkCategory Category)
+{
+	return GetLibraryBucket(const_cast<FRfsnBarkLibrary&>(Library), Category);
+}
+
+TArray<FRfsnInstantBarkEntry>& FRfsnBarkLibraryRegistry::GetLibraryBucket(FRfsnBarkLibrary& Library,
+                                                                         ERfsnBarkCategory Category)
+{
+	switch (Category)
+	{
+	case ERfsnBarkCategory::Greet:
+		return Library.GreetBarks;
+	case ERfsnBarkCategory::Threaten:
+		return Library.ThreatenBarks;
+	case ERfsnBarkCategory::Agree:
+		return Library.AgreeBarks;
+	case ERfsnBarkCategory::Disagree:
+		return Library.DisagreeBarks;
+	case ERfsnBarkCategory::Question:
+		return Library.QuestionBarks;
+	case ERfsnBarkCategory::Help:
+		return Library.HelpBarks;
+	case ERfsnBarkCategory::Trade:
+		return Library.TradeBarks;
+	case ERfsnBarkCategory::Farewell:
+		return Library.FarewellBarks;
+	case ERfsnBarkCategory::Combat:
+		return Library.CombatBarks;
+	case ERfsnBarkCategory::Surprise:
+		return Library.SurpriseBarks;
+	case ERfsnBarkCategory::Grateful:
+		return Library.GratefulBarks;
+	case ERfsnBarkCategory::Idle:
+	default:
+		return Library.IdleBarks;
+	}
+}
+
+uint64 FRfsnBarkLibraryRegistry::HashLibrary(const FRfsnBarkLibrary& Library)
+{
+	uint64 Hash = 0;
+	for (int32 i = 0; i < FRfsnInstantBarkSet::NumCategories; i++)
+	{
+		const TArray<FRfsnInstantBarkEntry>& Bucket = GetLibraryBucket(Library, static_cast<ERfsnBarkCategory>(i));
+		Hash = RfsnBarkRegistry::HashValue(Bucket.Num(), Hash);
+		for (const FRfsnInstantBarkEntry& Entry : Bucket)
+		{
+			Hash = RfsnBarkRegistry::HashString(Entry.Text, Hash);
+			Hash = RfsnBarkRegistry::HashValue(Entry.Audio, Hash);
+			Hash = RfsnBarkRegistry::HashValue(Entry.DurationMs, Hash);
+		}
+	}
+	return Hash;
+}
+
+uint64 FRfsnBarkLibraryRegistry::HashBarks(const TArray<FRfsnBark>& Barks)
+{
+	uint64 Hash = RfsnBarkRegistry::HashValue(Barks.Num(), 0);
+	for (const FRfsnBark& Bark : Barks)
+	{
+		Hash = RfsnBarkRegistry::HashValue(Bark.Trigger, Hash);
+		Hash = RfsnBarkRegistry::HashString(Bark.Text, Hash);
+		Hash = RfsnBarkRegistry::HashString(Bark.CustomTag, Hash);
+		Hash = RfsnBarkRegistry::HashValue(Bark.Priority, Hash);
+		Hash = RfsnBarkRegistry::HashValue(Bark.Cooldown, Hash);
+	}
+	return Hash;
+}
+
+const FRfsnBarkLibrary& FRfsnBarkLibraryRegistry::GetDefaultInstantBarks()
+{
+	static const FRfsnBarkLibrary Defaults = []()
+	{
+		FRfsnBarkLibrary Library;
+
+		// Greet
+		Library.GreetBarks.Add(FRfsnInstantBarkEntry{TEXT("Hey there!"), nullptr, 400});
+		Library.GreetBarks.Add(FRfsnInstantBarkEntry{TEXT("Well, hello!"), nullptr, 450});
+		Library.GreetBarks.Add(FRfsnInstantBarkEntry{TEXT("Ah, you again."), nullptr, 500});
+
+		// Threaten
+		Library.ThreatenBarks.Add(FRfsnInstantBarkEntry{TEXT("You asked for it!"), nullptr, 600});
+		Library.ThreatenBarks.Add(FRfsnInstantBarkEntry{TEXT("Don't test me."), nullptr, 500});
+		Library.ThreatenBarks.Add(FRfsnInstantBarkEntry{TEXT("I'm warning you."), nullptr, 550});
+
+		// Agree
+		Library.AgreeBarks.Add(FRfsnInstantBarkEntry{TEXT("Alright then."), nullptr, 400});
+		Library.AgreeBarks.Add(FRfsnInstantBarkEntry{TEXT("Fair enough."), nullptr, 400});
+		Library.AgreeBarks.Add(FRfsnInstantBarkEntry{TEXT("You got it."), nullptr, 350});
+
+		// Disagree
+		Library.DisagreeBarks.Add(FRfsnInstantBarkEntry{TEXT("I don't think so."), nullptr, 500});
+		Library.DisagreeBarks.Add(FRfsnInstantBarkEntry{TEXT("No way."), nullptr, 300});
+		Library.DisagreeBarks.Add(FRfsnInstantBarkEntry{TEXT("Not a chance."), nullptr, 450});
+
+		// Question
+		Library.QuestionBarks.Add(FRfsnInstantBarkEntry{TEXT("Hmm, let me think..."), nullptr, 600});
+		Library.QuestionBarks.Add(FRfsnInstantBarkEntry{TEXT("Good question."), nullptr, 400});
+		Library.QuestionBarks.Add(FRfsnInstantBarkEntry{TEXT("Well..."), nullptr, 300});
+
+		// Help
+		Library.HelpBarks.Add(FRfsnInstantBarkEntry{TEXT("Of course!"), nullptr, 350});
+		Library.HelpBarks.Add(FRfsnInstantBarkEntry{TEXT("I can help with that."), nullptr, 600});
+		Library.HelpBarks.Add(FRfsnInstantBarkEntry{TEXT("Let's see..."), nullptr, 400});
+
+		// Trade
+		Library.TradeBarks.Add(FRfsnInstantBarkEntry{TEXT("Looking to trade?"), nullptr, 500});
+		Library.TradeBarks.Add(FRfsnInstantBarkEntry{TEXT("Let's see what you've got."), nullptr, 600});
+		Library.TradeBarks.Add(FRfsnInstantBarkEntry{TEXT("Business, eh?"), nullptr, 400});
+
+		// Farewell
+		Library.FarewellBarks.Add(FRfsnInstantBarkEntry{TEXT("Take care."), nullptr, 350});
+		Library.FarewellBarks.Add(FRfsnInstantBarkEntry{TEXT("Until next time."), nullptr, 450});
+		Library.FarewellBarks.Add(FRfsnInstantBarkEntry{TEXT("Safe travels."), nullptr, 400});
+
+		// Idle
+		Library.IdleBarks.Add(FRfsnInstantBarkEntry{TEXT("Hmm."), nullptr, 200});
+		Library.IdleBarks.Add(FRfsnInstantBarkEntry{TEXT("..."), nullptr, 100});
+
+		// Combat
+		Library.CombatBarks.Add(FRfsnInstantBarkEntry{TEXT("Die!"), nullptr, 250});
+		Library.CombatBarks.Add(FRfsnInstantBarkEntry{TEXT("Take that!"), nullptr, 300});
+		Library.CombatBarks.Add(FRfsnInstantBarkEntry{TEXT("You'll regret this!"), nullptr, 500});
+
+		// Surprise
+		Library.SurpriseBarks.Add(FRfsnInstantBarkEntry{TEXT("What the—"), nullptr, 350});
+		Library.SurpriseBarks.Add(FRfsnInstantBarkEntry{TEXT("Whoa!"), nullptr, 250});
+		Library.SurpriseBarks.Add(FRfsnInstantBarkEntry{TEXT("Huh?"), nullptr, 200});
+
+		// Grateful
+		Library.GratefulBarks.Add(FRfsnInstantBarkEntry{TEXT("Thanks!"), nullptr, 300});
+		Library.GratefulBarks.Add(FRfsnInstantBarkEntry{TEXT("Much appreciated."), nullptr, 450});
+		Library.GratefulBarks.Add(FRfsnInstantBarkEntry{TEXT("You're too kind."), nullptr, 450});
+
+		return Library;
+	}();
+
+	return Defaults;
+}
+
+const TArray<FRfsnBark>& FRfsnBarkLibraryRegistry::GetDefaultNpcBarks()
+{
+	static const TArray<FRfsnBark> Defaults = []()
+	{
+		TArray<FRfsnBark> Barks;
+		auto AddBark = [&Barks](ERfsnBarkTrigger Trigger, const TCHAR* Text, int32 Priority, float Cooldown)
+		{
+			FRfsnBark& Bark = Barks.AddDefaulted_GetRef();
+			Bark.Trigger = Trigger;
+			Bark.Text = Text;
+			Bark.Priority = Priority;
+			Bark.Cooldown = Cooldown;
+		};
+
+		// Idle
+		AddBark(ERfsnBarkTrigger::Idle, TEXT("*sigh*"), 3, 60.0f);
+		AddBark(ERfsnBarkTrigger::Idle, TEXT("Hmm..."), 3, 60.0f);
+		AddBark(ERfsnBarkTrigger::Idle, TEXT("What a day..."), 3, 60.0f);
+		AddBark(ERfsnBarkTrigger::Idle, TEXT("Stay alert..."), 4, 60.0f);
+
+		// Greetings
+		AddBark(ERfsnBarkTrigger::Greeting, TEXT("Hey there."), 5, 30.0f);
+		AddBark(ERfsnBarkTrigger::Greeting, TEXT("Oh, hello."), 5, 30.0f);
+		AddBark(ERfsnBarkTrigger::Greeting, TEXT("You again?"), 4, 30.0f);
+
+		// Farewells
+		AddBark(ERfsnBarkTrigger::Farewell, TEXT("See you around."), 5, 30.0f);
+		AddBark(ERfsnBarkTrigger::Farewell, TEXT("Take care."), 5, 30.0f);
+		AddBark(ERfsnBarkTrigger::Farewell, TEXT("Stay safe out there."), 5, 30.0f);
+
+		// Player near
+		AddBark(ERfsnBarkTrigger::PlayerNear, TEXT("Hmm?"), 4, 30.0f);
+		AddBark(ERfsnBarkTrigger::PlayerNear, TEXT("Need something?"), 5, 30.0f);
+
+		// Player leave
+		AddBark(ERfsnBarkTrigger::PlayerLeave, TEXT("Leaving already?"), 4, 30.0f);
+		AddBark(ERfsnBarkTrigger::PlayerLeave, TEXT("Watch yourself."), 4, 30.0f);
+
+		// Combat
+		AddBark(ERfsnBarkTrigger::Combat, TEXT("Get ready!"), 7, 15.0f);
+		AddBark(ERfsnBarkTrigger::Combat, TEXT("Here they come!"), 7, 15.0f);
+		AddBark(ERfsnBarkTrigger::Combat, TEXT("Fight!"), 6, 15.0f);
+
+		// Danger
+		AddBark(ERfsnBarkTrigger::Danger, TEXT("Watch out!"), 8, 10.0f);
+		AddBark(ERfsnBarkTrigger::Danger, TEXT("Something's wrong..."), 6, 20.0f);
+		AddBark(ERfsnBarkTrigger::Danger, TEXT("Did you hear that?"), 6, 20.0f);
+
+		// Weather
+		AddBark(ERfsnBarkTrigger::Weather, TEXT("This weather..."), 3, 120.0f);
+		AddBark(ERfsnBarkTrigger::Weather, TEXT("Hope it clears up."), 3, 120.0f);
+
+		// Time of day
+		AddBark(ERfsnBarkTrigger::TimeOfDay, TEXT("Another day begins."), 3, 300.0f);
+		AddBark(ERfsnBarkTrigger::TimeOfDay, TEXT("Getting dark..."), 4, 300.0f);
+		AddBark(ERfsnBarkTrigger::TimeOfDay, TEXT("Night falls."), 4, 300.0f);
+
+		// Pain
+		AddBark(ERfsnBarkTrigger::Pain, TEXT("Ugh!"), 8, 5.0f);
+		AddBark(ERfsnBarkTrigger::Pain, TEXT("That hurt!"), 7, 5.0f);
+
+		// Victory
+		AddBark(ERfsnBarkTrigger::Victory, TEXT("Got 'em!"), 6, 20.0f);
+		AddBark(ERfsnBarkTrigger::Victory, TEXT("That's that."), 5, 20.0f);
+
+		// Frustrated
+		AddBark(ERfsnBarkTrigger::Frustrated, TEXT("This is getting old..."), 4, 60.0f);
+		AddBark(ERfsnBarkTrigger::Frustrated, TEXT("*grumbles*"), 3, 60.0f);
+
+		return Barks;
+	}();
+
+	return Defaults;
+}
@@ -0,0 +1,40 @@
+// RFSN Benchmark Fixtures Implementation
+
+#include "RfsnBenchFixtures.h"
+
+namespace RfsnBench
+{
+TArray<int16> MakeSyntheticSpeech(int32 SampleRate)
+{
+	TArray<int16> Pcm;
+	FRandomStream Noise(42);
+
+	auto AddSegment = [&Pcm, SampleRate](float Seconds, TFunctionRef<float(float)> Generator)
+	{
+		const int32 Count = FMath::RoundToInt(Seconds * SampleRate);
+		for (int32 i = 0; i < Count; i++)
+		{
+			const float Sample = FMath::Clamp(Generator(static_cast<float>(i) / SampleRate), -1.0f, 1.0f);
+			Pcm.Add(static_cast<int16>(Sample * 32767.0f));
+		}
+	};
+
+	auto Silence = [](float) { return 0.0f; };
+	auto LowVowel = [](float T)
+	{
+		return 0.5f * FMath::Sin(UE_TWO_PI * 180.0f * T) + 0.2f * FMath::Sin(UE_TWO_PI * 360.0f * T) +
+		       0.1f * FMath::Sin(UE_TWO_PI * 540.0f * T);
+	};
+	auto OpenVowel = [](float T) { return 0.7f * FMath::Sin(UE_TWO_PI * 700.0f * T); };
+	auto Fricative = [&Noise](float) { return Noise.FRandRange(-0.15f, 0.15f); };
+
+	AddSegment(0.30f, Silence);
+	AddSegment(0.50f, LowVowel);
+	AddSegment(0.03f, Silence);
+	AddSegment(0.37f, OpenVowel);
+	AddSegment(0.30f, Fricative);
+	AddSegment(0.30f, Silence);
+
+	return Pcm;
+}
+} // namespace RfsnBench
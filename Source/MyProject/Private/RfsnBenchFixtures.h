@@ -0,0 +1,19 @@
+// RFSN Benchmark Fixtures
+// Workload pieces several benchmarks and tests share; each feature's legacy model lives in Tests/Rfsn<Feature>Fixtures
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+namespace RfsnBench
+{
+/** Synthetic speech-like clip: silence, low vowel, closure, open vowel, fricative noise, silence */
+TArray<int16> MakeSyntheticSpeech(int32 SampleRate);
+
+/** Crowds of NPCs (perception, proximity, significance) are scattered over a square this wide */
+constexpr float PerceptionArea = 20000.0f;
+
+/** Mock orchestrator timing: first sentence after the round-trip, then one sentence per gap */
+constexpr float MockFirstSentenceMs = 900.0f;
+constexpr float MockSentenceGapMs = 350.0f;
+} // namespace RfsnBench
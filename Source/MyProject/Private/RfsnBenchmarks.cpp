@@ -0,0 +1,2028 @@
+// RFSN Benchmarks Implementation
+
+#include "RfsnBenchmarks.h"
+#include "RfsnBenchFixtures.h"
+#include "Tests/RfsnBarkFixtures.h"
+#include "Tests/RfsnConversationLogFixtures.h"
+#include "Tests/RfsnFocusFixtures.h"
+#include "Tests/RfsnLipSyncFixtures.h"
+#include "Tests/RfsnLookAtFixtures.h"
+#include "Tests/RfsnNeedsFixtures.h"
+#include "Tests/RfsnProximityFixtures.h"
+#include "Tests/RfsnQuestTopicsFixtures.h"
+#include "Tests/RfsnRelationshipDecayFixtures.h"
+#include "Tests/RfsnResponseCacheFixtures.h"
+#include "Tests/RfsnScheduleFixtures.h"
+#include "Tests/RfsnSignificanceFixtures.h"
+#include "Tests/RfsnStreamReplayFixtures.h"
+#include "Tests/RfsnSubtitleFixtures.h"
+#include "Tests/RfsnTokenDecoderFixtures.h"
+#include "Tests/RfsnTraceFixtures.h"
+#include "Tests/RfsnTurnTakingFixtures.h"
+#include "Tests/RfsnWeatherReactionFixtures.h"
+#include "Tests/RfsnWitnessFixtures.h"
+#include "IslandInteractorComponent.h"
+#include "RfsnBarkLibrary.h"
+#include "RfsnConversationLog.h"
+#include "RfsnDialogueWidget.h"
+#include "RfsnLipSync.h"
+#include "RfsnLipSyncAnalysis.h"
+#include "RfsnLookAtManager.h"
+#include "RfsnPerceptionManager.h"
+#include "RfsnProximityManager.h"
+#include "RfsnDynamicPricing.h"
+#include "RfsnFactionSystem.h"
+#include "RfsnGameClock.h"
+#include "RfsnGroupConversation.h"
+#include "RfsnNeedsManager.h"
+#include "RfsnNpcClientComponent.h"
+#include "RfsnNpcSchedule.h"
+#include "RfsnQuestIntegration.h"
+#include "RfsnQuestRegistry.h"
+#include "RfsnRelationshipDecayManager.h"
+#include "RfsnSignificanceManager.h"
+#include "RfsnSpatialHash.h"
+#include "RfsnStreamSession.h"
+#include "RfsnResponseCache.h"
+#include "RfsnTokenDecoder.h"
+#include "RfsnWitnessSystem.h"
+#include "RfsnWorldEnvironment.h"
+#include "RfsnTrace.h"
+#include "RfsnLogging.h"
+#include "HAL/PlatformTime.h"
+#include "Kismet/KismetMathLibrary.h"
+#include "UObject/Package.h"
+#include "Algo/Sort.h"
+#include "Containers/SortedMap.h"
+#include "HAL/FileManager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "ProfilingDebugging/TraceAuxiliary.h"
+#include "Dom/JsonObject.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+
+bool FRfsnBenchmarks::Run(const FString& Name, int32 Count)
+{
+	if (Name.Equals(TEXT("Barks"), ESearchCase::IgnoreCase))
+	{
+		RunBarks(Count > 0 ? Count : 500);
+		return true;
+	}
+
+	if (Name.Equals(TEXT("LipSync"), ESearchCase::IgnoreCase))
+	{
+		RunLipSync(Count > 0 ? Count : 50);
+		return true;
+	}
+
+	if (Name.Equals(TEXT("Perception"), ESearchCase::IgnoreCase))
+	{
+		RunPerception(Count > 0 ? Count : 500);
+		return true;
+	}
+
+	if (Name.Equals(TEXT("Proximity"), ESearchCase::IgnoreCase))
+	{
+		RunProximity(Count > 0 ? Count : 500);
+		return true;
+	}
+
+	if (Name.Equals(TEXT("Schedule"), ESearchCase::IgnoreCase))
+	{
+		RunSchedule(Count > 0 ? Count : 1000);
+		return true;
+	}
+
+	if (Name.Equals(TEXT("Needs"), ESearchCase::IgnoreCase))
+	{
+		RunNeeds(Count > 0 ? Count : 1000);
+		return true;
+	}
+
+	if (Name.Equals(TEXT("Pricing"), ESearchCase::IgnoreCase))
+	{
+		RunPricing(Count > 0 ? Count : 2000);
+		return true;
+	}
+
+	if (Name.Equals(TEXT("Factions"), ESearchCase::IgnoreCase))
+	{
+		RunFactions(Count > 0 ? Count : 64);
+		return true;
+	}
+
+	if (Name.Equals(TEXT("Focus"), ESearchCase::IgnoreCase))
+	{
+		RunFocus(Count > 0 ? Count : 7200);
+		return true;
+	}
+
+	if (Name.Equals(TEXT("Trace"), ESearchCase::IgnoreCase))
+	{
+		RunTrace(Count > 0 ? Count : 1000000);
+		return true;
+	}
+
+	if (Name.Equals(TEXT("Significance"), ESearchCase::IgnoreCase))
+	{
+		RunSignificance(Count > 0 ? Count : 300);
+		return true;
+	}
+
+	if (Name.Equals(TEXT("Tokens"), ESearchCase::IgnoreCase))
+	{
+		RunTokens(Count > 0 ? Count : 200000);
+		return true;
+	}
+
+	if (Name.Equals(TEXT("Witness"), ESearchCase::IgnoreCase))
+	{
+		RunWitness(Count > 0 ? Count : 500);
+		return true;
+	}
+
+	if (Name.Equals(TEXT("ResponseCache"), ESearchCase::IgnoreCase))
+	{
+		RunResponseCache(Count > 0 ? Count : 5000);
+		return true;
+	}
+
+	if (Name.Equals(TEXT("Subtitles"), ESearchCase::IgnoreCase))
+	{
+		RunSubtitles(Count > 0 ? Count : 2000);
+		return true;
+	}
+
+	if (Name.Equals(TEXT("ConversationLog"), ESearchCase::IgnoreCase))
+	{
+		RunConversationLog(Count > 0 ? Count : 100000);
+		return true;
+	}
+
+	if (Name.Equals(TEXT("TurnTaking"), ESearchCase::IgnoreCase))
+	{
+		RunTurnTaking(Count > 0 ? Count : 200);
+		return true;
+	}
+
+	if (Name.Equals(TEXT("WeatherReactions"), ESearchCase::IgnoreCase))
+	{
+		RunWeatherReactions(Count > 0 ? Count : 1000);
+		return true;
+	}
+
+	if (Name.Equals(TEXT("LookAt"), ESearchCase::IgnoreCase))
+	{
+		RunLookAt(Count > 0 ? Count : 200);
+		return true;
+	}
+
+	if (Name.Equals(TEXT("RelationshipDecay"), ESearchCase::IgnoreCase))
+	{
+		RunRelationshipDecay(Count > 0 ? Count : 1000);
+		return true;
+	}
+
+	if (Name.Equals(TEXT("QuestTopics"), ESearchCase::IgnoreCase))
+	{
+		RunQuestTopics(Count > 0 ? Count : 500);
+		return true;
+	}
+
+	if (Name.Equals(TEXT("StreamReplay"), ESearchCase::IgnoreCase))
+	{
+		RunStreamReplay(Count > 0 ? Count : 200);
+		return true;
+	}
+
+	return false;
+}
+
+TArray<FString> FRfsnBenchmarks::GetBenchmarkNames()
+{
+	return {TEXT("Barks"), TEXT("LipSync"), TEXT("Perception"), TEXT("Proximity"), TEXT("Schedule"), TEXT("Needs"),
+	        TEXT("Pricing"), TEXT("Factions"), TEXT("Focus"), TEXT("Trace"),
+	        TEXT("Significance"), TEXT("Tokens"), TEXT("Witness"), TEXT("ResponseCache"),
+	        TEXT("Subtitles"), TEXT("ConversationLog"),
+	        TEXT("TurnTaking"), TEXT("WeatherReactions"), TEXT("LookAt"), TEXT("RelationshipDecay"),
+	        TEXT("QuestTopics"), TEXT("StreamReplay")};
+}
+
+void FRfsnBenchmarks::RunBarks(int32 NpcCount)
+{
+	using namespace RfsnBench;
+
+	const FRfsnBarkLibrary& DefaultLibrary = FRfsnBarkLibraryRegistry::GetDefaultInstantBarks();
+	const TArray<FRfsnBark>& DefaultBarks = FRfsnBarkLibraryRegistry::GetDefaultNpcBarks();
+
+	// ── Legacy: every NPC owns its copy ──
+	TArray<FLegacyNpcBarks> Legacy;
+	Legacy.SetNum(NpcCount);
+	SIZE_T LegacyBytes = Legacy.GetAllocatedSize();
+	for (FLegacyNpcBarks& Npc : Legacy)
+	{
+		Npc.InstantBarks = DefaultLibrary;
+		Npc.Barks = DefaultBarks;
+		Npc.LastUsedTime.Init(-1000.0f, DefaultBarks.Num());
+		LegacyBytes += GetLibrarySize(Npc.InstantBarks) + GetBarksSize(Npc.Barks) + Npc.LastUsedTime.GetAllocatedSize();
+	}
+
+	// ── Shared: one immutable set per archetype, per-NPC cursors and cooldowns ──
+	const FRfsnInstantBarkSetRef InstantSet = FRfsnBarkLibraryRegistry::AcquireInstantBarks(FRfsnBarkLibrary());
+	const FRfsnNpcBarkSetRef NpcSet = FRfsnBarkLibraryRegistry::AcquireNpcBarks(TArray<FRfsnBark>());
+	const SIZE_T CursorBytes = sizeof(int32) * FRfsnInstantBarkSet::NumCategories;
+
+	TArray<FRfsnBarkCooldownState> Shared;
+	Shared.SetNum(NpcCount);
+
+	const TArray<ERfsnBarkTrigger> Triggers = GetPopulatedTriggers(*NpcSet);
+
+	// Same trigger sequence for both runs
+	FRandomStream TriggerStream(1234);
+	TArray<uint8> Sequence;
+	Sequence.SetNumUninitialized(SelectionsPerNpc);
+	for (uint8& Entry : Sequence)
+	{
+		Entry = static_cast<uint8>(TriggerStream.RandRange(0, Triggers.Num() - 1));
+	}
+
+	int32 LegacyHits = 0;
+	const double LegacyStart = FPlatformTime::Seconds();
+	for (int32 Step = 0; Step < SelectionsPerNpc; Step++)
+	{
+		const float Now = Step * SelectionInterval;
+		const ERfsnBarkTrigger Trigger = Triggers[Sequence[Step]];
+		for (FLegacyNpcBarks& Npc : Legacy)
+		{
+			const int32 Index = Npc.Select(Trigger, Now);
+			if (Index != INDEX_NONE)
+			{
+				Npc.LastUsedTime[Index] = Now;
+				LegacyHits++;
+			}
+		}
+	}
+	const double LegacySeconds = FPlatformTime::Seconds() - LegacyStart;
+
+	int32 SharedHits = 0;
+	const double SharedStart = FPlatformTime::Seconds();
+	for (int32 Step = 0; Step < SelectionsPerNpc; Step++)
+	{
+		const float Now = Step * SelectionInterval;
+		const ERfsnBarkTrigger Trigger = Triggers[Sequence[Step]];
+		for (FRfsnBarkCooldownState& Npc : Shared)
+		{
+			const int32 Index = Npc.Pick(*NpcSet, Trigger, Now);
+			if (Index != INDEX_NONE)
+			{
+				Npc.MarkUsed(*NpcSet, Index, Now);
+				SharedHits++;
+			}
+		}
+	}
+	const double SharedSeconds = FPlatformTime::Seconds() - SharedStart;
+
+	// Cooldown state allocates on first use, so measure after the run
+	SIZE_T SharedBytes = InstantSet->GetAllocatedSize() + NpcSet->GetAllocatedSize() + Shared.GetAllocatedSize();
+	for (const FRfsnBarkCooldownState& Npc : Shared)
+	{
+		SharedBytes += Npc.GetAllocatedSize() + CursorBytes;
+	}
+
+	const int32 Selections = NpcCount * SelectionsPerNpc;
+	const double LegacyNs = Selections > 0 ? LegacySeconds * 1e9 / Selections : 0.0;
+	const double SharedNs = Selections > 0 ? SharedSeconds * 1e9 / Selections : 0.0;
+
+	RFSN_LOG(TEXT("[Bench] Barks: %d NPCs, %d selections each"), NpcCount, SelectionsPerNpc);
+	RFSN_LOG(TEXT("[Bench]   memory  per-NPC copies: %.1f KB (%.0f B/NPC)"), LegacyBytes / 1024.0,
+	         NpcCount > 0 ? static_cast<double>(LegacyBytes) / NpcCount : 0.0);
+	RFSN_LOG(TEXT("[Bench]   memory  shared sets:    %.1f KB (%.0f B/NPC)"), SharedBytes / 1024.0,
+	         NpcCount > 0 ? static_cast<double>(SharedBytes) / NpcCount : 0.0);
+	RFSN_LOG(TEXT("[Bench]   select  linear scan:    %.1f ns/pick (%d played)"), LegacyNs, LegacyHits);
+	RFSN_LOG(TEXT("[Bench]   select  bucket+wheel:   %.1f ns/pick (%d played)"), SharedNs, SharedHits);
+}
+
+void FRfsnBenchmarks::RunLipSync(int32 Iterations)
+{
+	using namespace RfsnBench;
+
+	const int32 SampleRate = 22050;
+	const TArray<int16> Pcm = MakeSyntheticSpeech(SampleRate);
+
+	// ── Analysis cost ──
+	FRfsnLipSyncTrack Track;
+	const double AnalyzeStart = FPlatformTime::Seconds();
+	for (int32 i = 0; i < Iterations; i++)
+	{
+		Track = FRfsnLipSyncAnalyzer::Analyze(Pcm.GetData(), Pcm.Num(), SampleRate);
+	}
+	const double AnalyzeMs = (FPlatformTime::Seconds() - AnalyzeStart) * 1000.0 / FMath::Max(1, Iterations);
+
+	// ── Morph writes per second at 60 Hz, viseme mode with the default 15 mappings ──
+	const int32 NumVisemes = static_cast<int32>(ERfsnViseme::WQ) + 1;
+	const float TickRate = 60.0f;
+	const float DeltaTime = 1.0f / TickRate;
+	const float Epsilon = 0.01f;
+
+	FRfsnMorphTargetBatch Batch;
+	const int32 JawChannel = Batch.AddChannel(FName("JawOpen"));
+	TArray<int32> VisemeChannels;
+	for (int32 i = 0; i < NumVisemes; i++)
+	{
+		VisemeChannels.Add(Batch.AddChannel(*FString::Printf(TEXT("Viseme%d"), i)));
+	}
+
+	TArray<float> Weights;
+	Weights.Init(0.0f, NumVisemes);
+	Weights[static_cast<int32>(ERfsnViseme::Silence)] = 1.0f;
+
+	int32 Ticks = 0;
+	int32 BatchedWrites = 0;
+	for (float T = 0.0f; T < Track.Duration; T += DeltaTime, Ticks++)
+	{
+		float Amplitude = 0.0f;
+		ERfsnViseme Viseme = ERfsnViseme::Silence;
+		Track.Sample(T, Amplitude, Viseme);
+
+		Batch.ClearTargets();
+		Batch.MaxTarget(JawChannel, FMath::Clamp(Amplitude * 1.5f, 0.0f, 1.0f));
+		for (int32 i = 0; i < NumVisemes; i++)
+		{
+			Weights[i] = FMath::FInterpTo(Weights[i], i == static_cast<int32>(Viseme) ? 1.0f : 0.0f, DeltaTime, 12.0f);
+			Batch.MaxTarget(VisemeChannels[i], Weights[i]);
+		}
+
+		BatchedWrites += Batch.Flush(Epsilon, [](FName, float) {});
+	}
+
+	// Previous ApplyToMesh wrote the jaw plus every mapping each tick
+	const float UnbatchedPerSecond = (1 + NumVisemes) * TickRate;
+	const float BatchedPerSecond = Track.Duration > 0.0f ? BatchedWrites / Track.Duration : 0.0f;
+
+	RFSN_LOG(TEXT("[Bench] LipSync: %.2fs clip @ %d Hz, %d frames, %.3f ms/analysis (%d runs)"), Track.Duration,
+	         SampleRate, Track.NumFrames(), AnalyzeMs, Iterations);
+	RFSN_LOG(TEXT("[Bench]   morph writes  every tick:   %.0f /s"), UnbatchedPerSecond);
+	RFSN_LOG(TEXT("[Bench]   morph writes  epsilon %.2f: %.0f /s (%d ticks)"), Epsilon, BatchedPerSecond, Ticks);
+}
+
+namespace RfsnBench
+{
+/** Observer placed by the perception benchmark (defaults match URfsnNpcAwareness) */
+struct FBenchObserver
+{
+	FVector Location;
+	FVector Forward;
+	float SightRange = 2000.0f;
+	float FieldOfView = 90.0f;
+	float PeripheralFOV = 120.0f;
+	float HearingRange = 1500.0f;
+};
+
+/** Per-NPC sight check as URfsnNpcAwareness did it before batching */
+float LegacyVisibility(const FBenchObserver& Npc, const FVector& Target)
+{
+	const float Distance = FVector::Dist(Npc.Location, Target);
+	if (Distance > Npc.SightRange)
+	{
+		return 0.0f;
+	}
+
+	const FVector ToTarget = (Target - Npc.Location).GetSafeNormal();
+	const float Angle = FMath::RadiansToDegrees(FMath::Acos(FVector::DotProduct(Npc.Forward, ToTarget)));
+	if (Angle > Npc.PeripheralFOV * 0.5f)
+	{
+		return 0.0f;
+	}
+
+	const float DistanceFactor = 1.0f - (Distance / Npc.SightRange);
+	const float FovAngle = FMath::RadiansToDegrees(FMath::Acos(FVector::DotProduct(Npc.Forward, ToTarget)));
+	return DistanceFactor * (FovAngle > Npc.FieldOfView * 0.5f ? 0.3f : 1.0f);
+}
+
+/** Sight passes per timing run (10 Hz for the 1-second window the trace budget uses) */
+constexpr int32 PerceptionPasses = 10;
+
+/** Sounds broadcast per hearing run */
+constexpr int32 SoundsPerRun = 100;
+} // namespace RfsnBench
+
+void FRfsnBenchmarks::RunPerception(int32 NpcCount)
+{
+	using namespace RfsnBench;
+
+	// Defaults of URfsnPerceptionManager
+	const int32 MaxTracesPerFrame = 16;
+	const float LineOfSightMaxAge = 0.2f;
+	const float HearingCellSize = 1000.0f;
+	const float FramesPerSecond = 60.0f;
+
+	RFSN_LOG(TEXT("[Bench] Perception: up to %d NPCs, %d sight passes, %d sounds"), NpcCount, PerceptionPasses,
+	         SoundsPerRun);
+	RFSN_LOG(TEXT("[Bench]   %6s | %10s %10s | %10s %10s | %9s %9s | %8s"), TEXT("NPCs"), TEXT("sight old"),
+	         TEXT("sight new"), TEXT("hear old"), TEXT("hear new"), TEXT("LOS old/s"), TEXT("LOS new/s"),
+	         TEXT("mismatch"));
+
+	const FVector Target = FVector::ZeroVector;
+
+	for (const int32 Divisor : {8, 4, 2, 1})
+	{
+		const int32 Count = FMath::Max(1, NpcCount / Divisor);
+
+		FRandomStream Stream(4321 + Count);
+		TArray<FBenchObserver> Npcs;
+		Npcs.SetNum(Count);
+		for (FBenchObserver& Npc : Npcs)
+		{
+			const float Half = PerceptionArea * 0.5f;
+			Npc.Location = FVector(Stream.FRandRange(-Half, Half), Stream.FRandRange(-Half, Half), 0.0f);
+			const float Yaw = Stream.FRandRange(0.0f, 2.0f * PI);
+			Npc.Forward = FVector(FMath::Cos(Yaw), FMath::Sin(Yaw), 0.0f);
+		}
+
+		// ── Sight: per-NPC Acos checks vs gathered batch + one cull ──
+		TArray<float> LegacyResults;
+		LegacyResults.SetNumZeroed(Count);
+
+		const double LegacyStart = FPlatformTime::Seconds();
+		for (int32 Pass = 0; Pass < PerceptionPasses; Pass++)
+		{
+			for (int32 i = 0; i < Count; i++)
+			{
+				LegacyResults[i] = LegacyVisibility(Npcs[i], Target);
+			}
+		}
+		const double LegacySeconds = FPlatformTime::Seconds() - LegacyStart;
+
+		FRfsnPerceptionBatch Batch;
+		const float CosHalfFov = FRfsnPerceptionBatch::HalfAngleCos(90.0f);
+		const float CosHalfPeripheral = FRfsnPerceptionBatch::HalfAngleCos(120.0f);
+
+		const double BatchStart = FPlatformTime::Seconds();
+		for (int32 Pass = 0; Pass < PerceptionPasses; Pass++)
+		{
+			Batch.Reset();
+			for (const FBenchObserver& Npc : Npcs)
+			{
+				Batch.Add(Npc.Location, Npc.Forward, Target, Npc.SightRange, CosHalfFov, CosHalfPeripheral);
+			}
+			Batch.Cull();
+		}
+		const double BatchSeconds = FPlatformTime::Seconds() - BatchStart;
+
+		// Both paths should agree on who is in the cone
+		int32 Mismatches = 0;
+		int32 InCone = 0;
+		for (int32 i = 0; i < Count; i++)
+		{
+			const bool bLegacy = LegacyResults[i] > 0.0f;
+			const bool bBatched = Batch.Visibility[i] > 0.0f;
+			Mismatches += bLegacy != bBatched ? 1 : 0;
+			InCone += bBatched ? 1 : 0;
+		}
+
+		// ── Hearing: every listener per sound vs spatial hash candidates ──
+		TArray<FVector> Sounds;
+		Sounds.SetNumUninitialized(SoundsPerRun);
+		for (FVector& Sound : Sounds)
+		{
+			const float Half = PerceptionArea * 0.5f;
+			Sound = FVector(Stream.FRandRange(-Half, Half), Stream.FRandRange(-Half, Half), 0.0f);
+		}
+		const float Loudness = 1.0f;
+
+		int32 LegacyHeard = 0;
+		const double HearLegacyStart = FPlatformTime::Seconds();
+		for (const FVector& Sound : Sounds)
+		{
+			for (const FBenchObserver& Npc : Npcs)
+			{
+				LegacyHeard += FVector::Dist(Npc.Location, Sound) <= Npc.HearingRange * Loudness ? 1 : 0;
+			}
+		}
+		const double HearLegacySeconds = FPlatformTime::Seconds() - HearLegacyStart;
+
+		int32 GridHeard = 0;
+		const double HearGridStart = FPlatformTime::Seconds();
+		FRfsnSpatialHashGrid Grid(HearingCellSize);
+		for (int32 i = 0; i < Count; i++)
+		{
+			Grid.Add(i, Npcs[i].Location);
+		}
+		for (const FVector& Sound : Sounds)
+		{
+			Grid.Query(Sound, 1500.0f * Loudness,
+			           [&Npcs, &Sound, &GridHeard, Loudness](int32 Index)
+			           {
+				           const float Range = Npcs[Index].HearingRange * Loudness;
+				           GridHeard += FVector::DistSquared(Npcs[Index].Location, Sound) <= Range * Range ? 1 : 0;
+			           });
+		}
+		const double HearGridSeconds = FPlatformTime::Seconds() - HearGridStart;
+		Mismatches += FMath::Abs(LegacyHeard - GridHeard);
+
+		// ── Line of sight: sync trace per in-cone pair per tick vs budgeted async refresh ──
+		const int32 LegacyTraces = InCone * PerceptionPasses;
+		const int32 BatchedTraces = FMath::Min(FMath::CeilToInt(InCone / LineOfSightMaxAge),
+		                                       FMath::RoundToInt(MaxTracesPerFrame * FramesPerSecond));
+
+		RFSN_LOG(TEXT("[Bench]   %6d | %8.1fus %8.1fus | %8.1fus %8.1fus | %9d %9d | %8d"), Count,
+		         LegacySeconds * 1e6 / PerceptionPasses, BatchSeconds * 1e6 / PerceptionPasses,
+		         HearLegacySeconds * 1e6 / SoundsPerRun, HearGridSeconds * 1e6 / SoundsPerRun, LegacyTraces,
+		         BatchedTraces, Mismatches);
+	}
+
+	RFSN_LOG(TEXT("[Bench]   sight = per pass, hear = per sound (grid build included), LOS old assumes 10 Hz ticks"));
+}
+
+void FRfsnBenchmarks::RunProximity(int32 NpcCount)
+{
+	using namespace RfsnBench;
+
+	FProximityWalk Walk;
+	Walk.Build(NpcCount);
+	const int32 NumZones = Walk.NumZones();
+
+	TArray<bool> PolledInside;
+	TArray<FRfsnProximityEvent> Events;
+	double PollSeconds = 0.0;
+	double TrackerSeconds = 0.0;
+	int64 Candidates = 0;
+	int32 Transitions = 0;
+
+	for (int32 Step = 0; Step < ProximitySteps; Step++)
+	{
+		if (Walk.Advance(Step))
+		{
+			// The manager re-reads zone positions at the same rate, so it counts against the tracker
+			const double RefreshStart = FPlatformTime::Seconds();
+			Walk.RefreshZones();
+			TrackerSeconds += FPlatformTime::Seconds() - RefreshStart;
+		}
+
+		const double PollStart = FPlatformTime::Seconds();
+		Walk.PollZones(PolledInside);
+		PollSeconds += FPlatformTime::Seconds() - PollStart;
+
+		Events.Reset();
+		const double TrackerStart = FPlatformTime::Seconds();
+		Walk.Tracker.Update(Walk.Player, Events);
+		TrackerSeconds += FPlatformTime::Seconds() - TrackerStart;
+
+		Candidates += Walk.Tracker.GetLastCandidates() + Walk.Tracker.GetInsideZones().Num();
+		Transitions += Events.Num();
+	}
+
+	RFSN_LOG(TEXT("[Bench] Proximity: %d NPCs, %d zones, %d steps, %d enter/exit events"), NpcCount, NumZones,
+	         ProximitySteps, Transitions);
+	RFSN_LOG(TEXT("[Bench]   per-zone polling: %.1fus per step, %d checks"), PollSeconds * 1e6 / ProximitySteps,
+	         NumZones);
+	RFSN_LOG(TEXT("[Bench]   tracker:          %.1fus per step, %.1f checks"), TrackerSeconds * 1e6 / ProximitySteps,
+	         static_cast<double>(Candidates) / ProximitySteps);
+	RFSN_LOG(TEXT("[Bench]   polling excludes the %d component ticks per step it also needed"), NumZones);
+}
+
+void FRfsnBenchmarks::RunSchedule(int32 NpcCount)
+{
+	using namespace RfsnBench;
+
+	const double MinutesPerDay = URfsnGameClock::MinutesPerDay;
+
+	FRandomStream Stream(1357);
+	TArray<TArray<FRfsnScheduleEntry>> Schedules;
+	TArray<FRfsnCompiledSchedule> Compiled;
+	Schedules.SetNum(NpcCount);
+	Compiled.SetNum(NpcCount);
+	for (int32 i = 0; i < NpcCount; i++)
+	{
+		Schedules[i] = MakeRandomSchedule(Stream);
+		Compiled[i].Compile(Schedules[i]);
+	}
+
+	// Same conversions URfsnGameClock uses
+	double GameMinutes = 0.0;
+	auto HourAt = [MinutesPerDay](double Minutes)
+	{ return static_cast<float>(FMath::Fmod(Minutes, MinutesPerDay) / 60.0); };
+	auto DayAt = [MinutesPerDay](double Minutes)
+	{ return FMath::FloorToInt32(Minutes / MinutesPerDay) % URfsnGameClock::DaysPerWeek; };
+
+	FRfsnTimingWheel Wheel;
+	TArray<int32> HandleOwner;
+	TArray<int32> Timers;
+	TArray<int32> States;
+	Timers.Init(INDEX_NONE, NpcCount);
+	States.Init(INDEX_NONE, NpcCount);
+
+	int64 Transitions = 0;
+	int64 Callbacks = 0;
+
+	// What URfsnNpcSchedule::HandleTransition does: re-evaluate, then arm the next boundary
+	auto Evaluate = [&](int32 Npc)
+	{
+		const int32 State = Compiled[Npc].FindEntry(DayAt(GameMinutes), HourAt(GameMinutes));
+		Transitions += State != States[Npc] ? 1 : 0;
+		States[Npc] = State;
+
+		Wheel.Remove(Timers[Npc]);
+		const double Next = Compiled[Npc].GetNextTransition(GameMinutes, DayAt(GameMinutes));
+		const int32 Handle = Wheel.Add(static_cast<uint64>(FMath::CeilToDouble(Next)));
+		if (Handle >= HandleOwner.Num())
+		{
+			HandleOwner.SetNum(Handle + 1);
+		}
+		HandleOwner[Handle] = Npc;
+		Timers[Npc] = Handle;
+	};
+
+	for (int32 i = 0; i < NpcCount; i++)
+	{
+		Evaluate(i);
+	}
+
+	double WheelSeconds = 0.0;
+	double PollSeconds = 0.0;
+	int64 PollChecks = 0;
+	int32 Frames = 0;
+	double RealSeconds = 0.0;
+	double NextPollTime = 1.0;
+	TArray<int32> Expired;
+	TArray<int32> Due;
+	TArray<int32> PolledStates;
+	PolledStates.SetNumZeroed(NpcCount);
+
+	for (const FClockPhase& Phase : SchedulePhases)
+	{
+		if (Phase.SecondsPerGameHour < 0.0f)
+		{
+			GameMinutes = FMath::Max(0.0, FMath::FloorToDouble(GameMinutes - Phase.GameHours * 60.0));
+			const double RewindStart = FPlatformTime::Seconds();
+			Wheel.Rewind(static_cast<uint64>(GameMinutes));
+			for (int32 i = 0; i < NpcCount; i++)
+			{
+				Evaluate(i);
+			}
+			WheelSeconds += FPlatformTime::Seconds() - RewindStart;
+			continue;
+		}
+
+		const double PhaseEnd = GameMinutes + Phase.GameHours * 60.0;
+		while (GameMinutes < PhaseEnd)
+		{
+			// Frames that cross a game minute land on it, as boundaries do
+			double Next = GameMinutes + ScheduleFrameSeconds * 60.0 / Phase.SecondsPerGameHour;
+			if (FMath::FloorToDouble(Next) > FMath::FloorToDouble(GameMinutes))
+			{
+				Next = FMath::FloorToDouble(Next);
+			}
+			RealSeconds += (Next - GameMinutes) * Phase.SecondsPerGameHour / 60.0;
+			GameMinutes = Next;
+			Frames++;
+
+			const double WheelStart = FPlatformTime::Seconds();
+			Expired.Reset();
+			Wheel.Advance(static_cast<uint64>(GameMinutes), Expired);
+			// Resolve owners first: re-arming recycles handles, as in URfsnGameClock::AdvanceTo
+			Due.Reset();
+			for (const int32 Handle : Expired)
+			{
+				Due.Add(HandleOwner[Handle]);
+				Timers[HandleOwner[Handle]] = INDEX_NONE;
+			}
+			for (const int32 Npc : Due)
+			{
+				Evaluate(Npc);
+			}
+			Callbacks += Expired.Num();
+			WheelSeconds += FPlatformTime::Seconds() - WheelStart;
+
+			// Old model: every NPC scans its schedule once per real second
+			if (RealSeconds >= NextPollTime)
+			{
+				NextPollTime += 1.0;
+				const float Hour = HourAt(GameMinutes);
+				const int32 Day = DayAt(GameMinutes);
+				const double PollStart = FPlatformTime::Seconds();
+				for (int32 i = 0; i < NpcCount; i++)
+				{
+					PolledStates[i] = FRfsnCompiledSchedule::FindEntryForTime(Schedules[i], Hour, Day);
+				}
+				PollSeconds += FPlatformTime::Seconds() - PollStart;
+				PollChecks += NpcCount;
+			}
+		}
+	}
+
+	RFSN_LOG(TEXT("[Bench] Schedule: %d NPCs, day %d reached, %.0f real seconds, %d frames, %lld transitions"),
+	         NpcCount, FMath::FloorToInt32(GameMinutes / MinutesPerDay), RealSeconds, Frames, Transitions);
+	RFSN_LOG(TEXT("[Bench]   1 Hz polling: %8.2fms total, %lld schedule scans (plus one tick each)"), PollSeconds * 1e3,
+	         PollChecks);
+	RFSN_LOG(TEXT("[Bench]   timing wheel: %8.2fms total, %lld callbacks"), WheelSeconds * 1e3, Callbacks);
+}
+
+void FRfsnBenchmarks::RunNeeds(int32 NpcCount)
+{
+	using namespace RfsnBench;
+
+	TArray<FLegacyNeeds> Legacy;
+	TArray<FNeedsEvent> Events;
+	MakeNeedsWorkload(NpcCount, Legacy, Events);
+
+	// What URfsnNpcNeeds does on a threshold callback or after a change
+	FRfsnNeedsSimulation Simulation;
+	TArray<ERfsnNeedState> States;
+	TArray<bool> Critical;
+	States.SetNum(NpcCount);
+	Critical.Init(false, NpcCount * RfsnNeeds::Num);
+	int64 Evaluations = 0;
+	int64 CriticalEntries = 0;
+	int64 StateChanges = 0;
+	auto Evaluate = [&](int32 Npc, double Now)
+	{
+		FRfsnNeed Needs[RfsnNeeds::Num];
+		for (int32 Need = 0; Need < RfsnNeeds::Num; Need++)
+		{
+			Needs[Need] = Legacy[Npc].Needs[Need];
+			Needs[Need].Value = Simulation.GetValue(Npc, Need, Now);
+		}
+		for (const int32 Need : {RfsnNeeds::Hunger, RfsnNeeds::Energy, RfsnNeeds::Social})
+		{
+			bool& bWasCritical = Critical[Npc * RfsnNeeds::Num + Need];
+			CriticalEntries += Needs[Need].IsCritical() && !bWasCritical ? 1 : 0;
+			bWasCritical = Needs[Need].IsCritical();
+		}
+		const ERfsnNeedState State = URfsnNpcNeeds::CalculateState(Needs);
+		StateChanges += State != States[Npc] ? 1 : 0;
+		States[Npc] = State;
+		Evaluations++;
+	};
+
+	for (int32 i = 0; i < NpcCount; i++)
+	{
+		Simulation.Add(Legacy[i].Needs, Legacy[i].TimeScale / 3600.0, 0.0);
+		Evaluate(i, 0.0);
+	}
+	CriticalEntries = 0;
+	StateChanges = 0;
+
+	double LegacySeconds = 0.0;
+	double ManagerSeconds = 0.0;
+	int64 LegacyCriticalEntries = 0;
+	int32 NextEvent = 0;
+	TArray<int32> Due;
+
+	for (int32 Second = 1; Second <= NeedsSeconds; Second++)
+	{
+		// Scripted changes land between ticks; the manager path re-evaluates at once, legacy on its next tick
+		const double ManagerStart = FPlatformTime::Seconds();
+		for (; NextEvent < Events.Num() && Events[NextEvent].Second == Second; NextEvent++)
+		{
+			const FNeedsEvent& Event = Events[NextEvent];
+			Legacy[Event.Npc].Needs[Event.Need].Satisfy(Event.Delta);
+			Simulation.Adjust(Event.Npc, Event.Need, Event.Delta, Second - 1);
+			Evaluate(Event.Npc, Second - 1);
+		}
+
+		// Manager: frames between ticks only pop the crossings that came due
+		for (int32 Frame = 1; Frame <= NeedsFramesPerSecond; Frame++)
+		{
+			const double Now = Second - 1 + static_cast<double>(Frame) / NeedsFramesPerSecond;
+			if (Simulation.GetNextEventTime() > Now)
+			{
+				continue;
+			}
+			Due.Reset();
+			Simulation.PopDue(Now, Due);
+			for (const int32 Npc : Due)
+			{
+				Simulation.ScheduleNext(Npc, Now);
+				Evaluate(Npc, Now);
+			}
+		}
+		ManagerSeconds += FPlatformTime::Seconds() - ManagerStart;
+
+		// Legacy: every component ticks
+		const double LegacyStart = FPlatformTime::Seconds();
+		for (FLegacyNeeds& Npc : Legacy)
+		{
+			LegacyCriticalEntries += Npc.Tick(1.0f);
+		}
+		LegacySeconds += FPlatformTime::Seconds() - LegacyStart;
+	}
+
+	RFSN_LOG(TEXT("[Bench] Needs: %d NPCs, %d seconds, %d scripted changes, %lld state changes"), NpcCount,
+	         NeedsSeconds, Events.Num(), StateChanges);
+	RFSN_LOG(TEXT("[Bench]   1 Hz ticks:    %8.2fms total, %lld updates, %lld critical entries"), LegacySeconds * 1e3,
+	         static_cast<int64>(NpcCount) * NeedsSeconds, LegacyCriticalEntries);
+	RFSN_LOG(TEXT("[Bench]   needs manager: %8.2fms total, %lld evaluations, %lld critical entries"),
+	         ManagerSeconds * 1e3, Evaluations, CriticalEntries);
+}
+
+namespace RfsnBench
+{
+/** Shop screens priced per pricing run, and stock changes between screens */
+constexpr int32 PricingFrames = 60;
+constexpr int32 StockChangesPerFrame = 20;
+constexpr int32 PricingCategories = 25;
+
+/** URfsnDynamicPricing::GetPrice before the item index: linear lookup, every modifier matched by string */
+float LegacyPrice(const URfsnDynamicPricing& Pricing, const FString& ItemId)
+{
+	const FRfsnItemPrice* Item = Pricing.Inventory.FindByPredicate(
+	    [&ItemId](const FRfsnItemPrice& Entry) { return Entry.ItemId.Equals(ItemId, ESearchCase::IgnoreCase); });
+	if (!Item)
+	{
+		return 0.0f;
+	}
+
+	float StockModifier = 1.0f;
+	if (Item->CurrentStock <= Item->LowStockThreshold && Item->CurrentStock > 0)
+	{
+		const float Scarcity = 1.0f - (float)Item->CurrentStock / (float)Item->LowStockThreshold;
+		StockModifier = 1.0f + Scarcity * (Pricing.LowStockPriceIncrease - 1.0f);
+	}
+	else if (Item->CurrentStock == 0)
+	{
+		StockModifier = Pricing.LowStockPriceIncrease * 1.5f;
+	}
+	else if (Item->CurrentStock > Item->MaxStock * 0.8f)
+	{
+		StockModifier = 0.9f;
+	}
+
+	float Multiplier = 1.0f;
+	for (const FRfsnPriceModifier& Mod : Pricing.ActiveModifiers)
+	{
+		if ((!Mod.AffectedItemId.IsEmpty() && Mod.AffectedItemId.Equals(ItemId, ESearchCase::IgnoreCase)) ||
+		    (!Mod.AffectedCategory.IsEmpty() && Mod.AffectedCategory.Equals(Item->Category, ESearchCase::IgnoreCase)) ||
+		    (Mod.AffectedItemId.IsEmpty() && Mod.AffectedCategory.IsEmpty()))
+		{
+			Multiplier *= Mod.Multiplier;
+		}
+	}
+
+	// No world in the benchmark, so the reputation modifier is 1
+	return FMath::RoundToFloat(Item->BasePrice * StockModifier * Multiplier);
+}
+} // namespace RfsnBench
+
+void FRfsnBenchmarks::RunPricing(int32 ItemCount)
+{
+	using namespace RfsnBench;
+
+	FRandomStream Stream(9753);
+	URfsnDynamicPricing* Pricing = NewObject<URfsnDynamicPricing>(GetTransientPackage());
+	Pricing->Inventory.Reserve(ItemCount);
+	for (int32 i = 0; i < ItemCount; i++)
+	{
+		FRfsnItemPrice& Item = Pricing->Inventory.AddDefaulted_GetRef();
+		Item.ItemId = FString::Printf(TEXT("item_%05d"), i);
+		Item.DisplayName = Item.ItemId;
+		Item.BasePrice = Stream.FRandRange(5.0f, 500.0f);
+		Item.CurrentStock = Stream.RandRange(0, Item.MaxStock);
+		Item.Category = FString::Printf(TEXT("category_%02d"), Stream.RandRange(0, PricingCategories - 1));
+	}
+	Pricing->RefreshInventory();
+
+	// Global, category, item and item-or-category modifiers; some expire during the run
+	auto RandomItem = [&Stream, ItemCount]()
+	{ return FString::Printf(TEXT("item_%05d"), Stream.RandRange(0, ItemCount - 1)); };
+	auto RandomCategory = [&Stream]()
+	{ return FString::Printf(TEXT("category_%02d"), Stream.RandRange(0, PricingCategories - 1)); };
+	Pricing->AddPriceModifier(TEXT("Festival"), 0.85f);
+	Pricing->AddPriceModifier(TEXT("Tax"), 1.07f, TEXT(""), TEXT(""), 3.0f);
+	for (int32 i = 0; i < 5; i++)
+	{
+		Pricing->AddPriceModifier(FString::Printf(TEXT("Shortage%d"), i), Stream.FRandRange(1.1f, 1.6f),
+		                          RandomCategory(), TEXT(""), i % 2 == 0 ? Stream.FRandRange(1.0f, 5.0f) : -1.0f);
+	}
+	for (int32 i = 0; i < 4; i++)
+	{
+		Pricing->AddPriceModifier(FString::Printf(TEXT("Deal%d"), i), Stream.FRandRange(0.5f, 0.9f), TEXT(""),
+		                          RandomItem(), Stream.FRandRange(1.0f, 5.0f));
+	}
+	Pricing->AddPriceModifier(TEXT("Bundle"), 0.95f, RandomCategory(), RandomItem());
+
+	TArray<FString> ItemIds;
+	ItemIds.Reserve(ItemCount);
+	for (const FRfsnItemPrice& Item : Pricing->Inventory)
+	{
+		ItemIds.Add(Item.ItemId);
+	}
+
+	double LegacySeconds = 0.0;
+	double LookupSeconds = 0.0;
+	double ScreenSeconds = 0.0;
+	int32 Mismatches = 0;
+	TArray<float> Expected;
+	Expected.SetNumUninitialized(ItemCount);
+
+	// Modifier products are formed in a different order, so a price may round the other way
+	auto Differs = [](float Price, float Reference) { return !FMath::IsNearlyEqual(Price, Reference, 1.0f); };
+
+	for (int32 Frame = 0; Frame < PricingFrames; Frame++)
+	{
+		// Sales and restocks; stock edits are picked up by the cache without going through BuyItem
+		for (int32 i = 0; i < StockChangesPerFrame; i++)
+		{
+			FRfsnItemPrice& Item = Pricing->Inventory[Stream.RandRange(0, ItemCount - 1)];
+			Item.CurrentStock = Stream.RandRange(0, Item.MaxStock);
+		}
+		if (Frame % 10 == 9)
+		{
+			Pricing->TickModifiers(1.0f);
+			Pricing->AddPriceModifier(TEXT("Rumor"), Stream.FRandRange(0.8f, 1.3f), RandomCategory());
+		}
+
+		const double LegacyStart = FPlatformTime::Seconds();
+		for (int32 i = 0; i < ItemCount; i++)
+		{
+			Expected[i] = LegacyPrice(*Pricing, ItemIds[i]);
+		}
+		LegacySeconds += FPlatformTime::Seconds() - LegacyStart;
+
+		const double LookupStart = FPlatformTime::Seconds();
+		for (int32 i = 0; i < ItemCount; i++)
+		{
+			Mismatches += Differs(Pricing->GetPrice(ItemIds[i]), Expected[i]) ? 1 : 0;
+		}
+		LookupSeconds += FPlatformTime::Seconds() - LookupStart;
+
+		const double ScreenStart = FPlatformTime::Seconds();
+		const TArray<float> Prices = Pricing->GetAllPrices();
+		ScreenSeconds += FPlatformTime::Seconds() - ScreenStart;
+		for (int32 i = 0; i < ItemCount; i++)
+		{
+			Mismatches += Differs(Prices[i], Expected[i]) ? 1 : 0;
+		}
+	}
+
+	RFSN_LOG(TEXT("[Bench] Pricing: %d items, %d categories, %d shop screens, %d modifiers at the end"), ItemCount,
+	         PricingCategories, PricingFrames, Pricing->ActiveModifiers.Num());
+	RFSN_LOG(TEXT("[Bench]   linear scan:      %8.2fms per screen"), LegacySeconds * 1e3 / PricingFrames);
+	RFSN_LOG(TEXT("[Bench]   indexed GetPrice: %8.2fms per screen"), LookupSeconds * 1e3 / PricingFrames);
+	RFSN_LOG(TEXT("[Bench]   GetAllPrices:     %8.2fms per screen"), ScreenSeconds * 1e3 / PricingFrames);
+	RFSN_LOG(TEXT("[Bench]   price mismatches vs linear scan: %d"), Mismatches);
+
+	Pricing->MarkAsGarbage();
+}
+
+namespace RfsnBench
+{
+/** Random faction pairs per query kind in the faction run */
+constexpr int32 FactionQueries = 200000;
+
+/** Faction storage before the relation matrix: string map and per-faction string lists */
+struct FLegacyFactions
+{
+	TMap<FString, FRfsnFaction> Factions;
+
+	bool AreAllied(const FString& A, const FString& B) const
+	{
+		const FRfsnFaction* Found = Factions.Find(A);
+		return Found && Found->Allies.Contains(B);
+	}
+
+	bool AreHostile(const FString& A, const FString& B) const
+	{
+		const FRfsnFaction* Found = Factions.Find(A);
+		return Found && Found->Enemies.Contains(B);
+	}
+
+	/** Ally-of-ally query without precomputed tables: breadth-first search over ally lists */
+	bool AreIndirectlyAllied(const FString& A, const FString& B) const
+	{
+		TArray<FString, TInlineAllocator<32>> Open;
+		TSet<FString> Visited;
+		Open.Add(A);
+		while (Open.Num() > 0)
+		{
+			const FRfsnFaction* Found = Factions.Find(Open.Pop(EAllowShrinking::No));
+			if (!Found)
+			{
+				continue;
+			}
+			for (const FString& Ally : Found->Allies)
+			{
+				if (Ally == B)
+				{
+					return true;
+				}
+				if (!Visited.Contains(Ally))
+				{
+					Visited.Add(Ally);
+					Open.Add(Ally);
+				}
+			}
+		}
+		return false;
+	}
+};
+} // namespace RfsnBench
+
+void FRfsnBenchmarks::RunFactions(int32 FactionCount)
+{
+	using namespace RfsnBench;
+
+	FRandomStream Stream(8642);
+	auto FactionName = [](int32 Index) { return FString::Printf(TEXT("faction_%03d"), Index); };
+
+	FLegacyFactions Legacy;
+	URfsnFactionSystem* System = NewObject<URfsnFactionSystem>(GetTransientPackage());
+	double RegisterSeconds = 0.0;
+	for (int32 i = 0; i < FactionCount; i++)
+	{
+		FRfsnFaction Faction;
+		Faction.FactionId = FactionName(i);
+		Faction.DisplayName = Faction.FactionId;
+		Faction.Reputation = Stream.FRandRange(-50.0f, 50.0f);
+
+		// A few links each, some to factions registered later; chains make the ally closure non-trivial
+		const int32 NumAllies = Stream.RandRange(0, 2);
+		for (int32 a = 0; a < NumAllies; a++)
+		{
+			Faction.Allies.AddUnique(FactionName(Stream.RandRange(0, FactionCount - 1)));
+		}
+		const int32 NumEnemies = Stream.RandRange(0, 3);
+		for (int32 e = 0; e < NumEnemies; e++)
+		{
+			Faction.Enemies.AddUnique(FactionName(Stream.RandRange(0, FactionCount - 1)));
+		}
+
+		Legacy.Factions.Add(Faction.FactionId, Faction);
+		const double RegisterStart = FPlatformTime::Seconds();
+		System->RegisterFaction(Faction);
+		RegisterSeconds += FPlatformTime::Seconds() - RegisterStart;
+	}
+
+	// Same pairs for every variant
+	TArray<FString> NamesA;
+	TArray<FString> NamesB;
+	TArray<int32> IndicesA;
+	TArray<int32> IndicesB;
+	for (int32 q = 0; q < FactionQueries; q++)
+	{
+		NamesA.Add(FactionName(Stream.RandRange(0, FactionCount - 1)));
+		NamesB.Add(FactionName(Stream.RandRange(0, FactionCount - 1)));
+		IndicesA.Add(System->GetFactionIndex(NamesA.Last()));
+		IndicesB.Add(System->GetFactionIndex(NamesB.Last()));
+	}
+
+	int32 Mismatches = 0;
+	int32 Related = 0;
+	TArray<uint8> Expected;
+	Expected.SetNumUninitialized(FactionQueries);
+
+	auto Time = [](auto&& Body)
+	{
+		const double Start = FPlatformTime::Seconds();
+		Body();
+		return FPlatformTime::Seconds() - Start;
+	};
+
+	// Direct relations: string map + list search, string wrapper, resolved indices
+	const double LegacyDirect = Time(
+	    [&]()
+	    {
+		    for (int32 q = 0; q < FactionQueries; q++)
+		    {
+			    Expected[q] = (Legacy.AreAllied(NamesA[q], NamesB[q]) ? 1 : 0) |
+			                  (Legacy.AreHostile(NamesA[q], NamesB[q]) ? 2 : 0);
+		    }
+	    });
+	const double WrapperDirect = Time(
+	    [&]()
+	    {
+		    for (int32 q = 0; q < FactionQueries; q++)
+		    {
+			    const uint8 Result = (System->AreFactionsAllied(NamesA[q], NamesB[q]) ? 1 : 0) |
+			                         (System->AreFactionsHostile(NamesA[q], NamesB[q]) ? 2 : 0);
+			    Mismatches += Result != Expected[q] ? 1 : 0;
+		    }
+	    });
+	const double IndexedDirect = Time(
+	    [&]()
+	    {
+		    for (int32 q = 0; q < FactionQueries; q++)
+		    {
+			    const uint8 Result = (System->AreAllied(IndicesA[q], IndicesB[q]) ? 1 : 0) |
+			                         (System->AreHostile(IndicesA[q], IndicesB[q]) ? 2 : 0);
+			    Mismatches += Result != Expected[q] ? 1 : 0;
+			    Related += Result != 0 ? 1 : 0;
+		    }
+	    });
+
+	// Ally of an ally: search per query vs the closure table
+	const double LegacyClosure = Time(
+	    [&]()
+	    {
+		    for (int32 q = 0; q < FactionQueries; q++)
+		    {
+			    Expected[q] = Legacy.AreIndirectlyAllied(NamesA[q], NamesB[q]) ? 1 : 0;
+		    }
+	    });
+	int32 Reachable = 0;
+	const double IndexedClosure = Time(
+	    [&]()
+	    {
+		    for (int32 q = 0; q < FactionQueries; q++)
+		    {
+			    const uint8 Result = System->AreIndirectlyAllied(IndicesA[q], IndicesB[q]) ? 1 : 0;
+			    Mismatches += Result != Expected[q] ? 1 : 0;
+			    Reachable += Result;
+		    }
+	    });
+
+	RFSN_LOG(TEXT("[Bench] Factions: %d factions, %d queries per variant, %d directly related, %d reachable by allies"),
+	         FactionCount, FactionQueries, Related, Reachable);
+	RFSN_LOG(TEXT("[Bench]   register + rebuild: %8.2fms total"), RegisterSeconds * 1e3);
+	RFSN_LOG(TEXT("[Bench]   ally/enemy  string map: %8.2fms  string API: %8.2fms  indexed: %8.2fms"),
+	         LegacyDirect * 1e3, WrapperDirect * 1e3, IndexedDirect * 1e3);
+	RFSN_LOG(TEXT("[Bench]   ally-of-ally  search: %8.2fms  closure table: %8.2fms"), LegacyClosure * 1e3,
+	         IndexedClosure * 1e3);
+	RFSN_LOG(TEXT("[Bench]   mismatches vs string map: %d"), Mismatches);
+
+	System->MarkAsGarbage();
+}
+
+void FRfsnBenchmarks::RunFocus(int32 Frames)
+{
+	using namespace RfsnBench;
+
+	FFocusWorld Focus;
+	Focus.Build(Frames);
+
+	struct FVariant
+	{
+		const TCHAR* Name;
+		UIslandInteractorComponent* Interactor;
+	};
+	const FVariant Variants[] = {
+	    {TEXT("per tick"), Focus.AddInteractor(&FFocusWorld::TraceEveryTick)},
+	    {TEXT("throttled"), Focus.AddInteractor([](UIslandInteractorComponent&) {})},
+	    {TEXT("throttled + cone"),
+	     Focus.AddInteractor([](UIslandInteractorComponent& Interactor) { Interactor.bUseConePrefilter = true; })},
+	    {TEXT("throttled + async"),
+	     Focus.AddInteractor([](UIslandInteractorComponent& Interactor) { Interactor.bAsyncFocusTrace = true; })},
+	};
+	Focus.BeginPlay();
+
+	// One pass of the camera path per variant with only its interactor ticking; the first pass has none, so the
+	// world's own frame cost can be taken off the others
+	auto RunPass = [&Focus, &Variants](const UIslandInteractorComponent* Active)
+	{
+		for (const FVariant& Variant : Variants)
+		{
+			Variant.Interactor->SetComponentTickEnabled(Variant.Interactor == Active);
+		}
+
+		const double Start = FPlatformTime::Seconds();
+		for (int32 Frame = 0; Frame < Focus.Views.Num(); Frame++)
+		{
+			Focus.Step(Frame);
+		}
+		return FPlatformTime::Seconds() - Start;
+	};
+
+	const double WorldSeconds = RunPass(nullptr);
+
+	RFSN_LOG(TEXT("[Bench] Focus: %d frames at 60 fps, %d interactables, world alone %.2fus per frame"), Frames,
+	         FocusInteractables, WorldSeconds * 1e6 / Frames);
+	for (const FVariant& Variant : Variants)
+	{
+		const double Seconds = RunPass(Variant.Interactor) - WorldSeconds;
+		RFSN_LOG(TEXT("[Bench]   %-18s %7.2fus per frame  traces: %6d  skipped by cone pre-filter: %6d"), Variant.Name,
+		         Seconds * 1e6 / Frames, Variant.Interactor->GetNumFocusTraces(),
+		         Variant.Interactor->GetNumPrefilteredTraces());
+	}
+}
+
+void FRfsnBenchmarks::RunTrace(int32 Iterations)
+{
+	using namespace RfsnBench;
+
+	const bool bWasEnabled = RfsnChannel.IsEnabled();
+
+	// ToggleChannel looks channels up by name, so this fails if RfsnTrace.cpp never registered it
+	if (!UE::Trace::ToggleChannel(TEXT("Rfsn"), false))
+	{
+		RFSN_WARNING(TEXT("[Bench] Trace: channel 'Rfsn' is not registered"));
+		return;
+	}
+	const double OffSeconds = TimeTraceScopes(Iterations);
+
+	UE::Trace::ToggleChannel(TEXT("Rfsn"), true);
+	const double OnSeconds = TimeTraceScopes(Iterations);
+
+	RFSN_LOG(TEXT("[Bench] Trace: %d scopes  channel off: %.2f ns  on: %.2f ns per scope"), Iterations,
+	         OffSeconds * 1.0e9, OnSeconds * 1.0e9);
+
+	// Capture the memory and emotion paths to a file, unless a session is already being recorded
+	const bool bCapture = !FTraceAuxiliary::IsConnected();
+	const FString TracePath = FPaths::ProfilingDir() / TEXT("RfsnBenchTrace.utrace");
+	if (bCapture && !FTraceAuxiliary::Start(FTraceAuxiliary::EConnectionType::File, *TracePath,
+	                                        TEXT("cpu,counters,bookmark,rfsn")))
+	{
+		RFSN_WARNING(TEXT("[Bench] Trace: could not start a capture to %s"), *TracePath);
+	}
+
+	TraceMemoryAndEmotion();
+
+	if (bCapture)
+	{
+		FTraceAuxiliary::Stop();
+		RFSN_LOG(TEXT("[Bench]   captured %s (%lld bytes); open it in Unreal Insights and filter timers by 'Rfsn'"),
+		         *TracePath, IFileManager::Get().FileSize(*TracePath));
+	}
+	else
+	{
+		RFSN_LOG(TEXT("[Bench]   recorded into the session already running"));
+	}
+
+	UE::Trace::ToggleChannel(TEXT("Rfsn"), bWasEnabled);
+}
+
+void FRfsnBenchmarks::RunSignificance(int32 NpcCount)
+{
+	using namespace RfsnBench;
+
+	struct FPass
+	{
+		const TCHAR* Name;
+		TFunction<void(URfsnSignificanceManager&)> Configure;
+	};
+	const FPass Passes[] = {
+	    {TEXT("fixed rates"), [](URfsnSignificanceManager& Manager) { Manager.bEnabled = false; }},
+	    {TEXT("significance"), [](URfsnSignificanceManager&) {}},
+	    {TEXT("no hysteresis"),
+	     [](URfsnSignificanceManager& Manager)
+	     {
+		     Manager.Settings.Hysteresis = 0.0f;
+		     Manager.Settings.MinDemotionDelay = 0.0f;
+	     }}};
+
+	const int32 Frames = FMath::RoundToInt(SignificanceSeconds / SignificanceFrameTime);
+	const int32 NumBuckets = static_cast<int32>(ERfsnSignificanceBucket::Dormant) + 1;
+	RFSN_LOG(TEXT("[Bench] Significance: %d NPCs, %.0fs at 60 fps"), NpcCount, SignificanceSeconds);
+
+	for (const FPass& Pass : Passes)
+	{
+		FSignificanceWorld World;
+		World.Build(NpcCount, Pass.Configure);
+		World.BeginPlay();
+
+		TArray<int64> BucketComponents;
+		BucketComponents.Init(0, NumBuckets);
+		// Last pass cost sampled every frame, so the sum over frames averages it
+		double PassMs = 0.0;
+
+		const double Start = FPlatformTime::Seconds();
+		for (int32 Frame = 0; Frame < Frames; Frame++)
+		{
+			World.Step();
+
+			const FRfsnSignificanceStats& Stats = World.Manager->GetStats();
+			for (int32 b = 0; b < Stats.ComponentsInBucket.Num(); b++)
+			{
+				BucketComponents[b] += Stats.ComponentsInBucket[b];
+			}
+			PassMs += Stats.LastPassMs;
+		}
+		const double Seconds = FPlatformTime::Seconds() - Start;
+
+		RFSN_LOG(TEXT("[Bench]   %-14s %d components  ticks/s: %8.0f  frame: %.3f ms  bucket changes/s: %.1f"),
+		         Pass.Name, World.GetComponents().Num(), World.Ticks / SignificanceSeconds, Seconds * 1e3 / Frames,
+		         World.Changes / SignificanceSeconds);
+
+		if (!World.Manager->bEnabled)
+		{
+			continue;
+		}
+		FString Distribution;
+		for (int32 b = 0; b < NumBuckets; b++)
+		{
+			Distribution += FString::Printf(TEXT("  %s %.0f"),
+			                                *StaticEnum<ERfsnSignificanceBucket>()->GetNameStringByIndex(b),
+			                                static_cast<double>(BucketComponents[b]) / Frames);
+		}
+		RFSN_LOG(TEXT("[Bench]     components per bucket:%s  scoring: %.1fus per pass"), *Distribution,
+		         PassMs * 1e3 / Frames);
+	}
+}
+
+void FRfsnBenchmarks::RunTokens(int32 Iterations)
+{
+	using namespace RfsnBench;
+
+	const int32 NumActions = UE_ARRAY_COUNT(RfsnTokens::ActionKeywords);
+	const FUtf8StringView Meta(reinterpret_cast<const UTF8CHAR*>(TokenMetaEvent));
+	FUtf8StringView Field;
+
+	// ── Action names: upper-cased copy and if-chain vs perfect hash ──
+	TArray<FString> Names;
+	for (int32 i = 0; i < NumActions; i++)
+	{
+		Names.Add(FRfsnTokenDecoder::GetActionName(static_cast<ERfsnNpcAction>(i)));
+	}
+
+	volatile int32 Sink = 0;
+	double Start = FPlatformTime::Seconds();
+	for (int32 i = 0; i < Iterations; i++)
+	{
+		Sink = Sink + static_cast<int32>(LegacyParseAction(Names[i % NumActions]));
+	}
+	const double LegacyNs = (FPlatformTime::Seconds() - Start) * 1.0e9 / FMath::Max(Iterations, 1);
+
+	Start = FPlatformTime::Seconds();
+	for (int32 i = 0; i < Iterations; i++)
+	{
+		Sink = Sink + static_cast<int32>(FRfsnTokenDecoder::DecodeAction(FStringView(Names[i % NumActions])));
+	}
+	const double DecodeNs = (FPlatformTime::Seconds() - Start) * 1.0e9 / FMath::Max(Iterations, 1);
+
+	// ── Meta event action: FString + JSON DOM vs UTF-8 field scan ──
+	const int32 MetaIterations = FMath::Max(Iterations / 20, 1);
+	Start = FPlatformTime::Seconds();
+	for (int32 i = 0; i < MetaIterations; i++)
+	{
+		TSharedPtr<FJsonObject> JsonObject;
+		const FString JsonData(UTF8_TO_TCHAR(TokenMetaEvent));
+		FString ActionString;
+		if (FJsonSerializer::Deserialize(TJsonReaderFactory<>::Create(JsonData), JsonObject) && JsonObject.IsValid() &&
+		    JsonObject->TryGetStringField(TEXT("npc_action"), ActionString))
+		{
+			Sink = Sink + static_cast<int32>(LegacyParseAction(ActionString));
+		}
+	}
+	const double MetaLegacyNs = (FPlatformTime::Seconds() - Start) * 1.0e9 / MetaIterations;
+
+	Start = FPlatformTime::Seconds();
+	for (int32 i = 0; i < MetaIterations; i++)
+	{
+		if (FRfsnTokenDecoder::FindJsonString(Meta, UTF8TEXT("npc_action"), Field))
+		{
+			Sink = Sink + static_cast<int32>(FRfsnTokenDecoder::DecodeAction(Field));
+		}
+	}
+	const double MetaDecodeNs = (FPlatformTime::Seconds() - Start) * 1.0e9 / MetaIterations;
+
+	RFSN_LOG(TEXT("[Bench] Tokens: %d action decodes, %d meta events"), Iterations, MetaIterations);
+	RFSN_LOG(TEXT("[Bench]   action name   if-chain: %7.1f ns  perfect hash: %7.1f ns"), LegacyNs, DecodeNs);
+	RFSN_LOG(TEXT("[Bench]   meta action   FString + JSON: %7.1f ns  UTF-8 scan: %7.1f ns"), MetaLegacyNs,
+	         MetaDecodeNs);
+}
+
+void FRfsnBenchmarks::RunWitness(int32 NpcCount)
+{
+	using namespace RfsnBench;
+
+	const URfsnWitnessSystem* Defaults = GetDefault<URfsnWitnessSystem>();
+	const float Radius = Defaults->ConversationDistance;
+	const float Chance = Defaults->RumorSpreadChance;
+	const float GossipChance = Defaults->GossipChance;
+	const float Decay = Defaults->AccuracyDecayPerHop;
+
+	FWitnessScenario Scenario;
+	Scenario.AddNpcs(NpcCount, Radius);
+	FRfsnKnowledgeMatrix& Matrix = Scenario.Matrix;
+	TArray<FLegacyKnowledgeMap>& Legacy = Scenario.Legacy;
+
+	double Start = FPlatformTime::Seconds();
+	Matrix.UpdateContacts();
+	const double BuildMs = (FPlatformTime::Seconds() - Start) * 1000.0;
+
+	Scenario.Witness(Defaults->WitnessRadius, GossipChance);
+
+	// ── Gossip: all-pairs scan and map lookups vs contact graph and bitsets ──
+	FRandomStream LegacyRandom(77);
+	FRandomStream MatrixRandom(77);
+	Start = FPlatformTime::Seconds();
+	for (int32 Tick = 0; Tick < WitnessTicks; Tick++)
+	{
+		LegacyRumorTick(Legacy, Scenario.Locations, Scenario.Active, Radius, Chance, GossipChance, Decay, LegacyRandom);
+	}
+	const double LegacyTickMs = (FPlatformTime::Seconds() - Start) * 1000.0 / WitnessTicks;
+
+	TArray<FRfsnRumorSpread> Spreads;
+	Start = FPlatformTime::Seconds();
+	for (int32 Tick = 0; Tick < WitnessTicks; Tick++)
+	{
+		Matrix.TickSpread(MatrixRandom, Chance, GossipChance, Decay, Spreads);
+	}
+	const double MatrixTickMs = (FPlatformTime::Seconds() - Start) * 1000.0 / WitnessTicks;
+
+	int32 Known = 0;
+	for (const FLegacyKnowledgeMap& Map : Legacy)
+	{
+		Known += Map.Num();
+	}
+
+	// ── What each NPC knows: map walk vs bitset scan ──
+	volatile int32 Sink = 0;
+	Start = FPlatformTime::Seconds();
+	for (int32 Npc = 0; Npc < NpcCount; Npc++)
+	{
+		for (const TPair<int32, FLegacyKnowledge>& Pair : Legacy[Npc])
+		{
+			Sink = Sink + (Scenario.Active[Pair.Key] ? 1 : 0);
+		}
+	}
+	const double LegacyQueryUs = (FPlatformTime::Seconds() - Start) * 1.0e6 / FMath::Max(NpcCount, 1);
+
+	Start = FPlatformTime::Seconds();
+	for (int32 Npc = 0; Npc < NpcCount; Npc++)
+	{
+		Matrix.ForEachKnown(Npc, [&Sink](int32) { Sink = Sink + 1; });
+	}
+	const double MatrixQueryUs = (FPlatformTime::Seconds() - Start) * 1.0e6 / FMath::Max(NpcCount, 1);
+
+	SIZE_T LegacyBytes = Legacy.GetAllocatedSize();
+	for (const FLegacyKnowledgeMap& Map : Legacy)
+	{
+		LegacyBytes += Map.GetAllocatedSize();
+	}
+
+	// ── A third of the NPCs walk each step ──
+	double UpdateSeconds = 0.0;
+	for (int32 Step = 0; Step < 20; Step++)
+	{
+		Scenario.Walk();
+		Start = FPlatformTime::Seconds();
+		Matrix.UpdateContacts();
+		UpdateSeconds += FPlatformTime::Seconds() - Start;
+	}
+
+	RFSN_LOG(TEXT("[Bench] Witness: %d NPCs x %d events, %d known after %d ticks, %d rumors"), NpcCount,
+	         WitnessEvents, Known, WitnessTicks, Spreads.Num());
+	RFSN_LOG(TEXT("[Bench]   rumor tick   all pairs + maps: %8.3f ms  contact graph + bitsets: %8.3f ms"),
+	         LegacyTickMs, MatrixTickMs);
+	RFSN_LOG(TEXT("[Bench]   known events map walk: %7.2f us  bitset scan: %7.2f us per NPC"), LegacyQueryUs,
+	         MatrixQueryUs);
+	RFSN_LOG(TEXT("[Bench]   contacts     build: %.3f ms  incremental: %.3f ms per step"), BuildMs,
+	         UpdateSeconds * 1000.0 / 20);
+	RFSN_LOG(TEXT("[Bench]   memory       maps: %.1f KB  matrix: %.1f KB"), LegacyBytes / 1024.0,
+	         Matrix.GetAllocatedSize() / 1024.0);
+}
+
+void FRfsnBenchmarks::RunResponseCache(int32 Requests)
+{
+	using namespace RfsnBench;
+
+	const FDateTime Start(2026, 1, 1);
+	FMockOrchestrator Mock;
+
+	// ── Workload: NPCs asked the usual things, their state drifting every few hundred requests ──
+	const int32 NumNpcs = 8;
+	const int32 NumPhrases = UE_ARRAY_COUNT(CachePhrases);
+	FRandomStream Stream(2718);
+	FRfsnResponseCacheStore Live;
+
+	double LookupSeconds = 0.0;
+	for (int32 i = 0; i < Requests; i++)
+	{
+		const FDateTime Now = Start + FTimespan::FromSeconds(i * 2.0);
+		const int32 NpcIndex = Stream.RandHelper(NumNpcs);
+		const FString NpcId = FString::Printf(TEXT("npc_%02d"), NpcIndex);
+		const uint32 Context = HashCombine(NpcIndex, i / 300 + Stream.RandHelper(100) / 90);
+
+		// One in four utterances is something new
+		const FString Utterance = Stream.FRand() < 0.25f ? FString::Printf(TEXT("tell me about day %d"), i)
+		                                                 : CachePhrases[Stream.RandHelper(NumPhrases)];
+
+		const double LookupStart = FPlatformTime::Seconds();
+		const bool bHit = Live.Find(NpcId, Context, Utterance, Now) != nullptr;
+		LookupSeconds += FPlatformTime::Seconds() - LookupStart;
+
+		if (!bHit)
+		{
+			Live.Add(Mock.Respond(NpcId, Context, Utterance), Now);
+		}
+	}
+
+	const FRfsnResponseCacheStats& Stats = Live.GetStats();
+
+	RFSN_LOG(TEXT("[Bench] ResponseCache: %d requests to %d NPCs, %d cached replies"), Requests, NumNpcs,
+	         Live.Num());
+	RFSN_LOG(TEXT("[Bench]   hit rate %.1f%% (%d exact, %d approximate), %d round-trips, %d evicted"),
+	         Stats.HitRate * 100.0f, Stats.ExactHits, Stats.ApproximateHits, Mock.Calls, Stats.Evicted);
+	RFSN_LOG(TEXT("[Bench]   first sentence wait  no cache: %.1f s  cache: %.1f s"),
+	         Requests * MockFirstSentenceMs / 1000.0, Mock.WaitMs / 1000.0);
+	RFSN_LOG(TEXT("[Bench]   lookup: %.2f us"), LookupSeconds * 1.0e6 / FMath::Max(Requests, 1));
+}
+
+void FRfsnBenchmarks::RunSubtitles(int32 Sentences)
+{
+	using namespace RfsnBench;
+
+	// ── Time to first character: every reply streamed per token and per sentence ──
+	double TokenFirstMs = 0.0;
+	double SentenceFirstMs = 0.0;
+	TArray<FString> StreamedLines;
+	for (const TCHAR* Reply : SubtitleReplies)
+	{
+		TArray<FString> Tokens;
+		TokenizeReply(Reply, Tokens);
+
+		TArray<FString> TokenLines;
+		TArray<FString> SentenceLines;
+		FRfsnSubtitleStream PerToken = MakeSubtitleStream();
+		FRfsnSubtitleStream PerSentence = MakeSubtitleStream();
+		TokenFirstMs += SimulateSubtitles(PerToken, Tokens, true, TokenLines);
+		SentenceFirstMs += SimulateSubtitles(PerSentence, Tokens, false, SentenceLines);
+		StreamedLines.Append(TokenLines);
+	}
+	const int32 NumReplies = UE_ARRAY_COUNT(SubtitleReplies);
+
+	// ── Throughput: a burst of sentences typed out at 60 fps ──
+	TArray<FString> Burst;
+	Burst.Reserve(Sentences);
+	for (int32 Index = 0; Index < Sentences; Index++)
+	{
+		Burst.Add(StreamedLines[Index % StreamedLines.Num()]);
+	}
+	const float FrameSeconds = static_cast<float>(SubtitleFrameMs / 1000.0);
+
+	FLegacySubtitles Legacy;
+	Legacy.Layout.MaxWidth = SubtitleWidth;
+	Legacy.Layout.MeasureRun = &MeasureSubtitleRun;
+	const double LegacyStart = FPlatformTime::Seconds();
+	Legacy.Queue = Burst;
+	while (Legacy.Next())
+	{
+		while (Legacy.Display.Len() < Legacy.Full.Len())
+		{
+			Legacy.Step(FrameSeconds);
+		}
+	}
+	const double LegacySeconds = FPlatformTime::Seconds() - LegacyStart;
+
+	FRfsnSubtitleStream Current = MakeSubtitleStream();
+	const double CurrentStart = FPlatformTime::Seconds();
+	for (const FString& Sentence : Burst)
+	{
+		Current.Append(Sentence, false);
+	}
+	int32 CurrentMeasured = 0;
+	do
+	{
+		while (!Current.IsFullyRevealed())
+		{
+			Current.Reveal(FrameSeconds);
+		}
+		CurrentMeasured += Current.Layout.GetMeasuredChars();
+	} while (Current.ShowNext());
+	const double CurrentSeconds = FPlatformTime::Seconds() - CurrentStart;
+	Current.Reset();
+
+	RFSN_LOG(TEXT("[Bench] Subtitles: %d sentences at %.0f chars/s, %d replies streamed"), Sentences,
+	         SubtitleRevealSpeed, NumReplies);
+	RFSN_LOG(TEXT("[Bench]   first character  per sentence: %.0f ms  per token: %.0f ms"),
+	         SentenceFirstMs / NumReplies, TokenFirstMs / NumReplies);
+	RFSN_LOG(TEXT("[Bench]   glyphs measured  legacy: %d  incremental: %d"), Legacy.MeasuredChars, CurrentMeasured);
+	RFSN_LOG(TEXT("[Bench]   typewriter       legacy: %.2f ms  incremental: %.2f ms"), LegacySeconds * 1000.0,
+	         CurrentSeconds * 1000.0);
+}
+
+void FRfsnBenchmarks::RunConversationLog(int32 Messages)
+{
+	using namespace RfsnBench;
+
+	const int32 NumSpeakers = UE_ARRAY_COUNT(LogSpeakers);
+	FRandomStream Random(4242);
+	const TArray<FRfsnConversationEntry> Transcript = MakeTranscript(Messages, Random);
+
+	// ── Search: word index vs scanning every message ──
+	const int32 Searched = FMath::Min(Messages, 20000);
+	FRfsnTranscriptIndex Index;
+	for (int32 Serial = 0; Serial < Messages; Serial++)
+	{
+		Index.Add(Serial, Transcript[Serial].Message);
+	}
+	FRfsnTranscriptIndex SearchedIndex;
+	TArray<FRfsnConversationEntry> SearchedTranscript(Transcript.GetData(), Searched);
+	for (int32 Serial = 0; Serial < Searched; Serial++)
+	{
+		SearchedIndex.Add(Serial, Transcript[Serial].Message);
+	}
+
+	const int32 NumQueries = 40;
+	const TArray<FString> Queries = MakeLogQueries(NumQueries, Random);
+	double IndexSeconds = 0.0;
+	double ScanSeconds = 0.0;
+	TArray<int32> Indexed;
+	TArray<int32> Scanned;
+	for (const FString& Query : Queries)
+	{
+		const double IndexStart = FPlatformTime::Seconds();
+		SearchedIndex.Search(Query, 20, Indexed);
+		IndexSeconds += FPlatformTime::Seconds() - IndexStart;
+
+		const double ScanStart = FPlatformTime::Seconds();
+		ScanTranscript(SearchedTranscript, Query, 20, Scanned);
+		ScanSeconds += FPlatformTime::Seconds() - ScanStart;
+	}
+
+	// ── Export: game-thread cost of handing entries over, and compression on the writer ──
+	const FString ExportDir = FPaths::ProjectSavedDir() / TEXT("RfsnBench") / TEXT("Transcript");
+	IFileManager::Get().DeleteDirectory(*ExportDir, false, true);
+
+	const int32 Exported = FMath::Min(Messages, 5000);
+	FRfsnTranscriptExporter Exporter;
+	Exporter.Begin(ExportDir);
+	double ExportAddSeconds = 0.0;
+	const double ExportStart = FPlatformTime::Seconds();
+	for (int32 Serial = 0; Serial < Exported; Serial++)
+	{
+		const double AddStart = FPlatformTime::Seconds();
+		Exporter.Add(Serial, Transcript[Serial]);
+		ExportAddSeconds += FPlatformTime::Seconds() - AddStart;
+	}
+	Exporter.Finish();
+	const double ExportSeconds = FPlatformTime::Seconds() - ExportStart;
+	const FRfsnTranscriptExportStats ExportStats = Exporter.GetStats();
+	IFileManager::Get().DeleteDirectory(*ExportDir, false, true);
+
+	// ── Throughput: log every message and pull the last five for display ──
+	const int32 Recent = 5;
+	FLegacyConversationLog Legacy;
+	int32 LegacyShown = 0;
+	const double LegacyStart = FPlatformTime::Seconds();
+	for (const FRfsnConversationEntry& Entry : Transcript)
+	{
+		Legacy.Add(Entry);
+		LegacyShown += Legacy.GetRecentEntries(Recent).Num();
+	}
+	const double LegacySeconds = FPlatformTime::Seconds() - LegacyStart;
+
+	FRfsnConversationRing Current;
+	Current.SetCapacity(Legacy.MaxEntries);
+	int32 CurrentShown = 0;
+	const double CurrentStart = FPlatformTime::Seconds();
+	for (const FRfsnConversationEntry& Entry : Transcript)
+	{
+		AddToRing(Current, Entry);
+		Current.ForEach([&CurrentShown](const FString&, const FString&, const FDateTime&, bool) { CurrentShown++; },
+		                Recent);
+	}
+	const double CurrentSeconds = FPlatformTime::Seconds() - CurrentStart;
+
+	const double RawMb = ExportStats.RawBytes / (1024.0 * 1024.0);
+	RFSN_LOG(TEXT("[Bench] ConversationLog: %d messages, %d speakers, capacity %d"), Messages, NumSpeakers,
+	         Legacy.MaxEntries);
+	RFSN_LOG(TEXT("[Bench]   log + last %d      legacy: %.2f ms  ring: %.2f ms (%d / %d shown)"), Recent,
+	         LegacySeconds * 1000.0, CurrentSeconds * 1000.0, LegacyShown, CurrentShown);
+	RFSN_LOG(TEXT("[Bench]   search (%d msgs)  scan: %.1f us  index: %.1f us  (%d words, %.1f KB for %d msgs)"),
+	         Searched, ScanSeconds * 1.0e6 / NumQueries, IndexSeconds * 1.0e6 / NumQueries, Index.NumWords(),
+	         Index.GetAllocatedSize() / 1024.0, Messages);
+	RFSN_LOG(TEXT("[Bench]   export %d msgs    %d chunks, %.2f MB -> %.1f%%, %.1f MB/s, game thread %.2f ms"),
+	         Exported, ExportStats.ChunksWritten, RawMb,
+	         100.0 * ExportStats.CompressedBytes / FMath::Max<int64>(ExportStats.RawBytes, 1),
+	         RawMb / FMath::Max(ExportSeconds, 1.0e-6), ExportAddSeconds * 1000.0);
+}
+
+void FRfsnBenchmarks::RunTurnTaking(int32 Turns)
+{
+	using namespace RfsnBench;
+
+	// ── Turn gaps against the mock backend ──
+	const FTurnGapRun Sequential = RunTurnGaps(Turns, false, 0);
+	const FTurnGapRun Prefetched = RunTurnGaps(Turns, true, 0);
+	const FTurnGapRun Interrupted = RunTurnGaps(Turns, true, 5);
+
+	auto Report = [](const TCHAR* Label, const FTurnGapRun& Run)
+	{
+		RFSN_LOG(TEXT("[Bench]   %-22s avg gap %6.0f ms  max %5.0f ms  %3d/%3d prefetched  %3d discarded  %.0f s"),
+		         Label, Run.Stats.GetAverageGapSeconds() * 1000.0, Run.Stats.MaxGapSeconds * 1000.0,
+		         Run.Stats.PrefetchHits, Run.Stats.Turns, Run.Stats.Discarded, Run.Seconds);
+	};
+	RFSN_LOG(TEXT("[Bench] TurnTaking: %d turns, 4 NPCs, mock replies %.0f-%.0f ms"), Turns,
+	         (MockFirstSentenceMs + MockSentenceGapMs) * 0.7, (MockFirstSentenceMs + 3 * MockSentenceGapMs) * 1.3);
+	Report(TEXT("ask when floor frees"), Sequential);
+	Report(TEXT("prefetch"), Prefetched);
+	Report(TEXT("prefetch, player/5"), Interrupted);
+}
+
+void FRfsnBenchmarks::RunWeatherReactions(int32 NpcCount)
+{
+	using namespace RfsnBench;
+
+	FWeatherScenario Scenario;
+	Scenario.Build(NpcCount);
+	TArray<FLegacyWeatherNpc>& Legacy = Scenario.Legacy;
+	FRfsnWeatherReactionBatch& Batch = Scenario.Batch;
+
+	// ── Weather changes: every weather from every other ──
+	double LegacyChangeSeconds = 0.0;
+	double BatchChangeSeconds = 0.0;
+	int32 Changes = 0;
+	int32 ReactionChanges = 0;
+	TArray<int32> Changed;
+	for (const ERfsnWeatherType Weather : MakeWeatherSequence())
+	{
+		Changes++;
+
+		// Every component heard the weather system and re-ran its reaction
+		double Start = FPlatformTime::Seconds();
+		for (FLegacyWeatherNpc& Npc : Legacy)
+		{
+			Npc.SetWeather(Weather);
+		}
+		LegacyChangeSeconds += FPlatformTime::Seconds() - Start;
+
+		Start = FPlatformTime::Seconds();
+		Changed.Reset();
+		Batch.Evaluate(Weather, Changed);
+		BatchChangeSeconds += FPlatformTime::Seconds() - Start;
+		ReactionChanges += Changed.Num();
+	}
+
+	// ── Steady state: a minute of 5 s ticks against nothing at all ──
+	constexpr int32 TicksPerMinute = static_cast<int32>(60.0f / WeatherTickSeconds);
+	const double TickStart = FPlatformTime::Seconds();
+	for (int32 Tick = 0; Tick < TicksPerMinute; Tick++)
+	{
+		for (FLegacyWeatherNpc& Npc : Legacy)
+		{
+			Npc.Tick();
+		}
+	}
+	const double TickSeconds = FPlatformTime::Seconds() - TickStart;
+
+	RFSN_LOG(TEXT("[Bench] WeatherReactions: %d NPCs, %d archetypes, %d weather changes, %d reaction changes"),
+	         NpcCount, Batch.NumArchetypes(), Changes, ReactionChanges);
+	RFSN_LOG(TEXT("[Bench]   per weather change:  components %8.2f us   batch %8.2f us"),
+	         LegacyChangeSeconds * 1e6 / FMath::Max(Changes, 1), BatchChangeSeconds * 1e6 / FMath::Max(Changes, 1));
+	RFSN_LOG(TEXT("[Bench]   per minute:          %d ticks %8.2f us   batch 0 evaluations"),
+	         TicksPerMinute * NpcCount, TickSeconds * 1e6);
+}
+
+void FRfsnBenchmarks::RunLookAt(int32 NpcCount)
+{
+	using namespace RfsnBench;
+
+	FLookAtScenario Scenario;
+	Scenario.Build(NpcCount);
+	TArray<FLegacyLookAt>& Legacy = Scenario.Legacy;
+	FRfsnLookAtSolver Serial = Scenario.Solver;
+	FRfsnLookAtSolver Parallel = Scenario.Solver;
+
+	// ── Time a frame: old ticks, then the batch serial and parallel ──
+	constexpr int32 TimedFrames = 600;
+	double LegacySeconds = 0.0;
+	double SerialSeconds = 0.0;
+	double ParallelSeconds = 0.0;
+	for (int32 Frame = 0; Frame < TimedFrames; Frame++)
+	{
+		const FVector Eyes = LookAtPlayerEyes(Frame);
+
+		double Start = FPlatformTime::Seconds();
+		for (FLegacyLookAt& Npc : Legacy)
+		{
+			Npc.LookAtTarget = Eyes;
+			Npc.Tick(LookAtFrameTime);
+		}
+		LegacySeconds += FPlatformTime::Seconds() - Start;
+
+		// The manager's frame: gather poses and targets, solve
+		Start = FPlatformTime::Seconds();
+		for (int32 i = 0; i < NpcCount; i++)
+		{
+			Serial.SetPose(i, Legacy[i].Location, Serial.GetBodyYaw(i));
+			Serial.SetTarget(i, Eyes);
+		}
+		Serial.Solve(LookAtFrameTime);
+		SerialSeconds += FPlatformTime::Seconds() - Start;
+
+		Start = FPlatformTime::Seconds();
+		for (int32 i = 0; i < NpcCount; i++)
+		{
+			Parallel.SetPose(i, Legacy[i].Location, Parallel.GetBodyYaw(i));
+			Parallel.SetTarget(i, Eyes);
+		}
+		Parallel.Solve(LookAtFrameTime, true);
+		ParallelSeconds += FPlatformTime::Seconds() - Start;
+	}
+
+	// ── Clearing targets: frames until every head is back at centre and its entry sleeps ──
+	for (int32 i = 0; i < NpcCount; i++)
+	{
+		Serial.ClearTarget(i);
+	}
+	int32 SettleFrames = 0;
+	int32 Awake = NpcCount;
+	while (Awake > 0 && SettleFrames < 300)
+	{
+		Serial.Solve(LookAtFrameTime);
+		SettleFrames++;
+		Awake = 0;
+		for (int32 i = 0; i < NpcCount; i++)
+		{
+			Awake += Serial.IsSettled(i) ? 0 : 1;
+		}
+	}
+
+	RFSN_LOG(TEXT("[Bench] LookAt: %d NPCs following the player"), NpcCount);
+	RFSN_LOG(TEXT("[Bench]   per frame:  component ticks %8.2f us   batch %8.2f us   parallel %8.2f us"),
+	         LegacySeconds * 1e6 / TimedFrames, SerialSeconds * 1e6 / TimedFrames,
+	         ParallelSeconds * 1e6 / TimedFrames);
+	RFSN_LOG(TEXT("[Bench]   idle NPCs:  component ticks every frame   batch 0 after %d settle frames"), SettleFrames);
+}
+
+void FRfsnBenchmarks::RunRelationshipDecay(int32 NpcCount)
+{
+	using namespace RfsnBench;
+
+	const TArray<FLegacyRelationship> Initial = MakeRelationships(NpcCount);
+
+	// ── A 30-day skip: hourly ticks against the lazy ledger and per-NPC fast-forwards ──
+	constexpr double SkipHours = 30.0 * 24.0;
+	TArray<FLegacyRelationship> Legacy = Initial;
+	FRfsnRelationshipLedger Ledger = MakeLedger(Initial);
+	FRfsnRelationshipLedger Forwarded = Ledger;
+
+	double Start = FPlatformTime::Seconds();
+	for (int32 Hour = 0; Hour < static_cast<int32>(SkipHours); Hour++)
+	{
+		for (FLegacyRelationship& Npc : Legacy)
+		{
+			Npc.TickDecay(1.0f);
+		}
+	}
+	const double SteppedSeconds = FPlatformTime::Seconds() - Start;
+
+	// The clock jumps; only NPCs with a crossing in the skipped span are touched
+	Start = FPlatformTime::Seconds();
+	TArray<int32> Due;
+	Ledger.PopDue(SkipHours, Due);
+	for (const int32 Npc : Due)
+	{
+		Ledger.ScheduleNext(Npc, SkipHours);
+	}
+	const double LazySeconds = FPlatformTime::Seconds() - Start;
+
+	Start = FPlatformTime::Seconds();
+	for (int32 i = 0; i < NpcCount; i++)
+	{
+		Forwarded.FastForward(i, SkipHours, 0.0);
+	}
+	const double ForwardSeconds = FPlatformTime::Seconds() - Start;
+
+	Start = FPlatformTime::Seconds();
+	float ValueSum = 0.0f;
+	for (int32 i = 0; i < NpcCount; i++)
+	{
+		ValueSum += Ledger.GetValue(i, SkipHours);
+	}
+	const double ReadSeconds = FPlatformTime::Seconds() - Start;
+
+	RFSN_LOG(TEXT("[Bench] RelationshipDecay: %d NPCs"), NpcCount);
+	RFSN_LOG(TEXT("[Bench]   30-day skip:  hourly ticks %10.2f us   lazy %8.2f us (%d crossings)   "
+	              "fast-forward %8.2f us   read all %8.2f us (sum %.0f)"),
+	         SteppedSeconds * 1e6, LazySeconds * 1e6, Due.Num(), ForwardSeconds * 1e6, ReadSeconds * 1e6, ValueSum);
+}
+
+void FRfsnBenchmarks::RunQuestTopics(int32 QuestCount)
+{
+	using namespace RfsnBench;
+
+	// No world, so the component indexes into its own FRfsnQuestIndex
+	URfsnQuestIntegration* Quests = NewObject<URfsnQuestIntegration>(GetTransientPackage());
+	Quests->OfferedQuests = MakeQuests(QuestCount);
+	Quests->QuestKnowledge = MakeQuestKnowledge(100);
+	Quests->RefreshQuests();
+	const FLegacyQuests Legacy{Quests->OfferedQuests, Quests->QuestKnowledge};
+	const TArray<FString> Lines = MakePlayerLines(Quests->OfferedQuests, 2000);
+	const TArray<FString> Ids = MakeQuestLookupIds(*Quests);
+
+	// ── Topic detection, lookups, context and matcher compile against the old scans ──
+	double Start = FPlatformTime::Seconds();
+	int32 LegacyTopics = 0;
+	for (const FString& Line : Lines)
+	{
+		LegacyTopics += Legacy.DetectQuestTopics(Line).Num();
+	}
+	const double LegacyTopicSeconds = FPlatformTime::Seconds() - Start;
+
+	Start = FPlatformTime::Seconds();
+	int32 IndexedTopics = 0;
+	for (const FString& Line : Lines)
+	{
+		IndexedTopics += Quests->DetectQuestTopics(Line).Num();
+	}
+	const double TopicSeconds = FPlatformTime::Seconds() - Start;
+
+	Start = FPlatformTime::Seconds();
+	int32 LegacyFound = 0;
+	for (const FString& Id : Ids)
+	{
+		LegacyFound += Legacy.FindQuest(Id) ? 1 : 0;
+	}
+	const double LegacyLookupSeconds = FPlatformTime::Seconds() - Start;
+
+	Start = FPlatformTime::Seconds();
+	int32 IndexedFound = 0;
+	for (const FString& Id : Ids)
+	{
+		IndexedFound += Quests->GetQuestStatus(Id) != ERfsnQuestStatus::Unknown ? 1 : 0;
+	}
+	const double LookupSeconds = FPlatformTime::Seconds() - Start;
+
+	constexpr int32 ContextCalls = 100;
+	Start = FPlatformTime::Seconds();
+	int32 ContextLength = 0;
+	for (int32 i = 0; i < ContextCalls; i++)
+	{
+		ContextLength += Legacy.GetQuestContext().Len();
+	}
+	const double LegacyContextSeconds = FPlatformTime::Seconds() - Start;
+
+	Start = FPlatformTime::Seconds();
+	for (int32 i = 0; i < ContextCalls; i++)
+	{
+		ContextLength -= Quests->GetQuestContext().Len();
+	}
+	const double ContextSeconds = FPlatformTime::Seconds() - Start;
+
+	FRfsnQuestIndex Fresh;
+	const int32 Source = Fresh.AddSource();
+	TArray<int32> Patterns;
+	for (const FRfsnQuest& Quest : Quests->OfferedQuests)
+	{
+		Patterns.Add(Fresh.Intern(Quest.QuestId));
+		Patterns.Add(Fresh.Intern(Quest.DisplayName));
+	}
+	Fresh.SetPatterns(Source, Patterns);
+	Start = FPlatformTime::Seconds();
+	Fresh.Build();
+	const double BuildSeconds = FPlatformTime::Seconds() - Start;
+
+	RFSN_LOG(TEXT("[Bench] QuestTopics: %d quests, %d player lines, %d lookups, matcher %d states"),
+	         Quests->OfferedQuests.Num(), Lines.Num(), Ids.Num(), Fresh.GetMatcher().NumStates());
+	RFSN_LOG(TEXT("[Bench]   topics:   old scan %10.2f us   matcher %10.2f us   (%.1fx, %d/%d)"),
+	         LegacyTopicSeconds * 1e6, TopicSeconds * 1e6, LegacyTopicSeconds / FMath::Max(TopicSeconds, 1e-9),
+	         LegacyTopics, IndexedTopics);
+	RFSN_LOG(TEXT("[Bench]   lookups:  old scan %10.2f us   hashed  %10.2f us   (%.1fx, %d/%d)"),
+	         LegacyLookupSeconds * 1e6, LookupSeconds * 1e6, LegacyLookupSeconds / FMath::Max(LookupSeconds, 1e-9),
+	         LegacyFound, IndexedFound);
+	RFSN_LOG(TEXT("[Bench]   context:  old build %9.2f us   cached  %10.2f us   x%d (diff %d)"),
+	         LegacyContextSeconds * 1e6, ContextSeconds * 1e6, ContextCalls, ContextLength);
+	RFSN_LOG(TEXT("[Bench]   matcher compile %8.2f us for %d patterns"), BuildSeconds * 1e6,
+	         Fresh.GetMatcher().NumPatterns());
+}
+
+void FRfsnBenchmarks::RunStreamReplay(int32 Dialogues)
+{
+	using namespace RfsnBench;
+
+	Dialogues = FMath::Max(Dialogues, 1);
+	const FRfsnStreamSession Recorded = MakeStreamSession(Dialogues, 11, 64);
+	const int64 PayloadBytes = Recorded.GetPayloadBytes();
+	const TArray<uint8> File = Recorded.ToBytes();
+
+	// ── Playback through the client's own parsing and events, then the session file ──
+	// The client logs every sentence; quieted so the timings below measure parsing
+#if !NO_LOGGING
+	const ELogVerbosity::Type TempVerbosity = LogTemp.GetVerbosity();
+	LogTemp.SetVerbosity(ELogVerbosity::Fatal);
+#endif
+
+	URfsnNpcClientComponent* Client = NewObject<URfsnNpcClientComponent>(GetTransientPackage());
+	const TSharedPtr<const FRfsnStreamSession> Session = MakeShared<FRfsnStreamSession>(Recorded);
+
+	const int32 Reps = 20;
+	double Start = FPlatformTime::Seconds();
+	for (int32 r = 0; r < Reps; r++)
+	{
+		Client->PlaySession(Session, 0.0f);
+	}
+	const double PlaySeconds = (FPlatformTime::Seconds() - Start) / Reps;
+#if !NO_LOGGING
+	LogTemp.SetVerbosity(TempVerbosity);
+#endif
+
+	Start = FPlatformTime::Seconds();
+	int32 Saved = 0;
+	for (int32 r = 0; r < Reps; r++)
+	{
+		Saved += Recorded.ToBytes().Num();
+	}
+	const double SaveSeconds = (FPlatformTime::Seconds() - Start) / Reps;
+
+	Start = FPlatformTime::Seconds();
+	FRfsnStreamSession Reloaded;
+	for (int32 r = 0; r < Reps; r++)
+	{
+		Reloaded.FromBytes(File);
+	}
+	const double LoadSeconds = (FPlatformTime::Seconds() - Start) / Reps;
+
+	RFSN_LOG(TEXT("[Bench] StreamReplay: %d dialogues, %d events, %d sentences, %lld payload bytes"), Dialogues,
+	         Recorded.Events.Num(), Recorded.Tally.Sentences, PayloadBytes);
+	RFSN_LOG(TEXT("[Bench]   file %d bytes (%.1f%% of payload, %.1f bytes per event)"), File.Num(),
+	         100.0 * File.Num() / FMath::Max<int64>(PayloadBytes, 1),
+	         static_cast<double>(File.Num()) / FMath::Max(Recorded.Events.Num(), 1));
+	RFSN_LOG(TEXT("[Bench]   playback %.2f ms per session (%.1f MB/s, %.2f us per sentence)"), PlaySeconds * 1000.0,
+	         PayloadBytes / FMath::Max(PlaySeconds, 1.0e-9) / (1024.0 * 1024.0),
+	         PlaySeconds * 1.0e6 / FMath::Max(Recorded.Tally.Sentences, 1));
+	RFSN_LOG(TEXT("[Bench]   save %.2f ms  load %.2f ms (%d bytes)"), SaveSeconds * 1000.0, LoadSeconds * 1000.0,
+	         Saved / Reps);
+}
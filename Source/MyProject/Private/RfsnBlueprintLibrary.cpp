@@ -4,6 +4,7 @@
 #include "RfsnDialogueManager.h"
 #include "RfsnNpcClientComponent.h"
 #include "RfsnLogging.h"
+#include "RfsnTokenDecoder.h"
 #include "EngineUtils.h"
 #include "Engine/World.h"
 
@@ -143,35 +144,7 @@ FString URfsnBlueprintLibrary::GetRfsnServerUrl()
 
 FString URfsnBlueprintLibrary::ActionToString(ERfsnNpcAction Action)
 {
-	switch (Action)
-	{
-	case ERfsnNpcAction::Greet:
-		return TEXT("Greet");
-	case ERfsnNpcAction::Attack:
-		return TEXT("Attack");
-	case ERfsnNpcAction::Flee:
-		return TEXT("Flee");
-	case ERfsnNpcAction::Help:
-		return TEXT("Help");
-	case ERfsnNpcAction::Trade:
-		return TEXT("Trade");
-	case ERfsnNpcAction::Warn:
-		return TEXT("Warn");
-	case ERfsnNpcAction::Threaten:
-		return TEXT("Threaten");
-	case ERfsnNpcAction::Accept:
-		return TEXT("Accept");
-	case ERfsnNpcAction::Refuse:
-		return TEXT("Refuse");
-	case ERfsnNpcAction::Explain:
-		return TEXT("Explain");
-	case ERfsnNpcAction::Answer:
-		return TEXT("Answer");
-	case ERfsnNpcAction::Offer:
-		return TEXT("Offer");
-	default:
-		return TEXT("Unknown");
-	}
+	return FRfsnTokenDecoder::GetActionName(Action);
 }
 
 URfsnDialogueManager* URfsnBlueprintLibrary::GetDialogueManager(const UObject* WorldContextObject)
@@ -5,12 +5,17 @@
 #include "RfsnNpcClientComponent.h"
 #include "RfsnDebugHud.h"
 #include "RfsnConversationLog.h"
+#include "RfsnBackstoryPregenerator.h"
+#include "RfsnBenchmarks.h"
 #include "RfsnBlueprintLibrary.h"
+#include "RfsnGameClock.h"
+#include "RfsnLoadTest.h"
 #include "RfsnLogging.h"
 #include "GameFramework/Character.h"
 #include "GameFramework/PlayerController.h"
 #include "EngineUtils.h"
 #include "Engine/World.h"
+#include "Misc/Paths.h"
 
 void URfsnCheatManager::RfsnDebug()
 {
@@ -171,10 +176,200 @@ void URfsnCheatManager::RfsnDumpLog()
 		return;
 	}
 
-	const TArray<FRfsnConversationEntry>& Entries = Log->GetEntries();
-	RFSN_LOG(TEXT("=== Conversation Log (%d entries) ==="), Entries.Num());
-	for (const FRfsnConversationEntry& Entry : Entries)
+	RFSN_LOG(TEXT("=== Conversation Log (%d entries) ==="), Log->GetNumEntries());
+	Log->ForEachEntry(
+	    [](const FString& Speaker, const FString& Message, const FDateTime& Timestamp, bool bIsPlayer)
+	    {
+		    RFSN_LOG(TEXT("[%s] %s: %s"), bIsPlayer ? TEXT("PLAYER") : TEXT("NPC"), *Speaker, *Message);
+	    });
+}
+
+void URfsnCheatManager::RfsnSearchLog(const FString& Query)
+{
+	APlayerController* PC = GetOuterAPlayerController();
+	if (!PC || !PC->GetPawn())
+	{
+		return;
+	}
+
+	URfsnConversationLog* Log = PC->GetPawn()->FindComponentByClass<URfsnConversationLog>();
+	if (!Log)
+	{
+		RFSN_WARNING(TEXT("RfsnSearchLog: No conversation log component"));
+		return;
+	}
+
+	// Results read back from the transcript arrive off the game thread; logging them there is fine
+	Log->SearchTranscriptAsync(Query).Then(
+	    [Query](TFuture<TArray<FRfsnConversationEntry>> Future)
+	    {
+		    const TArray<FRfsnConversationEntry>& Results = Future.Get();
+		    RFSN_LOG(TEXT("=== Transcript search '%s' (%d results, newest first) ==="), *Query, Results.Num());
+		    for (const FRfsnConversationEntry& Entry : Results)
+		    {
+			    RFSN_LOG(TEXT("%s [%s] %s: %s"), *Entry.Timestamp.ToString(TEXT("%H:%M:%S")),
+			             Entry.bIsPlayer ? TEXT("PLAYER") : TEXT("NPC"), *Entry.Speaker, *Entry.Message);
+		    }
+	    });
+}
+
+void URfsnCheatManager::RfsnPregenBackstories()
+{
+	UWorld* World = GetWorld();
+	URfsnBackstoryPregenerator* Pregen = World ? World->GetSubsystem<URfsnBackstoryPregenerator>() : nullptr;
+	if (!Pregen)
+	{
+		RFSN_WARNING(TEXT("RfsnPregenBackstories: No pregenerator subsystem"));
+		return;
+	}
+
+	if (!Pregen->IsPregenerating())
+	{
+		Pregen->StartPregeneration();
+	}
+
+	const FRfsnBackstoryPregenStats Stats = Pregen->GetStats();
+	RFSN_LOG(TEXT("Backstory pregen: queued=%d generated=%d fallback=%d skipped=%d avg=%.0fms"), Stats.Queued,
+	         Stats.Completed, Stats.Failed, Stats.Skipped, Stats.AverageLatencyMs);
+}
+
+void URfsnCheatManager::RfsnBench(const FString& Name, int32 Count)
+{
+	if (!FRfsnBenchmarks::Run(Name, Count))
+	{
+		RFSN_WARNING(TEXT("RfsnBench: Unknown benchmark '%s' (available: %s)"), *Name,
+		             *FString::Join(FRfsnBenchmarks::GetBenchmarkNames(), TEXT(", ")));
+	}
+}
+
+void URfsnCheatManager::RfsnLoadTest(int32 NpcCount, float DurationSeconds)
+{
+	UWorld* World = GetWorld();
+	URfsnLoadTest* LoadTest = World ? World->GetSubsystem<URfsnLoadTest>() : nullptr;
+	if (!LoadTest)
+	{
+		RFSN_WARNING(TEXT("RfsnLoadTest: No load test subsystem"));
+		return;
+	}
+
+	if (LoadTest->IsRunning())
+	{
+		RFSN_LOG(TEXT("RfsnLoadTest: Stopping current run"));
+		LoadTest->StopLoadTest();
+		return;
+	}
+
+	LoadTest->StartLoadTest(NpcCount > 0 ? NpcCount : 50, DurationSeconds > 0.0f ? DurationSeconds : 30.0f);
+}
+
+void URfsnCheatManager::RfsnRecord()
+{
+	UWorld* World = GetWorld();
+	if (!World)
+	{
+		return;
+	}
+
+	// Any client already recording means this call ends the recording
+	TArray<URfsnNpcClientComponent*> Clients;
+	bool bWasRecording = false;
+	for (TActorIterator<AActor> It(World); It; ++It)
 	{
-		RFSN_LOG(TEXT("[%s] %s: %s"), Entry.bIsPlayer ? TEXT("PLAYER") : TEXT("NPC"), *Entry.Speaker, *Entry.Message);
+		if (URfsnNpcClientComponent* Client = It->FindComponentByClass<URfsnNpcClientComponent>())
+		{
+			Clients.Add(Client);
+			bWasRecording |= Client->bRecordSession;
+		}
+	}
+
+	int32 Saved = 0;
+	for (URfsnNpcClientComponent* Client : Clients)
+	{
+		if (bWasRecording)
+		{
+			Saved += Client->GetSessionRecording() && Client->SaveSessionRecording(FString()) ? 1 : 0;
+		}
+		Client->bRecordSession = !bWasRecording;
 	}
+
+	if (bWasRecording)
+	{
+		RFSN_LOG(TEXT("RfsnRecord: Saved %d sessions to %s"), Saved, *(FPaths::ProfilingDir() / TEXT("RfsnSessions")));
+	}
+	else
+	{
+		RFSN_LOG(TEXT("RfsnRecord: Recording %d NPCs (run RfsnRecord again to save)"), Clients.Num());
+	}
+}
+
+void URfsnCheatManager::RfsnReplayTest(const FString& Session, int32 NpcCount, float DurationSeconds, float Speed)
+{
+	UWorld* World = GetWorld();
+	URfsnLoadTest* LoadTest = World ? World->GetSubsystem<URfsnLoadTest>() : nullptr;
+	if (!LoadTest)
+	{
+		RFSN_WARNING(TEXT("RfsnReplayTest: No load test subsystem"));
+		return;
+	}
+
+	if (LoadTest->IsRunning())
+	{
+		RFSN_LOG(TEXT("RfsnReplayTest: Stopping current run"));
+		LoadTest->StopLoadTest();
+		return;
+	}
+
+	// A bare name is an NPC id recorded by RfsnRecord; a negative speed plays as fast as possible
+	const FString Path = FPaths::FileExists(Session) ? Session : FRfsnStreamSession::GetDefaultPath(Session);
+	const float PlaySpeed = Speed < 0.0f ? 0.0f : (Speed > 0.0f ? Speed : 1.0f);
+	LoadTest->StartReplayTest(Path, NpcCount > 0 ? NpcCount : 50, DurationSeconds > 0.0f ? DurationSeconds : 30.0f,
+	                          PlaySpeed);
+}
+
+void URfsnCheatManager::RfsnDirectorTest(float DurationSeconds)
+{
+	UWorld* World = GetWorld();
+	URfsnLoadTest* LoadTest = World ? World->GetSubsystem<URfsnLoadTest>() : nullptr;
+	if (!LoadTest)
+	{
+		RFSN_WARNING(TEXT("RfsnDirectorTest: No load test subsystem"));
+		return;
+	}
+
+	if (LoadTest->IsRunning())
+	{
+		RFSN_LOG(TEXT("RfsnDirectorTest: Stopping current run"));
+		LoadTest->StopLoadTest();
+		return;
+	}
+
+	LoadTest->StartDirectorTest(DurationSeconds > 0.0f ? DurationSeconds : 60.0f);
+}
+
+void URfsnCheatManager::RfsnSetTime(int32 Day, float Hour)
+{
+	UWorld* World = GetWorld();
+	URfsnGameClock* Clock = World ? World->GetSubsystem<URfsnGameClock>() : nullptr;
+	if (!Clock)
+	{
+		RFSN_WARNING(TEXT("RfsnSetTime: No game clock subsystem"));
+		return;
+	}
+
+	Clock->SetGameTime(Day, Hour);
+	RFSN_LOG(TEXT("RfsnSetTime: day %d (weekday %d) %.2fh"), Clock->GetDay(), Clock->GetDayOfWeek(),
+	         Clock->GetGameHour());
+}
+
+void URfsnCheatManager::RfsnTimeScale(float SecondsPerGameHour)
+{
+	UWorld* World = GetWorld();
+	URfsnGameClock* Clock = World ? World->GetSubsystem<URfsnGameClock>() : nullptr;
+	if (!Clock)
+	{
+		RFSN_WARNING(TEXT("RfsnTimeScale: No game clock subsystem"));
+		return;
+	}
+
+	Clock->SetTimeScale(SecondsPerGameHour > 0.0f ? SecondsPerGameHour : 60.0f);
 }
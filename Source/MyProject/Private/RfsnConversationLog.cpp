@@ -2,41 +2,593 @@
 
 #include "RfsnConversationLog.h"
 #include "RfsnNpcClientComponent.h"
+#include "Algo/BinarySearch.h"
+#include "Async/Async.h"
+#include "GameFramework/Actor.h"
+#include "HAL/FileManager.h"
+#include "Misc/Compression.h"
+#include "Misc/Crc.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Misc/ScopeLock.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
 
-URfsnConversationLog::URfsnConversationLog() {
-  PrimaryComponentTick.bCanEverTick = false;
+namespace RfsnConversation {
+/** "RFCL" */
+constexpr uint32 ChunkMagic = 0x4C434652;
+constexpr uint32 ChunkVersion = 1;
+
+/** Magic, version, first serial, count, raw size, compressed size, CRC */
+constexpr int32 ChunkHeaderSize = 7 * sizeof(uint32);
+
+bool IsWordChar(TCHAR C) { return FChar::IsAlnum(C) || C == TEXT('\''); }
+
+/** A chunk file and the serials to look up in it */
+struct FChunkRead {
+  int32 Chunk = INDEX_NONE;
+  FString Path;
+  TArray<int32> Serials;
+};
+
+/** Compress Raw behind a chunk header; returns the file size, 0 on failure */
+int64 WriteChunkFile(const FString &Path, int32 FirstSerial, int32 Count,
+                     const TArray<uint8> &Raw) {
+  int32 CompressedSize =
+      FCompression::CompressMemoryBound(NAME_Zlib, Raw.Num());
+  TArray<uint8> Compressed;
+  Compressed.SetNumUninitialized(CompressedSize);
+  if (!FCompression::CompressMemory(NAME_Zlib, Compressed.GetData(),
+                                    CompressedSize, Raw.GetData(),
+                                    Raw.Num())) {
+    return 0;
+  }
+
+  TArray<uint8> File;
+  File.Reserve(ChunkHeaderSize + CompressedSize);
+  FMemoryWriter Writer(File);
+  uint32 Magic = ChunkMagic;
+  uint32 Version = ChunkVersion;
+  int32 RawSize = Raw.Num();
+  uint32 Crc = FCrc::MemCrc32(Raw.GetData(), Raw.Num());
+  Writer << Magic << Version << FirstSerial << Count << RawSize
+         << CompressedSize << Crc;
+  Writer.Serialize(Compressed.GetData(), CompressedSize);
+
+  // Written next to the final name and moved over it, so a reader never sees
+  // half a chunk
+  const FString TempPath = Path + TEXT(".tmp");
+  if (!FFileHelper::SaveArrayToFile(File, *TempPath) ||
+      !IFileManager::Get().Move(*Path, *TempPath)) {
+    return 0;
+  }
+  return File.Num();
 }
+} // namespace RfsnConversation
+
+// ─────────────────────────────────────────────────────────────
+// FRfsnConversationRing
+// ─────────────────────────────────────────────────────────────
+
+int32 FRfsnConversationRing::Add(const FString &Speaker,
+                                 const FString &Message,
+                                 const FDateTime &Timestamp, bool bIsPlayer) {
+  check(Slots.Num() > 0);
+
+  int32 SlotIndex = Head;
+  if (Count < Slots.Num()) {
+    SlotIndex = (Head + Count) % Slots.Num();
+    Count++;
+  } else {
+    // Full: the oldest slot is reused in place
+    Head = (Head + 1) % Slots.Num();
+  }
+
+  FSlot &Slot = Slots[SlotIndex];
+  Slot.Message = Message;
+  Slot.Timestamp = Timestamp;
+  Slot.Speaker = Intern(Speaker);
+  Slot.bIsPlayer = bIsPlayer;
+  return NextSerial++;
+}
+
+void FRfsnConversationRing::SetCapacity(int32 NewCapacity) {
+  NewCapacity = FMath::Max(1, NewCapacity);
+  if (NewCapacity == Slots.Num()) {
+    return;
+  }
+
+  const int32 Keep = FMath::Min(Count, NewCapacity);
+  TArray<FSlot> Resized;
+  Resized.SetNum(NewCapacity);
+  for (int32 Index = 0; Index < Keep; Index++) {
+    Resized[Index] =
+        MoveTemp(Slots[(Head + Count - Keep + Index) % Slots.Num()]);
+  }
+
+  Slots = MoveTemp(Resized);
+  Head = 0;
+  Count = Keep;
+}
+
+void FRfsnConversationRing::Reset() {
+  for (FSlot &Slot : Slots) {
+    Slot.Message.Reset();
+  }
+  Head = 0;
+  Count = 0;
+}
+
+FRfsnConversationEntry FRfsnConversationRing::Get(int32 Index) const {
+  const FSlot &Slot = SlotAt(Index);
 
-void URfsnConversationLog::LogPlayerMessage(const FString &Message) {
   FRfsnConversationEntry Entry;
-  Entry.Speaker = TEXT("Player");
-  Entry.Message = Message;
-  Entry.Timestamp = FDateTime::Now();
-  Entry.bIsPlayer = true;
+  Entry.Speaker = Speakers[Slot.Speaker];
+  Entry.Message = Slot.Message;
+  Entry.Timestamp = Slot.Timestamp;
+  Entry.bIsPlayer = Slot.bIsPlayer;
+  return Entry;
+}
 
-  Entries.Add(Entry);
+bool FRfsnConversationRing::FindBySerial(
+    int32 Serial, FRfsnConversationEntry &OutEntry) const {
+  if (Serial < GetOldestSerial() || Serial >= NextSerial) {
+    return false;
+  }
+  OutEntry = Get(Serial - GetOldestSerial());
+  return true;
+}
 
-  // Trim if over max
-  while (Entries.Num() > MaxEntries) {
-    Entries.RemoveAt(0);
+void FRfsnConversationRing::ForEach(
+    TFunctionRef<void(const FString &Speaker, const FString &Message,
+                      const FDateTime &Timestamp, bool bIsPlayer)>
+        Visitor,
+    int32 MaxCount) const {
+  for (int32 Index = Count - FMath::Clamp(MaxCount, 0, Count); Index < Count;
+       Index++) {
+    const FSlot &Slot = SlotAt(Index);
+    Visitor(Speakers[Slot.Speaker], Slot.Message, Slot.Timestamp,
+            Slot.bIsPlayer);
   }
+}
 
-  OnConversationUpdated.Broadcast(Entry);
+uint16 FRfsnConversationRing::Intern(const FString &Speaker) {
+  if (const uint16 *Id = SpeakerIds.Find(Speaker)) {
+    return *Id;
+  }
+
+  check(Speakers.Num() < MAX_uint16);
+  const uint16 Id = static_cast<uint16>(Speakers.Add(Speaker));
+  SpeakerIds.Add(Speaker, Id);
+  return Id;
+}
+
+// ─────────────────────────────────────────────────────────────
+// FRfsnTranscriptIndex
+// ─────────────────────────────────────────────────────────────
+
+void FRfsnTranscriptIndex::Add(int32 Serial, FStringView Message) {
+  TArray<FString> Words;
+  Tokenize(Message, Words);
+
+  for (const FString &Word : Words) {
+    TArray<int32> &Serials = Postings.FindOrAdd(Word);
+    // Serials only grow, so a repeated word only has to look at the last one
+    if (Serials.Num() == 0 || Serials.Last() != Serial) {
+      Serials.Add(Serial);
+    }
+  }
+
+  if (FirstSerial == NextSerial) {
+    FirstSerial = Serial;
+  }
+  NextSerial = Serial + 1;
+}
+
+void FRfsnTranscriptIndex::RemoveBefore(int32 Serial) {
+  for (auto It = Postings.CreateIterator(); It; ++It) {
+    TArray<int32> &Serials = It.Value();
+    const int32 Removed = Algo::LowerBound(Serials, Serial);
+    if (Removed == Serials.Num()) {
+      It.RemoveCurrent();
+    } else if (Removed > 0) {
+      Serials.RemoveAt(0, Removed);
+    }
+  }
+  FirstSerial = FMath::Clamp(Serial, FirstSerial, NextSerial);
+}
+
+void FRfsnTranscriptIndex::Search(FStringView Query, int32 MaxResults,
+                                  TArray<int32> &OutSerials) const {
+  OutSerials.Reset();
+
+  TArray<FString> Words;
+  Tokenize(Query, Words);
+  if (Words.Num() == 0 || MaxResults <= 0) {
+    return;
+  }
+
+  TArray<const TArray<int32> *, TInlineAllocator<8>> Lists;
+  for (const FString &Word : Words) {
+    const TArray<int32> *Serials = Postings.Find(Word);
+    if (!Serials) {
+      return;
+    }
+    Lists.Add(Serials);
+  }
+
+  // Walk the shortest list from the newest end and look the rest up
+  Lists.Sort([](const TArray<int32> &A, const TArray<int32> &B) {
+    return A.Num() < B.Num();
+  });
+
+  const TArray<int32> &Shortest = *Lists[0];
+  for (int32 Index = Shortest.Num() - 1;
+       Index >= 0 && OutSerials.Num() < MaxResults; Index--) {
+    const int32 Serial = Shortest[Index];
+    bool bInAll = true;
+    for (int32 List = 1; List < Lists.Num() && bInAll; List++) {
+      bInAll = Algo::BinarySearch(*Lists[List], Serial) != INDEX_NONE;
+    }
+    if (bInAll) {
+      OutSerials.Add(Serial);
+    }
+  }
+}
+
+void FRfsnTranscriptIndex::Reset() {
+  Postings.Reset();
+  FirstSerial = NextSerial = 0;
+}
+
+SIZE_T FRfsnTranscriptIndex::GetAllocatedSize() const {
+  SIZE_T Size = Postings.GetAllocatedSize();
+  for (const TPair<FString, TArray<int32>> &Pair : Postings) {
+    Size += Pair.Key.GetAllocatedSize() + Pair.Value.GetAllocatedSize();
+  }
+  return Size;
+}
+
+void FRfsnTranscriptIndex::Tokenize(FStringView Text,
+                                    TArray<FString> &OutWords) {
+  using namespace RfsnConversation;
+
+  OutWords.Reset();
+  int32 Index = 0;
+  while (Index < Text.Len()) {
+    while (Index < Text.Len() && !IsWordChar(Text[Index])) {
+      Index++;
+    }
+
+    int32 Start = Index;
+    while (Index < Text.Len() && IsWordChar(Text[Index])) {
+      Index++;
+    }
+
+    // Quotes around a word aren't part of it
+    int32 End = Index;
+    while (Start < End && Text[Start] == TEXT('\'')) {
+      Start++;
+    }
+    while (End > Start && Text[End - 1] == TEXT('\'')) {
+      End--;
+    }
+
+    if (End > Start) {
+      FString Word(Text.Mid(Start, End - Start));
+      Word.ToLowerInline();
+      OutWords.Add(MoveTemp(Word));
+    }
+  }
+}
+
+// ─────────────────────────────────────────────────────────────
+// FRfsnTranscriptExporter
+// ─────────────────────────────────────────────────────────────
+
+FRfsnTranscriptExporter::~FRfsnTranscriptExporter() { Finish(); }
+
+void FRfsnTranscriptExporter::Begin(const FString &InDirectory) {
+  Finish();
+
+  Directory = InDirectory;
+  IFileManager::Get().MakeDirectory(*Directory, true);
+  Pending.Reset();
+  Chunks.Reset();
+
+  FScopeLock Lock(&Shared->Lock);
+  Shared->Stats = FRfsnTranscriptExportStats();
+}
+
+void FRfsnTranscriptExporter::Add(int32 Serial,
+                                  const FRfsnConversationEntry &Entry) {
+  if (!IsActive()) {
+    return;
+  }
+
+  // A chunk holds consecutive serials; a gap starts a new one
+  if (Pending.Num() > 0 && Serial != PendingFirstSerial + Pending.Num()) {
+    FlushChunk();
+  }
+  if (Pending.Num() == 0) {
+    PendingFirstSerial = Serial;
+  }
+
+  Pending.Add(Entry);
+  if (Pending.Num() >= ChunkEntries) {
+    FlushChunk();
+  }
+}
+
+void FRfsnTranscriptExporter::FlushChunk() {
+  if (!IsActive() || Pending.Num() == 0) {
+    return;
+  }
+  ReleaseWrittenChunks();
+
+  // Serializing is cheap and needs the entries; compressing and writing go to
+  // the pool
+  TArray<uint8> Raw;
+  FMemoryWriter Writer(Raw);
+  int32 Count = Pending.Num();
+  Writer << Count;
+  for (FRfsnConversationEntry &Entry : Pending) {
+    Writer << Entry.Speaker << Entry.Message << Entry.Timestamp
+           << Entry.bIsPlayer;
+  }
+
+  FChunkInfo &Chunk = Chunks.AddDefaulted_GetRef();
+  Chunk.FirstSerial = PendingFirstSerial;
+  Chunk.Count = Count;
+  Chunk.Path = Directory / FString::Printf(TEXT("Chunk_%05d.rfsnlog"),
+                                           Chunks.Num() - 1);
+  Chunk.Entries = MoveTemp(Pending);
+  Pending.Reset();
+
+  Chunk.Written = Async(
+      EAsyncExecution::ThreadPool,
+      [Raw = MoveTemp(Raw), Path = Chunk.Path, FirstSerial = Chunk.FirstSerial,
+       Count, Shared = Shared]() {
+        const int64 FileSize =
+            RfsnConversation::WriteChunkFile(Path, FirstSerial, Count, Raw);
+
+        FScopeLock Lock(&Shared->Lock);
+        FRfsnTranscriptExportStats &Stats = Shared->Stats;
+        if (FileSize > 0) {
+          Stats.ChunksWritten++;
+          Stats.EntriesWritten += Count;
+          Stats.RawBytes += Raw.Num();
+          Stats.CompressedBytes += FileSize;
+        } else {
+          Stats.Failures++;
+        }
+        return FileSize > 0;
+      })
+      .Share();
+}
+
+void FRfsnTranscriptExporter::Finish() {
+  FlushChunk();
+  WaitForWrites();
+}
+
+FRfsnTranscriptExportStats FRfsnTranscriptExporter::GetStats() const {
+  FScopeLock Lock(&Shared->Lock);
+  return Shared->Stats;
+}
+
+TFuture<TMap<int32, FRfsnConversationEntry>>
+FRfsnTranscriptExporter::FindBySerialsAsync(
+    const TArray<int32> &Serials) const {
+  using namespace RfsnConversation;
+
+  TMap<int32, FRfsnConversationEntry> Found;
+  TArray<FChunkRead> Reads;
+  for (int32 Serial : Serials) {
+    if (Pending.IsValidIndex(Serial - PendingFirstSerial)) {
+      Found.Add(Serial, Pending[Serial - PendingFirstSerial]);
+      continue;
+    }
+
+    const int32 ChunkIndex =
+        Algo::UpperBoundBy(Chunks, Serial, &FChunkInfo::FirstSerial) - 1;
+    if (!Chunks.IsValidIndex(ChunkIndex) ||
+        Serial >= Chunks[ChunkIndex].FirstSerial + Chunks[ChunkIndex].Count) {
+      continue;
+    }
+
+    // Still being written (or failed to be): the entries are at hand
+    const FChunkInfo &Chunk = Chunks[ChunkIndex];
+    if (Chunk.Entries.Num() > 0) {
+      Found.Add(Serial, Chunk.Entries[Serial - Chunk.FirstSerial]);
+      continue;
+    }
+
+    FChunkRead *Read =
+        Reads.FindByPredicate([ChunkIndex](const FChunkRead &Other) {
+          return Other.Chunk == ChunkIndex;
+        });
+    if (!Read) {
+      Read = &Reads.AddDefaulted_GetRef();
+      Read->Chunk = ChunkIndex;
+      Read->Path = Chunk.Path;
+    }
+    Read->Serials.Add(Serial);
+  }
+
+  if (Reads.Num() == 0) {
+    return MakeFulfilledPromise<TMap<int32, FRfsnConversationEntry>>(
+               MoveTemp(Found))
+        .GetFuture();
+  }
+
+  // Only finished files are read, so nothing here waits on a write
+  return Async(EAsyncExecution::ThreadPool,
+               [Found = MoveTemp(Found), Reads = MoveTemp(Reads)]() mutable {
+                 TArray<FRfsnConversationEntry> Entries;
+                 for (const FChunkRead &Read : Reads) {
+                   int32 FirstSerial = 0;
+                   if (!ReadChunk(Read.Path, FirstSerial, Entries)) {
+                     continue;
+                   }
+                   for (int32 Serial : Read.Serials) {
+                     if (Entries.IsValidIndex(Serial - FirstSerial)) {
+                       Found.Add(Serial, Entries[Serial - FirstSerial]);
+                     }
+                   }
+                 }
+                 return MoveTemp(Found);
+               });
+}
+
+bool FRfsnTranscriptExporter::ReadChunk(
+    const FString &Path, int32 &OutFirstSerial,
+    TArray<FRfsnConversationEntry> &OutEntries) {
+  using namespace RfsnConversation;
+
+  OutEntries.Reset();
+
+  TArray<uint8> File;
+  if (!FFileHelper::LoadFileToArray(File, *Path, FILEREAD_Silent) ||
+      File.Num() < ChunkHeaderSize) {
+    return false;
+  }
+
+  FMemoryReader Header(File);
+  uint32 Magic = 0;
+  uint32 Version = 0;
+  int32 Count = 0;
+  int32 RawSize = 0;
+  int32 CompressedSize = 0;
+  uint32 Crc = 0;
+  Header << Magic << Version << OutFirstSerial << Count << RawSize
+         << CompressedSize << Crc;
+  if (Magic != ChunkMagic || Version != ChunkVersion || Count < 0 ||
+      RawSize < 0 || CompressedSize != File.Num() - ChunkHeaderSize) {
+    return false;
+  }
+
+  TArray<uint8> Raw;
+  Raw.SetNumUninitialized(RawSize);
+  if (!FCompression::UncompressMemory(NAME_Zlib, Raw.GetData(), RawSize,
+                                      File.GetData() + ChunkHeaderSize,
+                                      CompressedSize) ||
+      FCrc::MemCrc32(Raw.GetData(), Raw.Num()) != Crc) {
+    return false;
+  }
+
+  FMemoryReader Reader(Raw);
+  int32 Stored = 0;
+  Reader << Stored;
+  if (Stored != Count) {
+    return false;
+  }
+
+  OutEntries.SetNum(Count);
+  for (FRfsnConversationEntry &Entry : OutEntries) {
+    Reader << Entry.Speaker << Entry.Message << Entry.Timestamp
+           << Entry.bIsPlayer;
+  }
+  return !Reader.IsError() && Reader.AtEnd();
+}
+
+bool FRfsnTranscriptExporter::ReadTranscript(
+    const FString &InDirectory, TArray<FRfsnConversationEntry> &OutEntries) {
+  OutEntries.Reset();
+
+  TArray<FString> Files;
+  IFileManager::Get().FindFiles(Files, *(InDirectory / TEXT("*.rfsnlog")),
+                                true, false);
+  // Chunk numbers are zero-padded, so name order is write order
+  Files.Sort();
+
+  TArray<FRfsnConversationEntry> Chunk;
+  for (const FString &File : Files) {
+    int32 FirstSerial = 0;
+    if (!ReadChunk(InDirectory / File, FirstSerial, Chunk)) {
+      return false;
+    }
+    OutEntries.Append(MoveTemp(Chunk));
+  }
+  return true;
+}
+
+void FRfsnTranscriptExporter::WaitForWrites() {
+  for (const FChunkInfo &Chunk : Chunks) {
+    if (Chunk.Written.IsValid()) {
+      Chunk.Written.Wait();
+    }
+  }
+  ReleaseWrittenChunks();
+}
+
+void FRfsnTranscriptExporter::ReleaseWrittenChunks() {
+  for (FChunkInfo &Chunk : Chunks) {
+    if (Chunk.Entries.Num() > 0 && Chunk.Written.IsValid() &&
+        Chunk.Written.IsReady() && Chunk.Written.Get()) {
+      Chunk.Entries.Empty();
+    }
+  }
+}
+
+// ─────────────────────────────────────────────────────────────
+// URfsnConversationLog
+// ─────────────────────────────────────────────────────────────
+
+URfsnConversationLog::URfsnConversationLog() {
+  PrimaryComponentTick.bCanEverTick = false;
+}
+
+void URfsnConversationLog::BeginPlay() {
+  Super::BeginPlay();
+
+  Ring.SetCapacity(MaxEntries);
+  if (bExportTranscript) {
+    const FString Session = FString::Printf(
+        TEXT("%s_%s"), *FDateTime::Now().ToString(TEXT("%Y%m%d-%H%M%S")),
+        GetOwner() ? *GetOwner()->GetName() : TEXT("Log"));
+    Exporter.ChunkEntries = ExportChunkEntries;
+    Exporter.Begin(FPaths::ProjectSavedDir() / TEXT("Conversations") /
+                   Session);
+  }
+}
+
+void URfsnConversationLog::EndPlay(const EEndPlayReason::Type EndPlayReason) {
+  Exporter.Finish();
+  Super::EndPlay(EndPlayReason);
+}
+
+void URfsnConversationLog::LogPlayerMessage(const FString &Message) {
+  LogEntry(TEXT("Player"), Message, true);
 }
 
 void URfsnConversationLog::LogNpcMessage(const FString &NpcName,
                                          const FString &Message) {
+  LogEntry(NpcName, Message, false);
+}
+
+void URfsnConversationLog::LogEntry(const FString &Speaker,
+                                    const FString &Message, bool bIsPlayer) {
   FRfsnConversationEntry Entry;
-  Entry.Speaker = NpcName;
+  Entry.Speaker = Speaker;
   Entry.Message = Message;
   Entry.Timestamp = FDateTime::Now();
-  Entry.bIsPlayer = false;
+  Entry.bIsPlayer = bIsPlayer;
 
-  Entries.Add(Entry);
-
-  // Trim if over max
-  while (Entries.Num() > MaxEntries) {
-    Entries.RemoveAt(0);
+  // MaxEntries can be changed at runtime; a no-op unless it was
+  Ring.SetCapacity(MaxEntries);
+  const int32 Serial = Ring.Add(Speaker, Message, Entry.Timestamp, bIsPlayer);
+  // Only exported entries are indexed: they are the ones a search can still
+  // return once the ring drops them
+  if (Exporter.IsActive()) {
+    Index.Add(Serial, Message);
+    // Past the bound the oldest quarter goes in one pass rather than an
+    // entry per message
+    if (MaxIndexedEntries > 0 && Index.NumEntries() > MaxIndexedEntries) {
+      Index.RemoveBefore(Serial + 1 -
+                         FMath::Max(1, MaxIndexedEntries * 3 / 4));
+    }
+    Exporter.Add(Serial, Entry);
   }
 
   OnConversationUpdated.Broadcast(Entry);
@@ -45,14 +597,102 @@ void URfsnConversationLog::LogNpcMessage(const FString &NpcName,
 TArray<FRfsnConversationEntry>
 URfsnConversationLog::GetRecentEntries(int32 Count) const {
   TArray<FRfsnConversationEntry> Recent;
-  int32 Start = FMath::Max(0, Entries.Num() - Count);
-  for (int32 i = Start; i < Entries.Num(); ++i) {
-    Recent.Add(Entries[i]);
-  }
+  Recent.Reserve(FMath::Clamp(Count, 0, Ring.Num()));
+  Ring.ForEach(
+      [&Recent](const FString &Speaker, const FString &Message,
+                const FDateTime &Timestamp, bool bIsPlayer) {
+        FRfsnConversationEntry &Entry = Recent.AddDefaulted_GetRef();
+        Entry.Speaker = Speaker;
+        Entry.Message = Message;
+        Entry.Timestamp = Timestamp;
+        Entry.bIsPlayer = bIsPlayer;
+      },
+      Count);
   return Recent;
 }
 
-void URfsnConversationLog::ClearLog() { Entries.Empty(); }
+void URfsnConversationLog::SearchTranscript(
+    const FString &Query, int32 MaxResults,
+    const FOnTranscriptSearched &OnResults) {
+  SearchTranscriptAsync(Query, MaxResults)
+      .Then([WeakThis = TWeakObjectPtr<URfsnConversationLog>(this),
+             OnResults](TFuture<TArray<FRfsnConversationEntry>> Future) {
+        TArray<FRfsnConversationEntry> Results = Future.Get();
+        AsyncTask(ENamedThreads::GameThread,
+                  [WeakThis, OnResults, Results = MoveTemp(Results)]() {
+                    if (WeakThis.IsValid()) {
+                      OnResults.ExecuteIfBound(Results);
+                    }
+                  });
+      });
+}
+
+TFuture<TArray<FRfsnConversationEntry>>
+URfsnConversationLog::SearchTranscriptAsync(const FString &Query,
+                                            int32 MaxResults) {
+  TArray<FRfsnConversationEntry> Results;
+
+  // Without a transcript there is nothing past the ring, and it is short
+  // enough to scan
+  if (!Exporter.IsActive()) {
+    TArray<FString> QueryWords;
+    FRfsnTranscriptIndex::Tokenize(Query, QueryWords);
+    TArray<FString> Words;
+    for (int32 Age = Ring.Num() - 1;
+         Age >= 0 && QueryWords.Num() > 0 && Results.Num() < MaxResults;
+         Age--) {
+      FRfsnConversationEntry Entry = Ring.Get(Age);
+      FRfsnTranscriptIndex::Tokenize(Entry.Message, Words);
+      if (QueryWords.ContainsByPredicate([&Words](const FString &Word) {
+            return !Words.Contains(Word);
+          })) {
+        continue;
+      }
+      Results.Add(MoveTemp(Entry));
+    }
+    return MakeFulfilledPromise<TArray<FRfsnConversationEntry>>(
+               MoveTemp(Results))
+        .GetFuture();
+  }
+
+  TArray<int32> Serials;
+  Index.Search(Query, MaxResults, Serials);
+
+  // Entries still in the ring are copied now; the rest come from the exporter
+  TMap<int32, FRfsnConversationEntry> Held;
+  TArray<int32> Dropped;
+  for (int32 Serial : Serials) {
+    FRfsnConversationEntry Entry;
+    if (Ring.FindBySerial(Serial, Entry)) {
+      Held.Add(Serial, MoveTemp(Entry));
+    } else {
+      Dropped.Add(Serial);
+    }
+  }
+
+  return Exporter.FindBySerialsAsync(Dropped).Then(
+      [Serials = MoveTemp(Serials), Held = MoveTemp(Held)](
+          TFuture<TMap<int32, FRfsnConversationEntry>> Future) {
+        const TMap<int32, FRfsnConversationEntry> &Read = Future.Get();
+        TArray<FRfsnConversationEntry> Ordered;
+        Ordered.Reserve(Serials.Num());
+        for (int32 Serial : Serials) {
+          const FRfsnConversationEntry *Entry = Held.Find(Serial);
+          Entry = Entry ? Entry : Read.Find(Serial);
+          if (Entry) {
+            Ordered.Add(*Entry);
+          }
+        }
+        return Ordered;
+      });
+}
+
+void URfsnConversationLog::FlushTranscript() { Exporter.FlushChunk(); }
+
+void URfsnConversationLog::ClearLog() {
+  Ring.Reset();
+  Index.Reset();
+}
 
 void URfsnConversationLog::BindToRfsnClient(URfsnNpcClientComponent *Client) {
   if (Client) {
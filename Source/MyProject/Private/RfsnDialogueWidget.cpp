@@ -1,17 +1,294 @@
 // RFSN Dialogue Widget Implementation
 
 #include "RfsnDialogueWidget.h"
+#include "RfsnMetrics.h"
+#include "RfsnTrace.h"
+#include "Engine/GameInstance.h"
 #include "Engine/World.h"
+#include "Fonts/FontMeasure.h"
+#include "Framework/Application/SlateApplication.h"
+#include "Rendering/SlateRenderer.h"
+#include "Styling/CoreStyle.h"
 #include "TimerManager.h"
 
+// ─────────────────────────────────────────────────────────────
+// FRfsnSubtitleLayout
+// ─────────────────────────────────────────────────────────────
+
+void FRfsnSubtitleLayout::Append(const FString &Text) {
+  const int32 End = Text.Len();
+  int32 RunStart = LaidOut;
+
+  while (RunStart < End) {
+    const bool bSpace = FChar::IsWhitespace(Text[RunStart]);
+    int32 RunEnd = RunStart + 1;
+    while (RunEnd < End && FChar::IsWhitespace(Text[RunEnd]) == bSpace) {
+      RunEnd++;
+    }
+
+    const float Width = MeasureRun ? MeasureRun(Text, RunStart, RunEnd) : 0.0f;
+    MeasuredChars += RunEnd - RunStart;
+
+    if (bSpace) {
+      // The word before is settled; spaces never wrap on their own
+      LineWidth += WordWidth + Width;
+      WordWidth = 0.0f;
+      WordStart = RunEnd;
+    } else {
+      // A word continued by a later append keeps growing from where it was
+      WordWidth += Width;
+      if (WordStart > LineStart && LineWidth + WordWidth > MaxWidth) {
+        LineBreaks.Add(WordStart);
+        LineStart = WordStart;
+        LineWidth = 0.0f;
+      }
+    }
+
+    RunStart = RunEnd;
+  }
+
+  LaidOut = End;
+}
+
+void FRfsnSubtitleLayout::Reset() {
+  LineBreaks.Reset();
+  LaidOut = 0;
+  LineStart = 0;
+  WordStart = 0;
+  LineWidth = 0.0f;
+  WordWidth = 0.0f;
+  MeasuredChars = 0;
+}
+
+void FRfsnSubtitleLayout::GetLines(const FString &Text,
+                                   TArray<FString> &OutLines) const {
+  OutLines.Reset(LineBreaks.Num() + 1);
+
+  int32 Start = 0;
+  for (int32 Index = 0; Index <= LineBreaks.Num(); Index++) {
+    const int32 End = Index < LineBreaks.Num()
+                          ? FMath::Min(LineBreaks[Index], Text.Len())
+                          : Text.Len();
+    OutLines.Add(Text.Mid(Start, End - Start).TrimEnd());
+    Start = End;
+  }
+}
+
+// ─────────────────────────────────────────────────────────────
+// FRfsnSubtitleQueue
+// ─────────────────────────────────────────────────────────────
+
+void FRfsnSubtitleQueue::Push(FString &&Line) {
+  if (Count == Slots.Num()) {
+    // Unwrap into a doubled array so the oldest line is back at slot 0
+    TArray<FString> Grown;
+    Grown.SetNum(FMath::Max(8, Slots.Num() * 2));
+    for (int32 Index = 0; Index < Count; Index++) {
+      Grown[Index] = MoveTemp(Slots[(Head + Index) & (Slots.Num() - 1)]);
+    }
+    Slots = MoveTemp(Grown);
+    Head = 0;
+  }
+
+  Slots[(Head + Count) & (Slots.Num() - 1)] = MoveTemp(Line);
+  Count++;
+}
+
+bool FRfsnSubtitleQueue::Pop(FString &OutLine) {
+  if (Count == 0) {
+    return false;
+  }
+
+  OutLine = MoveTemp(Slots[Head]);
+  Slots[Head].Reset();
+  Head = (Head + 1) & (Slots.Num() - 1);
+  Count--;
+  return true;
+}
+
+FString &FRfsnSubtitleQueue::Last() {
+  check(Count > 0);
+  return Slots[(Head + Count - 1) & (Slots.Num() - 1)];
+}
+
+void FRfsnSubtitleQueue::Reset() {
+  for (FString &Slot : Slots) {
+    Slot.Reset();
+  }
+  Head = 0;
+  Count = 0;
+}
+
+// ─────────────────────────────────────────────────────────────
+// FRfsnSubtitleStream
+// ─────────────────────────────────────────────────────────────
+
+bool FRfsnSubtitleStream::Append(FStringView Fragment, bool bEndsTurn) {
+  const bool bCloses = bEndsTurn || EndsSentence(Fragment);
+
+  if (bTailOpen) {
+    Queue.Last().Append(Fragment.GetData(), Fragment.Len());
+    bTailOpen = !bCloses;
+    return false;
+  }
+
+  if (IsCurrentOpen()) {
+    FullText.Append(Fragment.GetData(), Fragment.Len());
+    bCurrentOpen = !bCloses;
+    if (RevealSpeed <= 0.0f) {
+      RevealTo(FullText.Len());
+    }
+    return false;
+  }
+
+  // A new line; the space a token carries in front of its word isn't shown
+  FString Line(Fragment.TrimStart());
+  if (Line.IsEmpty()) {
+    return false;
+  }
+
+  if (!bShowing) {
+    ShowLine(MoveTemp(Line), !bCloses);
+    return true;
+  }
+
+  Queue.Push(MoveTemp(Line));
+  bTailOpen = !bCloses;
+  RFSN_TRACE_COUNTER_ADD(RfsnQueuedSentences, 1);
+  return false;
+}
+
+void FRfsnSubtitleStream::Show(FStringView Line) {
+  ShowLine(FString(Line), false);
+}
+
+void FRfsnSubtitleStream::CloseOpenLine() {
+  if (bTailOpen) {
+    bTailOpen = false;
+  } else {
+    bCurrentOpen = false;
+  }
+}
+
+bool FRfsnSubtitleStream::ShowNext() {
+  FString Line;
+  if (!Queue.Pop(Line)) {
+    return false;
+  }
+
+  RFSN_TRACE_COUNTER_SUBTRACT(RfsnQueuedSentences, 1);
+
+  // If that was the newest line, text still streaming into it lands on screen
+  const bool bOpen = Queue.IsEmpty() && bTailOpen;
+  if (Queue.IsEmpty()) {
+    bTailOpen = false;
+  }
+  ShowLine(MoveTemp(Line), bOpen);
+  return true;
+}
+
+int32 FRfsnSubtitleStream::Reveal(float DeltaTime) {
+  if (!bShowing || IsFullyRevealed()) {
+    return 0;
+  }
+
+  const int32 Before = DisplayText.Len();
+  RevealProgress += DeltaTime * RevealSpeed;
+  RevealTo(FMath::Min(FMath::FloorToInt(RevealProgress), FullText.Len()));
+
+  // Caught up with the stream: text that arrives later starts revealing from
+  // then, not all at once
+  if (IsFullyRevealed()) {
+    RevealProgress = static_cast<float>(FullText.Len());
+  }
+  return DisplayText.Len() - Before;
+}
+
+void FRfsnSubtitleStream::Reset() {
+  RFSN_TRACE_COUNTER_SUBTRACT(RfsnQueuedSentences, Queue.Num());
+  Queue.Reset();
+  FullText.Reset();
+  DisplayText.Reset();
+  Layout.Reset();
+  RevealProgress = 0.0f;
+  bShowing = false;
+  bCurrentOpen = false;
+  bTailOpen = false;
+}
+
+bool FRfsnSubtitleStream::EndsSentence(FStringView Text) {
+  int32 Index = Text.Len() - 1;
+  while (Index >= 0 &&
+         (FChar::IsWhitespace(Text[Index]) || Text[Index] == TEXT('"') ||
+          Text[Index] == TEXT('\'') || Text[Index] == TEXT(')') ||
+          Text[Index] == TEXT(']') || Text[Index] == TEXT('*'))) {
+    Index--;
+  }
+
+  if (Index < 0) {
+    return false;
+  }
+
+  const TCHAR Last = Text[Index];
+  return Last == TEXT('.') || Last == TEXT('!') || Last == TEXT('?') ||
+         Last == TEXT('\u2026');
+}
+
+void FRfsnSubtitleStream::ShowLine(FString &&Line, bool bOpen) {
+  FullText = MoveTemp(Line);
+  DisplayText.Reset(FullText.Len());
+  Layout.Reset();
+  RevealProgress = 0.0f;
+  bShowing = true;
+  bCurrentOpen = bOpen;
+  LinesShown++;
+
+  if (RevealSpeed <= 0.0f) {
+    RevealTo(FullText.Len());
+  }
+}
+
+void FRfsnSubtitleStream::RevealTo(int32 NumChars) {
+  const int32 Revealed = DisplayText.Len();
+  if (NumChars <= Revealed) {
+    return;
+  }
+
+  DisplayText.AppendChars(*FullText + Revealed, NumChars - Revealed);
+  Layout.Append(DisplayText);
+}
+
+// ─────────────────────────────────────────────────────────────
+// URfsnDialogueWidget
+// ─────────────────────────────────────────────────────────────
+
 URfsnDialogueWidget::URfsnDialogueWidget() {
   PrimaryComponentTick.bCanEverTick = true;
   PrimaryComponentTick.bStartWithTickEnabled = false;
+
+  SubtitleFont = FCoreStyle::GetDefaultFontStyle("Regular", 18);
 }
 
-void URfsnDialogueWidget::BeginPlay() { Super::BeginPlay(); }
+void URfsnDialogueWidget::BeginPlay() {
+  Super::BeginPlay();
+
+  Stream.Layout.MeasureRun = [this](const FString &Text, int32 Start,
+                                    int32 End) -> float {
+    if (FSlateApplication::IsInitialized()) {
+      const TSharedRef<FSlateFontMeasure> FontMeasure =
+          FSlateApplication::Get().GetRenderer()->GetFontMeasureService();
+      return FontMeasure->Measure(Text, Start, End, SubtitleFont).X;
+    }
+
+    // No renderer (dedicated server, commandlets): half an em per character
+    return (End - Start) * SubtitleFont.Size * 0.5f;
+  };
+  ApplySettings();
+}
 
 void URfsnDialogueWidget::EndPlay(const EEndPlayReason::Type EndPlayReason) {
+  Stream.Reset();
+
   if (UWorld *World = GetWorld()) {
     World->GetTimerManager().ClearTimer(ClearTimer);
   }
@@ -23,8 +300,8 @@ void URfsnDialogueWidget::TickComponent(
     FActorComponentTickFunction *ThisTickFunction) {
   Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
 
-  if (bIsShowingDialogue && bUseTypewriter) {
-    UpdateTypewriter(DeltaTime);
+  if (Stream.Reveal(DeltaTime) > 0) {
+    OnStreamChanged();
   }
 }
 
@@ -33,54 +310,48 @@ void URfsnDialogueWidget::BindToRfsnClient(
   if (RfsnClient) {
     RfsnClient->OnSentenceReceived.AddDynamic(
         this, &URfsnDialogueWidget::OnRfsnSentenceReceived);
+    RfsnClient->OnDialogueComplete.AddDynamic(
+        this, &URfsnDialogueWidget::OnRfsnDialogueComplete);
     CurrentNpcName = RfsnClient->NpcName;
+    BoundClient = RfsnClient;
   }
 }
 
 void URfsnDialogueWidget::OnRfsnSentenceReceived(
     const FRfsnSentence &Sentence) {
-  if (!Sentence.Sentence.IsEmpty()) {
-    // Queue the sentence
-    SentenceQueue.Add(Sentence.Sentence);
-
-    // Start processing if not already
-    if (!bIsProcessingQueue) {
-      ProcessNextSentence();
+  // Text from a newer turn interrupts whatever is still on screen or queued
+  const URfsnNpcClientComponent *Client = BoundClient.Get();
+  const double StartTime = Client ? Client->GetDialogueStartTime() : 0.0;
+  if (StartTime != TurnStartTime) {
+    if (Stream.IsShowing()) {
+      ClearDialogue();
     }
+    TurnStartTime = StartTime;
+    bAwaitingFirstCharacter = Client != nullptr;
+  }
+
+  if (!Sentence.Sentence.IsEmpty() || Sentence.bIsFinal) {
+    ApplySettings();
+    Stream.Append(Sentence.Sentence, Sentence.bIsFinal);
+    OnStreamChanged();
   }
 }
 
+void URfsnDialogueWidget::OnRfsnDialogueComplete() {
+  Stream.CloseOpenLine();
+  OnStreamChanged();
+}
+
 void URfsnDialogueWidget::DisplaySentence(const FString &NpcName,
                                           const FString &Sentence) {
   CurrentNpcName = NpcName;
-  CurrentFullText = Sentence;
-
-  if (bUseTypewriter) {
-    CurrentDisplayText = TEXT("");
-    TypewriterProgress = 0.0f;
-    SetComponentTickEnabled(true);
-  } else {
-    CurrentDisplayText = Sentence;
-  }
-
-  bIsShowingDialogue = true;
-  OnDialogueDisplayed.Broadcast(NpcName, Sentence);
-
-  UE_LOG(LogTemp, Log, TEXT("[Dialogue] %s: %s"), *NpcName, *Sentence);
-
-  // Set clear timer
-  if (UWorld *World = GetWorld()) {
-    World->GetTimerManager().ClearTimer(ClearTimer);
-    World->GetTimerManager().SetTimer(ClearTimer, this,
-                                      &URfsnDialogueWidget::OnSentenceTimeout,
-                                      SentenceDisplayDuration, false);
-  }
+  ApplySettings();
+  Stream.Show(Sentence);
+  OnStreamChanged();
 }
 
 void URfsnDialogueWidget::ClearDialogue() {
-  CurrentDisplayText = TEXT("");
-  CurrentFullText = TEXT("");
-  bIsShowingDialogue = false;
+  Stream.Reset();
   SetComponentTickEnabled(false);
 
   if (UWorld *World = GetWorld()) {
@@ -88,35 +359,53 @@ void URfsnDialogueWidget::ClearDialogue() {
   }
 }
 
-void URfsnDialogueWidget::ProcessNextSentence() {
-  if (SentenceQueue.Num() > 0) {
-    bIsProcessingQueue = true;
-    FString NextSentence = SentenceQueue[0];
-    SentenceQueue.RemoveAt(0);
-    DisplaySentence(CurrentNpcName, NextSentence);
-  } else {
-    bIsProcessingQueue = false;
+TArray<FString> URfsnDialogueWidget::GetCurrentLines() const {
+  TArray<FString> Lines;
+  if (Stream.IsShowing()) {
+    Stream.Layout.GetLines(Stream.GetDisplayText(), Lines);
   }
+  return Lines;
 }
 
-void URfsnDialogueWidget::UpdateTypewriter(float DeltaTime) {
-  if (CurrentDisplayText.Len() >= CurrentFullText.Len()) {
-    // Typewriter complete
-    SetComponentTickEnabled(false);
-    return;
+void URfsnDialogueWidget::ApplySettings() {
+  Stream.RevealSpeed = bUseTypewriter ? TypewriterSpeed : 0.0f;
+  Stream.Layout.MaxWidth = MaxTextWidth;
+}
+
+void URfsnDialogueWidget::OnStreamChanged() {
+  if (bAwaitingFirstCharacter && !Stream.GetDisplayText().IsEmpty()) {
+    bAwaitingFirstCharacter = false;
+    UGameInstance *GI = GetWorld() ? GetWorld()->GetGameInstance() : nullptr;
+    URfsnMetrics *Metrics = GI ? GI->GetSubsystem<URfsnMetrics>() : nullptr;
+    if (Metrics) {
+      Metrics->RecordTimeToFirstCharacter(static_cast<float>(
+          (FPlatformTime::Seconds() - TurnStartTime) * 1000.0));
+    }
   }
 
-  TypewriterProgress += DeltaTime * TypewriterSpeed;
-  int32 CharsToShow = FMath::FloorToInt(TypewriterProgress);
-  CharsToShow = FMath::Min(CharsToShow, CurrentFullText.Len());
+  // The clear timer starts once the whole line is known
+  if (Stream.IsShowing() && !Stream.IsCurrentOpen() &&
+      AnnouncedLine != Stream.GetLinesShown()) {
+    AnnouncedLine = Stream.GetLinesShown();
+    OnDialogueDisplayed.Broadcast(CurrentNpcName, Stream.GetFullText());
+
+    UE_LOG(LogTemp, Log, TEXT("[Dialogue] %s: %s"), *CurrentNpcName,
+           *Stream.GetFullText());
+
+    if (UWorld *World = GetWorld()) {
+      World->GetTimerManager().SetTimer(ClearTimer, this,
+                                        &URfsnDialogueWidget::OnSentenceTimeout,
+                                        SentenceDisplayDuration, false);
+    }
+  }
 
-  CurrentDisplayText = CurrentFullText.Left(CharsToShow);
+  SetComponentTickEnabled(Stream.IsShowing() && !Stream.IsFullyRevealed());
 }
 
 void URfsnDialogueWidget::OnSentenceTimeout() {
   // Process next sentence or clear
-  if (SentenceQueue.Num() > 0) {
-    ProcessNextSentence();
+  if (Stream.ShowNext()) {
+    OnStreamChanged();
   } else {
     ClearDialogue();
   }
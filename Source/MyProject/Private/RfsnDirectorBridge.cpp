@@ -7,6 +7,7 @@
 #include "HttpModule.h"
 #include "Interfaces/IHttpResponse.h"
 #include "IslandDirectorSubsystem.h"
+#include "Policies/CondensedJsonPrintPolicy.h"
 #include "Serialization/JsonReader.h"
 #include "Serialization/JsonSerializer.h"
 #include "TimerManager.h"
@@ -34,29 +35,35 @@ void URfsnDirectorBridge::EndPlay(const EEndPlayReason::Type EndPlayReason) {
 }
 
 void URfsnDirectorBridge::StartPolling() {
-  if (UWorld *World = GetWorld()) {
-    World->GetTimerManager().SetTimer(
-        PollTimer, this, &URfsnDirectorBridge::OnPollTick, PollInterval,
-        true // Loop
-    );
+  bActive = true;
+  if (bUsePushChannel) {
+    OpenChannel();
+  } else {
+    StartTimerPolling();
   }
 }
 
 void URfsnDirectorBridge::StopPolling() {
+  bActive = false;
+  CloseChannel();
   if (UWorld *World = GetWorld()) {
     World->GetTimerManager().ClearTimer(PollTimer);
+    World->GetTimerManager().ClearTimer(ReconnectTimer);
   }
 }
 
-void URfsnDirectorBridge::OnPollTick() { RequestDirectorCommand(); }
-
-void URfsnDirectorBridge::RequestDirectorCommand() {
-  if (!DirectorSubsystem) {
-    UE_LOG(LogTemp, Warning, TEXT("[RFSN] Director subsystem not available"));
-    return;
+void URfsnDirectorBridge::StartTimerPolling() {
+  if (UWorld *World = GetWorld()) {
+    World->GetTimerManager().SetTimer(
+        PollTimer, this, &URfsnDirectorBridge::OnPollTick, PollInterval,
+        true // Loop
+    );
   }
+}
 
-  // Build game state payload for RFSN
+void URfsnDirectorBridge::OnPollTick() { RequestDirectorCommand(); }
+
+TSharedPtr<FJsonObject> URfsnDirectorBridge::BuildGameState() const {
   TSharedPtr<FJsonObject> GameState = MakeShareable(new FJsonObject());
   GameState->SetNumberField(TEXT("alert_level"),
                             DirectorSubsystem->GetAlertLevel());
@@ -84,25 +91,52 @@ void URfsnDirectorBridge::RequestDirectorCommand() {
     break;
   }
   GameState->SetStringField(TEXT("intensity_state"), IntensityState);
+  return GameState;
+}
+
+TSharedRef<IHttpRequest, ESPMode::ThreadSafe>
+URfsnDirectorBridge::CreateRequest(const FString &Url, const FString &Verb,
+                                   const TSharedPtr<FJsonObject> &Body) {
+  TSharedRef<IHttpRequest, ESPMode::ThreadSafe> Request =
+      FHttpModule::Get().CreateRequest();
+  Request->SetURL(Url);
+  Request->SetVerb(Verb);
+  BytesSent += Url.Len();
+
+  if (Body.IsValid()) {
+    FString JsonString;
+    TSharedRef<TJsonWriter<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>> Writer =
+        TJsonWriterFactory<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>::Create(
+            &JsonString);
+    FJsonSerializer::Serialize(Body.ToSharedRef(), Writer);
+
+    Request->SetHeader(TEXT("Content-Type"), TEXT("application/json"));
+    Request->SetContentAsString(JsonString);
+    BytesSent += JsonString.Len();
+  }
+  return Request;
+}
 
-  FString JsonString;
-  TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&JsonString);
-  FJsonSerializer::Serialize(GameState.ToSharedRef(), Writer);
+void URfsnDirectorBridge::RequestDirectorCommand() {
+  if (!DirectorSubsystem) {
+    UE_LOG(LogTemp, Warning, TEXT("[RFSN] Director subsystem not available"));
+    return;
+  }
+
+  // Build game state payload for RFSN
+  const TSharedPtr<FJsonObject> GameState = BuildGameState();
 
   // Send to RFSN
   TSharedRef<IHttpRequest, ESPMode::ThreadSafe> Request =
-      FHttpModule::Get().CreateRequest();
-  Request->SetURL(DirectorUrl);
-  Request->SetVerb(TEXT("POST"));
-  Request->SetHeader(TEXT("Content-Type"), TEXT("application/json"));
-  Request->SetContentAsString(JsonString);
+      CreateRequest(DirectorUrl, TEXT("POST"), GameState);
   Request->OnProcessRequestComplete().BindUObject(
       this, &URfsnDirectorBridge::OnDirectorResponse);
   Request->ProcessRequest();
 
   UE_LOG(LogTemp, Verbose,
          TEXT("[RFSN] Sent director state: alert=%.1f, intensity=%s"),
-         DirectorSubsystem->GetAlertLevel(), *IntensityState);
+         DirectorSubsystem->GetAlertLevel(),
+         *GameState->GetStringField(TEXT("intensity_state")));
 }
 
 void URfsnDirectorBridge::OnDirectorResponse(FHttpRequestPtr Request,
@@ -127,17 +161,21 @@ void URfsnDirectorBridge::OnDirectorResponse(FHttpRequestPtr Request,
     return;
   }
 
+  ApplyDirectorCommand(*JsonObject);
+}
+
+void URfsnDirectorBridge::ApplyDirectorCommand(const FJsonObject &Command) {
   // Process director commands
-  FString Command;
-  if (JsonObject->TryGetStringField(TEXT("command"), Command)) {
-    if (Command == TEXT("spawn_horde") && DirectorSubsystem) {
+  FString CommandName;
+  if (Command.TryGetStringField(TEXT("command"), CommandName)) {
+    if (CommandName == TEXT("spawn_horde") && DirectorSubsystem) {
       DirectorSubsystem->AddAlert(25.0f);
       UE_LOG(LogTemp, Log,
              TEXT("[RFSN] Director command: spawn_horde -> adding alert"));
-    } else if (Command == TEXT("respite") && DirectorSubsystem) {
+    } else if (CommandName == TEXT("respite") && DirectorSubsystem) {
       // Let alert decay naturally - could modify decay rate
       UE_LOG(LogTemp, Log, TEXT("[RFSN] Director command: respite"));
-    } else if (Command == TEXT("escalate") && DirectorSubsystem) {
+    } else if (CommandName == TEXT("escalate") && DirectorSubsystem) {
       DirectorSubsystem->AddAlert(15.0f);
       UE_LOG(LogTemp, Log, TEXT("[RFSN] Director command: escalate"));
     }
@@ -145,10 +183,246 @@ void URfsnDirectorBridge::OnDirectorResponse(FHttpRequestPtr Request,
 
   // Process alert modification
   double AlertMod = 0.0;
-  if (JsonObject->TryGetNumberField(TEXT("alert_modifier"), AlertMod) &&
+  if (Command.TryGetNumberField(TEXT("alert_modifier"), AlertMod) &&
       DirectorSubsystem) {
     DirectorSubsystem->AddAlert(static_cast<float>(AlertMod));
   }
+
+  if (!CommandName.IsEmpty()) {
+    OnDirectorCommand.Broadcast(CommandName);
+  }
+}
+
+// ─────────────────────────────────────────────────────────────
+// Push channel
+// ─────────────────────────────────────────────────────────────
+
+void URfsnDirectorBridge::OpenChannel() {
+  if (!bActive) {
+    return;
+  }
+
+  if (!DirectorSubsystem) {
+    UE_LOG(LogTemp, Warning, TEXT("[RFSN] Director subsystem not available"));
+    return;
+  }
+
+  // The server starts from the full state; everything after is a delta
+  SentState = BuildGameState();
+
+  TSharedRef<IHttpRequest, ESPMode::ThreadSafe> Request =
+      CreateRequest(ChannelUrl + TEXT("/open"), TEXT("POST"), SentState);
+  Request->OnProcessRequestComplete().BindUObject(
+      this, &URfsnDirectorBridge::OnChannelOpened);
+  Request->ProcessRequest();
+}
+
+void URfsnDirectorBridge::OnChannelOpened(FHttpRequestPtr Request,
+                                          FHttpResponsePtr Response,
+                                          bool bSuccess) {
+  if (!bActive || bChannelOpen) {
+    return;
+  }
+
+  TSharedPtr<FJsonObject> JsonObject;
+  if (bSuccess && Response.IsValid() && Response->GetResponseCode() == 200) {
+    TSharedRef<TJsonReader<>> Reader =
+        TJsonReaderFactory<>::Create(Response->GetContentAsString());
+    FJsonSerializer::Deserialize(Reader, JsonObject);
+  }
+
+  if (!JsonObject.IsValid() ||
+      !JsonObject->TryGetStringField(TEXT("session"), ChannelSession)) {
+    OnChannelDropped();
+    return;
+  }
+
+  bChannelOpen = true;
+  LastCommandId = 0;
+
+  if (UWorld *World = GetWorld()) {
+    World->GetTimerManager().ClearTimer(PollTimer);
+    World->GetTimerManager().ClearTimer(ReconnectTimer);
+    World->GetTimerManager().SetTimer(StateTimer, this,
+                                      &URfsnDirectorBridge::SendStateDelta,
+                                      StateCheckInterval, true);
+  }
+
+  UE_LOG(LogTemp, Log, TEXT("[RFSN] Director channel open (session %s)"),
+         *ChannelSession);
+  RequestCommands();
+}
+
+void URfsnDirectorBridge::SendStateDelta() {
+  if (!bChannelOpen || !DirectorSubsystem || !SentState.IsValid()) {
+    return;
+  }
+
+  const TSharedPtr<FJsonObject> State = BuildGameState();
+  TSharedRef<FJsonObject> Changes = MakeShared<FJsonObject>();
+
+  // Alert drifts every frame, so only steps past the threshold are news
+  const bool bIntensityChanged =
+      State->GetStringField(TEXT("intensity_state")) !=
+      SentState->GetStringField(TEXT("intensity_state"));
+  const double AlertDelta = State->GetNumberField(TEXT("alert_level")) -
+                            SentState->GetNumberField(TEXT("alert_level"));
+
+  if (bIntensityChanged || FMath::Abs(AlertDelta) >= AlertDeltaThreshold) {
+    Changes->SetField(TEXT("alert_level"),
+                      State->TryGetField(TEXT("alert_level")));
+    Changes->SetField(TEXT("intensity"), State->TryGetField(TEXT("intensity")));
+  }
+  if (bIntensityChanged) {
+    Changes->SetField(TEXT("intensity_state"),
+                      State->TryGetField(TEXT("intensity_state")));
+  }
+  for (const TCHAR *Flag : {TEXT("can_use_tower"), TEXT("can_transmit")}) {
+    if (State->GetBoolField(Flag) != SentState->GetBoolField(Flag)) {
+      Changes->SetField(Flag, State->TryGetField(Flag));
+    }
+  }
+
+  if (Changes->Values.Num() == 0) {
+    return;
+  }
+
+  for (const TPair<FString, TSharedPtr<FJsonValue>> &Change :
+       Changes->Values) {
+    SentState->SetField(Change.Key, Change.Value);
+  }
+
+  TSharedPtr<FJsonObject> Body = MakeShared<FJsonObject>();
+  Body->SetStringField(TEXT("session"), ChannelSession);
+  Body->SetObjectField(TEXT("changes"), Changes);
+
+  TSharedRef<IHttpRequest, ESPMode::ThreadSafe> Request =
+      CreateRequest(ChannelUrl + TEXT("/state"), TEXT("POST"), Body);
+  Request->OnProcessRequestComplete().BindUObject(
+      this, &URfsnDirectorBridge::OnStateSent);
+  Request->ProcessRequest();
+}
+
+void URfsnDirectorBridge::OnStateSent(FHttpRequestPtr Request,
+                                      FHttpResponsePtr Response,
+                                      bool bSuccess) {
+  if (!bChannelOpen) {
+    return;
+  }
+
+  if (bSuccess && Response.IsValid() && Response->GetResponseCode() == 404) {
+    // Server restarted or expired the session: start over with full state
+    CloseChannel();
+    OpenChannel();
+  } else if (!bSuccess || !Response.IsValid() ||
+             Response->GetResponseCode() != 200) {
+    OnChannelDropped();
+  }
+}
+
+void URfsnDirectorBridge::RequestCommands() {
+  const FString Url = FString::Printf(
+      TEXT("%s/commands?session=%s&after=%d&timeout=%d"), *ChannelUrl,
+      *ChannelSession, LastCommandId, FMath::RoundToInt(LongPollTimeout));
+
+  TSharedRef<IHttpRequest, ESPMode::ThreadSafe> Request =
+      CreateRequest(Url, TEXT("GET"), nullptr);
+  // The server answers by LongPollTimeout at the latest; anything longer is a
+  // dead connection
+  Request->SetTimeout(LongPollTimeout + 5.0f);
+  Request->OnProcessRequestComplete().BindUObject(
+      this, &URfsnDirectorBridge::OnCommandsReceived);
+  CommandRequest = Request;
+  Request->ProcessRequest();
+}
+
+void URfsnDirectorBridge::OnCommandsReceived(FHttpRequestPtr Request,
+                                             FHttpResponsePtr Response,
+                                             bool bSuccess) {
+  // Cancelled or replaced
+  if (!bChannelOpen || Request != CommandRequest) {
+    return;
+  }
+  CommandRequest.Reset();
+
+  if (bSuccess && Response.IsValid() && Response->GetResponseCode() == 404) {
+    CloseChannel();
+    OpenChannel();
+    return;
+  }
+
+  TSharedPtr<FJsonObject> JsonObject;
+  if (bSuccess && Response.IsValid() && Response->GetResponseCode() == 200) {
+    TSharedRef<TJsonReader<>> Reader =
+        TJsonReaderFactory<>::Create(Response->GetContentAsString());
+    FJsonSerializer::Deserialize(Reader, JsonObject);
+  }
+
+  const TArray<TSharedPtr<FJsonValue>> *Commands = nullptr;
+  if (!JsonObject.IsValid() ||
+      !JsonObject->TryGetArrayField(TEXT("commands"), Commands)) {
+    OnChannelDropped();
+    return;
+  }
+
+  for (const TSharedPtr<FJsonValue> &Value : *Commands) {
+    const TSharedPtr<FJsonObject> *Command = nullptr;
+    if (!Value.IsValid() || !Value->TryGetObject(Command)) {
+      continue;
+    }
+
+    int32 Id = 0;
+    if ((*Command)->TryGetNumberField(TEXT("id"), Id)) {
+      LastCommandId = FMath::Max(LastCommandId, Id);
+    }
+    ApplyDirectorCommand(**Command);
+  }
+
+  // A command may have stopped the bridge
+  if (bChannelOpen) {
+    RequestCommands();
+  }
+}
+
+void URfsnDirectorBridge::CloseChannel() {
+  bChannelOpen = false;
+  ChannelSession.Empty();
+  SentState.Reset();
+
+  if (UWorld *World = GetWorld()) {
+    World->GetTimerManager().ClearTimer(StateTimer);
+  }
+
+  // Reset first so the cancelled completion is ignored
+  if (CommandRequest.IsValid()) {
+    TSharedPtr<IHttpRequest, ESPMode::ThreadSafe> Pending = CommandRequest;
+    CommandRequest.Reset();
+    Pending->CancelRequest();
+  }
+}
+
+void URfsnDirectorBridge::OnChannelDropped() {
+  if (!bActive) {
+    return;
+  }
+
+  if (bChannelOpen) {
+    UE_LOG(LogTemp, Warning,
+           TEXT("[RFSN] Director channel dropped, falling back to polling"));
+  }
+  CloseChannel();
+
+  UWorld *World = GetWorld();
+  if (!World) {
+    return;
+  }
+
+  if (!World->GetTimerManager().IsTimerActive(PollTimer)) {
+    StartTimerPolling();
+  }
+  World->GetTimerManager().SetTimer(ReconnectTimer, this,
+                                    &URfsnDirectorBridge::OpenChannel,
+                                    ReconnectInterval, false);
 }
 
 void URfsnDirectorBridge::ApplyNpcActionToDirector(ERfsnNpcAction Action) {
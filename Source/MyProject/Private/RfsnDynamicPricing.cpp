@@ -13,40 +13,82 @@ URfsnDynamicPricing::URfsnDynamicPricing()
 void URfsnDynamicPricing::BeginPlay()
 {
 	Super::BeginPlay();
+	RefreshInventory();
 	RFSN_LOG(TEXT("DynamicPricing initialized for %s with %d items"), *GetOwner()->GetName(), Inventory.Num());
 }
 
 float URfsnDynamicPricing::GetPrice(const FString& ItemId) const
 {
-	const FRfsnItemPrice* Item = FindItem(ItemId);
-	if (!Item)
+	const int32 Index = FindItemIndex(ItemId);
+	if (Index == INDEX_NONE)
 	{
 		return 0.0f;
 	}
 
-	float FinalPrice = Item->BasePrice;
+	return CalculatePrice(Index, GetReputationModifier());
+}
+
+TArray<float> URfsnDynamicPricing::GetAllPrices() const
+{
+	if (IndexedCount != Inventory.Num())
+	{
+		RebuildInventoryIndex();
+	}
+
+	const float ReputationModifier = GetReputationModifier();
+
+	TArray<float> Prices;
+	Prices.SetNumUninitialized(Inventory.Num());
+	for (int32 i = 0; i < Inventory.Num(); i++)
+	{
+		Prices[i] = CalculatePrice(i, ReputationModifier);
+	}
+	return Prices;
+}
+
+float URfsnDynamicPricing::CalculatePrice(int32 Index, float ReputationModifier) const
+{
+	const FCachedPrice& Cached = GetCachedPrice(Index);
+
+	float FinalPrice = Inventory[Index].BasePrice;
 
 	// Apply reputation modifier
-	FinalPrice *= GetReputationModifier();
+	FinalPrice *= ReputationModifier;
 
 	// Apply stock modifier
-	FinalPrice *= GetStockModifier(ItemId);
+	FinalPrice *= Cached.StockModifier;
 
 	// Apply temporary modifiers
-	FinalPrice *= CalculateModifierMultiplier(ItemId, Item->Category);
+	FinalPrice *= Cached.ModifierMultiplier;
 
 	return FMath::RoundToFloat(FinalPrice);
 }
 
+const URfsnDynamicPricing::FCachedPrice& URfsnDynamicPricing::GetCachedPrice(int32 Index) const
+{
+	const FRfsnItemPrice& Item = Inventory[Index];
+	FCachedPrice& Cached = PriceCache[Index];
+	if (Cached.ModifierVersion != ModifierVersion || Cached.Stock != Item.CurrentStock ||
+	    Cached.BasePrice != Item.BasePrice)
+	{
+		Cached.ModifierVersion = ModifierVersion;
+		Cached.Stock = Item.CurrentStock;
+		Cached.BasePrice = Item.BasePrice;
+		Cached.StockModifier = CalculateStockModifier(Item);
+		Cached.ModifierMultiplier = CalculateModifierMultiplier(ItemNames[Index], ItemCategories[Index]);
+	}
+	return Cached;
+}
+
 float URfsnDynamicPricing::GetBuybackPrice(const FString& ItemId) const
 {
-	const FRfsnItemPrice* Item = FindItem(ItemId);
-	if (!Item)
+	const int32 Index = FindItemIndex(ItemId);
+	if (Index == INDEX_NONE)
 	{
 		return 0.0f;
 	}
 
-	float BaseValue = Item->BasePrice * BuybackPercentage;
+	float BaseValue = Inventory[Index].BasePrice * BuybackPercentage;
 
 	// Better prices with good reputation
 	float RepMod = GetReputationModifier();
@@ -62,7 +104,7 @@ float URfsnDynamicPricing::GetBuybackPrice(const FString& ItemId) const
 	}
 
 	// Low stock = merchant pays more
-	float StockMod = GetStockModifier(ItemId);
+	float StockMod = GetCachedPrice(Index).StockModifier;
 	if (StockMod > 1.0f)
 	{
 		BaseValue *= FMath::Sqrt(StockMod); // Partial benefit
@@ -109,24 +151,24 @@ float URfsnDynamicPricing::GetReputationModifier() const
 
 float URfsnDynamicPricing::GetStockModifier(const FString& ItemId) const
 {
-	const FRfsnItemPrice* Item = FindItem(ItemId);
-	if (!Item)
-	{
-		return 1.0f;
-	}
+	const int32 Index = FindItemIndex(ItemId);
+	return Index != INDEX_NONE ? GetCachedPrice(Index).StockModifier : 1.0f;
+}
 
-	if (Item->CurrentStock <= Item->LowStockThreshold && Item->CurrentStock > 0)
+float URfsnDynamicPricing::CalculateStockModifier(const FRfsnItemPrice& Item) const
+{
+	if (Item.CurrentStock <= Item.LowStockThreshold && Item.CurrentStock > 0)
 	{
 		// Low stock - increase price
-		float Scarcity = 1.0f - (float)Item->CurrentStock / (float)Item->LowStockThreshold;
+		float Scarcity = 1.0f - (float)Item.CurrentStock / (float)Item.LowStockThreshold;
 		return 1.0f + Scarcity * (LowStockPriceIncrease - 1.0f);
 	}
-	else if (Item->CurrentStock == 0)
+	else if (Item.CurrentStock == 0)
 	{
 		// Out of stock
 		return LowStockPriceIncrease * 1.5f;
 	}
-	else if (Item->CurrentStock > Item->MaxStock * 0.8f)
+	else if (Item.CurrentStock > Item.MaxStock * 0.8f)
 	{
 		// Overstocked - slight discount
 		return 0.9f;
@@ -137,17 +179,18 @@ float URfsnDynamicPricing::GetStockModifier(const FString& ItemId) const
 
 float URfsnDynamicPricing::BuyItem(const FString& ItemId, int32 Quantity)
 {
-	FRfsnItemPrice* Item = FindItem(ItemId);
-	if (!Item || Item->CurrentStock < Quantity)
+	const int32 Index = FindItemIndex(ItemId);
+	if (Index == INDEX_NONE || Inventory[Index].CurrentStock < Quantity)
 	{
 		return 0.0f;
 	}
 
-	float TotalPrice = GetPrice(ItemId) * Quantity;
-	Item->CurrentStock -= Quantity;
+	const float ReputationModifier = GetReputationModifier();
+	float TotalPrice = CalculatePrice(Index, ReputationModifier) * Quantity;
+	SetStock(Index, Inventory[Index].CurrentStock - Quantity);
 
-	OnStockChanged.Broadcast(ItemId, Item->CurrentStock);
-	OnPriceChanged.Broadcast(ItemId, GetPrice(ItemId));
+	OnStockChanged.Broadcast(ItemId, Inventory[Index].CurrentStock);
+	OnPriceChanged.Broadcast(ItemId, CalculatePrice(Index, ReputationModifier));
 
 	RFSN_LOG(TEXT("Bought %d x %s for %.0f"), Quantity, *ItemId, TotalPrice);
 	return TotalPrice;
@@ -155,14 +198,15 @@ float URfsnDynamicPricing::BuyItem(const FString& ItemId, int32 Quantity)
 
 float URfsnDynamicPricing::SellItem(const FString& ItemId, int32 Quantity)
 {
-	FRfsnItemPrice* Item = FindItem(ItemId);
+	const int32 Index = FindItemIndex(ItemId);
 
 	float Value = GetBuybackPrice(ItemId) * Quantity;
 
-	if (Item)
+	if (Index != INDEX_NONE)
 	{
-		Item->CurrentStock = FMath::Min(Item->CurrentStock + Quantity, Item->MaxStock * 2);
-		OnStockChanged.Broadcast(ItemId, Item->CurrentStock);
+		const FRfsnItemPrice& Item = Inventory[Index];
+		SetStock(Index, FMath::Min(Item.CurrentStock + Quantity, Item.MaxStock * 2));
+		OnStockChanged.Broadcast(ItemId, Item.CurrentStock);
 	}
 
 	RFSN_LOG(TEXT("Sold %d x %s for %.0f"), Quantity, *ItemId, Value);
@@ -181,35 +225,61 @@ void URfsnDynamicPricing::AddPriceModifier(const FString& Name, float Multiplier
 	Modifier.AffectedCategory = Category;
 	Modifier.AffectedItemId = ItemId;
 	Modifier.Duration = DurationHours;
-	Modifier.TimeRemaining = DurationHours;
+
+	if (DurationHours > 0.0f)
+	{
+		Modifier.ExpiresAt = ModifierClock + DurationHours;
+		ModifierExpiries.HeapPush({Modifier.ExpiresAt, Name});
+	}
 
 	ActiveModifiers.Add(Modifier);
+	RebuildModifierIndex();
 	RFSN_LOG(TEXT("Added price modifier: %s (x%.2f)"), *Name, Multiplier);
 }
 
 void URfsnDynamicPricing::RemovePriceModifier(const FString& Name)
 {
-	ActiveModifiers.RemoveAll([&Name](const FRfsnPriceModifier& Mod) { return Mod.Name == Name; });
+	// Queued expiries for removed modifiers are skipped when they come due
+	if (ActiveModifiers.RemoveAll([&Name](const FRfsnPriceModifier& Mod) { return Mod.Name == Name; }) > 0)
+	{
+		RebuildModifierIndex();
+	}
 }
 
 void URfsnDynamicPricing::RestockAll()
 {
-	for (FRfsnItemPrice& Item : Inventory)
+	if (IndexedCount != Inventory.Num())
+	{
+		RebuildInventoryIndex();
+	}
+
+	for (int32 i = 0; i < Inventory.Num(); i++)
 	{
-		Item.CurrentStock = Item.MaxStock;
-		OnStockChanged.Broadcast(Item.ItemId, Item.CurrentStock);
+		SetStock(i, Inventory[i].MaxStock);
+		OnStockChanged.Broadcast(Inventory[i].ItemId, Inventory[i].CurrentStock);
 	}
 	RFSN_LOG(TEXT("Restocked all items"));
 }
 
 TArray<FRfsnItemPrice> URfsnDynamicPricing::GetItemsInCategory(const FString& Category) const
 {
+	if (IndexedCount != Inventory.Num())
+	{
+		RebuildInventoryIndex();
+	}
+
 	TArray<FRfsnItemPrice> Result;
-	for (const FRfsnItemPrice& Item : Inventory)
+	const FName CategoryName(*Category, FNAME_Find);
+	if (CategoryName.IsNone())
+	{
+		return Result;
+	}
+
+	for (int32 i = 0; i < Inventory.Num(); i++)
 	{
-		if (Item.Category.Equals(Category, ESearchCase::IgnoreCase))
+		if (ItemCategories[i] == CategoryName)
 		{
-			Result.Add(Item);
+			Result.Add(Inventory[i]);
 		}
 	}
 	return Result;
@@ -250,13 +320,9 @@ FString URfsnDynamicPricing::GetPricingContext() const
 	}
 
 	// Check for low stock items
-	int32 LowStockCount = 0;
-	for (const FRfsnItemPrice& Item : Inventory)
+	if (IndexedCount != Inventory.Num())
 	{
-		if (Item.CurrentStock <= Item.LowStockThreshold)
-		{
-			LowStockCount++;
-		}
+		RebuildInventoryIndex();
 	}
 
 	if (LowStockCount > Inventory.Num() / 3)
@@ -265,17 +331,16 @@ FString URfsnDynamicPricing::GetPricingContext() const
 	}
 
 	// Check for active events
-	for (const FRfsnPriceModifier& Mod : ActiveModifiers)
+	if (ActiveModifiers.IsValidIndex(ContextModifier))
 	{
+		const FRfsnPriceModifier& Mod = ActiveModifiers[ContextModifier];
 		if (Mod.Multiplier > 1.1f)
 		{
 			Context += FString::Printf(TEXT("Due to %s, some prices are higher. "), *Mod.Name);
-			break;
 		}
-		if (Mod.Multiplier < 0.9f)
+		else
 		{
 			Context += FString::Printf(TEXT("Special deal: %s! "), *Mod.Name);
-			break;
 		}
 	}
 
@@ -284,56 +349,167 @@ FString URfsnDynamicPricing::GetPricingContext() const
 
 void URfsnDynamicPricing::TickModifiers(float GameHoursElapsed)
 {
-	for (int32 i = ActiveModifiers.Num() - 1; i >= 0; --i)
+	ModifierClock += GameHoursElapsed;
+
+	bool bExpired = false;
+	while (ModifierExpiries.Num() > 0 && ModifierExpiries.HeapTop().ExpiresAt <= ModifierClock)
 	{
-		FRfsnPriceModifier& Mod = ActiveModifiers[i];
-		if (Mod.Duration > 0)
+		FModifierExpiry Expiry;
+		ModifierExpiries.HeapPop(Expiry, EAllowShrinking::No);
+
+		// The modifier may have been removed or re-added with a new duration since this was queued
+		const int32 Index = ActiveModifiers.IndexOfByPredicate(
+		    [&Expiry](const FRfsnPriceModifier& Mod)
+		    { return Mod.Duration > 0.0f && Mod.ExpiresAt == Expiry.ExpiresAt && Mod.Name == Expiry.Name; });
+		if (Index != INDEX_NONE)
 		{
-			Mod.TimeRemaining -= GameHoursElapsed;
-			if (Mod.TimeRemaining <= 0)
-			{
-				RFSN_LOG(TEXT("Price modifier expired: %s"), *Mod.Name);
-				ActiveModifiers.RemoveAt(i);
-			}
+			RFSN_LOG(TEXT("Price modifier expired: %s"), *Expiry.Name);
+			ActiveModifiers.RemoveAt(Index);
+			bExpired = true;
 		}
 	}
+
+	if (bExpired)
+	{
+		RebuildModifierIndex();
+	}
 }
 
-FRfsnItemPrice* URfsnDynamicPricing::FindItem(const FString& ItemId)
+void URfsnDynamicPricing::RefreshInventory()
 {
-	return Inventory.FindByPredicate([&ItemId](const FRfsnItemPrice& Item)
-	                                 { return Item.ItemId.Equals(ItemId, ESearchCase::IgnoreCase); });
+	RebuildInventoryIndex();
 }
 
-const FRfsnItemPrice* URfsnDynamicPricing::FindItem(const FString& ItemId) const
+void URfsnDynamicPricing::RebuildInventoryIndex() const
 {
-	return Inventory.FindByPredicate([&ItemId](const FRfsnItemPrice& Item)
-	                                 { return Item.ItemId.Equals(ItemId, ESearchCase::IgnoreCase); });
+	const int32 NumItems = Inventory.Num();
+	ItemIndex.Reset();
+	ItemNames.SetNum(NumItems);
+	ItemCategories.SetNum(NumItems);
+	PriceCache.Reset();
+	PriceCache.SetNum(NumItems);
+	LowStockCount = 0;
+
+	for (int32 i = 0; i < NumItems; i++)
+	{
+		const FRfsnItemPrice& Item = Inventory[i];
+		ItemNames[i] = FName(*Item.ItemId);
+		ItemCategories[i] = FName(*Item.Category);
+
+		// First entry wins, as with the old linear search
+		if (!ItemIndex.Contains(ItemNames[i]))
+		{
+			ItemIndex.Add(ItemNames[i], i);
+		}
+
+		LowStockCount += Item.CurrentStock <= Item.LowStockThreshold ? 1 : 0;
+	}
+
+	IndexedCount = NumItems;
 }
 
-float URfsnDynamicPricing::CalculateModifierMultiplier(const FString& ItemId, const FString& Category) const
+void URfsnDynamicPricing::RebuildModifierIndex()
 {
-	float Multiplier = 1.0f;
+	GlobalModifier = 1.0f;
+	CategoryModifiers.Reset();
+	ItemModifiers.Reset();
+	DualModifiers.Reset();
+	ContextModifier = INDEX_NONE;
 
-	for (const FRfsnPriceModifier& Mod : ActiveModifiers)
+	for (int32 i = 0; i < ActiveModifiers.Num(); i++)
 	{
-		// Check if modifier applies
-		bool bApplies = false;
+		const FRfsnPriceModifier& Mod = ActiveModifiers[i];
+		const bool bItem = !Mod.AffectedItemId.IsEmpty();
+		const bool bCategory = !Mod.AffectedCategory.IsEmpty();
 
-		if (!Mod.AffectedItemId.IsEmpty() && Mod.AffectedItemId.Equals(ItemId, ESearchCase::IgnoreCase))
+		if (bItem && bCategory)
+		{
+			DualModifiers.Add({FName(*Mod.AffectedItemId), FName(*Mod.AffectedCategory), Mod.Multiplier});
+		}
+		else if (bItem)
+		{
+			ItemModifiers.FindOrAdd(FName(*Mod.AffectedItemId), 1.0f) *= Mod.Multiplier;
+		}
+		else if (bCategory)
 		{
-			bApplies = true;
+			CategoryModifiers.FindOrAdd(FName(*Mod.AffectedCategory), 1.0f) *= Mod.Multiplier;
 		}
-		else if (!Mod.AffectedCategory.IsEmpty() && Mod.AffectedCategory.Equals(Category, ESearchCase::IgnoreCase))
+		else
 		{
-			bApplies = true;
+			GlobalModifier *= Mod.Multiplier; // Applies to all
 		}
-		else if (Mod.AffectedItemId.IsEmpty() && Mod.AffectedCategory.IsEmpty())
+
+		if (ContextModifier == INDEX_NONE && (Mod.Multiplier > 1.1f || Mod.Multiplier < 0.9f))
 		{
-			bApplies = true; // Applies to all
+			ContextModifier = i;
 		}
+	}
+
+	// Invalidates every cached price
+	ModifierVersion++;
+}
+
+void URfsnDynamicPricing::SetStock(int32 Index, int32 NewStock)
+{
+	FRfsnItemPrice& Item = Inventory[Index];
+	LowStockCount -= Item.CurrentStock <= Item.LowStockThreshold ? 1 : 0;
+	Item.CurrentStock = NewStock;
+	LowStockCount += Item.CurrentStock <= Item.LowStockThreshold ? 1 : 0;
+}
+
+int32 URfsnDynamicPricing::FindItemIndex(const FString& ItemId) const
+{
+	if (IndexedCount != Inventory.Num())
+	{
+		RebuildInventoryIndex();
+	}
 
-		if (bApplies)
+	// An ID that was never interned can't be in the inventory
+	const FName ItemName(*ItemId, FNAME_Find);
+	if (ItemName.IsNone())
+	{
+		return INDEX_NONE;
+	}
+
+	const int32* Found = ItemIndex.Find(ItemName);
+	if (Found && !Inventory[*Found].ItemId.Equals(ItemId, ESearchCase::IgnoreCase))
+	{
+		// Inventory was edited in place since the last rebuild
+		RebuildInventoryIndex();
+		Found = ItemIndex.Find(ItemName);
+	}
+	return Found ? *Found : INDEX_NONE;
+}
+
+FRfsnItemPrice* URfsnDynamicPricing::FindItem(const FString& ItemId)
+{
+	const int32 Index = FindItemIndex(ItemId);
+	return Index != INDEX_NONE ? &Inventory[Index] : nullptr;
+}
+
+const FRfsnItemPrice* URfsnDynamicPricing::FindItem(const FString& ItemId) const
+{
+	const int32 Index = FindItemIndex(ItemId);
+	return Index != INDEX_NONE ? &Inventory[Index] : nullptr;
+}
+
+float URfsnDynamicPricing::CalculateModifierMultiplier(FName ItemId, FName Category) const
+{
+	float Multiplier = GlobalModifier;
+
+	if (const float* ItemMultiplier = ItemModifiers.Find(ItemId))
+	{
+		Multiplier *= *ItemMultiplier;
+	}
+
+	if (const float* CategoryMultiplier = CategoryModifiers.Find(Category))
+	{
+		Multiplier *= *CategoryMultiplier;
+	}
+
+	for (const FDualModifier& Mod : DualModifiers)
+	{
+		if (Mod.ItemId == ItemId || Mod.Category == Category)
 		{
 			Multiplier *= Mod.Multiplier;
 		}
@@ -6,6 +6,8 @@
 #include "HAL/FileManager.h"
 #include "Misc/Paths.h"
 #include "RfsnLogging.h"
+#include "RfsnTokenDecoder.h"
+#include "RfsnTrace.h"
 
 // ─────────────────────────────────────────────────────────────
 // FRfsnEmotionAxis Implementation
@@ -112,6 +114,8 @@ void URfsnEmotionBlend::BeginPlay()
 void URfsnEmotionBlend::TickComponent(float DeltaTime, ELevelTick TickType,
                                       FActorComponentTickFunction* ThisTickFunction)
 {
+	RFSN_TRACE_SCOPE(RfsnEmotion_Tick);
+
 	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
 	UpdateEmotionBlend(DeltaTime);
 }
@@ -141,6 +145,8 @@ void URfsnEmotionBlend::UpdateEmotionBlend(float DeltaTime)
 
 void URfsnEmotionBlend::UpdateFacialExpression()
 {
+	RFSN_TRACE_SCOPE(RfsnEmotion_UpdateFacialExpression);
+
 	// Convert VAD to facial expression weights
 	// Each expression maps to a region in VAD space
 
@@ -198,6 +204,8 @@ void URfsnEmotionBlend::ApplyStimulus(const FString& EmotionName, float Intensit
 
 void URfsnEmotionBlend::ApplyStimulusEnum(ERfsnCoreEmotion Emotion, float Intensity)
 {
+	RFSN_TRACE_SCOPE(RfsnEmotion_ApplyStimulus);
+
 	FRfsnEmotionAxis EmotionVAD = FRfsnEmotionAxis::FromCoreEmotion(Emotion);
 
 	// Scale by intensity and blend into target
@@ -354,6 +362,8 @@ void URfsnEmotionBlend::ResetToBaseline()
 
 TMap<FName, float> URfsnEmotionBlend::GetMorphTargetWeights() const
 {
+	RFSN_TRACE_SCOPE(RfsnEmotion_GetMorphTargetWeights);
+
 	TMap<FName, float> Weights;
 
 	// Standard morph target names (adjust to match your mesh)
@@ -421,52 +431,12 @@ ERfsnCoreEmotion URfsnEmotionBlend::CalculateDominantEmotion() const
 
 ERfsnCoreEmotion URfsnEmotionBlend::StringToEmotion(const FString& Name)
 {
-	FString Lower = Name.ToLower();
-
-	if (Lower == TEXT("joy") || Lower == TEXT("happy") || Lower == TEXT("happiness"))
-		return ERfsnCoreEmotion::Joy;
-	if (Lower == TEXT("trust") || Lower == TEXT("calm"))
-		return ERfsnCoreEmotion::Trust;
-	if (Lower == TEXT("fear") || Lower == TEXT("scared") || Lower == TEXT("afraid"))
-		return ERfsnCoreEmotion::Fear;
-	if (Lower == TEXT("surprise") || Lower == TEXT("surprised") || Lower == TEXT("shock"))
-		return ERfsnCoreEmotion::Surprise;
-	if (Lower == TEXT("sadness") || Lower == TEXT("sad") || Lower == TEXT("sorrow"))
-		return ERfsnCoreEmotion::Sadness;
-	if (Lower == TEXT("disgust") || Lower == TEXT("disgusted"))
-		return ERfsnCoreEmotion::Disgust;
-	if (Lower == TEXT("anger") || Lower == TEXT("angry") || Lower == TEXT("rage"))
-		return ERfsnCoreEmotion::Anger;
-	if (Lower == TEXT("anticipation") || Lower == TEXT("excited") || Lower == TEXT("eager"))
-		return ERfsnCoreEmotion::Anticipation;
-
-	return ERfsnCoreEmotion::Neutral;
+	return FRfsnTokenDecoder::DecodeEmotion(FStringView(Name));
 }
 
 FString URfsnEmotionBlend::EmotionToString(ERfsnCoreEmotion Emotion)
 {
-	switch (Emotion)
-	{
-	case ERfsnCoreEmotion::Joy:
-		return TEXT("Joy");
-	case ERfsnCoreEmotion::Trust:
-		return TEXT("Trust");
-	case ERfsnCoreEmotion::Fear:
-		return TEXT("Fear");
-	case ERfsnCoreEmotion::Surprise:
-		return TEXT("Surprise");
-	case ERfsnCoreEmotion::Sadness:
-		return TEXT("Sadness");
-	case ERfsnCoreEmotion::Disgust:
-		return TEXT("Disgust");
-	case ERfsnCoreEmotion::Anger:
-		return TEXT("Anger");
-	case ERfsnCoreEmotion::Anticipation:
-		return TEXT("Anticipation");
-	case ERfsnCoreEmotion::Neutral:
-	default:
-		return TEXT("Neutral");
-	}
+	return FRfsnTokenDecoder::GetEmotionName(Emotion);
 }
 
 // ─────────────────────────────────────────────────────────────
@@ -475,6 +445,8 @@ FString URfsnEmotionBlend::EmotionToString(ERfsnCoreEmotion Emotion)
 
 void URfsnEmotionBlend::ApplyContagionFromNearby()
 {
+	RFSN_TRACE_SCOPE(RfsnEmotion_ApplyContagion);
+
 	if (!bEnableContagion || ContagionSusceptibility <= 0.0f)
 	{
 		return;
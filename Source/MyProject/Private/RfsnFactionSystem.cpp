@@ -3,6 +3,42 @@
 #include "RfsnFactionSystem.h"
 #include "RfsnLogging.h"
 
+// ─────────────────────────────────────────────────────────────
+// FRfsnFactionRelationMatrix
+// ─────────────────────────────────────────────────────────────
+
+void FRfsnFactionRelationMatrix::Init(int32 InNum)
+{
+	NumFactions = InNum;
+	WordsPerRow = FMath::DivideAndRoundUp(InNum, 64);
+	Words.Reset();
+	Words.SetNumZeroed(NumFactions * WordsPerRow);
+}
+
+void FRfsnFactionRelationMatrix::Close()
+{
+	// Whenever A reaches K, A also reaches everything K reaches
+	for (int32 K = 0; K < NumFactions; K++)
+	{
+		const uint64* RowK = &Words[K * WordsPerRow];
+		for (int32 A = 0; A < NumFactions; A++)
+		{
+			if (Test(A, K))
+			{
+				uint64* RowA = &Words[A * WordsPerRow];
+				for (int32 Word = 0; Word < WordsPerRow; Word++)
+				{
+					RowA[Word] |= RowK[Word];
+				}
+			}
+		}
+	}
+}
+
+// ─────────────────────────────────────────────────────────────
+// URfsnFactionSystem
+// ─────────────────────────────────────────────────────────────
+
 void URfsnFactionSystem::Initialize(FSubsystemCollectionBase& Collection)
 {
 	Super::Initialize(Collection);
@@ -12,15 +48,74 @@ void URfsnFactionSystem::Initialize(FSubsystemCollectionBase& Collection)
 
 void URfsnFactionSystem::RegisterFaction(const FRfsnFaction& Faction)
 {
-	Factions.Add(Faction.FactionId, Faction);
+	// Re-registering an ID replaces the faction in place, keeping its index
+	int32 Index = GetFactionIndex(Faction.FactionId);
+	if (Index == INDEX_NONE)
+	{
+		Index = Factions.Add(Faction);
+		Reputations.Add(0.0f);
+		FactionIndices.Add(FName(*Faction.FactionId), Index);
+	}
+	else
+	{
+		Factions[Index] = Faction;
+	}
+	Reputations[Index] = Faction.Reputation;
+
+	RebuildRelations();
 	RFSN_LOG(TEXT("Registered faction: %s"), *Faction.DisplayName);
 }
 
+void URfsnFactionSystem::RebuildRelations()
+{
+	const int32 NumFactions = Factions.Num();
+	Allies.Init(NumFactions);
+	Enemies.Init(NumFactions);
+
+	// Relations to factions that aren't registered yet resolve once they are
+	for (int32 A = 0; A < NumFactions; A++)
+	{
+		for (const FString& Ally : Factions[A].Allies)
+		{
+			const int32 B = GetFactionIndex(Ally);
+			if (B != INDEX_NONE)
+			{
+				Allies.Set(A, B);
+			}
+		}
+		for (const FString& Enemy : Factions[A].Enemies)
+		{
+			const int32 B = GetFactionIndex(Enemy);
+			if (B != INDEX_NONE)
+			{
+				Enemies.Set(A, B);
+			}
+		}
+	}
+
+	AllyClosure = Allies;
+	AllyClosure.Close();
+}
+
+int32 URfsnFactionSystem::GetFactionIndex(const FString& FactionId) const
+{
+	// IDs that were never interned can't be registered
+	return GetFactionIndex(FName(*FactionId, FNAME_Find));
+}
+
+int32 URfsnFactionSystem::GetFactionIndex(FName FactionId) const
+{
+	const int32* Found = FactionId.IsNone() ? nullptr : FactionIndices.Find(FactionId);
+	return Found ? *Found : INDEX_NONE;
+}
+
 bool URfsnFactionSystem::GetFaction(const FString& FactionId, FRfsnFaction& OutFaction)
 {
-	if (FRfsnFaction* Found = Factions.Find(FactionId))
+	const int32 Index = GetFactionIndex(FactionId);
+	if (Index != INDEX_NONE)
 	{
-		OutFaction = *Found;
+		OutFaction = Factions[Index];
+		OutFaction.Reputation = Reputations[Index];
 		return true;
 	}
 	return false;
@@ -28,55 +123,50 @@ bool URfsnFactionSystem::GetFaction(const FString& FactionId, FRfsnFaction& OutF
 
 TArray<FRfsnFaction> URfsnFactionSystem::GetAllFactions() const
 {
-	TArray<FRfsnFaction> Result;
-	Factions.GenerateValueArray(Result);
+	TArray<FRfsnFaction> Result = Factions;
+	for (int32 i = 0; i < Result.Num(); i++)
+	{
+		Result[i].Reputation = Reputations[i];
+	}
 	return Result;
 }
 
 float URfsnFactionSystem::GetReputation(const FString& FactionId) const
 {
-	if (const FRfsnFaction* Found = Factions.Find(FactionId))
-	{
-		return Found->Reputation;
-	}
-	return 0.0f;
+	return GetReputationByIndex(GetFactionIndex(FactionId));
+}
+
+void URfsnFactionSystem::SetReputationByIndex(int32 Faction, float Value)
+{
+	Reputations[Faction] = FMath::Clamp(Value, -100.0f, 100.0f);
 }
 
 void URfsnFactionSystem::ModifyReputation(const FString& FactionId, float Delta)
 {
-	if (FRfsnFaction* Found = Factions.Find(FactionId))
+	const int32 Index = GetFactionIndex(FactionId);
+	if (Index != INDEX_NONE)
 	{
-		Found->Reputation = FMath::Clamp(Found->Reputation + Delta, -100.0f, 100.0f);
-		OnFactionReputationChanged.Broadcast(FactionId, Found->Reputation);
-		RFSN_LOG(TEXT("Faction %s reputation changed by %.1f to %.1f"), *FactionId, Delta, Found->Reputation);
+		SetReputationByIndex(Index, Reputations[Index] + Delta);
+		OnFactionReputationChanged.Broadcast(FactionId, Reputations[Index]);
+		RFSN_LOG(TEXT("Faction %s reputation changed by %.1f to %.1f"), *FactionId, Delta, Reputations[Index]);
 
 		// Propagate to allies/enemies
-		for (const FString& Ally : Found->Allies)
-		{
-			if (FRfsnFaction* AllyFaction = Factions.Find(Ally))
-			{
-				float AllyDelta = Delta * 0.5f; // Half effect on allies
-				AllyFaction->Reputation = FMath::Clamp(AllyFaction->Reputation + AllyDelta, -100.0f, 100.0f);
-			}
-		}
-
-		for (const FString& Enemy : Found->Enemies)
-		{
-			if (FRfsnFaction* EnemyFaction = Factions.Find(Enemy))
-			{
-				float EnemyDelta = -Delta * 0.5f; // Opposite effect on enemies
-				EnemyFaction->Reputation = FMath::Clamp(EnemyFaction->Reputation + EnemyDelta, -100.0f, 100.0f);
-			}
-		}
+		const float AllyDelta = Delta * 0.5f;   // Half effect on allies
+		const float EnemyDelta = -Delta * 0.5f; // Opposite effect on enemies
+		Allies.ForEachInRow(Index, [this, AllyDelta](int32 Ally)
+		                    { SetReputationByIndex(Ally, Reputations[Ally] + AllyDelta); });
+		Enemies.ForEachInRow(Index, [this, EnemyDelta](int32 Enemy)
+		                     { SetReputationByIndex(Enemy, Reputations[Enemy] + EnemyDelta); });
 	}
 }
 
 void URfsnFactionSystem::SetReputation(const FString& FactionId, float Value)
 {
-	if (FRfsnFaction* Found = Factions.Find(FactionId))
+	const int32 Index = GetFactionIndex(FactionId);
+	if (Index != INDEX_NONE)
 	{
-		Found->Reputation = FMath::Clamp(Value, -100.0f, 100.0f);
-		OnFactionReputationChanged.Broadcast(FactionId, Found->Reputation);
+		SetReputationByIndex(Index, Value);
+		OnFactionReputationChanged.Broadcast(FactionId, Reputations[Index]);
 	}
 }
 
@@ -97,20 +187,17 @@ FString URfsnFactionSystem::GetReputationTier(const FString& FactionId) const
 
 bool URfsnFactionSystem::AreFactionsAllied(const FString& FactionA, const FString& FactionB) const
 {
-	if (const FRfsnFaction* Found = Factions.Find(FactionA))
-	{
-		return Found->Allies.Contains(FactionB);
-	}
-	return false;
+	return AreAllied(GetFactionIndex(FactionA), GetFactionIndex(FactionB));
 }
 
 bool URfsnFactionSystem::AreFactionsHostile(const FString& FactionA, const FString& FactionB) const
 {
-	if (const FRfsnFaction* Found = Factions.Find(FactionA))
-	{
-		return Found->Enemies.Contains(FactionB);
-	}
-	return false;
+	return AreHostile(GetFactionIndex(FactionA), GetFactionIndex(FactionB));
+}
+
+bool URfsnFactionSystem::AreFactionsIndirectlyAllied(const FString& FactionA, const FString& FactionB) const
+{
+	return AreIndirectlyAllied(GetFactionIndex(FactionA), GetFactionIndex(FactionB));
 }
 
 float URfsnFactionSystem::GetNpcAffinityFromFaction(const FString& FactionId) const
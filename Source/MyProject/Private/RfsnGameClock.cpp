@@ -0,0 +1,276 @@
+// RFSN Game Clock Implementation
+
+#include "RfsnGameClock.h"
+#include "RfsnLogging.h"
+
+// ─────────────────────────────────────────────────────────────
+// FRfsnTimingWheel
+// ─────────────────────────────────────────────────────────────
+
+int32 FRfsnTimingWheel::Add(uint64 DueTick)
+{
+	FTimer Timer;
+	Timer.DueTick = DueTick;
+	const int32 Handle = Timers.Add(Timer);
+	Insert(Handle);
+	return Handle;
+}
+
+void FRfsnTimingWheel::Insert(int32 Handle)
+{
+	FTimer& Timer = Timers[Handle];
+	if (Timer.DueTick <= CurrentTick)
+	{
+		Timer.Level = INDEX_NONE;
+		Overdue.Add(Handle);
+		return;
+	}
+
+	const uint64 Delta = FMath::Min(Timer.DueTick - CurrentTick, MaxDelta);
+	Timer.DueTick = CurrentTick + Delta;
+
+	// Coarsest level needed: level L holds timers due within 64^(L+1) ticks
+	int32 Level = 0;
+	while (Level < NumLevels - 1 && Delta >= (uint64(1) << (SlotBits * (Level + 1))))
+	{
+		Level++;
+	}
+
+	Timer.Level = static_cast<int8>(Level);
+	Timer.Slot = static_cast<uint8>((Timer.DueTick >> (SlotBits * Level)) & (NumSlots - 1));
+	Slots[Level][Timer.Slot].Add(Handle);
+}
+
+void FRfsnTimingWheel::Remove(int32 Handle)
+{
+	if (!Timers.IsValidIndex(Handle))
+	{
+		return;
+	}
+
+	const FTimer& Timer = Timers[Handle];
+	if (Timer.Level == INDEX_NONE)
+	{
+		Overdue.RemoveSingleSwap(Handle, EAllowShrinking::No);
+	}
+	else
+	{
+		Slots[Timer.Level][Timer.Slot].RemoveSingleSwap(Handle, EAllowShrinking::No);
+	}
+	Timers.RemoveAt(Handle);
+}
+
+void FRfsnTimingWheel::Cascade(int32 Level)
+{
+	const int32 Slot = static_cast<int32>((CurrentTick >> (SlotBits * Level)) & (NumSlots - 1));
+
+	// Everything here is due within this level's span, so it re-inserts into a finer level
+	TArray<int32> Moving = MoveTemp(Slots[Level][Slot]);
+	Slots[Level][Slot].Reset();
+	for (const int32 Handle : Moving)
+	{
+		Insert(Handle);
+	}
+}
+
+void FRfsnTimingWheel::Advance(uint64 ToTick, TArray<int32>& OutExpired)
+{
+	auto ExpireOverdue = [this, &OutExpired]()
+	{
+		for (const int32 Handle : Overdue)
+		{
+			OutExpired.Add(Handle);
+			Timers.RemoveAt(Handle);
+		}
+		Overdue.Reset();
+	};
+
+	ExpireOverdue();
+
+	while (CurrentTick < ToTick)
+	{
+		if (Timers.Num() == 0)
+		{
+			CurrentTick = ToTick;
+			break;
+		}
+
+		CurrentTick++;
+
+		// Each time a level wraps, the next level's current slot comes due
+		for (int32 Level = 1; Level < NumLevels; Level++)
+		{
+			if ((CurrentTick & ((uint64(1) << (SlotBits * Level)) - 1)) != 0)
+			{
+				break;
+			}
+			Cascade(Level);
+		}
+
+		TArray<int32>& Slot = Slots[0][CurrentTick & (NumSlots - 1)];
+		for (const int32 Handle : Slot)
+		{
+			checkSlow(Timers[Handle].DueTick == CurrentTick);
+			OutExpired.Add(Handle);
+			Timers.RemoveAt(Handle);
+		}
+		Slot.Reset();
+
+		// Cascaded timers due exactly now
+		ExpireOverdue();
+	}
+}
+
+void FRfsnTimingWheel::Rewind(uint64 ToTick)
+{
+	for (int32 Level = 0; Level < NumLevels; Level++)
+	{
+		for (TArray<int32>& Slot : Slots[Level])
+		{
+			Slot.Reset();
+		}
+	}
+	Overdue.Reset();
+
+	CurrentTick = ToTick;
+	for (auto It = Timers.CreateIterator(); It; ++It)
+	{
+		Insert(It.GetIndex());
+	}
+}
+
+void FRfsnTimingWheel::Reset(uint64 Tick)
+{
+	Timers.Empty();
+	Rewind(Tick);
+}
+
+// ─────────────────────────────────────────────────────────────
+// URfsnGameClock
+// ─────────────────────────────────────────────────────────────
+
+void URfsnGameClock::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	GameMinutes = FMath::Clamp(StartHour, 0.0f, 24.0f) * 60.0;
+	Wheel.Reset(static_cast<uint64>(GameMinutes));
+	ScheduleDayTimer();
+}
+
+void URfsnGameClock::Deinitialize()
+{
+	Callbacks.Empty();
+	Wheel.Reset();
+	DayTimer = INDEX_NONE;
+	Super::Deinitialize();
+}
+
+TStatId URfsnGameClock::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(URfsnGameClock, STATGROUP_Tickables);
+}
+
+float URfsnGameClock::GetGameHour() const
+{
+	return static_cast<float>(FMath::Fmod(GameMinutes, static_cast<double>(MinutesPerDay)) / 60.0);
+}
+
+int32 URfsnGameClock::GetDay() const
+{
+	return FMath::FloorToInt32(GameMinutes / MinutesPerDay);
+}
+
+int32 URfsnGameClock::GetDayOfWeek() const
+{
+	return ((GetDay() + StartDayOfWeek) % DaysPerWeek + DaysPerWeek) % DaysPerWeek;
+}
+
+void URfsnGameClock::SetTimeScale(float InSecondsPerGameHour)
+{
+	SecondsPerGameHour = FMath::Max(InSecondsPerGameHour, 0.01f);
+	RFSN_LOG(TEXT("Game clock: %.2f seconds per game hour"), SecondsPerGameHour);
+}
+
+void URfsnGameClock::SetGameTime(int32 Day, float Hour)
+{
+	const double NewGameMinutes = FMath::Max(Day, 0) * static_cast<double>(MinutesPerDay) +
+	                              FMath::Clamp(Hour, 0.0f, 24.0f) * 60.0;
+
+	if (NewGameMinutes >= GameMinutes)
+	{
+		AdvanceTo(NewGameMinutes);
+		return;
+	}
+
+	GameMinutes = NewGameMinutes;
+	Wheel.Rewind(static_cast<uint64>(GameMinutes));
+
+	CancelTimer(DayTimer);
+	ScheduleDayTimer();
+
+	RFSN_LOG(TEXT("Game clock rewound to day %d %.2fh"), GetDay(), GetGameHour());
+	OnTimeJumped.Broadcast();
+}
+
+int32 URfsnGameClock::ScheduleAt(double GameMinute, FRfsnGameClockCallback Callback)
+{
+	const int32 Handle = Wheel.Add(static_cast<uint64>(FMath::CeilToDouble(FMath::Max(GameMinute, 0.0))));
+	Callbacks.Add(Handle, MoveTemp(Callback));
+	return Handle;
+}
+
+void URfsnGameClock::CancelTimer(int32 Handle)
+{
+	if (Callbacks.Remove(Handle) > 0)
+	{
+		Wheel.Remove(Handle);
+	}
+}
+
+void URfsnGameClock::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	if (!bPaused)
+	{
+		AdvanceTo(GameMinutes + DeltaTime * 60.0 / SecondsPerGameHour);
+	}
+}
+
+void URfsnGameClock::AdvanceTo(double NewGameMinutes)
+{
+	GameMinutes = NewGameMinutes;
+
+	Expired.Reset();
+	Wheel.Advance(static_cast<uint64>(GameMinutes), Expired);
+	if (Expired.Num() == 0)
+	{
+		return;
+	}
+
+	// Take every callback first: handles are recycled, and callbacks usually schedule their next timer
+	TArray<FRfsnGameClockCallback, TInlineAllocator<16>> Due;
+	Due.Reserve(Expired.Num());
+	for (const int32 Handle : Expired)
+	{
+		Due.Add(Callbacks.FindAndRemoveChecked(Handle));
+	}
+
+	for (const FRfsnGameClockCallback& Callback : Due)
+	{
+		Callback.ExecuteIfBound();
+	}
+}
+
+void URfsnGameClock::ScheduleDayTimer()
+{
+	const double NextMidnight = (GetDay() + 1) * static_cast<double>(MinutesPerDay);
+	DayTimer = ScheduleAt(NextMidnight, FRfsnGameClockCallback::CreateUObject(this, &URfsnGameClock::HandleDayChanged));
+}
+
+void URfsnGameClock::HandleDayChanged()
+{
+	ScheduleDayTimer();
+	OnDayChanged.Broadcast(GetDay());
+}
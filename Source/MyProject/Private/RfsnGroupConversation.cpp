@@ -3,57 +3,387 @@
 #include "RfsnGroupConversation.h"
 #include "RfsnLogging.h"
 #include "RfsnNpcClientComponent.h"
-#include "EngineUtils.h"
-#include "Kismet/GameplayStatics.h"
+#include "RfsnRelationshipManager.h"
+#include "Dom/JsonObject.h"
+#include "Engine/GameInstance.h"
+#include "Engine/World.h"
+#include "HttpModule.h"
+#include "Interfaces/IHttpResponse.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+#include "TimerManager.h"
+
+namespace RfsnGroup
+{
+/** Lines used without a server, or when a request fails */
+const TCHAR* const PlaceholderLines[] = {
+    TEXT("I agree with that."),
+    TEXT("That's an interesting point."),
+    TEXT("I hadn't thought about it that way."),
+    TEXT("What do you think we should do about it?"),
+    TEXT("I've been thinking the same thing."),
+    TEXT("Things have been different lately."),
+    TEXT("We should be careful."),
+    TEXT("I hope things improve soon."),
+};
+
+FString GetPlaceholderLine()
+{
+	return PlaceholderLines[FMath::RandRange(0, UE_ARRAY_COUNT(PlaceholderLines) - 1)];
+}
 
-URfsnGroupConversation::URfsnGroupConversation()
+/** Sentences of an orchestrator SSE response joined into one line */
+FString ParseStreamedLine(const FString& Body)
 {
-	PrimaryComponentTick.bCanEverTick = true;
-	PrimaryComponentTick.TickInterval = 0.5f;
+	TArray<FString> Events;
+	Body.ParseIntoArrayLines(Events);
+
+	FString Line;
+	for (const FString& Event : Events)
+	{
+		if (!Event.StartsWith(TEXT("data:")) || !Event.Contains(TEXT("\"sentence\"")))
+		{
+			continue;
+		}
+
+		TSharedPtr<FJsonObject> JsonObject;
+		TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(Event.RightChop(5).TrimStartAndEnd());
+		FString Sentence;
+		if (FJsonSerializer::Deserialize(Reader, JsonObject) && JsonObject.IsValid() &&
+		    JsonObject->TryGetStringField(TEXT("sentence"), Sentence) && !Sentence.IsEmpty())
+		{
+			Line += Line.IsEmpty() ? Sentence : TEXT(" ") + Sentence;
+		}
+	}
+	return Line;
 }
 
-void URfsnGroupConversation::BeginPlay()
+bool IsNameChar(TCHAR C)
 {
-	Super::BeginPlay();
+	return FChar::IsAlnum(C) || C == TEXT('\'');
+}
+} // namespace RfsnGroup
 
-	// Setup default topics if empty
-	if (AvailableTopics.Num() == 0)
+// ─────────────────────────────────────────────────────────────
+// FRfsnTurnScheduler
+// ─────────────────────────────────────────────────────────────
+
+void FRfsnTurnScheduler::AddCandidate(const FRfsnTurnCandidate& Candidate)
+{
+	Candidates.Add(Candidate);
+
+	// Nobody could take the floor before; maybe the newcomer can
+	if (!bSpeaking && FloorFreeSince >= 0.0 && Pending.Speaker == INDEX_NONE)
 	{
-		AvailableTopics.Add({TEXT("weather"), TEXT("Weather"), {TEXT("Have you noticed the weather lately?")}});
-		AvailableTopics.Add({TEXT("rumors"), TEXT("Rumors"), {TEXT("Have you heard any interesting news?")}});
-		AvailableTopics.Add({TEXT("survival"), TEXT("Survival"), {TEXT("How are supplies holding up?")}});
-		AvailableTopics.Add({TEXT("stories"), TEXT("Stories"), {TEXT("Remember the old days?")}});
+		Advance();
 	}
+}
 
-	RFSN_LOG(TEXT("GroupConversation initialized"));
+void FRfsnTurnScheduler::RemoveCandidate(int32 Index)
+{
+	if (!Candidates.IsValidIndex(Index))
+	{
+		return;
+	}
+
+	Candidates.RemoveAt(Index);
+
+	auto Shift = [Index](int32& Slot)
+	{
+		if (Slot == Index)
+		{
+			Slot = INDEX_NONE;
+		}
+		else if (Slot > Index)
+		{
+			Slot--;
+		}
+	};
+
+	if (Pending.Speaker == Index)
+	{
+		Discard();
+	}
+	Shift(Pending.Speaker);
+	Shift(CurrentSpeaker);
+	Shift(Addressed);
+
+	// Someone else's line is needed now; a removed speaker's own line is cut short by the owner
+	if (!bSpeaking && FloorFreeSince >= 0.0)
+	{
+		Advance();
+	}
+	else
+	{
+		Prefetch();
+	}
 }
 
-void URfsnGroupConversation::TickComponent(float DeltaTime, ELevelTick TickType,
-                                           FActorComponentTickFunction* ThisTickFunction)
+void FRfsnTurnScheduler::Reset()
 {
-	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
+	Candidates.Reset();
+	Pending = FPendingLine();
+	CurrentSpeaker = INDEX_NONE;
+	TurnNumber = 0;
+	Addressed = INDEX_NONE;
+	bAfterPlayer = false;
+	bSpeaking = false;
+	FloorFreeSince = -1.0;
+	Stats = FRfsnTurnStats();
+}
 
-	if (!bConversationActive)
+void FRfsnTurnScheduler::Stop()
+{
+	Pending = FPendingLine();
+	bSpeaking = false;
+	FloorFreeSince = -1.0;
+}
+
+void FRfsnTurnScheduler::Advance()
+{
+	bSpeaking = false;
+	if (FloorFreeSince < 0.0)
 	{
+		FloorFreeSince = Clock();
+	}
+
+	const int32 Next = PickNext();
+	if (Next == INDEX_NONE)
+	{
+		Discard();
 		return;
 	}
 
-	// Check end conditions
-	if (ShouldEndConversation())
+	if (Pending.Speaker != Next)
+	{
+		// The prediction missed; ask the speaker who actually has the floor
+		Discard();
+		Request(Next, false);
+	}
+
+	if (Pending.bReady && !bSpeaking)
+	{
+		Speak();
+	}
+}
+
+void FRfsnTurnScheduler::OnLineReady(int32 InRequest, const FString& Line)
+{
+	if (InRequest != Pending.Request || Pending.Speaker == INDEX_NONE || Pending.bReady)
+	{
+		return;
+	}
+
+	Pending.Line = Line;
+	Pending.bReady = true;
+
+	if (!bSpeaking && FloorFreeSince >= 0.0)
+	{
+		Speak();
+	}
+}
+
+void FRfsnTurnScheduler::OnInterjection(int32 InAddressed)
+{
+	Addressed = InAddressed;
+	bAfterPlayer = true;
+
+	// Whatever was requested didn't hear this
+	Discard();
+
+	if (bSpeaking)
+	{
+		Prefetch();
+	}
+	else if (FloorFreeSince >= 0.0)
+	{
+		Advance();
+	}
+}
+
+int32 FRfsnTurnScheduler::PickNext() const
+{
+	int32 Best = INDEX_NONE;
+	float BestScore = 0.0f;
+
+	for (int32 Index = 0; Index < Candidates.Num(); Index++)
+	{
+		// Nobody answers themselves unless the player spoke in between
+		if (!Candidates[Index].bAvailable || (Index == CurrentSpeaker && !bAfterPlayer))
+		{
+			continue;
+		}
+
+		const float IndexScore = Score(Index);
+		if (Best == INDEX_NONE || IndexScore > BestScore ||
+		    (IndexScore == BestScore && Candidates[Index].TurnCount < Candidates[Best].TurnCount))
+		{
+			Best = Index;
+			BestScore = IndexScore;
+		}
+	}
+
+	return Best;
+}
+
+float FRfsnTurnScheduler::Score(int32 Index) const
+{
+	const FRfsnTurnCandidate& Candidate = Candidates[Index];
+
+	const int32 Waited = Candidate.LastTurn == INDEX_NONE ? TurnNumber + 1 : TurnNumber - Candidate.LastTurn;
+	float Result = WaitWeight * Waited + InterruptWeight * Candidate.Interruptiveness;
+
+	// How an NPC feels about the player matters most when answering the player
+	Result += RelationshipWeight * Candidate.Affinity * (bAfterPlayer ? 1.0f : 0.25f);
+
+	if (Index == Addressed)
+	{
+		Result += AddressedWeight;
+	}
+	return Result;
+}
+
+int32 FRfsnTurnScheduler::FindAddressed(FStringView Text, int32 Speaker) const
+{
+	using namespace RfsnGroup;
+
+	int32 Best = INDEX_NONE;
+	int32 BestPosition = MAX_int32;
+
+	for (int32 Index = 0; Index < Candidates.Num(); Index++)
+	{
+		const FString& Name = Candidates[Index].Name;
+		if (Index == Speaker || Name.IsEmpty())
+		{
+			continue;
+		}
+
+		for (int32 Position = 0; Position + Name.Len() <= Text.Len() && Position < BestPosition; Position++)
+		{
+			const bool bStartsWord = Position == 0 || !IsNameChar(Text[Position - 1]);
+			const int32 End = Position + Name.Len();
+			if (bStartsWord && (End == Text.Len() || !IsNameChar(Text[End])) &&
+			    Text.Mid(Position, Name.Len()).Equals(Name, ESearchCase::IgnoreCase))
+			{
+				Best = Index;
+				BestPosition = Position;
+				break;
+			}
+		}
+	}
+
+	return Best;
+}
+
+void FRfsnTurnScheduler::Request(int32 Speaker, bool bPrefetched)
+{
+	Pending = FPendingLine();
+	Pending.Request = NextRequest++;
+	Pending.Speaker = Speaker;
+	Pending.bPrefetched = bPrefetched;
+	Stats.Requests++;
+
+	// May answer straight away
+	if (RequestLine)
+	{
+		RequestLine(Speaker, Pending.Request);
+	}
+}
+
+void FRfsnTurnScheduler::Prefetch()
+{
+	if (!bPrefetch || !bSpeaking || Pending.Speaker != INDEX_NONE)
 	{
-		EndConversation();
 		return;
 	}
 
-	// Auto-progress conversation
-	TurnTimer += DeltaTime;
-	if (TurnTimer >= TurnDelay && Participants.Num() > 0)
+	const int32 Next = PickNext();
+	if (Next != INDEX_NONE)
 	{
-		TurnTimer = 0.0f;
-		TriggerNextSpeaker();
+		Request(Next, true);
 	}
 }
 
+void FRfsnTurnScheduler::Discard()
+{
+	if (Pending.Speaker != INDEX_NONE)
+	{
+		Stats.Discarded++;
+	}
+	Pending = FPendingLine();
+}
+
+void FRfsnTurnScheduler::Speak()
+{
+	const int32 Speaker = Pending.Speaker;
+	const FString Line = MoveTemp(Pending.Line);
+
+	const double Gap = Clock() - FloorFreeSince;
+	Stats.Gaps++;
+	Stats.TotalGapSeconds += Gap;
+	Stats.MaxGapSeconds = FMath::Max(Stats.MaxGapSeconds, Gap);
+	Stats.Turns++;
+	Stats.PrefetchHits += Pending.bPrefetched ? 1 : 0;
+	Pending = FPendingLine();
+	FloorFreeSince = -1.0;
+
+	FRfsnTurnCandidate& Candidate = Candidates[Speaker];
+	Candidate.TurnCount++;
+	Candidate.LastTurn = TurnNumber++;
+	const int32 Turn = TurnNumber;
+
+	CurrentSpeaker = Speaker;
+	Addressed = FindAddressed(Line, Speaker);
+	bAfterPlayer = false;
+	bSpeaking = true;
+
+	if (SpeakLine)
+	{
+		SpeakLine(Speaker, Line);
+	}
+
+	// Asked after SpeakLine so the owner's context already has this line; skipped if it ended meanwhile
+	if (TurnNumber == Turn)
+	{
+		Prefetch();
+	}
+}
+
+// ─────────────────────────────────────────────────────────────
+// URfsnGroupConversation
+// ─────────────────────────────────────────────────────────────
+
+URfsnGroupConversation::URfsnGroupConversation()
+{
+	// Turns are driven by line requests and timers
+	PrimaryComponentTick.bCanEverTick = false;
+
+	Scheduler.RequestLine = [this](int32 SpeakerIndex, int32 Request) { RequestLine(SpeakerIndex, Request); };
+	Scheduler.SpeakLine = [this](int32 SpeakerIndex, const FString& Line) { SpeakLine(SpeakerIndex, Line); };
+}
+
+void URfsnGroupConversation::BeginPlay()
+{
+	Super::BeginPlay();
+
+	// Setup default topics if empty
+	if (AvailableTopics.Num() == 0)
+	{
+		AvailableTopics.Add({TEXT("weather"), TEXT("Weather"), {TEXT("Have you noticed the weather lately?")}});
+		AvailableTopics.Add({TEXT("rumors"), TEXT("Rumors"), {TEXT("Have you heard any interesting news?")}});
+		AvailableTopics.Add({TEXT("survival"), TEXT("Survival"), {TEXT("How are supplies holding up?")}});
+		AvailableTopics.Add({TEXT("stories"), TEXT("Stories"), {TEXT("Remember the old days?")}});
+	}
+
+	RFSN_LOG(TEXT("GroupConversation initialized"));
+}
+
+void URfsnGroupConversation::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	StopTurns();
+	Super::EndPlay(EndPlayReason);
+}
+
 bool URfsnGroupConversation::StartConversation(const TArray<FString>& NpcIds, const FString& Topic)
 {
 	if (bConversationActive || NpcIds.Num() < 2)
@@ -63,6 +393,10 @@ bool URfsnGroupConversation::StartConversation(const TArray<FString>& NpcIds, co
 
 	Participants.Empty();
 	DialogueHistory.Empty();
+	SpeakerSummaries.Empty();
+	TotalLines = 0;
+	Scheduler.Reset();
+	Scheduler.bPrefetch = bPrefetchLines;
 
 	for (const FString& NpcId : NpcIds)
 	{
@@ -71,14 +405,9 @@ bool URfsnGroupConversation::StartConversation(const TArray<FString>& NpcIds, co
 			break;
 		}
 
-		URfsnNpcClientComponent* NpcComp = FindNpcComponent(NpcId);
-		if (NpcComp)
+		if (URfsnNpcClientComponent* NpcComp = FindNpcComponent(NpcId))
 		{
-			FRfsnConversationParticipant Participant;
-			Participant.NpcId = NpcId;
-			Participant.DisplayName = NpcComp->NpcName;
-			Participant.NpcComponent = NpcComp;
-			Participants.Add(Participant);
+			AddParticipantComponent(NpcId, NpcComp);
 		}
 	}
 
@@ -89,7 +418,6 @@ bool URfsnGroupConversation::StartConversation(const TArray<FString>& NpcIds, co
 
 	bConversationActive = true;
 	CurrentSpeakerIndex = 0;
-	TurnTimer = 0.0f;
 	ConversationStartTime = GetWorld() ? GetWorld()->GetTimeSeconds() : 0.0f;
 
 	// Set topic
@@ -102,10 +430,16 @@ bool URfsnGroupConversation::StartConversation(const TArray<FString>& NpcIds, co
 		CurrentTopic = AvailableTopics[FMath::RandRange(0, AvailableTopics.Num() - 1)].TopicId;
 	}
 
+	if (UWorld* World = GetWorld())
+	{
+		World->GetTimerManager().SetTimer(DurationTimer, this, &URfsnGroupConversation::EndConversation,
+		                                  FMath::Max(MaxDuration, 0.01f), false);
+	}
+
 	RFSN_LOG(TEXT("Group conversation started with %d participants, topic: %s"), Participants.Num(), *CurrentTopic);
 
 	// First speaker starts
-	TriggerNextSpeaker();
+	Scheduler.Advance();
 	return true;
 }
 
@@ -118,9 +452,13 @@ void URfsnGroupConversation::EndConversation()
 
 	bConversationActive = false;
 	bPlayerParticipating = false;
+	StopTurns();
+
+	const FRfsnTurnStats& Stats = Scheduler.GetStats();
+	RFSN_LOG(TEXT("Group conversation ended after %d lines (%d of %d NPC turns prefetched, average wait %.0f ms)"),
+	         TotalLines, Stats.PrefetchHits, Stats.Turns, Stats.GetAverageGapSeconds() * 1000.0);
 
 	OnConversationEnded.Broadcast();
-	RFSN_LOG(TEXT("Group conversation ended after %d exchanges"), DialogueHistory.Num());
 }
 
 bool URfsnGroupConversation::AddParticipant(const FString& NpcId)
@@ -136,11 +474,7 @@ bool URfsnGroupConversation::AddParticipant(const FString& NpcId)
 		return false;
 	}
 
-	FRfsnConversationParticipant Participant;
-	Participant.NpcId = NpcId;
-	Participant.DisplayName = NpcComp->NpcName;
-	Participant.NpcComponent = NpcComp;
-	Participants.Add(Participant);
+	AddParticipantComponent(NpcId, NpcComp);
 
 	OnParticipantJoined.Broadcast(NpcId);
 	RFSN_LOG(TEXT("%s joined group conversation"), *NpcId);
@@ -157,7 +491,19 @@ bool URfsnGroupConversation::RemoveParticipant(const FString& NpcId)
 		return false;
 	}
 
+	const bool bWasSpeaking = Scheduler.IsSpeaking() && Scheduler.GetCurrentSpeaker() == Index;
 	Participants.RemoveAt(Index);
+	Scheduler.RemoveCandidate(Index);
+
+	// Keep pointing at the same speaker, or at nobody if it was them who left
+	if (Index < CurrentSpeakerIndex)
+	{
+		CurrentSpeakerIndex--;
+	}
+	else if (Index == CurrentSpeakerIndex)
+	{
+		CurrentSpeakerIndex = INDEX_NONE;
+	}
 	OnParticipantLeft.Broadcast(NpcId);
 
 	// End if not enough participants
@@ -165,6 +511,15 @@ bool URfsnGroupConversation::RemoveParticipant(const FString& NpcId)
 	{
 		EndConversation();
 	}
+	else if (bWasSpeaking && bConversationActive)
+	{
+		// Their line leaves with them
+		if (UWorld* World = GetWorld())
+		{
+			World->GetTimerManager().ClearTimer(LineTimer);
+		}
+		Scheduler.Advance();
+	}
 
 	return true;
 }
@@ -199,7 +554,10 @@ void URfsnGroupConversation::PlayerSpeak(const FString& Text)
 	}
 
 	AddDialogueLine(TEXT("player"), TEXT("You"), Text, true);
-	TurnTimer = 0.0f; // Reset timer for NPC response
+
+	// Whoever the player named answers; lines requested before this are stale
+	RefreshCandidates();
+	Scheduler.OnInterjection(Scheduler.FindAddressed(Text, INDEX_NONE));
 }
 
 void URfsnGroupConversation::TriggerNextSpeaker()
@@ -209,12 +567,15 @@ void URfsnGroupConversation::TriggerNextSpeaker()
 		return;
 	}
 
-	int32 NextSpeaker = SelectNextSpeaker();
-	if (NextSpeaker != INDEX_NONE)
+	if (UWorld* World = GetWorld())
+	{
+		World->GetTimerManager().ClearTimer(LineTimer);
+	}
+	if (Participants.IsValidIndex(CurrentSpeakerIndex))
 	{
-		CurrentSpeakerIndex = NextSpeaker;
-		GenerateNpcResponse(NextSpeaker);
+		Participants[CurrentSpeakerIndex].bIsSpeaking = false;
 	}
+	Scheduler.Advance();
 }
 
 FString URfsnGroupConversation::GetConversationContext() const
@@ -231,9 +592,15 @@ FString URfsnGroupConversation::GetConversationContext() const
 		Context += TEXT("NPCs are talking among themselves. ");
 	}
 
-	if (DialogueHistory.Num() > 0)
+	if (TotalLines > 0)
+	{
+		Context += FString::Printf(TEXT("%d exchanges so far. "), TotalLines);
+	}
+
+	const FString Summary = GetHistorySummary();
+	if (!Summary.IsEmpty())
 	{
-		Context += FString::Printf(TEXT("%d exchanges so far. "), DialogueHistory.Num());
+		Context += Summary + TEXT(" ");
 	}
 
 	return Context;
@@ -253,6 +620,22 @@ FString URfsnGroupConversation::GetRecentDialogue(int32 LineCount) const
 	return Dialogue;
 }
 
+FString URfsnGroupConversation::GetHistorySummary() const
+{
+	if (SpeakerSummaries.Num() == 0)
+	{
+		return FString();
+	}
+
+	TArray<FString> Parts;
+	for (const FRfsnGroupSpeakerSummary& Summary : SpeakerSummaries)
+	{
+		Parts.Add(FString::Printf(TEXT("%s (%d %s, last: \"%s\")"), *Summary.Name, Summary.Lines,
+		                          Summary.Lines == 1 ? TEXT("line") : TEXT("lines"), *Summary.LastLine));
+	}
+	return TEXT("Earlier: ") + FString::Join(Parts, TEXT("; ")) + TEXT(".");
+}
+
 FString URfsnGroupConversation::GetParticipantNames() const
 {
 	TArray<FString> Names;
@@ -275,92 +658,171 @@ bool URfsnGroupConversation::IsParticipating(const FString& NpcId) const
 
 URfsnNpcClientComponent* URfsnGroupConversation::FindNpcComponent(const FString& NpcId) const
 {
+	// Every NPC client registers itself with the relationship manager at BeginPlay
 	UWorld* World = GetWorld();
-	if (!World)
+	UGameInstance* GI = World ? World->GetGameInstance() : nullptr;
+	URfsnRelationshipManager* RelMgr = GI ? GI->GetSubsystem<URfsnRelationshipManager>() : nullptr;
+	return RelMgr ? RelMgr->FindNpcClient(NpcId) : nullptr;
+}
+
+void URfsnGroupConversation::AddParticipantComponent(const FString& NpcId, URfsnNpcClientComponent* NpcComp)
+{
+	FRfsnConversationParticipant Participant;
+	Participant.NpcId = NpcId;
+	Participant.DisplayName = NpcComp->NpcName;
+	Participant.NpcComponent = NpcComp;
+	Participants.Add(Participant);
+
+	FRfsnTurnCandidate Candidate;
+	Candidate.Name = Participant.DisplayName;
+	Candidate.Affinity = NpcComp->Affinity;
+	Candidate.Interruptiveness = Participant.Interruptiveness;
+	Scheduler.AddCandidate(Candidate);
+}
+
+void URfsnGroupConversation::RefreshCandidates()
+{
+	for (int32 Index = 0; Index < Participants.Num() && Index < Scheduler.NumCandidates(); Index++)
+	{
+		const FRfsnConversationParticipant& Participant = Participants[Index];
+		FRfsnTurnCandidate& Candidate = Scheduler.GetCandidate(Index);
+		Candidate.Affinity = Participant.NpcComponent ? Participant.NpcComponent->Affinity : 0.0f;
+		Candidate.Interruptiveness = Participant.Interruptiveness;
+		Candidate.bAvailable = Participant.NpcComponent != nullptr;
+	}
+}
+
+FString URfsnGroupConversation::BuildLinePrompt(int32 SpeakerIndex) const
+{
+	const FRfsnConversationParticipant& Speaker = Participants[SpeakerIndex];
+	const FString Instruction =
+	    FString::Printf(TEXT("You are %s in a group conversation about %s with %s. Say something brief and natural."),
+	                    *Speaker.DisplayName, *CurrentTopic, *GetParticipantNames());
+	return GetConversationContext() + TEXT("\n") + GetRecentDialogue(HistoryWindow) + Instruction;
+}
+
+void URfsnGroupConversation::RequestLine(int32 SpeakerIndex, int32 Request)
+{
+	// Only one line is ever wanted; a newer request replaces the one in flight
+	if (LineRequest.IsValid())
 	{
-		return nullptr;
+		LineRequest->OnProcessRequestComplete().Unbind();
+		LineRequest->CancelRequest();
+		LineRequest.Reset();
 	}
 
-	for (TActorIterator<AActor> It(World); It; ++It)
+	URfsnNpcClientComponent* NpcComp = Participants[SpeakerIndex].NpcComponent;
+	if (!bRequestLinesFromServer || !NpcComp)
 	{
-		URfsnNpcClientComponent* Comp = (*It)->FindComponentByClass<URfsnNpcClientComponent>();
-		if (Comp && Comp->NpcId == NpcId)
-		{
-			return Comp;
-		}
+		Scheduler.OnLineReady(Request, NpcComp ? RfsnGroup::GetPlaceholderLine() : TEXT("..."));
+		return;
 	}
 
-	return nullptr;
+	// Same payload as URfsnNpcClientComponent, with the group prompt as the utterance
+	TSharedPtr<FJsonObject> NpcState = MakeShareable(new FJsonObject());
+	NpcState->SetStringField(TEXT("npc_name"), NpcComp->NpcName);
+	NpcState->SetStringField(TEXT("npc_id"), NpcComp->NpcId);
+	NpcState->SetNumberField(TEXT("affinity"), NpcComp->Affinity);
+	NpcState->SetStringField(TEXT("mood"), NpcComp->Mood);
+	NpcState->SetStringField(TEXT("relationship"), NpcComp->Relationship);
+
+	TSharedPtr<FJsonObject> Payload = MakeShareable(new FJsonObject());
+	Payload->SetStringField(TEXT("user_input"), BuildLinePrompt(SpeakerIndex));
+	Payload->SetObjectField(TEXT("npc_state"), NpcState);
+	Payload->SetStringField(TEXT("tts_engine"), NpcComp->TtsEngine);
+
+	FString JsonString;
+	TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&JsonString);
+	FJsonSerializer::Serialize(Payload.ToSharedRef(), Writer);
+
+	LineRequest = FHttpModule::Get().CreateRequest();
+	LineRequest->SetURL(NpcComp->OrchestratorUrl);
+	LineRequest->SetVerb(TEXT("POST"));
+	LineRequest->SetHeader(TEXT("Content-Type"), TEXT("application/json"));
+	LineRequest->SetHeader(TEXT("Accept"), TEXT("text/event-stream"));
+	LineRequest->SetContentAsString(JsonString);
+
+	TWeakObjectPtr<URfsnGroupConversation> WeakThis(this);
+	LineRequest->OnProcessRequestComplete().BindLambda(
+	    [WeakThis, Request](FHttpRequestPtr, FHttpResponsePtr Response, bool bSuccess)
+	    {
+		    URfsnGroupConversation* This = WeakThis.Get();
+		    if (!This)
+		    {
+			    return;
+		    }
+
+		    This->LineRequest.Reset();
+		    FString Line = bSuccess && Response.IsValid() ? RfsnGroup::ParseStreamedLine(Response->GetContentAsString())
+		                                                  : FString();
+		    if (Line.IsEmpty())
+		    {
+			    RFSN_WARNING(TEXT("[Group] Line request failed, using a placeholder"));
+			    Line = RfsnGroup::GetPlaceholderLine();
+		    }
+		    This->Scheduler.OnLineReady(Request, Line);
+	    });
+	LineRequest->ProcessRequest();
 }
 
-int32 URfsnGroupConversation::SelectNextSpeaker() const
+void URfsnGroupConversation::SpeakLine(int32 SpeakerIndex, const FString& Line)
 {
-	if (Participants.Num() == 0)
+	FRfsnConversationParticipant& Speaker = Participants[SpeakerIndex];
+	Speaker.TurnCount++;
+	Speaker.bHasContributed = true;
+	Speaker.bIsSpeaking = true;
+	CurrentSpeakerIndex = SpeakerIndex;
+
+	AddDialogueLine(Speaker.NpcId, Speaker.DisplayName, Line);
+
+	// Affinity may have moved since the last turn; the scheduler prefetches right after this
+	RefreshCandidates();
+
+	const float Duration = FMath::Max(TurnDelay, Line.Len() * SecondsPerCharacter) + FMath::Max(TurnGap, 0.0f);
+	if (UWorld* World = GetWorld())
 	{
-		return INDEX_NONE;
+		World->GetTimerManager().SetTimer(LineTimer, this, &URfsnGroupConversation::FinishLine, Duration, false);
 	}
+}
 
-	// Find participant who hasn't spoken recently
-	int32 Best = -1;
-	int32 LowestTurns = INT_MAX;
-
-	for (int32 i = 0; i < Participants.Num(); ++i)
+void URfsnGroupConversation::FinishLine()
+{
+	if (Participants.IsValidIndex(CurrentSpeakerIndex))
 	{
-		if (i != CurrentSpeakerIndex && Participants[i].TurnCount < LowestTurns)
-		{
-			LowestTurns = Participants[i].TurnCount;
-			Best = i;
-		}
+		Participants[CurrentSpeakerIndex].bIsSpeaking = false;
 	}
 
-	if (Best == -1 && Participants.Num() > 0)
+	// Check end conditions
+	if (ShouldEndConversation())
 	{
-		// Just pick next
-		Best = (CurrentSpeakerIndex + 1) % Participants.Num();
+		EndConversation();
+		return;
 	}
 
-	return Best;
+	Scheduler.Advance();
 }
 
-void URfsnGroupConversation::GenerateNpcResponse(int32 SpeakerIndex)
+void URfsnGroupConversation::StopTurns()
 {
-	if (SpeakerIndex < 0 || SpeakerIndex >= Participants.Num())
+	if (UWorld* World = GetWorld())
 	{
-		return;
+		World->GetTimerManager().ClearTimer(LineTimer);
+		World->GetTimerManager().ClearTimer(DurationTimer);
 	}
 
-	FRfsnConversationParticipant& Speaker = Participants[SpeakerIndex];
-	Speaker.TurnCount++;
-	Speaker.bHasContributed = true;
-	Speaker.bIsSpeaking = true;
-
-	// Generate response via NPC component (would integrate with LLM)
-	FString Response;
-	if (Speaker.NpcComponent)
-	{
-		// Create context-aware prompt
-		FString Prompt = FString::Printf(
-		    TEXT("You are %s in a group conversation about %s with %s. Say something brief and natural."),
-		    *Speaker.DisplayName, *CurrentTopic, *GetParticipantNames());
-
-		// For now, use placeholder
-		TArray<FString> Responses = {TEXT("I agree with that."),
-		                             TEXT("That's an interesting point."),
-		                             TEXT("I hadn't thought about it that way."),
-		                             TEXT("What do you think we should do about it?"),
-		                             TEXT("I've been thinking the same thing."),
-		                             TEXT("Things have been different lately."),
-		                             TEXT("We should be careful."),
-		                             TEXT("I hope things improve soon.")};
-		Response = Responses[FMath::RandRange(0, Responses.Num() - 1)];
+	if (LineRequest.IsValid())
+	{
+		LineRequest->OnProcessRequestComplete().Unbind();
+		LineRequest->CancelRequest();
+		LineRequest.Reset();
 	}
-	else
+
+	for (FRfsnConversationParticipant& Participant : Participants)
 	{
-		Response = TEXT("...");
+		Participant.bIsSpeaking = false;
 	}
 
-	AddDialogueLine(Speaker.NpcId, Speaker.DisplayName, Response);
-	Speaker.bIsSpeaking = false;
+	Scheduler.Stop();
 }
 
 void URfsnGroupConversation::AddDialogueLine(const FString& SpeakerId, const FString& Name, const FString& Text,
@@ -374,6 +836,24 @@ void URfsnGroupConversation::AddDialogueLine(const FString& SpeakerId, const FSt
 	Line.Timestamp = GetWorld() ? GetWorld()->GetTimeSeconds() : 0.0f;
 
 	DialogueHistory.Add(Line);
+	TotalLines++;
+
+	// Lines leaving the window are kept as a per-speaker count and their latest line
+	while (DialogueHistory.Num() > FMath::Max(HistoryWindow, 1))
+	{
+		const FRfsnGroupDialogueLine& Oldest = DialogueHistory[0];
+		FRfsnGroupSpeakerSummary* Summary = SpeakerSummaries.FindByPredicate(
+		    [&Oldest](const FRfsnGroupSpeakerSummary& S) { return S.Name == Oldest.SpeakerName; });
+		if (!Summary)
+		{
+			Summary = &SpeakerSummaries.AddDefaulted_GetRef();
+			Summary->Name = Oldest.SpeakerName;
+		}
+		Summary->Lines++;
+		Summary->LastLine = Oldest.Text.Len() > 80 ? Oldest.Text.Left(77) + TEXT("...") : Oldest.Text;
+		DialogueHistory.RemoveAt(0);
+	}
+
 	OnGroupDialogue.Broadcast(SpeakerId, Text);
 
 	RFSN_LOG(TEXT("[Group] %s: %s"), *Name, *Text);
@@ -395,7 +875,7 @@ bool URfsnGroupConversation::ShouldEndConversation() const
 	}
 
 	// Too many exchanges
-	if (DialogueHistory.Num() > 20)
+	if (TotalLines >= MaxLines)
 	{
 		return true;
 	}
@@ -2,6 +2,7 @@
 
 #include "RfsnHttpPool.h"
 #include "RfsnLogging.h"
+#include "RfsnTrace.h"
 #include "HttpModule.h"
 #include "Interfaces/IHttpResponse.h"
 
@@ -16,6 +17,8 @@ void URfsnHttpPool::Initialize(FSubsystemCollectionBase& Collection)
 TSharedPtr<IHttpRequest, ESPMode::ThreadSafe> URfsnHttpPool::CreatePostRequest(const FString& Endpoint,
                                                                                const FString& JsonBody)
 {
+	RFSN_TRACE_SCOPE(RfsnHttpPool_CreatePostRequest);
+
 	if (Stats.ActiveRequests >= MaxConcurrentRequests)
 	{
 		RFSN_WARNING(TEXT("Max concurrent requests reached (%d)"), MaxConcurrentRequests);
@@ -32,11 +35,15 @@ TSharedPtr<IHttpRequest, ESPMode::ThreadSafe> URfsnHttpPool::CreatePostRequest(c
 	Request->SetContentAsString(JsonBody);
 	Request->SetTimeout(RequestTimeout);
 
+	RFSN_TRACE_COUNTER_ADD(RfsnPooledRequests, 1);
+
 	return Request;
 }
 
 TSharedPtr<IHttpRequest, ESPMode::ThreadSafe> URfsnHttpPool::CreateGetRequest(const FString& Endpoint)
 {
+	RFSN_TRACE_SCOPE(RfsnHttpPool_CreateGetRequest);
+
 	TSharedPtr<IHttpRequest, ESPMode::ThreadSafe> Request = FHttpModule::Get().CreateRequest();
 
 	FString FullUrl = BaseUrl + Endpoint;
@@ -45,6 +52,8 @@ TSharedPtr<IHttpRequest, ESPMode::ThreadSafe> URfsnHttpPool::CreateGetRequest(co
 	Request->SetHeader(TEXT("Accept"), TEXT("application/json"));
 	Request->SetTimeout(RequestTimeout);
 
+	RFSN_TRACE_COUNTER_ADD(RfsnPooledRequests, 1);
+
 	return Request;
 }
 
@@ -52,6 +61,7 @@ void URfsnHttpPool::ResetStats()
 {
 	Stats = FRfsnHttpStats();
 	LatencySamples.Empty();
+	RFSN_TRACE_COUNTER_SET(RfsnInFlightRequests, 0);
 }
 
 void URfsnHttpPool::PingServer()
@@ -80,11 +90,15 @@ void URfsnHttpPool::OnRequestStarted()
 {
 	Stats.TotalRequests++;
 	Stats.ActiveRequests++;
+	RFSN_TRACE_COUNTER_SET(RfsnInFlightRequests, Stats.ActiveRequests);
 }
 
 void URfsnHttpPool::OnRequestCompleted(bool bSuccess, float LatencyMs, int32 BytesReceived)
 {
+	RFSN_TRACE_SCOPE(RfsnHttpPool_OnRequestCompleted);
+
 	Stats.ActiveRequests = FMath::Max(0, Stats.ActiveRequests - 1);
+	RFSN_TRACE_COUNTER_SET(RfsnInFlightRequests, Stats.ActiveRequests);
 
 	if (bSuccess)
 	{
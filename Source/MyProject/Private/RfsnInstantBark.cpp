@@ -1,8 +1,10 @@
 // RFSN Instant Bark System - Implementation
 
 #include "RfsnInstantBark.h"
+#include "RfsnBarkLibrary.h"
 #include "RfsnNpcClientComponent.h"
 #include "RfsnLogging.h"
+#include "RfsnTokenDecoder.h"
 #include "Components/AudioComponent.h"
 #include "Kismet/GameplayStatics.h"
 #include "TimerManager.h"
@@ -31,11 +33,8 @@ void URfsnInstantBark::BeginPlay()
 		}
 	}
 
-	// Setup default barks if library is empty
-	if (BarkLibrary.GreetBarks.Num() == 0)
-	{
-		SetupDefaultBarks();
-	}
+	// Share bark content with every NPC of the same archetype (defaults if empty)
+	RefreshBarkLibrary();
 
 	// Auto-bind to RFSN client
 	if (bAutoBindToClient)
@@ -64,7 +63,7 @@ void URfsnInstantBark::PlayBark(ERfsnBarkCategory Category)
 
 	StopBark();
 
-	FRfsnInstantBarkEntry Bark = GetNextBark(Category);
+	const FRfsnInstantBarkEntry& Bark = GetNextBark(Category);
 
 	if (Bark.Text.IsEmpty())
 	{
@@ -160,35 +159,18 @@ ERfsnBarkCategory URfsnInstantBark::ActionToCategory(const FString& ActionName)
 
 TArray<FRfsnInstantBarkEntry> URfsnInstantBark::GetBarksForCategory(ERfsnBarkCategory Category) const
 {
-	switch (Category)
+	return GetBarkBucket(Category);
+}
+
+const TArray<FRfsnInstantBarkEntry>& URfsnInstantBark::GetBarkBucket(ERfsnBarkCategory Category) const
+{
+	if (SharedBarks.IsValid())
 	{
-	case ERfsnBarkCategory::Greet:
-		return BarkLibrary.GreetBarks;
-	case ERfsnBarkCategory::Threaten:
-		return BarkLibrary.ThreatenBarks;
-	case ERfsnBarkCategory::Agree:
-		return BarkLibrary.AgreeBarks;
-	case ERfsnBarkCategory::Disagree:
-		return BarkLibrary.DisagreeBarks;
-	case ERfsnBarkCategory::Question:
-		return BarkLibrary.QuestionBarks;
-	case ERfsnBarkCategory::Help:
-		return BarkLibrary.HelpBarks;
-	case ERfsnBarkCategory::Trade:
-		return BarkLibrary.TradeBarks;
-	case ERfsnBarkCategory::Farewell:
-		return BarkLibrary.FarewellBarks;
-	case ERfsnBarkCategory::Idle:
-		return BarkLibrary.IdleBarks;
-	case ERfsnBarkCategory::Combat:
-		return BarkLibrary.CombatBarks;
-	case ERfsnBarkCategory::Surprise:
-		return BarkLibrary.SurpriseBarks;
-	case ERfsnBarkCategory::Grateful:
-		return BarkLibrary.GratefulBarks;
-	default:
-		return TArray<FRfsnInstantBarkEntry>();
+		return SharedBarks->GetBucket(Category);
 	}
+
+	// Not yet initialized (e.g. queried before BeginPlay) - read the authored library
+	return FRfsnBarkLibraryRegistry::GetLibraryBucket(BarkLibrary, Category);
 }
 
 void URfsnInstantBark::StopBark()
@@ -218,89 +200,38 @@ void URfsnInstantBark::BindToRfsnClient(URfsnNpcClientComponent* Client)
 
 void URfsnInstantBark::SetupDefaultBarks()
 {
-	// Greet
-	BarkLibrary.GreetBarks.Add(FRfsnInstantBarkEntry{TEXT("Hey there!"), nullptr, 400});
-	BarkLibrary.GreetBarks.Add(FRfsnInstantBarkEntry{TEXT("Well, hello!"), nullptr, 450});
-	BarkLibrary.GreetBarks.Add(FRfsnInstantBarkEntry{TEXT("Ah, you again."), nullptr, 500});
-
-	// Threaten
-	BarkLibrary.ThreatenBarks.Add(FRfsnInstantBarkEntry{TEXT("You asked for it!"), nullptr, 600});
-	BarkLibrary.ThreatenBarks.Add(FRfsnInstantBarkEntry{TEXT("Don't test me."), nullptr, 500});
-	BarkLibrary.ThreatenBarks.Add(FRfsnInstantBarkEntry{TEXT("I'm warning you."), nullptr, 550});
-
-	// Agree
-	BarkLibrary.AgreeBarks.Add(FRfsnInstantBarkEntry{TEXT("Alright then."), nullptr, 400});
-	BarkLibrary.AgreeBarks.Add(FRfsnInstantBarkEntry{TEXT("Fair enough."), nullptr, 400});
-	BarkLibrary.AgreeBarks.Add(FRfsnInstantBarkEntry{TEXT("You got it."), nullptr, 350});
-
-	// Disagree
-	BarkLibrary.DisagreeBarks.Add(FRfsnInstantBarkEntry{TEXT("I don't think so."), nullptr, 500});
-	BarkLibrary.DisagreeBarks.Add(FRfsnInstantBarkEntry{TEXT("No way."), nullptr, 300});
-	BarkLibrary.DisagreeBarks.Add(FRfsnInstantBarkEntry{TEXT("Not a chance."), nullptr, 450});
-
-	// Question
-	BarkLibrary.QuestionBarks.Add(FRfsnInstantBarkEntry{TEXT("Hmm, let me think..."), nullptr, 600});
-	BarkLibrary.QuestionBarks.Add(FRfsnInstantBarkEntry{TEXT("Good question."), nullptr, 400});
-	BarkLibrary.QuestionBarks.Add(FRfsnInstantBarkEntry{TEXT("Well..."), nullptr, 300});
-
-	// Help
-	BarkLibrary.HelpBarks.Add(FRfsnInstantBarkEntry{TEXT("Of course!"), nullptr, 350});
-	BarkLibrary.HelpBarks.Add(FRfsnInstantBarkEntry{TEXT("I can help with that."), nullptr, 600});
-	BarkLibrary.HelpBarks.Add(FRfsnInstantBarkEntry{TEXT("Let's see..."), nullptr, 400});
-
-	// Trade
-	BarkLibrary.TradeBarks.Add(FRfsnInstantBarkEntry{TEXT("Looking to trade?"), nullptr, 500});
-	BarkLibrary.TradeBarks.Add(FRfsnInstantBarkEntry{TEXT("Let's see what you've got."), nullptr, 600});
-	BarkLibrary.TradeBarks.Add(FRfsnInstantBarkEntry{TEXT("Business, eh?"), nullptr, 400});
-
-	// Farewell
-	BarkLibrary.FarewellBarks.Add(FRfsnInstantBarkEntry{TEXT("Take care."), nullptr, 350});
-	BarkLibrary.FarewellBarks.Add(FRfsnInstantBarkEntry{TEXT("Until next time."), nullptr, 450});
-	BarkLibrary.FarewellBarks.Add(FRfsnInstantBarkEntry{TEXT("Safe travels."), nullptr, 400});
-
-	// Idle
-	BarkLibrary.IdleBarks.Add(FRfsnInstantBarkEntry{TEXT("Hmm."), nullptr, 200});
-	BarkLibrary.IdleBarks.Add(FRfsnInstantBarkEntry{TEXT("..."), nullptr, 100});
-
-	// Combat
-	BarkLibrary.CombatBarks.Add(FRfsnInstantBarkEntry{TEXT("Die!"), nullptr, 250});
-	BarkLibrary.CombatBarks.Add(FRfsnInstantBarkEntry{TEXT("Take that!"), nullptr, 300});
-	BarkLibrary.CombatBarks.Add(FRfsnInstantBarkEntry{TEXT("You'll regret this!"), nullptr, 500});
-
-	// Surprise
-	BarkLibrary.SurpriseBarks.Add(FRfsnInstantBarkEntry{TEXT("What the—"), nullptr, 350});
-	BarkLibrary.SurpriseBarks.Add(FRfsnInstantBarkEntry{TEXT("Whoa!"), nullptr, 250});
-	BarkLibrary.SurpriseBarks.Add(FRfsnInstantBarkEntry{TEXT("Huh?"), nullptr, 200});
-
-	// Grateful
-	BarkLibrary.GratefulBarks.Add(FRfsnInstantBarkEntry{TEXT("Thanks!"), nullptr, 300});
-	BarkLibrary.GratefulBarks.Add(FRfsnInstantBarkEntry{TEXT("Much appreciated."), nullptr, 450});
-	BarkLibrary.GratefulBarks.Add(FRfsnInstantBarkEntry{TEXT("You're too kind."), nullptr, 450});
+	BarkLibrary = FRfsnBarkLibraryRegistry::GetDefaultInstantBarks();
+	RefreshBarkLibrary();
+}
+
+void URfsnInstantBark::RefreshBarkLibrary()
+{
+	SharedBarks = FRfsnBarkLibraryRegistry::AcquireInstantBarks(BarkLibrary);
+	FMemory::Memzero(BarkCursors, sizeof(BarkCursors));
 }
 
 void URfsnInstantBark::OnRfsnMetaReceived(const FRfsnDialogueMeta& Meta)
 {
 	// Play bark immediately when action is received
 	// This masks the LLM generation latency
-	FString ActionStr = UEnum::GetValueAsString(Meta.NpcAction);
-	ActionStr = ActionStr.Replace(TEXT("ERfsnNpcAction::"), TEXT(""));
-
-	PlayBarkFromAction(ActionStr);
+	PlayBarkFromAction(FRfsnTokenDecoder::GetActionName(Meta.NpcAction));
 }
 
-FRfsnInstantBarkEntry URfsnInstantBark::GetNextBark(ERfsnBarkCategory Category)
+const FRfsnInstantBarkEntry& URfsnInstantBark::GetNextBark(ERfsnBarkCategory Category)
 {
-	TArray<FRfsnInstantBarkEntry> Barks = GetBarksForCategory(Category);
+	static const FRfsnInstantBarkEntry EmptyBark{TEXT("..."), nullptr, 100};
+
+	const TArray<FRfsnInstantBarkEntry>& Barks = GetBarkBucket(Category);
 
 	if (Barks.Num() == 0)
 	{
-		return FRfsnInstantBarkEntry{TEXT("..."), nullptr, 100};
+		return EmptyBark;
 	}
 
-	// Round-robin selection
-	int32& Index = BarkIndices.FindOrAdd(Category);
-	FRfsnInstantBarkEntry Bark = Barks[Index % Barks.Num()];
-	Index = (Index + 1) % Barks.Num();
+	// Round-robin selection (cursor is per NPC, content is shared)
+	int32& Cursor = BarkCursors[static_cast<int32>(Category)];
+	const FRfsnInstantBarkEntry& Bark = Barks[Cursor % Barks.Num()];
+	Cursor = (Cursor + 1) % Barks.Num();
 
 	return Bark;
 }
@@ -31,8 +31,9 @@ void URfsnLipSync::BeginPlay()
 		SetupDefaultMappings();
 	}
 
-	// Initialize viseme weights
+	// Initialize viseme weights and resolve morph channels once
 	ResetVisemeWeights();
+	RefreshMorphTargets();
 
 	RFSN_LOG(TEXT("LipSync initialized for %s"), *GetOwner()->GetName());
 }
@@ -41,6 +42,12 @@ void URfsnLipSync::TickComponent(float DeltaTime, ELevelTick TickType, FActorCom
 {
 	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
 
+	// TTS clips carry their own analysis; start automatically when one plays
+	if (!CurrentState.bIsPlaying && TtsComponent && TtsComponent->IsPlaying())
+	{
+		CurrentState.bIsPlaying = true;
+	}
+
 	if (!CurrentState.bIsPlaying)
 	{
 		// Decay to silence
@@ -70,10 +77,9 @@ void URfsnLipSync::TickComponent(float DeltaTime, ELevelTick TickType, FActorCom
 	// Generate viseme if not using simple mode
 	if (!bUseSimpleMode)
 	{
-		ERfsnViseme NewViseme = GeneratePseudoViseme();
+		ERfsnViseme NewViseme = bHasTrackSample ? TrackViseme : GeneratePseudoViseme();
 		if (NewViseme != CurrentState.CurrentViseme)
 		{
-			ERfsnViseme OldViseme = CurrentState.CurrentViseme;
 			CurrentState.CurrentViseme = NewViseme;
 			OnVisemeChanged.Broadcast(NewViseme);
 		}
@@ -121,35 +127,71 @@ void URfsnLipSync::ApplyToMesh()
 		return;
 	}
 
+	if (MorphBatch.Num() == 0)
+	{
+		RefreshMorphTargets();
+	}
+
+	MorphBatch.ClearTargets();
+
 	// Apply jaw opening
-	TargetMesh->SetMorphTarget(JawOpenMorphTarget, CurrentState.JawOpen);
+	MorphBatch.MaxTarget(JawChannel, CurrentState.JawOpen);
 
 	if (bUseSimpleMode)
 	{
 		// Simple mode: just use amplitude for basic open/close
 		// Apply to common lip shapes
-		TargetMesh->SetMorphTarget(FName("MouthOpen"), CurrentState.JawOpen);
-		TargetMesh->SetMorphTarget(FName("AA"), CurrentState.JawOpen * 0.8f);
+		MorphBatch.MaxTarget(MouthOpenChannel, CurrentState.JawOpen);
+		MorphBatch.MaxTarget(SimpleAAChannel, CurrentState.JawOpen * 0.8f);
 	}
 	else
 	{
 		// Viseme mode: blend between viseme shapes
-		for (auto& Pair : VisemeWeights)
+		const float DeltaSeconds = GetWorld()->GetDeltaSeconds();
+		for (int32 i = 0; i < NumVisemes; i++)
 		{
-			float TargetWeight = (Pair.Key == CurrentState.CurrentViseme) ? 1.0f : 0.0f;
-			Pair.Value = FMath::FInterpTo(Pair.Value, TargetWeight, GetWorld()->GetDeltaSeconds(), VisemeChangeSpeed);
+			float TargetWeight = (i == static_cast<int32>(CurrentState.CurrentViseme)) ? 1.0f : 0.0f;
+			VisemeWeights[i] = FMath::FInterpTo(VisemeWeights[i], TargetWeight, DeltaSeconds, VisemeChangeSpeed);
 		}
 
-		// Apply all viseme weights
-		for (const FRfsnVisemeMapping& Mapping : VisemeMappings)
+		for (int32 i = 0; i < VisemeMappings.Num() && i < MappingChannels.Num(); i++)
 		{
-			float* Weight = VisemeWeights.Find(Mapping.Viseme);
-			if (Weight)
-			{
-				TargetMesh->SetMorphTarget(Mapping.MorphTargetName, (*Weight) * Mapping.WeightMultiplier);
-			}
+			const FRfsnVisemeMapping& Mapping = VisemeMappings[i];
+			MorphBatch.MaxTarget(MappingChannels[i],
+			                     VisemeWeights[static_cast<int32>(Mapping.Viseme)] * Mapping.WeightMultiplier);
 		}
 	}
+
+	// Write only the morphs that visibly changed
+	USkeletalMeshComponent* Mesh = TargetMesh;
+	MorphUpdatesThisWindow += MorphBatch.Flush(MorphUpdateEpsilon, [Mesh](FName MorphTarget, float Weight)
+	                                           { Mesh->SetMorphTarget(MorphTarget, Weight); });
+
+	MorphWindowTime += GetWorld()->GetDeltaSeconds();
+	if (MorphWindowTime >= 1.0f)
+	{
+		MorphUpdatesPerSecond = MorphUpdatesThisWindow / MorphWindowTime;
+		MorphUpdatesThisWindow = 0;
+		MorphWindowTime = 0.0f;
+	}
+}
+
+void URfsnLipSync::RefreshMorphTargets()
+{
+	MorphBatch.Reset();
+	MappingChannels.Reset(VisemeMappings.Num());
+
+	JawChannel = MorphBatch.AddChannel(JawOpenMorphTarget);
+	MouthOpenChannel = MorphBatch.AddChannel(FName("MouthOpen"));
+	SimpleAAChannel = MorphBatch.AddChannel(FName("AA"));
+
+	for (const FRfsnVisemeMapping& Mapping : VisemeMappings)
+	{
+		MappingChannels.Add(MorphBatch.AddChannel(Mapping.MorphTargetName));
+	}
+
+	// Mesh state is unknown after a rebuild; write everything once
+	MorphBatch.Invalidate();
 }
 
 void URfsnLipSync::SetupDefaultMappings()
@@ -181,10 +223,18 @@ void URfsnLipSync::SetupDefaultMappings()
 	AddMapping(ERfsnViseme::MBP, FName("MBP"), 1.0f);
 	AddMapping(ERfsnViseme::TH, FName("TH"), 0.8f);
 	AddMapping(ERfsnViseme::WQ, FName("WQ"), 0.9f);
+
+	RefreshMorphTargets();
 }
 
 void URfsnLipSync::UpdateAmplitude()
 {
+	// Prefer the analyzed envelope of the clip actually playing
+	if (SampleTtsTrack())
+	{
+		return;
+	}
+
 	if (!AudioSource || !AudioSource->IsPlaying())
 	{
 		CurrentState.Amplitude = 0.0f;
@@ -192,14 +242,8 @@ void URfsnLipSync::UpdateAmplitude()
 		return;
 	}
 
-	// Get audio envelope/amplitude
-	// In a real implementation, you'd analyze the audio buffer
-	// For now, we simulate with randomized amplitude when playing
-
-	// Check if we can get real audio data
-	// UE5 provides audio analysis through the AudioMixer module
-
-	// Fallback: generate pseudo-random amplitude based on time
+	// Non-TTS audio source (no PCM to analyze):
+	// generate pseudo-random amplitude based on time
 	// This creates a natural-looking mouth movement
 	float Time = GetWorld()->GetTimeSeconds();
 	float BaseAmplitude = 0.5f + 0.5f * FMath::Sin(Time * 15.0f);
@@ -208,6 +252,29 @@ void URfsnLipSync::UpdateAmplitude()
 	CurrentState.Amplitude = FMath::Clamp(BaseAmplitude + Variation, 0.0f, 1.0f);
 }
 
+bool URfsnLipSync::SampleTtsTrack()
+{
+	bHasTrackSample = false;
+
+	if (!TtsComponent || !TtsComponent->IsPlaying())
+	{
+		return false;
+	}
+
+	float Amplitude = 0.0f;
+	ERfsnViseme Viseme = ERfsnViseme::Silence;
+	if (!TtsComponent->SampleLipSync(Amplitude, Viseme))
+	{
+		// Analysis still running or failed for this clip; let the baseline animation drive the mouth
+		return false;
+	}
+
+	CurrentState.Amplitude = Amplitude;
+	TrackViseme = Viseme;
+	bHasTrackSample = true;
+	return true;
+}
+
 ERfsnViseme URfsnLipSync::GeneratePseudoViseme() const
 {
 	// Generate pseudo-viseme based on amplitude pattern
@@ -247,21 +314,10 @@ ERfsnViseme URfsnLipSync::GeneratePseudoViseme() const
 
 void URfsnLipSync::ResetVisemeWeights()
 {
-	VisemeWeights.Empty();
-
-	VisemeWeights.Add(ERfsnViseme::Silence, 1.0f);
-	VisemeWeights.Add(ERfsnViseme::AA, 0.0f);
-	VisemeWeights.Add(ERfsnViseme::AO, 0.0f);
-	VisemeWeights.Add(ERfsnViseme::EE, 0.0f);
-	VisemeWeights.Add(ERfsnViseme::EH, 0.0f);
-	VisemeWeights.Add(ERfsnViseme::IH, 0.0f);
-	VisemeWeights.Add(ERfsnViseme::OH, 0.0f);
-	VisemeWeights.Add(ERfsnViseme::OO, 0.0f);
-	VisemeWeights.Add(ERfsnViseme::UH, 0.0f);
-	VisemeWeights.Add(ERfsnViseme::CDG, 0.0f);
-	VisemeWeights.Add(ERfsnViseme::FV, 0.0f);
-	VisemeWeights.Add(ERfsnViseme::L, 0.0f);
-	VisemeWeights.Add(ERfsnViseme::MBP, 0.0f);
-	VisemeWeights.Add(ERfsnViseme::TH, 0.0f);
-	VisemeWeights.Add(ERfsnViseme::WQ, 0.0f);
+	for (float& Weight : VisemeWeights)
+	{
+		Weight = 0.0f;
+	}
+
+	VisemeWeights[static_cast<int32>(ERfsnViseme::Silence)] = 1.0f;
 }
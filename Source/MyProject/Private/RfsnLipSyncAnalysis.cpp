@@ -0,0 +1,241 @@
+// RFSN Lip Sync Analysis Implementation
+
+#include "RfsnLipSyncAnalysis.h"
+#include "RfsnLipSync.h"
+
+// ─────────────────────────────────────────────────────────────
+// FRfsnLipSyncTrack
+// ─────────────────────────────────────────────────────────────
+
+void FRfsnLipSyncTrack::Sample(float Time, float& OutAmplitude, ERfsnViseme& OutViseme) const
+{
+	OutAmplitude = 0.0f;
+	OutViseme = ERfsnViseme::Silence;
+
+	const int32 Frames = Envelope.Num();
+	if (Frames == 0 || Time < 0.0f || Time >= Duration)
+	{
+		return;
+	}
+
+	const float FrameTime = Time * FrameRate;
+	const int32 Frame = FMath::Clamp(FMath::FloorToInt(FrameTime), 0, Frames - 1);
+	const int32 NextFrame = FMath::Min(Frame + 1, Frames - 1);
+	const float Alpha = FMath::Clamp(FrameTime - Frame, 0.0f, 1.0f);
+
+	OutAmplitude = FMath::Lerp(Envelope[Frame], Envelope[NextFrame], Alpha);
+	OutViseme = Visemes[Alpha < 0.5f ? Frame : NextFrame];
+}
+
+// ─────────────────────────────────────────────────────────────
+// FRfsnLipSyncAnalyzer
+// ─────────────────────────────────────────────────────────────
+
+namespace RfsnLipSyncAnalysis
+{
+/** Per-frame features */
+struct FFrameFeatures
+{
+	float Rms = 0.0f;
+
+	/** Zero crossings expressed as an approximate dominant frequency (Hz) */
+	float ZeroCrossingHz = 0.0f;
+};
+
+/** Envelope smoothing: open fast, close slower (matches how jaws actually move) */
+constexpr float AttackRate = 0.6f;
+constexpr float ReleaseRate = 0.25f;
+
+/** Unvoiced noise above this crossing rate is treated as a fricative */
+constexpr float FricativeHz = 2500.0f;
+constexpr float SibilantHz = 4000.0f;
+
+/** Silence runs up to this many frames between sounds read as lip closures (m, b, p) */
+constexpr int32 MaxClosureFrames = 4;
+
+ERfsnViseme ClassifyFrame(float Level, float ZeroCrossingHz)
+{
+	if (Level < FRfsnLipSyncAnalyzer::SilenceThreshold)
+	{
+		return ERfsnViseme::Silence;
+	}
+
+	// Noisy, high crossing rate, comparatively quiet: fricatives
+	if (ZeroCrossingHz > FricativeHz && Level < 0.6f)
+	{
+		return ZeroCrossingHz > SibilantHz ? ERfsnViseme::CDG : ERfsnViseme::FV;
+	}
+
+	// Voiced: low crossing rates are dark, rounded vowels; high rates are bright, spread vowels
+	if (ZeroCrossingHz < 400.0f)
+	{
+		return Level > 0.55f ? ERfsnViseme::OH : ERfsnViseme::OO;
+	}
+	if (ZeroCrossingHz < 900.0f)
+	{
+		return Level > 0.6f ? ERfsnViseme::AA : (Level > 0.35f ? ERfsnViseme::AO : ERfsnViseme::UH);
+	}
+	if (ZeroCrossingHz < 1600.0f)
+	{
+		return Level > 0.5f ? ERfsnViseme::EH : ERfsnViseme::IH;
+	}
+	return ERfsnViseme::EE;
+}
+} // namespace RfsnLipSyncAnalysis
+
+FRfsnLipSyncTrack FRfsnLipSyncAnalyzer::Analyze(const int16* Samples, int32 NumSamples, int32 SampleRate)
+{
+	using namespace RfsnLipSyncAnalysis;
+
+	FRfsnLipSyncTrack Track;
+	if (!Samples || NumSamples <= 0 || SampleRate <= 0)
+	{
+		return Track;
+	}
+
+	Track.Duration = static_cast<float>(NumSamples) / SampleRate;
+
+	const int32 HopSamples = FMath::Max(1, FMath::RoundToInt(SampleRate / Track.FrameRate));
+	const int32 NumFrames = FMath::DivideAndRoundUp(NumSamples, HopSamples);
+
+	// Pass 1: features and clip peak
+	TArray<FFrameFeatures> Features;
+	Features.SetNumUninitialized(NumFrames);
+	float PeakRms = 0.0f;
+
+	for (int32 Frame = 0; Frame < NumFrames; Frame++)
+	{
+		const int32 Start = Frame * HopSamples;
+		const int32 End = FMath::Min(Start + HopSamples, NumSamples);
+		const int32 Count = End - Start;
+
+		double Energy = 0.0;
+		int32 Crossings = 0;
+		for (int32 i = Start; i < End; i++)
+		{
+			const float Sample = Samples[i] / 32768.0f;
+			Energy += Sample * Sample;
+
+			if (i > Start && ((Samples[i] >= 0) != (Samples[i - 1] >= 0)))
+			{
+				Crossings++;
+			}
+		}
+
+		FFrameFeatures& F = Features[Frame];
+		F.Rms = static_cast<float>(FMath::Sqrt(Energy / Count));
+		F.ZeroCrossingHz = Count > 1 ? 0.5f * Crossings * SampleRate / (Count - 1) : 0.0f;
+		PeakRms = FMath::Max(PeakRms, F.Rms);
+	}
+
+	// Pass 2: normalized, smoothed envelope and per-frame classification
+	Track.Envelope.SetNumUninitialized(NumFrames);
+	Track.Visemes.SetNumUninitialized(NumFrames);
+
+	const float InvPeak = PeakRms > KINDA_SMALL_NUMBER ? 1.0f / PeakRms : 0.0f;
+	float Level = 0.0f;
+
+	for (int32 Frame = 0; Frame < NumFrames; Frame++)
+	{
+		const float Raw = FMath::Clamp(Features[Frame].Rms * InvPeak, 0.0f, 1.0f);
+		Level += (Raw - Level) * (Raw > Level ? AttackRate : ReleaseRate);
+
+		Track.Envelope[Frame] = Level;
+		Track.Visemes[Frame] = ClassifyFrame(Raw, Features[Frame].ZeroCrossingHz);
+	}
+
+	// Pass 3: short gaps between sounds are closures, not silence
+	for (int32 Frame = 1; Frame < NumFrames; Frame++)
+	{
+		if (Track.Visemes[Frame] != ERfsnViseme::Silence || Track.Visemes[Frame - 1] == ERfsnViseme::Silence)
+		{
+			continue;
+		}
+
+		int32 RunEnd = Frame;
+		while (RunEnd < NumFrames && Track.Visemes[RunEnd] == ERfsnViseme::Silence)
+		{
+			RunEnd++;
+		}
+
+		if (RunEnd < NumFrames && RunEnd - Frame <= MaxClosureFrames)
+		{
+			for (int32 i = Frame; i < RunEnd; i++)
+			{
+				Track.Visemes[i] = ERfsnViseme::MBP;
+			}
+		}
+		Frame = RunEnd;
+	}
+
+	// Pass 4: hold each viseme for a minimum time so the mouth doesn't flicker
+	ERfsnViseme Current = Track.Visemes[0];
+	int32 HeldFor = 1;
+	for (int32 Frame = 1; Frame < NumFrames; Frame++)
+	{
+		ERfsnViseme& Viseme = Track.Visemes[Frame];
+		if (Viseme == Current)
+		{
+			HeldFor++;
+		}
+		else if (HeldFor < MinHoldFrames && Viseme != ERfsnViseme::Silence)
+		{
+			Viseme = Current;
+			HeldFor++;
+		}
+		else
+		{
+			Current = Viseme;
+			HeldFor = 1;
+		}
+	}
+
+	return Track;
+}
+
+FRfsnLipSyncTrack FRfsnLipSyncAnalyzer::AnalyzeBytes(const TArray<uint8>& PCMData, int32 SampleRate)
+{
+	// 16-bit little-endian, as delivered by the TTS backends
+	return Analyze(reinterpret_cast<const int16*>(PCMData.GetData()), PCMData.Num() / 2, SampleRate);
+}
+
+// ─────────────────────────────────────────────────────────────
+// FRfsnMorphTargetBatch
+// ─────────────────────────────────────────────────────────────
+
+void FRfsnMorphTargetBatch::Reset()
+{
+	Names.Reset();
+	Pending.Reset();
+	Applied.Reset();
+}
+
+int32 FRfsnMorphTargetBatch::AddChannel(FName MorphTarget)
+{
+	const int32 Existing = Names.IndexOfByKey(MorphTarget);
+	if (Existing != INDEX_NONE)
+	{
+		return Existing;
+	}
+
+	Names.Add(MorphTarget);
+	Pending.Add(0.0f);
+	Applied.Add(0.0f);
+	return Names.Num() - 1;
+}
+
+void FRfsnMorphTargetBatch::ClearTargets()
+{
+	for (float& Weight : Pending)
+	{
+		Weight = 0.0f;
+	}
+}
+
+void FRfsnMorphTargetBatch::Invalidate()
+{
+	for (float& Weight : Applied)
+	{
+		Weight = -1.0f;
+	}
+}
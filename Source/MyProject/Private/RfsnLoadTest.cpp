@@ -0,0 +1,732 @@
+// RFSN Load Test Implementation
+
+#include "RfsnLoadTest.h"
+#include "RfsnAmbientChatter.h"
+#include "RfsnBackstoryGenerator.h"
+#include "IslandDirectorSubsystem.h"
+#include "RfsnDirectorBridge.h"
+#include "RfsnEmotionBlend.h"
+#include "RfsnHttpPool.h"
+#include "RfsnInstantBark.h"
+#include "RfsnLipSync.h"
+#include "RfsnLogging.h"
+#include "RfsnNpcAwareness.h"
+#include "RfsnNpcBarks.h"
+#include "RfsnNpcClientComponent.h"
+#include "RfsnNpcDialogueTrigger.h"
+#include "RfsnNpcLookAt.h"
+#include "RfsnNpcMemory.h"
+#include "RfsnNpcNeeds.h"
+#include "RfsnNpcSchedule.h"
+#include "RfsnRelationshipDecay.h"
+#include "RfsnTemporalMemory.h"
+#include "RfsnTtsAudioComponent.h"
+#include "RfsnVoiceRouter.h"
+#include "RfsnWeatherReactions.h"
+#include "Components/SceneComponent.h"
+#include "Engine/GameInstance.h"
+#include "Engine/World.h"
+#include "GameFramework/Actor.h"
+#include "HAL/FileManager.h"
+#include "HAL/PlatformMemory.h"
+#include "Interfaces/IHttpResponse.h"
+#include "JsonObjectConverter.h"
+#include "Misc/App.h"
+#include "Misc/CommandLine.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Parse.h"
+#include "Misc/Paths.h"
+
+namespace RfsnLoadTest
+{
+const TCHAR* const Utterances[] = {
+    TEXT("Hello there."),
+    TEXT("Can you help me?"),
+    TEXT("I want to trade."),
+    TEXT("What happened to the camp?"),
+    TEXT("Goodbye for now."),
+};
+
+/** Nearest-rank percentile of an already sorted array */
+float Percentile(const TArray<float>& Sorted, float Percent)
+{
+	if (Sorted.Num() == 0)
+	{
+		return 0.0f;
+	}
+	const int32 Rank = FMath::CeilToInt(Percent / 100.0f * Sorted.Num());
+	return Sorted[FMath::Clamp(Rank - 1, 0, Sorted.Num() - 1)];
+}
+
+float ToMb(uint64 Bytes)
+{
+	return static_cast<float>(Bytes / (1024.0 * 1024.0));
+}
+
+/** Director runs hold the alert at a steady "alerted" level the director leaves alone, then overwhelm it */
+constexpr float DirectorBaselineAlert = 45.0f;
+constexpr float DirectorOverwhelmedAlert = 95.0f;
+} // namespace RfsnLoadTest
+
+// ─────────────────────────────────────────────────────────────
+// URfsnLoadTestProbe
+// ─────────────────────────────────────────────────────────────
+
+void URfsnLoadTestProbe::SyncReplayTurn()
+{
+	// A played session starts its own dialogues; each new start time is a new turn
+	URfsnNpcClientComponent* ClientPtr = Client.Get();
+	if (!bReplay || !ClientPtr || ClientPtr->GetDialogueStartTime() == SendTime)
+	{
+		return;
+	}
+
+	SendTime = ClientPtr->GetDialogueStartTime();
+	bInFlight = true;
+	bGotFirstToken = false;
+	if (URfsnLoadTest* LoadTest = Owner.Get())
+	{
+		LoadTest->RecordTurnStart();
+	}
+}
+
+void URfsnLoadTestProbe::HandleSentence(const FRfsnSentence& Sentence)
+{
+	SyncReplayTurn();
+	if (!bInFlight || bGotFirstToken)
+	{
+		return;
+	}
+
+	bGotFirstToken = true;
+	if (URfsnLoadTest* LoadTest = Owner.Get())
+	{
+		LoadTest->RecordFirstToken((FPlatformTime::Seconds() - SendTime) * 1000.0);
+	}
+}
+
+void URfsnLoadTestProbe::HandleComplete()
+{
+	SyncReplayTurn();
+	if (!bInFlight)
+	{
+		return;
+	}
+
+	bInFlight = false;
+	if (URfsnLoadTest* LoadTest = Owner.Get())
+	{
+		LoadTest->RecordTurn((FPlatformTime::Seconds() - SendTime) * 1000.0, true);
+	}
+}
+
+void URfsnLoadTestProbe::HandleError(const FString& ErrorMessage)
+{
+	SyncReplayTurn();
+	if (!bInFlight)
+	{
+		return;
+	}
+
+	bInFlight = false;
+	if (URfsnLoadTest* LoadTest = Owner.Get())
+	{
+		LoadTest->RecordTurn((FPlatformTime::Seconds() - SendTime) * 1000.0, false);
+	}
+}
+
+// ─────────────────────────────────────────────────────────────
+// URfsnLoadTest
+// ─────────────────────────────────────────────────────────────
+
+URfsnLoadTest::URfsnLoadTest()
+{
+	NpcClass = AActor::StaticClass();
+
+	// Everything an RFSN NPC normally carries (player-side HUD/log/camera components excluded)
+	ComponentClasses = {
+	    URfsnNpcClientComponent::StaticClass(), URfsnEmotionBlend::StaticClass(),
+	    URfsnBackstoryGenerator::StaticClass(), URfsnNpcMemory::StaticClass(),
+	    URfsnTemporalMemory::StaticClass(),     URfsnNpcAwareness::StaticClass(),
+	    URfsnNpcBarks::StaticClass(),           URfsnInstantBark::StaticClass(),
+	    URfsnAmbientChatter::StaticClass(),     URfsnNpcDialogueTrigger::StaticClass(),
+	    URfsnVoiceRouter::StaticClass(),        URfsnTtsAudioComponent::StaticClass(),
+	    URfsnLipSync::StaticClass(),            URfsnNpcLookAt::StaticClass(),
+	    URfsnNpcNeeds::StaticClass(),           URfsnNpcSchedule::StaticClass(),
+	    URfsnWeatherReactions::StaticClass(),   URfsnRelationshipDecay::StaticClass(),
+	};
+}
+
+void URfsnLoadTest::Deinitialize()
+{
+	if (bRunning && DirectorBridge && Director)
+	{
+		Director->AlertDecayRate = SavedAlertDecayRate;
+	}
+	DestroyNpcs();
+	bRunning = false;
+	Super::Deinitialize();
+}
+
+TStatId URfsnLoadTest::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(URfsnLoadTest, STATGROUP_Tickables);
+}
+
+bool URfsnLoadTest::StartLoadTest(int32 NpcCount, float DurationSeconds)
+{
+	if (!bRunning)
+	{
+		ReplaySession.Reset();
+		ReplaySessionPath.Reset();
+	}
+	return BeginRun(NpcCount, DurationSeconds);
+}
+
+bool URfsnLoadTest::StartReplayTest(const FString& SessionPath, int32 NpcCount, float DurationSeconds, float Speed)
+{
+	if (bRunning)
+	{
+		return BeginRun(NpcCount, DurationSeconds);
+	}
+
+	TSharedPtr<FRfsnStreamSession> Session = MakeShared<FRfsnStreamSession>();
+	if (!Session->LoadFromFile(SessionPath) || Session->IsEmpty())
+	{
+		RFSN_WARNING(TEXT("LoadTest: cannot replay %s (missing, empty or not a session)"), *SessionPath);
+		return false;
+	}
+
+	ReplaySession = Session;
+	ReplaySessionPath = SessionPath;
+	ReplaySpeed = FMath::Max(Speed, 0.0f);
+	RFSN_LOG(TEXT("LoadTest: replaying %s (%d events over %.1fs, speed %.2f)"), *SessionPath, Session->Events.Num(),
+	         Session->GetDurationUs() / 1000000.0, ReplaySpeed);
+	return BeginRun(NpcCount, DurationSeconds);
+}
+
+bool URfsnLoadTest::BeginRun(int32 NpcCount, float DurationSeconds)
+{
+	UWorld* World = GetWorld();
+	if (bRunning || !World || NpcCount <= 0 || DurationSeconds <= 0.0f)
+	{
+		RFSN_WARNING(TEXT("LoadTest: cannot start (%s)"),
+		             bRunning ? TEXT("already running") : TEXT("invalid arguments"));
+		return false;
+	}
+
+	// CI can tighten or relax the budgets without a rebuild
+	FParse::Value(FCommandLine::Get(), TEXT("RfsnFrameBudgetMs="), FrameMsBudgetP95);
+	FParse::Value(FCommandLine::Get(), TEXT("RfsnMemoryBudgetMb="), MemoryBudgetMb);
+
+	Turns = Completed = Errors = PoolErrors = Playbacks = ReplayMismatches = 0;
+	FrameSamples.Reset();
+	FirstTokenSamples.Reset();
+	TurnSamples.Reset();
+	PoolSamples.Reset();
+
+	// Preallocate so sample collection doesn't show up in the memory figures
+	const int32 ExpectedFrames = FMath::CeilToInt(DurationSeconds * 120.0f);
+	const int32 ExpectedTurns = FMath::CeilToInt(NpcCount * (DurationSeconds / UtteranceInterval + 1.0f));
+	FrameSamples.Reserve(ExpectedFrames);
+	FirstTokenSamples.Reserve(ExpectedTurns);
+	TurnSamples.Reserve(ExpectedTurns);
+	PoolSamples.Reserve(FMath::CeilToInt(DurationSeconds / PoolRequestInterval) + 1);
+
+	StartMemory = FPlatformMemory::GetStats().UsedPhysical;
+
+	const double Now = FPlatformTime::Seconds();
+	for (int32 Index = 0; Index < NpcCount; Index++)
+	{
+		AActor* Npc = SpawnNpc(Index);
+		URfsnNpcClientComponent* Client = Npc ? Npc->FindComponentByClass<URfsnNpcClientComponent>() : nullptr;
+		if (!Client)
+		{
+			continue;
+		}
+
+		URfsnLoadTestProbe* Probe = NewObject<URfsnLoadTestProbe>(this);
+		Probe->Owner = this;
+		Probe->Client = Client;
+		Probe->NextSendTime = Now + FMath::FRandRange(0.0f, UtteranceInterval);
+		Probe->bReplay = ReplaySession.IsValid();
+		Client->OnSentenceReceived.AddDynamic(Probe, &URfsnLoadTestProbe::HandleSentence);
+		Client->OnDialogueComplete.AddDynamic(Probe, &URfsnLoadTestProbe::HandleComplete);
+		Client->OnError.AddDynamic(Probe, &URfsnLoadTestProbe::HandleError);
+
+		SpawnedNpcs.Add(Npc);
+		Probes.Add(Probe);
+	}
+
+	bRunning = true;
+	StartTime = Now;
+	EndTime = Now + DurationSeconds;
+	NextPoolRequestTime = Now;
+
+	RFSN_LOG(TEXT("LoadTest: started with %d/%d NPCs for %.0fs (%d components each, %s)"), Probes.Num(), NpcCount,
+	         DurationSeconds, ComponentClasses.Num(), ReplaySession.IsValid() ? TEXT("replay") : TEXT("live"));
+	return true;
+}
+
+AActor* URfsnLoadTest::SpawnNpc(int32 Index)
+{
+	UWorld* World = GetWorld();
+	UClass* Class = NpcClass ? NpcClass.Get() : AActor::StaticClass();
+
+	const float Half = SpawnArea * 0.5f;
+	const FVector Location(FMath::FRandRange(-Half, Half), FMath::FRandRange(-Half, Half), 0.0f);
+	const FRotator Rotation(0.0f, FMath::FRandRange(0.0f, 360.0f), 0.0f);
+
+	FActorSpawnParameters Params;
+	Params.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+	AActor* Npc = World->SpawnActor<AActor>(Class, Location, Rotation, Params);
+	if (!Npc)
+	{
+		return nullptr;
+	}
+
+	// A bare actor needs a root so location-based components have somewhere to be
+	if (!Npc->GetRootComponent())
+	{
+		USceneComponent* Root = NewObject<USceneComponent>(Npc, TEXT("Root"));
+		Npc->SetRootComponent(Root);
+		Root->RegisterComponent();
+		Npc->SetActorLocationAndRotation(Location, Rotation);
+	}
+
+	// Client first: other components look it up in BeginPlay
+	for (const TSubclassOf<UActorComponent>& ComponentClass : ComponentClasses)
+	{
+		if (!ComponentClass || Npc->FindComponentByClass(ComponentClass))
+		{
+			continue;
+		}
+
+		UActorComponent* Component = NewObject<UActorComponent>(Npc, ComponentClass);
+		if (URfsnNpcClientComponent* Client = Cast<URfsnNpcClientComponent>(Component))
+		{
+			Client->NpcId = FString::Printf(TEXT("loadtest_%04d"), Index);
+			Client->NpcName = FString::Printf(TEXT("LoadTest %d"), Index);
+			if (!OrchestratorUrl.IsEmpty())
+			{
+				Client->OrchestratorUrl = OrchestratorUrl;
+			}
+		}
+		Npc->AddInstanceComponent(Component);
+		Component->RegisterComponent();
+	}
+
+	return Npc;
+}
+
+void URfsnLoadTest::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	if (!bRunning)
+	{
+		return;
+	}
+
+	if (DirectorBridge)
+	{
+		TickDirector(FPlatformTime::Seconds());
+		return;
+	}
+
+	// Raw frame time (not dilated or clamped)
+	FrameSamples.Add(static_cast<float>(FApp::GetDeltaTime() * 1000.0));
+
+	const double Now = FPlatformTime::Seconds();
+	if (Now >= EndTime)
+	{
+		FinishLoadTest();
+		return;
+	}
+
+	// Replayed sessions need no orchestrator, so neither utterances nor pool requests are sent
+	if (ReplaySession.IsValid())
+	{
+		TickReplay(Now);
+		return;
+	}
+
+	for (URfsnLoadTestProbe* Probe : Probes)
+	{
+		URfsnNpcClientComponent* Client = Probe ? Probe->Client.Get() : nullptr;
+		if (!Client || Probe->bInFlight || Now < Probe->NextSendTime)
+		{
+			continue;
+		}
+
+		Probe->bInFlight = true;
+		Probe->bGotFirstToken = false;
+		Probe->SendTime = Now;
+		Probe->NextSendTime = Now + UtteranceInterval;
+		Turns++;
+
+		const int32 Pick = FMath::RandRange(0, static_cast<int32>(UE_ARRAY_COUNT(RfsnLoadTest::Utterances)) - 1);
+		Client->SendPlayerUtterance(RfsnLoadTest::Utterances[Pick]);
+	}
+
+	if (Now >= NextPoolRequestTime)
+	{
+		NextPoolRequestTime = Now + PoolRequestInterval;
+		IssuePoolRequest();
+	}
+}
+
+void URfsnLoadTest::TickReplay(double Now)
+{
+	for (URfsnLoadTestProbe* Probe : Probes)
+	{
+		URfsnNpcClientComponent* Client = Probe ? Probe->Client.Get() : nullptr;
+		if (!Client || Client->IsPlayingSession() || (Probe->Playbacks == 0 && Now < Probe->NextSendTime))
+		{
+			continue;
+		}
+
+		// A finished playback must have parsed exactly what the recording did
+		if (Probe->Playbacks > 0)
+		{
+			Playbacks++;
+			const FRfsnSessionTally& Played = Client->GetPlaybackTally();
+			const FRfsnSessionTally& Recorded = ReplaySession->Tally;
+			if (!(Played == Recorded))
+			{
+				ReplayMismatches++;
+				RFSN_WARNING(TEXT("LoadTest: %s replay mismatch: %d/%d/%d/%d dialogues/metas/sentences/errors, "
+				                  "recorded %d/%d/%d/%d"),
+				             *Client->NpcName, Played.Dialogues, Played.Metas, Played.Sentences, Played.Errors,
+				             Recorded.Dialogues, Recorded.Metas, Recorded.Sentences, Recorded.Errors);
+			}
+		}
+
+		Probe->Playbacks++;
+		Client->PlaySession(ReplaySession, ReplaySpeed);
+	}
+}
+
+void URfsnLoadTest::IssuePoolRequest()
+{
+	UGameInstance* GI = GetWorld() ? GetWorld()->GetGameInstance() : nullptr;
+	URfsnHttpPool* Pool = GI ? GI->GetSubsystem<URfsnHttpPool>() : nullptr;
+	if (!Pool)
+	{
+		return;
+	}
+
+	TSharedPtr<IHttpRequest, ESPMode::ThreadSafe> Request = Pool->CreateGetRequest(TEXT("/api/health"));
+	const double SentAt = FPlatformTime::Seconds();
+	TWeakObjectPtr<URfsnLoadTest> WeakThis(this);
+	TWeakObjectPtr<URfsnHttpPool> WeakPool(Pool);
+
+	Request->OnProcessRequestComplete().BindLambda(
+	    [WeakThis, WeakPool, SentAt](FHttpRequestPtr Req, FHttpResponsePtr Response, bool bSuccess)
+	    {
+		    const bool bOk = bSuccess && Response.IsValid() && Response->GetResponseCode() == 200;
+		    const float LatencyMs = static_cast<float>((FPlatformTime::Seconds() - SentAt) * 1000.0);
+
+		    if (URfsnHttpPool* PoolPtr = WeakPool.Get())
+		    {
+			    PoolPtr->OnRequestCompleted(bOk, LatencyMs, Response.IsValid() ? Response->GetContentLength() : 0);
+		    }
+
+		    URfsnLoadTest* LoadTest = WeakThis.Get();
+		    if (LoadTest && LoadTest->bRunning)
+		    {
+			    LoadTest->PoolSamples.Add(LatencyMs);
+			    LoadTest->PoolErrors += bOk ? 0 : 1;
+		    }
+	    });
+
+	Pool->OnRequestStarted();
+	Request->ProcessRequest();
+}
+
+void URfsnLoadTest::RecordTurn(double LatencyMs, bool bSuccess)
+{
+	if (bSuccess)
+	{
+		Completed++;
+		TurnSamples.Add(static_cast<float>(LatencyMs));
+	}
+	else
+	{
+		Errors++;
+	}
+}
+
+void URfsnLoadTest::StopLoadTest()
+{
+	if (bRunning && DirectorBridge)
+	{
+		FinishDirectorTest();
+	}
+	else if (bRunning)
+	{
+		FinishLoadTest();
+	}
+}
+
+void URfsnLoadTest::FinishLoadTest()
+{
+	using namespace RfsnLoadTest;
+
+	bRunning = false;
+
+	const FPlatformMemoryStats Memory = FPlatformMemory::GetStats();
+
+	FrameSamples.Sort();
+	FirstTokenSamples.Sort();
+	TurnSamples.Sort();
+	PoolSamples.Sort();
+
+	FRfsnLoadTestReport Report;
+	Report.NpcCount = Probes.Num();
+	Report.DurationSeconds = static_cast<float>(FPlatformTime::Seconds() - StartTime);
+	Report.Frames = FrameSamples.Num();
+	Report.FrameMsP50 = Percentile(FrameSamples, 50.0f);
+	Report.FrameMsP95 = Percentile(FrameSamples, 95.0f);
+	Report.FrameMsP99 = Percentile(FrameSamples, 99.0f);
+	Report.FrameMsMax = FrameSamples.Num() > 0 ? FrameSamples.Last() : 0.0f;
+	Report.Turns = Turns;
+	Report.Completed = Completed;
+	Report.Errors = Errors;
+	Report.FirstTokenMsP50 = Percentile(FirstTokenSamples, 50.0f);
+	Report.FirstTokenMsP95 = Percentile(FirstTokenSamples, 95.0f);
+	Report.FirstTokenMsP99 = Percentile(FirstTokenSamples, 99.0f);
+	Report.TurnMsP50 = Percentile(TurnSamples, 50.0f);
+	Report.TurnMsP95 = Percentile(TurnSamples, 95.0f);
+	Report.TurnMsP99 = Percentile(TurnSamples, 99.0f);
+	Report.PoolMsP50 = Percentile(PoolSamples, 50.0f);
+	Report.PoolMsP95 = Percentile(PoolSamples, 95.0f);
+	Report.PoolErrors = PoolErrors;
+	Report.MemoryDeltaMb = ToMb(Memory.UsedPhysical) - ToMb(StartMemory);
+	Report.PeakMemoryMb = ToMb(Memory.PeakUsedPhysical);
+	Report.Session = ReplaySessionPath;
+	Report.Playbacks = Playbacks;
+	Report.ReplayMismatches = ReplayMismatches;
+	Report.bWithinBudget = (FrameMsBudgetP95 <= 0.0f || Report.FrameMsP95 <= FrameMsBudgetP95) &&
+	                       (MemoryBudgetMb <= 0.0f || Report.MemoryDeltaMb <= MemoryBudgetMb);
+	LastReport = Report;
+
+	DestroyNpcs();
+
+	RFSN_LOG(TEXT("LoadTest: %d NPCs, %.1fs, %d frames"), Report.NpcCount, Report.DurationSeconds, Report.Frames);
+	RFSN_LOG(TEXT("LoadTest:   frame ms    p50 %.2f  p95 %.2f  p99 %.2f  max %.2f"), Report.FrameMsP50,
+	         Report.FrameMsP95, Report.FrameMsP99, Report.FrameMsMax);
+	RFSN_LOG(TEXT("LoadTest:   turns       %d sent, %d completed, %d errors"), Report.Turns, Report.Completed,
+	         Report.Errors);
+	RFSN_LOG(TEXT("LoadTest:   first token p50 %.0f  p95 %.0f  p99 %.0f ms"), Report.FirstTokenMsP50,
+	         Report.FirstTokenMsP95, Report.FirstTokenMsP99);
+	RFSN_LOG(TEXT("LoadTest:   full turn   p50 %.0f  p95 %.0f  p99 %.0f ms"), Report.TurnMsP50, Report.TurnMsP95,
+	         Report.TurnMsP99);
+	RFSN_LOG(TEXT("LoadTest:   http pool   p50 %.1f  p95 %.1f ms, %d errors"), Report.PoolMsP50, Report.PoolMsP95,
+	         Report.PoolErrors);
+	RFSN_LOG(TEXT("LoadTest:   memory      %+.1f MB (peak %.1f MB)"), Report.MemoryDeltaMb, Report.PeakMemoryMb);
+	if (!Report.Session.IsEmpty())
+	{
+		RFSN_LOG(TEXT("LoadTest:   replay      %d playbacks, %d mismatches"), Report.Playbacks,
+		         Report.ReplayMismatches);
+	}
+	if (!Report.bWithinBudget)
+	{
+		RFSN_WARNING(TEXT("LoadTest: over budget (frame p95 %.2f / %.2f ms, memory %+.1f / %.1f MB)"),
+		             Report.FrameMsP95, FrameMsBudgetP95, Report.MemoryDeltaMb, MemoryBudgetMb);
+	}
+
+	PublishReport(Report);
+}
+
+void URfsnLoadTest::PublishReport(const FRfsnLoadTestReport& Report)
+{
+	// Machine-readable copy for CI comparisons
+	FString Json;
+	if (FJsonObjectConverter::UStructToJsonObjectString(Report, Json))
+	{
+		const FString ReportPath = FPaths::ProfilingDir() / TEXT("RfsnLoadTest.json");
+		IFileManager::Get().MakeDirectory(*FPaths::GetPath(ReportPath), true);
+		FFileHelper::SaveStringToFile(Json, *ReportPath);
+		RFSN_LOG(TEXT("LoadTest: report written to %s"), *ReportPath);
+	}
+
+	OnLoadTestComplete.Broadcast(Report);
+
+	if (FParse::Param(FCommandLine::Get(), TEXT("RfsnLoadTestExit")))
+	{
+		const bool bPassed = Report.bWithinBudget && Report.ReplayMismatches == 0;
+		FPlatformMisc::RequestExitWithStatus(false, bPassed ? 0 : 1);
+	}
+}
+
+void URfsnLoadTest::DestroyNpcs()
+{
+	for (AActor* Npc : SpawnedNpcs)
+	{
+		if (IsValid(Npc))
+		{
+			Npc->Destroy();
+		}
+	}
+	SpawnedNpcs.Reset();
+	Probes.Reset();
+	DirectorBridge = nullptr;
+}
+
+// ─────────────────────────────────────────────────────────────
+// Director channel run
+// ─────────────────────────────────────────────────────────────
+
+bool URfsnLoadTest::StartDirectorTest(float DurationSeconds)
+{
+	UWorld* World = GetWorld();
+	UIslandDirectorSubsystem* WorldDirector = World ? World->GetSubsystem<UIslandDirectorSubsystem>() : nullptr;
+	if (bRunning || !WorldDirector || DurationSeconds <= 0.0f)
+	{
+		RFSN_WARNING(TEXT("LoadTest: cannot start director run (%s)"),
+		             bRunning ? TEXT("already running")
+		                      : (WorldDirector ? TEXT("invalid arguments") : TEXT("no director subsystem")));
+		return false;
+	}
+
+	FActorSpawnParameters Params;
+	Params.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+	AActor* BridgeActor = World->SpawnActor<AActor>(AActor::StaticClass(), FTransform::Identity, Params);
+	if (!BridgeActor)
+	{
+		return false;
+	}
+
+	// Started by hand in each phase, so the mode can be switched first
+	Director = WorldDirector;
+	DirectorBridge = NewObject<URfsnDirectorBridge>(BridgeActor);
+	DirectorBridge->bAutoPolling = false;
+	BridgeActor->AddInstanceComponent(DirectorBridge);
+	DirectorBridge->RegisterComponent();
+	DirectorBridge->OnDirectorCommand.AddDynamic(this, &URfsnLoadTest::HandleDirectorCommand);
+	SpawnedNpcs.Add(BridgeActor);
+
+	// Decay would move the alert between state checks and polls differently; only the script and commands move it
+	SavedAlertDecayRate = Director->AlertDecayRate;
+	Director->AlertDecayRate = 0.0f;
+
+	DirectorDuration = DurationSeconds;
+	DirectorLatencyMs[0] = DirectorLatencyMs[1] = -1.0f;
+	DirectorBytesPerMin[0] = DirectorBytesPerMin[1] = 0.0f;
+	bRunning = true;
+	StartTime = FPlatformTime::Seconds();
+	BeginDirectorPhase(false, StartTime);
+
+	RFSN_LOG(TEXT("LoadTest: director run, %.0fs over the channel (%s) then %.0fs polling (%s)"), DurationSeconds,
+	         *DirectorBridge->ChannelUrl, DurationSeconds, *DirectorBridge->DirectorUrl);
+	return true;
+}
+
+void URfsnLoadTest::BeginDirectorPhase(bool bPolling, double Now)
+{
+	DirectorBridge->StopPolling();
+	DirectorBridge->bUsePushChannel = !bPolling;
+	Director->AddAlert(RfsnLoadTest::DirectorBaselineAlert - Director->GetAlertLevel());
+
+	bDirectorPolling = bPolling;
+	bDirectorOverwhelmed = false;
+	PhaseStartTime = Now;
+	PhaseStartBytes = DirectorBridge->GetBytesSent();
+	EndTime = Now + DirectorDuration;
+
+	// Half a poll interval after the poll nearest the middle: polling's average wait, and never on a poll
+	const float PollInterval = DirectorBridge->PollInterval;
+	OverwhelmTime = Now + (FMath::FloorToDouble(DirectorDuration * 0.5 / PollInterval) + 0.5) * PollInterval;
+
+	DirectorBridge->StartPolling();
+}
+
+void URfsnLoadTest::TickDirector(double Now)
+{
+	if (!bDirectorOverwhelmed && Now >= OverwhelmTime && Now < EndTime)
+	{
+		bDirectorOverwhelmed = true;
+		OverwhelmTime = Now;
+		Director->AddAlert(RfsnLoadTest::DirectorOverwhelmedAlert - Director->GetAlertLevel());
+	}
+
+	if (Now < EndTime)
+	{
+		return;
+	}
+
+	const int32 Phase = bDirectorPolling ? 1 : 0;
+	DirectorBytesPerMin[Phase] =
+	    static_cast<float>((DirectorBridge->GetBytesSent() - PhaseStartBytes) * 60.0 / (Now - PhaseStartTime));
+	if (!bDirectorPolling && !DirectorBridge->IsChannelOpen())
+	{
+		RFSN_WARNING(TEXT("LoadTest: director channel was not open at the end of its phase (polling fallback)"));
+	}
+
+	if (bDirectorPolling)
+	{
+		FinishDirectorTest();
+	}
+	else
+	{
+		BeginDirectorPhase(true, Now);
+	}
+}
+
+void URfsnLoadTest::HandleDirectorCommand(const FString& CommandName)
+{
+	// Only the first respite after the overwhelm counts; later ones answer the director's own modifiers
+	const int32 Phase = bDirectorPolling ? 1 : 0;
+	if (bRunning && bDirectorOverwhelmed && CommandName == TEXT("respite") && DirectorLatencyMs[Phase] < 0.0f)
+	{
+		DirectorLatencyMs[Phase] = static_cast<float>((FPlatformTime::Seconds() - OverwhelmTime) * 1000.0);
+	}
+}
+
+void URfsnLoadTest::FinishDirectorTest()
+{
+	bRunning = false;
+	Director->AlertDecayRate = SavedAlertDecayRate;
+
+	// Stopped early: the phase under way is measured up to now
+	const double Now = FPlatformTime::Seconds();
+	const int32 Phase = bDirectorPolling ? 1 : 0;
+	if (DirectorBytesPerMin[Phase] == 0.0f && Now > PhaseStartTime)
+	{
+		DirectorBytesPerMin[Phase] =
+		    static_cast<float>((DirectorBridge->GetBytesSent() - PhaseStartBytes) * 60.0 / (Now - PhaseStartTime));
+	}
+
+	FRfsnLoadTestReport Report;
+	Report.DurationSeconds = static_cast<float>(Now - StartTime);
+	Report.DirectorChannelBytesPerMin = DirectorBytesPerMin[0];
+	Report.DirectorPollBytesPerMin = DirectorBytesPerMin[1];
+	Report.DirectorChannelLatencyMs = DirectorLatencyMs[0];
+	Report.DirectorPollLatencyMs = DirectorLatencyMs[1];
+
+	const float ChannelMs = Report.DirectorChannelLatencyMs;
+	const float PollMs = Report.DirectorPollLatencyMs;
+	Report.bWithinBudget = ChannelMs >= 0.0f &&
+	                       (DirectorLatencyBudgetMs <= 0.0f || ChannelMs <= DirectorLatencyBudgetMs) &&
+	                       (PollMs < 0.0f || ChannelMs < PollMs) &&
+	                       Report.DirectorChannelBytesPerMin < Report.DirectorPollBytesPerMin;
+	LastReport = Report;
+
+	DestroyNpcs();
+
+	RFSN_LOG(TEXT("LoadTest: director, %.1fs"), Report.DurationSeconds);
+	RFSN_LOG(TEXT("LoadTest:   channel     respite after %.0f ms, %.0f bytes/min"), ChannelMs,
+	         Report.DirectorChannelBytesPerMin);
+	RFSN_LOG(TEXT("LoadTest:   polling     respite after %.0f ms, %.0f bytes/min"), PollMs,
+	         Report.DirectorPollBytesPerMin);
+	if (!Report.bWithinBudget)
+	{
+		RFSN_WARNING(TEXT("LoadTest: director channel over budget (respite %.0f / %.0f ms, polling %.0f ms; "
+		                  "%.0f bytes/min, polling %.0f)"),
+		             ChannelMs, DirectorLatencyBudgetMs, PollMs, Report.DirectorChannelBytesPerMin,
+		             Report.DirectorPollBytesPerMin);
+	}
+
+	PublishReport(Report);
+}
@@ -0,0 +1,423 @@
+// RFSN Look-At Manager Implementation
+
+#include "RfsnLookAtManager.h"
+#include "RfsnNpcLookAt.h"
+#include "RfsnDialogueManager.h"
+#include "RfsnLogging.h"
+#include "Async/ParallelFor.h"
+#include "Engine/World.h"
+#include "GameFramework/Pawn.h"
+#include "Kismet/GameplayStatics.h"
+
+namespace RfsnLookAt
+{
+/** Head angles (degrees) close enough to centre to stop solving */
+constexpr float SettleAngle = 0.5f;
+
+FRfsnLookAtParams MakeParams(const URfsnNpcLookAt* LookAt)
+{
+	FRfsnLookAtParams Params;
+	Params.TurnSpeed = LookAt->RotationSpeed / 90.0f; // Convert to interp speed
+	Params.HeadOnlyAngle = LookAt->HeadOnlyAngle;
+	Params.MaxHeadPitch = LookAt->MaxHeadPitch;
+	Params.HeadSpeed = LookAt->HeadInterpSpeed;
+	Params.bRotateBody = LookAt->bRotateBody;
+	return Params;
+}
+} // namespace RfsnLookAt
+
+// ─────────────────────────────────────────────────────────────
+// FRfsnLookAtSolver
+// ─────────────────────────────────────────────────────────────
+
+int32 FRfsnLookAtSolver::Add(const FRfsnLookAtParams& Params)
+{
+	const int32 Index = BodyYaw.Add(0.0f);
+	for (TArray<float>* Array : {&OriginX, &OriginY, &OriginZ, &TargetX, &TargetY, &TargetZ, &TurnSpeed, &HeadOnlyAngle,
+	                             &MaxHeadPitch, &HeadSpeed, &HeadYaw, &HeadPitch, &AngleToTarget})
+	{
+		Array->Add(0.0f);
+	}
+	Flags.Add(FlagSettled);
+	SetParams(Index, Params);
+	return Index;
+}
+
+int32 FRfsnLookAtSolver::RemoveAtSwap(int32 Index)
+{
+	const int32 Last = Num() - 1;
+	for (TArray<float>* Array : {&OriginX, &OriginY, &OriginZ, &TargetX, &TargetY, &TargetZ, &TurnSpeed, &HeadOnlyAngle,
+	                             &MaxHeadPitch, &HeadSpeed, &BodyYaw, &HeadYaw, &HeadPitch, &AngleToTarget})
+	{
+		Array->RemoveAtSwap(Index, 1, EAllowShrinking::No);
+	}
+	Flags.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+	return Index < Last ? Last : INDEX_NONE;
+}
+
+void FRfsnLookAtSolver::SetParams(int32 Index, const FRfsnLookAtParams& Params)
+{
+	TurnSpeed[Index] = Params.TurnSpeed;
+	HeadOnlyAngle[Index] = Params.HeadOnlyAngle;
+	MaxHeadPitch[Index] = Params.MaxHeadPitch;
+	HeadSpeed[Index] = Params.HeadSpeed;
+	if (Params.bRotateBody)
+	{
+		Flags[Index] |= FlagRotateBody;
+	}
+	else
+	{
+		Flags[Index] &= static_cast<uint8>(~FlagRotateBody);
+	}
+}
+
+void FRfsnLookAtSolver::SetPose(int32 Index, const FVector& Origin, float InBodyYaw)
+{
+	OriginX[Index] = Origin.X;
+	OriginY[Index] = Origin.Y;
+	OriginZ[Index] = Origin.Z;
+	BodyYaw[Index] = InBodyYaw;
+}
+
+void FRfsnLookAtSolver::SetTarget(int32 Index, const FVector& Target)
+{
+	TargetX[Index] = Target.X;
+	TargetY[Index] = Target.Y;
+	TargetZ[Index] = Target.Z;
+	Flags[Index] = static_cast<uint8>((Flags[Index] | FlagHasTarget) & ~FlagSettled);
+}
+
+void FRfsnLookAtSolver::ClearTarget(int32 Index)
+{
+	Flags[Index] &= static_cast<uint8>(~FlagHasTarget);
+}
+
+void FRfsnLookAtSolver::Solve(float DeltaTime, bool bParallel, int32 MinBatch)
+{
+	const int32 Count = Num();
+	const int32 NumBatches = bParallel ? FMath::Max(Count / FMath::Max(MinBatch, 1), 1) : 1;
+	if (NumBatches == 1)
+	{
+		SolveRange(0, Count, DeltaTime);
+		return;
+	}
+
+	// Entries are independent, so batches only need disjoint ranges
+	const int32 BatchSize = FMath::DivideAndRoundUp(Count, NumBatches);
+	ParallelFor(NumBatches,
+	            [this, Count, BatchSize, DeltaTime](int32 Batch)
+	            {
+		            const int32 Begin = Batch * BatchSize;
+		            SolveRange(Begin, FMath::Min(Begin + BatchSize, Count), DeltaTime);
+	            });
+}
+
+void FRfsnLookAtSolver::SolveRange(int32 Begin, int32 End, float DeltaTime)
+{
+	for (int32 i = Begin; i < End; i++)
+	{
+		float YawGoal = 0.0f;
+		float PitchGoal = 0.0f;
+		uint8 Flag = Flags[i] & static_cast<uint8>(~(FlagTurning | FlagSettled));
+
+		if (Flag & FlagHasTarget)
+		{
+			// FindLookAtRotation from the NPC's origin
+			const float DX = TargetX[i] - OriginX[i];
+			const float DY = TargetY[i] - OriginY[i];
+			const float DZ = TargetZ[i] - OriginZ[i];
+			const float PlanarSq = DX * DX + DY * DY;
+			const float TargetYaw = FMath::RadiansToDegrees(FMath::Atan2(DY, DX));
+			const float TargetPitch = FMath::RadiansToDegrees(FMath::Atan2(DZ, FMath::Sqrt(PlanarSq)));
+
+			// Straight above or below there is no horizontal direction: the old forward-dot-target gave 90
+			float Delta = FMath::UnwindDegrees(TargetYaw - BodyYaw[i]);
+			AngleToTarget[i] = PlanarSq > UE_SMALL_NUMBER ? FMath::Abs(Delta) : 90.0f;
+
+			if ((Flag & FlagRotateBody) && AngleToTarget[i] > HeadOnlyAngle[i])
+			{
+				// RInterpTo on yaw alone
+				Flag |= FlagTurning;
+				if (DeltaTime != 0.0f && FMath::Abs(Delta) > UE_KINDA_SMALL_NUMBER)
+				{
+					const float Alpha = TurnSpeed[i] > 0.0f ? FMath::Clamp(DeltaTime * TurnSpeed[i], 0.0f, 1.0f) : 1.0f;
+					BodyYaw[i] = FMath::UnwindDegrees(BodyYaw[i] + Delta * Alpha);
+					Delta = FMath::UnwindDegrees(TargetYaw - BodyYaw[i]);
+				}
+			}
+
+			YawGoal = FMath::Clamp(Delta, -HeadOnlyAngle[i], HeadOnlyAngle[i]);
+			PitchGoal = FMath::Clamp(TargetPitch, -MaxHeadPitch[i], MaxHeadPitch[i]);
+		}
+		else
+		{
+			AngleToTarget[i] = 0.0f;
+		}
+
+		HeadYaw[i] = FMath::FInterpTo(HeadYaw[i], YawGoal, DeltaTime, HeadSpeed[i]);
+		HeadPitch[i] = FMath::FInterpTo(HeadPitch[i], PitchGoal, DeltaTime, HeadSpeed[i]);
+
+		if (!(Flag & FlagHasTarget) && FMath::Abs(HeadYaw[i]) < RfsnLookAt::SettleAngle &&
+		    FMath::Abs(HeadPitch[i]) < RfsnLookAt::SettleAngle)
+		{
+			Flag |= FlagSettled;
+		}
+		Flags[i] = Flag;
+	}
+}
+
+// ─────────────────────────────────────────────────────────────
+// URfsnLookAtManager
+// ─────────────────────────────────────────────────────────────
+
+void URfsnLookAtManager::OnWorldBeginPlay(UWorld& InWorld)
+{
+	Super::OnWorldBeginPlay(InWorld);
+
+	DialogueManager = InWorld.GetSubsystem<URfsnDialogueManager>();
+	if (URfsnDialogueManager* Dialogue = DialogueManager.Get())
+	{
+		Dialogue->OnDialogueStarted.AddDynamic(this, &URfsnLookAtManager::HandleDialogueStarted);
+		Dialogue->OnDialogueEnded.AddDynamic(this, &URfsnLookAtManager::HandleDialogueEnded);
+	}
+}
+
+void URfsnLookAtManager::Deinitialize()
+{
+	if (URfsnDialogueManager* Dialogue = DialogueManager.Get())
+	{
+		Dialogue->OnDialogueStarted.RemoveDynamic(this, &URfsnLookAtManager::HandleDialogueStarted);
+		Dialogue->OnDialogueEnded.RemoveDynamic(this, &URfsnLookAtManager::HandleDialogueEnded);
+	}
+	DialogueManager.Reset();
+	DialogueLookAt.Reset();
+
+	Entries.Empty();
+	Solver = FRfsnLookAtSolver();
+	AwakeHandles.Empty();
+	Super::Deinitialize();
+}
+
+TStatId URfsnLookAtManager::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(URfsnLookAtManager, STATGROUP_Tickables);
+}
+
+int32 URfsnLookAtManager::Register(URfsnNpcLookAt* LookAt)
+{
+	if (!LookAt)
+	{
+		return INDEX_NONE;
+	}
+
+	FEntry Entry;
+	Entry.Component = LookAt;
+	return Entries.Add(Entry);
+}
+
+void URfsnLookAtManager::Unregister(int32 Handle)
+{
+	if (!Entries.IsValidIndex(Handle))
+	{
+		return;
+	}
+
+	Sleep(Handle);
+	Entries.RemoveAt(Handle);
+}
+
+void URfsnLookAtManager::Wake(int32 Handle)
+{
+	FEntry& Entry = Entries[Handle];
+	const URfsnNpcLookAt* LookAt = Entry.Component.Get();
+	if (!LookAt)
+	{
+		return;
+	}
+
+	// Settings are read whenever a target is assigned
+	const FRfsnLookAtParams Params = RfsnLookAt::MakeParams(LookAt);
+	if (Entry.Awake == INDEX_NONE)
+	{
+		Entry.Awake = Solver.Add(Params);
+		AwakeHandles.Add(Handle);
+	}
+	else
+	{
+		Solver.SetParams(Entry.Awake, Params);
+	}
+	Solver.SetTarget(Entry.Awake, Entry.TargetLocation);
+}
+
+void URfsnLookAtManager::Sleep(int32 Handle)
+{
+	FEntry& Entry = Entries[Handle];
+	const int32 Index = Entry.Awake;
+	if (Index == INDEX_NONE)
+	{
+		return;
+	}
+
+	Entry.Awake = INDEX_NONE;
+	AwakeHandles.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+	if (Solver.RemoveAtSwap(Index) != INDEX_NONE)
+	{
+		Entries[AwakeHandles[Index]].Awake = Index;
+	}
+}
+
+void URfsnLookAtManager::SetTargetActor(int32 Handle, AActor* Target)
+{
+	if (!Entries.IsValidIndex(Handle) || !Target)
+	{
+		return;
+	}
+
+	FEntry& Entry = Entries[Handle];
+	Entry.Target = ETarget::Actor;
+	Entry.TargetActor = Target;
+	Entry.TargetLocation = Target->GetActorLocation();
+	Wake(Handle);
+}
+
+void URfsnLookAtManager::SetTargetLocation(int32 Handle, const FVector& Location)
+{
+	if (!Entries.IsValidIndex(Handle))
+	{
+		return;
+	}
+
+	FEntry& Entry = Entries[Handle];
+	Entry.Target = ETarget::Location;
+	Entry.TargetActor.Reset();
+	Entry.TargetLocation = Location;
+	Wake(Handle);
+}
+
+void URfsnLookAtManager::SetTargetPlayer(int32 Handle)
+{
+	if (!Entries.IsValidIndex(Handle))
+	{
+		return;
+	}
+
+	FEntry& Entry = Entries[Handle];
+	Entry.Target = ETarget::Player;
+	Entry.TargetActor.Reset();
+	const APawn* Player = UGameplayStatics::GetPlayerPawn(GetWorld(), 0);
+	const URfsnNpcLookAt* LookAt = Entry.Component.Get();
+	if (Player && LookAt)
+	{
+		Entry.TargetLocation = Player->GetActorLocation();
+		Entry.TargetLocation.Z += LookAt->EyeHeightOffset;
+	}
+	Wake(Handle);
+}
+
+void URfsnLookAtManager::ClearTarget(int32 Handle)
+{
+	if (!Entries.IsValidIndex(Handle))
+	{
+		return;
+	}
+
+	FEntry& Entry = Entries[Handle];
+	Entry.Target = ETarget::None;
+	Entry.TargetActor.Reset();
+	if (Entry.Awake != INDEX_NONE)
+	{
+		Solver.ClearTarget(Entry.Awake);
+	}
+}
+
+void URfsnLookAtManager::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	const APawn* Player = UGameplayStatics::GetPlayerPawn(GetWorld(), 0);
+
+	// Gather: poses and moving targets, on the game thread
+	const int32 Count = Solver.Num();
+	Skipped.Init(false, Count);
+	for (int32 Index = 0; Index < Count; Index++)
+	{
+		FEntry& Entry = Entries[AwakeHandles[Index]];
+		const URfsnNpcLookAt* LookAt = Entry.Component.Get();
+		const AActor* Owner = LookAt ? LookAt->GetOwner() : nullptr;
+		if (!Owner || !LookAt->bEnabled)
+		{
+			Skipped[Index] = true;
+			continue;
+		}
+
+		Solver.SetPose(Index, Owner->GetActorLocation(), Owner->GetActorRotation().Yaw);
+
+		// A target actor that is gone leaves the last location it was seen at
+		const AActor* Tracked = Entry.Target == ETarget::Actor ? Entry.TargetActor.Get() : nullptr;
+		Tracked = Entry.Target == ETarget::Player ? Player : Tracked;
+		if (Tracked)
+		{
+			Entry.TargetLocation = Tracked->GetActorLocation();
+			Entry.TargetLocation.Z += LookAt->EyeHeightOffset; // Eye level
+			Solver.SetTarget(Index, Entry.TargetLocation);
+		}
+	}
+
+	Solver.Solve(DeltaTime, bSolveInParallel, ParallelBatchSize);
+
+	// Apply, then let the NPCs whose heads are back at centre (or that were disabled) sleep
+	for (int32 Index = Count - 1; Index >= 0; Index--)
+	{
+		const int32 Handle = AwakeHandles[Index];
+		URfsnNpcLookAt* LookAt = Entries[Handle].Component.Get();
+		if (!LookAt)
+		{
+			Unregister(Handle);
+			continue;
+		}
+		if (Skipped[Index])
+		{
+			// A disabled NPC drops its target and sleeps instead of holding a solver slot; a new target wakes it
+			LookAt->StopLooking();
+			Sleep(Handle);
+			continue;
+		}
+
+		if (Solver.IsTurningBody(Index))
+		{
+			AActor* Owner = LookAt->GetOwner();
+			FRotator Rotation = Owner->GetActorRotation();
+			Rotation.Yaw = Solver.GetBodyYaw(Index);
+			Owner->SetActorRotation(Rotation);
+		}
+		LookAt->HandleSolved(Entries[Handle].TargetLocation, Solver.GetHeadYaw(Index), Solver.GetHeadPitch(Index));
+
+		if (Solver.IsSettled(Index))
+		{
+			Sleep(Handle);
+		}
+	}
+}
+
+void URfsnLookAtManager::HandleDialogueStarted(AActor* NpcActor)
+{
+	HandleDialogueEnded();
+
+	URfsnNpcLookAt* LookAt = NpcActor ? NpcActor->FindComponentByClass<URfsnNpcLookAt>() : nullptr;
+	if (LookAt && LookAt->bEnabled && LookAt->bOnlyDuringDialogue)
+	{
+		// We are the active dialogue NPC - look at player
+		LookAt->LookAtPlayer();
+		DialogueLookAt = LookAt;
+	}
+}
+
+void URfsnLookAtManager::HandleDialogueEnded()
+{
+	URfsnNpcLookAt* LookAt = DialogueLookAt.Get();
+	if (LookAt && LookAt->bIsLookingAtPlayer)
+	{
+		LookAt->StopLooking();
+	}
+	DialogueLookAt.Reset();
+}
@@ -33,6 +33,17 @@ void URfsnMetrics::RecordDialogueLatency(float LatencyMs)
 	UpdateLatencyStats();
 }
 
+void URfsnMetrics::RecordTimeToFirstCharacter(float LatencyMs)
+{
+	const int32 MaxSamples = 100;
+	FirstCharacterSamples.Add(LatencyMs);
+	if (FirstCharacterSamples.Num() > MaxSamples)
+	{
+		FirstCharacterSamples.RemoveAt(0);
+	}
+	UpdateFirstCharacterStats();
+}
+
 void URfsnMetrics::RecordSentenceReceived()
 {
 	ComponentMetrics.TotalSentencesReceived++;
@@ -48,6 +59,7 @@ void URfsnMetrics::ResetMetrics()
 	ComponentMetrics = FRfsnComponentMetrics();
 	PerformanceMetrics = FRfsnPerformanceMetrics();
 	LatencySamples.Empty();
+	FirstCharacterSamples.Empty();
 }
 
 FString URfsnMetrics::GetMetricsString() const
@@ -55,11 +67,13 @@ FString URfsnMetrics::GetMetricsString() const
 	return FString::Printf(TEXT("RFSN Metrics\n") TEXT("────────────────\n") TEXT("Active NPCs: %d\n")
 	                           TEXT("Active Dialogues: %d\n") TEXT("Active Convs: %d\n") TEXT("Total Sentences: %d\n")
 	                               TEXT("Total Actions: %d\n") TEXT("────────────────\n") TEXT("Avg Latency: %.1fms\n")
-	                                   TEXT("Min Latency: %.1fms\n") TEXT("Max Latency: %.1fms\n"),
+	                                   TEXT("Min Latency: %.1fms\n") TEXT("Max Latency: %.1fms\n")
+	                                       TEXT("Avg First Char: %.1fms\n"),
 	                       ComponentMetrics.ActiveNpcClients, ComponentMetrics.ActiveDialogues,
 	                       ComponentMetrics.ActiveConversations, ComponentMetrics.TotalSentencesReceived,
 	                       ComponentMetrics.TotalActionsReceived, PerformanceMetrics.AverageDialogueLatencyMs,
-	                       PerformanceMetrics.MinDialogueLatencyMs, PerformanceMetrics.MaxDialogueLatencyMs);
+	                       PerformanceMetrics.MinDialogueLatencyMs, PerformanceMetrics.MaxDialogueLatencyMs,
+	                       PerformanceMetrics.AverageTimeToFirstCharacterMs);
 }
 
 void URfsnMetrics::UpdateMetrics()
@@ -110,3 +124,18 @@ void URfsnMetrics::UpdateLatencyStats()
 	PerformanceMetrics.MinDialogueLatencyMs = Min;
 	PerformanceMetrics.MaxDialogueLatencyMs = Max;
 }
+
+void URfsnMetrics::UpdateFirstCharacterStats()
+{
+	float Sum = 0.0f;
+	float Max = 0.0f;
+	for (float Sample : FirstCharacterSamples)
+	{
+		Sum += Sample;
+		Max = FMath::Max(Max, Sample);
+	}
+
+	PerformanceMetrics.AverageTimeToFirstCharacterMs =
+	    FirstCharacterSamples.Num() > 0 ? Sum / FirstCharacterSamples.Num() : 0.0f;
+	PerformanceMetrics.MaxTimeToFirstCharacterMs = Max;
+}
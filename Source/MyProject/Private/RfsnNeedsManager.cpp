@@ -0,0 +1,296 @@
+// RFSN Needs Manager Implementation
+
+#include "RfsnNeedsManager.h"
+#include "RfsnLogging.h"
+#include "Engine/World.h"
+
+// ─────────────────────────────────────────────────────────────
+// FRfsnNeedsSimulation
+// ─────────────────────────────────────────────────────────────
+
+int32 FRfsnNeedsSimulation::Add(const FRfsnNeed (&Needs)[RfsnNeeds::Num], double DecayScale, double Now)
+{
+	int32 Npc;
+	if (FreeSlots.Num() > 0)
+	{
+		Npc = FreeSlots.Pop(EAllowShrinking::No);
+		Active[Npc] = true;
+	}
+	else
+	{
+		Npc = Active.Add(true);
+		for (int32 Need = 0; Need < RfsnNeeds::Num; Need++)
+		{
+			BaseValues[Need].AddUninitialized();
+			DecayRates[Need].AddUninitialized();
+			SeekThresholds[Need].AddUninitialized();
+			CriticalThresholds[Need].AddUninitialized();
+		}
+		BaseTimes.AddUninitialized();
+		DecayScales.AddUninitialized();
+		Generations.Add(0);
+	}
+
+	for (int32 Need = 0; Need < RfsnNeeds::Num; Need++)
+	{
+		BaseValues[Need][Npc] = FMath::Clamp(Needs[Need].Value, 0.0f, 100.0f);
+		DecayRates[Need][Npc] = Needs[Need].DecayRate;
+		SeekThresholds[Need][Npc] = Needs[Need].SeekThreshold;
+		CriticalThresholds[Need][Npc] = Needs[Need].CriticalThreshold;
+	}
+	BaseTimes[Npc] = Now;
+	DecayScales[Npc] = FMath::Max(DecayScale, 0.0);
+
+	ScheduleNext(Npc, Now);
+	return Npc;
+}
+
+void FRfsnNeedsSimulation::Remove(int32 Npc)
+{
+	if (!IsValid(Npc))
+	{
+		return;
+	}
+
+	// Queued events die with the generation
+	Generations[Npc]++;
+	Active[Npc] = false;
+	FreeSlots.Add(Npc);
+}
+
+void FRfsnNeedsSimulation::Rebase(int32 Npc, double Now)
+{
+	for (int32 Need = 0; Need < RfsnNeeds::Num; Need++)
+	{
+		BaseValues[Need][Npc] = GetValue(Npc, Need, Now);
+	}
+	BaseTimes[Npc] = Now;
+}
+
+void FRfsnNeedsSimulation::Adjust(int32 Npc, int32 Need, float Delta, double Now)
+{
+	if (!IsValid(Npc))
+	{
+		return;
+	}
+
+	Rebase(Npc, Now);
+	BaseValues[Need][Npc] = FMath::Clamp(BaseValues[Need][Npc] + Delta, 0.0f, 100.0f);
+	ScheduleNext(Npc, Now);
+}
+
+void FRfsnNeedsSimulation::Set(int32 Npc, int32 Need, const FRfsnNeed& Config, double Now)
+{
+	if (!IsValid(Npc))
+	{
+		return;
+	}
+
+	Rebase(Npc, Now);
+	BaseValues[Need][Npc] = FMath::Clamp(Config.Value, 0.0f, 100.0f);
+	DecayRates[Need][Npc] = Config.DecayRate;
+	SeekThresholds[Need][Npc] = Config.SeekThreshold;
+	CriticalThresholds[Need][Npc] = Config.CriticalThreshold;
+	ScheduleNext(Npc, Now);
+}
+
+void FRfsnNeedsSimulation::SetDecayScale(int32 Npc, double DecayScale, double Now)
+{
+	if (!IsValid(Npc))
+	{
+		return;
+	}
+
+	Rebase(Npc, Now);
+	DecayScales[Npc] = FMath::Max(DecayScale, 0.0);
+	ScheduleNext(Npc, Now);
+}
+
+void FRfsnNeedsSimulation::ScheduleNext(int32 Npc, double Now)
+{
+	const uint32 Generation = ++Generations[Npc];
+
+	double Next = TNumericLimits<double>::Max();
+	for (int32 Need = 0; Need < RfsnNeeds::Num; Need++)
+	{
+		const double Rate = DecayRates[Need][Npc] * DecayScales[Npc];
+		if (Rate <= 0.0)
+		{
+			continue;
+		}
+
+		// Values only fall between changes, so only thresholds still above can be crossed
+		const float Value = GetValue(Npc, Need, Now);
+		for (const float Threshold : {SeekThresholds[Need][Npc], CriticalThresholds[Need][Npc]})
+		{
+			if (Value > Threshold)
+			{
+				Next = FMath::Min(Next, Now + (Value - Threshold) / Rate);
+			}
+		}
+	}
+
+	if (Next < TNumericLimits<double>::Max())
+	{
+		Events.HeapPush({Next, Npc, Generation});
+	}
+}
+
+void FRfsnNeedsSimulation::PopDue(double Now, TArray<int32>& OutNpcs)
+{
+	while (Events.Num() > 0 && Events.HeapTop().Time <= Now)
+	{
+		FEvent Event;
+		Events.HeapPop(Event, EAllowShrinking::No);
+
+		// Stale: the NPC changed or was removed after this was queued
+		if (!IsValid(Event.Npc) || Generations[Event.Npc] != Event.Generation)
+		{
+			continue;
+		}
+
+		// Invalidate so a second queued copy can't report it twice; the caller reschedules
+		Generations[Event.Npc]++;
+		OutNpcs.Add(Event.Npc);
+	}
+}
+
+// ─────────────────────────────────────────────────────────────
+// URfsnNeedsManager
+// ─────────────────────────────────────────────────────────────
+
+void URfsnNeedsManager::Deinitialize()
+{
+	Components.Empty();
+	CriticalSlots.Empty();
+	Simulation = FRfsnNeedsSimulation();
+	Super::Deinitialize();
+}
+
+TStatId URfsnNeedsManager::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(URfsnNeedsManager, STATGROUP_Tickables);
+}
+
+double URfsnNeedsManager::GetNow() const
+{
+	const UWorld* World = GetWorld();
+	return World ? World->GetTimeSeconds() : 0.0;
+}
+
+int32 URfsnNeedsManager::Register(URfsnNpcNeeds* Needs)
+{
+	if (!Needs)
+	{
+		return INDEX_NONE;
+	}
+
+	FRfsnNeed Config[RfsnNeeds::Num];
+	Needs->GetCurrentNeeds(Config);
+
+	const double DecayScale = Needs->bEnabled ? Needs->TimeScale / 3600.0 : 0.0;
+	const int32 Slot = Simulation.Add(Config, DecayScale, GetNow());
+	if (Slot >= Components.Num())
+	{
+		Components.SetNum(Slot + 1);
+	}
+	Components[Slot] = Needs;
+	return Slot;
+}
+
+void URfsnNeedsManager::Unregister(int32 Slot)
+{
+	if (Simulation.IsValid(Slot))
+	{
+		Simulation.Remove(Slot);
+		Components[Slot].Reset();
+		CriticalSlots.RemoveSwap(Slot, EAllowShrinking::No);
+	}
+}
+
+float URfsnNeedsManager::GetNeedValue(int32 Slot, int32 Need) const
+{
+	return Simulation.IsValid(Slot) ? Simulation.GetValue(Slot, Need, GetNow()) : 0.0f;
+}
+
+void URfsnNeedsManager::AdjustNeed(int32 Slot, int32 Need, float Delta)
+{
+	Simulation.Adjust(Slot, Need, Delta, GetNow());
+}
+
+void URfsnNeedsManager::SetNeed(int32 Slot, int32 Need, const FRfsnNeed& Config)
+{
+	Simulation.Set(Slot, Need, Config, GetNow());
+}
+
+void URfsnNeedsManager::UpdateDecay(int32 Slot)
+{
+	if (Simulation.IsValid(Slot))
+	{
+		if (const URfsnNpcNeeds* Needs = Components[Slot].Get())
+		{
+			Simulation.SetDecayScale(Slot, Needs->bEnabled ? Needs->TimeScale / 3600.0 : 0.0, GetNow());
+		}
+	}
+}
+
+void URfsnNeedsManager::SetCritical(int32 Slot, bool bCritical)
+{
+	if (!Simulation.IsValid(Slot))
+	{
+		return;
+	}
+
+	if (bCritical)
+	{
+		CriticalSlots.AddUnique(Slot);
+	}
+	else
+	{
+		CriticalSlots.RemoveSwap(Slot, EAllowShrinking::No);
+	}
+}
+
+void URfsnNeedsManager::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	// Critical needs repeat OnNeedCritical at the old tick rate; callbacks may feed an NPC and drop its slot
+	TimeSinceCriticalUpdate += DeltaTime;
+	if (TimeSinceCriticalUpdate >= URfsnNpcNeeds::CriticalUpdateInterval)
+	{
+		TimeSinceCriticalUpdate = 0.0f;
+		CriticalUpdateSlots = CriticalSlots;
+		for (const int32 Slot : CriticalUpdateSlots)
+		{
+			if (URfsnNpcNeeds* Needs = Components.IsValidIndex(Slot) ? Components[Slot].Get() : nullptr)
+			{
+				Needs->HandleCriticalUpdate();
+			}
+		}
+	}
+
+	const double Now = GetNow();
+	if (Simulation.GetNextEventTime() > Now)
+	{
+		return;
+	}
+
+	DueSlots.Reset();
+	Simulation.PopDue(Now, DueSlots);
+
+	for (const int32 Slot : DueSlots)
+	{
+		// Queue the next crossing first: the callback may change needs, which queues again
+		Simulation.ScheduleNext(Slot, Now);
+
+		if (URfsnNpcNeeds* Needs = Components[Slot].Get())
+		{
+			Needs->HandleThresholdCrossed();
+		}
+		else
+		{
+			Unregister(Slot);
+		}
+	}
+}
@@ -1,6 +1,7 @@
 // RFSN NPC Awareness Implementation
 
 #include "RfsnNpcAwareness.h"
+#include "RfsnPerceptionManager.h"
 #include "RfsnLogging.h"
 #include "DrawDebugHelpers.h"
 #include "Kismet/GameplayStatics.h"
@@ -15,7 +16,33 @@ URfsnNpcAwareness::URfsnNpcAwareness()
 void URfsnNpcAwareness::BeginPlay()
 {
 	Super::BeginPlay();
-	RFSN_LOG(TEXT("NpcAwareness initialized for %s"), *GetOwner()->GetName());
+
+	// Batched: the manager culls, traces and applies perception for every NPC in one pass
+	URfsnPerceptionManager* Manager =
+	    bUseBatchedPerception && GetWorld() ? GetWorld()->GetSubsystem<URfsnPerceptionManager>() : nullptr;
+	if (Manager)
+	{
+		Manager->RegisterObserver(this);
+		bRegisteredWithManager = true;
+		SetComponentTickEnabled(false);
+	}
+
+	RFSN_LOG(TEXT("NpcAwareness initialized for %s%s"), *GetOwner()->GetName(),
+	         bRegisteredWithManager ? TEXT(" (batched)") : TEXT(""));
+}
+
+void URfsnNpcAwareness::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	if (bRegisteredWithManager)
+	{
+		if (URfsnPerceptionManager* Manager = GetWorld() ? GetWorld()->GetSubsystem<URfsnPerceptionManager>() : nullptr)
+		{
+			Manager->UnregisterObserver(this);
+		}
+		bRegisteredWithManager = false;
+	}
+
+	Super::EndPlay(EndPlayReason);
 }
 
 void URfsnNpcAwareness::TickComponent(float DeltaTime, ELevelTick TickType,
@@ -23,11 +50,37 @@ void URfsnNpcAwareness::TickComponent(float DeltaTime, ELevelTick TickType,
 {
 	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
 
+	// Unbatched path: test the current target directly
 	if (CurrentTarget)
 	{
 		UpdateVisualDetection(DeltaTime);
 	}
 	else
+	{
+		ApplyPerception(DeltaTime, false, 0.0f);
+	}
+}
+
+void URfsnNpcAwareness::ApplyPerception(float DeltaTime, bool bSeesTarget, float Visibility)
+{
+	if (CurrentTarget)
+	{
+		bCanSeeTarget = bSeesTarget;
+
+		if (bCanSeeTarget)
+		{
+			AwarenessValue = FMath::Min(1.0f, AwarenessValue + AwarenessGainRate * Visibility * DeltaTime);
+			LastKnownLocation = CurrentTarget->GetActorLocation();
+		}
+		else
+		{
+			// Decay when can't see
+			AwarenessValue = FMath::Max(0.0f, AwarenessValue - AwarenessDecayRate * DeltaTime * 0.5f);
+		}
+
+		UpdateAwarenessLevel();
+	}
+	else
 	{
 		// Decay awareness when no target
 		if (AwarenessValue > 0.0f)
@@ -54,10 +107,21 @@ void URfsnNpcAwareness::TickComponent(float DeltaTime, ELevelTick TickType,
 		TimeSinceDetection = 0.0f;
 	}
 
-	// Clear old events
-	float CurrentTime = GetWorld() ? GetWorld()->GetTimeSeconds() : 0.0f;
-	RecentEvents.RemoveAll([CurrentTime](const FRfsnDetectionEvent& Event)
-	                       { return (CurrentTime - Event.Timestamp) > 30.0f; });
+	// Clear old events (appended in time order, so only the front can expire)
+	if (RecentEvents.Num() > 0)
+	{
+		const float CurrentTime = GetWorld() ? GetWorld()->GetTimeSeconds() : 0.0f;
+		int32 NumExpired = 0;
+		while (NumExpired < RecentEvents.Num() && (CurrentTime - RecentEvents[NumExpired].Timestamp) > 30.0f)
+		{
+			NumExpired++;
+		}
+
+		if (NumExpired > 0)
+		{
+			RecentEvents.RemoveAt(0, NumExpired, EAllowShrinking::No);
+		}
+	}
 }
 
 void URfsnNpcAwareness::UpdateVisualDetection(float DeltaTime)
@@ -68,21 +132,8 @@ void URfsnNpcAwareness::UpdateVisualDetection(float DeltaTime)
 		return;
 	}
 
-	bCanSeeTarget = CanSeeActor(CurrentTarget);
-
-	if (bCanSeeTarget)
-	{
-		float Visibility = CalculateVisibility(CurrentTarget);
-		AwarenessValue = FMath::Min(1.0f, AwarenessValue + AwarenessGainRate * Visibility * DeltaTime);
-		LastKnownLocation = CurrentTarget->GetActorLocation();
-	}
-	else
-	{
-		// Decay when can't see
-		AwarenessValue = FMath::Max(0.0f, AwarenessValue - AwarenessDecayRate * DeltaTime * 0.5f);
-	}
-
-	UpdateAwarenessLevel();
+	const bool bSees = CanSeeActor(CurrentTarget);
+	ApplyPerception(DeltaTime, bSees, bSees ? CalculateVisibility(CurrentTarget) : 0.0f);
 }
 
 void URfsnNpcAwareness::UpdateAwarenessLevel()
@@ -170,6 +221,11 @@ void URfsnNpcAwareness::ReportSound(FVector SoundLocation, float Loudness, AActo
 		return;
 	}
 
+	ReceiveSound(SoundLocation, Loudness, Source);
+}
+
+void URfsnNpcAwareness::ReceiveSound(FVector SoundLocation, float Loudness, AActor* Source)
+{
 	// Create detection event
 	FRfsnDetectionEvent Event;
 	Event.Location = SoundLocation;
@@ -286,10 +342,9 @@ float URfsnNpcAwareness::CalculateVisibility(AActor* Target) const
 	// FOV factor (lower in peripheral)
 	FVector ToTarget = (TargetLocation - MyLocation).GetSafeNormal();
 	FVector Forward = GetOwner()->GetActorForwardVector();
-	float Angle = FMath::RadiansToDegrees(FMath::Acos(FVector::DotProduct(Forward, ToTarget)));
 
 	float FOVFactor = 1.0f;
-	if (Angle > FieldOfView * 0.5f)
+	if (FVector::DotProduct(Forward, ToTarget) < FRfsnPerceptionBatch::HalfAngleCos(FieldOfView))
 	{
 		// In peripheral vision
 		FOVFactor = 0.3f;
@@ -335,6 +390,5 @@ bool URfsnNpcAwareness::IsInFieldOfView(FVector Location) const
 	FVector Forward = GetOwner()->GetActorForwardVector();
 	FVector ToLocation = (Location - MyLocation).GetSafeNormal();
 
-	float Angle = FMath::RadiansToDegrees(FMath::Acos(FVector::DotProduct(Forward, ToLocation)));
-	return Angle <= PeripheralFOV * 0.5f;
+	return FVector::DotProduct(Forward, ToLocation) >= FRfsnPerceptionBatch::HalfAngleCos(PeripheralFOV);
 }
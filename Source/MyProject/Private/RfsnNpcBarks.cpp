@@ -1,7 +1,9 @@
 // RFSN NPC Barks Implementation
 
 #include "RfsnNpcBarks.h"
+#include "RfsnBarkLibrary.h"
 #include "RfsnLogging.h"
+#include "RfsnProximityManager.h"
 #include "Kismet/GameplayStatics.h"
 #include "GameFramework/PlayerController.h"
 
@@ -15,15 +17,34 @@ void URfsnNpcBarks::BeginPlay()
 {
 	Super::BeginPlay();
 
-	if (Barks.Num() == 0)
-	{
-		SetupDefaultBarks();
-	}
+	// Share bark content with every NPC of the same archetype (defaults if empty)
+	RefreshBarkLibrary();
 
 	// Randomize initial idle timer
 	IdleTimer = FMath::RandRange(IdleBarkInterval * 0.5f, IdleBarkInterval);
 
-	RFSN_LOG(TEXT("NpcBarks initialized for %s with %d barks"), *GetOwner()->GetName(), Barks.Num());
+	if (URfsnProximityManager* Proximity = GetWorld() ? GetWorld()->GetSubsystem<URfsnProximityManager>() : nullptr)
+	{
+		ProximityZone = Proximity->RegisterZone(
+		    GetOwner(), HearingRange,
+		    FRfsnProximityChanged::CreateWeakLambda(this, [this](bool bInside) { bPlayerInRange = bInside; }));
+	}
+
+	RFSN_LOG(TEXT("NpcBarks initialized for %s with %d barks"), *GetOwner()->GetName(), SharedBarks->Num());
+}
+
+void URfsnNpcBarks::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	if (ProximityZone != INDEX_NONE)
+	{
+		if (URfsnProximityManager* Proximity = GetWorld() ? GetWorld()->GetSubsystem<URfsnProximityManager>() : nullptr)
+		{
+			Proximity->UnregisterZone(ProximityZone);
+		}
+		ProximityZone = INDEX_NONE;
+	}
+
+	Super::EndPlay(EndPlayReason);
 }
 
 void URfsnNpcBarks::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
@@ -69,22 +90,13 @@ bool URfsnNpcBarks::TryBark(ERfsnBarkTrigger Trigger, bool bForce)
 		}
 	}
 
-	FRfsnBark* SelectedBark = SelectBark(Trigger);
-	if (!SelectedBark)
+	const int32 SelectedBark = SelectBark(Trigger);
+	if (SelectedBark == INDEX_NONE)
 	{
 		return false;
 	}
 
-	// Update usage
-	float CurrentTime = GetWorld() ? GetWorld()->GetTimeSeconds() : 0.0f;
-	SelectedBark->LastUsedTime = CurrentTime;
-	LastBarkTime = CurrentTime;
-	CurrentBark = SelectedBark->Text;
-	bIsBarking = true;
-
-	OnBarkTriggered.Broadcast(Trigger, SelectedBark->Text);
-
-	RFSN_LOG(TEXT("%s barks: %s"), *GetOwner()->GetName(), *SelectedBark->Text);
+	PlayBark(SelectedBark, GetWorld() ? GetWorld()->GetTimeSeconds() : 0.0f);
 	return true;
 }
 
@@ -105,19 +117,19 @@ bool URfsnNpcBarks::TryCustomBark(const FString& CustomTag)
 		return false;
 	}
 
+	const TArray<uint16>* Tagged = SharedBarks.IsValid() ? SharedBarks->FindCustomTag(CustomTag) : nullptr;
+	if (!Tagged)
+	{
+		return false;
+	}
+
 	float CurrentTime = GetWorld() ? GetWorld()->GetTimeSeconds() : 0.0f;
 
-	for (FRfsnBark& Bark : Barks)
+	for (const uint16 BarkIndex : *Tagged)
 	{
-		if (Bark.Trigger == ERfsnBarkTrigger::Custom && Bark.CustomTag.Equals(CustomTag, ESearchCase::IgnoreCase) &&
-		    Bark.IsAvailable(CurrentTime))
+		if (CooldownState.IsAvailable(*SharedBarks, BarkIndex, CurrentTime))
 		{
-			Bark.LastUsedTime = CurrentTime;
-			LastBarkTime = CurrentTime;
-			CurrentBark = Bark.Text;
-			bIsBarking = true;
-
-			OnBarkTriggered.Broadcast(ERfsnBarkTrigger::Custom, Bark.Text);
+			PlayBark(BarkIndex, CurrentTime);
 			return true;
 		}
 	}
@@ -127,38 +139,41 @@ bool URfsnNpcBarks::TryCustomBark(const FString& CustomTag)
 
 void URfsnNpcBarks::AddBark(ERfsnBarkTrigger Trigger, const FString& Text, int32 Priority, float InCooldown)
 {
+	MaterializeBarks();
+
 	FRfsnBark Bark;
 	Bark.Trigger = Trigger;
 	Bark.Text = Text;
 	Bark.Priority = Priority;
 	Bark.Cooldown = InCooldown;
 	Barks.Add(Bark);
+
+	RefreshBarkLibrary();
 }
 
 void URfsnNpcBarks::ClearBarks(ERfsnBarkTrigger Trigger)
 {
+	MaterializeBarks();
 	Barks.RemoveAll([Trigger](const FRfsnBark& Bark) { return Bark.Trigger == Trigger; });
+	RefreshBarkLibrary();
 }
 
 FString URfsnNpcBarks::GetRandomBark(ERfsnBarkTrigger Trigger) const
 {
-	float CurrentTime = GetWorld() ? GetWorld()->GetTimeSeconds() : 0.0f;
-
-	TArray<const FRfsnBark*> Available;
-	for (const FRfsnBark& Bark : Barks)
+	if (!SharedBarks.IsValid())
 	{
-		if (Bark.Trigger == Trigger && Bark.IsAvailable(CurrentTime))
-		{
-			Available.Add(&Bark);
-		}
+		return TEXT("");
 	}
 
-	if (Available.Num() == 0)
+	float CurrentTime = GetWorld() ? GetWorld()->GetTimeSeconds() : 0.0f;
+
+	const int32 BarkIndex = CooldownState.PickUniform(*SharedBarks, Trigger, CurrentTime);
+	if (BarkIndex == INDEX_NONE)
 	{
 		return TEXT("");
 	}
 
-	return Available[FMath::RandRange(0, Available.Num() - 1)]->Text;
+	return SharedBarks->GetDef(BarkIndex).Text;
 }
 
 bool URfsnNpcBarks::CanBark() const
@@ -169,6 +184,11 @@ bool URfsnNpcBarks::CanBark() const
 
 bool URfsnNpcBarks::IsPlayerInRange() const
 {
+	if (ProximityZone != INDEX_NONE)
+	{
+		return bPlayerInRange;
+	}
+
 	APlayerController* PC = UGameplayStatics::GetPlayerController(GetWorld(), 0);
 	if (!PC || !PC->GetPawn())
 	{
@@ -179,102 +199,63 @@ bool URfsnNpcBarks::IsPlayerInRange() const
 	return Distance <= HearingRange;
 }
 
+TArray<FRfsnBark> URfsnNpcBarks::GetActiveBarks() const
+{
+	if (Barks.Num() > 0 || !SharedBarks.IsValid())
+	{
+		return Barks;
+	}
+
+	TArray<FRfsnBark> Active;
+	SharedBarks->ToBarks(Active);
+	return Active;
+}
+
 void URfsnNpcBarks::SetupDefaultBarks()
 {
-	Barks.Empty();
-
-	// Idle
-	AddBark(ERfsnBarkTrigger::Idle, TEXT("*sigh*"), 3, 60.0f);
-	AddBark(ERfsnBarkTrigger::Idle, TEXT("Hmm..."), 3, 60.0f);
-	AddBark(ERfsnBarkTrigger::Idle, TEXT("What a day..."), 3, 60.0f);
-	AddBark(ERfsnBarkTrigger::Idle, TEXT("Stay alert..."), 4, 60.0f);
-
-	// Greetings
-	AddBark(ERfsnBarkTrigger::Greeting, TEXT("Hey there."), 5, 30.0f);
-	AddBark(ERfsnBarkTrigger::Greeting, TEXT("Oh, hello."), 5, 30.0f);
-	AddBark(ERfsnBarkTrigger::Greeting, TEXT("You again?"), 4, 30.0f);
-
-	// Farewells
-	AddBark(ERfsnBarkTrigger::Farewell, TEXT("See you around."), 5, 30.0f);
-	AddBark(ERfsnBarkTrigger::Farewell, TEXT("Take care."), 5, 30.0f);
-	AddBark(ERfsnBarkTrigger::Farewell, TEXT("Stay safe out there."), 5, 30.0f);
-
-	// Player near
-	AddBark(ERfsnBarkTrigger::PlayerNear, TEXT("Hmm?"), 4, 30.0f);
-	AddBark(ERfsnBarkTrigger::PlayerNear, TEXT("Need something?"), 5, 30.0f);
-
-	// Player leave
-	AddBark(ERfsnBarkTrigger::PlayerLeave, TEXT("Leaving already?"), 4, 30.0f);
-	AddBark(ERfsnBarkTrigger::PlayerLeave, TEXT("Watch yourself."), 4, 30.0f);
-
-	// Combat
-	AddBark(ERfsnBarkTrigger::Combat, TEXT("Get ready!"), 7, 15.0f);
-	AddBark(ERfsnBarkTrigger::Combat, TEXT("Here they come!"), 7, 15.0f);
-	AddBark(ERfsnBarkTrigger::Combat, TEXT("Fight!"), 6, 15.0f);
-
-	// Danger
-	AddBark(ERfsnBarkTrigger::Danger, TEXT("Watch out!"), 8, 10.0f);
-	AddBark(ERfsnBarkTrigger::Danger, TEXT("Something's wrong..."), 6, 20.0f);
-	AddBark(ERfsnBarkTrigger::Danger, TEXT("Did you hear that?"), 6, 20.0f);
-
-	// Weather
-	AddBark(ERfsnBarkTrigger::Weather, TEXT("This weather..."), 3, 120.0f);
-	AddBark(ERfsnBarkTrigger::Weather, TEXT("Hope it clears up."), 3, 120.0f);
-
-	// Time of day
-	AddBark(ERfsnBarkTrigger::TimeOfDay, TEXT("Another day begins."), 3, 300.0f);
-	AddBark(ERfsnBarkTrigger::TimeOfDay, TEXT("Getting dark..."), 4, 300.0f);
-	AddBark(ERfsnBarkTrigger::TimeOfDay, TEXT("Night falls."), 4, 300.0f);
-
-	// Pain
-	AddBark(ERfsnBarkTrigger::Pain, TEXT("Ugh!"), 8, 5.0f);
-	AddBark(ERfsnBarkTrigger::Pain, TEXT("That hurt!"), 7, 5.0f);
-
-	// Victory
-	AddBark(ERfsnBarkTrigger::Victory, TEXT("Got 'em!"), 6, 20.0f);
-	AddBark(ERfsnBarkTrigger::Victory, TEXT("That's that."), 5, 20.0f);
-
-	// Frustrated
-	AddBark(ERfsnBarkTrigger::Frustrated, TEXT("This is getting old..."), 4, 60.0f);
-	AddBark(ERfsnBarkTrigger::Frustrated, TEXT("*grumbles*"), 3, 60.0f);
+	Barks = FRfsnBarkLibraryRegistry::GetDefaultNpcBarks();
+	RefreshBarkLibrary();
 }
 
-FRfsnBark* URfsnNpcBarks::SelectBark(ERfsnBarkTrigger Trigger)
+void URfsnNpcBarks::RefreshBarkLibrary()
 {
-	float CurrentTime = GetWorld() ? GetWorld()->GetTimeSeconds() : 0.0f;
+	SharedBarks = FRfsnBarkLibraryRegistry::AcquireNpcBarks(Barks);
+	CooldownState.Reset();
+}
 
-	TArray<FRfsnBark*> Available;
-	for (FRfsnBark& Bark : Barks)
+void URfsnNpcBarks::MaterializeBarks()
+{
+	// An empty Barks array means "use the shared defaults"; copy them before editing
+	if (Barks.Num() == 0 && SharedBarks.IsValid())
 	{
-		if (Bark.Trigger == Trigger && Bark.IsAvailable(CurrentTime))
-		{
-			Available.Add(&Bark);
-		}
+		SharedBarks->ToBarks(Barks);
 	}
+}
 
-	if (Available.Num() == 0)
+int32 URfsnNpcBarks::SelectBark(ERfsnBarkTrigger Trigger)
+{
+	if (!SharedBarks.IsValid())
 	{
-		return nullptr;
+		return INDEX_NONE;
 	}
 
+	float CurrentTime = GetWorld() ? GetWorld()->GetTimeSeconds() : 0.0f;
+
 	// Weight by priority
-	int32 TotalPriority = 0;
-	for (const FRfsnBark* Bark : Available)
-	{
-		TotalPriority += Bark->Priority;
-	}
+	return CooldownState.Pick(*SharedBarks, Trigger, CurrentTime);
+}
 
-	int32 Roll = FMath::RandRange(1, TotalPriority);
-	int32 Cumulative = 0;
+void URfsnNpcBarks::PlayBark(int32 BarkIndex, float CurrentTime)
+{
+	const FRfsnBarkDef& Bark = SharedBarks->GetDef(BarkIndex);
 
-	for (FRfsnBark* Bark : Available)
-	{
-		Cumulative += Bark->Priority;
-		if (Roll <= Cumulative)
-		{
-			return Bark;
-		}
-	}
+	// Update usage
+	CooldownState.MarkUsed(*SharedBarks, BarkIndex, CurrentTime);
+	LastBarkTime = CurrentTime;
+	CurrentBark = Bark.Text;
+	bIsBarking = true;
+
+	OnBarkTriggered.Broadcast(Bark.Trigger, Bark.Text);
 
-	return Available.Last();
+	RFSN_LOG(TEXT("%s barks: %s"), *GetOwner()->GetName(), *Bark.Text);
 }
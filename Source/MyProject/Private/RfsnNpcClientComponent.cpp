@@ -5,12 +5,20 @@
 #include "RfsnBackstoryGenerator.h"
 #include "RfsnEmotionBlend.h"
 #include "RfsnRelationshipManager.h"
+#include "RfsnResponseCache.h"
+#include "RfsnSignificanceManager.h"
+#include "RfsnTokenDecoder.h"
+#include "RfsnTrace.h"
+#include "RfsnVoiceRouter.h"
+#include "RfsnWitnessSystem.h"
 #include "Dom/JsonObject.h"
 #include "HttpModule.h"
 #include "Interfaces/IHttpResponse.h"
 #include "Serialization/JsonReader.h"
 #include "Serialization/JsonSerializer.h"
 #include "Engine/GameInstance.h"
+#include "Engine/World.h"
+#include "TimerManager.h"
 
 URfsnNpcClientComponent::URfsnNpcClientComponent()
 {
@@ -28,22 +36,45 @@ void URfsnNpcClientComponent::BeginPlay()
 		{
 			RelMgr->RegisterNpcClient(this);
 		}
+
+		// Witness player actions and pass rumors to NPCs nearby
+		if (URfsnWitnessSystem* Witness = GI->GetSubsystem<URfsnWitnessSystem>())
+		{
+			Witness->RegisterNpcClient(this);
+		}
+	}
+
+	// Throttle this NPC's other RFSN components by relevance
+	if (URfsnSignificanceManager* Significance = GetWorld()->GetSubsystem<URfsnSignificanceManager>())
+	{
+		Significance->RegisterNpc(GetOwner());
 	}
 }
 
 void URfsnNpcClientComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
 {
+	StopSessionPlayback();
 	CancelDialogue();
 
-	// Unregister to save relationship state
 	if (UWorld* World = GetWorld())
 	{
+		if (URfsnSignificanceManager* Significance = World->GetSubsystem<URfsnSignificanceManager>())
+		{
+			Significance->UnregisterNpc(GetOwner());
+		}
+
+		// Unregister to save relationship state
 		if (UGameInstance* GI = World->GetGameInstance())
 		{
 			if (URfsnRelationshipManager* RelMgr = GI->GetSubsystem<URfsnRelationshipManager>())
 			{
 				RelMgr->UnregisterNpcClient(this);
 			}
+
+			if (URfsnWitnessSystem* Witness = GI->GetSubsystem<URfsnWitnessSystem>())
+			{
+				Witness->UnregisterNpcClient(this);
+			}
 		}
 	}
 
@@ -53,6 +84,14 @@ void URfsnNpcClientComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
 
 void URfsnNpcClientComponent::SendPlayerUtterance(const FString& PlayerText)
 {
+	RFSN_TRACE_SCOPE(RfsnClient_SendPlayerUtterance);
+
+	// A played-back session owns the dialogue; its own requests stand in for this one
+	if (bPlayingSession)
+	{
+		return;
+	}
+
 	// Cancel any existing stream
 	CancelDialogue();
 
@@ -62,6 +101,18 @@ void URfsnNpcClientComponent::SendPlayerUtterance(const FString& PlayerText)
 		BackstoryGen->OnFirstInteraction();
 	}
 
+	// Near-repeats under the same NPC state are answered from an earlier reply without a round-trip
+	URfsnResponseCache* ResponseCache = bRecordSession ? nullptr : GetResponseCache();
+	const uint32 ReplyContext = ResponseCache ? URfsnResponseCache::MakeContext(this) : 0;
+	if (ResponseCache)
+	{
+		if (const FRfsnCachedResponse* Cached = ResponseCache->Find(NpcId, ReplyContext, PlayerText))
+		{
+			StartReplay(*Cached);
+			return;
+		}
+	}
+
 	// Get mood from emotion blend if available, otherwise use string
 	FString CurrentMood = Mood;
 	FString DialogueTone = TEXT("");
@@ -96,6 +147,7 @@ void URfsnNpcClientComponent::SendPlayerUtterance(const FString& PlayerText)
 	FString JsonString;
 	TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&JsonString);
 	FJsonSerializer::Serialize(Payload.ToSharedRef(), Writer);
+	RecordSessionEvent(ERfsnSessionEvent::Request, JsonString);
 
 	// Create HTTP request
 	CurrentRequest = FHttpModule::Get().CreateRequest();
@@ -109,31 +161,83 @@ void URfsnNpcClientComponent::SendPlayerUtterance(const FString& PlayerText)
 	CurrentRequest->OnRequestProgress64().BindUObject(this, &URfsnNpcClientComponent::OnStreamProgress);
 	CurrentRequest->OnProcessRequestComplete().BindUObject(this, &URfsnNpcClientComponent::OnStreamComplete);
 
-	// Reset state
-	bIsStreaming = true;
-	bGotMeta = false;
-	StreamBuffer.Empty();
+	BeginStream();
 
-	UE_LOG(LogTemp, Log, TEXT("[RFSN] Sending utterance to %s: %s"), *NpcName, *PlayerText);
+	// Record the reply for the cache
+	if (ResponseCache)
+	{
+		Reply = MakeShared<FRfsnCachedResponse>();
+		Reply->NpcId = NpcId;
+		Reply->Context = ReplyContext;
+		Reply->Utterance = PlayerText;
+	}
 
+	UE_LOG(LogTemp, Log, TEXT("[RFSN] Sending utterance to %s: %s"), *NpcName, *PlayerText);
 	CurrentRequest->ProcessRequest();
 }
 
+void URfsnNpcClientComponent::BeginStream()
+{
+	bIsStreaming = true;
+	bGotMeta = false;
+	bGotSentence = false;
+	ProcessedBytes = 0;
+	RecordedBytes = 0;
+	ReplyStartTime = FPlatformTime::Seconds();
+
+	RFSN_TRACE_COUNTER_ADD(RfsnActiveStreams, 1);
+	RFSN_TRACE_BOOKMARK(TEXT("RFSN dialogue start: %s"), *NpcName);
+}
+
 void URfsnNpcClientComponent::CancelDialogue()
 {
-	if (CurrentRequest.IsValid() && bIsStreaming)
+	if (bPlayingSession)
+	{
+		return;
+	}
+
+	if (bIsStreaming && !bReplaying)
+	{
+		RecordSessionBytes(ERfsnSessionEvent::Cancel, nullptr, 0);
+	}
+	CancelStream();
+}
+
+void URfsnNpcClientComponent::CancelStream()
+{
+	const bool bWasStreaming = bIsStreaming;
+	const bool bWasReplaying = bReplaying;
+
+	bReplaying = false;
+	Reply.Reset();
+	if (UWorld* World = GetWorld())
+	{
+		World->GetTimerManager().ClearTimer(ReplayTimer);
+	}
+
+	// Cleared before cancelling so a synchronous completion doesn't end the stream twice
+	bIsStreaming = false;
+	if (CurrentRequest.IsValid() && bWasStreaming)
 	{
 		CurrentRequest->CancelRequest();
 		CurrentRequest.Reset();
 	}
-	bIsStreaming = false;
 	bGotMeta = false;
-	StreamBuffer.Empty();
+	ProcessedBytes = 0;
+
+	if (bWasStreaming && !bWasReplaying)
+	{
+		RFSN_TRACE_COUNTER_SUBTRACT(RfsnActiveStreams, 1);
+		RFSN_TRACE_BOOKMARK(TEXT("RFSN dialogue cancel: %s"), *NpcName);
+	}
 }
 
 void URfsnNpcClientComponent::OnStreamProgress(FHttpRequestPtr Request, uint64 BytesSent, uint64 BytesReceived)
 {
-	if (!Request.IsValid())
+	RFSN_TRACE_SCOPE(RfsnClient_StreamProgress);
+
+	// A replay or played-back session owns the dialogue; anything still arriving is from a request it replaced
+	if (!Request.IsValid() || Request != CurrentRequest || bReplaying || bPlayingSession)
 	{
 		return;
 	}
@@ -144,78 +248,124 @@ void URfsnNpcClientComponent::OnStreamProgress(FHttpRequestPtr Request, uint64 B
 		return;
 	}
 
-	// Accumulate response content
-	FString Content = Response->GetContentAsString();
+	RecordStreamBytes(Response->GetContent());
+	ConsumeStream(Response->GetContent(), false);
+}
 
-	// Process any complete lines we haven't seen yet
-	int32 SearchStart = StreamBuffer.Len();
-	StreamBuffer = Content;
+void URfsnNpcClientComponent::OnStreamComplete(FHttpRequestPtr Request, FHttpResponsePtr Response, bool bSuccess)
+{
+	RFSN_TRACE_SCOPE(RfsnClient_StreamComplete);
 
-	// Find and process complete lines
-	TArray<FString> Lines;
-	StreamBuffer.ParseIntoArrayLines(Lines);
+	// Cancelled or replaced requests have already been ended
+	if (!bIsStreaming || Request != CurrentRequest || bReplaying || bPlayingSession)
+	{
+		return;
+	}
 
-	for (const FString& Line : Lines)
+	const bool bSucceeded = bSuccess && Response.IsValid();
+	const int32 Code = Response.IsValid() ? Response->GetResponseCode() : 0;
+	if (Response.IsValid())
 	{
-		if (!Line.IsEmpty())
-		{
-			ProcessSSELine(Line);
-		}
+		RecordStreamBytes(Response->GetContent());
 	}
+	RecordSessionBytes(bSucceeded ? ERfsnSessionEvent::Complete : ERfsnSessionEvent::Failed, nullptr, 0, Code);
+
+	EndStream(bSucceeded, Code, Response.IsValid() ? &Response->GetContent() : nullptr);
 }
 
-void URfsnNpcClientComponent::OnStreamComplete(FHttpRequestPtr Request, FHttpResponsePtr Response, bool bSuccess)
+void URfsnNpcClientComponent::EndStream(bool bSucceeded, int32 Code, const TArray<uint8>* Content)
 {
+	if (bIsStreaming)
+	{
+		RFSN_TRACE_COUNTER_SUBTRACT(RfsnActiveStreams, 1);
+	}
 	bIsStreaming = false;
 
-	if (!bSuccess || !Response.IsValid())
+	if (!bSucceeded || !Content)
 	{
 		FString ErrorMsg = TEXT("Connection failed");
-		if (Response.IsValid())
+		if (Content)
 		{
-			ErrorMsg =
-			    FString::Printf(TEXT("HTTP %d: %s"), Response->GetResponseCode(), *Response->GetContentAsString());
+			const FUTF8ToTCHAR Body(reinterpret_cast<const ANSICHAR*>(Content->GetData()), Content->Num());
+			ErrorMsg = FString::Printf(TEXT("HTTP %d: %s"), Code, *FString(Body.Length(), Body.Get()));
 		}
 		UE_LOG(LogTemp, Error, TEXT("[RFSN] Error: %s"), *ErrorMsg);
+		RFSN_TRACE_BOOKMARK(TEXT("RFSN dialogue error: %s"), *NpcName);
+		Reply.Reset();
+		if (FRfsnSessionTally* Tally = GetSessionTally())
+		{
+			Tally->Errors++;
+		}
 		OnError.Broadcast(ErrorMsg);
 		return;
 	}
 
 	// Process any remaining content
-	FString FinalContent = Response->GetContentAsString();
-	if (FinalContent.Len() > StreamBuffer.Len())
+	const TSharedPtr<FRfsnCachedResponse> Finished = Reply;
+	ConsumeStream(*Content, true);
+
+	// Only whole, successful replies are worth serving again (and only if no listener started another)
+	if (Reply == Finished)
 	{
-		TArray<FString> Lines;
-		FinalContent.ParseIntoArrayLines(Lines);
-		for (const FString& Line : Lines)
+		Reply.Reset();
+		URfsnResponseCache* ResponseCache = GetResponseCache();
+		if (Finished.IsValid() && ResponseCache && EHttpResponseCodes::IsOk(Code))
 		{
-			if (!Line.IsEmpty())
-			{
-				ProcessSSELine(Line);
-			}
+			ResponseCache->Store(MoveTemp(*Finished));
 		}
 	}
 
 	UE_LOG(LogTemp, Log, TEXT("[RFSN] Dialogue stream complete for %s"), *NpcName);
+	RFSN_TRACE_BOOKMARK(TEXT("RFSN dialogue complete: %s"), *NpcName);
+	if (FRfsnSessionTally* Tally = GetSessionTally())
+	{
+		Tally->Dialogues++;
+	}
 	OnDialogueComplete.Broadcast();
 }
 
-void URfsnNpcClientComponent::ProcessSSELine(const FString& Line)
+void URfsnNpcClientComponent::ConsumeStream(const TArray<uint8>& Content, bool bStreamEnded)
 {
+	// Lines are cut straight from the UTF-8 response bytes; only JSON that needs parsing is ever decoded
+	const UTF8CHAR* Bytes = reinterpret_cast<const UTF8CHAR*>(Content.GetData());
+	int32 LineStart = ProcessedBytes;
+
+	for (int32 i = ProcessedBytes; i < Content.Num(); i++)
+	{
+		if (Content[i] == '\n')
+		{
+			ProcessSSELine(FUtf8StringView(Bytes + LineStart, i - LineStart));
+			LineStart = i + 1;
+		}
+	}
+
+	if (bStreamEnded && LineStart < Content.Num())
+	{
+		ProcessSSELine(FUtf8StringView(Bytes + LineStart, Content.Num() - LineStart));
+		LineStart = Content.Num();
+	}
+
+	ProcessedBytes = LineStart;
+}
+
+void URfsnNpcClientComponent::ProcessSSELine(FUtf8StringView Line)
+{
+	RFSN_TRACE_SCOPE(RfsnClient_ProcessSSELine);
+
 	// SSE format: "data: {...json...}"
-	if (!Line.StartsWith(TEXT("data:")))
+	if (!Line.StartsWith(UTF8TEXT("data:")))
 	{
 		return;
 	}
 
-	FString JsonData = Line.Mid(5).TrimStartAndEnd();
+	const FUtf8StringView JsonData = Line.RightChop(5).TrimStartAndEnd();
 	if (JsonData.IsEmpty())
 	{
 		return;
 	}
 
 	// Try meta event first (has npc_action field)
-	if (!bGotMeta && JsonData.Contains(TEXT("\"npc_action\"")))
+	if (!bGotMeta && JsonData.Contains(UTF8TEXT("\"npc_action\"")))
 	{
 		bGotMeta = true;
 		ParseMetaEvent(JsonData);
@@ -223,20 +373,22 @@ void URfsnNpcClientComponent::ProcessSSELine(const FString& Line)
 	}
 
 	// Sentence event (has sentence field)
-	if (JsonData.Contains(TEXT("\"sentence\"")))
+	if (JsonData.Contains(UTF8TEXT("\"sentence\"")))
 	{
 		ParseSentenceEvent(JsonData);
 	}
 }
 
-void URfsnNpcClientComponent::ParseMetaEvent(const FString& JsonData)
+void URfsnNpcClientComponent::ParseMetaEvent(FUtf8StringView JsonData)
 {
+	RFSN_TRACE_SCOPE(RfsnClient_ParseMetaEvent);
+
 	TSharedPtr<FJsonObject> JsonObject;
-	TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(JsonData);
+	TSharedRef<TJsonReader<UTF8CHAR>> Reader = TJsonReaderFactory<UTF8CHAR>::CreateFromView(JsonData);
 
 	if (!FJsonSerializer::Deserialize(Reader, JsonObject) || !JsonObject.IsValid())
 	{
-		UE_LOG(LogTemp, Warning, TEXT("[RFSN] Failed to parse meta event: %s"), *JsonData);
+		UE_LOG(LogTemp, Warning, TEXT("[RFSN] Failed to parse meta event: %s"), *FString(JsonData));
 		return;
 	}
 
@@ -245,32 +397,47 @@ void URfsnNpcClientComponent::ParseMetaEvent(const FString& JsonData)
 	JsonObject->TryGetStringField(TEXT("bandit_key"), Meta.BanditKey);
 	JsonObject->TryGetStringField(TEXT("action_mode"), Meta.ActionMode);
 
-	FString ActionString;
-	if (JsonObject->TryGetStringField(TEXT("npc_action"), ActionString))
+	// The action is decoded from the payload bytes rather than from a converted FString field
+	FUtf8StringView ActionToken;
+	if (FRfsnTokenDecoder::FindJsonString(JsonData, UTF8TEXT("npc_action"), ActionToken))
 	{
-		Meta.NpcAction = ParseNpcAction(ActionString);
+		Meta.NpcAction = FRfsnTokenDecoder::DecodeAction(ActionToken);
 		LastNpcAction = Meta.NpcAction;
 	}
+	if (FRfsnSessionTally* Tally = GetSessionTally())
+	{
+		Tally->Metas++;
+	}
 
 	// Parse instant bark for latency masking (Gemini recommendation)
 	JsonObject->TryGetStringField(TEXT("instant_bark"), Meta.InstantBark);
 	JsonObject->TryGetNumberField(TEXT("bark_duration_ms"), Meta.BarkDurationMs);
 
-	UE_LOG(LogTemp, Log, TEXT("[RFSN] Meta: action=%s, mode=%s, signal=%s, bark='%s'"), *ActionString, *Meta.ActionMode,
-	       *Meta.PlayerSignal, *Meta.InstantBark.Left(30));
+	UE_LOG(LogTemp, Log, TEXT("[RFSN] Meta: action=%s, mode=%s, signal=%s, bark='%s'"),
+	       FRfsnTokenDecoder::GetActionName(Meta.NpcAction), *Meta.ActionMode, *Meta.PlayerSignal,
+	       *Meta.InstantBark.Left(30));
+
+	if (Reply.IsValid())
+	{
+		Reply->bHasMeta = true;
+		Reply->Meta = Meta;
+	}
 
+	RFSN_TRACE_BOOKMARK(TEXT("RFSN dialogue meta: %s"), *NpcName);
 	OnMetaReceived.Broadcast(Meta);
 	OnNpcActionReceived.Broadcast(Meta.NpcAction);
 }
 
-void URfsnNpcClientComponent::ParseSentenceEvent(const FString& JsonData)
+void URfsnNpcClientComponent::ParseSentenceEvent(FUtf8StringView JsonData)
 {
+	RFSN_TRACE_SCOPE(RfsnClient_ParseSentenceEvent);
+
 	TSharedPtr<FJsonObject> JsonObject;
-	TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(JsonData);
+	TSharedRef<TJsonReader<UTF8CHAR>> Reader = TJsonReaderFactory<UTF8CHAR>::CreateFromView(JsonData);
 
 	if (!FJsonSerializer::Deserialize(Reader, JsonObject) || !JsonObject.IsValid())
 	{
-		UE_LOG(LogTemp, Warning, TEXT("[RFSN] Failed to parse sentence event: %s"), *JsonData);
+		UE_LOG(LogTemp, Warning, TEXT("[RFSN] Failed to parse sentence event: %s"), *FString(JsonData));
 		return;
 	}
 
@@ -286,71 +453,326 @@ void URfsnNpcClientComponent::ParseSentenceEvent(const FString& JsonData)
 
 	if (!Sentence.Sentence.IsEmpty())
 	{
-		// Apply emotional stimulus from sentence tone (if detected)
-		if (URfsnEmotionBlend* EmotionBlend = GetOwner()->FindComponentByClass<URfsnEmotionBlend>())
+		if (Reply.IsValid())
 		{
-			// Simple sentiment analysis based on NPC action
-			if (LastNpcAction == ERfsnNpcAction::Attack || LastNpcAction == ERfsnNpcAction::Threaten)
-			{
-				EmotionBlend->ApplyStimulus(TEXT("Anger"), 0.5f);
-			}
-			else if (LastNpcAction == ERfsnNpcAction::Flee)
-			{
-				EmotionBlend->ApplyStimulus(TEXT("Fear"), 0.5f);
-			}
-			else if (LastNpcAction == ERfsnNpcAction::Greet || LastNpcAction == ERfsnNpcAction::Help)
+			Reply->Sentences.Add(Sentence);
+			Reply->SentenceOffsetsMs.Add(static_cast<float>((FPlatformTime::Seconds() - ReplyStartTime) * 1000.0));
+		}
+		EmitSentence(Sentence);
+	}
+}
+
+void URfsnNpcClientComponent::EmitSentence(const FRfsnSentence& Sentence)
+{
+	// Apply emotional stimulus from sentence tone (if detected)
+	AActor* Owner = GetOwner();
+	if (URfsnEmotionBlend* EmotionBlend = Owner ? Owner->FindComponentByClass<URfsnEmotionBlend>() : nullptr)
+	{
+		// Simple sentiment analysis based on NPC action
+		if (LastNpcAction == ERfsnNpcAction::Attack || LastNpcAction == ERfsnNpcAction::Threaten)
+		{
+			EmotionBlend->ApplyStimulusEnum(ERfsnCoreEmotion::Anger, 0.5f);
+		}
+		else if (LastNpcAction == ERfsnNpcAction::Flee)
+		{
+			EmotionBlend->ApplyStimulusEnum(ERfsnCoreEmotion::Fear, 0.5f);
+		}
+		else if (LastNpcAction == ERfsnNpcAction::Greet || LastNpcAction == ERfsnNpcAction::Help)
+		{
+			EmotionBlend->ApplyStimulusEnum(ERfsnCoreEmotion::Joy, 0.3f);
+		}
+	}
+
+	UE_LOG(LogTemp, Log, TEXT("[%s] %s"), *NpcName, *Sentence.Sentence);
+	if (!bGotSentence)
+	{
+		bGotSentence = true;
+		RFSN_TRACE_BOOKMARK(TEXT("RFSN dialogue first sentence: %s"), *NpcName);
+	}
+	if (FRfsnSessionTally* Tally = GetSessionTally())
+	{
+		Tally->Sentences++;
+	}
+	OnSentenceReceived.Broadcast(Sentence);
+}
+
+URfsnResponseCache* URfsnNpcClientComponent::GetResponseCache() const
+{
+	UGameInstance* GI = bUseResponseCache && GetWorld() ? GetWorld()->GetGameInstance() : nullptr;
+	URfsnResponseCache* ResponseCache = GI ? GI->GetSubsystem<URfsnResponseCache>() : nullptr;
+	return ResponseCache && ResponseCache->bEnabled ? ResponseCache : nullptr;
+}
+
+void URfsnNpcClientComponent::StartReplay(const FRfsnCachedResponse& Cached)
+{
+	Reply = MakeShared<FRfsnCachedResponse>(Cached);
+	bReplaying = true;
+	bIsStreaming = true;
+	bGotMeta = false;
+	bGotSentence = false;
+	ReplayIndex = 0;
+	ReplyStartTime = FPlatformTime::Seconds();
+
+	UE_LOG(LogTemp, Log, TEXT("[RFSN] Replaying cached reply for %s"), *NpcName);
+	RFSN_TRACE_BOOKMARK(TEXT("RFSN dialogue cache hit: %s"), *NpcName);
+
+	if (Reply->bHasMeta)
+	{
+		bGotMeta = true;
+		LastNpcAction = Reply->Meta.NpcAction;
+		OnMetaReceived.Broadcast(Reply->Meta);
+		OnNpcActionReceived.Broadcast(Reply->Meta.NpcAction);
+	}
+
+	ReplayDueSentences();
+}
+
+void URfsnNpcClientComponent::ReplayDueSentences()
+{
+	// Held so a listener that cancels or starts another dialogue mid-broadcast ends this replay cleanly
+	const TSharedPtr<FRfsnCachedResponse> Replay = Reply;
+	if (!bReplaying || !Replay.IsValid())
+	{
+		return;
+	}
+
+	// The first sentence comes at once (that is the round-trip saved); the rest keep their recorded spacing
+	const TArray<float>& Offsets = Replay->SentenceOffsetsMs;
+	const float FirstMs = Offsets.Num() > 0 ? Offsets[0] : 0.0f;
+	while (bReplaying && Reply == Replay && ReplayIndex < Replay->Sentences.Num())
+	{
+		const float DueMs = Offsets.IsValidIndex(ReplayIndex) ? Offsets[ReplayIndex] - FirstMs : 0.0f;
+		const float ElapsedMs = static_cast<float>((FPlatformTime::Seconds() - ReplyStartTime) * 1000.0);
+		if (DueMs > ElapsedMs)
+		{
+			GetWorld()->GetTimerManager().SetTimer(ReplayTimer, this, &URfsnNpcClientComponent::ReplayDueSentences,
+			                                       (DueMs - ElapsedMs) / 1000.0f, false);
+			return;
+		}
+
+		EmitSentence(Replay->Sentences[ReplayIndex++]);
+	}
+
+	if (bReplaying && Reply == Replay)
+	{
+		bReplaying = false;
+		bIsStreaming = false;
+		Reply.Reset();
+
+		UE_LOG(LogTemp, Log, TEXT("[RFSN] Cached dialogue complete for %s"), *NpcName);
+		RFSN_TRACE_BOOKMARK(TEXT("RFSN dialogue complete: %s"), *NpcName);
+		OnDialogueComplete.Broadcast();
+	}
+}
+
+// ─────────────────────────────────────────────────────────────
+// Session Recording & Playback
+// ─────────────────────────────────────────────────────────────
+
+void URfsnNpcClientComponent::RecordSessionEvent(ERfsnSessionEvent Type, const FString& Body, int32 Code)
+{
+	if (bRecordSession && !bPlayingSession)
+	{
+		const FTCHARToUTF8 Utf8(*Body);
+		RecordSessionBytes(Type, reinterpret_cast<const uint8*>(Utf8.Get()), Utf8.Length(), Code);
+	}
+}
+
+void URfsnNpcClientComponent::RecordSessionBytes(ERfsnSessionEvent Type, const uint8* Data, int32 Size, int32 Code)
+{
+	if (!bRecordSession || bPlayingSession)
+	{
+		return;
+	}
+
+	if (!Recording.IsValid())
+	{
+		Recording = MakeShared<FRfsnStreamSession>();
+		Recording->NpcId = NpcId;
+		RecordingStartTime = FPlatformTime::Seconds();
+	}
+
+	const int64 TimeUs = static_cast<int64>((FPlatformTime::Seconds() - RecordingStartTime) * 1000000.0);
+	Recording->Add(Type, TimeUs, Data, Size, Code);
+}
+
+void URfsnNpcClientComponent::RecordStreamBytes(const TArray<uint8>& Content)
+{
+	// Each progress callback's new bytes become one chunk, keeping the splits the parser actually saw
+	if (bRecordSession && Content.Num() > RecordedBytes)
+	{
+		RecordSessionBytes(ERfsnSessionEvent::Chunk, Content.GetData() + RecordedBytes, Content.Num() - RecordedBytes);
+	}
+	RecordedBytes = Content.Num();
+}
+
+FRfsnSessionTally* URfsnNpcClientComponent::GetSessionTally()
+{
+	if (bPlayingSession)
+	{
+		return &PlaybackTally;
+	}
+	return bRecordSession && Recording.IsValid() ? &Recording->Tally : nullptr;
+}
+
+bool URfsnNpcClientComponent::SaveSessionRecording(const FString& FilePath)
+{
+	if (!Recording.IsValid() || Recording->IsEmpty())
+	{
+		UE_LOG(LogTemp, Warning, TEXT("[RFSN] No session recorded for %s"), *NpcName);
+		return false;
+	}
+
+	const FString Path = FilePath.IsEmpty() ? FRfsnStreamSession::GetDefaultPath(NpcId) : FilePath;
+	if (!Recording->SaveToFile(Path))
+	{
+		UE_LOG(LogTemp, Error, TEXT("[RFSN] Failed to save session to %s"), *Path);
+		return false;
+	}
+
+	UE_LOG(LogTemp, Log, TEXT("[RFSN] Saved session for %s: %d events, %.1fs, %lld payload bytes -> %s"), *NpcName,
+	       Recording->Events.Num(), Recording->GetDurationUs() / 1000000.0, Recording->GetPayloadBytes(), *Path);
+	Recording.Reset();
+	return true;
+}
+
+bool URfsnNpcClientComponent::PlaySessionFile(const FString& FilePath, float Speed)
+{
+	TSharedPtr<FRfsnStreamSession> Session = MakeShared<FRfsnStreamSession>();
+	if (!Session->LoadFromFile(FilePath))
+	{
+		UE_LOG(LogTemp, Error, TEXT("[RFSN] Failed to load session %s"), *FilePath);
+		return false;
+	}
+
+	PlaySession(Session, Speed);
+	return true;
+}
+
+void URfsnNpcClientComponent::PlaySession(const TSharedPtr<const FRfsnStreamSession>& Session, float Speed)
+{
+	StopSessionPlayback();
+	CancelDialogue();
+
+	if (!Session.IsValid() || Session->IsEmpty())
+	{
+		UE_LOG(LogTemp, Warning, TEXT("[RFSN] Empty session given to %s"), *NpcName);
+		return;
+	}
+
+	PlaybackSession = Session;
+	bPlayingSession = true;
+	PlaybackIndex = 0;
+	PlaybackSpeed = FMath::Max(Speed, 0.0f);
+	PlaybackStartTime = FPlatformTime::Seconds();
+	PlaybackTally = FRfsnSessionTally();
+	PlaybackContent.Reset();
+
+	UE_LOG(LogTemp, Log, TEXT("[RFSN] Playing session of %s on %s (%d events, speed %.2f)"), *Session->NpcId,
+	       *NpcName, Session->Events.Num(), PlaybackSpeed);
+	PlayDueSessionEvents();
+}
+
+void URfsnNpcClientComponent::StopSessionPlayback()
+{
+	if (!bPlayingSession)
+	{
+		return;
+	}
+
+	if (UWorld* World = GetWorld())
+	{
+		World->GetTimerManager().ClearTimer(PlaybackTimer);
+	}
+	bPlayingSession = false;
+	PlaybackSession.Reset();
+	PlaybackContent.Reset();
+	CancelStream();
+}
+
+void URfsnNpcClientComponent::PlayDueSessionEvents()
+{
+	RFSN_TRACE_SCOPE(RfsnClient_PlaySession);
+
+	// Held so a listener that stops or restarts playback mid-broadcast ends this pass cleanly
+	const TSharedPtr<const FRfsnStreamSession> Session = PlaybackSession;
+	UWorld* World = GetWorld();
+	while (bPlayingSession && PlaybackSession == Session && PlaybackIndex < Session->Events.Num())
+	{
+		const FRfsnSessionEvent& Event = Session->Events[PlaybackIndex];
+		if (PlaybackSpeed > 0.0f && World)
+		{
+			const double DueSeconds = Event.TimeUs / 1000000.0 / PlaybackSpeed;
+			const double ElapsedSeconds = FPlatformTime::Seconds() - PlaybackStartTime;
+			if (DueSeconds > ElapsedSeconds)
 			{
-				EmotionBlend->ApplyStimulus(TEXT("Joy"), 0.3f);
+				World->GetTimerManager().SetTimer(PlaybackTimer, this,
+				                                  &URfsnNpcClientComponent::PlayDueSessionEvents,
+				                                  static_cast<float>(DueSeconds - ElapsedSeconds), false);
+				return;
 			}
 		}
 
-		UE_LOG(LogTemp, Log, TEXT("[%s] %s"), *NpcName, *Sentence.Sentence);
-		OnSentenceReceived.Broadcast(Sentence);
+		PlaybackIndex++;
+		PlaySessionEvent(Event);
+	}
+
+	if (bPlayingSession && PlaybackSession == Session)
+	{
+		// A recording saved mid-stream leaves its last dialogue open
+		bPlayingSession = false;
+		PlaybackSession.Reset();
+		CancelStream();
+
+		UE_LOG(LogTemp, Log, TEXT("[RFSN] Session playback complete for %s: %d dialogues, %d sentences, %d errors"),
+		       *NpcName, PlaybackTally.Dialogues, PlaybackTally.Sentences, PlaybackTally.Errors);
+		OnSessionPlaybackComplete.Broadcast();
+	}
+}
+
+void URfsnNpcClientComponent::PlaySessionEvent(const FRfsnSessionEvent& Event)
+{
+	switch (Event.Type)
+	{
+	case ERfsnSessionEvent::Request:
+		CancelStream();
+		PlaybackContent.Reset();
+		BeginStream();
+		break;
+
+	case ERfsnSessionEvent::Chunk:
+		PlaybackContent.Append(Event.Payload);
+		ConsumeStream(PlaybackContent, false);
+		break;
+
+	case ERfsnSessionEvent::Complete:
+		EndStream(true, Event.Code, &PlaybackContent);
+		break;
+
+	case ERfsnSessionEvent::Failed:
+		// Code 0 is a connection that never produced a response
+		EndStream(false, Event.Code, Event.Code != 0 ? &PlaybackContent : nullptr);
+		break;
+
+	case ERfsnSessionEvent::Cancel:
+		CancelStream();
+		break;
+
+	case ERfsnSessionEvent::TtsResponse:
+		if (URfsnVoiceRouter* Router = GetOwner() ? GetOwner()->FindComponentByClass<URfsnVoiceRouter>() : nullptr)
+		{
+			const FUTF8ToTCHAR Body(reinterpret_cast<const ANSICHAR*>(Event.Payload.GetData()), Event.Payload.Num());
+			Router->HandleTtsResponse(Event.Code, FString(Body.Length(), Body.Get()));
+		}
+		break;
+
+	default:
+		// TTS requests are re-sent by the voice router as the played sentences arrive; only replies are played
+		break;
 	}
 }
 
 ERfsnNpcAction URfsnNpcClientComponent::ParseNpcAction(const FString& ActionString)
 {
-	FString Upper = ActionString.ToUpper();
-
-	if (Upper == TEXT("GREET"))
-		return ERfsnNpcAction::Greet;
-	if (Upper == TEXT("WARN"))
-		return ERfsnNpcAction::Warn;
-	if (Upper == TEXT("IDLE"))
-		return ERfsnNpcAction::Idle;
-	if (Upper == TEXT("FLEE"))
-		return ERfsnNpcAction::Flee;
-	if (Upper == TEXT("ATTACK"))
-		return ERfsnNpcAction::Attack;
-	if (Upper == TEXT("TRADE"))
-		return ERfsnNpcAction::Trade;
-	if (Upper == TEXT("OFFER"))
-		return ERfsnNpcAction::Offer;
-	if (Upper == TEXT("APOLOGIZE"))
-		return ERfsnNpcAction::Apologize;
-	if (Upper == TEXT("THREATEN"))
-		return ERfsnNpcAction::Threaten;
-	if (Upper == TEXT("HELP"))
-		return ERfsnNpcAction::Help;
-	if (Upper == TEXT("REQUEST"))
-		return ERfsnNpcAction::Request;
-	if (Upper == TEXT("AGREE"))
-		return ERfsnNpcAction::Agree;
-	if (Upper == TEXT("DISAGREE"))
-		return ERfsnNpcAction::Disagree;
-	if (Upper == TEXT("ACCEPT"))
-		return ERfsnNpcAction::Accept;
-	if (Upper == TEXT("REFUSE"))
-		return ERfsnNpcAction::Refuse;
-	if (Upper == TEXT("IGNORE"))
-		return ERfsnNpcAction::Ignore;
-	if (Upper == TEXT("INQUIRE"))
-		return ERfsnNpcAction::Inquire;
-	if (Upper == TEXT("EXPLAIN"))
-		return ERfsnNpcAction::Explain;
-	if (Upper == TEXT("ANSWER"))
-		return ERfsnNpcAction::Answer;
-
-	return ERfsnNpcAction::Talk;
+	return FRfsnTokenDecoder::DecodeAction(FStringView(ActionString));
 }
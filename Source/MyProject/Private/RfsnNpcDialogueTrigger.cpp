@@ -7,6 +7,7 @@
 #include "Kismet/GameplayStatics.h"
 #include "RfsnDialogueWidget.h"
 #include "RfsnNpcClientComponent.h"
+#include "RfsnProximityManager.h"
 
 URfsnNpcDialogueTrigger::URfsnNpcDialogueTrigger() {
   PrimaryComponentTick.bCanEverTick = true;
@@ -17,6 +18,21 @@ void URfsnNpcDialogueTrigger::BeginPlay() {
   Super::BeginPlay();
   FindComponents();
 
+  // Enter/exit events from the proximity manager replace polling
+  URfsnProximityManager *Proximity =
+      GetWorld() ? GetWorld()->GetSubsystem<URfsnProximityManager>() : nullptr;
+  if (Proximity) {
+    ProximityZone = Proximity->RegisterZone(
+        GetOwner(), ProximityRadius,
+        FRfsnProximityChanged::CreateUObject(
+            this, &URfsnNpcDialogueTrigger::SetPlayerInProximity));
+  }
+
+  if (ProximityZone != INDEX_NONE) {
+    SetComponentTickEnabled(false);
+    return;
+  }
+
   // Get player pawn reference
   if (APlayerController *PC =
           UGameplayStatics::GetPlayerController(GetWorld(), 0)) {
@@ -24,6 +40,20 @@ void URfsnNpcDialogueTrigger::BeginPlay() {
   }
 }
 
+void URfsnNpcDialogueTrigger::EndPlay(
+    const EEndPlayReason::Type EndPlayReason) {
+  if (ProximityZone != INDEX_NONE) {
+    if (URfsnProximityManager *Proximity =
+            GetWorld() ? GetWorld()->GetSubsystem<URfsnProximityManager>()
+                       : nullptr) {
+      Proximity->UnregisterZone(ProximityZone);
+    }
+    ProximityZone = INDEX_NONE;
+  }
+
+  Super::EndPlay(EndPlayReason);
+}
+
 void URfsnNpcDialogueTrigger::TickComponent(
     float DeltaTime, ELevelTick TickType,
     FActorComponentTickFunction *ThisTickFunction) {
@@ -83,8 +113,12 @@ void URfsnNpcDialogueTrigger::CheckProximity() {
                                       PlayerPawn->GetActorLocation());
   float RadiusSq = ProximityRadius * ProximityRadius;
 
+  SetPlayerInProximity(DistSq <= RadiusSq);
+}
+
+void URfsnNpcDialogueTrigger::SetPlayerInProximity(bool bInProximity) {
   bool bWasInProximity = bPlayerInProximity;
-  bPlayerInProximity = (DistSq <= RadiusSq);
+  bPlayerInProximity = bInProximity;
 
   // Check for proximity trigger
   if (bPlayerInProximity && !bWasInProximity) {
@@ -1,62 +1,40 @@
 // RFSN NPC Look-At Implementation
 
 #include "RfsnNpcLookAt.h"
-#include "RfsnDialogueManager.h"
+#include "RfsnLookAtManager.h"
 #include "RfsnLogging.h"
-#include "GameFramework/Character.h"
-#include "Kismet/KismetMathLibrary.h"
-#include "Kismet/GameplayStatics.h"
 #include "Engine/World.h"
 
 URfsnNpcLookAt::URfsnNpcLookAt()
 {
-	PrimaryComponentTick.bCanEverTick = true;
-	PrimaryComponentTick.TickInterval = 0.016f; // ~60fps
+	// Solved in batches by URfsnLookAtManager
+	PrimaryComponentTick.bCanEverTick = false;
 }
 
 void URfsnNpcLookAt::BeginPlay()
 {
 	Super::BeginPlay();
-}
-
-void URfsnNpcLookAt::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
-{
-	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
 
-	if (!bEnabled)
+	if (UWorld* World = GetWorld())
 	{
-		return;
+		Manager = World->GetSubsystem<URfsnLookAtManager>();
 	}
-
-	// Check if we should be looking during dialogue
-	if (bOnlyDuringDialogue)
+	if (URfsnLookAtManager* LookAtManager = Manager.Get())
 	{
-		UWorld* World = GetWorld();
-		URfsnDialogueManager* DialogueMgr = World ? World->GetSubsystem<URfsnDialogueManager>() : nullptr;
-
-		if (DialogueMgr && DialogueMgr->IsDialogueActive())
-		{
-			AActor* ActiveNpc = DialogueMgr->GetActiveNpc();
-			if (ActiveNpc == GetOwner())
-			{
-				// We are the active dialogue NPC - look at player
-				LookAtLocation(GetPlayerEyeLocation());
-				bIsLookingAtPlayer = true;
-			}
-		}
-		else
-		{
-			if (bIsLookingAtPlayer)
-			{
-				StopLooking();
-			}
-		}
+		ManagerHandle = LookAtManager->Register(this);
 	}
+}
 
-	if (bHasTarget)
+void URfsnNpcLookAt::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	if (URfsnLookAtManager* LookAtManager = Manager.Get())
 	{
-		UpdateLookAt(DeltaTime);
+		LookAtManager->Unregister(ManagerHandle);
 	}
+	Manager.Reset();
+	ManagerHandle = INDEX_NONE;
+
+	Super::EndPlay(EndPlayReason);
 }
 
 void URfsnNpcLookAt::LookAtActor(AActor* Target)
@@ -69,7 +47,13 @@ void URfsnNpcLookAt::LookAtActor(AActor* Target)
 
 	CurrentTarget = Target;
 	bHasTarget = true;
+	bIsLookingAtPlayer = false;
 	LookAtTarget = Target->GetActorLocation();
+
+	if (URfsnLookAtManager* LookAtManager = Manager.Get())
+	{
+		LookAtManager->SetTargetActor(ManagerHandle, Target);
+	}
 }
 
 void URfsnNpcLookAt::LookAtLocation(FVector Location)
@@ -77,6 +61,24 @@ void URfsnNpcLookAt::LookAtLocation(FVector Location)
 	CurrentTarget.Reset();
 	LookAtTarget = Location;
 	bHasTarget = true;
+	bIsLookingAtPlayer = false;
+
+	if (URfsnLookAtManager* LookAtManager = Manager.Get())
+	{
+		LookAtManager->SetTargetLocation(ManagerHandle, Location);
+	}
+}
+
+void URfsnNpcLookAt::LookAtPlayer()
+{
+	CurrentTarget.Reset();
+	bHasTarget = true;
+	bIsLookingAtPlayer = true;
+
+	if (URfsnLookAtManager* LookAtManager = Manager.Get())
+	{
+		LookAtManager->SetTargetPlayer(ManagerHandle);
+	}
 }
 
 void URfsnNpcLookAt::StopLooking()
@@ -84,6 +86,21 @@ void URfsnNpcLookAt::StopLooking()
 	bHasTarget = false;
 	bIsLookingAtPlayer = false;
 	CurrentTarget.Reset();
+
+	if (URfsnLookAtManager* LookAtManager = Manager.Get())
+	{
+		LookAtManager->ClearTarget(ManagerHandle);
+	}
+}
+
+void URfsnNpcLookAt::HandleSolved(const FVector& Target, float InHeadYaw, float InHeadPitch)
+{
+	if (bHasTarget)
+	{
+		LookAtTarget = Target;
+	}
+	HeadYaw = InHeadYaw;
+	HeadPitch = InHeadPitch;
 }
 
 float URfsnNpcLookAt::GetAngleToTarget() const
@@ -110,59 +127,3 @@ float URfsnNpcLookAt::GetAngleToTarget() const
 	float Dot = FVector::DotProduct(Forward, ToTarget);
 	return FMath::RadiansToDegrees(FMath::Acos(Dot));
 }
-
-void URfsnNpcLookAt::UpdateLookAt(float DeltaTime)
-{
-	AActor* Owner = GetOwner();
-	if (!Owner)
-	{
-		return;
-	}
-
-	// Update target location if tracking an actor
-	if (CurrentTarget.IsValid())
-	{
-		LookAtTarget = CurrentTarget->GetActorLocation();
-		LookAtTarget.Z += EyeHeightOffset; // Eye level
-	}
-
-	// Calculate target rotation
-	FVector OwnerLocation = Owner->GetActorLocation();
-	TargetRotation = UKismetMathLibrary::FindLookAtRotation(OwnerLocation, LookAtTarget);
-
-	// Only rotate yaw for body
-	FRotator CurrentRotation = Owner->GetActorRotation();
-	float AngleToTarget = GetAngleToTarget();
-
-	if (bRotateBody && AngleToTarget > HeadOnlyAngle)
-	{
-		// Rotate body
-		FRotator NewRotation = FMath::RInterpTo(
-		    CurrentRotation, FRotator(CurrentRotation.Pitch, TargetRotation.Yaw, CurrentRotation.Roll), DeltaTime,
-		    RotationSpeed / 90.0f // Convert to interp speed
-		);
-		Owner->SetActorRotation(NewRotation);
-	}
-
-	// Head bone rotation would be handled via animation blueprint
-	// This component provides the target - animation BP reads it
-}
-
-FVector URfsnNpcLookAt::GetPlayerEyeLocation() const
-{
-	APlayerController* PC = UGameplayStatics::GetPlayerController(GetWorld(), 0);
-	if (!PC)
-	{
-		return FVector::ZeroVector;
-	}
-
-	APawn* PlayerPawn = PC->GetPawn();
-	if (!PlayerPawn)
-	{
-		return FVector::ZeroVector;
-	}
-
-	FVector Location = PlayerPawn->GetActorLocation();
-	Location.Z += EyeHeightOffset;
-	return Location;
-}
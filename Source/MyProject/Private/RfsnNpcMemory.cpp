@@ -2,6 +2,7 @@
 
 #include "RfsnNpcMemory.h"
 #include "RfsnLogging.h"
+#include "RfsnTrace.h"
 #include "RfsnNpcClientComponent.h"
 #include "Misc/FileHelper.h"
 #include "Misc/Paths.h"
@@ -30,6 +31,8 @@ void URfsnNpcMemory::BeginPlay()
 FGuid URfsnNpcMemory::CreateMemory(ERfsnMemoryType Type, const FString& Summary, float EmotionalImpact,
                                    float Importance)
 {
+	RFSN_TRACE_SCOPE(RfsnMemory_CreateMemory);
+
 	FRfsnMemoryEntry Memory;
 	Memory.Type = Type;
 	Memory.Summary = Summary;
@@ -66,6 +69,8 @@ void URfsnNpcMemory::AddTopicToMemory(const FGuid& MemoryId, const FString& Topi
 
 TArray<FRfsnMemoryEntry> URfsnNpcMemory::RecallByTopic(const FString& Topic) const
 {
+	RFSN_TRACE_SCOPE(RfsnMemory_RecallByTopic);
+
 	TArray<FRfsnMemoryEntry> Results;
 	FString LowerTopic = Topic.ToLower();
 
@@ -117,6 +122,8 @@ TArray<FRfsnMemoryEntry> URfsnNpcMemory::GetRecentMemories(int32 Count) const
 
 TArray<FRfsnMemoryEntry> URfsnNpcMemory::GetStrongestMemories(int32 Count) const
 {
+	RFSN_TRACE_SCOPE(RfsnMemory_GetStrongestMemories);
+
 	TArray<FRfsnMemoryEntry> Sorted = Memories;
 	Sorted.Sort([](const FRfsnMemoryEntry& A, const FRfsnMemoryEntry& B)
 	            { return A.Strength * A.Importance > B.Strength * B.Importance; });
@@ -228,6 +235,8 @@ FGuid URfsnNpcMemory::EndConversation()
 
 FString URfsnNpcMemory::GetMemoryContext(int32 InMaxMemories) const
 {
+	RFSN_TRACE_SCOPE(RfsnMemory_GetMemoryContext);
+
 	TArray<FRfsnMemoryEntry> StrongMemories = GetStrongestMemories(InMaxMemories);
 
 	if (StrongMemories.Num() == 0)
@@ -282,6 +291,8 @@ bool URfsnNpcMemory::HasMetPlayer() const
 
 void URfsnNpcMemory::DecayMemories(float GameHoursElapsed)
 {
+	RFSN_TRACE_SCOPE(RfsnMemory_DecayMemories);
+
 	if (MemoryDecayRate <= 0.0f)
 	{
 		return;
@@ -337,6 +348,8 @@ FString URfsnNpcMemory::GetSavePath() const
 
 void URfsnNpcMemory::SaveMemories()
 {
+	RFSN_TRACE_SCOPE(RfsnMemory_SaveMemories);
+
 	FString SavePath = GetSavePath();
 
 	TSharedRef<FJsonObject> RootObj = MakeShared<FJsonObject>();
@@ -375,6 +388,8 @@ void URfsnNpcMemory::SaveMemories()
 
 bool URfsnNpcMemory::LoadMemories()
 {
+	RFSN_TRACE_SCOPE(RfsnMemory_LoadMemories);
+
 	FString SavePath = GetSavePath();
 	FString JsonString;
 
@@ -430,6 +445,8 @@ bool URfsnNpcMemory::LoadMemories()
 
 TArray<FString> URfsnNpcMemory::DetectTopics(const FString& Text) const
 {
+	RFSN_TRACE_SCOPE(RfsnMemory_DetectTopics);
+
 	TArray<FString> Topics;
 	FString LowerText = Text.ToLower();
 
@@ -3,6 +3,24 @@
 #include "RfsnNpcNeeds.h"
 #include "RfsnEmotionBlend.h"
 #include "RfsnLogging.h"
+#include "RfsnNeedsManager.h"
+#include "Engine/World.h"
+
+namespace RfsnNeeds
+{
+static FName GetNeedName(int32 Need)
+{
+	static const FName Names[Num] = {FName("Hunger"), FName("Energy"), FName("Social"), FName("Safety"),
+	                                 FName("Purpose")};
+	return Names[Need];
+}
+
+static bool IsSameNeed(const FRfsnNeed& A, const FRfsnNeed& B)
+{
+	return A.Value == B.Value && A.DecayRate == B.DecayRate && A.SeekThreshold == B.SeekThreshold &&
+	       A.CriticalThreshold == B.CriticalThreshold;
+}
+} // namespace RfsnNeeds
 
 URfsnNpcNeeds::URfsnNpcNeeds()
 {
@@ -20,9 +38,43 @@ URfsnNpcNeeds::URfsnNpcNeeds()
 void URfsnNpcNeeds::BeginPlay()
 {
 	Super::BeginPlay();
+
+	if (UWorld* World = GetWorld())
+	{
+		Manager = World->GetSubsystem<URfsnNeedsManager>();
+	}
+	if (URfsnNeedsManager* NeedsManager = Manager.Get())
+	{
+		// The manager simulates decay; this component only reacts to threshold crossings
+		ManagedSlot = NeedsManager->Register(this);
+		for (int32 Need = 0; Need < RfsnNeeds::Num; Need++)
+		{
+			SyncedNeeds[Need] = GetNeedByIndex(Need);
+		}
+		SetComponentTickEnabled(false);
+	}
+
+	EvaluateNeeds();
 	RFSN_LOG(TEXT("NpcNeeds initialized for %s"), *GetOwner()->GetName());
 }
 
+void URfsnNpcNeeds::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	if (URfsnNeedsManager* NeedsManager = Manager.Get())
+	{
+		// Keep the final values on the component
+		for (int32 Need = 0; Need < RfsnNeeds::Num; Need++)
+		{
+			GetNeedByIndex(Need).Value = NeedsManager->GetNeedValue(ManagedSlot, Need);
+		}
+		NeedsManager->Unregister(ManagedSlot);
+	}
+	Manager.Reset();
+	ManagedSlot = INDEX_NONE;
+
+	Super::EndPlay(EndPlayReason);
+}
+
 void URfsnNpcNeeds::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
 {
 	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
@@ -48,28 +100,92 @@ void URfsnNpcNeeds::TickComponent(float DeltaTime, ELevelTick TickType, FActorCo
 void URfsnNpcNeeds::UpdateNeeds(float GameHours)
 {
 	// Decay all needs
-	Hunger.Decay(GameHours);
-	Energy.Decay(GameHours);
-	Social.Decay(GameHours);
-	Safety.Decay(GameHours);
-	Purpose.Decay(GameHours);
+	for (int32 Need = 0; Need < RfsnNeeds::Num; Need++)
+	{
+		GetNeedByIndex(Need).Decay(GameHours);
+	}
 
-	// Check for critical needs
-	if (Hunger.IsCritical())
+	EvaluateNeeds(true);
+}
+
+void URfsnNpcNeeds::HandleThresholdCrossed()
+{
+	EvaluateNeeds(true);
+}
+
+void URfsnNpcNeeds::HandleCriticalUpdate()
+{
+	if (bEnabled)
 	{
-		OnNeedCritical.Broadcast(FName("Hunger"));
+		EvaluateNeeds(true);
 	}
-	if (Energy.IsCritical())
+}
+
+void URfsnNpcNeeds::ApplyEditedNeeds()
+{
+	URfsnNeedsManager* NeedsManager = ManagedSlot != INDEX_NONE ? Manager.Get() : nullptr;
+	if (!NeedsManager)
 	{
-		OnNeedCritical.Broadcast(FName("Energy"));
+		return;
 	}
-	if (Social.IsCritical())
+
+	for (int32 Need = 0; Need < RfsnNeeds::Num; Need++)
 	{
-		OnNeedCritical.Broadcast(FName("Social"));
+		const FRfsnNeed& Property = GetNeedByIndex(Need);
+		if (RfsnNeeds::IsSameNeed(Property, SyncedNeeds[Need]))
+		{
+			continue;
+		}
+
+		// An untouched Value is stale; only a written one replaces the simulated value
+		FRfsnNeed Config = Property;
+		if (Property.Value == SyncedNeeds[Need].Value)
+		{
+			Config.Value = NeedsManager->GetNeedValue(ManagedSlot, Need);
+		}
+		NeedsManager->SetNeed(ManagedSlot, Need, Config);
+	}
+}
+
+void URfsnNpcNeeds::EvaluateNeeds(bool bUpdate)
+{
+	ApplyEditedNeeds();
+
+	FRfsnNeed Needs[RfsnNeeds::Num];
+	GetCurrentNeeds(Needs);
+
+	for (int32 Need = 0; Need < RfsnNeeds::Num; Need++)
+	{
+		GetNeedByIndex(Need).Value = Needs[Need].Value;
+		SyncedNeeds[Need] = GetNeedByIndex(Need);
+	}
+
+	// Check for critical needs
+	bool bAnyCritical = false;
+	for (const int32 Need : {RfsnNeeds::Hunger, RfsnNeeds::Energy, RfsnNeeds::Social})
+	{
+		const bool bCritical = Needs[Need].IsCritical();
+		const bool bBecameCritical = bCritical && !bWasCritical[Need];
+		bWasCritical[Need] = bCritical;
+		bAnyCritical |= bCritical;
+		if (bBecameCritical)
+		{
+			OnNeedBecameCritical.Broadcast(RfsnNeeds::GetNeedName(Need));
+		}
+		if (bCritical && (bUpdate || bBecameCritical))
+		{
+			OnNeedCritical.Broadcast(RfsnNeeds::GetNeedName(Need));
+		}
+	}
+
+	// Decay no longer ticks this component, so the manager repeats updates while a need stays critical
+	if (URfsnNeedsManager* NeedsManager = Manager.Get())
+	{
+		NeedsManager->SetCritical(ManagedSlot, bAnyCritical);
 	}
 
 	// Update state
-	ERfsnNeedState NewState = CalculateState();
+	ERfsnNeedState NewState = CalculateState(Needs);
 	if (NewState != CurrentState)
 	{
 		ERfsnNeedState OldState = CurrentState;
@@ -80,87 +196,154 @@ void URfsnNpcNeeds::UpdateNeeds(float GameHours)
 	UpdateWellbeing();
 }
 
+void URfsnNpcNeeds::RefreshNeeds()
+{
+	if (URfsnNeedsManager* NeedsManager = Manager.Get())
+	{
+		NeedsManager->UpdateDecay(ManagedSlot);
+	}
+	EvaluateNeeds();
+}
+
+void URfsnNpcNeeds::SetNeedsEnabled(bool bNewEnabled)
+{
+	bEnabled = bNewEnabled;
+	RefreshNeeds();
+}
+
+void URfsnNpcNeeds::GetCurrentNeeds(FRfsnNeed (&OutNeeds)[RfsnNeeds::Num]) const
+{
+	const URfsnNeedsManager* NeedsManager = ManagedSlot != INDEX_NONE ? Manager.Get() : nullptr;
+	for (int32 Need = 0; Need < RfsnNeeds::Num; Need++)
+	{
+		OutNeeds[Need] = GetNeedByIndex(Need);
+		if (NeedsManager)
+		{
+			OutNeeds[Need].Value = NeedsManager->GetNeedValue(ManagedSlot, Need);
+		}
+	}
+}
+
+FRfsnNeed& URfsnNpcNeeds::GetNeedByIndex(int32 Need)
+{
+	return const_cast<FRfsnNeed&>(static_cast<const URfsnNpcNeeds*>(this)->GetNeedByIndex(Need));
+}
+
+const FRfsnNeed& URfsnNpcNeeds::GetNeedByIndex(int32 Need) const
+{
+	switch (Need)
+	{
+	case RfsnNeeds::Hunger:
+		return Hunger;
+	case RfsnNeeds::Energy:
+		return Energy;
+	case RfsnNeeds::Social:
+		return Social;
+	case RfsnNeeds::Safety:
+		return Safety;
+	default:
+		return Purpose;
+	}
+}
+
+void URfsnNpcNeeds::AdjustNeed(int32 Need, float Delta)
+{
+	// An edited value is the one the change applies to
+	ApplyEditedNeeds();
+	if (URfsnNeedsManager* NeedsManager = Manager.Get())
+	{
+		NeedsManager->AdjustNeed(ManagedSlot, Need, Delta);
+	}
+	else
+	{
+		GetNeedByIndex(Need).Satisfy(Delta);
+	}
+	EvaluateNeeds();
+}
+
 void URfsnNpcNeeds::Feed(float Amount)
 {
-	Hunger.Satisfy(Amount);
+	AdjustNeed(RfsnNeeds::Hunger, Amount);
 	RFSN_LOG(TEXT("%s fed (Hunger: %.1f)"), *GetOwner()->GetName(), Hunger.Value);
 }
 
 void URfsnNpcNeeds::Rest(float Amount)
 {
-	Energy.Satisfy(Amount);
+	AdjustNeed(RfsnNeeds::Energy, Amount);
 	RFSN_LOG(TEXT("%s rested (Energy: %.1f)"), *GetOwner()->GetName(), Energy.Value);
 }
 
 void URfsnNpcNeeds::Socialize(float Amount)
 {
-	Social.Satisfy(Amount);
+	AdjustNeed(RfsnNeeds::Social, Amount);
 	RFSN_LOG(TEXT("%s socialized (Social: %.1f)"), *GetOwner()->GetName(), Social.Value);
 }
 
 void URfsnNpcNeeds::FeelSafe(float Amount)
 {
-	Safety.Satisfy(Amount);
+	AdjustNeed(RfsnNeeds::Safety, Amount);
 }
 
 void URfsnNpcNeeds::FeelThreatened(float Amount)
 {
-	Safety.Value = FMath::Max(0.0f, Safety.Value - Amount);
+	AdjustNeed(RfsnNeeds::Safety, -Amount);
 }
 
 void URfsnNpcNeeds::Accomplish(float Amount)
 {
-	Purpose.Satisfy(Amount);
+	AdjustNeed(RfsnNeeds::Purpose, Amount);
 }
 
 float URfsnNpcNeeds::GetNeedValue(FName NeedName) const
 {
-	if (NeedName == FName("Hunger"))
-		return Hunger.Value;
-	if (NeedName == FName("Energy"))
-		return Energy.Value;
-	if (NeedName == FName("Social"))
-		return Social.Value;
-	if (NeedName == FName("Safety"))
-		return Safety.Value;
-	if (NeedName == FName("Purpose"))
-		return Purpose.Value;
+	for (int32 Need = 0; Need < RfsnNeeds::Num; Need++)
+	{
+		if (NeedName == RfsnNeeds::GetNeedName(Need))
+		{
+			const URfsnNeedsManager* NeedsManager = ManagedSlot != INDEX_NONE ? Manager.Get() : nullptr;
+			return NeedsManager ? NeedsManager->GetNeedValue(ManagedSlot, Need) : GetNeedByIndex(Need).Value;
+		}
+	}
 	return 100.0f;
 }
 
+float URfsnNpcNeeds::GetOverallWellbeing() const
+{
+	FRfsnNeed Needs[RfsnNeeds::Num];
+	GetCurrentNeeds(Needs);
+
+	float Wellbeing = 0.0f;
+	for (const FRfsnNeed& Need : Needs)
+	{
+		Wellbeing += Need.Value;
+	}
+	return Wellbeing / RfsnNeeds::Num;
+}
+
 bool URfsnNpcNeeds::HasCriticalNeed() const
 {
-	return Hunger.IsCritical() || Energy.IsCritical() || Social.IsCritical() || Safety.IsCritical();
+	FRfsnNeed Needs[RfsnNeeds::Num];
+	GetCurrentNeeds(Needs);
+
+	return Needs[RfsnNeeds::Hunger].IsCritical() || Needs[RfsnNeeds::Energy].IsCritical() ||
+	       Needs[RfsnNeeds::Social].IsCritical() || Needs[RfsnNeeds::Safety].IsCritical();
 }
 
 FName URfsnNpcNeeds::GetMostPressingNeed() const
 {
+	FRfsnNeed Needs[RfsnNeeds::Num];
+	GetCurrentNeeds(Needs);
+
 	FName MostPressing = NAME_None;
 	float LowestValue = 100.0f;
 
-	if (Hunger.Value < LowestValue)
+	for (int32 Need = 0; Need < RfsnNeeds::Num; Need++)
 	{
-		LowestValue = Hunger.Value;
-		MostPressing = FName("Hunger");
-	}
-	if (Energy.Value < LowestValue)
-	{
-		LowestValue = Energy.Value;
-		MostPressing = FName("Energy");
-	}
-	if (Social.Value < LowestValue)
-	{
-		LowestValue = Social.Value;
-		MostPressing = FName("Social");
-	}
-	if (Safety.Value < LowestValue)
-	{
-		LowestValue = Safety.Value;
-		MostPressing = FName("Safety");
-	}
-	if (Purpose.Value < LowestValue)
-	{
-		MostPressing = FName("Purpose");
+		if (Needs[Need].Value < LowestValue)
+		{
+			LowestValue = Needs[Need].Value;
+			MostPressing = RfsnNeeds::GetNeedName(Need);
+		}
 	}
 
 	return MostPressing;
@@ -168,20 +351,28 @@ FName URfsnNpcNeeds::GetMostPressingNeed() const
 
 float URfsnNpcNeeds::GetBehaviorModifier() const
 {
+	FRfsnNeed Needs[RfsnNeeds::Num];
+	GetCurrentNeeds(Needs);
+
 	// Returns -1 (very negative behavior) to 1 (positive behavior)
 	float Modifier = 0.0f;
 
-	if (Hunger.IsCritical())
+	if (Needs[RfsnNeeds::Hunger].IsCritical())
 		Modifier -= 0.3f;
-	if (Energy.IsCritical())
+	if (Needs[RfsnNeeds::Energy].IsCritical())
 		Modifier -= 0.3f;
-	if (Social.IsCritical())
+	if (Needs[RfsnNeeds::Social].IsCritical())
 		Modifier -= 0.2f;
-	if (Safety.IsCritical())
+	if (Needs[RfsnNeeds::Safety].IsCritical())
 		Modifier -= 0.4f;
 
 	// Bonus for high wellbeing
-	if (OverallWellbeing > 80.0f)
+	float Wellbeing = 0.0f;
+	for (const FRfsnNeed& Need : Needs)
+	{
+		Wellbeing += Need.Value / RfsnNeeds::Num;
+	}
+	if (Wellbeing > 80.0f)
 		Modifier += 0.2f;
 
 	return FMath::Clamp(Modifier, -1.0f, 1.0f);
@@ -189,36 +380,42 @@ float URfsnNpcNeeds::GetBehaviorModifier() const
 
 FString URfsnNpcNeeds::GetNeedsToneModifier() const
 {
+	FRfsnNeed Needs[RfsnNeeds::Num];
+	GetCurrentNeeds(Needs);
+	const FRfsnNeed& CurrentHunger = Needs[RfsnNeeds::Hunger];
+	const FRfsnNeed& CurrentEnergy = Needs[RfsnNeeds::Energy];
+	const FRfsnNeed& CurrentSocial = Needs[RfsnNeeds::Social];
+
 	TArray<FString> Modifiers;
 
-	if (Hunger.IsCritical())
+	if (CurrentHunger.IsCritical())
 	{
 		Modifiers.Add(TEXT("hungry and distracted"));
 	}
-	else if (Hunger.NeedsSeeking())
+	else if (CurrentHunger.NeedsSeeking())
 	{
 		Modifiers.Add(TEXT("thinking about food"));
 	}
 
-	if (Energy.IsCritical())
+	if (CurrentEnergy.IsCritical())
 	{
 		Modifiers.Add(TEXT("exhausted"));
 	}
-	else if (Energy.NeedsSeeking())
+	else if (CurrentEnergy.NeedsSeeking())
 	{
 		Modifiers.Add(TEXT("tired"));
 	}
 
-	if (Social.IsCritical())
+	if (CurrentSocial.IsCritical())
 	{
 		Modifiers.Add(TEXT("desperate for company"));
 	}
-	else if (Social.NeedsSeeking())
+	else if (CurrentSocial.NeedsSeeking())
 	{
 		Modifiers.Add(TEXT("eager to talk"));
 	}
 
-	if (Safety.IsCritical())
+	if (Needs[RfsnNeeds::Safety].IsCritical())
 	{
 		Modifiers.Add(TEXT("anxious and paranoid"));
 	}
@@ -251,6 +448,8 @@ void URfsnNpcNeeds::ApplyToEmotionBlend()
 		return;
 	}
 
+	RefreshNeeds();
+
 	// Apply mood effects based on needs
 	if (Hunger.IsCritical())
 	{
@@ -278,16 +477,21 @@ void URfsnNpcNeeds::ApplyToEmotionBlend()
 	}
 }
 
-ERfsnNeedState URfsnNpcNeeds::CalculateState() const
+ERfsnNeedState URfsnNpcNeeds::CalculateState(const FRfsnNeed (&Needs)[RfsnNeeds::Num])
 {
+	const FRfsnNeed& CurrentHunger = Needs[RfsnNeeds::Hunger];
+	const FRfsnNeed& CurrentEnergy = Needs[RfsnNeeds::Energy];
+	const FRfsnNeed& CurrentSocial = Needs[RfsnNeeds::Social];
+	const FRfsnNeed& CurrentSafety = Needs[RfsnNeeds::Safety];
+
 	int32 CriticalCount = 0;
-	if (Hunger.IsCritical())
+	if (CurrentHunger.IsCritical())
 		CriticalCount++;
-	if (Energy.IsCritical())
+	if (CurrentEnergy.IsCritical())
 		CriticalCount++;
-	if (Social.IsCritical())
+	if (CurrentSocial.IsCritical())
 		CriticalCount++;
-	if (Safety.IsCritical())
+	if (CurrentSafety.IsCritical())
 		CriticalCount++;
 
 	if (CriticalCount >= 2)
@@ -298,11 +502,11 @@ ERfsnNeedState URfsnNpcNeeds::CalculateState() const
 	if (CriticalCount >= 1)
 	{
 		int32 LowCount = 0;
-		if (Hunger.NeedsSeeking())
+		if (CurrentHunger.NeedsSeeking())
 			LowCount++;
-		if (Energy.NeedsSeeking())
+		if (CurrentEnergy.NeedsSeeking())
 			LowCount++;
-		if (Social.NeedsSeeking())
+		if (CurrentSocial.NeedsSeeking())
 			LowCount++;
 
 		if (LowCount >= 2)
@@ -312,17 +516,17 @@ ERfsnNeedState URfsnNpcNeeds::CalculateState() const
 	}
 
 	// Single need issues
-	if (Hunger.IsCritical() || Hunger.NeedsSeeking())
+	if (CurrentHunger.IsCritical() || CurrentHunger.NeedsSeeking())
 	{
 		return ERfsnNeedState::Hungry;
 	}
 
-	if (Energy.IsCritical() || Energy.NeedsSeeking())
+	if (CurrentEnergy.IsCritical() || CurrentEnergy.NeedsSeeking())
 	{
 		return ERfsnNeedState::Tired;
 	}
 
-	if (Social.IsCritical() || Social.NeedsSeeking())
+	if (CurrentSocial.IsCritical() || CurrentSocial.NeedsSeeking())
 	{
 		return ERfsnNeedState::Lonely;
 	}
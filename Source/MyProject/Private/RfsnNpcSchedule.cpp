@@ -1,8 +1,108 @@
 // RFSN NPC Schedule Implementation
 
 #include "RfsnNpcSchedule.h"
+#include "RfsnGameClock.h"
 #include "RfsnLogging.h"
+#include "Algo/BinarySearch.h"
 #include "Kismet/GameplayStatics.h"
+#include "TimerManager.h"
+
+// ─────────────────────────────────────────────────────────────
+// FRfsnCompiledSchedule
+// ─────────────────────────────────────────────────────────────
+
+void FRfsnCompiledSchedule::Compile(const TArray<FRfsnScheduleEntry>& Schedule)
+{
+	for (int32 Day = 0; Day < NumDays; Day++)
+	{
+		TArray<float, TInlineAllocator<16>> Boundaries;
+		Boundaries.Add(0.0f);
+		for (const FRfsnScheduleEntry& Entry : Schedule)
+		{
+			if (Entry.ActiveDays.Num() > 0 && !Entry.ActiveDays.Contains(Day))
+			{
+				continue;
+			}
+			for (const float Hour : {Entry.StartHour, Entry.EndHour})
+			{
+				if (Hour > 0.0f && Hour < 24.0f)
+				{
+					Boundaries.Add(Hour);
+				}
+			}
+		}
+		Boundaries.Sort();
+
+		// Containment only changes at boundaries, so evaluating each one's start covers its whole segment
+		TArray<FSegment>& Segments = Days[Day];
+		Segments.Reset();
+		for (const float Hour : Boundaries)
+		{
+			const int32 EntryIndex = FindEntryForTime(Schedule, Hour, Day);
+			if (Segments.Num() == 0 || Segments.Last().EntryIndex != EntryIndex)
+			{
+				Segments.Add({Hour, EntryIndex});
+			}
+		}
+	}
+}
+
+int32 FRfsnCompiledSchedule::FindEntry(int32 DayOfWeek, float Hour) const
+{
+	const TArray<FSegment>& Segments = Days[DayOfWeek];
+	const int32 Next = Algo::UpperBoundBy(Segments, Hour, &FSegment::StartHour);
+	return Next > 0 ? Segments[Next - 1].EntryIndex : INDEX_NONE;
+}
+
+double FRfsnCompiledSchedule::GetNextTransition(double GameMinutes, int32 DayOfWeek) const
+{
+	const double MinutesPerDay = URfsnGameClock::MinutesPerDay;
+	const double DayStart = FMath::FloorToDouble(GameMinutes / MinutesPerDay) * MinutesPerDay;
+	const float Hour = static_cast<float>((GameMinutes - DayStart) / 60.0);
+
+	const TArray<FSegment>& Segments = Days[DayOfWeek];
+	const int32 Next = Algo::UpperBoundBy(Segments, Hour, &FSegment::StartHour);
+	if (Segments.IsValidIndex(Next))
+	{
+		return DayStart + Segments[Next].StartHour * 60.0;
+	}
+
+	// Day-restricted entries can change at midnight
+	return DayStart + MinutesPerDay;
+}
+
+int32 FRfsnCompiledSchedule::FindEntryForTime(const TArray<FRfsnScheduleEntry>& Schedule, float Hour, int32 DayOfWeek)
+{
+	int32 BestMatch = -1;
+	int32 HighestPriority = -1;
+
+	for (int32 i = 0; i < Schedule.Num(); ++i)
+	{
+		const FRfsnScheduleEntry& Entry = Schedule[i];
+
+		// Check if day matches (empty = all days)
+		if (Entry.ActiveDays.Num() > 0 && !Entry.ActiveDays.Contains(DayOfWeek))
+		{
+			continue;
+		}
+
+		// Check if time matches
+		if (Entry.ContainsTime(Hour))
+		{
+			if (Entry.Priority > HighestPriority)
+			{
+				HighestPriority = Entry.Priority;
+				BestMatch = i;
+			}
+		}
+	}
+
+	return BestMatch;
+}
+
+// ─────────────────────────────────────────────────────────────
+// URfsnNpcSchedule
+// ─────────────────────────────────────────────────────────────
 
 URfsnNpcSchedule::URfsnNpcSchedule()
 {
@@ -14,36 +114,110 @@ void URfsnNpcSchedule::BeginPlay()
 {
 	Super::BeginPlay();
 
-	// Initial schedule update
-	UpdateActivityFromSchedule();
+	Clock = GetWorld() ? GetWorld()->GetSubsystem<URfsnGameClock>() : nullptr;
+	if (URfsnGameClock* GameClock = Clock.Get())
+	{
+		GameClock->OnTimeJumped.AddDynamic(this, &URfsnNpcSchedule::HandleClockJumped);
+	}
+
+	// Compiles, applies the current entry and arms the first transition
+	RebuildSchedule();
 
 	RFSN_LOG(TEXT("NpcSchedule initialized for %s with %d entries"), *GetOwner()->GetName(), Schedule.Num());
 }
 
+void URfsnNpcSchedule::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	if (URfsnGameClock* GameClock = Clock.Get())
+	{
+		GameClock->CancelTimer(TransitionTimer);
+		GameClock->OnTimeJumped.RemoveDynamic(this, &URfsnNpcSchedule::HandleClockJumped);
+	}
+	TransitionTimer = INDEX_NONE;
+
+	if (UWorld* World = GetWorld())
+	{
+		World->GetTimerManager().ClearTimer(InterruptTimerHandle);
+	}
+
+	Super::EndPlay(EndPlayReason);
+}
+
+void URfsnNpcSchedule::RebuildSchedule()
+{
+	CompiledSchedule.Compile(Schedule);
+
+	// Re-apply even if the index didn't change: the entry at that index may have been edited
+	CurrentScheduleIndex = INDEX_NONE;
+	if (!bIsInterrupted)
+	{
+		UpdateActivityFromSchedule();
+	}
+
+	ScheduleNextTransition();
+	UpdateTickEnabled();
+}
+
+void URfsnNpcSchedule::ScheduleNextTransition()
+{
+	URfsnGameClock* GameClock = Clock.Get();
+	if (!GameClock)
+	{
+		return;
+	}
+
+	GameClock->CancelTimer(TransitionTimer);
+	const double Next = CompiledSchedule.GetNextTransition(GameClock->GetGameMinutes(), GameClock->GetDayOfWeek());
+	TransitionTimer = GameClock->ScheduleAt(
+	    Next, FRfsnGameClockCallback::CreateUObject(this, &URfsnNpcSchedule::HandleTransition));
+}
+
+void URfsnNpcSchedule::HandleTransition()
+{
+	TransitionTimer = INDEX_NONE;
+
+	if (bScheduleEnabled && !bIsInterrupted)
+	{
+		UpdateActivityFromSchedule();
+		UpdateTickEnabled();
+	}
+
+	ScheduleNextTransition();
+}
+
+void URfsnNpcSchedule::HandleClockJumped()
+{
+	// The pending timer survives a rewind but now points at the wrong boundary
+	if (URfsnGameClock* GameClock = Clock.Get())
+	{
+		GameClock->CancelTimer(TransitionTimer);
+	}
+	HandleTransition();
+}
+
+void URfsnNpcSchedule::UpdateTickEnabled()
+{
+	// Patrol waits and arrival still need a per-frame view; everything else is clock-driven
+	const bool bNeedsTick = !Clock.IsValid() || (CurrentActivity == ERfsnActivityType::Patrol && !bIsInterrupted);
+	SetComponentTickEnabled(bNeedsTick);
+}
+
 void URfsnNpcSchedule::TickComponent(float DeltaTime, ELevelTick TickType,
                                      FActorComponentTickFunction* ThisTickFunction)
 {
 	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
 
-	if (!bScheduleEnabled)
+	if (!bScheduleEnabled || bIsInterrupted)
 	{
 		return;
 	}
 
-	// Handle interrupt timer
-	if (bIsInterrupted)
+	// Without a game clock, poll the schedule
+	if (!Clock.IsValid())
 	{
-		InterruptTimer -= DeltaTime;
-		if (InterruptTimer <= 0.0f)
-		{
-			ResumeSchedule();
-		}
-		return;
+		UpdateActivityFromSchedule();
 	}
 
-	// Update activity based on schedule
-	UpdateActivityFromSchedule();
-
 	// Handle patrol wait timer
 	if (CurrentActivity == ERfsnActivityType::Patrol && bAtTargetLocation)
 	{
@@ -61,7 +235,7 @@ void URfsnNpcSchedule::TickComponent(float DeltaTime, ELevelTick TickType,
 void URfsnNpcSchedule::UpdateActivityFromSchedule()
 {
 	float CurrentHour = GetCurrentGameHour();
-	int32 NewIndex = FindScheduleEntryForTime(CurrentHour);
+	int32 NewIndex = FindScheduleEntryForTime(CurrentHour, GetCurrentDayOfWeek());
 
 	if (NewIndex != CurrentScheduleIndex)
 	{
@@ -93,41 +267,26 @@ void URfsnNpcSchedule::UpdateActivityFromSchedule()
 	}
 }
 
-int32 URfsnNpcSchedule::FindScheduleEntryForTime(float Hour) const
+int32 URfsnNpcSchedule::FindScheduleEntryForTime(float Hour, int32 DayOfWeek) const
 {
-	int32 BestMatch = -1;
-	int32 HighestPriority = -1;
-
-	// Get current day of week
-	int32 CurrentDay = 0; // TODO: Get from game time system
-
-	for (int32 i = 0; i < Schedule.Num(); ++i)
-	{
-		const FRfsnScheduleEntry& Entry = Schedule[i];
-
-		// Check if day matches (empty = all days)
-		if (Entry.ActiveDays.Num() > 0 && !Entry.ActiveDays.Contains(CurrentDay))
-		{
-			continue;
-		}
-
-		// Check if time matches
-		if (Entry.ContainsTime(Hour))
-		{
-			if (Entry.Priority > HighestPriority)
-			{
-				HighestPriority = Entry.Priority;
-				BestMatch = i;
-			}
-		}
-	}
+	return Clock.IsValid() ? CompiledSchedule.FindEntry(DayOfWeek, Hour)
+	                       : FRfsnCompiledSchedule::FindEntryForTime(Schedule, Hour, DayOfWeek);
+}
 
-	return BestMatch;
+int32 URfsnNpcSchedule::GetCurrentDayOfWeek() const
+{
+	const URfsnGameClock* GameClock = Clock.Get();
+	return GameClock ? GameClock->GetDayOfWeek() : 0;
 }
 
 float URfsnNpcSchedule::GetCurrentGameHour() const
 {
-	// Get time from game
+	if (const URfsnGameClock* GameClock = Clock.Get())
+	{
+		return GameClock->GetGameHour();
+	}
+
+	// No shared clock
 	// Default: use real-time seconds mapped to 24h cycle (1 game day = 24 real minutes)
 	float Seconds = GetWorld() ? UGameplayStatics::GetTimeSeconds(GetWorld()) : 0.0f;
 	float Hours = FMath::Fmod(Seconds / 60.0f, 24.0f); // 60 sec = 1 game hour
@@ -186,14 +345,15 @@ bool URfsnNpcSchedule::ShouldMoveToTarget() const
 	switch (CurrentActivity)
 	{
 	case ERfsnActivityType::Patrol:
-	case ERfsnActivityType::Travel:
 		return !bAtTargetLocation;
+	case ERfsnActivityType::Travel:
 	case ERfsnActivityType::Work:
 	case ERfsnActivityType::Sleep:
 	case ERfsnActivityType::Eat:
 	case ERfsnActivityType::Guard:
 	case ERfsnActivityType::Trade:
-		return !bAtTargetLocation;
+		// Not ticking for these with a game clock, so check directly
+		return Clock.IsValid() ? !CheckAtTargetLocation() : !bAtTargetLocation;
 	default:
 		return false;
 	}
@@ -203,7 +363,13 @@ void URfsnNpcSchedule::InterruptSchedule(ERfsnActivityType OverrideActivity, flo
 {
 	bIsInterrupted = true;
 	InterruptActivity = OverrideActivity;
-	InterruptTimer = DurationSeconds;
+
+	if (UWorld* World = GetWorld())
+	{
+		World->GetTimerManager().SetTimer(InterruptTimerHandle, this, &URfsnNpcSchedule::ResumeSchedule,
+		                                  FMath::Max(DurationSeconds, KINDA_SMALL_NUMBER), false);
+	}
+	UpdateTickEnabled();
 
 	ERfsnActivityType Previous = CurrentActivity;
 	CurrentActivity = OverrideActivity;
@@ -215,11 +381,15 @@ void URfsnNpcSchedule::InterruptSchedule(ERfsnActivityType OverrideActivity, flo
 void URfsnNpcSchedule::ResumeSchedule()
 {
 	bIsInterrupted = false;
-	InterruptTimer = 0.0f;
+	if (UWorld* World = GetWorld())
+	{
+		World->GetTimerManager().ClearTimer(InterruptTimerHandle);
+	}
 
 	// Force update to current schedule
 	CurrentScheduleIndex = -1;
 	UpdateActivityFromSchedule();
+	UpdateTickEnabled();
 
 	RFSN_LOG(TEXT("%s schedule resumed"), *GetOwner()->GetName());
 }
@@ -0,0 +1,402 @@
+// RFSN Perception Manager Implementation
+
+#include "RfsnPerceptionManager.h"
+#include "RfsnNpcAwareness.h"
+#include "RfsnLogging.h"
+#include "Engine/World.h"
+#include "GameFramework/Actor.h"
+
+namespace RfsnPerception
+{
+/** Eye height above actor origin for line-of-sight traces (matches URfsnNpcAwareness) */
+const FVector EyeOffset(0.0f, 0.0f, 50.0f);
+
+/** Extra query radius so observers that moved since the grid was built are still found */
+constexpr float HearingGridSlack = 200.0f;
+
+/** Visibility multiplier for targets moving faster than MovingSpeed */
+constexpr float MovingFactor = 1.3f;
+constexpr float MovingSpeedSq = 50.0f * 50.0f;
+} // namespace RfsnPerception
+
+// ─────────────────────────────────────────────────────────────
+// FRfsnPerceptionBatch
+// ─────────────────────────────────────────────────────────────
+
+void FRfsnPerceptionBatch::Reset()
+{
+	EyeX.Reset();
+	EyeY.Reset();
+	EyeZ.Reset();
+	ForwardX.Reset();
+	ForwardY.Reset();
+	ForwardZ.Reset();
+	TargetX.Reset();
+	TargetY.Reset();
+	TargetZ.Reset();
+	SightRangeSq.Reset();
+	InvSightRange.Reset();
+	CosHalfFov.Reset();
+	CosHalfPeripheral.Reset();
+	Visibility.Reset();
+}
+
+int32 FRfsnPerceptionBatch::Add(const FVector& Eye, const FVector& Forward, const FVector& Target, float SightRange,
+                                float InCosHalfFov, float InCosHalfPeripheral)
+{
+	EyeX.Add(Eye.X);
+	EyeY.Add(Eye.Y);
+	EyeZ.Add(Eye.Z);
+	ForwardX.Add(Forward.X);
+	ForwardY.Add(Forward.Y);
+	ForwardZ.Add(Forward.Z);
+	TargetX.Add(Target.X);
+	TargetY.Add(Target.Y);
+	TargetZ.Add(Target.Z);
+	SightRangeSq.Add(SightRange * SightRange);
+	InvSightRange.Add(SightRange > 0.0f ? 1.0f / SightRange : 0.0f);
+	CosHalfFov.Add(InCosHalfFov);
+	CosHalfPeripheral.Add(InCosHalfPeripheral);
+	return Visibility.Add(0.0f);
+}
+
+void FRfsnPerceptionBatch::Cull()
+{
+	const int32 Count = Num();
+
+	const float* RESTRICT Ex = EyeX.GetData();
+	const float* RESTRICT Ey = EyeY.GetData();
+	const float* RESTRICT Ez = EyeZ.GetData();
+	const float* RESTRICT Fx = ForwardX.GetData();
+	const float* RESTRICT Fy = ForwardY.GetData();
+	const float* RESTRICT Fz = ForwardZ.GetData();
+	const float* RESTRICT Tx = TargetX.GetData();
+	const float* RESTRICT Ty = TargetY.GetData();
+	const float* RESTRICT Tz = TargetZ.GetData();
+	const float* RESTRICT RangeSq = SightRangeSq.GetData();
+	const float* RESTRICT InvRange = InvSightRange.GetData();
+	const float* RESTRICT CosCentral = CosHalfFov.GetData();
+	const float* RESTRICT CosOuter = CosHalfPeripheral.GetData();
+	float* RESTRICT Out = Visibility.GetData();
+
+	for (int32 i = 0; i < Count; i++)
+	{
+		const float Dx = Tx[i] - Ex[i];
+		const float Dy = Ty[i] - Ey[i];
+		const float Dz = Tz[i] - Ez[i];
+		const float DistSq = Dx * Dx + Dy * Dy + Dz * Dz;
+		const float Dist = FMath::Sqrt(DistSq);
+		const float Dot = Fx[i] * Dx + Fy[i] * Dy + Fz[i] * Dz;
+
+		// angle <= half cone  <=>  cos(angle) >= cos(half cone)  <=>  Dot >= Cos * |D|
+		const bool bVisible = (DistSq <= RangeSq[i]) & (Dot >= CosOuter[i] * Dist);
+		const float CentralFactor = Dot >= CosCentral[i] * Dist ? 1.0f : 0.3f;
+		const float DistanceFactor = 1.0f - FMath::Min(Dist * InvRange[i], 1.0f);
+
+		Out[i] = bVisible ? DistanceFactor * CentralFactor : 0.0f;
+	}
+}
+
+// ─────────────────────────────────────────────────────────────
+// URfsnPerceptionManager
+// ─────────────────────────────────────────────────────────────
+
+void URfsnPerceptionManager::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+	TraceDelegate.BindUObject(this, &URfsnPerceptionManager::OnTraceComplete);
+}
+
+void URfsnPerceptionManager::Deinitialize()
+{
+	TraceDelegate.Unbind();
+	Slots.Empty();
+	FreeSlots.Empty();
+	SlotLookup.Empty();
+
+	Super::Deinitialize();
+}
+
+TStatId URfsnPerceptionManager::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(URfsnPerceptionManager, STATGROUP_Tickables);
+}
+
+void URfsnPerceptionManager::RegisterObserver(URfsnNpcAwareness* Awareness)
+{
+	if (!Awareness || SlotLookup.Contains(Awareness))
+	{
+		return;
+	}
+
+	const int32 Index = FreeSlots.Num() > 0 ? FreeSlots.Pop(EAllowShrinking::No) : Slots.AddDefaulted();
+	Slots[Index] = FObserverSlot();
+	Slots[Index].Awareness = Awareness;
+	SlotLookup.Add(Awareness, Index);
+
+	bHearingGridValid = false;
+	Stats.Observers = SlotLookup.Num();
+}
+
+void URfsnPerceptionManager::UnregisterObserver(URfsnNpcAwareness* Awareness)
+{
+	int32 Index = INDEX_NONE;
+	if (!SlotLookup.RemoveAndCopyValue(Awareness, Index))
+	{
+		return;
+	}
+
+	// Resetting the slot also drops any in-flight trace result for it
+	Slots[Index] = FObserverSlot();
+	FreeSlots.Add(Index);
+
+	bHearingGridValid = false;
+	Stats.Observers = SlotLookup.Num();
+}
+
+void URfsnPerceptionManager::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	TimeSinceUpdate += DeltaTime;
+	if (TimeSinceUpdate >= UpdateInterval)
+	{
+		RunPass(TimeSinceUpdate);
+		TimeSinceUpdate = 0.0f;
+	}
+
+	IssueTraces();
+
+	TraceWindowTime += DeltaTime;
+	if (TraceWindowTime >= 1.0f)
+	{
+		Stats.TracesPerSecond = FMath::RoundToInt(TracesThisWindow / TraceWindowTime);
+		TracesThisWindow = 0;
+		TraceWindowTime = 0.0f;
+	}
+}
+
+void URfsnPerceptionManager::RunPass(float DeltaTime)
+{
+	const double PassStart = FPlatformTime::Seconds();
+
+	// Gather: one pair per observer that is tracking a target
+	Batch.Reset();
+	BatchSlots.Reset();
+
+	for (int32 Index = 0; Index < Slots.Num(); Index++)
+	{
+		FObserverSlot& Slot = Slots[Index];
+		Slot.bInCone = false;
+		Slot.Visibility = 0.0f;
+
+		URfsnNpcAwareness* Awareness = Slot.Awareness.Get();
+		AActor* Owner = Awareness ? Awareness->GetOwner() : nullptr;
+		AActor* Target = Awareness ? Awareness->CurrentTarget : nullptr;
+		if (!Owner || !Target)
+		{
+			continue;
+		}
+
+		// New target: the cached line of sight no longer applies
+		if (Slot.LosTarget.Get() != Target)
+		{
+			Slot.LosTarget = Target;
+			Slot.bLosVisible = false;
+			Slot.LosTime = -1.0;
+			Slot.PendingTrace = FTraceHandle();
+		}
+
+		if (Slot.CachedFov != Awareness->FieldOfView || Slot.CachedPeripheralFov != Awareness->PeripheralFOV)
+		{
+			Slot.CachedFov = Awareness->FieldOfView;
+			Slot.CachedPeripheralFov = Awareness->PeripheralFOV;
+			Slot.CosHalfFov = FRfsnPerceptionBatch::HalfAngleCos(Awareness->FieldOfView);
+			Slot.CosHalfPeripheral = FRfsnPerceptionBatch::HalfAngleCos(Awareness->PeripheralFOV);
+		}
+
+		Batch.Add(Owner->GetActorLocation(), Owner->GetActorForwardVector(), Target->GetActorLocation(),
+		          Awareness->SightRange, Slot.CosHalfFov, Slot.CosHalfPeripheral);
+		BatchSlots.Add(Index);
+	}
+
+	// Cull: range and cone for every pair in one pass
+	Batch.Cull();
+
+	int32 InCone = 0;
+	for (int32 i = 0; i < BatchSlots.Num(); i++)
+	{
+		FObserverSlot& Slot = Slots[BatchSlots[i]];
+		Slot.Visibility = Batch.Visibility[i];
+		Slot.bInCone = Slot.Visibility > 0.0f;
+		InCone += Slot.bInCone ? 1 : 0;
+	}
+
+	// Apply: cached line of sight gates what passed the cull
+	const int32 NumSlots = Slots.Num();
+	for (int32 Index = 0; Index < NumSlots; Index++)
+	{
+		const FObserverSlot& Slot = Slots[Index];
+		URfsnNpcAwareness* Awareness = Slot.Awareness.Get();
+		if (!Awareness)
+		{
+			continue;
+		}
+
+		const bool bSees = Slot.bInCone && Slot.bLosVisible && Slot.LosTime >= 0.0;
+		float Visibility = 0.0f;
+		if (bSees)
+		{
+			const AActor* Target = Slot.LosTarget.Get();
+			const bool bMoving = Target && Target->GetVelocity().SizeSquared() > RfsnPerception::MovingSpeedSq;
+			Visibility = Slot.Visibility * (bMoving ? RfsnPerception::MovingFactor : 1.0f);
+		}
+
+		// May broadcast; anything it registers lands in a new or free slot and is picked up next pass
+		Awareness->ApplyPerception(DeltaTime, bSees, Visibility);
+	}
+
+	RebuildHearingGrid();
+
+	Stats.PairsTested = BatchSlots.Num();
+	Stats.PairsInCone = InCone;
+	Stats.LastPassMs = static_cast<float>((FPlatformTime::Seconds() - PassStart) * 1000.0);
+}
+
+void URfsnPerceptionManager::IssueTraces()
+{
+	UWorld* World = GetWorld();
+	const int32 Count = Slots.Num();
+	if (!World || Count == 0)
+	{
+		return;
+	}
+
+	const double Now = World->GetTimeSeconds();
+	int32 Issued = 0;
+	int32 Step = 0;
+
+	// Round-robin so every in-cone pair is refreshed within a bounded number of frames
+	for (; Step < Count && Issued < MaxTracesPerFrame; Step++)
+	{
+		const int32 Index = (TraceCursor + Step) % Count;
+		FObserverSlot& Slot = Slots[Index];
+
+		if (!Slot.bInCone || Slot.PendingTrace.IsValid())
+		{
+			continue;
+		}
+
+		if (Slot.LosTime >= 0.0 && Now - Slot.LosTime < LineOfSightMaxAge)
+		{
+			continue;
+		}
+
+		URfsnNpcAwareness* Awareness = Slot.Awareness.Get();
+		AActor* Owner = Awareness ? Awareness->GetOwner() : nullptr;
+		AActor* Target = Slot.LosTarget.Get();
+		if (!Owner || !Target)
+		{
+			continue;
+		}
+
+		FCollisionQueryParams Params(SCENE_QUERY_STAT(RfsnPerceptionLos), false, Owner);
+		Slot.PendingTrace = World->AsyncLineTraceByChannel(
+		    EAsyncTraceType::Single, Owner->GetActorLocation() + RfsnPerception::EyeOffset,
+		    Target->GetActorLocation() + RfsnPerception::EyeOffset, ECC_Visibility, Params,
+		    FCollisionResponseParams::DefaultResponseParam, &TraceDelegate, static_cast<uint32>(Index));
+		Issued++;
+	}
+
+	TraceCursor = (TraceCursor + Step) % Count;
+	TracesThisWindow += Issued;
+}
+
+void URfsnPerceptionManager::OnTraceComplete(const FTraceHandle& Handle, FTraceDatum& Datum)
+{
+	const int32 Index = static_cast<int32>(Datum.UserData);
+	if (!Slots.IsValidIndex(Index) || !(Slots[Index].PendingTrace == Handle))
+	{
+		// Observer unregistered or retargeted while the trace was in flight
+		return;
+	}
+
+	FObserverSlot& Slot = Slots[Index];
+	Slot.PendingTrace = FTraceHandle();
+
+	const AActor* Target = Slot.LosTarget.Get();
+	bool bVisible = Target != nullptr;
+	for (const FHitResult& Hit : Datum.OutHits)
+	{
+		if (Hit.bBlockingHit)
+		{
+			bVisible = Hit.GetActor() == Target;
+			break;
+		}
+	}
+
+	Slot.bLosVisible = bVisible;
+	Slot.LosTime = GetWorld() ? GetWorld()->GetTimeSeconds() : 0.0;
+}
+
+void URfsnPerceptionManager::RebuildHearingGrid()
+{
+	HearingGrid.Reset(HearingCellSize);
+	MaxHearingReach = 0.0f;
+
+	for (int32 Index = 0; Index < Slots.Num(); Index++)
+	{
+		const URfsnNpcAwareness* Awareness = Slots[Index].Awareness.Get();
+		const AActor* Owner = Awareness ? Awareness->GetOwner() : nullptr;
+		if (!Owner)
+		{
+			continue;
+		}
+
+		HearingGrid.Add(Index, Owner->GetActorLocation());
+		MaxHearingReach = FMath::Max(MaxHearingReach, Awareness->HearingRange * Awareness->HearingSensitivity);
+	}
+
+	bHearingGridValid = true;
+}
+
+int32 URfsnPerceptionManager::ReportSound(FVector Location, float Loudness, AActor* Source)
+{
+	if (Loudness <= 0.0f)
+	{
+		return 0;
+	}
+
+	if (!bHearingGridValid)
+	{
+		RebuildHearingGrid();
+	}
+
+	// Collect first: listeners may react by spawning, destroying or re-registering observers
+	TArray<URfsnNpcAwareness*, TInlineAllocator<32>> Listeners;
+	const float QueryRadius = MaxHearingReach * Loudness + RfsnPerception::HearingGridSlack;
+
+	HearingGrid.Query(Location, QueryRadius,
+	                  [this, &Listeners, &Location, Loudness](int32 Index)
+	                  {
+		                  URfsnNpcAwareness* Awareness = Slots[Index].Awareness.Get();
+		                  const AActor* Owner = Awareness ? Awareness->GetOwner() : nullptr;
+		                  if (!Owner)
+		                  {
+			                  return;
+		                  }
+
+		                  const float Range = Awareness->HearingRange * Loudness * Awareness->HearingSensitivity;
+		                  if (FVector::DistSquared(Owner->GetActorLocation(), Location) <= Range * Range)
+		                  {
+			                  Listeners.Add(Awareness);
+		                  }
+	                  });
+
+	for (URfsnNpcAwareness* Listener : Listeners)
+	{
+		Listener->ReceiveSound(Location, Loudness, Source);
+	}
+
+	return Listeners.Num();
+}
@@ -0,0 +1,293 @@
+// RFSN Proximity Manager Implementation
+
+#include "RfsnProximityManager.h"
+#include "RfsnLogging.h"
+#include "Engine/World.h"
+#include "GameFramework/Actor.h"
+#include "GameFramework/Pawn.h"
+#include "Kismet/GameplayStatics.h"
+
+// ─────────────────────────────────────────────────────────────
+// FRfsnProximityTracker
+// ─────────────────────────────────────────────────────────────
+
+int32 FRfsnProximityTracker::AddZone(const FVector& Location, float Radius)
+{
+	FZone Zone;
+	Zone.Location = Location;
+	Zone.GridLocation = Location;
+	Zone.Radius = FMath::Max(Radius, 0.0f);
+
+	MaxRadius = FMath::Max(MaxRadius, Zone.Radius);
+	const int32 Index = Zones.Add(Zone);
+	if (!bGridDirty)
+	{
+		Grid.Add(Index, Location);
+	}
+	return Index;
+}
+
+void FRfsnProximityTracker::RemoveZone(int32 Zone)
+{
+	if (!Zones.IsValidIndex(Zone))
+	{
+		return;
+	}
+
+	if (Zones[Zone].bInside)
+	{
+		InsideZones.RemoveSingleSwap(Zone, EAllowShrinking::No);
+	}
+
+	if (!bGridDirty)
+	{
+		Grid.Remove(Zone, Zones[Zone].GridLocation);
+	}
+	Zones.RemoveAt(Zone);
+}
+
+bool FRfsnProximityTracker::SetZoneLocation(int32 Zone, const FVector& Location)
+{
+	if (!Zones.IsValidIndex(Zone))
+	{
+		return false;
+	}
+
+	FZone& Entry = Zones[Zone];
+	if (Entry.Location.Equals(Location, 1.0f))
+	{
+		return false;
+	}
+
+	Entry.Location = Location;
+	if (!bGridDirty && FVector::DistSquared2D(Entry.GridLocation, Location) > GridSlack * GridSlack)
+	{
+		Grid.Move(Zone, Entry.GridLocation, Location);
+		Entry.GridLocation = Location;
+	}
+	return true;
+}
+
+void FRfsnProximityTracker::SetZoneRadius(int32 Zone, float Radius)
+{
+	if (Zones.IsValidIndex(Zone))
+	{
+		Zones[Zone].Radius = FMath::Max(Radius, 0.0f);
+		MaxRadius = FMath::Max(MaxRadius, Zones[Zone].Radius);
+	}
+}
+
+void FRfsnProximityTracker::RebuildGrid()
+{
+	Grid.Reset(CellSize);
+	MaxRadius = 0.0f;
+
+	for (auto It = Zones.CreateIterator(); It; ++It)
+	{
+		It->GridLocation = It->Location;
+		Grid.Add(It.GetIndex(), It->Location);
+		MaxRadius = FMath::Max(MaxRadius, It->Radius);
+	}
+
+	bGridDirty = false;
+}
+
+void FRfsnProximityTracker::Update(const FVector& PlayerLocation, TArray<FRfsnProximityEvent>& OutEvents)
+{
+	if (bGridDirty || Grid.GetCellSize() != CellSize)
+	{
+		RebuildGrid();
+	}
+
+	// Exits: only zones the player is currently inside
+	for (int32 i = InsideZones.Num() - 1; i >= 0; i--)
+	{
+		const int32 Index = InsideZones[i];
+		FZone& Zone = Zones[Index];
+		const float ExitRadius = Zone.Radius + Hysteresis;
+
+		if (FVector::DistSquared(Zone.Location, PlayerLocation) > ExitRadius * ExitRadius)
+		{
+			Zone.bInside = false;
+			InsideZones.RemoveAtSwap(i, 1, EAllowShrinking::No);
+			OutEvents.Add({Index, false});
+		}
+	}
+
+	// Entries: zones whose grid cell is within reach (slack covers movement since the zone was last bucketed)
+	int32 Candidates = 0;
+	Grid.Query(PlayerLocation, MaxRadius + GridSlack,
+	           [this, &PlayerLocation, &OutEvents, &Candidates](int32 Index)
+	           {
+		           if (!Zones.IsValidIndex(Index))
+		           {
+			           return;
+		           }
+
+		           FZone& Zone = Zones[Index];
+		           Candidates++;
+		           if (!Zone.bInside && FVector::DistSquared(Zone.Location, PlayerLocation) <= Zone.Radius * Zone.Radius)
+		           {
+			           Zone.bInside = true;
+			           InsideZones.Add(Index);
+			           OutEvents.Add({Index, true});
+		           }
+	           });
+
+	LastCandidates = Candidates;
+}
+
+void FRfsnProximityTracker::ExitAll(TArray<FRfsnProximityEvent>& OutEvents)
+{
+	for (const int32 Index : InsideZones)
+	{
+		Zones[Index].bInside = false;
+		OutEvents.Add({Index, false});
+	}
+	InsideZones.Reset();
+}
+
+// ─────────────────────────────────────────────────────────────
+// URfsnProximityManager
+// ─────────────────────────────────────────────────────────────
+
+void URfsnProximityManager::Deinitialize()
+{
+	Listeners.Empty();
+	Tracker = FRfsnProximityTracker();
+	Super::Deinitialize();
+}
+
+TStatId URfsnProximityManager::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(URfsnProximityManager, STATGROUP_Tickables);
+}
+
+int32 URfsnProximityManager::RegisterZone(AActor* Owner, float Radius, FRfsnProximityChanged OnChanged)
+{
+	if (!Owner)
+	{
+		return INDEX_NONE;
+	}
+
+	const int32 Zone = Tracker.AddZone(Owner->GetActorLocation(), Radius);
+	FZoneListener& Listener = Listeners.Add(Zone);
+	Listener.Owner = Owner;
+	Listener.OnChanged = MoveTemp(OnChanged);
+
+	// The player may already be standing in it
+	bNeedsEvaluation = true;
+	return Zone;
+}
+
+void URfsnProximityManager::UnregisterZone(int32 Zone)
+{
+	if (Listeners.Remove(Zone) > 0)
+	{
+		Tracker.RemoveZone(Zone);
+	}
+}
+
+void URfsnProximityManager::SetZoneRadius(int32 Zone, float Radius)
+{
+	Tracker.SetZoneRadius(Zone, Radius);
+	bNeedsEvaluation = true;
+}
+
+void URfsnProximityManager::RefreshZoneLocations()
+{
+	for (auto It = Listeners.CreateIterator(); It; ++It)
+	{
+		const AActor* Owner = It.Value().Owner.Get();
+		if (!Owner)
+		{
+			// Owner destroyed without unregistering
+			Tracker.RemoveZone(It.Key());
+			It.RemoveCurrent();
+			continue;
+		}
+
+		bNeedsEvaluation |= Tracker.SetZoneLocation(It.Key(), Owner->GetActorLocation());
+	}
+}
+
+void URfsnProximityManager::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	TimeSinceEvaluation += DeltaTime;
+	TimeSinceZoneRefresh += DeltaTime;
+	if (TimeSinceEvaluation < EvaluationInterval || Listeners.Num() == 0)
+	{
+		return;
+	}
+	TimeSinceEvaluation = 0.0f;
+
+	Tracker.Hysteresis = Hysteresis;
+
+	const APawn* Player = UGameplayStatics::GetPlayerPawn(GetWorld(), 0);
+	if (!Player)
+	{
+		if (bHadPlayer)
+		{
+			bHadPlayer = false;
+			Tracker.ExitAll(PendingEvents);
+			DispatchEvents();
+		}
+		return;
+	}
+
+	if (TimeSinceZoneRefresh >= ZoneRefreshInterval)
+	{
+		TimeSinceZoneRefresh = 0.0f;
+		RefreshZoneLocations();
+	}
+	else
+	{
+		// Zones the player is inside decide exits, so keep them exact
+		for (const int32 Zone : Tracker.GetInsideZones())
+		{
+			if (const FZoneListener* Listener = Listeners.Find(Zone))
+			{
+				if (const AActor* Owner = Listener->Owner.Get())
+				{
+					bNeedsEvaluation |= Tracker.SetZoneLocation(Zone, Owner->GetActorLocation());
+				}
+			}
+		}
+	}
+
+	const FVector PlayerLocation = Player->GetActorLocation();
+	const float MoveThresholdSq = PlayerMoveThreshold * PlayerMoveThreshold;
+	if (!bHadPlayer || FVector::DistSquared(PlayerLocation, LastPlayerLocation) > MoveThresholdSq)
+	{
+		bNeedsEvaluation = true;
+	}
+
+	if (!bNeedsEvaluation)
+	{
+		return;
+	}
+
+	bHadPlayer = true;
+	bNeedsEvaluation = false;
+	LastPlayerLocation = PlayerLocation;
+
+	Tracker.Update(PlayerLocation, PendingEvents);
+	DispatchEvents();
+}
+
+void URfsnProximityManager::DispatchEvents()
+{
+	// Swap out first: callbacks may register or unregister zones
+	TArray<FRfsnProximityEvent> Events = MoveTemp(PendingEvents);
+	PendingEvents.Reset();
+
+	for (const FRfsnProximityEvent& Event : Events)
+	{
+		if (const FZoneListener* Listener = Listeners.Find(Event.Zone))
+		{
+			Listener->OnChanged.ExecuteIfBound(Event.bEntered);
+		}
+	}
+}
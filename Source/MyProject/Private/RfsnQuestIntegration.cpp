@@ -3,6 +3,7 @@
 #include "RfsnQuestIntegration.h"
 #include "RfsnLogging.h"
 #include "RfsnNpcClientComponent.h"
+#include "Engine/World.h"
 
 URfsnQuestIntegration::URfsnQuestIntegration()
 {
@@ -12,9 +13,97 @@ URfsnQuestIntegration::URfsnQuestIntegration()
 void URfsnQuestIntegration::BeginPlay()
 {
 	Super::BeginPlay();
+
+	ReleaseIndex();
+	if (UWorld* World = GetWorld())
+	{
+		Registry = World->GetSubsystem<URfsnQuestRegistry>();
+	}
+	IndexQuests();
+
 	RFSN_LOG(TEXT("QuestIntegration initialized for %s with %d quests"), *GetOwner()->GetName(), OfferedQuests.Num());
 }
 
+void URfsnQuestIntegration::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	ReleaseIndex();
+	Registry.Reset();
+
+	Super::EndPlay(EndPlayReason);
+}
+
+FRfsnQuestIndex& URfsnQuestIntegration::GetIndex() const
+{
+	URfsnQuestRegistry* QuestRegistry = Registry.Get();
+	return QuestRegistry ? QuestRegistry->GetIndex() : LocalIndex;
+}
+
+void URfsnQuestIntegration::RefreshQuests()
+{
+	IndexQuests();
+}
+
+void URfsnQuestIntegration::IndexQuests() const
+{
+	FRfsnQuestIndex& Index = GetIndex();
+	if (IndexedIn != &Index)
+	{
+		PatternSource = Index.AddSource();
+		IndexedIn = &Index;
+	}
+
+	QuestsById.Reset();
+	QuestsByPattern.Reset();
+	TArray<int32> Patterns;
+	Patterns.Reserve(OfferedQuests.Num() * 2);
+
+	for (int32 QuestIndex = 0; QuestIndex < OfferedQuests.Num(); QuestIndex++)
+	{
+		const FRfsnQuest& Quest = OfferedQuests[QuestIndex];
+		const int32 Id = Index.Intern(Quest.QuestId);
+		QuestsById.FindOrAdd(Id, QuestIndex);
+		QuestsByPattern.Add(Id, QuestIndex);
+		Patterns.Add(Id);
+
+		if (!Quest.DisplayName.IsEmpty())
+		{
+			const int32 NameId = Index.Intern(Quest.DisplayName);
+			QuestsByPattern.Add(NameId, QuestIndex);
+			Patterns.Add(NameId);
+		}
+	}
+	Index.SetPatterns(PatternSource, Patterns);
+
+	KnowledgeById.Reset();
+	for (int32 KnowledgeIndex = 0; KnowledgeIndex < QuestKnowledge.Num(); KnowledgeIndex++)
+	{
+		KnowledgeById.FindOrAdd(Index.Intern(QuestKnowledge[KnowledgeIndex].QuestId), KnowledgeIndex);
+	}
+
+	IndexedQuests = OfferedQuests.Num();
+	IndexedKnowledge = QuestKnowledge.Num();
+	bContextCached = false;
+}
+
+void URfsnQuestIntegration::EnsureIndexed() const
+{
+	if (IndexedIn != &GetIndex() || IndexedQuests != OfferedQuests.Num() || IndexedKnowledge != QuestKnowledge.Num())
+	{
+		IndexQuests();
+	}
+}
+
+void URfsnQuestIntegration::ReleaseIndex()
+{
+	FRfsnQuestIndex& Index = GetIndex();
+	if (IndexedIn == &Index)
+	{
+		Index.RemoveSource(PatternSource);
+	}
+	PatternSource = INDEX_NONE;
+	IndexedIn = nullptr;
+}
+
 bool URfsnQuestIntegration::StartQuest(const FString& QuestId)
 {
 	FRfsnQuest* Quest = FindQuest(QuestId);
@@ -29,6 +118,7 @@ bool URfsnQuestIntegration::StartQuest(const FString& QuestId)
 	}
 
 	Quest->Status = ERfsnQuestStatus::Active;
+	InvalidateQuestContext();
 	OnQuestStatusChanged.Broadcast(QuestId, ERfsnQuestStatus::Active);
 
 	RFSN_LOG(TEXT("Quest started: %s"), *Quest->DisplayName);
@@ -49,6 +139,7 @@ bool URfsnQuestIntegration::CompleteQuest(const FString& QuestId)
 	}
 
 	Quest->Status = ERfsnQuestStatus::Completed;
+	InvalidateQuestContext();
 	OnQuestStatusChanged.Broadcast(QuestId, ERfsnQuestStatus::Completed);
 
 	RFSN_LOG(TEXT("Quest completed: %s"), *Quest->DisplayName);
@@ -64,6 +155,7 @@ bool URfsnQuestIntegration::FailQuest(const FString& QuestId)
 	}
 
 	Quest->Status = ERfsnQuestStatus::Failed;
+	InvalidateQuestContext();
 	OnQuestStatusChanged.Broadcast(QuestId, ERfsnQuestStatus::Failed);
 
 	RFSN_LOG(TEXT("Quest failed: %s"), *Quest->DisplayName);
@@ -83,6 +175,7 @@ bool URfsnQuestIntegration::UpdateObjective(const FString& QuestId, const FStrin
 		if (Obj.ObjectiveId == ObjectiveId)
 		{
 			Obj.CurrentProgress = FMath::Min(Obj.CurrentProgress + Progress, Obj.RequiredProgress);
+			InvalidateQuestContext();
 			OnObjectiveProgress.Broadcast(QuestId, ObjectiveId);
 
 			// Check for quest completion
@@ -138,38 +231,56 @@ TArray<FRfsnQuest> URfsnQuestIntegration::GetActiveQuests() const
 
 FString URfsnQuestIntegration::GetQuestContext() const
 {
-	FString Context;
+	EnsureIndexed();
+	const uint32 Key = HashQuestContext();
+	if (bContextCached && CachedContextKey == Key)
+	{
+		return CachedContext;
+	}
+
+	FString& Context = CachedContext;
+	Context.Reset();
 
 	// Available quests
-	TArray<FRfsnQuest> Available = GetAvailableQuests();
-	if (Available.Num() > 0)
+	bool bAnyAvailable = false;
+	for (const FRfsnQuest& Quest : OfferedQuests)
 	{
-		Context += TEXT("NPC can offer quests: ");
-		for (const FRfsnQuest& Quest : Available)
+		if (Quest.Status == ERfsnQuestStatus::Available || Quest.Status == ERfsnQuestStatus::Unknown)
 		{
-			Context += FString::Printf(TEXT("[%s] "), *Quest.DisplayName);
+			if (!bAnyAvailable)
+			{
+				Context += TEXT("NPC can offer quests: ");
+				bAnyAvailable = true;
+			}
+			Context.Appendf(TEXT("[%s] "), *Quest.DisplayName);
 		}
 	}
 
 	// Active quests
-	TArray<FRfsnQuest> Active = GetActiveQuests();
-	if (Active.Num() > 0)
+	bool bAnyActive = false;
+	for (const FRfsnQuest& Quest : OfferedQuests)
 	{
-		Context += TEXT("Active quests from this NPC: ");
-		for (const FRfsnQuest& Quest : Active)
+		if (Quest.Status != ERfsnQuestStatus::Active)
 		{
-			int32 Complete = 0, Total = 0;
-			for (const FRfsnQuestObjective& Obj : Quest.Objectives)
+			continue;
+		}
+		if (!bAnyActive)
+		{
+			Context += TEXT("Active quests from this NPC: ");
+			bAnyActive = true;
+		}
+
+		int32 Complete = 0, Total = 0;
+		for (const FRfsnQuestObjective& Obj : Quest.Objectives)
+		{
+			if (!Obj.bOptional)
 			{
-				if (!Obj.bOptional)
-				{
-					Total++;
-					if (Obj.IsComplete())
-						Complete++;
-				}
+				Total++;
+				if (Obj.IsComplete())
+					Complete++;
 			}
-			Context += FString::Printf(TEXT("[%s: %d/%d objectives] "), *Quest.DisplayName, Complete, Total);
 		}
+		Context.Appendf(TEXT("[%s: %d/%d objectives] "), *Quest.DisplayName, Complete, Total);
 	}
 
 	// Quest knowledge
@@ -177,13 +288,41 @@ FString URfsnQuestIntegration::GetQuestContext() const
 	{
 		if (Knowledge.bCanProvideInfo && !Knowledge.DialogueHint.IsEmpty())
 		{
-			Context += FString::Printf(TEXT("Knows about quest '%s'. "), *Knowledge.QuestId);
+			Context.Appendf(TEXT("Knows about quest '%s'. "), *Knowledge.QuestId);
 		}
 	}
 
+	CachedContextKey = Key;
+	bContextCached = true;
 	return Context;
 }
 
+uint32 URfsnQuestIntegration::HashQuestContext() const
+{
+	// Everything GetQuestContext reads, so Blueprint writes to the arrays are seen without building the string
+	uint32 Hash = 0;
+	for (const FRfsnQuest& Quest : OfferedQuests)
+	{
+		Hash = HashCombine(Hash, GetTypeHash(static_cast<uint8>(Quest.Status)));
+		Hash = HashCombine(Hash, GetTypeHash(Quest.DisplayName));
+		if (Quest.Status != ERfsnQuestStatus::Active)
+		{
+			continue;
+		}
+		for (const FRfsnQuestObjective& Obj : Quest.Objectives)
+		{
+			const uint32 Counted = Obj.bOptional ? 0 : (Obj.IsComplete() ? 2 : 1);
+			Hash = HashCombine(Hash, Counted);
+		}
+	}
+	for (const FRfsnNpcQuestKnowledge& Knowledge : QuestKnowledge)
+	{
+		const bool bShown = Knowledge.bCanProvideInfo && !Knowledge.DialogueHint.IsEmpty();
+		Hash = HashCombine(Hash, bShown ? GetTypeHash(Knowledge.QuestId) : 0);
+	}
+	return Hash;
+}
+
 FString URfsnQuestIntegration::GetQuestDialogueHint(const FString& QuestId) const
 {
 	const FRfsnQuest* Quest = FindQuest(QuestId);
@@ -250,30 +389,29 @@ FString URfsnQuestIntegration::GetQuestInfo(const FString& QuestId) const
 
 TArray<FString> URfsnQuestIntegration::DetectQuestTopics(const FString& PlayerDialogue) const
 {
-	TArray<FString> Topics;
-	FString Lower = PlayerDialogue.ToLower();
+	EnsureIndexed();
 
-	// Check for quest keywords
-	static TArray<FString> QuestKeywords = {TEXT("quest"),   TEXT("mission"), TEXT("task"),        TEXT("job"),
-	                                        TEXT("help"),    TEXT("need"),    TEXT("looking for"), TEXT("find"),
-	                                        TEXT("deliver"), TEXT("kill"),    TEXT("collect"),     TEXT("retrieve")};
+	// One pass over the text finds every keyword, quest ID and quest name in the world
+	TArray<int32> Matched;
+	bool bKeyword = false;
+	GetIndex().Detect(PlayerDialogue, Matched, bKeyword);
 
-	for (const FString& Keyword : QuestKeywords)
+	TArray<FString> Topics;
+	if (bKeyword)
 	{
-		if (Lower.Contains(Keyword))
-		{
-			Topics.AddUnique(TEXT("Quest"));
-			break;
-		}
+		Topics.Add(TEXT("Quest"));
 	}
 
-	// Check for specific quest mentions
-	for (const FRfsnQuest& Quest : OfferedQuests)
+	// Keep the matches naming this NPC's quests, in offered order
+	TArray<int32> QuestIndices;
+	for (const int32 Id : Matched)
 	{
-		if (Lower.Contains(Quest.DisplayName.ToLower()) || Lower.Contains(Quest.QuestId.ToLower()))
-		{
-			Topics.AddUnique(Quest.QuestId);
-		}
+		QuestsByPattern.MultiFind(Id, QuestIndices);
+	}
+	QuestIndices.Sort();
+	for (const int32 QuestIndex : QuestIndices)
+	{
+		Topics.AddUnique(OfferedQuests[QuestIndex].QuestId);
 	}
 
 	return Topics;
@@ -281,18 +419,44 @@ TArray<FString> URfsnQuestIntegration::DetectQuestTopics(const FString& PlayerDi
 
 FRfsnQuest* URfsnQuestIntegration::FindQuest(const FString& QuestId)
 {
-	return OfferedQuests.FindByPredicate([&QuestId](const FRfsnQuest& Quest)
-	                                     { return Quest.QuestId.Equals(QuestId, ESearchCase::IgnoreCase); });
+	return const_cast<FRfsnQuest*>(static_cast<const URfsnQuestIntegration*>(this)->FindQuest(QuestId));
 }
 
 const FRfsnQuest* URfsnQuestIntegration::FindQuest(const FString& QuestId) const
 {
-	return OfferedQuests.FindByPredicate([&QuestId](const FRfsnQuest& Quest)
-	                                     { return Quest.QuestId.Equals(QuestId, ESearchCase::IgnoreCase); });
+	EnsureIndexed();
+	const int32* QuestIndex = QuestsById.Find(GetIndex().Find(QuestId));
+	if (QuestIndex && OfferedQuests[*QuestIndex].QuestId.Equals(QuestId, ESearchCase::IgnoreCase))
+	{
+		return &OfferedQuests[*QuestIndex];
+	}
+
+	// A miss, or a quest renamed in place since the last index (possibly to an ID never interned): the array is
+	// the truth, so scan it and re-index when the lookups turn out to be stale
+	const int32 Found = OfferedQuests.IndexOfByPredicate(
+	    [&QuestId](const FRfsnQuest& Quest) { return Quest.QuestId.Equals(QuestId, ESearchCase::IgnoreCase); });
+	if (QuestIndex || Found != INDEX_NONE)
+	{
+		IndexQuests();
+	}
+	return Found != INDEX_NONE ? &OfferedQuests[Found] : nullptr;
 }
 
 const FRfsnNpcQuestKnowledge* URfsnQuestIntegration::FindQuestKnowledge(const FString& QuestId) const
 {
-	return QuestKnowledge.FindByPredicate([&QuestId](const FRfsnNpcQuestKnowledge& Knowledge)
+	EnsureIndexed();
+	const int32* KnowledgeIndex = KnowledgeById.Find(GetIndex().Find(QuestId));
+	if (KnowledgeIndex && QuestKnowledge[*KnowledgeIndex].QuestId.Equals(QuestId, ESearchCase::IgnoreCase))
+	{
+		return &QuestKnowledge[*KnowledgeIndex];
+	}
+
+	const int32 Found =
+	    QuestKnowledge.IndexOfByPredicate([&QuestId](const FRfsnNpcQuestKnowledge& Knowledge)
 	                                      { return Knowledge.QuestId.Equals(QuestId, ESearchCase::IgnoreCase); });
+	if (KnowledgeIndex || Found != INDEX_NONE)
+	{
+		IndexQuests();
+	}
+	return Found != INDEX_NONE ? &QuestKnowledge[Found] : nullptr;
 }
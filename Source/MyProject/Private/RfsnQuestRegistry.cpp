@@ -0,0 +1,266 @@
+// RFSN Quest Registry Implementation
+
+#include "RfsnQuestRegistry.h"
+#include "RfsnLogging.h"
+
+namespace RfsnQuests
+{
+/** Words that make any line about quests (the "Quest" topic) */
+static const TCHAR* Keywords[] = {TEXT("quest"),   TEXT("mission"), TEXT("task"),        TEXT("job"),
+                                  TEXT("help"),    TEXT("need"),    TEXT("looking for"), TEXT("find"),
+                                  TEXT("deliver"), TEXT("kill"),    TEXT("collect"),     TEXT("retrieve")};
+} // namespace RfsnQuests
+
+// ─────────────────────────────────────────────────────────────
+// FRfsnQuestMatcher
+// ─────────────────────────────────────────────────────────────
+
+void FRfsnQuestMatcher::Add(const FString& Pattern, int32 Value)
+{
+	if (!Pattern.IsEmpty())
+	{
+		Patterns.Add({Pattern.ToLower(), Value});
+	}
+}
+
+void FRfsnQuestMatcher::Reset()
+{
+	Patterns.Reset();
+	Transitions.Reset();
+	FirstValue.Reset();
+	OutputLinks.Reset();
+	Values.Reset();
+	NextValue.Reset();
+	NumClasses = 0;
+}
+
+uint16 FRfsnQuestMatcher::GetClass(TCHAR Char) const
+{
+	if (static_cast<uint32>(Char) < 128)
+	{
+		return AsciiClasses[Char];
+	}
+	const uint16* Class = OtherClasses.Find(Char);
+	return Class ? *Class : 0;
+}
+
+void FRfsnQuestMatcher::Build()
+{
+	FMemory::Memzero(AsciiClasses);
+	OtherClasses.Reset();
+	NumClasses = 1;
+
+	for (const FPattern& Pattern : Patterns)
+	{
+		for (const TCHAR Char : Pattern.Text)
+		{
+			if (GetClass(Char) != 0)
+			{
+				continue;
+			}
+			if (static_cast<uint32>(Char) < 128)
+			{
+				AsciiClasses[Char] = static_cast<uint16>(NumClasses);
+			}
+			else
+			{
+				OtherClasses.Add(Char, static_cast<uint16>(NumClasses));
+			}
+			NumClasses++;
+		}
+	}
+
+	// Trie of the patterns; missing edges are INDEX_NONE until the failure pass fills them in
+	Transitions.Init(INDEX_NONE, NumClasses);
+	FirstValue.Init(INDEX_NONE, 1);
+	Values.Reset();
+	NextValue.Reset();
+
+	for (const FPattern& Pattern : Patterns)
+	{
+		int32 State = 0;
+		for (const TCHAR Char : Pattern.Text)
+		{
+			const int32 Edge = State * NumClasses + GetClass(Char);
+			if (Transitions[Edge] == INDEX_NONE)
+			{
+				Transitions[Edge] = FirstValue.Add(INDEX_NONE);
+				Transitions.AddUninitialized(NumClasses);
+				FMemory::Memset(&Transitions[Transitions[Edge] * NumClasses], 0xFF, NumClasses * sizeof(int32));
+			}
+			State = Transitions[Edge];
+		}
+		NextValue.Add(FirstValue[State]);
+		FirstValue[State] = Values.Add(Pattern.Value);
+	}
+
+	// Breadth-first: each state's failure state is shallower, so its transitions are already complete
+	const int32 NumStatesBuilt = FirstValue.Num();
+	TArray<int32> Failures;
+	Failures.Init(0, NumStatesBuilt);
+	OutputLinks.Init(0, NumStatesBuilt);
+
+	TArray<int32> Queue;
+	Queue.Reserve(NumStatesBuilt);
+	for (int32 Class = 0; Class < NumClasses; Class++)
+	{
+		int32& Next = Transitions[Class];
+		if (Next == INDEX_NONE)
+		{
+			Next = 0;
+		}
+		else
+		{
+			Queue.Add(Next);
+		}
+	}
+
+	for (int32 Head = 0; Head < Queue.Num(); Head++)
+	{
+		const int32 State = Queue[Head];
+		const int32 Failure = Failures[State];
+		OutputLinks[State] = FirstValue[Failure] != INDEX_NONE ? Failure : OutputLinks[Failure];
+
+		for (int32 Class = 0; Class < NumClasses; Class++)
+		{
+			int32& Next = Transitions[State * NumClasses + Class];
+			const int32 FailureNext = Transitions[Failure * NumClasses + Class];
+			if (Next == INDEX_NONE)
+			{
+				Next = FailureNext;
+			}
+			else
+			{
+				Failures[Next] = FailureNext;
+				Queue.Add(Next);
+			}
+		}
+	}
+}
+
+void FRfsnQuestMatcher::Match(const FString& Text, TArray<int32>& OutValues) const
+{
+	if (Patterns.Num() == 0 || NumClasses == 0)
+	{
+		return;
+	}
+
+	int32 State = 0;
+	for (const TCHAR Char : Text)
+	{
+		State = Transitions[State * NumClasses + GetClass(FChar::ToLower(Char))];
+		for (int32 Output = FirstValue[State] != INDEX_NONE ? State : OutputLinks[State]; Output != 0;
+		     Output = OutputLinks[Output])
+		{
+			for (int32 Value = FirstValue[Output]; Value != INDEX_NONE; Value = NextValue[Value])
+			{
+				OutValues.Add(Values[Value]);
+			}
+		}
+	}
+}
+
+// ─────────────────────────────────────────────────────────────
+// FRfsnQuestIndex
+// ─────────────────────────────────────────────────────────────
+
+uint32 FRfsnQuestIndex::FKeyFuncs::GetKeyHash(const FString& Key)
+{
+	uint32 Hash = 2166136261u;
+	for (const TCHAR Char : Key)
+	{
+		Hash = (Hash ^ static_cast<uint32>(FChar::ToLower(Char))) * 16777619u;
+	}
+	return Hash;
+}
+
+int32 FRfsnQuestIndex::Intern(const FString& Text)
+{
+	if (const int32* Id = Ids.Find(Text))
+	{
+		return *Id;
+	}
+	const int32 Id = Strings.Add(Text.ToLower());
+	Ids.Add(Text, Id);
+	return Id;
+}
+
+int32 FRfsnQuestIndex::Find(const FString& Text) const
+{
+	const int32* Id = Ids.Find(Text);
+	return Id ? *Id : INDEX_NONE;
+}
+
+int32 FRfsnQuestIndex::AddSource()
+{
+	return Sources.Add(TArray<int32>());
+}
+
+void FRfsnQuestIndex::RemoveSource(int32 Source)
+{
+	if (Sources.IsValidIndex(Source))
+	{
+		bDirty |= Sources[Source].Num() > 0;
+		Sources.RemoveAt(Source);
+	}
+}
+
+void FRfsnQuestIndex::SetPatterns(int32 Source, const TArray<int32>& PatternIds)
+{
+	if (Sources.IsValidIndex(Source) && Sources[Source] != PatternIds)
+	{
+		Sources[Source] = PatternIds;
+		bDirty = true;
+	}
+}
+
+void FRfsnQuestIndex::Build()
+{
+	Matcher.Reset();
+	for (const TCHAR* Keyword : RfsnQuests::Keywords)
+	{
+		Matcher.Add(Keyword, INDEX_NONE);
+	}
+
+	TBitArray<> Added(false, Strings.Num());
+	for (const TArray<int32>& PatternIds : Sources)
+	{
+		for (const int32 Id : PatternIds)
+		{
+			if (!Added[Id])
+			{
+				Added[Id] = true;
+				Matcher.Add(Strings[Id], Id);
+			}
+		}
+	}
+
+	Matcher.Build();
+	bDirty = false;
+	NumBuilds++;
+	RFSN_LOG(TEXT("QuestIndex: matcher built with %d patterns (%d states)"), Matcher.NumPatterns(),
+	         Matcher.NumStates());
+}
+
+void FRfsnQuestIndex::Detect(const FString& Text, TArray<int32>& OutIds, bool& bOutKeyword)
+{
+	if (bDirty)
+	{
+		Build();
+	}
+
+	bOutKeyword = false;
+	Matches.Reset();
+	Matcher.Match(Text, Matches);
+	for (const int32 Id : Matches)
+	{
+		if (Id == INDEX_NONE)
+		{
+			bOutKeyword = true;
+		}
+		else
+		{
+			OutIds.AddUnique(Id);
+		}
+	}
+}
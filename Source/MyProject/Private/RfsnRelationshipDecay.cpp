@@ -3,6 +3,8 @@
 #include "RfsnRelationshipDecay.h"
 #include "RfsnLogging.h"
 #include "RfsnNpcClientComponent.h"
+#include "RfsnRelationshipDecayManager.h"
+#include "Engine/World.h"
 
 URfsnRelationshipDecay::URfsnRelationshipDecay()
 {
@@ -13,19 +15,84 @@ void URfsnRelationshipDecay::BeginPlay()
 {
 	Super::BeginPlay();
 	UpdateTier();
+
+	if (UWorld* World = GetWorld())
+	{
+		Manager = World->GetSubsystem<URfsnRelationshipDecayManager>();
+	}
+	if (URfsnRelationshipDecayManager* DecayManager = Manager.Get())
+	{
+		ManagedSlot = DecayManager->Register(this);
+	}
+
 	RFSN_LOG(TEXT("RelationshipDecay initialized for %s (value: %.1f)"), *GetOwner()->GetName(), CurrentValue);
 }
 
+void URfsnRelationshipDecay::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	if (URfsnRelationshipDecayManager* DecayManager = Manager.Get())
+	{
+		// Keep the decayed state in case the component registers again
+		RefreshFromManager();
+		DecayManager->Unregister(ManagedSlot);
+	}
+	Manager.Reset();
+	ManagedSlot = INDEX_NONE;
+
+	Super::EndPlay(EndPlayReason);
+}
+
+void URfsnRelationshipDecay::RefreshFromManager()
+{
+	const URfsnRelationshipDecayManager* DecayManager = ManagedSlot != INDEX_NONE ? Manager.Get() : nullptr;
+	if (DecayManager)
+	{
+		CurrentValue = DecayManager->GetValue(ManagedSlot);
+		HoursSinceInteraction = DecayManager->GetHoursSinceInteraction(ManagedSlot);
+	}
+}
+
+void URfsnRelationshipDecay::CommitValue(float Value)
+{
+	CurrentValue = Value;
+	if (URfsnRelationshipDecayManager* DecayManager = Manager.Get())
+	{
+		DecayManager->SetValue(ManagedSlot, CurrentValue, bIsLocked);
+	}
+}
+
+float URfsnRelationshipDecay::GetCurrentValue() const
+{
+	const URfsnRelationshipDecayManager* DecayManager = ManagedSlot != INDEX_NONE ? Manager.Get() : nullptr;
+	return DecayManager ? DecayManager->GetValue(ManagedSlot) : CurrentValue;
+}
+
+float URfsnRelationshipDecay::GetHoursSinceInteraction() const
+{
+	const URfsnRelationshipDecayManager* DecayManager = ManagedSlot != INDEX_NONE ? Manager.Get() : nullptr;
+	return DecayManager ? DecayManager->GetHoursSinceInteraction(ManagedSlot) : HoursSinceInteraction;
+}
+
+void URfsnRelationshipDecay::RefreshDecaySettings()
+{
+	if (URfsnRelationshipDecayManager* DecayManager = Manager.Get())
+	{
+		DecayManager->UpdateDecay(ManagedSlot);
+	}
+}
+
 void URfsnRelationshipDecay::ModifyRelationship(float Amount, const FString& Reason)
 {
+	RefreshFromManager();
 	float OldValue = CurrentValue;
-	CurrentValue = FMath::Clamp(CurrentValue + Amount, MinValue, MaxValue);
 
 	// Check for lock
-	if (CurrentValue >= LockThreshold)
+	const float NewValue = FMath::Clamp(CurrentValue + Amount, MinValue, MaxValue);
+	if (NewValue >= LockThreshold)
 	{
 		bIsLocked = true;
 	}
+	CommitValue(NewValue);
 
 	// Record bonus
 	if (Amount != 0.0f && !Reason.IsEmpty())
@@ -36,8 +103,8 @@ void URfsnRelationshipDecay::ModifyRelationship(float Amount, const FString& Rea
 		Bonus.Timestamp = FDateTime::Now();
 		RecentBonuses.Add(Bonus);
 
-		// Keep only recent bonuses
-		while (RecentBonuses.Num() > 10)
+		// Keep only the latest
+		if (RecentBonuses.Num() > MaxRecentBonuses)
 		{
 			RecentBonuses.RemoveAt(0);
 		}
@@ -56,6 +123,10 @@ void URfsnRelationshipDecay::ModifyRelationship(float Amount, const FString& Rea
 void URfsnRelationshipDecay::RecordInteraction()
 {
 	HoursSinceInteraction = 0.0f;
+	if (URfsnRelationshipDecayManager* DecayManager = Manager.Get())
+	{
+		DecayManager->RecordInteraction(ManagedSlot);
+	}
 }
 
 void URfsnRelationshipDecay::GiveGift(float Value)
@@ -80,48 +151,54 @@ void URfsnRelationshipDecay::Betray(float Value)
 {
 	ModifyRelationship(Value, TEXT("Betrayal"));
 	bIsLocked = false; // Betrayal breaks lock
+	CommitValue(CurrentValue);
 	RecordInteraction();
 }
 
 void URfsnRelationshipDecay::TickDecay(float GameHoursElapsed)
 {
-	if (bIsLocked)
+	if (bIsLocked || GameHoursElapsed <= 0.0f)
 	{
 		return; // No decay for best friends
 	}
 
-	HoursSinceInteraction += GameHoursElapsed;
+	RefreshFromManager();
+	const float OldValue = CurrentValue;
 
-	// Check grace period
-	if (HoursSinceInteraction < DecayGracePeriodHours)
+	if (URfsnRelationshipDecayManager* DecayManager = Manager.Get())
 	{
-		return;
+		DecayManager->FastForward(ManagedSlot, GameHoursElapsed);
+		RefreshFromManager();
 	}
-
-	// Calculate decay
-	float DaysElapsed = GameHoursElapsed / 24.0f;
-	float DecayRate = CalculateDecayRate();
-	float DecayAmount = DecayRate * DaysElapsed;
-
-	if (DecayAmount > 0.0f)
+	else
 	{
-		float OldValue = CurrentValue;
-
-		// Decay toward neutral
-		if (CurrentValue > 0)
+		// Only the hours past the grace period decay
+		const float OldHours = HoursSinceInteraction;
+		HoursSinceInteraction += GameHoursElapsed;
+		const float DecayHours = HoursSinceInteraction - FMath::Max(OldHours, DecayGracePeriodHours);
+		if (DecayHours > 0.0f)
 		{
-			CurrentValue = FMath::Max(0.0f, CurrentValue - DecayAmount);
-		}
-		else if (CurrentValue < 0)
-		{
-			CurrentValue = FMath::Min(0.0f, CurrentValue + DecayAmount);
+			CurrentValue =
+			    FRfsnRelationshipLedger::Decay(CurrentValue, DecayHours, RfsnRelationship::MakeParams(this));
 		}
+	}
 
-		if (FMath::Abs(CurrentValue - OldValue) >= 1.0f)
-		{
-			UpdateTier();
-			OnRelationshipDecayed.Broadcast(OldValue, CurrentValue);
-		}
+	UpdateTier();
+	if (FMath::Abs(CurrentValue - OldValue) >= 1.0f)
+	{
+		OnRelationshipDecayed.Broadcast(OldValue, CurrentValue);
+	}
+}
+
+void URfsnRelationshipDecay::HandleTierCrossed()
+{
+	const float OldValue = CurrentValue;
+	RefreshFromManager();
+	UpdateTier();
+
+	if (FMath::Abs(CurrentValue - OldValue) >= 1.0f)
+	{
+		OnRelationshipDecayed.Broadcast(OldValue, CurrentValue);
 	}
 }
 
@@ -163,13 +240,14 @@ FString URfsnRelationshipDecay::TierToString(ERfsnRelationshipTier Tier)
 
 FString URfsnRelationshipDecay::GetRelationshipContext() const
 {
-	FString Context = FString::Printf(TEXT("Relationship: %s (%.0f). "), *TierToString(CurrentTier), CurrentValue);
+	FString Context =
+	    FString::Printf(TEXT("Relationship: %s (%.0f). "), *TierToString(CurrentTier), GetCurrentValue());
 
 	if (bIsLocked)
 	{
 		Context += TEXT("This is a deep friendship that won't fade. ");
 	}
-	else if (HoursSinceInteraction > DecayGracePeriodHours * 2)
+	else if (GetHoursSinceInteraction() > DecayGracePeriodHours * 2)
 	{
 		Context += TEXT("We haven't talked in a long time. ");
 	}
@@ -197,9 +275,10 @@ FString URfsnRelationshipDecay::GetDecayWarning() const
 		return TEXT("");
 	}
 
-	if (HoursSinceInteraction > DecayGracePeriodHours)
+	const float Hours = GetHoursSinceInteraction();
+	if (Hours > DecayGracePeriodHours)
 	{
-		float DaysWithoutContact = (HoursSinceInteraction - DecayGracePeriodHours) / 24.0f;
+		float DaysWithoutContact = (Hours - DecayGracePeriodHours) / 24.0f;
 		if (DaysWithoutContact > 3.0f)
 		{
 			return FString::Printf(TEXT("%s relationship is fading (%.0f days without contact)."),
@@ -212,11 +291,12 @@ FString URfsnRelationshipDecay::GetDecayWarning() const
 
 void URfsnRelationshipDecay::SetInitialValue(float Value)
 {
-	CurrentValue = FMath::Clamp(Value, MinValue, MaxValue);
-	if (CurrentValue >= LockThreshold)
+	const float NewValue = FMath::Clamp(Value, MinValue, MaxValue);
+	if (NewValue >= LockThreshold)
 	{
 		bIsLocked = true;
 	}
+	CommitValue(NewValue);
 	UpdateTier();
 }
 
@@ -233,34 +313,3 @@ void URfsnRelationshipDecay::UpdateTier()
 		         *TierToString(NewTier));
 	}
 }
-
-float URfsnRelationshipDecay::CalculateDecayRate() const
-{
-	float Rate = DecayRatePerDay;
-
-	if (CurrentValue > 0)
-	{
-		// Positive relationships decay slower
-		Rate *= PositiveDecayMultiplier;
-	}
-	else if (CurrentValue < 0)
-	{
-		// Negative relationships move toward neutral faster
-		Rate *= NegativeDecayMultiplier;
-	}
-
-	// Higher tier = slower decay
-	switch (CurrentTier)
-	{
-	case ERfsnRelationshipTier::Trusted:
-		Rate *= 0.5f;
-		break;
-	case ERfsnRelationshipTier::Friendly:
-		Rate *= 0.75f;
-		break;
-	default:
-		break;
-	}
-
-	return Rate;
-}
@@ -0,0 +1,530 @@
+// RFSN Relationship Decay Manager Implementation
+
+#include "RfsnRelationshipDecayManager.h"
+#include "RfsnGameClock.h"
+#include "RfsnLogging.h"
+#include "Engine/World.h"
+
+namespace RfsnRelationship
+{
+FRfsnRelationshipDecayParams MakeParams(const URfsnRelationshipDecay* Relationship)
+{
+	FRfsnRelationshipDecayParams Params;
+	Params.DecayRatePerDay = Relationship->DecayRatePerDay;
+	Params.GracePeriodHours = Relationship->DecayGracePeriodHours;
+	Params.PositiveMultiplier = Relationship->PositiveDecayMultiplier;
+	Params.NegativeMultiplier = Relationship->NegativeDecayMultiplier;
+	return Params;
+}
+} // namespace RfsnRelationship
+
+// ─────────────────────────────────────────────────────────────
+// FRfsnRelationshipLedger
+// ─────────────────────────────────────────────────────────────
+
+float FRfsnRelationshipLedger::GetDecayRatePerDay(float Value, const FRfsnRelationshipDecayParams& InParams)
+{
+	float Rate = InParams.DecayRatePerDay;
+
+	if (Value > 0)
+	{
+		// Positive relationships decay slower
+		Rate *= InParams.PositiveMultiplier;
+	}
+	else if (Value < 0)
+	{
+		// Negative relationships move toward neutral faster
+		Rate *= InParams.NegativeMultiplier;
+	}
+
+	// Higher tier = slower decay
+	switch (URfsnRelationshipDecay::ValueToTier(Value))
+	{
+	case ERfsnRelationshipTier::Trusted:
+		Rate *= 0.5f;
+		break;
+	case ERfsnRelationshipTier::Friendly:
+		Rate *= 0.75f;
+		break;
+	default:
+		break;
+	}
+
+	return Rate;
+}
+
+float FRfsnRelationshipLedger::GetNextStop(float Value)
+{
+	using namespace RfsnRelationship;
+
+	if (Value > 0)
+	{
+		int32 Stop = NumStops - 1;
+		while (Stops[Stop] >= Value)
+		{
+			Stop--;
+		}
+		return Stops[Stop];
+	}
+
+	int32 Stop = 0;
+	while (Stops[Stop] <= Value)
+	{
+		Stop++;
+	}
+	return Stops[Stop];
+}
+
+float FRfsnRelationshipLedger::Decay(float Value, double Hours, const FRfsnRelationshipDecayParams& InParams)
+{
+	// Within one segment between stops the tier, and so the rate, is fixed
+	while (Hours > 0.0 && Value != 0.0f)
+	{
+		const float Stop = GetNextStop(Value);
+		const double Rate = GetDecayRatePerDay(0.5f * (Value + Stop), InParams) / 24.0;
+		if (Rate <= 0.0)
+		{
+			break;
+		}
+
+		const double Needed = FMath::Abs(Value - Stop) / Rate;
+		if (Needed > Hours)
+		{
+			return static_cast<float>(Value > 0 ? Value - Rate * Hours : Value + Rate * Hours);
+		}
+		Hours -= Needed;
+		Value = Stop;
+	}
+	return Value;
+}
+
+double FRfsnRelationshipLedger::HoursToReach(float Value, float Target, const FRfsnRelationshipDecayParams& InParams)
+{
+	double Hours = 0.0;
+	while (Value != Target)
+	{
+		if (Value == 0.0f)
+		{
+			return TNumericLimits<double>::Max();
+		}
+
+		const float Stop = Value > 0 ? FMath::Max(GetNextStop(Value), Target) : FMath::Min(GetNextStop(Value), Target);
+		const double Rate = GetDecayRatePerDay(0.5f * (Value + Stop), InParams) / 24.0;
+		if (Rate <= 0.0)
+		{
+			return TNumericLimits<double>::Max();
+		}
+
+		Hours += FMath::Abs(Value - Stop) / Rate;
+		Value = Stop;
+	}
+	return Hours;
+}
+
+int32 FRfsnRelationshipLedger::Add(const FRfsnRelationshipDecayParams& InParams, float Value, bool bLocked,
+                                   double HoursSinceInteraction, double Now)
+{
+	int32 Npc;
+	if (FreeSlots.Num() > 0)
+	{
+		Npc = FreeSlots.Pop(EAllowShrinking::No);
+		Active[Npc] = true;
+	}
+	else
+	{
+		Npc = Active.Add(true);
+		BaseValues.AddUninitialized();
+		BaseHours.AddUninitialized();
+		InteractionHours.AddUninitialized();
+		Params.AddDefaulted();
+		Locked.Add(false);
+		Generations.Add(0);
+	}
+
+	BaseValues[Npc] = Value;
+	BaseHours[Npc] = Now;
+	InteractionHours[Npc] = Now - FMath::Max(HoursSinceInteraction, 0.0);
+	Params[Npc] = InParams;
+	Locked[Npc] = bLocked;
+
+	ScheduleNext(Npc, Now);
+	return Npc;
+}
+
+void FRfsnRelationshipLedger::Remove(int32 Npc)
+{
+	if (!IsValid(Npc))
+	{
+		return;
+	}
+
+	// Queued events die with the generation
+	Generations[Npc]++;
+	Active[Npc] = false;
+	FreeSlots.Add(Npc);
+}
+
+float FRfsnRelationshipLedger::GetValue(int32 Npc, double Now) const
+{
+	if (Locked[Npc])
+	{
+		return BaseValues[Npc]; // No decay for best friends
+	}
+
+	const double Elapsed = Now - GetDecayStart(Npc);
+	return Elapsed > 0.0 ? Decay(BaseValues[Npc], Elapsed, Params[Npc]) : BaseValues[Npc];
+}
+
+void FRfsnRelationshipLedger::Rebase(int32 Npc, double Now)
+{
+	BaseValues[Npc] = GetValue(Npc, Now);
+	BaseHours[Npc] = Now;
+}
+
+void FRfsnRelationshipLedger::SetValue(int32 Npc, float Value, bool bLocked, double Now)
+{
+	if (!IsValid(Npc))
+	{
+		return;
+	}
+
+	Rebase(Npc, Now);
+	BaseValues[Npc] = Value;
+	Locked[Npc] = bLocked;
+	ScheduleNext(Npc, Now);
+}
+
+void FRfsnRelationshipLedger::RecordInteraction(int32 Npc, double Now)
+{
+	if (!IsValid(Npc))
+	{
+		return;
+	}
+
+	Rebase(Npc, Now);
+	InteractionHours[Npc] = Now;
+	ScheduleNext(Npc, Now);
+}
+
+void FRfsnRelationshipLedger::FastForward(int32 Npc, double Hours, double Now)
+{
+	if (!IsValid(Npc) || Hours <= 0.0)
+	{
+		return;
+	}
+
+	BaseHours[Npc] -= Hours;
+	InteractionHours[Npc] -= Hours;
+	ScheduleNext(Npc, Now);
+}
+
+void FRfsnRelationshipLedger::SetParams(int32 Npc, const FRfsnRelationshipDecayParams& InParams, double Now)
+{
+	if (!IsValid(Npc))
+	{
+		return;
+	}
+
+	Rebase(Npc, Now);
+	Params[Npc] = InParams;
+	ScheduleNext(Npc, Now);
+}
+
+void FRfsnRelationshipLedger::Rewind(double Now)
+{
+	Events.Reset();
+	for (int32 Npc = 0; Npc < Active.Num(); Npc++)
+	{
+		if (!Active[Npc])
+		{
+			continue;
+		}
+
+		// Shift both times so the hours since the last interaction carry over
+		const double Shift = BaseHours[Npc] - Now;
+		if (Shift > 0.0)
+		{
+			BaseHours[Npc] -= Shift;
+			InteractionHours[Npc] -= Shift;
+		}
+		ScheduleNext(Npc, Now);
+	}
+}
+
+void FRfsnRelationshipLedger::ScheduleNext(int32 Npc, double Now)
+{
+	using namespace RfsnRelationship;
+
+	const uint32 Generation = ++Generations[Npc];
+	if (Locked[Npc])
+	{
+		return;
+	}
+
+	// Values only move toward neutral, so the next crossing is the nearest tier boundary on that side
+	const float Value = GetValue(Npc, Now);
+	float Boundary = 0.0f;
+	for (const float Stop : Stops)
+	{
+		if (Value > 0 && Stop > 0 && Stop <= Value)
+		{
+			Boundary = Stop;
+		}
+		else if (Value < 0 && Stop < 0 && Stop > Value && Boundary == 0.0f)
+		{
+			Boundary = Stop;
+		}
+	}
+	if (Boundary == 0.0f)
+	{
+		return;
+	}
+
+	const double Hours = HoursToReach(BaseValues[Npc], Boundary, Params[Npc]);
+	if (Hours < TNumericLimits<double>::Max())
+	{
+		// Every change leaves the NPC's previous event behind; an NPC touched often would otherwise grow the heap
+		// without bound until those far-off times came due
+		if (Events.Num() >= FMath::Max(MinEventsToCompact, 2 * Num()))
+		{
+			CompactEvents();
+		}
+		Events.HeapPush({GetDecayStart(Npc) + Hours + CrossingSlackHours, Npc, Generation});
+	}
+}
+
+void FRfsnRelationshipLedger::CompactEvents()
+{
+	// At most one event per NPC is live, so this leaves the heap no larger than Num()
+	Events.RemoveAllSwap([this](const FEvent& Event) { return !IsLive(Event); }, EAllowShrinking::No);
+	Events.Heapify();
+}
+
+void FRfsnRelationshipLedger::PopDue(double Now, TArray<int32>& OutNpcs)
+{
+	while (Events.Num() > 0 && Events.HeapTop().Time <= Now)
+	{
+		FEvent Event;
+		Events.HeapPop(Event, EAllowShrinking::No);
+
+		if (!IsLive(Event))
+		{
+			continue;
+		}
+
+		// Invalidate so a second queued copy can't report it twice; the caller reschedules
+		Generations[Event.Npc]++;
+		OutNpcs.Add(Event.Npc);
+	}
+}
+
+// ─────────────────────────────────────────────────────────────
+// URfsnRelationshipDecayManager
+// ─────────────────────────────────────────────────────────────
+
+void URfsnRelationshipDecayManager::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	// The clock is another world subsystem: ask for it so it exists before OnWorldBeginPlay
+	Collection.InitializeDependency<URfsnGameClock>();
+}
+
+void URfsnRelationshipDecayManager::OnWorldBeginPlay(UWorld& InWorld)
+{
+	Super::OnWorldBeginPlay(InWorld);
+
+	Clock = InWorld.GetSubsystem<URfsnGameClock>();
+	if (URfsnGameClock* GameClock = Clock.Get())
+	{
+		GameClock->OnTimeJumped.AddDynamic(this, &URfsnRelationshipDecayManager::HandleClockJumped);
+	}
+	UpdateEventTimer();
+}
+
+void URfsnRelationshipDecayManager::Deinitialize()
+{
+	if (URfsnGameClock* GameClock = Clock.Get())
+	{
+		GameClock->CancelTimer(EventTimer);
+		GameClock->OnTimeJumped.RemoveDynamic(this, &URfsnRelationshipDecayManager::HandleClockJumped);
+	}
+	EventTimer = INDEX_NONE;
+	EventTimerHours = TNumericLimits<double>::Max();
+	Clock.Reset();
+
+	Components.Empty();
+	Ledger = FRfsnRelationshipLedger();
+	Super::Deinitialize();
+}
+
+double URfsnRelationshipDecayManager::GetNow() const
+{
+	const URfsnGameClock* GameClock = Clock.Get();
+	return GameClock ? GameClock->GetGameMinutes() / 60.0 : LocalHours;
+}
+
+int32 URfsnRelationshipDecayManager::Register(URfsnRelationshipDecay* Relationship)
+{
+	if (!Relationship)
+	{
+		return INDEX_NONE;
+	}
+
+	// A component registering mid-game brings the hours it has already gone without interaction
+	const int32 Slot = Ledger.Add(RfsnRelationship::MakeParams(Relationship), Relationship->CurrentValue,
+	                              Relationship->bIsLocked, Relationship->HoursSinceInteraction, GetNow());
+	if (Slot >= Components.Num())
+	{
+		Components.SetNum(Slot + 1);
+	}
+	Components[Slot] = Relationship;
+
+	UpdateEventTimer();
+	return Slot;
+}
+
+void URfsnRelationshipDecayManager::Unregister(int32 Slot)
+{
+	if (Ledger.IsValid(Slot))
+	{
+		Ledger.Remove(Slot);
+		Components[Slot].Reset();
+	}
+}
+
+float URfsnRelationshipDecayManager::GetValue(int32 Slot) const
+{
+	return Ledger.IsValid(Slot) ? Ledger.GetValue(Slot, GetNow()) : 0.0f;
+}
+
+float URfsnRelationshipDecayManager::GetHoursSinceInteraction(int32 Slot) const
+{
+	return Ledger.IsValid(Slot) ? static_cast<float>(Ledger.GetHoursSinceInteraction(Slot, GetNow())) : 0.0f;
+}
+
+void URfsnRelationshipDecayManager::SetValue(int32 Slot, float Value, bool bLocked)
+{
+	Ledger.SetValue(Slot, Value, bLocked, GetNow());
+	UpdateEventTimer();
+}
+
+void URfsnRelationshipDecayManager::RecordInteraction(int32 Slot)
+{
+	Ledger.RecordInteraction(Slot, GetNow());
+	UpdateEventTimer();
+}
+
+void URfsnRelationshipDecayManager::FastForward(int32 Slot, float Hours)
+{
+	Ledger.FastForward(Slot, Hours, GetNow());
+	UpdateEventTimer();
+}
+
+void URfsnRelationshipDecayManager::UpdateDecay(int32 Slot)
+{
+	if (Ledger.IsValid(Slot))
+	{
+		if (const URfsnRelationshipDecay* Relationship = Components[Slot].Get())
+		{
+			Ledger.SetParams(Slot, RfsnRelationship::MakeParams(Relationship), GetNow());
+			UpdateEventTimer();
+		}
+	}
+}
+
+void URfsnRelationshipDecayManager::SkipTime(float Hours)
+{
+	if (Hours <= 0.0f)
+	{
+		return;
+	}
+
+	// Each component fast-forwards its own slot, so it refreshes its tier and broadcasts the decay once
+	for (int32 Slot = 0; Slot < Components.Num(); Slot++)
+	{
+		if (!Ledger.IsValid(Slot))
+		{
+			continue;
+		}
+		if (URfsnRelationshipDecay* Relationship = Components[Slot].Get())
+		{
+			Relationship->TickDecay(Hours);
+		}
+		else
+		{
+			Unregister(Slot);
+		}
+	}
+}
+
+void URfsnRelationshipDecayManager::UpdateEventTimer()
+{
+	URfsnGameClock* GameClock = Clock.Get();
+	const double Next = Ledger.GetNextEventTime();
+	if (!GameClock || Next == TNumericLimits<double>::Max())
+	{
+		return;
+	}
+
+	// An earlier timer already covers it; if its event went stale it fires and reschedules
+	if (EventTimer != INDEX_NONE && EventTimerHours <= Next)
+	{
+		return;
+	}
+
+	GameClock->CancelTimer(EventTimer);
+	EventTimer = GameClock->ScheduleAt(
+	    Next * 60.0, FRfsnGameClockCallback::CreateUObject(this, &URfsnRelationshipDecayManager::HandleEventTimer));
+	EventTimerHours = Next;
+}
+
+void URfsnRelationshipDecayManager::HandleEventTimer()
+{
+	EventTimer = INDEX_NONE;
+	EventTimerHours = TNumericLimits<double>::Max();
+	ProcessDue();
+	UpdateEventTimer();
+}
+
+void URfsnRelationshipDecayManager::ProcessDue()
+{
+	const double Now = GetNow();
+	if (Ledger.GetNextEventTime() > Now)
+	{
+		return;
+	}
+
+	DueSlots.Reset();
+	Ledger.PopDue(Now, DueSlots);
+
+	for (const int32 Slot : DueSlots)
+	{
+		// Queue the next crossing first: the callback may change the value, which queues again
+		Ledger.ScheduleNext(Slot, Now);
+
+		if (URfsnRelationshipDecay* Relationship = Components[Slot].Get())
+		{
+			Relationship->HandleTierCrossed();
+		}
+		else
+		{
+			Unregister(Slot);
+		}
+	}
+}
+
+void URfsnRelationshipDecayManager::HandleClockJumped()
+{
+	// Pending timers keep their game times, which now lie too far ahead
+	if (URfsnGameClock* GameClock = Clock.Get())
+	{
+		GameClock->CancelTimer(EventTimer);
+	}
+	EventTimer = INDEX_NONE;
+	EventTimerHours = TNumericLimits<double>::Max();
+
+	Ledger.Rewind(GetNow());
+	UpdateEventTimer();
+	RFSN_LOG(TEXT("Relationship decay rewound to hour %.1f for %d NPCs"), GetNow(), Ledger.Num());
+}
@@ -264,6 +264,19 @@ void URfsnRelationshipManager::ClearSavedRelationships()
 	}
 }
 
+URfsnNpcClientComponent* URfsnRelationshipManager::FindNpcClient(const FString& NpcId) const
+{
+	for (const TWeakObjectPtr<URfsnNpcClientComponent>& WeakClient : RegisteredClients)
+	{
+		URfsnNpcClientComponent* Client = WeakClient.Get();
+		if (Client && Client->NpcId == NpcId)
+		{
+			return Client;
+		}
+	}
+	return nullptr;
+}
+
 TArray<FString> URfsnRelationshipManager::GetAllNpcIds() const
 {
 	TArray<FString> Ids;
@@ -3,6 +3,7 @@
 #include "RfsnReplicatedDialogue.h"
 #include "RfsnNpcClientComponent.h"
 #include "RfsnLogging.h"
+#include "RfsnTokenDecoder.h"
 #include "Net/UnrealNetwork.h"
 #include "GameFramework/Actor.h"
 
@@ -72,6 +73,7 @@ void URfsnReplicatedDialogue::MulticastShowSentence_Implementation(const FString
 void URfsnReplicatedDialogue::MulticastNpcAction_Implementation(ERfsnNpcAction Action)
 {
 	CurrentAction = Action;
+	RFSN_DIALOGUE_LOG(TEXT("[Multicast] Action: %s"), FRfsnTokenDecoder::GetActionName(Action));
 }
 
 void URfsnReplicatedDialogue::ServerRequestDialogue_Implementation(const FString& PlayerUtterance)
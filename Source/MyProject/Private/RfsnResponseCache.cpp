@@ -0,0 +1,622 @@
+// RFSN Response Cache Implementation
+
+#include "RfsnResponseCache.h"
+#include "RfsnEmotionBlend.h"
+#include "RfsnLogging.h"
+#include "RfsnNpcAwareness.h"
+#include "RfsnQuestIntegration.h"
+#include "RfsnTokenDecoder.h"
+#include "RfsnTrace.h"
+#include "Dom/JsonObject.h"
+#include "HAL/FileManager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+#include "Serialization/JsonWriter.h"
+
+// ─────────────────────────────────────────────────────────────
+// FRfsnResponseCacheStore
+// ─────────────────────────────────────────────────────────────
+
+FString FRfsnResponseCacheStore::NormalizeUtterance(FStringView Utterance)
+{
+	FString Normalized;
+	Normalized.Reserve(Utterance.Len());
+
+	bool bPendingSpace = false;
+	for (const TCHAR C : Utterance)
+	{
+		if (FChar::IsAlnum(C))
+		{
+			if (bPendingSpace && Normalized.Len() > 0)
+			{
+				Normalized.AppendChar(TEXT(' '));
+			}
+			bPendingSpace = false;
+			Normalized.AppendChar(FChar::ToLower(C));
+		}
+		else if (C != TEXT('\'') && C != TEXT('`'))
+		{
+			// Apostrophes join ("what's" -> "whats"); anything else separates words
+			bPendingSpace = true;
+		}
+	}
+	return Normalized;
+}
+
+float FRfsnResponseCacheStore::Similarity(FStringView A, FStringView B)
+{
+	TArray<uint64> TrigramsA;
+	TArray<uint64> TrigramsB;
+	MakeTrigrams(NormalizeUtterance(A), TrigramsA);
+	MakeTrigrams(NormalizeUtterance(B), TrigramsB);
+	return Dice(TrigramsA, TrigramsB);
+}
+
+void FRfsnResponseCacheStore::MakeTrigrams(FStringView Normalized, TArray<uint64>& OutTrigrams)
+{
+	OutTrigrams.Reset();
+	if (Normalized.IsEmpty())
+	{
+		return;
+	}
+
+	// Padded with a space each side so the first and last letters weigh as much as the middle
+	auto CharAt = [Normalized](int32 Index) -> uint64
+	{ return Index < 0 || Index >= Normalized.Len() ? ' ' : static_cast<uint64>(Normalized[Index]) & 0x1FFFFF; };
+
+	for (int32 i = -1; i < Normalized.Len() - 1; i++)
+	{
+		OutTrigrams.Add(CharAt(i) << 42 | CharAt(i + 1) << 21 | CharAt(i + 2));
+	}
+
+	OutTrigrams.Sort();
+	int32 Unique = 0;
+	for (int32 i = 0; i < OutTrigrams.Num(); i++)
+	{
+		if (i == 0 || OutTrigrams[i] != OutTrigrams[Unique - 1])
+		{
+			OutTrigrams[Unique++] = OutTrigrams[i];
+		}
+	}
+	OutTrigrams.SetNum(Unique);
+}
+
+float FRfsnResponseCacheStore::Dice(const TArray<uint64>& A, const TArray<uint64>& B)
+{
+	if (A.Num() == 0 || B.Num() == 0)
+	{
+		return A.Num() == B.Num() ? 1.0f : 0.0f;
+	}
+
+	int32 Shared = 0;
+	for (int32 i = 0, j = 0; i < A.Num() && j < B.Num();)
+	{
+		if (A[i] == B[j])
+		{
+			Shared++;
+			i++;
+			j++;
+		}
+		else if (A[i] < B[j])
+		{
+			i++;
+		}
+		else
+		{
+			j++;
+		}
+	}
+	return 2.0f * Shared / (A.Num() + B.Num());
+}
+
+FString FRfsnResponseCacheStore::MakeKey(const FString& NpcId, uint32 Context, const FString& Utterance)
+{
+	return FString::Printf(TEXT("%s|%08x|%s"), *NpcId, Context, *Utterance);
+}
+
+uint32 FRfsnResponseCacheStore::MakeBucket(const FString& NpcId, uint32 Context)
+{
+	return HashCombine(GetTypeHash(NpcId), Context);
+}
+
+bool FRfsnResponseCacheStore::IsExpired(const FEntry& Entry, FDateTime Now) const
+{
+	return Now - Entry.Response.StoredAt > TimeToLive;
+}
+
+const FRfsnCachedResponse* FRfsnResponseCacheStore::Find(const FString& NpcId, uint32 Context, FStringView Utterance,
+                                                         FDateTime Now, ERfsnCacheMatch* OutMatch)
+{
+	RFSN_TRACE_SCOPE(RfsnCache_Find);
+
+	Stats.Lookups++;
+	ERfsnCacheMatch Match = ERfsnCacheMatch::None;
+	FEntry* Best = nullptr;
+
+	const uint32 Bucket = MakeBucket(NpcId, Context);
+	if (const TArray<FString>* BucketKeys = Buckets.Find(Bucket))
+	{
+		// Expired replies under this NPC and context go before anything is matched against them
+		for (const FString& Key : TArray<FString>(*BucketKeys))
+		{
+			if (IsExpired(Entries.FindChecked(Key), Now))
+			{
+				RemoveEntry(Key);
+				Stats.Expired++;
+			}
+		}
+	}
+
+	const FString Normalized = NormalizeUtterance(Utterance);
+	if (FEntry* Entry = Entries.Find(MakeKey(NpcId, Context, Normalized)))
+	{
+		Best = Entry;
+		Match = ERfsnCacheMatch::Exact;
+	}
+	else if (SimilarityThreshold < 1.0f && !Normalized.IsEmpty())
+	{
+		if (const TArray<FString>* BucketKeys = Buckets.Find(Bucket))
+		{
+			TArray<uint64> Trigrams;
+			MakeTrigrams(Normalized, Trigrams);
+
+			float BestScore = SimilarityThreshold;
+			for (const FString& Key : *BucketKeys)
+			{
+				FEntry& Candidate = Entries.FindChecked(Key);
+				if (Candidate.Response.Context != Context || Candidate.Response.NpcId != NpcId)
+				{
+					continue; // Another NPC or context that shares the bucket hash
+				}
+
+				const float Score = Dice(Trigrams, Candidate.Trigrams);
+				if (Score >= BestScore)
+				{
+					Best = &Candidate;
+					BestScore = Score;
+					Match = ERfsnCacheMatch::Approximate;
+				}
+			}
+		}
+	}
+
+	if (Best)
+	{
+		Best->Response.Hits++;
+		Best->Response.LastUsedAt = Now;
+		if (Match == ERfsnCacheMatch::Exact)
+		{
+			Stats.ExactHits++;
+		}
+		else
+		{
+			Stats.ApproximateHits++;
+		}
+	}
+	else
+	{
+		Stats.Misses++;
+	}
+	UpdateDerivedStats();
+
+	if (OutMatch)
+	{
+		*OutMatch = Match;
+	}
+	return Best ? &Best->Response : nullptr;
+}
+
+void FRfsnResponseCacheStore::Add(FRfsnCachedResponse&& Response, FDateTime Now)
+{
+	RFSN_TRACE_SCOPE(RfsnCache_Add);
+
+	Response.StoredAt = Now;
+	Response.LastUsedAt = Now;
+	Response.Utterance = NormalizeUtterance(Response.Utterance);
+	if (Response.Utterance.IsEmpty())
+	{
+		return;
+	}
+
+	Insert(MoveTemp(Response));
+	Stats.Stored++;
+	EvictToLimit();
+	UpdateDerivedStats();
+}
+
+void FRfsnResponseCacheStore::Insert(FRfsnCachedResponse&& Response)
+{
+	const FString Key = MakeKey(Response.NpcId, Response.Context, Response.Utterance);
+	if (Entries.Contains(Key))
+	{
+		RemoveEntry(Key);
+	}
+
+	Buckets.FindOrAdd(MakeBucket(Response.NpcId, Response.Context)).Add(Key);
+
+	FEntry& Entry = Entries.Add(Key);
+	MakeTrigrams(Response.Utterance, Entry.Trigrams);
+	Entry.Response = MoveTemp(Response);
+}
+
+void FRfsnResponseCacheStore::RemoveEntry(const FString& Key)
+{
+	FEntry Entry;
+	if (!Entries.RemoveAndCopyValue(Key, Entry))
+	{
+		return;
+	}
+
+	const uint32 Bucket = MakeBucket(Entry.Response.NpcId, Entry.Response.Context);
+	if (TArray<FString>* BucketKeys = Buckets.Find(Bucket))
+	{
+		BucketKeys->RemoveSingleSwap(Key, EAllowShrinking::No);
+		if (BucketKeys->Num() == 0)
+		{
+			Buckets.Remove(Bucket);
+		}
+	}
+}
+
+int32 FRfsnResponseCacheStore::RemoveExpired(FDateTime Now)
+{
+	TArray<FString> ExpiredKeys;
+	for (const TPair<FString, FEntry>& Pair : Entries)
+	{
+		if (IsExpired(Pair.Value, Now))
+		{
+			ExpiredKeys.Add(Pair.Key);
+		}
+	}
+
+	for (const FString& Key : ExpiredKeys)
+	{
+		RemoveEntry(Key);
+	}
+	Stats.Expired += ExpiredKeys.Num();
+	UpdateDerivedStats();
+	return ExpiredKeys.Num();
+}
+
+void FRfsnResponseCacheStore::EvictToLimit()
+{
+	while (Entries.Num() > FMath::Max(MaxEntries, 0))
+	{
+		const FString* Oldest = nullptr;
+		FDateTime OldestUse = FDateTime::MaxValue();
+		for (const TPair<FString, FEntry>& Pair : Entries)
+		{
+			if (Pair.Value.Response.LastUsedAt < OldestUse)
+			{
+				Oldest = &Pair.Key;
+				OldestUse = Pair.Value.Response.LastUsedAt;
+			}
+		}
+
+		if (!Oldest)
+		{
+			break;
+		}
+		RemoveEntry(FString(*Oldest));
+		Stats.Evicted++;
+	}
+}
+
+void FRfsnResponseCacheStore::Reset()
+{
+	Entries.Reset();
+	Buckets.Reset();
+	UpdateDerivedStats();
+}
+
+void FRfsnResponseCacheStore::ResetStats()
+{
+	Stats = FRfsnResponseCacheStats();
+	UpdateDerivedStats();
+}
+
+void FRfsnResponseCacheStore::UpdateDerivedStats()
+{
+	Stats.Entries = Entries.Num();
+	Stats.HitRate =
+	    Stats.Lookups > 0 ? static_cast<float>(Stats.ExactHits + Stats.ApproximateHits) / Stats.Lookups : 0.0f;
+}
+
+FString FRfsnResponseCacheStore::ToJson() const
+{
+	TArray<TSharedPtr<FJsonValue>> EntriesArray;
+	for (const TPair<FString, FEntry>& Pair : Entries)
+	{
+		const FRfsnCachedResponse& Response = Pair.Value.Response;
+
+		TSharedRef<FJsonObject> EntryObj = MakeShared<FJsonObject>();
+		EntryObj->SetStringField(TEXT("npc_id"), Response.NpcId);
+		EntryObj->SetNumberField(TEXT("context"), Response.Context);
+		EntryObj->SetStringField(TEXT("utterance"), Response.Utterance);
+		EntryObj->SetStringField(TEXT("stored_at"), Response.StoredAt.ToIso8601());
+		EntryObj->SetStringField(TEXT("last_used_at"), Response.LastUsedAt.ToIso8601());
+		EntryObj->SetNumberField(TEXT("hits"), Response.Hits);
+
+		if (Response.bHasMeta)
+		{
+			TSharedRef<FJsonObject> MetaObj = MakeShared<FJsonObject>();
+			MetaObj->SetStringField(TEXT("player_signal"), Response.Meta.PlayerSignal);
+			MetaObj->SetStringField(TEXT("bandit_key"), Response.Meta.BanditKey);
+			MetaObj->SetStringField(TEXT("npc_action"), FRfsnTokenDecoder::GetActionName(Response.Meta.NpcAction));
+			MetaObj->SetStringField(TEXT("action_mode"), Response.Meta.ActionMode);
+			MetaObj->SetStringField(TEXT("instant_bark"), Response.Meta.InstantBark);
+			MetaObj->SetNumberField(TEXT("bark_duration_ms"), Response.Meta.BarkDurationMs);
+			EntryObj->SetObjectField(TEXT("meta"), MetaObj);
+		}
+
+		TArray<TSharedPtr<FJsonValue>> SentencesArray;
+		for (int32 i = 0; i < Response.Sentences.Num(); i++)
+		{
+			TSharedRef<FJsonObject> SentenceObj = MakeShared<FJsonObject>();
+			SentenceObj->SetStringField(TEXT("sentence"), Response.Sentences[i].Sentence);
+			SentenceObj->SetBoolField(TEXT("is_final"), Response.Sentences[i].bIsFinal);
+			const float OffsetMs = Response.SentenceOffsetsMs.IsValidIndex(i) ? Response.SentenceOffsetsMs[i] : 0.0f;
+			SentenceObj->SetNumberField(TEXT("latency_ms"), Response.Sentences[i].LatencyMs);
+			SentenceObj->SetNumberField(TEXT("offset_ms"), OffsetMs);
+			SentencesArray.Add(MakeShared<FJsonValueObject>(SentenceObj));
+		}
+		EntryObj->SetArrayField(TEXT("sentences"), SentencesArray);
+
+		EntriesArray.Add(MakeShared<FJsonValueObject>(EntryObj));
+	}
+
+	TSharedRef<FJsonObject> RootObj = MakeShared<FJsonObject>();
+	RootObj->SetArrayField(TEXT("entries"), EntriesArray);
+
+	FString OutputString;
+	TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&OutputString);
+	FJsonSerializer::Serialize(RootObj, Writer);
+	return OutputString;
+}
+
+bool FRfsnResponseCacheStore::FromJson(const FString& Json, FDateTime Now)
+{
+	TSharedPtr<FJsonObject> RootObj;
+	TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(Json);
+	if (!FJsonSerializer::Deserialize(Reader, RootObj) || !RootObj.IsValid())
+	{
+		return false;
+	}
+
+	const TArray<TSharedPtr<FJsonValue>>* EntriesArray;
+	if (!RootObj->TryGetArrayField(TEXT("entries"), EntriesArray))
+	{
+		return false;
+	}
+
+	for (const TSharedPtr<FJsonValue>& EntryVal : *EntriesArray)
+	{
+		const TSharedPtr<FJsonObject>* EntryObj;
+		if (!EntryVal->TryGetObject(EntryObj))
+		{
+			continue;
+		}
+
+		FRfsnCachedResponse Response;
+		double Context = 0.0;
+		FString StoredAt;
+		FString LastUsedAt;
+		(*EntryObj)->TryGetStringField(TEXT("npc_id"), Response.NpcId);
+		(*EntryObj)->TryGetNumberField(TEXT("context"), Context);
+		(*EntryObj)->TryGetStringField(TEXT("utterance"), Response.Utterance);
+		(*EntryObj)->TryGetNumberField(TEXT("hits"), Response.Hits);
+		Response.Context = static_cast<uint32>(Context);
+
+		if (!(*EntryObj)->TryGetStringField(TEXT("stored_at"), StoredAt) ||
+		    !FDateTime::ParseIso8601(*StoredAt, Response.StoredAt) || Now - Response.StoredAt > TimeToLive)
+		{
+			continue;
+		}
+		if (!(*EntryObj)->TryGetStringField(TEXT("last_used_at"), LastUsedAt) ||
+		    !FDateTime::ParseIso8601(*LastUsedAt, Response.LastUsedAt))
+		{
+			Response.LastUsedAt = Response.StoredAt;
+		}
+
+		const TSharedPtr<FJsonObject>* MetaObj;
+		if ((*EntryObj)->TryGetObjectField(TEXT("meta"), MetaObj))
+		{
+			FString Action;
+			Response.bHasMeta = true;
+			(*MetaObj)->TryGetStringField(TEXT("player_signal"), Response.Meta.PlayerSignal);
+			(*MetaObj)->TryGetStringField(TEXT("bandit_key"), Response.Meta.BanditKey);
+			(*MetaObj)->TryGetStringField(TEXT("action_mode"), Response.Meta.ActionMode);
+			(*MetaObj)->TryGetStringField(TEXT("instant_bark"), Response.Meta.InstantBark);
+			(*MetaObj)->TryGetNumberField(TEXT("bark_duration_ms"), Response.Meta.BarkDurationMs);
+			if ((*MetaObj)->TryGetStringField(TEXT("npc_action"), Action))
+			{
+				Response.Meta.NpcAction = FRfsnTokenDecoder::DecodeAction(FStringView(Action));
+			}
+		}
+
+		const TArray<TSharedPtr<FJsonValue>>* SentencesArray;
+		if ((*EntryObj)->TryGetArrayField(TEXT("sentences"), SentencesArray))
+		{
+			for (const TSharedPtr<FJsonValue>& SentenceVal : *SentencesArray)
+			{
+				const TSharedPtr<FJsonObject>* SentenceObj;
+				if (!SentenceVal->TryGetObject(SentenceObj))
+				{
+					continue;
+				}
+
+				FRfsnSentence& Sentence = Response.Sentences.AddDefaulted_GetRef();
+				double LatencyMs = 0.0;
+				double OffsetMs = 0.0;
+				(*SentenceObj)->TryGetStringField(TEXT("sentence"), Sentence.Sentence);
+				(*SentenceObj)->TryGetBoolField(TEXT("is_final"), Sentence.bIsFinal);
+				(*SentenceObj)->TryGetNumberField(TEXT("latency_ms"), LatencyMs);
+				(*SentenceObj)->TryGetNumberField(TEXT("offset_ms"), OffsetMs);
+				Sentence.LatencyMs = static_cast<float>(LatencyMs);
+				Response.SentenceOffsetsMs.Add(static_cast<float>(OffsetMs));
+			}
+		}
+
+		if (!Response.Utterance.IsEmpty() && Response.Sentences.Num() > 0)
+		{
+			Insert(MoveTemp(Response));
+		}
+	}
+
+	EvictToLimit();
+	UpdateDerivedStats();
+	return true;
+}
+
+// ─────────────────────────────────────────────────────────────
+// URfsnResponseCache
+// ─────────────────────────────────────────────────────────────
+
+void URfsnResponseCache::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	ApplySettings();
+	if (bPersistToDisk && LoadFromDisk())
+	{
+		RFSN_LOG(TEXT("Loaded %d cached responses"), Cache.Num());
+	}
+}
+
+void URfsnResponseCache::Deinitialize()
+{
+	if (bPersistToDisk)
+	{
+		Cache.RemoveExpired(FDateTime::UtcNow());
+		SaveToDisk();
+	}
+
+	if (Cache.GetStats().Lookups > 0)
+	{
+		RFSN_LOG(TEXT("%s"), *GetStatsString());
+	}
+
+	Super::Deinitialize();
+}
+
+uint32 URfsnResponseCache::MakeContext(const URfsnNpcClientComponent* Client)
+{
+	if (!Client)
+	{
+		return 0;
+	}
+
+	const AActor* Owner = Client->GetOwner();
+
+	// Mood: the blend's dominant emotion in three intensity steps, else the emotion its mood string names
+	ERfsnCoreEmotion Emotion = FRfsnTokenDecoder::DecodeMood(Client->Mood).Emotion;
+	int32 Intensity = 0;
+	if (const URfsnEmotionBlend* EmotionBlend = Owner ? Owner->FindComponentByClass<URfsnEmotionBlend>() : nullptr)
+	{
+		Emotion = EmotionBlend->DominantEmotion;
+		Intensity = FMath::Clamp(FMath::FloorToInt(EmotionBlend->GetEmotionIntensity(Emotion) * 3.0f), 0, 2);
+	}
+
+	// Relationship: five tiers across the affinity range, and the label the prompt carries
+	const int32 Tier = FMath::Clamp(FMath::FloorToInt((Client->Affinity + 1.0f) * 2.5f), 0, 4);
+
+	uint32 Context = HashCombine(GetTypeHash(static_cast<uint8>(Emotion)), GetTypeHash(Intensity));
+	Context = HashCombine(Context, GetTypeHash(Tier));
+	Context = HashCombine(Context, GetTypeHash(Client->Relationship));
+
+	if (const URfsnNpcAwareness* Awareness = Owner ? Owner->FindComponentByClass<URfsnNpcAwareness>() : nullptr)
+	{
+		Context = HashCombine(Context, GetTypeHash(static_cast<uint8>(Awareness->CurrentAwareness)));
+	}
+
+	if (const URfsnQuestIntegration* Quests = Owner ? Owner->FindComponentByClass<URfsnQuestIntegration>() : nullptr)
+	{
+		for (const FRfsnQuest& Quest : Quests->OfferedQuests)
+		{
+			Context = HashCombine(Context, GetTypeHash(Quest.QuestId));
+			Context = HashCombine(Context, GetTypeHash(static_cast<uint8>(Quest.Status)));
+		}
+	}
+
+	return Context;
+}
+
+const FRfsnCachedResponse* URfsnResponseCache::Find(const FString& NpcId, uint32 Context, const FString& PlayerText)
+{
+	if (!bEnabled)
+	{
+		return nullptr;
+	}
+
+	ApplySettings();
+	ERfsnCacheMatch Match;
+	const FRfsnCachedResponse* Response = Cache.Find(NpcId, Context, PlayerText, FDateTime::UtcNow(), &Match);
+	if (Response)
+	{
+		RFSN_LOG(TEXT("Response cache %s hit for %s: '%s'"),
+		         Match == ERfsnCacheMatch::Exact ? TEXT("exact") : TEXT("approximate"), *NpcId, *PlayerText);
+	}
+	return Response;
+}
+
+void URfsnResponseCache::Store(FRfsnCachedResponse&& Response)
+{
+	if (!bEnabled || Response.Sentences.Num() == 0)
+	{
+		return;
+	}
+
+	ApplySettings();
+	Cache.Add(MoveTemp(Response), FDateTime::UtcNow());
+}
+
+FString URfsnResponseCache::GetStatsString() const
+{
+	const FRfsnResponseCacheStats& Stats = Cache.GetStats();
+	return FString::Printf(
+	    TEXT("Response cache: %d entries, %.0f%% of %d lookups hit (%d exact, %d approximate), %d evicted, %d expired"),
+	    Stats.Entries, Stats.HitRate * 100.0f, Stats.Lookups, Stats.ExactHits, Stats.ApproximateHits, Stats.Evicted,
+	    Stats.Expired);
+}
+
+void URfsnResponseCache::ClearCache()
+{
+	Cache.Reset();
+}
+
+void URfsnResponseCache::SaveToDisk() const
+{
+	RFSN_TRACE_SCOPE(RfsnCache_SaveToDisk);
+
+	const FString SavePath = GetSavePath();
+	IFileManager::Get().MakeDirectory(*FPaths::GetPath(SavePath), true);
+	FFileHelper::SaveStringToFile(Cache.ToJson(), *SavePath);
+}
+
+bool URfsnResponseCache::LoadFromDisk()
+{
+	RFSN_TRACE_SCOPE(RfsnCache_LoadFromDisk);
+
+	FString JsonString;
+	if (!FFileHelper::LoadFileToString(JsonString, *GetSavePath()))
+	{
+		return false;
+	}
+
+	ApplySettings();
+	return Cache.FromJson(JsonString, FDateTime::UtcNow());
+}
+
+void URfsnResponseCache::ApplySettings()
+{
+	Cache.SimilarityThreshold = SimilarityThreshold;
+	Cache.TimeToLive = FTimespan::FromMinutes(TimeToLiveMinutes);
+	Cache.MaxEntries = MaxEntries;
+}
+
+FString URfsnResponseCache::GetSavePath()
+{
+	return FPaths::ProjectSavedDir() / TEXT("ResponseCache") / TEXT("ResponseCache.json");
+}
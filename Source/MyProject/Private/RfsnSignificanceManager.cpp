@@ -0,0 +1,405 @@
+// RFSN Significance Manager Implementation
+
+#include "RfsnSignificanceManager.h"
+#include "RfsnDialogueCamera.h"
+#include "RfsnDialogueManager.h"
+#include "RfsnEmotionBlend.h"
+#include "RfsnLogging.h"
+#include "RfsnNpcAwareness.h"
+#include "RfsnNpcClientComponent.h"
+#include "RfsnNpcPortrait.h"
+#include "RfsnTrace.h"
+#include "Engine/World.h"
+#include "GameFramework/Actor.h"
+#include "GameFramework/Pawn.h"
+#include "HAL/PlatformTime.h"
+#include "Kismet/GameplayStatics.h"
+
+DECLARE_STATS_GROUP(TEXT("RfsnSignificance"), STATGROUP_RfsnSignificance, STATCAT_Advanced);
+DECLARE_CYCLE_STAT(TEXT("Scoring Pass"), STAT_RfsnSignificancePass, STATGROUP_RfsnSignificance);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("NPCs"), STAT_RfsnSignificanceNpcs, STATGROUP_RfsnSignificance);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Components Critical"), STAT_RfsnSignificanceCritical, STATGROUP_RfsnSignificance);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Components High"), STAT_RfsnSignificanceHigh, STATGROUP_RfsnSignificance);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Components Medium"), STAT_RfsnSignificanceMedium, STATGROUP_RfsnSignificance);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Components Low"), STAT_RfsnSignificanceLow, STATGROUP_RfsnSignificance);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Components Dormant"), STAT_RfsnSignificanceDormant, STATGROUP_RfsnSignificance);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Bucket Changes / s"), STAT_RfsnSignificanceChanges, STATGROUP_RfsnSignificance);
+
+namespace RfsnSignificance
+{
+constexpr int32 NumBuckets = static_cast<int32>(ERfsnSignificanceBucket::Dormant) + 1;
+
+FRfsnSignificanceTickRow MakeRow(TSubclassOf<UActorComponent> ComponentClass, float Critical, float High,
+                                 float Medium, float Low, bool bAllowDormant)
+{
+	FRfsnSignificanceTickRow Row;
+	Row.ComponentClass = ComponentClass;
+	Row.CriticalInterval = Critical;
+	Row.HighInterval = High;
+	Row.MediumInterval = Medium;
+	Row.LowInterval = Low;
+	Row.bAllowDormant = bAllowDormant;
+	return Row;
+}
+} // namespace RfsnSignificance
+
+// ─────────────────────────────────────────────────────────────
+// Settings
+// ─────────────────────────────────────────────────────────────
+
+float FRfsnSignificanceSettings::Score(const FRfsnSignificanceInputs& Inputs) const
+{
+	if (Inputs.bInDialogue)
+	{
+		return 1.0f;
+	}
+
+	const float Proximity = 1.0f - FMath::Clamp(Inputs.Distance / MaxDistance, 0.0f, 1.0f);
+	return Proximity * DistanceWeight + (Inputs.bVisible ? VisibleWeight : 0.0f) +
+	       FMath::Clamp(Inputs.Threat, 0.0f, 1.0f) * ThreatWeight;
+}
+
+float FRfsnSignificanceSettings::GetThreshold(ERfsnSignificanceBucket Bucket) const
+{
+	switch (Bucket)
+	{
+	case ERfsnSignificanceBucket::Critical:
+		return CriticalScore;
+	case ERfsnSignificanceBucket::High:
+		return HighScore;
+	case ERfsnSignificanceBucket::Medium:
+		return MediumScore;
+	case ERfsnSignificanceBucket::Low:
+		return LowScore;
+	default:
+		return -MAX_flt;
+	}
+}
+
+ERfsnSignificanceBucket FRfsnSignificanceSettings::SelectBucket(float InScore, ERfsnSignificanceBucket Current,
+                                                                float TimeInBucket) const
+{
+	// Promotions take the plain thresholds, so an NPC becoming relevant is picked up at once
+	for (int32 i = 0; i < RfsnSignificance::NumBuckets; i++)
+	{
+		const ERfsnSignificanceBucket Bucket = static_cast<ERfsnSignificanceBucket>(i);
+		if (InScore >= GetThreshold(Bucket))
+		{
+			if (Bucket >= Current)
+			{
+				break;
+			}
+			return Bucket;
+		}
+	}
+
+	// Demotions have to clear the current bucket's threshold by Hysteresis, after holding it for a while
+	if (InScore >= GetThreshold(Current) - Hysteresis || TimeInBucket < MinDemotionDelay)
+	{
+		return Current;
+	}
+
+	for (int32 i = static_cast<int32>(Current) + 1; i < RfsnSignificance::NumBuckets; i++)
+	{
+		const ERfsnSignificanceBucket Bucket = static_cast<ERfsnSignificanceBucket>(i);
+		if (InScore >= GetThreshold(Bucket))
+		{
+			return Bucket;
+		}
+	}
+	return ERfsnSignificanceBucket::Dormant;
+}
+
+float FRfsnSignificanceTickRow::GetInterval(ERfsnSignificanceBucket Bucket) const
+{
+	switch (Bucket)
+	{
+	case ERfsnSignificanceBucket::Critical:
+		return CriticalInterval;
+	case ERfsnSignificanceBucket::High:
+		return HighInterval;
+	case ERfsnSignificanceBucket::Medium:
+		return MediumInterval;
+	default:
+		return LowInterval;
+	}
+}
+
+// ─────────────────────────────────────────────────────────────
+// URfsnSignificanceManager
+// ─────────────────────────────────────────────────────────────
+
+URfsnSignificanceManager::URfsnSignificanceManager()
+{
+	using namespace RfsnSignificance;
+
+	// Critical matches each component's default rate; awareness and the dialogue camera never go dormant since
+	// they are what notice the player and a conversation starting
+	TickTable.Add(MakeRow(URfsnEmotionBlend::StaticClass(), 0.016f, 0.033f, 0.1f, 0.25f, true));
+	TickTable.Add(MakeRow(URfsnDialogueCamera::StaticClass(), 0.016f, 0.05f, 0.1f, 0.25f, false));
+	TickTable.Add(MakeRow(URfsnNpcPortrait::StaticClass(), 0.1f, 0.1f, 0.25f, 0.5f, true));
+	TickTable.Add(MakeRow(URfsnNpcAwareness::StaticClass(), 0.1f, 0.1f, 0.2f, 0.5f, false));
+
+	Stats.ComponentsInBucket.SetNumZeroed(NumBuckets);
+}
+
+void URfsnSignificanceManager::Deinitialize()
+{
+	for (auto& Pair : Npcs)
+	{
+		Restore(Pair.Value);
+	}
+	Npcs.Empty();
+	Super::Deinitialize();
+}
+
+TStatId URfsnSignificanceManager::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(URfsnSignificanceManager, STATGROUP_Tickables);
+}
+
+const FRfsnSignificanceTickRow* URfsnSignificanceManager::FindRow(const UClass* ComponentClass) const
+{
+	for (const FRfsnSignificanceTickRow& Row : TickTable)
+	{
+		if (Row.ComponentClass && ComponentClass && ComponentClass->IsChildOf(Row.ComponentClass))
+		{
+			return &Row;
+		}
+	}
+	return nullptr;
+}
+
+void URfsnSignificanceManager::RegisterNpc(AActor* Npc)
+{
+	if (!Npc || Npcs.Contains(Npc))
+	{
+		return;
+	}
+
+	FNpc& Entry = Npcs.Add(Npc);
+	Entry.Actor = Npc;
+
+	TInlineComponentArray<UActorComponent*> Components(Npc);
+	for (UActorComponent* Component : Components)
+	{
+		const FRfsnSignificanceTickRow* Row = FindRow(Component->GetClass());
+		if (!Row || !Component->PrimaryComponentTick.bCanEverTick)
+		{
+			continue;
+		}
+
+		FManagedComponent& Managed = Entry.Components.AddDefaulted_GetRef();
+		Managed.Component = Component;
+		Managed.Row = static_cast<int32>(Row - TickTable.GetData());
+	}
+
+	// Scored on the next pass; until then it ticks at its own rate
+	TimeSinceUpdate = UpdateInterval;
+}
+
+void URfsnSignificanceManager::UnregisterNpc(AActor* Npc)
+{
+	FNpc Entry;
+	if (Npcs.RemoveAndCopyValue(Npc, Entry))
+	{
+		Restore(Entry);
+	}
+}
+
+ERfsnSignificanceBucket URfsnSignificanceManager::GetBucket(AActor* Npc) const
+{
+	const FNpc* Entry = Npcs.Find(Npc);
+	return Entry ? Entry->Bucket : ERfsnSignificanceBucket::Critical;
+}
+
+void URfsnSignificanceManager::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	TimeSinceStatsReset += DeltaTime;
+	if (TimeSinceStatsReset >= 1.0f)
+	{
+		Stats.ChangesPerSecond = ChangesThisSecond;
+		ChangesThisSecond = 0;
+		TimeSinceStatsReset = 0.0f;
+	}
+
+	if (!bEnabled)
+	{
+		for (auto& Pair : Npcs)
+		{
+			if (Pair.Value.Bucket != ERfsnSignificanceBucket::Critical)
+			{
+				Restore(Pair.Value);
+			}
+		}
+		return;
+	}
+
+	TimeSinceUpdate += DeltaTime;
+	if (TimeSinceUpdate < UpdateInterval || Npcs.Num() == 0)
+	{
+		return;
+	}
+	TimeSinceUpdate = 0.0f;
+
+	EvaluateAll();
+}
+
+FRfsnSignificanceInputs URfsnSignificanceManager::GatherInputs(const AActor* Npc, const FVector& PlayerLocation) const
+{
+	FRfsnSignificanceInputs Inputs;
+	Inputs.Distance = FVector::Dist(Npc->GetActorLocation(), PlayerLocation);
+	Inputs.bVisible = Npc->WasRecentlyRendered(VisibleTolerance);
+
+	if (const URfsnNpcClientComponent* Client = Npc->FindComponentByClass<URfsnNpcClientComponent>())
+	{
+		Inputs.bInDialogue = Client->IsDialogueActive();
+	}
+	if (!Inputs.bInDialogue)
+	{
+		const URfsnDialogueManager* DialogueMgr = GetWorld()->GetSubsystem<URfsnDialogueManager>();
+		Inputs.bInDialogue = DialogueMgr && DialogueMgr->GetActiveNpc() == Npc;
+	}
+
+	if (const URfsnNpcAwareness* Awareness = Npc->FindComponentByClass<URfsnNpcAwareness>())
+	{
+		Inputs.Threat = Awareness->IsHostile() ? 1.0f : Awareness->AwarenessValue;
+	}
+	return Inputs;
+}
+
+void URfsnSignificanceManager::EvaluateAll()
+{
+	SCOPE_CYCLE_COUNTER(STAT_RfsnSignificancePass);
+	RFSN_TRACE_SCOPE(RfsnSignificance_Evaluate);
+
+	const double StartTime = FPlatformTime::Seconds();
+
+	// No player (menus, loading): everything stays at full rate rather than going dormant
+	const APawn* Player = UGameplayStatics::GetPlayerPawn(GetWorld(), 0);
+	const FVector PlayerLocation = Player ? Player->GetActorLocation() : FVector::ZeroVector;
+
+	const double Now = GetWorld()->GetTimeSeconds();
+
+	for (auto It = Npcs.CreateIterator(); It; ++It)
+	{
+		FNpc& Npc = It.Value();
+		const AActor* Actor = Npc.Actor.Get();
+		if (!Actor)
+		{
+			// Destroyed without unregistering; its components went with it
+			It.RemoveCurrent();
+			continue;
+		}
+
+		Npc.Score = Player ? Settings.Score(GatherInputs(Actor, PlayerLocation)) : 1.0f;
+		const float TimeInBucket = static_cast<float>(Now - Npc.BucketSince);
+		const ERfsnSignificanceBucket Bucket = Settings.SelectBucket(Npc.Score, Npc.Bucket, TimeInBucket);
+		if (Bucket != Npc.Bucket)
+		{
+			Npc.BucketSince = Now;
+			ApplyBucket(Npc, Bucket);
+			ChangesThisSecond++;
+		}
+	}
+
+	Stats.LastPassMs = static_cast<float>((FPlatformTime::Seconds() - StartTime) * 1000.0);
+	UpdateStats();
+}
+
+void URfsnSignificanceManager::ApplyBucket(FNpc& Npc, ERfsnSignificanceBucket Bucket)
+{
+	Npc.Bucket = Bucket;
+
+	for (FManagedComponent& Managed : Npc.Components)
+	{
+		UActorComponent* Component = Managed.Component.Get();
+		if (!Component || !TickTable.IsValidIndex(Managed.Row))
+		{
+			continue;
+		}
+
+		if (!Managed.bHasDefaultInterval)
+		{
+			Managed.DefaultInterval = Component->GetComponentTickInterval();
+			Managed.bHasDefaultInterval = true;
+		}
+
+		const FRfsnSignificanceTickRow& Row = TickTable[Managed.Row];
+		if (Bucket == ERfsnSignificanceBucket::Dormant && Row.bAllowDormant)
+		{
+			// Leave components that already turned themselves off alone, and remember which ones we turned off
+			if (Component->IsComponentTickEnabled())
+			{
+				Component->SetComponentTickEnabled(false);
+				Managed.bMadeDormant = true;
+			}
+			continue;
+		}
+
+		Component->SetComponentTickInterval(Row.GetInterval(Bucket));
+		if (Managed.bMadeDormant)
+		{
+			Managed.bMadeDormant = false;
+			Component->SetComponentTickEnabled(true);
+		}
+	}
+}
+
+void URfsnSignificanceManager::Restore(FNpc& Npc)
+{
+	Npc.Bucket = ERfsnSignificanceBucket::Critical;
+
+	for (FManagedComponent& Managed : Npc.Components)
+	{
+		UActorComponent* Component = Managed.Component.Get();
+		if (!Component)
+		{
+			continue;
+		}
+
+		if (Managed.bHasDefaultInterval)
+		{
+			Component->SetComponentTickInterval(Managed.DefaultInterval);
+		}
+		if (Managed.bMadeDormant)
+		{
+			Managed.bMadeDormant = false;
+			Component->SetComponentTickEnabled(true);
+		}
+	}
+}
+
+void URfsnSignificanceManager::UpdateStats()
+{
+	Stats.Npcs = Npcs.Num();
+	Stats.ComponentsInBucket.Init(0, RfsnSignificance::NumBuckets);
+
+	for (const auto& Pair : Npcs)
+	{
+		for (const FManagedComponent& Managed : Pair.Value.Components)
+		{
+			if (!Managed.Component.IsValid() || !TickTable.IsValidIndex(Managed.Row))
+			{
+				continue;
+			}
+
+			// A component whose row keeps it ticking counts as Low, not Dormant
+			const bool bDormant = Pair.Value.Bucket == ERfsnSignificanceBucket::Dormant;
+			const ERfsnSignificanceBucket Effective = bDormant && !TickTable[Managed.Row].bAllowDormant
+			                                              ? ERfsnSignificanceBucket::Low
+			                                              : Pair.Value.Bucket;
+			Stats.ComponentsInBucket[static_cast<int32>(Effective)]++;
+		}
+	}
+
+	SET_DWORD_STAT(STAT_RfsnSignificanceNpcs, Stats.Npcs);
+	SET_DWORD_STAT(STAT_RfsnSignificanceCritical, Stats.ComponentsInBucket[0]);
+	SET_DWORD_STAT(STAT_RfsnSignificanceHigh, Stats.ComponentsInBucket[1]);
+	SET_DWORD_STAT(STAT_RfsnSignificanceMedium, Stats.ComponentsInBucket[2]);
+	SET_DWORD_STAT(STAT_RfsnSignificanceLow, Stats.ComponentsInBucket[3]);
+	SET_DWORD_STAT(STAT_RfsnSignificanceDormant, Stats.ComponentsInBucket[4]);
+	SET_DWORD_STAT(STAT_RfsnSignificanceChanges, Stats.ChangesPerSecond);
+}
@@ -0,0 +1,36 @@
+// RFSN Spatial Hash Implementation
+
+#include "RfsnSpatialHash.h"
+
+void FRfsnSpatialHashGrid::Reset(float InCellSize)
+{
+	const float NewCellSize = FMath::Max(InCellSize, 1.0f);
+
+	if (NewCellSize != CellSize)
+	{
+		Cells.Empty();
+	}
+	else
+	{
+		// Same layout: keep buckets for cells that are likely to be reused
+		for (auto& Pair : Cells)
+		{
+			Pair.Value.Reset();
+		}
+	}
+
+	CellSize = NewCellSize;
+	InvCellSize = 1.0f / NewCellSize;
+	NumEntries = 0;
+}
+
+void FRfsnSpatialHashGrid::Remove(int32 Id, const FVector& Location)
+{
+	if (TArray<int32, TInlineAllocator<8>>* Cell = Cells.Find(CellOf(Location)))
+	{
+		if (Cell->RemoveSingleSwap(Id, EAllowShrinking::No) > 0)
+		{
+			NumEntries--;
+		}
+	}
+}
@@ -0,0 +1,187 @@
+// RFSN Stream Session Implementation
+
+#include "RfsnStreamSession.h"
+#include "HAL/FileManager.h"
+#include "Misc/Compression.h"
+#include "Misc/Crc.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+
+namespace RfsnSession
+{
+/** "RFSS" */
+constexpr uint32 FileMagic = 0x53534652;
+constexpr uint32 FileVersion = 1;
+
+/** Magic, version, raw size, compressed size, CRC */
+constexpr int32 FileHeaderSize = 5 * sizeof(uint32);
+} // namespace RfsnSession
+
+void FRfsnStreamSession::Add(ERfsnSessionEvent Type, int64 TimeUs, const uint8* Data, int32 Size, int32 Code)
+{
+	FRfsnSessionEvent& Event = Events.AddDefaulted_GetRef();
+	Event.Type = Type;
+	Event.TimeUs = TimeUs;
+	Event.Code = Code;
+	Event.Payload.Append(Data, Size);
+}
+
+void FRfsnStreamSession::Add(ERfsnSessionEvent Type, int64 TimeUs, const FString& Text, int32 Code)
+{
+	const FTCHARToUTF8 Utf8(*Text);
+	Add(Type, TimeUs, reinterpret_cast<const uint8*>(Utf8.Get()), Utf8.Length(), Code);
+}
+
+int64 FRfsnStreamSession::GetPayloadBytes() const
+{
+	int64 Bytes = 0;
+	for (const FRfsnSessionEvent& Event : Events)
+	{
+		Bytes += Event.Payload.Num();
+	}
+	return Bytes;
+}
+
+TArray<uint8> FRfsnStreamSession::ToBytes() const
+{
+	using namespace RfsnSession;
+
+	// Times are packed deltas and codes and sizes packed ints, so most events cost a few bytes besides payload
+	TArray<uint8> Raw;
+	Raw.Reserve(GetPayloadBytes() + Events.Num() * 8 + 64);
+	FMemoryWriter Writer(Raw);
+	FString Id = NpcId;
+	FRfsnSessionTally Counts = Tally;
+	int32 NumEvents = Events.Num();
+	Writer << Id << Counts.Dialogues << Counts.Metas << Counts.Sentences << Counts.Errors << NumEvents;
+
+	int64 PreviousUs = 0;
+	for (const FRfsnSessionEvent& Event : Events)
+	{
+		uint8 Type = static_cast<uint8>(Event.Type);
+		uint32 DeltaUs = static_cast<uint32>(FMath::Clamp<int64>(Event.TimeUs - PreviousUs, 0, MAX_uint32));
+		uint32 Code = static_cast<uint32>(FMath::Max(Event.Code, 0));
+		uint32 Size = static_cast<uint32>(Event.Payload.Num());
+		Writer << Type;
+		Writer.SerializeIntPacked(DeltaUs);
+		Writer.SerializeIntPacked(Code);
+		Writer.SerializeIntPacked(Size);
+		Writer.Serialize(const_cast<uint8*>(Event.Payload.GetData()), Size);
+		PreviousUs += DeltaUs;
+	}
+
+	int32 CompressedSize = FCompression::CompressMemoryBound(NAME_Zlib, Raw.Num());
+	TArray<uint8> File;
+	File.SetNumUninitialized(FileHeaderSize + CompressedSize);
+	if (!FCompression::CompressMemory(NAME_Zlib, File.GetData() + FileHeaderSize, CompressedSize, Raw.GetData(),
+	                                  Raw.Num()))
+	{
+		return TArray<uint8>();
+	}
+	File.SetNum(FileHeaderSize + CompressedSize);
+
+	TArray<uint8> Header;
+	FMemoryWriter HeaderWriter(Header);
+	uint32 Magic = FileMagic;
+	uint32 Version = FileVersion;
+	int32 RawSize = Raw.Num();
+	uint32 Crc = FCrc::MemCrc32(Raw.GetData(), Raw.Num());
+	HeaderWriter << Magic << Version << RawSize << CompressedSize << Crc;
+	FMemory::Memcpy(File.GetData(), Header.GetData(), FileHeaderSize);
+	return File;
+}
+
+bool FRfsnStreamSession::FromBytes(const TArray<uint8>& Bytes)
+{
+	using namespace RfsnSession;
+
+	*this = FRfsnStreamSession();
+	if (Bytes.Num() < FileHeaderSize)
+	{
+		return false;
+	}
+
+	FMemoryReader Header(Bytes);
+	uint32 Magic = 0;
+	uint32 Version = 0;
+	int32 RawSize = 0;
+	int32 CompressedSize = 0;
+	uint32 Crc = 0;
+	Header << Magic << Version << RawSize << CompressedSize << Crc;
+	if (Magic != FileMagic || Version != FileVersion || RawSize < 0 ||
+	    CompressedSize != Bytes.Num() - FileHeaderSize)
+	{
+		return false;
+	}
+
+	TArray<uint8> Raw;
+	Raw.SetNumUninitialized(RawSize);
+	if (!FCompression::UncompressMemory(NAME_Zlib, Raw.GetData(), RawSize, Bytes.GetData() + FileHeaderSize,
+	                                    CompressedSize) ||
+	    FCrc::MemCrc32(Raw.GetData(), Raw.Num()) != Crc)
+	{
+		return false;
+	}
+
+	FMemoryReader Reader(Raw);
+	int32 NumEvents = 0;
+	Reader << NpcId << Tally.Dialogues << Tally.Metas << Tally.Sentences << Tally.Errors << NumEvents;
+	if (Reader.IsError() || NumEvents < 0 || NumEvents > RawSize)
+	{
+		*this = FRfsnStreamSession();
+		return false;
+	}
+
+	Events.SetNum(NumEvents);
+	int64 TimeUs = 0;
+	for (FRfsnSessionEvent& Event : Events)
+	{
+		uint8 Type = 0;
+		uint32 DeltaUs = 0;
+		uint32 Code = 0;
+		uint32 Size = 0;
+		Reader << Type;
+		Reader.SerializeIntPacked(DeltaUs);
+		Reader.SerializeIntPacked(Code);
+		Reader.SerializeIntPacked(Size);
+		if (Reader.IsError() || Type >= static_cast<uint8>(ERfsnSessionEvent::Num) ||
+		    Size > static_cast<uint32>(RawSize - Reader.Tell()))
+		{
+			*this = FRfsnStreamSession();
+			return false;
+		}
+
+		TimeUs += DeltaUs;
+		Event.Type = static_cast<ERfsnSessionEvent>(Type);
+		Event.TimeUs = TimeUs;
+		Event.Code = static_cast<int32>(Code);
+		Event.Payload.SetNumUninitialized(Size);
+		Reader.Serialize(Event.Payload.GetData(), Size);
+	}
+	return true;
+}
+
+bool FRfsnStreamSession::SaveToFile(const FString& Path) const
+{
+	const TArray<uint8> File = ToBytes();
+	IFileManager::Get().MakeDirectory(*FPaths::GetPath(Path), true);
+	return File.Num() > 0 && FFileHelper::SaveArrayToFile(File, *Path);
+}
+
+bool FRfsnStreamSession::LoadFromFile(const FString& Path)
+{
+	TArray<uint8> File;
+	if (!FFileHelper::LoadFileToArray(File, *Path))
+	{
+		*this = FRfsnStreamSession();
+		return false;
+	}
+	return FromBytes(File);
+}
+
+FString FRfsnStreamSession::GetDefaultPath(const FString& Name)
+{
+	return FPaths::ProfilingDir() / TEXT("RfsnSessions") / (FPaths::MakeValidFileName(Name) + TEXT(".rfsnsession"));
+}
@@ -0,0 +1,88 @@
+// RFSN Test World
+// A bare game world for automation tests and benchmarks that need spawned actors, world subsystems and timers
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Components/SceneComponent.h"
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+#include "GameFramework/Actor.h"
+#include "GameFramework/WorldSettings.h"
+
+/**
+ * Game world created for one test or benchmark run and destroyed with it. There is no game mode, so BeginPlay
+ * starts the actors through the world settings the way a game mode's StartPlay would.
+ */
+class FRfsnTestWorld
+{
+public:
+	FRfsnTestWorld()
+	{
+		World = UWorld::CreateWorld(EWorldType::Game, false, TEXT("RfsnTestWorld"));
+		FWorldContext& Context = GEngine->CreateNewWorldContext(EWorldType::Game);
+		Context.SetCurrentWorld(World);
+		World->InitializeActorsForPlay(FURL());
+	}
+
+	~FRfsnTestWorld()
+	{
+		GEngine->DestroyWorldContext(World);
+		World->DestroyWorld(false);
+	}
+
+	FRfsnTestWorld(const FRfsnTestWorld&) = delete;
+	FRfsnTestWorld& operator=(const FRfsnTestWorld&) = delete;
+
+	UWorld* GetWorld() const { return World; }
+
+	template <typename T>
+	T* GetSubsystem() const
+	{
+		return World->GetSubsystem<T>();
+	}
+
+	/** Subsystems' OnWorldBeginPlay, then BeginPlay on every actor */
+	void BeginPlay()
+	{
+		World->BeginPlay();
+		if (!World->GetAuthGameMode())
+		{
+			World->GetWorldSettings()->NotifyBeginPlay();
+		}
+	}
+
+	/** One frame: actor and component ticks, tickable subsystems and timers */
+	void Tick(float DeltaSeconds) { World->Tick(LEVELTICK_All, DeltaSeconds); }
+
+	/** An empty actor with a scene root at Location */
+	AActor* SpawnActor(const FVector& Location)
+	{
+		AActor* Actor = World->SpawnActor<AActor>();
+		USceneComponent* Root = NewObject<USceneComponent>(Actor, TEXT("Root"));
+		Actor->SetRootComponent(Root);
+		Root->RegisterComponent();
+		Actor->SetActorLocation(Location);
+		return Actor;
+	}
+
+	/** Component of class T on Actor, registered (and begun, if the world already has) once Configure has run */
+	template <typename T>
+	T* AddComponent(AActor* Actor, TFunctionRef<void(T&)> Configure)
+	{
+		T* Component = NewObject<T>(Actor);
+		Configure(*Component);
+		Actor->AddInstanceComponent(Component);
+		Component->RegisterComponent();
+		return Component;
+	}
+
+	template <typename T>
+	T* AddComponent(AActor* Actor)
+	{
+		return AddComponent<T>(Actor, [](T&) {});
+	}
+
+private:
+	UWorld* World = nullptr;
+};
@@ -0,0 +1,165 @@
+// RFSN Token Decoder Implementation
+
+#include "RfsnTokenDecoder.h"
+
+namespace RfsnTokens
+{
+// Display names in enum order
+const TCHAR* const ActionNames[] = {
+    TEXT("Greet"), TEXT("Warn"), TEXT("Idle"), TEXT("Flee"), TEXT("Attack"),
+    TEXT("Trade"), TEXT("Offer"), TEXT("Talk"), TEXT("Apologize"), TEXT("Threaten"),
+    TEXT("Explain"), TEXT("Answer"), TEXT("Inquire"), TEXT("Help"), TEXT("Request"),
+    TEXT("Agree"), TEXT("Disagree"), TEXT("Accept"), TEXT("Refuse"), TEXT("Ignore"),
+};
+
+const TCHAR* const EmotionNames[] = {
+    TEXT("Joy"), TEXT("Trust"), TEXT("Fear"), TEXT("Surprise"), TEXT("Sadness"),
+    TEXT("Disgust"), TEXT("Anger"), TEXT("Anticipation"), TEXT("Neutral"),
+};
+
+static_assert(UE_ARRAY_COUNT(ActionNames) == UE_ARRAY_COUNT(ActionKeywords), "Every action needs a name");
+static_assert(UE_ARRAY_COUNT(EmotionNames) == static_cast<int32>(ERfsnCoreEmotion::Neutral) + 1,
+              "Every emotion needs a name");
+
+// Spot checks; RfsnBench Tokens round-trips every name at runtime
+static_assert(ActionTable.Find("Greet", 5) == 0 && ActionTable.Find("IGNORE", 6) == 19, "Action lookup");
+static_assert(ActionTable.Find("Greets", 6) == INDEX_NONE && ActionTable.Find("gree", 4) == INDEX_NONE,
+              "Action near-miss");
+static_assert(EmotionTable.Find("ANGRY", 5) != INDEX_NONE && EmotionTable.Find("Angst", 5) == INDEX_NONE,
+              "Emotion lookup");
+
+constexpr bool IsJsonSpace(UTF8CHAR C)
+{
+	return C == ' ' || C == '\t' || C == '\r' || C == '\n';
+}
+
+template <int32 NumKeywords, int32 NumSlots, typename EnumType, typename CharType>
+bool Decode(const TPerfectHash<NumKeywords, NumSlots>& Table, TStringView<CharType> Name, EnumType& OutValue)
+{
+	const int32 Index = Table.Find(Name.GetData(), Name.Len());
+	if (Index == INDEX_NONE)
+	{
+		return false;
+	}
+
+	OutValue = static_cast<EnumType>(Table.Keywords[Index].Value);
+	return true;
+}
+} // namespace RfsnTokens
+
+bool FRfsnTokenDecoder::TryDecodeAction(FStringView Name, ERfsnNpcAction& OutAction)
+{
+	return RfsnTokens::Decode(RfsnTokens::ActionTable, Name, OutAction);
+}
+
+bool FRfsnTokenDecoder::TryDecodeAction(FUtf8StringView Name, ERfsnNpcAction& OutAction)
+{
+	return RfsnTokens::Decode(RfsnTokens::ActionTable, Name, OutAction);
+}
+
+bool FRfsnTokenDecoder::TryDecodeEmotion(FStringView Name, ERfsnCoreEmotion& OutEmotion)
+{
+	return RfsnTokens::Decode(RfsnTokens::EmotionTable, Name, OutEmotion);
+}
+
+bool FRfsnTokenDecoder::TryDecodeEmotion(FUtf8StringView Name, ERfsnCoreEmotion& OutEmotion)
+{
+	return RfsnTokens::Decode(RfsnTokens::EmotionTable, Name, OutEmotion);
+}
+
+FRfsnMoodToken FRfsnTokenDecoder::DecodeMood(FStringView Mood)
+{
+	FRfsnMoodToken Token;
+	bool bHasEmotion = false;
+
+	int32 WordStart = 0;
+	for (int32 i = 0; i <= Mood.Len(); i++)
+	{
+		if (i < Mood.Len() && FChar::IsAlpha(Mood[i]))
+		{
+			continue;
+		}
+
+		const FStringView Word = Mood.Mid(WordStart, i - WordStart);
+		WordStart = i + 1;
+		if (Word.IsEmpty())
+		{
+			continue;
+		}
+
+		ERfsnMoodFlags Flag;
+		if (RfsnTokens::Decode(RfsnTokens::MoodTable, Word, Flag))
+		{
+			Token.Flags |= Flag;
+		}
+		if (!bHasEmotion)
+		{
+			bHasEmotion = TryDecodeEmotion(Word, Token.Emotion);
+		}
+	}
+
+	return Token;
+}
+
+const TCHAR* FRfsnTokenDecoder::GetActionName(ERfsnNpcAction Action)
+{
+	const SIZE_T Index = static_cast<SIZE_T>(Action);
+	return Index < UE_ARRAY_COUNT(RfsnTokens::ActionNames) ? RfsnTokens::ActionNames[Index] : TEXT("Unknown");
+}
+
+const TCHAR* FRfsnTokenDecoder::GetEmotionName(ERfsnCoreEmotion Emotion)
+{
+	const SIZE_T Index = static_cast<SIZE_T>(Emotion);
+	return Index < UE_ARRAY_COUNT(RfsnTokens::EmotionNames) ? RfsnTokens::EmotionNames[Index] : TEXT("Neutral");
+}
+
+bool FRfsnTokenDecoder::FindJsonString(FUtf8StringView Json, FUtf8StringView Key, FUtf8StringView& OutValue)
+{
+	const UTF8CHAR* Data = Json.GetData();
+	const int32 Len = Json.Len();
+
+	for (int32 i = 0; i + Key.Len() + 2 <= Len; i++)
+	{
+		// "Key" as a whole quoted token, not the tail of a longer key or of a value
+		if (Data[i] != '"' || Data[i + Key.Len() + 1] != '"' ||
+		    !Json.Mid(i + 1, Key.Len()).Equals(Key, ESearchCase::CaseSensitive))
+		{
+			continue;
+		}
+
+		int32 Pos = i + Key.Len() + 2;
+		while (Pos < Len && RfsnTokens::IsJsonSpace(Data[Pos]))
+		{
+			Pos++;
+		}
+		if (Pos >= Len || Data[Pos] != ':')
+		{
+			continue;
+		}
+
+		Pos++;
+		while (Pos < Len && RfsnTokens::IsJsonSpace(Data[Pos]))
+		{
+			Pos++;
+		}
+		if (Pos >= Len || Data[Pos] != '"')
+		{
+			return false;
+		}
+
+		const int32 ValueStart = ++Pos;
+		while (Pos < Len && Data[Pos] != '"')
+		{
+			Pos += Data[Pos] == '\\' ? 2 : 1;
+		}
+		if (Pos >= Len)
+		{
+			return false;
+		}
+
+		OutValue = Json.Mid(ValueStart, Pos - ValueStart);
+		return true;
+	}
+
+	return false;
+}
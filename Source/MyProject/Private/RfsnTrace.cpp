@@ -0,0 +1,11 @@
+// RFSN Trace Implementation
+
+#include "RfsnTrace.h"
+
+UE_TRACE_CHANNEL_DEFINE(RfsnChannel);
+
+TRACE_DECLARE_INT_COUNTER(RfsnInFlightRequests, TEXT("Rfsn/InFlightRequests"));
+TRACE_DECLARE_INT_COUNTER(RfsnPooledRequests, TEXT("Rfsn/PooledRequests"));
+TRACE_DECLARE_INT_COUNTER(RfsnActiveStreams, TEXT("Rfsn/ActiveStreams"));
+TRACE_DECLARE_INT_COUNTER(RfsnQueuedSentences, TEXT("Rfsn/QueuedSentences"));
+TRACE_DECLARE_INT_COUNTER(RfsnWitnessEvents, TEXT("Rfsn/WitnessEvents"));
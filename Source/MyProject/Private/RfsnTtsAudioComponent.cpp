@@ -3,6 +3,9 @@
 #include "RfsnTtsAudioComponent.h"
 #include "RfsnVoiceRouter.h"
 #include "RfsnEmotionBlend.h"
+#include "RfsnLipSync.h"
+#include "RfsnLipSyncAnalysis.h"
+#include "Async/Async.h"
 #include "Components/AudioComponent.h"
 #include "Kismet/GameplayStatics.h"
 #include "Sound/SoundWaveProcedural.h"
@@ -104,10 +107,14 @@ void URfsnTtsAudioComponent::PlayAudioFromPCM(const TArray<uint8>& PCMData, int3
 	// Queue the audio data
 	SoundWave->QueueAudio(PCMData.GetData(), PCMData.Num());
 
+	// Analyze once per clip off the game thread; lip sync samples it by playback time
+	StartLipSyncAnalysis(PCMData, SampleRate);
+
 	// Play the sound
 	AudioComponent->SetSound(SoundWave);
 	AudioComponent->Play();
 	bIsPlaying = true;
+	PlaybackStartTime = GetWorld() ? GetWorld()->GetAudioTimeSeconds() : 0.0;
 
 	OnAudioStarted.Broadcast(TEXT(""));
 
@@ -122,6 +129,10 @@ void URfsnTtsAudioComponent::StopAudio()
 	}
 	bIsPlaying = false;
 	AudioQueue.Empty();
+
+	// Drop the track and any analysis still in flight
+	LipSyncTrack.Reset();
+	ClipSerial++;
 }
 
 bool URfsnTtsAudioComponent::IsPlaying() const
@@ -129,6 +140,55 @@ bool URfsnTtsAudioComponent::IsPlaying() const
 	return AudioComponent ? AudioComponent->IsPlaying() : false;
 }
 
+float URfsnTtsAudioComponent::GetPlaybackTime() const
+{
+	const UWorld* World = GetWorld();
+	return World ? static_cast<float>(World->GetAudioTimeSeconds() - PlaybackStartTime) : 0.0f;
+}
+
+bool URfsnTtsAudioComponent::SampleLipSync(float& OutAmplitude, ERfsnViseme& OutViseme) const
+{
+	if (!LipSyncTrack.IsValid())
+	{
+		return false;
+	}
+
+	// Playback rate follows pitch for procedural waves
+	LipSyncTrack->Sample(GetPlaybackTime() * PitchMultiplier, OutAmplitude, OutViseme);
+	return true;
+}
+
+void URfsnTtsAudioComponent::StartLipSyncAnalysis(const TArray<uint8>& PCMData, int32 SampleRate)
+{
+	const uint32 Serial = ++ClipSerial;
+	LipSyncTrack.Reset();
+
+	if (!bAnalyzeForLipSync || !GetOwner() || !GetOwner()->FindComponentByClass<URfsnLipSync>())
+	{
+		return;
+	}
+
+	TWeakObjectPtr<URfsnTtsAudioComponent> WeakThis(this);
+	AsyncTask(ENamedThreads::AnyBackgroundThreadNormalTask,
+	          [WeakThis, Serial, PCMData, SampleRate]()
+	          {
+		          TSharedRef<const FRfsnLipSyncTrack, ESPMode::ThreadSafe> Track =
+		              MakeShared<FRfsnLipSyncTrack, ESPMode::ThreadSafe>(
+		                  FRfsnLipSyncAnalyzer::AnalyzeBytes(PCMData, SampleRate));
+
+		          // Must run on game thread
+		          AsyncTask(ENamedThreads::GameThread,
+		                    [WeakThis, Serial, Track]()
+		                    {
+			                    URfsnTtsAudioComponent* Component = WeakThis.Get();
+			                    if (Component && Component->ClipSerial == Serial)
+			                    {
+				                    Component->LipSyncTrack = Track;
+			                    }
+		                    });
+	          });
+}
+
 void URfsnTtsAudioComponent::ProcessNextInQueue()
 {
 	if (AudioQueue.Num() == 0)
@@ -258,6 +258,16 @@ void URfsnVoiceRouter::SendToBackend(ERfsnTtsBackend Backend, const FString& Tex
 	TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&JsonString);
 	FJsonSerializer::Serialize(JsonObject.ToSharedRef(), Writer);
 
+	// A played-back session answers with its recorded replies, so nothing goes to the backend
+	if (URfsnNpcClientComponent* NpcClient = GetOwner()->FindComponentByClass<URfsnNpcClientComponent>())
+	{
+		if (NpcClient->IsPlayingSession())
+		{
+			return;
+		}
+		NpcClient->RecordSessionEvent(ERfsnSessionEvent::TtsRequest, JsonString);
+	}
+
 	// Create HTTP request
 	TSharedRef<IHttpRequest, ESPMode::ThreadSafe> HttpRequest = FHttpModule::Get().CreateRequest();
 	HttpRequest->SetURL(Endpoint);
@@ -269,20 +279,30 @@ void URfsnVoiceRouter::SendToBackend(ERfsnTtsBackend Backend, const FString& Tex
 	HttpRequest->OnProcessRequestComplete().BindLambda(
 	    [this](FHttpRequestPtr Request, FHttpResponsePtr Response, bool bSuccess)
 	    {
-		    if (bSuccess && Response.IsValid() && Response->GetResponseCode() == 200)
+		    const int32 Code = bSuccess && Response.IsValid() ? Response->GetResponseCode() : 0;
+		    const FString Body = Code != 0 ? Response->GetContentAsString() : FString();
+		    if (URfsnNpcClientComponent* NpcClient = GetOwner()->FindComponentByClass<URfsnNpcClientComponent>())
 		    {
-			    FString AudioPath = Response->GetContentAsString();
-			    OnTtsComplete.Broadcast(AudioPath);
-		    }
-		    else
-		    {
-			    RFSN_LOG(TEXT("VoiceRouter: TTS request failed"));
+			    NpcClient->RecordSessionEvent(ERfsnSessionEvent::TtsResponse, Body, Code);
 		    }
+		    HandleTtsResponse(Code, Body);
 	    });
 
 	HttpRequest->ProcessRequest();
 }
 
+void URfsnVoiceRouter::HandleTtsResponse(int32 Code, const FString& Body)
+{
+	if (Code == 200)
+	{
+		OnTtsComplete.Broadcast(Body);
+	}
+	else
+	{
+		RFSN_LOG(TEXT("VoiceRouter: TTS request failed"));
+	}
+}
+
 FString URfsnVoiceRouter::GetBackendEndpoint(ERfsnTtsBackend Backend) const
 {
 	switch (Backend)
@@ -1,13 +1,15 @@
 // RFSN Weather Reactions Implementation
 
 #include "RfsnWeatherReactions.h"
+#include "RfsnWorldEnvironment.h"
 #include "RfsnLogging.h"
 #include "RfsnEmotionBlend.h"
+#include "Engine/World.h"
 
 URfsnWeatherReactions::URfsnWeatherReactions()
 {
-	PrimaryComponentTick.bCanEverTick = true;
-	PrimaryComponentTick.TickInterval = 5.0f; // Update every 5 seconds
+	// Weather and time changes are pushed by URfsnWorldEnvironment
+	PrimaryComponentTick.bCanEverTick = false;
 }
 
 void URfsnWeatherReactions::BeginPlay()
@@ -23,25 +25,46 @@ void URfsnWeatherReactions::BeginPlay()
 		Preferences.Add({ERfsnWeatherType::Cold, -0.4f, TEXT("It's freezing out here.")});
 	}
 
+	if (UWorld* World = GetWorld())
+	{
+		Environment = World->GetSubsystem<URfsnWorldEnvironment>();
+	}
+	if (URfsnWorldEnvironment* WorldEnvironment = Environment.Get())
+	{
+		EnvironmentSlot = WorldEnvironment->Register(this);
+	}
+	else
+	{
+		UpdateReaction();
+	}
+
 	RFSN_LOG(TEXT("WeatherReactions initialized for %s"), *GetOwner()->GetName());
 }
 
-void URfsnWeatherReactions::TickComponent(float DeltaTime, ELevelTick TickType,
-                                          FActorComponentTickFunction* ThisTickFunction)
+void URfsnWeatherReactions::EndPlay(const EEndPlayReason::Type EndPlayReason)
 {
-	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
+	if (URfsnWorldEnvironment* WorldEnvironment = Environment.Get())
+	{
+		WorldEnvironment->Unregister(EnvironmentSlot);
+	}
+	Environment.Reset();
+	EnvironmentSlot = INDEX_NONE;
 
-	UpdateTimeOfDay();
-	UpdateReaction();
+	Super::EndPlay(EndPlayReason);
 }
 
 void URfsnWeatherReactions::SetWeather(ERfsnWeatherType NewWeather)
 {
+	if (URfsnWorldEnvironment* WorldEnvironment = Environment.Get())
+	{
+		WorldEnvironment->SetWeather(NewWeather);
+		return;
+	}
+
 	if (NewWeather != CurrentWeather)
 	{
 		ERfsnWeatherType OldWeather = CurrentWeather;
-		CurrentWeather = NewWeather;
-		OnWeatherChanged.Broadcast(NewWeather, OldWeather);
+		HandleWeatherChanged(NewWeather);
 		UpdateReaction();
 
 		RFSN_LOG(TEXT("%s noticed weather change: %s -> %s"), *GetOwner()->GetName(), *WeatherToString(OldWeather),
@@ -51,94 +74,63 @@ void URfsnWeatherReactions::SetWeather(ERfsnWeatherType NewWeather)
 
 void URfsnWeatherReactions::SetGameTime(float Hour)
 {
-	CurrentHour = FMath::Fmod(Hour, 24.0f);
-	if (CurrentHour < 0)
-		CurrentHour += 24.0f;
-	UpdateTimeOfDay();
+	if (URfsnWorldEnvironment* WorldEnvironment = Environment.Get())
+	{
+		WorldEnvironment->AdvanceToHour(Hour);
+		return;
+	}
+
+	Hour = FMath::Fmod(Hour, 24.0f);
+	if (Hour < 0)
+		Hour += 24.0f;
+	HandleTimeChanged(Hour, FRfsnWeatherReactionBatch::GetTimeOfDay(Hour));
 }
 
-void URfsnWeatherReactions::UpdateTimeOfDay()
+void URfsnWeatherReactions::SetIndoors(bool bInIndoors)
 {
-	ERfsnTimeOfDay NewTime;
-
-	if (CurrentHour >= 0 && CurrentHour < 3)
+	if (bInIndoors != bIsIndoors)
 	{
-		NewTime = ERfsnTimeOfDay::Midnight;
+		bIsIndoors = bInIndoors;
+		RefreshPreferences();
 	}
-	else if (CurrentHour >= 3 && CurrentHour < 5)
-	{
-		NewTime = ERfsnTimeOfDay::Night;
-	}
-	else if (CurrentHour >= 5 && CurrentHour < 7)
-	{
-		NewTime = ERfsnTimeOfDay::Dawn;
-	}
-	else if (CurrentHour >= 7 && CurrentHour < 12)
-	{
-		NewTime = ERfsnTimeOfDay::Morning;
-	}
-	else if (CurrentHour >= 12 && CurrentHour < 14)
-	{
-		NewTime = ERfsnTimeOfDay::Noon;
-	}
-	else if (CurrentHour >= 14 && CurrentHour < 18)
+}
+
+void URfsnWeatherReactions::RefreshPreferences()
+{
+	if (URfsnWorldEnvironment* WorldEnvironment = Environment.Get())
 	{
-		NewTime = ERfsnTimeOfDay::Afternoon;
+		WorldEnvironment->UpdateNpc(EnvironmentSlot);
 	}
-	else if (CurrentHour >= 18 && CurrentHour < 21)
+	else
 	{
-		NewTime = ERfsnTimeOfDay::Evening;
+		UpdateReaction();
 	}
-	else
+}
+
+void URfsnWeatherReactions::HandleWeatherChanged(ERfsnWeatherType NewWeather)
+{
+	if (NewWeather != CurrentWeather)
 	{
-		NewTime = ERfsnTimeOfDay::Night;
+		const ERfsnWeatherType OldWeather = CurrentWeather;
+		CurrentWeather = NewWeather;
+		OnWeatherChanged.Broadcast(NewWeather, OldWeather);
 	}
+}
 
+void URfsnWeatherReactions::HandleTimeChanged(float Hour, ERfsnTimeOfDay NewTime)
+{
+	CurrentHour = Hour;
 	if (NewTime != CurrentTimeOfDay)
 	{
-		ERfsnTimeOfDay OldTime = CurrentTimeOfDay;
+		const ERfsnTimeOfDay OldTime = CurrentTimeOfDay;
 		CurrentTimeOfDay = NewTime;
 		OnTimeOfDayChanged.Broadcast(NewTime, OldTime);
 	}
 }
 
-void URfsnWeatherReactions::UpdateReaction()
+void URfsnWeatherReactions::HandleReaction(ERfsnWeatherReaction NewReaction, bool bNewShouldSeekShelter)
 {
-	float Feeling = GetWeatherFeeling();
-	ERfsnWeatherReaction NewReaction;
-
-	// Determine reaction based on feeling and weather severity
-	if (CurrentWeather == ERfsnWeatherType::Storm && !bIsIndoors)
-	{
-		NewReaction = ERfsnWeatherReaction::SeekShelter;
-		bShouldSeekShelter = true;
-	}
-	else if (CurrentWeather == ERfsnWeatherType::Rain && !bIsIndoors && bSeeksShelter)
-	{
-		NewReaction = ERfsnWeatherReaction::SeekShelter;
-		bShouldSeekShelter = true;
-	}
-	else if (Feeling < -0.5f)
-	{
-		NewReaction = ERfsnWeatherReaction::Uncomfortable;
-		bShouldSeekShelter = bSeeksShelter && !bIsIndoors;
-	}
-	else if (Feeling < -0.2f)
-	{
-		NewReaction = ERfsnWeatherReaction::Worried;
-		bShouldSeekShelter = false;
-	}
-	else if (Feeling > 0.3f)
-	{
-		NewReaction = ERfsnWeatherReaction::Enjoying;
-		bShouldSeekShelter = false;
-	}
-	else
-	{
-		NewReaction = ERfsnWeatherReaction::Neutral;
-		bShouldSeekShelter = false;
-	}
-
+	bShouldSeekShelter = bNewShouldSeekShelter;
 	if (NewReaction != CurrentReaction)
 	{
 		CurrentReaction = NewReaction;
@@ -146,6 +138,14 @@ void URfsnWeatherReactions::UpdateReaction()
 	}
 }
 
+void URfsnWeatherReactions::UpdateReaction()
+{
+	bool bNewShouldSeekShelter = false;
+	const ERfsnWeatherReaction NewReaction = FRfsnWeatherReactionBatch::React(
+	    CurrentWeather, GetWeatherFeeling(), bIsIndoors, bSeeksShelter, bNewShouldSeekShelter);
+	HandleReaction(NewReaction, bNewShouldSeekShelter);
+}
+
 float URfsnWeatherReactions::GetWeatherFeeling() const
 {
 	return GetPreference(CurrentWeather);
@@ -153,6 +153,11 @@ float URfsnWeatherReactions::GetWeatherFeeling() const
 
 float URfsnWeatherReactions::GetPreference(ERfsnWeatherType Weather) const
 {
+	if (const URfsnWorldEnvironment* WorldEnvironment = Environment.Get())
+	{
+		return WorldEnvironment->GetPreference(EnvironmentSlot, Weather);
+	}
+
 	for (const FRfsnWeatherPreference& Pref : Preferences)
 	{
 		if (Pref.Weather == Weather)
@@ -165,6 +170,11 @@ float URfsnWeatherReactions::GetPreference(ERfsnWeatherType Weather) const
 
 FString URfsnWeatherReactions::GetCustomComment(ERfsnWeatherType Weather) const
 {
+	if (const URfsnWorldEnvironment* WorldEnvironment = Environment.Get())
+	{
+		return WorldEnvironment->GetComment(EnvironmentSlot, Weather);
+	}
+
 	for (const FRfsnWeatherPreference& Pref : Preferences)
 	{
 		if (Pref.Weather == Weather && !Pref.Comment.IsEmpty())
@@ -236,9 +246,11 @@ FString URfsnWeatherReactions::GetEnvironmentContext() const
 {
 	FString Context;
 
-	// Time context
+	// Time context (with a game clock the hour moves between time-of-day changes)
+	const URfsnWorldEnvironment* WorldEnvironment = Environment.Get();
+	const float Hour = WorldEnvironment ? WorldEnvironment->GetGameHour() : CurrentHour;
 	Context += FString::Printf(TEXT("It is currently %s (around %d:00). "), *TimeOfDayToString(CurrentTimeOfDay),
-	                           FMath::FloorToInt(CurrentHour));
+	                           FMath::FloorToInt(Hour));
 
 	// Weather context
 	if (CurrentWeather != ERfsnWeatherType::Clear)
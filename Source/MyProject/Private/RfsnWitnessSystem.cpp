@@ -4,26 +4,367 @@
 #include "RfsnFactionSystem.h"
 #include "RfsnLogging.h"
 #include "RfsnNpcClientComponent.h"
-#include "EngineUtils.h"
+#include "RfsnTrace.h"
 #include "Kismet/GameplayStatics.h"
+#include "Algo/BinarySearch.h"
+
+// ─────────────────────────────────────────────────────────────
+// FRfsnKnowledgeMatrix
+// ─────────────────────────────────────────────────────────────
+
+int32 FRfsnKnowledgeMatrix::AddNpc()
+{
+	KnownBits.AddZeroed(WordsPerRow);
+	GossipBits.AddZeroed(WordsPerRow);
+	return Npcs.AddDefaulted();
+}
+
+int32 FRfsnKnowledgeMatrix::AddEvent()
+{
+	int32 Event;
+	if (FreeColumns.Num() > 0)
+	{
+		Event = FreeColumns.Pop(EAllowShrinking::No);
+	}
+	else
+	{
+		if (NumColumns == WordsPerRow * 64)
+		{
+			GrowColumns();
+		}
+		Event = NumColumns++;
+	}
+
+	ActiveBits[Event / 64] |= 1ull << (Event % 64);
+	return Event;
+}
+
+void FRfsnKnowledgeMatrix::RemoveEvent(int32 Event)
+{
+	if (Event < 0 || Event >= NumColumns)
+	{
+		return;
+	}
+
+	const int32 Word = Event / 64;
+	const uint64 Bit = 1ull << (Event % 64);
+	for (int32 Npc = 0; Npc < Npcs.Num(); Npc++)
+	{
+		uint64& Known = KnownBits[Npc * WordsPerRow + Word];
+		if (Known & Bit)
+		{
+			Cells.Remove(CellKey(Npc, Event));
+			Known &= ~Bit;
+			GossipBits[Npc * WordsPerRow + Word] &= ~Bit;
+		}
+	}
+
+	ActiveBits[Word] &= ~Bit;
+	FreeColumns.Add(Event);
+}
+
+void FRfsnKnowledgeMatrix::SetEventActive(int32 Event, bool bActive)
+{
+	if (Event >= 0 && Event < NumColumns)
+	{
+		const uint64 Bit = 1ull << (Event % 64);
+		ActiveBits[Event / 64] = bActive ? ActiveBits[Event / 64] | Bit : ActiveBits[Event / 64] & ~Bit;
+	}
+}
+
+void FRfsnKnowledgeMatrix::GrowColumns()
+{
+	const int32 NewWords = FMath::Max(WordsPerRow * 2, 1);
+
+	auto Widen = [this, NewWords](TArray<uint64>& Bits)
+	{
+		TArray<uint64> Wide;
+		Wide.SetNumZeroed(Npcs.Num() * NewWords);
+		for (int32 Npc = 0; Npc < Npcs.Num() && WordsPerRow > 0; Npc++)
+		{
+			FMemory::Memcpy(&Wide[Npc * NewWords], &Bits[Npc * WordsPerRow], WordsPerRow * sizeof(uint64));
+		}
+		Bits = MoveTemp(Wide);
+	};
+
+	Widen(KnownBits);
+	Widen(GossipBits);
+	ActiveBits.SetNumZeroed(NewWords);
+	WordsPerRow = NewWords;
+}
+
+bool FRfsnKnowledgeMatrix::Learn(int32 Npc, int32 Event, const FCell& Cell, bool bWillGossip)
+{
+	const int32 Word = Npc * WordsPerRow + Event / 64;
+	const uint64 Bit = 1ull << (Event % 64);
+	if (KnownBits[Word] & Bit)
+	{
+		return false;
+	}
+
+	KnownBits[Word] |= Bit;
+	if (bWillGossip)
+	{
+		GossipBits[Word] |= Bit;
+	}
+	Cells.Add(CellKey(Npc, Event), Cell);
+	return true;
+}
+
+void FRfsnKnowledgeMatrix::SetNpcLocation(int32 Npc, const FVector& Location)
+{
+	FNpc& Node = Npcs[Npc];
+	Node.Location = Location;
+
+	if (!Node.bPlaced)
+	{
+		Node.bPlaced = true;
+		Node.ContactLocation = Location;
+		Grid.Add(Npc, Location);
+		MarkDirty(Npc);
+	}
+	else if (FVector::DistSquared(Node.ContactLocation, Location) > FMath::Square(ContactSlack))
+	{
+		MarkDirty(Npc);
+	}
+}
+
+void FRfsnKnowledgeMatrix::ClearNpcLocation(int32 Npc)
+{
+	FNpc& Node = Npcs[Npc];
+	if (!Node.bPlaced)
+	{
+		return;
+	}
+
+	Unlink(Npc);
+	Grid.Remove(Npc, Node.ContactLocation);
+	Node.bPlaced = false;
+
+	if (Node.bDirty)
+	{
+		Node.bDirty = false;
+		DirtyNpcs.RemoveSingleSwap(Npc, EAllowShrinking::No);
+	}
+}
+
+void FRfsnKnowledgeMatrix::MarkDirty(int32 Npc)
+{
+	if (!Npcs[Npc].bDirty)
+	{
+		Npcs[Npc].bDirty = true;
+		DirtyNpcs.Add(Npc);
+	}
+}
+
+void FRfsnKnowledgeMatrix::UpdateContacts()
+{
+	if (LinkedRadius != ContactRadius)
+	{
+		LinkedRadius = ContactRadius;
+		for (int32 Npc = 0; Npc < Npcs.Num(); Npc++)
+		{
+			if (Npcs[Npc].bPlaced)
+			{
+				MarkDirty(Npc);
+			}
+		}
+	}
+
+	// Re-bucket every mover first so each one's query sees the others where they are now
+	for (const int32 Npc : DirtyNpcs)
+	{
+		FNpc& Node = Npcs[Npc];
+		Grid.Move(Npc, Node.ContactLocation, Node.Location);
+		Node.ContactLocation = Node.Location;
+	}
+
+	for (const int32 Npc : DirtyNpcs)
+	{
+		Unlink(Npc);
+		Link(Npc);
+		Npcs[Npc].bDirty = false;
+	}
+	DirtyNpcs.Reset();
+}
+
+void FRfsnKnowledgeMatrix::Unlink(int32 Npc)
+{
+	for (const int32 Other : Npcs[Npc].Contacts)
+	{
+		TArray<int32>& OtherContacts = Npcs[Other].Contacts;
+		const int32 Index = Algo::BinarySearch(OtherContacts, Npc);
+		if (Index != INDEX_NONE)
+		{
+			OtherContacts.RemoveAt(Index, 1, EAllowShrinking::No);
+		}
+	}
+	Npcs[Npc].Contacts.Reset();
+}
+
+void FRfsnKnowledgeMatrix::Link(int32 Npc)
+{
+	FNpc& Node = Npcs[Npc];
+	const float RadiusSq = ContactRadius * ContactRadius;
+
+	// Non-movers may sit up to ContactSlack from their cell
+	Grid.Query(Node.Location, ContactRadius + ContactSlack,
+	           [this, Npc, &Node, RadiusSq](int32 Other)
+	           {
+		           if (Other == Npc || FVector::DistSquared(Node.Location, Npcs[Other].Location) >= RadiusSq)
+		           {
+			           return;
+		           }
+
+		           Node.Contacts.Add(Other);
+		           TArray<int32>& OtherContacts = Npcs[Other].Contacts;
+		           OtherContacts.Insert(Npc, Algo::LowerBound(OtherContacts, Npc));
+	           });
+
+	Node.Contacts.Sort();
+}
+
+void FRfsnKnowledgeMatrix::TickSpread(FRandomStream& Random, float Chance, float GossipChance, float AccuracyDecay,
+                                      TArray<FRfsnRumorSpread>& OutSpreads)
+{
+	const int32 MaxPerContact = MaxRumorsPerContact > 0 ? MaxRumorsPerContact : MAX_int32;
+
+	for (int32 From = 0; From < Npcs.Num(); From++)
+	{
+		for (const int32 To : Npcs[From].Contacts)
+		{
+			if (Random.FRand() > Chance)
+			{
+				continue;
+			}
+
+			// What the teller will pass on and the listener lacks, a word of events at a time
+			const uint64* Gossip = GossipBits.GetData() + From * WordsPerRow;
+			const uint64* Known = KnownBits.GetData() + To * WordsPerRow;
+			int32 Shared = 0;
+
+			for (int32 Word = 0; Word < WordsPerRow && Shared < MaxPerContact; Word++)
+			{
+				for (uint64 Fresh = Gossip[Word] & ActiveBits[Word] & ~Known[Word]; Fresh && Shared < MaxPerContact;
+				     Fresh &= Fresh - 1)
+				{
+					const int32 Event = Word * 64 + static_cast<int32>(FMath::CountTrailingZeros64(Fresh));
+
+					FCell& Teller = Cells.FindChecked(CellKey(From, Event));
+					Teller.ShareCount++;
+
+					FCell Heard;
+					Heard.Accuracy = FMath::Max(0.1f, Teller.Accuracy - AccuracyDecay);
+					Heard.Opinion = Teller.Opinion;
+					Heard.SourceNpc = From;
+
+					// Teller may move when the cell map grows
+					Learn(To, Event, Heard, Random.FRand() < GossipChance);
+					OutSpreads.Add({From, To, Event});
+					Shared++;
+				}
+			}
+		}
+	}
+}
+
+SIZE_T FRfsnKnowledgeMatrix::GetAllocatedSize() const
+{
+	SIZE_T Size = KnownBits.GetAllocatedSize() + GossipBits.GetAllocatedSize() + ActiveBits.GetAllocatedSize() +
+	              Cells.GetAllocatedSize() + Npcs.GetAllocatedSize() + FreeColumns.GetAllocatedSize() +
+	              DirtyNpcs.GetAllocatedSize();
+	for (const FNpc& Node : Npcs)
+	{
+		Size += Node.Contacts.GetAllocatedSize();
+	}
+	return Size;
+}
+
+// ─────────────────────────────────────────────────────────────
+// URfsnWitnessSystem
+// ─────────────────────────────────────────────────────────────
 
 void URfsnWitnessSystem::Initialize(FSubsystemCollectionBase& Collection)
 {
 	Super::Initialize(Collection);
+	RumorRandom.GenerateNewSeed();
 	RFSN_LOG(TEXT("WitnessSystem initialized"));
 }
 
 void URfsnWitnessSystem::Deinitialize()
 {
 	AllEvents.Empty();
-	NpcKnowledge.Empty();
+	Knowledge = FRfsnKnowledgeMatrix();
+	NpcRows.Empty();
+	RowNpcIds.Empty();
+	RowActors.Empty();
+	EventColumns.Empty();
+	ColumnEvents.Empty();
 	Super::Deinitialize();
 }
 
+void URfsnWitnessSystem::RegisterNpcClient(URfsnNpcClientComponent* Client)
+{
+	if (!Client || !Client->GetOwner() || Client->NpcId.IsEmpty())
+	{
+		return;
+	}
+
+	const int32 Row = FindOrAddNpcRow(Client->NpcId);
+	RowActors[Row] = Client->GetOwner();
+	Knowledge.SetNpcLocation(Row, Client->GetOwner()->GetActorLocation());
+}
+
+void URfsnWitnessSystem::UnregisterNpcClient(URfsnNpcClientComponent* Client)
+{
+	const int32* Row = Client ? FindNpcRow(Client->NpcId) : nullptr;
+	if (Row && RowActors[*Row] == Client->GetOwner())
+	{
+		RowActors[*Row].Reset();
+		Knowledge.ClearNpcLocation(*Row);
+	}
+}
+
+int32 URfsnWitnessSystem::FindOrAddNpcRow(const FString& NpcId)
+{
+	if (const int32* Row = NpcRows.Find(NpcId))
+	{
+		return *Row;
+	}
+
+	const int32 Row = Knowledge.AddNpc();
+	RowNpcIds.Add(NpcId);
+	RowActors.AddDefaulted();
+	NpcRows.Add(NpcId, Row);
+	return Row;
+}
+
+void URfsnWitnessSystem::RefreshNpcLocations()
+{
+	Knowledge.ContactRadius = ConversationDistance;
+	Knowledge.MaxRumorsPerContact = RumorsPerContact;
+
+	for (int32 Row = 0; Row < RowActors.Num(); Row++)
+	{
+		if (const AActor* Actor = RowActors[Row].Get())
+		{
+			Knowledge.SetNpcLocation(Row, Actor->GetActorLocation());
+		}
+		else if (Knowledge.HasLocation(Row))
+		{
+			Knowledge.ClearNpcLocation(Row);
+		}
+	}
+
+	Knowledge.UpdateContacts();
+}
+
 FGuid URfsnWitnessSystem::RecordPlayerAction(ERfsnWitnessEventType EventType, const FString& Description,
                                              FVector Location, const FString& TargetNpcId, float Importance,
                                              bool bPositive)
 {
+	RFSN_TRACE_SCOPE(RfsnWitness_RecordPlayerAction);
+
 	// Create event
 	FRfsnWitnessEvent Event;
 	Event.EventType = EventType;
@@ -38,28 +379,45 @@ FGuid URfsnWitnessSystem::RecordPlayerAction(ERfsnWitnessEventType EventType, co
 	TArray<FString> Witnesses = FindWitnesses(Location);
 	Event.OriginalWitnesses = Witnesses;
 
+	// Store event
+	const int32 Column = Knowledge.AddEvent();
+	EventColumns.Add(Event.EventId, Column);
+	ColumnEvents.SetNum(Knowledge.NumEventColumns());
+	ColumnEvents[Column] = AllEvents.Add(Event);
+
 	// Register knowledge for each witness
 	for (const FString& WitnessId : Witnesses)
 	{
-		RegisterWitness(Event.EventId, WitnessId, 1.0f, TEXT("witnessed"));
-		OnEventWitnessed.Broadcast(Event, WitnessId);
+		RegisterWitness(Column, FindOrAddNpcRow(WitnessId));
 	}
 
-	// Store event
-	AllEvents.Add(Event);
+	const FRfsnWitnessEvent Recorded = AllEvents[ColumnEvents[Column]];
+	for (const FString& WitnessId : Witnesses)
+	{
+		OnEventWitnessed.Broadcast(Recorded, WitnessId);
+	}
 
 	// Trim old events if over limit
-	while (AllEvents.Num() > MaxTrackedEvents)
+	const int32 Excess = AllEvents.Num() - MaxTrackedEvents;
+	if (Excess > 0)
 	{
-		AllEvents.RemoveAt(0);
+		for (int32 i = 0; i < Excess; i++)
+		{
+			ForgetEvent(AllEvents[i].EventId);
+		}
+		AllEvents.RemoveAt(0, Excess);
+		ReindexEvents();
 	}
+	RFSN_TRACE_COUNTER_SET(RfsnWitnessEvents, AllEvents.Num());
 
 	RFSN_LOG(TEXT("Recorded event: %s (witnessed by %d NPCs)"), *Description, Witnesses.Num());
-	return Event.EventId;
+	return Recorded.EventId;
 }
 
 TArray<FString> URfsnWitnessSystem::FindWitnesses(FVector Location, float Radius)
 {
+	RFSN_TRACE_SCOPE(RfsnWitness_FindWitnesses);
+
 	TArray<FString> Witnesses;
 
 	if (Radius < 0.0f)
@@ -67,121 +425,88 @@ TArray<FString> URfsnWitnessSystem::FindWitnesses(FVector Location, float Radius
 		Radius = WitnessRadius;
 	}
 
-	UWorld* World = GetWorld();
-	if (!World)
-	{
-		return Witnesses;
-	}
-
-	// Find all NPCs with RfsnNpcClientComponent in range
-	for (TActorIterator<AActor> It(World); It; ++It)
-	{
-		AActor* Actor = *It;
-		URfsnNpcClientComponent* NpcClient = Actor->FindComponentByClass<URfsnNpcClientComponent>();
-
-		if (!NpcClient || NpcClient->NpcId.IsEmpty())
-		{
-			continue;
-		}
-
-		float Distance = FVector::Dist(Location, Actor->GetActorLocation());
-		if (Distance <= Radius)
-		{
-			// Check line of sight (optional, simplified)
-			Witnesses.Add(NpcClient->NpcId);
-		}
-	}
+	// Registered NPCs in range (line of sight not checked)
+	RefreshNpcLocations();
+	Knowledge.QueryNpcs(Location, Radius, [this, &Witnesses](int32 Row) { Witnesses.Add(RowNpcIds[Row]); });
 
 	return Witnesses;
 }
 
-void URfsnWitnessSystem::RegisterWitness(const FGuid& EventId, const FString& NpcId, float Accuracy,
-                                         const FString& Source)
+void URfsnWitnessSystem::RegisterWitness(int32 Column, int32 NpcRow, float Accuracy, int32 SourceRow)
 {
-	FRfsnEventKnowledge Knowledge;
-	Knowledge.EventId = EventId;
-	Knowledge.Accuracy = Accuracy;
-	Knowledge.Source = Source;
-	Knowledge.bWillGossip = FMath::FRand() < 0.7f; // 70% chance to gossip
+	FRfsnKnowledgeMatrix::FCell Cell;
+	Cell.Accuracy = Accuracy;
+	Cell.SourceNpc = SourceRow;
 
-	// Calculate opinion based on faction
-	const FRfsnWitnessEvent* Event = FindEvent(EventId);
+	FRfsnWitnessEvent* Event = GetColumnEvent(Column);
 	if (Event)
 	{
-		// Find NPC's faction
-		UWorld* World = GetWorld();
-		if (World)
-		{
-			for (TActorIterator<AActor> It(World); It; ++It)
-			{
-				URfsnNpcClientComponent* Client = (*It)->FindComponentByClass<URfsnNpcClientComponent>();
-				if (Client && Client->NpcId == NpcId)
-				{
-					// TODO: Get faction from faction system once integrated
-					Knowledge.Opinion = CalculateOpinion(TEXT(""), *Event);
-					break;
-				}
-			}
-		}
-
-		// Update event's informed list
-		FRfsnWitnessEvent* MutableEvent = FindEvent(EventId);
-		if (MutableEvent && !MutableEvent->InformedNpcs.Contains(NpcId))
-		{
-			MutableEvent->InformedNpcs.Add(NpcId);
-		}
+		// TODO: Get faction from faction system once integrated
+		Cell.Opinion = CalculateOpinion(TEXT(""), *Event);
 	}
 
-	// Store knowledge
-	if (!NpcKnowledge.Contains(NpcId))
+	if (Knowledge.Learn(NpcRow, Column, Cell, RumorRandom.FRand() < GossipChance) && Event)
 	{
-		NpcKnowledge.Add(NpcId, TMap<FGuid, FRfsnEventKnowledge>());
+		Event->InformedNpcs.Add(RowNpcIds[NpcRow]);
 	}
-	NpcKnowledge[NpcId].Add(EventId, Knowledge);
 }
 
-bool URfsnWitnessSystem::DoesNpcKnow(const FString& NpcId, const FGuid& EventId) const
+FRfsnEventKnowledge URfsnWitnessSystem::MakeKnowledge(int32 NpcRow, int32 Column) const
 {
-	const TMap<FGuid, FRfsnEventKnowledge>* KnowledgeMap = NpcKnowledge.Find(NpcId);
-	if (!KnowledgeMap)
+	FRfsnEventKnowledge Result;
+	const FRfsnKnowledgeMatrix::FCell* Cell = Knowledge.FindCell(NpcRow, Column);
+	const FRfsnWitnessEvent* Event = GetColumnEvent(Column);
+	if (!Cell || !Event)
 	{
-		return false;
+		return Result;
 	}
-	return KnowledgeMap->Contains(EventId);
+
+	Result.EventId = Event->EventId;
+	Result.Source = Cell->SourceNpc == INDEX_NONE
+	                    ? FString(TEXT("witnessed"))
+	                    : FString::Printf(TEXT("heard from %s"), *RowNpcIds[Cell->SourceNpc]);
+	Result.Accuracy = Cell->Accuracy;
+	Result.Opinion = Cell->Opinion;
+	Result.bWillGossip = Knowledge.WillGossip(NpcRow, Column);
+	Result.ShareCount = Cell->ShareCount;
+	return Result;
+}
+
+bool URfsnWitnessSystem::DoesNpcKnow(const FString& NpcId, const FGuid& EventId) const
+{
+	const int32* Row = FindNpcRow(NpcId);
+	const int32* Column = EventColumns.Find(EventId);
+	return Row && Column && Knowledge.Knows(*Row, *Column);
 }
 
 FRfsnEventKnowledge URfsnWitnessSystem::GetNpcKnowledge(const FString& NpcId, const FGuid& EventId) const
 {
-	const TMap<FGuid, FRfsnEventKnowledge>* KnowledgeMap = NpcKnowledge.Find(NpcId);
-	if (KnowledgeMap)
-	{
-		const FRfsnEventKnowledge* Knowledge = KnowledgeMap->Find(EventId);
-		if (Knowledge)
-		{
-			return *Knowledge;
-		}
-	}
-	return FRfsnEventKnowledge();
+	const int32* Row = FindNpcRow(NpcId);
+	const int32* Column = EventColumns.Find(EventId);
+	return Row && Column ? MakeKnowledge(*Row, *Column) : FRfsnEventKnowledge();
 }
 
 TArray<FRfsnWitnessEvent> URfsnWitnessSystem::GetNpcKnownEvents(const FString& NpcId) const
 {
+	RFSN_TRACE_SCOPE(RfsnWitness_GetNpcKnownEvents);
+
 	TArray<FRfsnWitnessEvent> Result;
 
-	const TMap<FGuid, FRfsnEventKnowledge>* KnowledgeMap = NpcKnowledge.Find(NpcId);
-	if (!KnowledgeMap)
+	const int32* Row = FindNpcRow(NpcId);
+	if (!Row)
 	{
 		return Result;
 	}
 
-	for (const auto& Pair : *KnowledgeMap)
-	{
-		const FRfsnWitnessEvent* Event = FindEvent(Pair.Key);
-		if (Event && !Event->bExpired)
-		{
-			Result.Add(*Event);
-		}
-	}
+	// Expired events are inactive columns, which ForEachKnown skips
+	Knowledge.ForEachKnown(*Row,
+	                       [this, &Result](int32 Column)
+	                       {
+		                       if (const FRfsnWitnessEvent* Event = GetColumnEvent(Column))
+		                       {
+			                       Result.Add(*Event);
+		                       }
+	                       });
 
 	return Result;
 }
@@ -204,90 +529,96 @@ TArray<FRfsnWitnessEvent> URfsnWitnessSystem::GetRecentEvents(int32 MaxCount) co
 
 FString URfsnWitnessSystem::GetGossipForNpc(const FString& NpcId) const
 {
-	TArray<FRfsnWitnessEvent> KnownEvents = GetNpcKnownEvents(NpcId);
-	if (KnownEvents.Num() == 0)
+	const int32* Row = FindNpcRow(NpcId);
+	if (!Row)
 	{
 		return TEXT("");
 	}
 
-	// Pick a random event they know about and will gossip
-	TArray<FRfsnWitnessEvent> GossipEvents;
-	for (const FRfsnWitnessEvent& Event : KnownEvents)
-	{
-		FRfsnEventKnowledge Knowledge = GetNpcKnowledge(NpcId, Event.EventId);
-		if (Knowledge.bWillGossip && Knowledge.ShareCount < 3)
-		{
-			GossipEvents.Add(Event);
-		}
-	}
-
-	if (GossipEvents.Num() == 0)
+	// Most important event they know about, will gossip and haven't worn out
+	const FRfsnWitnessEvent* Best = nullptr;
+	Knowledge.ForEachKnown(*Row,
+	                       [this, Row, &Best](int32 Column)
+	                       {
+		                       const FRfsnKnowledgeMatrix::FCell* Cell = Knowledge.FindCell(*Row, Column);
+		                       const FRfsnWitnessEvent* Event = GetColumnEvent(Column);
+		                       if (Event && Cell && Cell->ShareCount < 3 && Knowledge.WillGossip(*Row, Column) &&
+		                           (!Best || Event->Importance > Best->Importance))
+		                       {
+			                       Best = Event;
+		                       }
+	                       });
+
+	if (!Best)
 	{
 		return TEXT("");
 	}
 
-	// Return most important/recent gossip
-	GossipEvents.Sort([](const FRfsnWitnessEvent& A, const FRfsnWitnessEvent& B)
-	                  { return A.Importance > B.Importance; });
-
-	return FString::Printf(TEXT("I heard that %s"), *GossipEvents[0].Description);
+	return FString::Printf(TEXT("I heard that %s"), *Best->Description);
 }
 
 FString URfsnWitnessSystem::GetWitnessContext(const FString& NpcId) const
 {
-	TArray<FRfsnWitnessEvent> KnownEvents = GetNpcKnownEvents(NpcId);
-	if (KnownEvents.Num() == 0)
+	RFSN_TRACE_SCOPE(RfsnWitness_GetWitnessContext);
+
+	const int32* Row = FindNpcRow(NpcId);
+	if (!Row)
 	{
 		return TEXT("");
 	}
 
-	FString Context = TEXT("This NPC knows about: ");
+	FString Context;
 	int32 Count = 0;
 
-	for (const FRfsnWitnessEvent& Event : KnownEvents)
-	{
-		if (Count >= 3)
-			break; // Limit context length
-
-		FRfsnEventKnowledge Knowledge = GetNpcKnowledge(NpcId, Event.EventId);
-		FString Accuracy = Knowledge.Accuracy > 0.8f   ? TEXT("clearly saw")
-		                   : Knowledge.Accuracy > 0.5f ? TEXT("heard about")
-		                                               : TEXT("vaguely heard");
-
-		Context +=
-		    FString::Printf(TEXT("[%s %s: %s] "), *Accuracy, *EventTypeToString(Event.EventType), *Event.Description);
-		Count++;
-	}
-
-	return Context;
+	Knowledge.ForEachKnown(
+	    *Row,
+	    [this, Row, &Context, &Count](int32 Column)
+	    {
+		    const FRfsnWitnessEvent* Event = GetColumnEvent(Column);
+		    const FRfsnKnowledgeMatrix::FCell* Cell = Knowledge.FindCell(*Row, Column);
+		    if (Count >= 3 || !Event || !Cell)
+		    {
+			    return; // Limit context length
+		    }
+
+		    const TCHAR* Accuracy = Cell->Accuracy > 0.8f   ? TEXT("clearly saw")
+		                            : Cell->Accuracy > 0.5f ? TEXT("heard about")
+		                                                    : TEXT("vaguely heard");
+
+		    Context += FString::Printf(TEXT("[%s %s: %s] "), Accuracy, *EventTypeToString(Event->EventType),
+		                               *Event->Description);
+		    Count++;
+	    });
+
+	return Count > 0 ? TEXT("This NPC knows about: ") + Context : FString();
 }
 
 void URfsnWitnessSystem::SpreadRumor(const FGuid& EventId, const FString& FromNpc, const FString& ToNpc)
 {
-	if (!DoesNpcKnow(FromNpc, EventId))
+	const int32* FromRow = FindNpcRow(FromNpc);
+	const int32* Column = EventColumns.Find(EventId);
+	if (!FromRow || !Column || !Knowledge.Knows(*FromRow, *Column))
 	{
 		return; // From NPC doesn't know
 	}
 
-	if (DoesNpcKnow(ToNpc, EventId))
+	const int32 From = *FromRow;
+	const int32 To = FindOrAddNpcRow(ToNpc);
+	if (Knowledge.Knows(To, *Column))
 	{
 		return; // To NPC already knows
 	}
 
-	FRfsnEventKnowledge FromKnowledge = GetNpcKnowledge(FromNpc, EventId);
-
 	// Degrade accuracy based on rumor hop
-	float NewAccuracy = FMath::Max(0.1f, FromKnowledge.Accuracy - AccuracyDecayPerHop);
+	FRfsnKnowledgeMatrix::FCell* Teller = Knowledge.FindCell(From, *Column);
+	const float NewAccuracy = FMath::Max(0.1f, (Teller ? Teller->Accuracy : 1.0f) - AccuracyDecayPerHop);
 
-	RegisterWitness(EventId, ToNpc, NewAccuracy, FString::Printf(TEXT("heard from %s"), *FromNpc));
+	RegisterWitness(*Column, To, NewAccuracy, From);
 
-	// Increment share count
-	if (TMap<FGuid, FRfsnEventKnowledge>* KnowledgeMap = NpcKnowledge.Find(FromNpc))
+	// Increment share count (looked up again, the cell map may have grown)
+	if (FRfsnKnowledgeMatrix::FCell* Shared = Knowledge.FindCell(From, *Column))
 	{
-		if (FRfsnEventKnowledge* Knowledge = KnowledgeMap->Find(EventId))
-		{
-			Knowledge->ShareCount++;
-		}
+		Shared->ShareCount++;
 	}
 
 	OnRumorSpread.Broadcast(EventId, FromNpc, ToNpc);
@@ -296,95 +627,100 @@ void URfsnWitnessSystem::SpreadRumor(const FGuid& EventId, const FString& FromNp
 
 void URfsnWitnessSystem::TickRumorSpreading()
 {
-	UWorld* World = GetWorld();
-	if (!World)
-	{
-		return;
-	}
+	RFSN_TRACE_SCOPE(RfsnWitness_TickRumorSpreading);
+
+	// Contacts only change around NPCs that moved
+	RefreshNpcLocations();
 
-	// Build list of all NPC pairs in proximity
-	TArray<TPair<FString, FString>> NpcPairs;
+	TArray<FRfsnRumorSpread> Spreads;
+	Knowledge.TickSpread(RumorRandom, RumorSpreadChance, GossipChance, AccuracyDecayPerHop, Spreads);
 
-	for (TActorIterator<AActor> It(World); It; ++It)
+	for (const FRfsnRumorSpread& Spread : Spreads)
 	{
-		URfsnNpcClientComponent* ClientA = (*It)->FindComponentByClass<URfsnNpcClientComponent>();
-		if (!ClientA || ClientA->NpcId.IsEmpty())
+		FRfsnWitnessEvent* Event = GetColumnEvent(Spread.Event);
+		if (!Event)
 		{
 			continue;
 		}
 
-		for (TActorIterator<AActor> It2(World); It2; ++It2)
-		{
-			if (*It == *It2)
-			{
-				continue;
-			}
+		const FString& FromNpc = RowNpcIds[Spread.FromNpc];
+		const FString& ToNpc = RowNpcIds[Spread.ToNpc];
+		Event->InformedNpcs.Add(ToNpc);
 
-			URfsnNpcClientComponent* ClientB = (*It2)->FindComponentByClass<URfsnNpcClientComponent>();
-			if (!ClientB || ClientB->NpcId.IsEmpty())
-			{
-				continue;
-			}
+		OnRumorSpread.Broadcast(Event->EventId, FromNpc, ToNpc);
+		RFSN_LOG(TEXT("Rumor spread: %s -> %s (accuracy: %.2f)"), *FromNpc, *ToNpc,
+		         Knowledge.FindCell(Spread.ToNpc, Spread.Event)->Accuracy);
+	}
+}
+
+void URfsnWitnessSystem::CleanupExpiredEvents()
+{
+	RFSN_TRACE_SCOPE(RfsnWitness_CleanupExpiredEvents);
 
-			float Distance = FVector::Dist((*It)->GetActorLocation(), (*It2)->GetActorLocation());
-			if (Distance < 500.0f) // Conversation distance
+	float CurrentTime = GetWorld() ? UGameplayStatics::GetTimeSeconds(GetWorld()) : 0.0f;
+	float ExpiryTime = MemoryDurationHours * 3600.0f; // Convert hours to seconds
+
+	for (FRfsnWitnessEvent& Event : AllEvents)
+	{
+		if (!Event.bExpired && (CurrentTime - Event.GameTimeWhenOccurred) > ExpiryTime)
+		{
+			Event.bExpired = true;
+			if (const int32* Column = EventColumns.Find(Event.EventId))
 			{
-				NpcPairs.Add(TPair<FString, FString>(ClientA->NpcId, ClientB->NpcId));
+				Knowledge.SetEventActive(*Column, false);
 			}
 		}
 	}
 
-	// For each pair, chance to spread rumor
-	for (const auto& Pair : NpcPairs)
-	{
-		if (FMath::FRand() > RumorSpreadChance)
-		{
-			continue;
-		}
+	// Remove very old events
+	auto IsForgotten = [CurrentTime, ExpiryTime](const FRfsnWitnessEvent& Event)
+	{ return Event.bExpired && (CurrentTime - Event.GameTimeWhenOccurred) > (ExpiryTime * 2.0f); };
 
-		// Get events FromNpc knows but ToNpc doesn't
-		TArray<FRfsnWitnessEvent> KnownEvents = GetNpcKnownEvents(Pair.Key);
-		for (const FRfsnWitnessEvent& Event : KnownEvents)
+	for (const FRfsnWitnessEvent& Event : AllEvents)
+	{
+		if (IsForgotten(Event))
 		{
-			if (!DoesNpcKnow(Pair.Value, Event.EventId))
-			{
-				FRfsnEventKnowledge Knowledge = GetNpcKnowledge(Pair.Key, Event.EventId);
-				if (Knowledge.bWillGossip)
-				{
-					SpreadRumor(Event.EventId, Pair.Key, Pair.Value);
-					break; // One rumor per tick per pair
-				}
-			}
+			ForgetEvent(Event.EventId);
 		}
 	}
+	if (AllEvents.RemoveAll(IsForgotten) > 0)
+	{
+		ReindexEvents();
+	}
+	RFSN_TRACE_COUNTER_SET(RfsnWitnessEvents, AllEvents.Num());
 }
 
-void URfsnWitnessSystem::CleanupExpiredEvents()
+void URfsnWitnessSystem::ForgetEvent(const FGuid& EventId)
 {
-	float CurrentTime = GetWorld() ? UGameplayStatics::GetTimeSeconds(GetWorld()) : 0.0f;
-	float ExpiryTime = MemoryDurationHours * 3600.0f; // Convert hours to seconds
+	int32 Column = INDEX_NONE;
+	if (EventColumns.RemoveAndCopyValue(EventId, Column))
+	{
+		Knowledge.RemoveEvent(Column);
+	}
+}
 
-	for (FRfsnWitnessEvent& Event : AllEvents)
+void URfsnWitnessSystem::ReindexEvents()
+{
+	ColumnEvents.Init(INDEX_NONE, Knowledge.NumEventColumns());
+	for (int32 i = 0; i < AllEvents.Num(); i++)
 	{
-		if (!Event.bExpired && (CurrentTime - Event.GameTimeWhenOccurred) > ExpiryTime)
+		if (const int32* Column = EventColumns.Find(AllEvents[i].EventId))
 		{
-			Event.bExpired = true;
+			ColumnEvents[*Column] = i;
 		}
 	}
-
-	// Remove very old events
-	AllEvents.RemoveAll([this, CurrentTime, ExpiryTime](const FRfsnWitnessEvent& Event)
-	                    { return Event.bExpired && (CurrentTime - Event.GameTimeWhenOccurred) > (ExpiryTime * 2.0f); });
 }
 
 FRfsnWitnessEvent* URfsnWitnessSystem::FindEvent(const FGuid& EventId)
 {
-	return AllEvents.FindByPredicate([EventId](const FRfsnWitnessEvent& Event) { return Event.EventId == EventId; });
+	const int32* Column = EventColumns.Find(EventId);
+	return Column ? GetColumnEvent(*Column) : nullptr;
 }
 
 const FRfsnWitnessEvent* URfsnWitnessSystem::FindEvent(const FGuid& EventId) const
 {
-	return AllEvents.FindByPredicate([EventId](const FRfsnWitnessEvent& Event) { return Event.EventId == EventId; });
+	const int32* Column = EventColumns.Find(EventId);
+	return Column ? GetColumnEvent(*Column) : nullptr;
 }
 
 float URfsnWitnessSystem::CalculateOpinion(const FString& NpcFaction, const FRfsnWitnessEvent& Event) const
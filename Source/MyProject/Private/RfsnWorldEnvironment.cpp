@@ -0,0 +1,493 @@
+// RFSN World Environment Implementation
+
+#include "RfsnWorldEnvironment.h"
+#include "RfsnGameClock.h"
+#include "RfsnLogging.h"
+#include "Engine/World.h"
+
+// ─────────────────────────────────────────────────────────────
+// FRfsnWeatherArchetype
+// ─────────────────────────────────────────────────────────────
+
+FRfsnWeatherArchetype FRfsnWeatherArchetype::FromPreferences(const TArray<FRfsnWeatherPreference>& InPreferences)
+{
+	FRfsnWeatherArchetype Archetype;
+	bool bHasPreference[RfsnWeather::NumTypes] = {};
+
+	for (const FRfsnWeatherPreference& Pref : InPreferences)
+	{
+		const int32 Weather = static_cast<int32>(Pref.Weather);
+		if (Weather >= RfsnWeather::NumTypes)
+		{
+			continue;
+		}
+
+		if (!bHasPreference[Weather])
+		{
+			Archetype.Preferences[Weather] = Pref.Preference;
+			bHasPreference[Weather] = true;
+		}
+		if (Archetype.Comments[Weather].IsEmpty())
+		{
+			Archetype.Comments[Weather] = Pref.Comment;
+		}
+	}
+	return Archetype;
+}
+
+bool FRfsnWeatherArchetype::operator==(const FRfsnWeatherArchetype& Other) const
+{
+	for (int32 Weather = 0; Weather < RfsnWeather::NumTypes; Weather++)
+	{
+		if (Preferences[Weather] != Other.Preferences[Weather] || Comments[Weather] != Other.Comments[Weather])
+		{
+			return false;
+		}
+	}
+	return true;
+}
+
+uint32 GetTypeHash(const FRfsnWeatherArchetype& Archetype)
+{
+	uint32 Hash = 0;
+	for (int32 Weather = 0; Weather < RfsnWeather::NumTypes; Weather++)
+	{
+		Hash = HashCombine(Hash, GetTypeHash(Archetype.Preferences[Weather]));
+		Hash = HashCombine(Hash, GetTypeHash(Archetype.Comments[Weather]));
+	}
+	return Hash;
+}
+
+// ─────────────────────────────────────────────────────────────
+// FRfsnWeatherReactionBatch
+// ─────────────────────────────────────────────────────────────
+
+int32 FRfsnWeatherReactionBatch::FindOrAddArchetype(const FRfsnWeatherArchetype& Archetype)
+{
+	const uint32 Hash = GetTypeHash(Archetype);
+	TArray<int32>& Candidates = ArchetypesByHash.FindOrAdd(Hash);
+	for (const int32 Candidate : Candidates)
+	{
+		if (Archetypes[Candidate] == Archetype)
+		{
+			return Candidate;
+		}
+	}
+
+	// Archetypes are never dropped: NPCs are configured from a handful of presets
+	check(Archetypes.Num() < MAX_uint16);
+	const int32 Index = Archetypes.Add(Archetype);
+	Candidates.Add(Index);
+	Results.AddUninitialized(RfsnWeather::NumFlagSets);
+	EvaluateArchetype(Index);
+	return Index;
+}
+
+uint8 FRfsnWeatherReactionBatch::MakeFlags(bool bIsIndoors, bool bSeeksShelter)
+{
+	return (bIsIndoors ? RfsnWeather::FlagIndoors : 0) | (bSeeksShelter ? RfsnWeather::FlagSeeksShelter : 0);
+}
+
+int32 FRfsnWeatherReactionBatch::Add(int32 Archetype, bool bIsIndoors, bool bSeeksShelter)
+{
+	int32 Npc;
+	if (FreeSlots.Num() > 0)
+	{
+		Npc = FreeSlots.Pop(EAllowShrinking::No);
+		Active[Npc] = true;
+	}
+	else
+	{
+		Npc = Active.Add(true);
+		NpcArchetypes.AddUninitialized();
+		NpcFlags.AddUninitialized();
+		NpcResults.AddUninitialized();
+	}
+
+	NpcArchetypes[Npc] = static_cast<uint16>(Archetype);
+	NpcFlags[Npc] = MakeFlags(bIsIndoors, bSeeksShelter);
+	NpcResults[Npc] = Results[Archetype * RfsnWeather::NumFlagSets + NpcFlags[Npc]];
+	return Npc;
+}
+
+void FRfsnWeatherReactionBatch::Remove(int32 Npc)
+{
+	if (IsValid(Npc))
+	{
+		Active[Npc] = false;
+		FreeSlots.Add(Npc);
+	}
+}
+
+bool FRfsnWeatherReactionBatch::Update(int32 Npc, int32 Archetype, bool bIsIndoors, bool bSeeksShelter)
+{
+	if (!IsValid(Npc))
+	{
+		return false;
+	}
+
+	NpcArchetypes[Npc] = static_cast<uint16>(Archetype);
+	NpcFlags[Npc] = MakeFlags(bIsIndoors, bSeeksShelter);
+
+	const uint8 Result = Results[Archetype * RfsnWeather::NumFlagSets + NpcFlags[Npc]];
+	const bool bChanged = Result != NpcResults[Npc];
+	NpcResults[Npc] = Result;
+	return bChanged;
+}
+
+void FRfsnWeatherReactionBatch::EvaluateArchetype(int32 Archetype)
+{
+	const float Feeling = Archetypes[Archetype].Preferences[static_cast<int32>(Weather)];
+	for (uint8 Flags = 0; Flags < RfsnWeather::NumFlagSets; Flags++)
+	{
+		bool bShelter = false;
+		const ERfsnWeatherReaction Reaction = React(Weather, Feeling, (Flags & RfsnWeather::FlagIndoors) != 0,
+		                                            (Flags & RfsnWeather::FlagSeeksShelter) != 0, bShelter);
+		Results[Archetype * RfsnWeather::NumFlagSets + Flags] =
+		    static_cast<uint8>(Reaction) | (bShelter ? ShelterBit : 0);
+	}
+}
+
+void FRfsnWeatherReactionBatch::Evaluate(ERfsnWeatherType NewWeather, TArray<int32>& OutChanged)
+{
+	Weather = NewWeather;
+	for (int32 Archetype = 0; Archetype < Archetypes.Num(); Archetype++)
+	{
+		EvaluateArchetype(Archetype);
+	}
+
+	// Every NPC is a table read; only the ones whose result moved are reported
+	const uint8* Table = Results.GetData();
+	for (TConstSetBitIterator<> It(Active); It; ++It)
+	{
+		const int32 Npc = It.GetIndex();
+		const uint8 Result = Table[NpcArchetypes[Npc] * RfsnWeather::NumFlagSets + NpcFlags[Npc]];
+		if (Result != NpcResults[Npc])
+		{
+			NpcResults[Npc] = Result;
+			OutChanged.Add(Npc);
+		}
+	}
+}
+
+ERfsnWeatherReaction FRfsnWeatherReactionBatch::React(ERfsnWeatherType InWeather, float Feeling, bool bIsIndoors,
+                                                      bool bSeeksShelter, bool& bOutShouldSeekShelter)
+{
+	// Determine reaction based on feeling and weather severity
+	if (InWeather == ERfsnWeatherType::Storm && !bIsIndoors)
+	{
+		bOutShouldSeekShelter = true;
+		return ERfsnWeatherReaction::SeekShelter;
+	}
+	if (InWeather == ERfsnWeatherType::Rain && !bIsIndoors && bSeeksShelter)
+	{
+		bOutShouldSeekShelter = true;
+		return ERfsnWeatherReaction::SeekShelter;
+	}
+	if (Feeling < -0.5f)
+	{
+		bOutShouldSeekShelter = bSeeksShelter && !bIsIndoors;
+		return ERfsnWeatherReaction::Uncomfortable;
+	}
+
+	bOutShouldSeekShelter = false;
+	if (Feeling < -0.2f)
+	{
+		return ERfsnWeatherReaction::Worried;
+	}
+	if (Feeling > 0.3f)
+	{
+		return ERfsnWeatherReaction::Enjoying;
+	}
+	return ERfsnWeatherReaction::Neutral;
+}
+
+namespace RfsnWeather
+{
+/** Period boundaries in hours: [0,3) Midnight, [3,5) Night, ... [21,24) Night */
+constexpr int32 NumPeriods = 8;
+constexpr float PeriodEnds[NumPeriods] = {3.0f, 5.0f, 7.0f, 12.0f, 14.0f, 18.0f, 21.0f, 24.0f};
+constexpr ERfsnTimeOfDay Periods[NumPeriods] = {
+    ERfsnTimeOfDay::Midnight, ERfsnTimeOfDay::Night,     ERfsnTimeOfDay::Dawn,    ERfsnTimeOfDay::Morning,
+    ERfsnTimeOfDay::Noon,     ERfsnTimeOfDay::Afternoon, ERfsnTimeOfDay::Evening, ERfsnTimeOfDay::Night};
+
+int32 FindPeriod(float Hour)
+{
+	for (int32 Period = 0; Period < NumPeriods - 1; Period++)
+	{
+		if (Hour < PeriodEnds[Period])
+		{
+			return Period;
+		}
+	}
+	return NumPeriods - 1;
+}
+} // namespace RfsnWeather
+
+ERfsnTimeOfDay FRfsnWeatherReactionBatch::GetTimeOfDay(float Hour)
+{
+	return RfsnWeather::Periods[RfsnWeather::FindPeriod(Hour)];
+}
+
+float FRfsnWeatherReactionBatch::GetPeriodEndHour(float Hour)
+{
+	return RfsnWeather::PeriodEnds[RfsnWeather::FindPeriod(Hour)];
+}
+
+// ─────────────────────────────────────────────────────────────
+// URfsnWorldEnvironment
+// ─────────────────────────────────────────────────────────────
+
+void URfsnWorldEnvironment::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	// The clock is another world subsystem: ask for it so it exists before OnWorldBeginPlay
+	Collection.InitializeDependency<URfsnGameClock>();
+	TimeOfDay = FRfsnWeatherReactionBatch::GetTimeOfDay(LocalHour);
+}
+
+void URfsnWorldEnvironment::OnWorldBeginPlay(UWorld& InWorld)
+{
+	Super::OnWorldBeginPlay(InWorld);
+
+	Clock = InWorld.GetSubsystem<URfsnGameClock>();
+	if (URfsnGameClock* GameClock = Clock.Get())
+	{
+		GameClock->OnTimeJumped.AddDynamic(this, &URfsnWorldEnvironment::HandleClockJumped);
+	}
+	HandlePeriodEnd();
+}
+
+void URfsnWorldEnvironment::Deinitialize()
+{
+	if (URfsnGameClock* GameClock = Clock.Get())
+	{
+		GameClock->CancelTimer(PeriodTimer);
+		GameClock->OnTimeJumped.RemoveDynamic(this, &URfsnWorldEnvironment::HandleClockJumped);
+	}
+	PeriodTimer = INDEX_NONE;
+	Clock.Reset();
+
+	Components.Empty();
+	Batch = FRfsnWeatherReactionBatch();
+	Super::Deinitialize();
+}
+
+int32 URfsnWorldEnvironment::ReadArchetype(const URfsnWeatherReactions* Reactions)
+{
+	return Batch.FindOrAddArchetype(FRfsnWeatherArchetype::FromPreferences(Reactions->Preferences));
+}
+
+int32 URfsnWorldEnvironment::Register(URfsnWeatherReactions* Reactions)
+{
+	if (!Reactions)
+	{
+		return INDEX_NONE;
+	}
+
+	const int32 Slot = Batch.Add(ReadArchetype(Reactions), Reactions->bIsIndoors, Reactions->bSeeksShelter);
+	if (Slot >= Components.Num())
+	{
+		Components.SetNum(Slot + 1);
+	}
+	Components[Slot] = Reactions;
+
+	Reactions->HandleWeatherChanged(Batch.GetWeather());
+	Reactions->HandleTimeChanged(GetGameHour(), TimeOfDay);
+	Reactions->HandleReaction(Batch.GetReaction(Slot), Batch.GetShouldSeekShelter(Slot));
+	return Slot;
+}
+
+void URfsnWorldEnvironment::Unregister(int32 Slot)
+{
+	if (Batch.IsValid(Slot))
+	{
+		Batch.Remove(Slot);
+		Components[Slot].Reset();
+	}
+}
+
+void URfsnWorldEnvironment::UpdateNpc(int32 Slot)
+{
+	if (!Batch.IsValid(Slot))
+	{
+		return;
+	}
+
+	if (URfsnWeatherReactions* Reactions = Components[Slot].Get())
+	{
+		if (Batch.Update(Slot, ReadArchetype(Reactions), Reactions->bIsIndoors, Reactions->bSeeksShelter))
+		{
+			Reactions->HandleReaction(Batch.GetReaction(Slot), Batch.GetShouldSeekShelter(Slot));
+		}
+	}
+}
+
+float URfsnWorldEnvironment::GetPreference(int32 Slot, ERfsnWeatherType Weather) const
+{
+	return Batch.IsValid(Slot) ? Batch.GetArchetype(Batch.GetArchetypeOf(Slot)).Preferences[static_cast<int32>(Weather)]
+	                           : 0.0f;
+}
+
+const FString& URfsnWorldEnvironment::GetComment(int32 Slot, ERfsnWeatherType Weather) const
+{
+	static const FString Empty;
+	return Batch.IsValid(Slot) ? Batch.GetArchetype(Batch.GetArchetypeOf(Slot)).Comments[static_cast<int32>(Weather)]
+	                           : Empty;
+}
+
+void URfsnWorldEnvironment::SetWeather(ERfsnWeatherType NewWeather)
+{
+	const ERfsnWeatherType OldWeather = Batch.GetWeather();
+	if (NewWeather == OldWeather)
+	{
+		return;
+	}
+
+	Changed.Reset();
+	Batch.Evaluate(NewWeather, Changed);
+
+	RFSN_LOG(TEXT("Weather changed: %s -> %s (%d of %d NPCs react differently)"),
+	         *URfsnWeatherReactions::WeatherToString(OldWeather), *URfsnWeatherReactions::WeatherToString(NewWeather),
+	         Changed.Num(), Batch.Num());
+
+	OnWeatherChanged.Broadcast(NewWeather, OldWeather);
+
+	for (int32 Slot = 0; Slot < Components.Num(); Slot++)
+	{
+		if (URfsnWeatherReactions* Reactions = Components[Slot].Get())
+		{
+			Reactions->HandleWeatherChanged(NewWeather);
+		}
+	}
+
+	for (const int32 Slot : Changed)
+	{
+		if (URfsnWeatherReactions* Reactions = Components[Slot].Get())
+		{
+			Reactions->HandleReaction(Batch.GetReaction(Slot), Batch.GetShouldSeekShelter(Slot));
+		}
+	}
+}
+
+float URfsnWorldEnvironment::GetGameHour() const
+{
+	const URfsnGameClock* GameClock = Clock.Get();
+	return GameClock ? GameClock->GetGameHour() : LocalHour;
+}
+
+void URfsnWorldEnvironment::SetGameTime(float Hour)
+{
+	Hour = FMath::Fmod(Hour, 24.0f);
+	if (Hour < 0)
+	{
+		Hour += 24.0f;
+	}
+
+	// The clock's timers (ours included) fire on a forward jump, and a backward jump calls HandleClockJumped
+	if (URfsnGameClock* GameClock = Clock.Get())
+	{
+		GameClock->SetGameTime(GameClock->GetDay(), Hour);
+		return;
+	}
+
+	LocalHour = Hour;
+	UpdateTimeOfDay();
+}
+
+void URfsnWorldEnvironment::AdvanceToHour(float Hour)
+{
+	Hour = FMath::Fmod(Hour, 24.0f);
+	if (Hour < 0)
+	{
+		Hour += 24.0f;
+	}
+
+	if (URfsnGameClock* GameClock = Clock.Get())
+	{
+		// How far the clock is past Hour, wrapped so a driver still at 23:55 after midnight counts as just behind
+		const float Now = GameClock->GetGameHour();
+		float Behind = Now - Hour;
+		if (Behind < 0)
+		{
+			Behind += 24.0f;
+		}
+
+		if (Behind <= RfsnWeather::AdvanceLagHours)
+		{
+			return;
+		}
+		if (Hour > Now)
+		{
+			GameClock->SetGameTime(GameClock->GetDay(), Hour);
+			return;
+		}
+
+		RFSN_WARNING(TEXT("AdvanceToHour(%.2f): the clock is already at %.2f; not skipping to the next day"), Hour,
+		             Now);
+		return;
+	}
+
+	// Without a clock there are no days or timers to skip, so the hour can simply be set
+	LocalHour = Hour;
+	UpdateTimeOfDay();
+}
+
+void URfsnWorldEnvironment::UpdateTimeOfDay()
+{
+	const float Hour = GetGameHour();
+	const ERfsnTimeOfDay NewTime = FRfsnWeatherReactionBatch::GetTimeOfDay(Hour);
+	const ERfsnTimeOfDay OldTime = TimeOfDay;
+	TimeOfDay = NewTime;
+
+	// Reactions don't depend on the hour; components only need the new period (and the hour for context)
+	for (const TWeakObjectPtr<URfsnWeatherReactions>& Component : Components)
+	{
+		if (URfsnWeatherReactions* Reactions = Component.Get())
+		{
+			Reactions->HandleTimeChanged(Hour, NewTime);
+		}
+	}
+
+	if (NewTime != OldTime)
+	{
+		RFSN_LOG(TEXT("Time of day changed: %s -> %s"), *URfsnWeatherReactions::TimeOfDayToString(OldTime),
+		         *URfsnWeatherReactions::TimeOfDayToString(NewTime));
+		OnTimeOfDayChanged.Broadcast(NewTime, OldTime);
+	}
+}
+
+void URfsnWorldEnvironment::SchedulePeriodEnd()
+{
+	URfsnGameClock* GameClock = Clock.Get();
+	if (!GameClock)
+	{
+		return;
+	}
+
+	GameClock->CancelTimer(PeriodTimer);
+	const double Minutes = GameClock->GetGameMinutes();
+	const double MinutesPerDay = URfsnGameClock::MinutesPerDay;
+	const double DayStart = FMath::FloorToDouble(Minutes / MinutesPerDay) * MinutesPerDay;
+	const double Next = DayStart + FRfsnWeatherReactionBatch::GetPeriodEndHour(GameClock->GetGameHour()) * 60.0;
+	PeriodTimer = GameClock->ScheduleAt(
+	    Next, FRfsnGameClockCallback::CreateUObject(this, &URfsnWorldEnvironment::HandlePeriodEnd));
+}
+
+void URfsnWorldEnvironment::HandlePeriodEnd()
+{
+	PeriodTimer = INDEX_NONE;
+	UpdateTimeOfDay();
+	SchedulePeriodEnd();
+}
+
+void URfsnWorldEnvironment::HandleClockJumped()
+{
+	// The pending timer survives a rewind but now points at the wrong boundary
+	if (URfsnGameClock* GameClock = Clock.Get())
+	{
+		GameClock->CancelTimer(PeriodTimer);
+	}
+	HandlePeriodEnd();
+}
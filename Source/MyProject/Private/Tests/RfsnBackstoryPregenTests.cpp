@@ -0,0 +1,187 @@
+// RFSN Backstory Pregeneration Tests
+// The level-load pregeneration pass against a mock backend with fixed latency
+
+#include "RfsnBackstoryGenerator.h"
+#include "RfsnBackstoryPregenerator.h"
+#include "RfsnTestWorld.h"
+#include "HAL/PlatformProcess.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace RfsnBackstoryPregenTests
+{
+/** Every field the generator parses, as /api/backstory/generate returns them */
+const TCHAR ResponseFormat[] =
+    TEXT("{\"npc_id\":\"%s\",\"summary\":\"Washed ashore years ago and never left.\",\"occupation\":\"Fisher\",")
+    TEXT("\"faction_history\":\"Joined the survivors\",\"personal_goal\":\"Leave the island\",")
+    TEXT("\"fear\":\"The tower lights going dark\",\"secret\":\"Hid supplies\",\"trait\":\"cautious\",")
+    TEXT("\"version\":1}");
+
+/** Answers every request Latency seconds after it was sent, or never when Latency is negative */
+struct FMockBackend
+{
+	double Latency = 0.1;
+	TArray<TPair<TWeakObjectPtr<URfsnBackstoryGenerator>, double>> Pending;
+	TArray<FString> RequestOrder;
+	int32 MaxOutstanding = 0;
+
+	void Bind(URfsnBackstoryGenerator& Generator)
+	{
+		Generator.bLoadOnBeginPlay = false;
+		Generator.bSaveAfterGeneration = false;
+		Generator.RequestHandler.BindLambda(
+		    [this](URfsnBackstoryGenerator* Sender, const FString& JsonPayload)
+		    {
+			    RequestOrder.Add(Sender->GetOwner()->GetName());
+			    Pending.Emplace(Sender, FPlatformTime::Seconds() + Latency);
+			    MaxOutstanding = FMath::Max(MaxOutstanding, Pending.Num());
+		    });
+	}
+
+	void AnswerDue()
+	{
+		const double Now = FPlatformTime::Seconds();
+		for (int32 i = 0; i < Pending.Num(); i++)
+		{
+			if (Latency < 0.0 || Pending[i].Value > Now)
+			{
+				continue;
+			}
+			URfsnBackstoryGenerator* Generator = Pending[i].Key.Get();
+			Pending.RemoveAt(i--);
+			if (Generator)
+			{
+				// Completing starts the next request, which lands at the end of Pending
+				Generator->CompleteRequest(true, FString::Printf(ResponseFormat, *Generator->GetOwner()->GetName()));
+			}
+		}
+	}
+};
+} // namespace RfsnBackstoryPregenTests
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRfsnBackstoryPregenLatencyTest, "Rfsn.Backstory.PregenLatency",
+                                 EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext |
+                                     EAutomationTestFlags::ProductFilter)
+
+bool FRfsnBackstoryPregenLatencyTest::RunTest(const FString& Parameters)
+{
+	using namespace RfsnBackstoryPregenTests;
+
+	FRfsnTestWorld TestWorld;
+	URfsnBackstoryPregenerator* Pregenerator = TestWorld.GetSubsystem<URfsnBackstoryPregenerator>();
+	if (!TestNotNull(TEXT("Pregenerator"), Pregenerator))
+	{
+		return false;
+	}
+	Pregenerator->bPregenerateOnLevelLoad = false;
+	Pregenerator->MaxConcurrentRequests = 4;
+
+	// Twelve NPCs spawned out of distance order; with no player or start, distance is from the origin
+	constexpr int32 NpcCount = 12;
+	FMockBackend Backend;
+	TArray<URfsnBackstoryGenerator*> Generators;
+	TArray<FString> NearestFirst;
+	NearestFirst.SetNum(NpcCount);
+	for (int32 i = 0; i < NpcCount; i++)
+	{
+		const int32 Rank = (i * 5) % NpcCount;
+		AActor* Npc = TestWorld.SpawnActor(FVector(500.0f * (Rank + 1), 0.0f, 0.0f));
+		NearestFirst[Rank] = Npc->GetName();
+		Generators.Add(TestWorld.AddComponent<URfsnBackstoryGenerator>(
+		    Npc, [&Backend](URfsnBackstoryGenerator& Generator) { Backend.Bind(Generator); }));
+	}
+	TestWorld.BeginPlay();
+
+	// Overlap is counted at the backend rather than timed: whenever NPCs are still waiting for a request, every
+	// slot must be in use
+	const double Start = FPlatformTime::Seconds();
+	Pregenerator->StartPregeneration();
+	int32 IdleSlotRounds = 0;
+	while (Pregenerator->IsPregenerating() && FPlatformTime::Seconds() - Start < 10.0)
+	{
+		if (Backend.RequestOrder.Num() < NpcCount && Backend.Pending.Num() < Pregenerator->MaxConcurrentRequests)
+		{
+			IdleSlotRounds++;
+		}
+		FPlatformProcess::Sleep(0.002f);
+		Backend.AnswerDue();
+	}
+
+	const FRfsnBackstoryPregenStats Stats = Pregenerator->GetStats();
+	TestFalse(TEXT("Pass still running"), Pregenerator->IsPregenerating());
+	TestEqual(TEXT("Queued"), Stats.Queued, NpcCount);
+	TestEqual(TEXT("Completed"), Stats.Completed, NpcCount);
+	TestEqual(TEXT("Failed"), Stats.Failed, 0);
+	TestEqual(TEXT("Requests in flight at most"), Backend.MaxOutstanding, Pregenerator->MaxConcurrentRequests);
+	TestEqual(TEXT("Nearest NPCs requested first"), Backend.RequestOrder, NearestFirst);
+	for (const URfsnBackstoryGenerator* Generator : Generators)
+	{
+		TestTrue(TEXT("Backstory cached"), Generator->HasBackstory());
+	}
+
+	TestEqual(TEXT("Checks with a free slot while NPCs waited"), IdleSlotRounds, 0);
+	TestTrue(TEXT("Average latency covers the backend's"), Stats.AverageLatencyMs >= Backend.Latency * 1000.0 * 0.9);
+	AddInfo(FString::Printf(TEXT("%d NPCs in %.2f s (sequential %.2f s), average latency %.0f ms"), NpcCount,
+	                        Stats.TotalSeconds, NpcCount * Backend.Latency, Stats.AverageLatencyMs));
+
+	// Talking to a pregenerated NPC uses the cached backstory without asking the backend again
+	const int32 PassRequests = Backend.RequestOrder.Num();
+	for (URfsnBackstoryGenerator* Generator : Generators)
+	{
+		Generator->OnFirstInteraction();
+		TestFalse(TEXT("Generating on first interaction"), Generator->IsGenerating());
+		TestFalse(TEXT("Dialogue context"), Generator->GetShortContext().IsEmpty());
+	}
+	TestEqual(TEXT("Backend requests on first interaction"), Backend.RequestOrder.Num() - PassRequests, 0);
+	TestEqual(TEXT("Requests left pending"), Backend.Pending.Num(), 0);
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRfsnBackstoryPregenDestroyedTest, "Rfsn.Backstory.PregenDestroyedNpcs",
+                                 EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext |
+                                     EAutomationTestFlags::ProductFilter)
+
+bool FRfsnBackstoryPregenDestroyedTest::RunTest(const FString& Parameters)
+{
+	using namespace RfsnBackstoryPregenTests;
+
+	FRfsnTestWorld TestWorld;
+	URfsnBackstoryPregenerator* Pregenerator = TestWorld.GetSubsystem<URfsnBackstoryPregenerator>();
+	if (!TestNotNull(TEXT("Pregenerator"), Pregenerator))
+	{
+		return false;
+	}
+	Pregenerator->bPregenerateOnLevelLoad = false;
+	Pregenerator->MaxConcurrentRequests = 2;
+
+	// A backend that never answers, and every NPC in flight streamed out before it could
+	FMockBackend Backend;
+	Backend.Latency = -1.0;
+	TArray<AActor*> Npcs;
+	for (int32 i = 0; i < 2; i++)
+	{
+		Npcs.Add(TestWorld.SpawnActor(FVector(100.0f * (i + 1), 0.0f, 0.0f)));
+		TestWorld.AddComponent<URfsnBackstoryGenerator>(
+		    Npcs.Last(), [&Backend](URfsnBackstoryGenerator& Generator) { Backend.Bind(Generator); });
+	}
+	TestWorld.BeginPlay();
+
+	Pregenerator->StartPregeneration();
+	TestEqual(TEXT("Requests sent"), Backend.RequestOrder.Num(), 2);
+	for (AActor* Npc : Npcs)
+	{
+		Npc->Destroy();
+	}
+
+	for (int32 Frame = 0; Frame < 30 && Pregenerator->IsPregenerating(); Frame++)
+	{
+		TestWorld.Tick(0.1f);
+	}
+	TestFalse(TEXT("Pass still running"), Pregenerator->IsPregenerating());
+	TestEqual(TEXT("Skipped"), Pregenerator->GetStats().Skipped, 2);
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
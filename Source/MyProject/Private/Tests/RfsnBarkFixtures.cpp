@@ -0,0 +1,45 @@
+// RFSN Bark Fixtures Implementation
+
+#include "RfsnBarkFixtures.h"
+
+namespace RfsnBench
+{
+SIZE_T GetBarksSize(const TArray<FRfsnBark>& Barks)
+{
+	SIZE_T Size = Barks.GetAllocatedSize();
+	for (const FRfsnBark& Bark : Barks)
+	{
+		Size += Bark.Text.GetAllocatedSize() + Bark.CustomTag.GetAllocatedSize();
+	}
+	return Size;
+}
+
+SIZE_T GetLibrarySize(const FRfsnBarkLibrary& Library)
+{
+	SIZE_T Size = sizeof(FRfsnBarkLibrary);
+	for (int32 i = 0; i < FRfsnInstantBarkSet::NumCategories; i++)
+	{
+		const TArray<FRfsnInstantBarkEntry>& Bucket =
+		    FRfsnBarkLibraryRegistry::GetLibraryBucket(Library, static_cast<ERfsnBarkCategory>(i));
+		Size += Bucket.GetAllocatedSize();
+		for (const FRfsnInstantBarkEntry& Entry : Bucket)
+		{
+			Size += Entry.Text.GetAllocatedSize();
+		}
+	}
+	return Size;
+}
+
+TArray<ERfsnBarkTrigger> GetPopulatedTriggers(const FRfsnNpcBarkSet& Set)
+{
+	TArray<ERfsnBarkTrigger> Triggers;
+	for (int32 t = 0; t < FRfsnNpcBarkSet::NumTriggers; t++)
+	{
+		if (Set.GetBucketSize(static_cast<ERfsnBarkTrigger>(t)) > 0)
+		{
+			Triggers.Add(static_cast<ERfsnBarkTrigger>(t));
+		}
+	}
+	return Triggers;
+}
+} // namespace RfsnBench
@@ -0,0 +1,69 @@
+// RFSN Bark Fixtures
+// The per-NPC bark copies and linear selection that the shared bark libraries replaced
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "RfsnBarkLibrary.h"
+#include "RfsnNpcBarks.h"
+
+namespace RfsnBench
+{
+/** Selections simulated per NPC */
+constexpr int32 SelectionsPerNpc = 200;
+
+/** Simulated seconds between selections */
+constexpr float SelectionInterval = 1.0f;
+
+SIZE_T GetBarksSize(const TArray<FRfsnBark>& Barks);
+
+SIZE_T GetLibrarySize(const FRfsnBarkLibrary& Library);
+
+/** Previous per-NPC layout: owned copies plus a last-used time per bark */
+struct FLegacyNpcBarks
+{
+	FRfsnBarkLibrary InstantBarks;
+	TArray<FRfsnBark> Barks;
+	TArray<float> LastUsedTime;
+
+	/** Linear scan + cumulative priority roll, as URfsnNpcBarks::SelectBark did */
+	int32 Select(ERfsnBarkTrigger Trigger, float Now)
+	{
+		TArray<int32, TInlineAllocator<16>> Available;
+		for (int32 i = 0; i < Barks.Num(); i++)
+		{
+			if (Barks[i].Trigger == Trigger && Now - LastUsedTime[i] >= Barks[i].Cooldown)
+			{
+				Available.Add(i);
+			}
+		}
+
+		if (Available.Num() == 0)
+		{
+			return INDEX_NONE;
+		}
+
+		int32 TotalPriority = 0;
+		for (const int32 Index : Available)
+		{
+			TotalPriority += Barks[Index].Priority;
+		}
+
+		const int32 Roll = FMath::RandRange(1, FMath::Max(1, TotalPriority));
+		int32 Cumulative = 0;
+		for (const int32 Index : Available)
+		{
+			Cumulative += Barks[Index].Priority;
+			if (Roll <= Cumulative)
+			{
+				return Index;
+			}
+		}
+
+		return Available.Last();
+	}
+};
+
+/** Triggers that have content in the default library */
+TArray<ERfsnBarkTrigger> GetPopulatedTriggers(const FRfsnNpcBarkSet& Set);
+} // namespace RfsnBench
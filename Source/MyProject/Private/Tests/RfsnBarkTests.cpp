@@ -0,0 +1,168 @@
+// RFSN Bark Tests
+// Shared bark sets with bucketed cooldowns against the per-NPC scan they replaced
+
+#include "RfsnBarkFixtures.h"
+#include "RfsnBarkLibrary.h"
+#include "RfsnNpcBarks.h"
+#include "RfsnTestWorld.h"
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRfsnBarkCooldownTest, "Rfsn.Barks.CooldownsMatchScan",
+                                 EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext |
+                                     EAutomationTestFlags::ProductFilter)
+
+bool FRfsnBarkCooldownTest::RunTest(const FString& Parameters)
+{
+	using namespace RfsnBench;
+
+	// The old model over the same content, listed in the set's index order
+	const FRfsnNpcBarkSetRef Set = FRfsnBarkLibraryRegistry::AcquireNpcBarks(TArray<FRfsnBark>());
+	FLegacyNpcBarks Legacy;
+	Set->ToBarks(Legacy.Barks);
+	Legacy.LastUsedTime.Init(-1000.0f, Legacy.Barks.Num());
+	FRfsnBarkCooldownState Shared;
+
+	const TArray<ERfsnBarkTrigger> Triggers = GetPopulatedTriggers(*Set);
+	FRandomStream Stream(1234);
+	int32 Picks = 0;
+	int32 OutsideAvailable = 0;
+	int32 AvailabilityErrors = 0;
+	int32 NoneErrors = 0;
+	for (int32 Step = 0; Step < SelectionsPerNpc; Step++)
+	{
+		const float Now = Step * SelectionInterval;
+		const ERfsnBarkTrigger Trigger = Triggers[Stream.RandRange(0, Triggers.Num() - 1)];
+
+		// Every bark is off cooldown exactly when the old per-bark timestamps say so
+		bool bAnyAvailable = false;
+		for (int32 i = 0; i < Legacy.Barks.Num(); i++)
+		{
+			const bool bLegacyAvailable = Now - Legacy.LastUsedTime[i] >= Legacy.Barks[i].Cooldown;
+			AvailabilityErrors += Shared.IsAvailable(*Set, i, Now) == bLegacyAvailable ? 0 : 1;
+			bAnyAvailable |= bLegacyAvailable && Legacy.Barks[i].Trigger == Trigger;
+		}
+
+		// The pick comes from the barks the old scan would have rolled over, and both start the same cooldown
+		const int32 Index = Shared.Pick(*Set, Trigger, Now);
+		if (Index == INDEX_NONE)
+		{
+			NoneErrors += bAnyAvailable ? 1 : 0;
+			continue;
+		}
+		Picks++;
+		OutsideAvailable += Legacy.Barks[Index].Trigger == Trigger &&
+		                            Now - Legacy.LastUsedTime[Index] >= Legacy.Barks[Index].Cooldown
+		                        ? 0
+		                        : 1;
+		Shared.MarkUsed(*Set, Index, Now);
+		Legacy.LastUsedTime[Index] = Now;
+	}
+
+	TestTrue(TEXT("Barks picked"), Picks > 0);
+	TestEqual(TEXT("Picks the old scan could not have made"), OutsideAvailable, 0);
+	TestEqual(TEXT("Nothing picked while barks were available"), NoneErrors, 0);
+	TestEqual(TEXT("Availability differing from the old timestamps"), AvailabilityErrors, 0);
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRfsnBarkPriorityTest, "Rfsn.Barks.PriorityWeighting",
+                                 EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext |
+                                     EAutomationTestFlags::ProductFilter)
+
+bool FRfsnBarkPriorityTest::RunTest(const FString& Parameters)
+{
+	using namespace RfsnBench;
+
+	// One bucket without cooldowns, so every pick rolls over the same barks
+	TArray<FRfsnBark> Authored;
+	const int32 Priorities[] = {1, 3, 6};
+	for (const int32 Priority : Priorities)
+	{
+		FRfsnBark& Bark = Authored.AddDefaulted_GetRef();
+		Bark.Trigger = ERfsnBarkTrigger::Greeting;
+		Bark.Text = FString::Printf(TEXT("Priority %d"), Priority);
+		Bark.Priority = Priority;
+		Bark.Cooldown = 0.0f;
+	}
+	const FRfsnNpcBarkSetRef Set = FRfsnBarkLibraryRegistry::AcquireNpcBarks(Authored);
+	FLegacyNpcBarks Legacy;
+	Set->ToBarks(Legacy.Barks);
+	Legacy.LastUsedTime.Init(-1000.0f, Legacy.Barks.Num());
+	FRfsnBarkCooldownState Shared;
+
+	constexpr int32 Rolls = 30000;
+	int32 SharedCounts[3] = {};
+	int32 LegacyCounts[3] = {};
+	for (int32 i = 0; i < Rolls; i++)
+	{
+		const int32 Index = Shared.Pick(*Set, ERfsnBarkTrigger::Greeting, 0.0f);
+		SharedCounts[FMath::Clamp(Index, 0, 2)]++;
+		LegacyCounts[FMath::Clamp(Legacy.Select(ERfsnBarkTrigger::Greeting, 0.0f), 0, 2)]++;
+	}
+
+	// Both pick each bark in proportion to its priority
+	for (int32 i = 0; i < 3; i++)
+	{
+		const float Expected = Legacy.Barks[i].Priority / 10.0f;
+		TestEqual(FString::Printf(TEXT("Share of %s"), *Legacy.Barks[i].Text),
+		          SharedCounts[i] / static_cast<float>(Rolls), Expected, 0.02f);
+		TestEqual(FString::Printf(TEXT("Old share of %s"), *Legacy.Barks[i].Text),
+		          LegacyCounts[i] / static_cast<float>(Rolls), Expected, 0.02f);
+	}
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRfsnBarkComponentTest, "Rfsn.Barks.Component",
+                                 EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext |
+                                     EAutomationTestFlags::ProductFilter)
+
+bool FRfsnBarkComponentTest::RunTest(const FString& Parameters)
+{
+	FRfsnTestWorld TestWorld;
+	AActor* Npc = TestWorld.SpawnActor(FVector::ZeroVector);
+	URfsnNpcBarks* Barks = TestWorld.AddComponent<URfsnNpcBarks>(Npc);
+	TestWorld.BeginPlay();
+
+	// The shared defaults are not copied into the NPC; GetActiveBarks lists them
+	const TArray<FRfsnBark>& Defaults = FRfsnBarkLibraryRegistry::GetDefaultNpcBarks();
+	TestEqual(TEXT("Barks left empty"), Barks->Barks.Num(), 0);
+	TestEqual(TEXT("Active barks"), Barks->GetActiveBarks().Num(), Defaults.Num());
+	TestEqual(TEXT("Shared barks"), Barks->GetBarkSet()->Num(), Defaults.Num());
+
+	// A forced bark plays one of the trigger's lines, and each line then cools down until none is left
+	TSet<FString> Greetings;
+	for (const FRfsnBark& Bark : Defaults)
+	{
+		if (Bark.Trigger == ERfsnBarkTrigger::Greeting)
+		{
+			Greetings.Add(Bark.Text);
+		}
+	}
+	TSet<FString> Played;
+	while (Barks->TryBark(ERfsnBarkTrigger::Greeting, true))
+	{
+		TestTrue(TEXT("Played a greeting"), Greetings.Contains(Barks->CurrentBark));
+		TestFalse(TEXT("Played a cooling greeting"), Played.Contains(Barks->CurrentBark));
+		Played.Add(Barks->CurrentBark);
+		if (Played.Num() > Greetings.Num())
+		{
+			break;
+		}
+	}
+	TestEqual(TEXT("Greetings played before all were cooling"), Played.Num(), Greetings.Num());
+
+	// Runtime edits copy the defaults into Barks first, and keep them and the shared set in step
+	Barks->ClearBarks(ERfsnBarkTrigger::Greeting);
+	Barks->AddBark(ERfsnBarkTrigger::Greeting, TEXT("Well met."), 5, 30.0f);
+	const int32 Edited = Defaults.Num() - Greetings.Num() + 1;
+	TestEqual(TEXT("Listed after edits"), Barks->Barks.Num(), Edited);
+	TestEqual(TEXT("Active after edits"), Barks->GetActiveBarks().Num(), Edited);
+	TestEqual(TEXT("Shared after edits"), Barks->GetBarkSet()->Num(), Edited);
+	TestTrue(TEXT("Added bark plays"), Barks->TryBark(ERfsnBarkTrigger::Greeting, true));
+	TestEqual(TEXT("Added bark"), Barks->CurrentBark, FString(TEXT("Well met.")));
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,92 @@
+// RFSN Conversation Log Fixtures Implementation
+
+#include "RfsnConversationLogFixtures.h"
+
+namespace RfsnBench
+{
+FString MakeLogMessage(FRandomStream& Random)
+{
+	const int32 NumWords = Random.RandRange(4, 12);
+	FString Message;
+	for (int32 Index = 0; Index < NumWords; Index++)
+	{
+		if (Index > 0)
+		{
+			Message += Random.FRand() < 0.1f ? TEXT(", ") : TEXT(" ");
+		}
+		Message += LogWords[Random.RandRange(0, UE_ARRAY_COUNT(LogWords) - 1)];
+	}
+	return Message + (Random.FRand() < 0.3f ? TEXT("?") : TEXT("."));
+}
+
+TArray<FRfsnConversationEntry> MakeTranscript(int32 Messages, FRandomStream& Random)
+{
+	const int32 NumSpeakers = UE_ARRAY_COUNT(LogSpeakers);
+	const FDateTime Start(2026, 1, 1);
+	TArray<FRfsnConversationEntry> Transcript;
+	Transcript.SetNum(Messages);
+	for (int32 Serial = 0; Serial < Messages; Serial++)
+	{
+		FRfsnConversationEntry& Entry = Transcript[Serial];
+		Entry.Speaker = LogSpeakers[Serial % NumSpeakers];
+		Entry.bIsPlayer = Serial % NumSpeakers == 0;
+		Entry.Message = MakeLogMessage(Random);
+		Entry.Timestamp = Start + FTimespan::FromSeconds(Serial);
+	}
+	return Transcript;
+}
+
+TArray<FString> MakeLogQueries(int32 NumQueries, FRandomStream& Random)
+{
+	TArray<FString> Queries;
+	for (int32 Query = 0; Query < NumQueries; Query++)
+	{
+		FString Text = LogWords[Random.RandRange(0, UE_ARRAY_COUNT(LogWords) - 1)];
+		for (int32 More = Query % 3; More > 0; More--)
+		{
+			Text += TEXT(" ");
+			Text += LogWords[Random.RandRange(0, UE_ARRAY_COUNT(LogWords) - 1)];
+		}
+		Queries.Add(Query % 10 == 9 ? Text + TEXT(" zeppelin") : Text.ToUpper());
+	}
+	return Queries;
+}
+
+int32 AddToRing(FRfsnConversationRing& Ring, const FRfsnConversationEntry& Entry)
+{
+	return Ring.Add(Entry.Speaker, Entry.Message, Entry.Timestamp, Entry.bIsPlayer);
+}
+
+void ScanTranscript(const TArray<FRfsnConversationEntry>& Transcript, FStringView Query, int32 MaxResults,
+                    TArray<int32>& OutSerials)
+{
+	OutSerials.Reset();
+	TArray<FString> QueryWords;
+	FRfsnTranscriptIndex::Tokenize(Query, QueryWords);
+	if (QueryWords.Num() == 0)
+	{
+		return;
+	}
+
+	TArray<FString> Words;
+	for (int32 Serial = Transcript.Num() - 1; Serial >= 0 && OutSerials.Num() < MaxResults; Serial--)
+	{
+		FRfsnTranscriptIndex::Tokenize(Transcript[Serial].Message, Words);
+		bool bAll = true;
+		for (const FString& Word : QueryWords)
+		{
+			bAll &= Words.Contains(Word);
+		}
+		if (bAll)
+		{
+			OutSerials.Add(Serial);
+		}
+	}
+}
+
+bool SameEntry(const FRfsnConversationEntry& A, const FRfsnConversationEntry& B)
+{
+	return A.Speaker == B.Speaker && A.Message.Equals(B.Message, ESearchCase::CaseSensitive) &&
+	       A.Timestamp == B.Timestamp && A.bIsPlayer == B.bIsPlayer;
+}
+} // namespace RfsnBench
@@ -0,0 +1,70 @@
+// RFSN Conversation Log Fixtures
+// Synthetic transcripts and queries, and the array log and unindexed search they are checked against
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "RfsnConversationLog.h"
+
+namespace RfsnBench
+{
+const TCHAR* const LogSpeakers[] = {
+    TEXT("Player"), TEXT("Mara"), TEXT("Old Tom"), TEXT("Guard Captain"), TEXT("Fisherman"), TEXT("Radio Voice"),
+    TEXT("Merchant"),
+};
+
+const TCHAR* const LogWords[] = {
+    TEXT("the"), TEXT("radio"), TEXT("tower"), TEXT("quarry"), TEXT("marsh"), TEXT("night"), TEXT("road"),
+    TEXT("don't"), TEXT("trust"), TEXT("stranger"), TEXT("lamp"), TEXT("oil"), TEXT("rope"), TEXT("fish"),
+    TEXT("boat"), TEXT("storm"), TEXT("north"), TEXT("south"), TEXT("cave"), TEXT("key"), TEXT("door"),
+    TEXT("signal"), TEXT("batteries"), TEXT("generator"), TEXT("fuel"), TEXT("island"), TEXT("ferry"),
+    TEXT("lighthouse"), TEXT("keeper"), TEXT("missing"), TEXT("found"), TEXT("help"), TEXT("price"),
+    TEXT("trade"), TEXT("wolves"), TEXT("bridge"), TEXT("broken"), TEXT("map"), TEXT("camp"), TEXT("fire"),
+    TEXT("quiet"), TEXT("listen"), TEXT("tomorrow"), TEXT("dawn"), TEXT("Mara"), TEXT("you"), TEXT("I"),
+    TEXT("is"),
+};
+
+/** Four to twelve words from LogWords with light punctuation */
+FString MakeLogMessage(FRandomStream& Random);
+
+/** Messages entries, one a second from 2026-01-01, speakers taking turns and the player first */
+TArray<FRfsnConversationEntry> MakeTranscript(int32 Messages, FRandomStream& Random);
+
+/** Search queries of one to three LogWords in upper case; every tenth adds a word no message contains */
+TArray<FString> MakeLogQueries(int32 NumQueries, FRandomStream& Random);
+
+/** Log the entry into the ring; returns its serial */
+int32 AddToRing(FRfsnConversationRing& Ring, const FRfsnConversationEntry& Entry);
+
+/** The old log: an array trimmed with RemoveAt(0), recent entries copied out */
+struct FLegacyConversationLog
+{
+	TArray<FRfsnConversationEntry> Entries;
+	int32 MaxEntries = 50;
+
+	void Add(const FRfsnConversationEntry& Entry)
+	{
+		Entries.Add(Entry);
+		while (Entries.Num() > MaxEntries)
+		{
+			Entries.RemoveAt(0);
+		}
+	}
+
+	TArray<FRfsnConversationEntry> GetRecentEntries(int32 Count) const
+	{
+		TArray<FRfsnConversationEntry> Recent;
+		for (int32 Index = FMath::Max(0, Entries.Num() - Count); Index < Entries.Num(); Index++)
+		{
+			Recent.Add(Entries[Index]);
+		}
+		return Recent;
+	}
+};
+
+/** Search without an index: tokenize every message, newest first */
+void ScanTranscript(const TArray<FRfsnConversationEntry>& Transcript, FStringView Query, int32 MaxResults,
+                    TArray<int32>& OutSerials);
+
+bool SameEntry(const FRfsnConversationEntry& A, const FRfsnConversationEntry& B);
+} // namespace RfsnBench
@@ -0,0 +1,296 @@
+// RFSN Conversation Log Tests
+// Ring wrap-around and resizing, the word index against a scan, the chunked transcript export and searching a log
+
+#include "RfsnConversationLog.h"
+#include "RfsnConversationLogFixtures.h"
+#include "RfsnTestWorld.h"
+#include "HAL/FileManager.h"
+#include "Misc/AutomationTest.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRfsnConversationRingTest, "Rfsn.ConversationLog.Ring",
+                                 EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext |
+                                     EAutomationTestFlags::ProductFilter)
+
+bool FRfsnConversationRingTest::RunTest(const FString& Parameters)
+{
+	using namespace RfsnBench;
+
+	FRandomStream Random(4242);
+	const int32 Logged = 173;
+	const int32 Extra = 10;
+	const TArray<FRfsnConversationEntry> Transcript = MakeTranscript(Logged + Extra, Random);
+
+	// Wrap-around: serials keep counting, the oldest are dropped
+	FRfsnConversationRing Ring;
+	Ring.SetCapacity(50);
+	for (int32 Serial = 0; Serial < Logged; Serial++)
+	{
+		TestEqual(TEXT("Serial"), AddToRing(Ring, Transcript[Serial]), Serial);
+	}
+	TestEqual(TEXT("Entries"), Ring.Num(), 50);
+	TestEqual(TEXT("Oldest serial"), Ring.GetOldestSerial(), Logged - 50);
+	for (int32 Index = 0; Index < Ring.Num(); Index++)
+	{
+		TestTrue(TEXT("Entry in order"), SameEntry(Ring.Get(Index), Transcript[Ring.GetOldestSerial() + Index]));
+	}
+
+	FRfsnConversationEntry Found;
+	TestFalse(TEXT("Dropped serial"), Ring.FindBySerial(Ring.GetOldestSerial() - 1, Found));
+	if (TestTrue(TEXT("Newest serial"), Ring.FindBySerial(Logged - 1, Found)))
+	{
+		TestTrue(TEXT("Newest entry"), SameEntry(Found, Transcript[Logged - 1]));
+	}
+
+	// Resizing keeps the newest entries
+	Ring.SetCapacity(20);
+	TestEqual(TEXT("Shrunk"), Ring.Num(), 20);
+	TestTrue(TEXT("Newest kept"), SameEntry(Ring.Get(Ring.Num() - 1), Transcript[Logged - 1]));
+
+	Ring.SetCapacity(64);
+	for (int32 Serial = Logged; Serial < Logged + Extra; Serial++)
+	{
+		AddToRing(Ring, Transcript[Serial]);
+	}
+	TestEqual(TEXT("Grown"), Ring.Num(), 20 + Extra);
+
+	int32 Visited = 0;
+	Ring.ForEach(
+	    [&](const FString& Speaker, const FString& Message, const FDateTime& Timestamp, bool bIsPlayer)
+	    {
+		    const FRfsnConversationEntry& Expected = Transcript[Logged + Extra - 5 + Visited++];
+		    TestEqual(TEXT("Recent speaker"), Speaker, Expected.Speaker);
+		    TestEqual(TEXT("Recent message"), Message, Expected.Message);
+	    },
+	    5);
+	TestEqual(TEXT("Recent entries visited"), Visited, 5);
+	TestEqual(TEXT("Speakers interned"), Ring.GetNumSpeakers(), static_cast<int32>(UE_ARRAY_COUNT(LogSpeakers)));
+
+	// The display path reads the same entries as the old array log
+	FLegacyConversationLog Legacy;
+	FRfsnConversationRing Current;
+	Current.SetCapacity(Legacy.MaxEntries);
+	for (const FRfsnConversationEntry& Entry : Transcript)
+	{
+		Legacy.Add(Entry);
+		AddToRing(Current, Entry);
+	}
+	const TArray<FRfsnConversationEntry> Expected = Legacy.GetRecentEntries(5);
+	int32 Shown = 0;
+	Current.ForEach(
+	    [&](const FString& Speaker, const FString& Message, const FDateTime& Timestamp, bool bIsPlayer)
+	    {
+		    TestEqual(TEXT("Same message as the old log"), Message, Expected[Shown++].Message);
+	    },
+	    5);
+	TestEqual(TEXT("Same entries shown"), Shown, Expected.Num());
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRfsnTranscriptIndexTest, "Rfsn.ConversationLog.IndexMatchesScan",
+                                 EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext |
+                                     EAutomationTestFlags::ProductFilter)
+
+bool FRfsnTranscriptIndexTest::RunTest(const FString& Parameters)
+{
+	using namespace RfsnBench;
+
+	FRandomStream Random(4242);
+	const TArray<FRfsnConversationEntry> Transcript = MakeTranscript(5000, Random);
+	FRfsnTranscriptIndex Index;
+	for (int32 Serial = 0; Serial < Transcript.Num(); Serial++)
+	{
+		Index.Add(Serial, Transcript[Serial].Message);
+	}
+
+	TArray<int32> Indexed;
+	TArray<int32> Scanned;
+	for (const FString& Query : MakeLogQueries(40, Random))
+	{
+		Index.Search(Query, 20, Indexed);
+		ScanTranscript(Transcript, Query, 20, Scanned);
+		TestTrue(FString::Printf(TEXT("\"%s\" finds what a scan finds"), *Query), Indexed == Scanned);
+	}
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRfsnTranscriptExportTest, "Rfsn.ConversationLog.Export",
+                                 EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext |
+                                     EAutomationTestFlags::ProductFilter)
+
+bool FRfsnTranscriptExportTest::RunTest(const FString& Parameters)
+{
+	using namespace RfsnBench;
+
+	FRandomStream Random(4242);
+	const int32 Exported = 5000;
+	const TArray<FRfsnConversationEntry> Transcript = MakeTranscript(Exported, Random);
+	const FString ExportDir = FPaths::AutomationTransientDir() / TEXT("RfsnTranscript");
+	IFileManager::Get().DeleteDirectory(*ExportDir, false, true);
+
+	FRfsnTranscriptExporter Exporter;
+	Exporter.Begin(ExportDir);
+	for (int32 Serial = 0; Serial < Exported; Serial++)
+	{
+		Exporter.Add(Serial, Transcript[Serial]);
+	}
+	// Chunks still being written answer from memory, finished ones from their files; neither waits on a write
+	TArray<int32> Probes = {Exported - 1};
+	for (int32 Probe = 0; Probe < 20; Probe++)
+	{
+		Probes.Add(Random.RandRange(0, Exported - 2));
+	}
+	const TMap<int32, FRfsnConversationEntry> Found = Exporter.FindBySerialsAsync(Probes).Get();
+	int32 NotFound = 0;
+	for (int32 Serial : Probes)
+	{
+		const FRfsnConversationEntry* Entry = Found.Find(Serial);
+		NotFound += Entry && SameEntry(*Entry, Transcript[Serial]) ? 0 : 1;
+	}
+	TestEqual(TEXT("Queued and written entries not found"), NotFound, 0);
+	TestEqual(TEXT("Unexported serial left out"), Exporter.FindBySerialsAsync({Exported}).Get().Num(), 0);
+	Exporter.Finish();
+	TestEqual(TEXT("Write failures"), Exporter.GetStats().Failures, 0);
+
+	// Once written, every chunk is read back from disk
+	const TMap<int32, FRfsnConversationEntry> FoundOnDisk = Exporter.FindBySerialsAsync(Probes).Get();
+	NotFound = 0;
+	for (int32 Serial : Probes)
+	{
+		const FRfsnConversationEntry* Entry = FoundOnDisk.Find(Serial);
+		NotFound += Entry && SameEntry(*Entry, Transcript[Serial]) ? 0 : 1;
+	}
+	TestEqual(TEXT("Written entries not found"), NotFound, 0);
+
+	// Chunks read back intact
+	TArray<FRfsnConversationEntry> ReadBack;
+	TestTrue(TEXT("Transcript read"), FRfsnTranscriptExporter::ReadTranscript(ExportDir, ReadBack));
+	if (TestEqual(TEXT("Entries read back"), ReadBack.Num(), Exported))
+	{
+		int32 Differing = 0;
+		for (int32 Serial = 0; Serial < Exported; Serial++)
+		{
+			Differing += SameEntry(ReadBack[Serial], Transcript[Serial]) ? 0 : 1;
+		}
+		TestEqual(TEXT("Entries differing"), Differing, 0);
+	}
+
+	// Damage is caught
+	TArray<uint8> Chunk;
+	TestTrue(TEXT("First chunk"), FFileHelper::LoadFileToArray(Chunk, *(ExportDir / TEXT("Chunk_00000.rfsnlog"))));
+	if (Chunk.Num() > 16)
+	{
+		const FString DamagedPath = ExportDir / TEXT("Damaged.bin");
+		int32 FirstSerial = 0;
+		TArray<uint8> Damaged = Chunk;
+		Damaged.Last() ^= 0x5A;
+		FFileHelper::SaveArrayToFile(Damaged, *DamagedPath);
+		TestFalse(TEXT("Flipped bit rejected"), FRfsnTranscriptExporter::ReadChunk(DamagedPath, FirstSerial, ReadBack));
+
+		Damaged = Chunk;
+		Damaged.SetNum(Damaged.Num() - 16);
+		FFileHelper::SaveArrayToFile(Damaged, *DamagedPath);
+		TestFalse(TEXT("Truncation rejected"), FRfsnTranscriptExporter::ReadChunk(DamagedPath, FirstSerial, ReadBack));
+	}
+
+	IFileManager::Get().DeleteDirectory(*ExportDir, false, true);
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRfsnConversationLogSearchTest, "Rfsn.ConversationLog.Search",
+                                 EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext |
+                                     EAutomationTestFlags::ProductFilter)
+
+bool FRfsnConversationLogSearchTest::RunTest(const FString& Parameters)
+{
+	using namespace RfsnBench;
+
+	FRandomStream Random(4242);
+	const int32 Logged = 500;
+	const int32 Capacity = 50;
+	const TArray<FRfsnConversationEntry> Transcript = MakeTranscript(Logged, Random);
+	const TArray<FString> Queries = MakeLogQueries(20, Random);
+
+	FRfsnTestWorld TestWorld;
+	AActor* Owner = TestWorld.SpawnActor(FVector::ZeroVector);
+	// Configured before play begins, which is when the logs read their settings
+	URfsnConversationLog* RingOnly = TestWorld.AddComponent<URfsnConversationLog>(Owner);
+	RingOnly->MaxEntries = Capacity;
+	RingOnly->bExportTranscript = false;
+	URfsnConversationLog* Exported = TestWorld.AddComponent<URfsnConversationLog>(Owner);
+	Exported->MaxEntries = Capacity;
+	Exported->bExportTranscript = true;
+	Exported->ExportChunkEntries = 16;
+	// Transcript directories are named after the owner, so a second exporting log needs its own
+	AActor* BoundedOwner = TestWorld.SpawnActor(FVector::ZeroVector);
+	URfsnConversationLog* Bounded = TestWorld.AddComponent<URfsnConversationLog>(BoundedOwner);
+	Bounded->MaxEntries = Capacity;
+	Bounded->bExportTranscript = true;
+	Bounded->ExportChunkEntries = 16;
+	Bounded->MaxIndexedEntries = 100;
+	TestWorld.BeginPlay();
+	for (const FRfsnConversationEntry& Entry : Transcript)
+	{
+		RingOnly->LogNpcMessage(Entry.Speaker, Entry.Message);
+		Exported->LogNpcMessage(Entry.Speaker, Entry.Message);
+	}
+	for (int32 Serial = 0; Serial < Logged; Serial++)
+	{
+		Bounded->LogNpcMessage(TEXT("Clerk"), FString::Printf(TEXT("Ledger line %d"), Serial));
+	}
+
+	// Without an export only the ring is searched; with one, the whole session
+	const TArray<FRfsnConversationEntry> Held(Transcript.GetData() + Logged - Capacity, Capacity);
+	TArray<int32> Expected;
+	for (const FString& Query : Queries)
+	{
+		ScanTranscript(Held, Query, 20, Expected);
+		const TArray<FRfsnConversationEntry> FromRing = RingOnly->SearchTranscriptAsync(Query).Get();
+		bool bSame = FromRing.Num() == Expected.Num();
+		for (int32 i = 0; bSame && i < Expected.Num(); i++)
+		{
+			bSame = FromRing[i].Message == Held[Expected[i]].Message;
+		}
+		TestTrue(FString::Printf(TEXT("\"%s\" searches the ring"), *Query), bSame);
+
+		ScanTranscript(Transcript, Query, 20, Expected);
+		const TArray<FRfsnConversationEntry> FromExport = Exported->SearchTranscriptAsync(Query).Get();
+		bSame = FromExport.Num() == Expected.Num();
+		for (int32 i = 0; bSame && i < Expected.Num(); i++)
+		{
+			bSame = FromExport[i].Message == Transcript[Expected[i]].Message;
+		}
+		TestTrue(FString::Printf(TEXT("\"%s\" searches the transcript"), *Query), bSame);
+	}
+
+	// The bounded index keeps the newest entries, dropping the oldest quarter each time it fills
+	const int32 Indexed = Bounded->SearchTranscriptAsync(TEXT("ledger line"), Logged).Get().Num();
+	TestTrue(TEXT("Bounded index holds at most MaxIndexedEntries"), Indexed <= Bounded->MaxIndexedEntries);
+	TestTrue(TEXT("Bounded index keeps three quarters"), Indexed >= Bounded->MaxIndexedEntries * 3 / 4);
+	TestEqual(TEXT("Newest entry found"),
+	          Bounded->SearchTranscriptAsync(FString::Printf(TEXT("line %d"), Logged - 1)).Get().Num(), 1);
+	TestEqual(TEXT("Entry past the bound found"), Bounded->SearchTranscriptAsync(TEXT("line 3")).Get().Num(), 0);
+
+	// Clearing the log clears what it can find
+	Exported->ClearLog();
+	int32 FoundAfterClear = 0;
+	for (const FString& Query : Queries)
+	{
+		FoundAfterClear += Exported->SearchTranscriptAsync(Query).Get().Num();
+	}
+	TestEqual(TEXT("Entries found after ClearLog"), FoundAfterClear, 0);
+
+	// Ending play finishes the writes before the session's files are removed
+	for (URfsnConversationLog* Log : {Exported, Bounded})
+	{
+		const FString ExportDir = Log->GetTranscriptDirectory();
+		Log->DestroyComponent();
+		IFileManager::Get().DeleteDirectory(*ExportDir, false, true);
+	}
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,103 @@
+// RFSN Focus Fixtures Implementation
+
+#include "RfsnFocusFixtures.h"
+#include "IslandRadioTower.h"
+#include "Components/SphereComponent.h"
+#include "Engine/CollisionProfile.h"
+
+namespace RfsnBench
+{
+void FFocusWorld::Build(int32 Frames)
+{
+	const float Half = 2000.0f;
+	FRandomStream Stream(1357);
+
+	for (int32 i = 0; i < FocusInteractables; i++)
+	{
+		const float X = Stream.FRandRange(-Half, Half);
+		const float Y = Stream.FRandRange(-Half, Half);
+		const float Z = Stream.FRandRange(0.0f, 200.0f);
+		const float Radius = Stream.FRandRange(20.0f, 120.0f);
+
+		UWorld* World = TestWorld.GetWorld();
+		AIslandRadioTower* Tower = World->SpawnActor<AIslandRadioTower>(FVector(X, Y, Z), FRotator::ZeroRotator);
+		Tower->SetActorTickEnabled(false);
+
+		// Collision added after spawning, as a Blueprint would; the focus trace hits it and the registry sizes it
+		USceneComponent* Root = Tower->GetRootComponent();
+		TestWorld.AddComponent<USphereComponent>(Tower,
+		                                         [Root, Radius](USphereComponent& Sphere)
+		                                         {
+			                                         Sphere.SetupAttachment(Root);
+			                                         Sphere.InitSphereRadius(Radius);
+			                                         Sphere.SetCollisionProfileName(
+			                                             UCollisionProfile::BlockAll_ProfileName);
+		                                         });
+	}
+
+	enum class EMotion : uint8
+	{
+		Still,
+		Drift,
+		Look,
+		Walk
+	};
+	EMotion Motion = EMotion::Still;
+	int32 SegmentLeft = 0;
+	float YawRate = 0.0f;
+	float PitchRate = 0.0f;
+	FIslandFocusView View;
+	View.Location = FVector(0.0f, 0.0f, 170.0f);
+
+	Views.SetNum(Frames);
+	for (int32 Frame = 0; Frame < Frames; Frame++)
+	{
+		if (SegmentLeft-- <= 0)
+		{
+			Motion = static_cast<EMotion>(Stream.RandRange(0, 3));
+			SegmentLeft = Stream.RandRange(30, 240);
+			const float Rate = Motion == EMotion::Drift ? 0.05f : Stream.FRandRange(0.5f, 3.0f);
+			YawRate = Stream.FRandRange(-1.0f, 1.0f) * Rate;
+			PitchRate = Stream.FRandRange(-0.3f, 0.3f) * Rate;
+		}
+
+		if (Motion != EMotion::Still)
+		{
+			View.Rotation.Yaw = FRotator::NormalizeAxis(View.Rotation.Yaw + YawRate);
+			View.Rotation.Pitch = FMath::Clamp(View.Rotation.Pitch + PitchRate, -40.0f, 20.0f);
+		}
+		if (Motion == EMotion::Walk)
+		{
+			View.Location += FRotator(0.0f, View.Rotation.Yaw, 0.0f).Vector() * 5.0f;
+			View.Location.X = FMath::Clamp(View.Location.X, -Half, Half);
+			View.Location.Y = FMath::Clamp(View.Location.Y, -Half, Half);
+		}
+		Views[Frame] = View;
+	}
+}
+
+UIslandInteractorComponent* FFocusWorld::AddInteractor(TFunctionRef<void(UIslandInteractorComponent&)> Configure)
+{
+	AActor* Owner = TestWorld.SpawnActor(FVector::ZeroVector);
+	UIslandInteractorComponent* Interactor = TestWorld.AddComponent<UIslandInteractorComponent>(Owner, Configure);
+	Interactors.Add(Interactor);
+	return Interactor;
+}
+
+void FFocusWorld::Step(int32 Frame)
+{
+	for (UIslandInteractorComponent* Interactor : Interactors)
+	{
+		Interactor->SetViewOverride(Views[Frame]);
+	}
+	TestWorld.Tick(FocusFrameTime);
+}
+
+void FFocusWorld::TraceEveryTick(UIslandInteractorComponent& Interactor)
+{
+	Interactor.FocusMoveThreshold = 0.0f;
+	Interactor.FocusRotateThreshold = 0.0f;
+	Interactor.FocusRefreshInterval = KINDA_SMALL_NUMBER;
+	Interactor.bUseConePrefilter = false;
+}
+} // namespace RfsnBench
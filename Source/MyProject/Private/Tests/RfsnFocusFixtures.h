@@ -0,0 +1,44 @@
+// RFSN Focus Fixtures
+// A world of traceable interactables and interactors following a scripted camera path
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "IslandInteractorComponent.h"
+#include "RfsnTestWorld.h"
+
+namespace RfsnBench
+{
+/** Frame time of the focus run (60 fps) */
+constexpr float FocusFrameTime = 1.0f / 60.0f;
+
+/** Interactables scattered over the focus run's area */
+constexpr int32 FocusInteractables = 400;
+
+/**
+ * The focus run's world: interactables as radio towers with sphere collision, a scripted camera path (standing
+ * still, slow sub-threshold pans, looking around and walking, in random segments) and interactors that follow it
+ * through the real UIslandInteractorComponent. Add the interactors, then BeginPlay, then Step each frame.
+ */
+struct FFocusWorld
+{
+	FRfsnTestWorld TestWorld;
+	TArray<FIslandFocusView> Views;
+
+	void Build(int32 Frames);
+
+	/** An interactor on an actor of its own, configured before it registers */
+	UIslandInteractorComponent* AddInteractor(TFunctionRef<void(UIslandInteractorComponent&)> Configure);
+
+	void BeginPlay() { TestWorld.BeginPlay(); }
+
+	/** Point every interactor at the frame's view and tick the world once */
+	void Step(int32 Frame);
+
+	/** Settings that trace on every tick, as the component did before throttling */
+	static void TraceEveryTick(UIslandInteractorComponent& Interactor);
+
+private:
+	TArray<UIslandInteractorComponent*> Interactors;
+};
+} // namespace RfsnBench
@@ -0,0 +1,150 @@
+// RFSN Focus Tests
+// The throttled, pre-filtered and async interactor focus against tracing on every tick, and the interactable registry
+
+#include "IslandInteractableRegistry.h"
+#include "IslandInteractorComponent.h"
+#include "IslandRadioTower.h"
+#include "RfsnFocusFixtures.h"
+#include "RfsnTestWorld.h"
+#include "Components/SphereComponent.h"
+#include "Engine/CollisionProfile.h"
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace RfsnFocusTests
+{
+/** One minute of the camera path */
+constexpr int32 Frames = 3600;
+
+int32 CountTraces(const UIslandInteractorComponent& Interactor)
+{
+	return Interactor.GetNumFocusTraces() + Interactor.GetNumPrefilteredTraces();
+}
+} // namespace RfsnFocusTests
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRfsnFocusThrottleTest, "Rfsn.Focus.MatchesPerTick",
+                                 EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext |
+                                     EAutomationTestFlags::ProductFilter)
+
+bool FRfsnFocusThrottleTest::RunTest(const FString& Parameters)
+{
+	using namespace RfsnBench;
+	using namespace RfsnFocusTests;
+
+	FFocusWorld Focus;
+	Focus.Build(Frames);
+	UIslandInteractorComponent* PerTick = Focus.AddInteractor(&FFocusWorld::TraceEveryTick);
+	UIslandInteractorComponent* Throttled = Focus.AddInteractor([](UIslandInteractorComponent&) {});
+	UIslandInteractorComponent* Prefiltered =
+	    Focus.AddInteractor([](UIslandInteractorComponent& Interactor) { Interactor.bUseConePrefilter = true; });
+	UIslandInteractorComponent* Async =
+	    Focus.AddInteractor([](UIslandInteractorComponent& Interactor) { Interactor.bAsyncFocusTrace = true; });
+	Focus.BeginPlay();
+
+	// Without a trace the focus can only go stale for as long as the refresh interval
+	const int32 RefreshFrames = FMath::CeilToInt(Throttled->FocusRefreshInterval / FocusFrameTime) + 1;
+
+	FIslandFocusView LastTraceView;
+	AActor* PreviousReference = nullptr;
+	bool bAsyncTraced = false;
+	int32 FocusChanges = 0;
+	int32 UntracedMoves = 0;
+	int32 TracedMismatches = 0;
+	int32 LongestUntraced = 0;
+	int32 Untraced = 0;
+	int32 PrefilterMisses = 0;
+	int32 AsyncMismatches = 0;
+
+	for (int32 Frame = 0; Frame < Frames; Frame++)
+	{
+		const int32 ThrottledBefore = CountTraces(*Throttled);
+		const int32 AsyncBefore = CountTraces(*Async);
+		Focus.Step(Frame);
+
+		AActor* Reference = PerTick->FocusedActor;
+		FocusChanges += Frame > 0 && Reference != PreviousReference ? 1 : 0;
+
+		// A view moved or turned past the thresholds is traced that frame, and a traced frame agrees with per tick
+		const bool bTraced = CountTraces(*Throttled) > ThrottledBefore;
+		const bool bMoved = Focus.Views[Frame].DiffersFrom(LastTraceView, Throttled->FocusMoveThreshold,
+		                                                   Throttled->FocusRotateThreshold);
+		UntracedMoves += bMoved && !bTraced && Frame > 0 ? 1 : 0;
+		TracedMismatches += bTraced && Throttled->FocusedActor != Reference ? 1 : 0;
+		Untraced = bTraced ? 0 : Untraced + 1;
+		LongestUntraced = FMath::Max(LongestUntraced, Untraced);
+		if (bTraced)
+		{
+			LastTraceView = Focus.Views[Frame];
+		}
+
+		// The cone pre-filter only skips traces that would have hit nothing
+		PrefilterMisses += Prefiltered->FocusedActor != Throttled->FocusedActor ? 1 : 0;
+
+		// An async trace lands on the next frame with what the per-tick trace saw on its own
+		AsyncMismatches += bAsyncTraced && Async->FocusedActor != PreviousReference ? 1 : 0;
+		bAsyncTraced = CountTraces(*Async) > AsyncBefore;
+
+		PreviousReference = Reference;
+	}
+
+	TestTrue(TEXT("The camera path changes focus"), FocusChanges > 0);
+	TestTrue(TEXT("Throttling skips traces"), CountTraces(*Throttled) < CountTraces(*PerTick));
+	TestTrue(TEXT("The pre-filter skips traces"), Prefiltered->GetNumPrefilteredTraces() > 0);
+	TestEqual(TEXT("Moves past a threshold without a trace"), UntracedMoves, 0);
+	TestEqual(TEXT("Traced frames differing from per tick"), TracedMismatches, 0);
+	TestTrue(TEXT("Frames between traces within the refresh interval"), LongestUntraced <= RefreshFrames);
+	TestEqual(TEXT("Frames the pre-filter lost the focus"), PrefilterMisses, 0);
+	TestEqual(TEXT("Async results differing from the frame they were traced on"), AsyncMismatches, 0);
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRfsnFocusRegistryTest, "Rfsn.Focus.Registry",
+                                 EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext |
+                                     EAutomationTestFlags::ProductFilter)
+
+bool FRfsnFocusRegistryTest::RunTest(const FString& Parameters)
+{
+	FRfsnTestWorld TestWorld;
+	TestWorld.BeginPlay();
+	UIslandInteractableRegistry* Registry = TestWorld.GetSubsystem<UIslandInteractableRegistry>();
+	if (!TestNotNull(TEXT("Registry"), Registry))
+	{
+		return false;
+	}
+
+	// Off the view ray, in a narrow cone only once its collision counts
+	UWorld* World = TestWorld.GetWorld();
+	const FVector TowerLocation(500.0f, 200.0f, 0.0f);
+	AIslandRadioTower* Tower = World->SpawnActor<AIslandRadioTower>(TowerLocation, FRotator::ZeroRotator);
+	TestEqual(TEXT("Registered on spawn"), Registry->GetNumRegistered(), 1);
+
+	// Collision added after the spawn handler ran is still measured
+	USceneComponent* Root = Tower->GetRootComponent();
+	TestWorld.AddComponent<USphereComponent>(Tower,
+	                                         [Root](USphereComponent& Sphere)
+	                                         {
+		                                         Sphere.SetupAttachment(Root);
+		                                         Sphere.InitSphereRadius(150.0f);
+		                                         Sphere.SetCollisionProfileName(
+		                                             UCollisionProfile::BlockAll_ProfileName);
+	                                         });
+	TestTrue(TEXT("Sized after registering"), Registry->AnyInCone(FVector::ZeroVector, FVector::ForwardVector,
+	                                                               1000.0f, 5.0f));
+	TestFalse(TEXT("Outside the cone"), Registry->AnyInCone(FVector::ZeroVector, -FVector::ForwardVector, 1000.0f,
+	                                                       5.0f));
+
+	// Streamed out: ends play without being destroyed
+	Tower->RouteEndPlay(EEndPlayReason::RemovedFromWorld);
+	TestEqual(TEXT("Dropped on end play"), Registry->GetNumRegistered(), 0);
+	TestFalse(TEXT("Nothing left in the cone"), Registry->AnyInCone(FVector::ZeroVector, FVector::ForwardVector,
+	                                                               1000.0f, 5.0f));
+
+	AActor* Destroyed = World->SpawnActor<AIslandRadioTower>(FVector(300.0f, 0.0f, 0.0f), FRotator::ZeroRotator);
+	TestEqual(TEXT("Registered again"), Registry->GetNumRegistered(), 1);
+	Destroyed->Destroy();
+	TestEqual(TEXT("Dropped on destroy"), Registry->GetNumRegistered(), 0);
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,36 @@
+// RFSN Lip Sync Fixtures Implementation
+
+#include "RfsnLipSyncFixtures.h"
+
+namespace RfsnBench
+{
+float MeanEnvelope(const FRfsnLipSyncTrack& Track, float From, float To)
+{
+	float Sum = 0.0f;
+	int32 Count = 0;
+	for (float T = From; T < To; T += 1.0f / Track.FrameRate)
+	{
+		float Amplitude = 0.0f;
+		ERfsnViseme Viseme = ERfsnViseme::Silence;
+		Track.Sample(T, Amplitude, Viseme);
+		Sum += Amplitude;
+		Count++;
+	}
+	return Count > 0 ? Sum / Count : 0.0f;
+}
+
+float VisemeFraction(const FRfsnLipSyncTrack& Track, float From, float To, TFunctionRef<bool(ERfsnViseme)> Predicate)
+{
+	int32 Hits = 0;
+	int32 Count = 0;
+	for (float T = From; T < To; T += 1.0f / Track.FrameRate)
+	{
+		float Amplitude = 0.0f;
+		ERfsnViseme Viseme = ERfsnViseme::Silence;
+		Track.Sample(T, Amplitude, Viseme);
+		Hits += Predicate(Viseme) ? 1 : 0;
+		Count++;
+	}
+	return Count > 0 ? static_cast<float>(Hits) / Count : 0.0f;
+}
+} // namespace RfsnBench
@@ -0,0 +1,14 @@
+// RFSN Lip Sync Fixtures
+// Measurements of analyzed lip sync tracks over a stretch of the synthetic clip
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "RfsnLipSyncAnalysis.h"
+
+namespace RfsnBench
+{
+float MeanEnvelope(const FRfsnLipSyncTrack& Track, float From, float To);
+
+float VisemeFraction(const FRfsnLipSyncTrack& Track, float From, float To, TFunctionRef<bool(ERfsnViseme)> Predicate);
+} // namespace RfsnBench
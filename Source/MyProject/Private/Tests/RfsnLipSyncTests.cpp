@@ -0,0 +1,44 @@
+// RFSN Lip Sync Tests
+// Envelope and viseme checks of the offline analyzer on a synthetic speech clip
+
+#include "RfsnBenchFixtures.h"
+#include "RfsnLipSyncAnalysis.h"
+#include "RfsnLipSyncFixtures.h"
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRfsnLipSyncEnvelopeTest, "Rfsn.LipSync.Envelope",
+                                 EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext |
+                                     EAutomationTestFlags::ProductFilter)
+
+bool FRfsnLipSyncEnvelopeTest::RunTest(const FString& Parameters)
+{
+	using namespace RfsnBench;
+
+	const int32 SampleRate = 22050;
+	const TArray<int16> Pcm = MakeSyntheticSpeech(SampleRate);
+	const FRfsnLipSyncTrack Track = FRfsnLipSyncAnalyzer::Analyze(Pcm.GetData(), Pcm.Num(), SampleRate);
+
+	TestEqual(TEXT("Duration"), Track.Duration, static_cast<float>(Pcm.Num()) / SampleRate, 0.01f);
+	TestTrue(TEXT("Leading silence keeps the mouth closed"), MeanEnvelope(Track, 0.02f, 0.28f) < 0.02f);
+	TestTrue(TEXT("Vowel opens the mouth"), MeanEnvelope(Track, 0.40f, 0.75f) > 0.5f);
+
+	float OnsetLevel = 0.0f;
+	ERfsnViseme OnsetViseme = ERfsnViseme::Silence;
+	Track.Sample(0.33f, OnsetLevel, OnsetViseme);
+	TestTrue(TEXT("Onset opens within 30 ms"), OnsetLevel > 0.5f);
+
+	const float Closure = VisemeFraction(Track, 0.80f, 0.83f, [](ERfsnViseme V) { return V == ERfsnViseme::MBP; });
+	TestTrue(TEXT("Short gap is a closure"), Closure > 0.5f);
+
+	const float Fricative = VisemeFraction(Track, 1.25f, 1.45f, [](ERfsnViseme V)
+	                                       { return V == ERfsnViseme::CDG || V == ERfsnViseme::FV; });
+	TestTrue(TEXT("Noise is fricative"), Fricative > 0.6f);
+
+	const float Trailing = VisemeFraction(Track, 1.60f, 1.78f, [](ERfsnViseme V) { return V == ERfsnViseme::Silence; });
+	TestTrue(TEXT("Trailing silence"), Trailing > 0.9f);
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,99 @@
+// RFSN Load Test Tests
+// The load test subsystem run headless against the checked-in stream fixture, held to its own budgets
+
+#include "RfsnLoadTest.h"
+#include "RfsnTestWorld.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/App.h"
+#include "Misc/AutomationTest.h"
+#include "Misc/Paths.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace RfsnLoadTestTests
+{
+constexpr int32 NpcCount = 50;
+constexpr float DurationSeconds = 3.0f;
+
+/** Wall-clock limit on the run, well past DurationSeconds, so a load test that never finishes fails instead */
+constexpr double TimeoutSeconds = 30.0;
+
+FString GetFixturePath()
+{
+	return FPaths::GameSourceDir() / TEXT("MyProject/Private/Tests/Fixtures/StreamReplay.rfsnsession");
+}
+} // namespace RfsnLoadTestTests
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRfsnLoadTestReplayTest, "Rfsn.LoadTest.ReplayBudgets",
+                                 EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext |
+                                     EAutomationTestFlags::ProductFilter)
+
+bool FRfsnLoadTestReplayTest::RunTest(const FString& Parameters)
+{
+	using namespace RfsnLoadTestTests;
+
+	FRfsnTestWorld World;
+	URfsnLoadTest* LoadTest = World.GetSubsystem<URfsnLoadTest>();
+	if (!TestNotNull(TEXT("Load test subsystem"), LoadTest))
+	{
+		return false;
+	}
+	World.BeginPlay();
+
+	// Speed 0 replays the whole fixture as soon as a playback starts, so every NPC parses it again each frame
+	if (!TestTrue(TEXT("Replay started"), LoadTest->StartReplayTest(GetFixturePath(), NpcCount, DurationSeconds, 0.0f)))
+	{
+		return false;
+	}
+
+	// The client logs every sentence; quieted so the frames measure the NPCs
+#if !NO_LOGGING
+	const ELogVerbosity::Type TempVerbosity = LogTemp.GetVerbosity();
+	LogTemp.SetVerbosity(ELogVerbosity::Fatal);
+#endif
+
+	// The load test samples the engine's frame time, which only the engine loop sets; set it from the wall clock
+	// the same way so each sample is the previous frame of this loop
+	const double SavedDeltaTime = FApp::GetDeltaTime();
+	const double Start = FPlatformTime::Seconds();
+	double FrameStart = Start;
+	while (LoadTest->IsRunning() && FPlatformTime::Seconds() - Start < TimeoutSeconds)
+	{
+		const double Now = FPlatformTime::Seconds();
+		FApp::SetDeltaTime(Now - FrameStart);
+		FrameStart = Now;
+		World.Tick(0.1f);
+	}
+	FApp::SetDeltaTime(SavedDeltaTime);
+
+#if !NO_LOGGING
+	LogTemp.SetVerbosity(TempVerbosity);
+#endif
+
+	if (!TestFalse(TEXT("Load test finished within the timeout"), LoadTest->IsRunning()))
+	{
+		LoadTest->StopLoadTest();
+		return false;
+	}
+
+	// MemoryDeltaMb is resident-memory growth over the run, which other threads and allocator caching also move,
+	// so the memory budget only catches gross regressions such as NPCs or sessions that are never freed
+	const FRfsnLoadTestReport Report = LoadTest->GetLastReport();
+	AddInfo(FString::Printf(TEXT("%d NPCs, %d frames: frame p95 %.2f ms (budget %.1f), memory %+.1f MB (budget %.1f), "
+	                             "%d playbacks"),
+	                        Report.NpcCount, Report.Frames, Report.FrameMsP95, LoadTest->FrameMsBudgetP95,
+	                        Report.MemoryDeltaMb, LoadTest->MemoryBudgetMb, Report.Playbacks));
+
+	TestEqual(TEXT("NPCs spawned"), Report.NpcCount, NpcCount);
+	TestTrue(TEXT("Frames sampled"), Report.Frames > 0);
+	TestTrue(TEXT("Fixture replayed"), Report.Playbacks > 0);
+	TestEqual(TEXT("Playbacks that differ from the recording"), Report.ReplayMismatches, 0);
+	TestTrue(TEXT("Frame time p95 within budget"),
+	         LoadTest->FrameMsBudgetP95 <= 0.0f || Report.FrameMsP95 <= LoadTest->FrameMsBudgetP95);
+	TestTrue(TEXT("Memory growth within budget"),
+	         LoadTest->MemoryBudgetMb <= 0.0f || Report.MemoryDeltaMb <= LoadTest->MemoryBudgetMb);
+	TestTrue(TEXT("Report within budget"), Report.bWithinBudget);
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,40 @@
+// RFSN Look At Fixtures Implementation
+
+#include "RfsnLookAtFixtures.h"
+
+namespace RfsnBench
+{
+void FLookAtScenario::Build(int32 NpcCount)
+{
+	FRandomStream Stream(2468);
+	Legacy.SetNum(NpcCount);
+	for (int32 i = 0; i < NpcCount; i++)
+	{
+		FLegacyLookAt& Npc = Legacy[i];
+		Npc.Location = FVector(Stream.FRandRange(-2000.0f, 2000.0f), Stream.FRandRange(-1200.0f, 1200.0f), 90.0f);
+		Npc.Rotation = FRotator(0.0f, Stream.FRandRange(-180.0f, 180.0f), 0.0f);
+		Npc.RotationSpeed = Stream.FRandRange(90.0f, 360.0f);
+		Npc.HeadOnlyAngle = Stream.FRandRange(30.0f, 60.0f);
+		Npc.bRotateBody = i % 5 != 0;
+		Npc.bHasTarget = true;
+
+		FRfsnLookAtParams Params;
+		Params.TurnSpeed = Npc.RotationSpeed / 90.0f;
+		Params.HeadOnlyAngle = Npc.HeadOnlyAngle;
+		Params.bRotateBody = Npc.bRotateBody;
+		Solver.Add(Params);
+		Solver.SetPose(i, Npc.Location, Npc.Rotation.Yaw);
+	}
+}
+
+FVector LookAtPlayerEyes(int32 Frame)
+{
+	const float Angle = Frame * LookAtFrameTime * 0.4f;
+	return FVector(1500.0f * FMath::Cos(Angle), 900.0f * FMath::Sin(Angle * 2.0f), 90.0f + LookAtEyeHeight);
+}
+
+float YawError(float A, float B)
+{
+	return FMath::Abs(FMath::UnwindDegrees(A - B));
+}
+} // namespace RfsnBench
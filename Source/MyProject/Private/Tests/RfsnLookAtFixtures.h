@@ -0,0 +1,73 @@
+// RFSN Look At Fixtures
+// URfsnNpcLookAt's per-tick update before the look-at manager, and the player's loop through the NPCs
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "RfsnLookAtManager.h"
+#include "Kismet/KismetMathLibrary.h"
+
+namespace RfsnBench
+{
+constexpr float LookAtFrameTime = 1.0f / 60.0f;
+constexpr float LookAtEyeHeight = 160.0f;
+
+/** URfsnNpcLookAt's old per-tick update for one NPC (less the dialogue manager lookup that preceded it) */
+struct FLegacyLookAt
+{
+	FVector Location = FVector::ZeroVector;
+	FRotator Rotation = FRotator::ZeroRotator;
+	FVector LookAtTarget = FVector::ZeroVector;
+	bool bHasTarget = false;
+	float RotationSpeed = 180.0f;
+	float HeadOnlyAngle = 45.0f;
+	bool bRotateBody = true;
+
+	float GetAngleToTarget() const
+	{
+		FVector ToTarget = LookAtTarget - Location;
+		ToTarget.Z = 0;
+		ToTarget.Normalize();
+
+		FVector Forward = Rotation.Vector();
+		Forward.Z = 0;
+		Forward.Normalize();
+
+		return FMath::RadiansToDegrees(FMath::Acos(FVector::DotProduct(Forward, ToTarget)));
+	}
+
+	/** Returns whether the body turned */
+	bool Tick(float DeltaTime)
+	{
+		if (!bHasTarget)
+		{
+			return false;
+		}
+
+		const FRotator TargetRotation = UKismetMathLibrary::FindLookAtRotation(Location, LookAtTarget);
+		if (bRotateBody && GetAngleToTarget() > HeadOnlyAngle)
+		{
+			Rotation = FMath::RInterpTo(Rotation, FRotator(Rotation.Pitch, TargetRotation.Yaw, Rotation.Roll),
+			                            DeltaTime, RotationSpeed / 90.0f);
+			return true;
+		}
+		return false;
+	}
+};
+
+/** NPCs scattered around the player's loop, a fifth of them head-only, with varied speeds and limits, both as old
+ *  components and in one solver */
+struct FLookAtScenario
+{
+	TArray<FLegacyLookAt> Legacy;
+	FRfsnLookAtSolver Solver;
+
+	void Build(int32 NpcCount);
+};
+
+/** The player walking a loop through the NPCs, at eye height */
+FVector LookAtPlayerEyes(int32 Frame);
+
+/** Shortest distance between two yaws */
+float YawError(float A, float B);
+} // namespace RfsnBench
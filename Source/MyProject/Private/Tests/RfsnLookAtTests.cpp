@@ -0,0 +1,235 @@
+// RFSN Look-At Tests
+// The batched look-at solver against the per-component tick it replaced, and the manager's sleeping entries
+
+#include "RfsnLookAtFixtures.h"
+#include "RfsnLookAtManager.h"
+#include "RfsnNpcLookAt.h"
+#include "RfsnTestWorld.h"
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace RfsnLookAtTests
+{
+constexpr int32 NpcCount = 200;
+} // namespace RfsnLookAtTests
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRfsnLookAtFollowTest, "Rfsn.LookAt.MatchesComponentTick",
+                                 EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext |
+                                     EAutomationTestFlags::ProductFilter)
+
+bool FRfsnLookAtFollowTest::RunTest(const FString& Parameters)
+{
+	using namespace RfsnBench;
+	using namespace RfsnLookAtTests;
+
+	FLookAtScenario Scenario;
+	Scenario.Build(NpcCount);
+	FRfsnLookAtSolver& Solver = Scenario.Solver;
+
+	// Ten seconds of following the player
+	constexpr int32 Frames = 600;
+	int32 Samples = 0;
+	int32 TurnMismatches = 0;
+	int32 ClampErrors = 0;
+	float MaxYawError = 0.0f;
+	float MaxAngleError = 0.0f;
+	TArray<float> LegacyAngles;
+	for (int32 Frame = 0; Frame < Frames; Frame++)
+	{
+		const FVector Eyes = LookAtPlayerEyes(Frame);
+		LegacyAngles.Reset();
+		for (int32 i = 0; i < NpcCount; i++)
+		{
+			Scenario.Legacy[i].LookAtTarget = Eyes;
+			Solver.SetTarget(i, Eyes);
+			LegacyAngles.Add(Scenario.Legacy[i].GetAngleToTarget());
+		}
+
+		Solver.Solve(LookAtFrameTime);
+		for (int32 i = 0; i < NpcCount; i++)
+		{
+			FLegacyLookAt& Npc = Scenario.Legacy[i];
+			const bool bTurned = Npc.Tick(LookAtFrameTime);
+			Samples++;
+			MaxAngleError = FMath::Max(MaxAngleError, FMath::Abs(Solver.GetAngleToTarget(i) - LegacyAngles[i]));
+			ClampErrors += FMath::Abs(Solver.GetHeadYaw(i)) <= Npc.HeadOnlyAngle + UE_KINDA_SMALL_NUMBER &&
+			                       FMath::Abs(Solver.GetHeadPitch(i)) <= 30.0f + UE_KINDA_SMALL_NUMBER
+			                   ? 0
+			                   : 1;
+
+			// A target sitting exactly on HeadOnlyAngle may land either side in float; resync and count it
+			if (bTurned != Solver.IsTurningBody(i))
+			{
+				TurnMismatches++;
+				Solver.SetPose(i, Npc.Location, Npc.Rotation.Yaw);
+				continue;
+			}
+			MaxYawError = FMath::Max(MaxYawError, YawError(Solver.GetBodyYaw(i), Npc.Rotation.Yaw));
+		}
+	}
+	TestTrue(TEXT("Body yaw matches the old tick"), MaxYawError < 0.01f);
+	TestTrue(TEXT("Angle to target matches"), MaxAngleError < 0.1f);
+	TestTrue(TEXT("Turn decisions match"), TurnMismatches <= Samples / 1000);
+	TestEqual(TEXT("Head aims outside its limits"), ClampErrors, 0);
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRfsnLookAtConvergeTest, "Rfsn.LookAt.HeadConverges",
+                                 EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext |
+                                     EAutomationTestFlags::ProductFilter)
+
+bool FRfsnLookAtConvergeTest::RunTest(const FString& Parameters)
+{
+	// A still target the head alone can reach: the head lands on it and the body stays put
+	FRfsnLookAtSolver Single;
+	Single.Add(FRfsnLookAtParams());
+	const FVector Origin(0.0f, 0.0f, 0.0f);
+	const float HeadTurn = FMath::DegreesToRadians(30.0f);
+	const FVector Target(400.0f * FMath::Cos(HeadTurn), 400.0f * FMath::Sin(HeadTurn), 80.0f);
+	const float TargetPitch = FMath::RadiansToDegrees(FMath::Atan2(80.0f, 400.0f));
+	Single.SetPose(0, Origin, 0.0f);
+	Single.SetTarget(0, Target);
+	for (int32 Frame = 0; Frame < 120; Frame++)
+	{
+		Single.Solve(RfsnBench::LookAtFrameTime);
+	}
+	TestFalse(TEXT("Body not turning"), Single.IsTurningBody(0));
+	TestEqual(TEXT("Body yaw"), Single.GetBodyYaw(0), 0.0f);
+	TestEqual(TEXT("Head yaw"), Single.GetHeadYaw(0), 30.0f, 0.1f);
+	TestEqual(TEXT("Head pitch"), Single.GetHeadPitch(0), TargetPitch, 0.1f);
+
+	// Straight overhead there is no yaw to turn to
+	Single.SetTarget(0, Origin + FVector(0.0f, 0.0f, 500.0f));
+	Single.Solve(RfsnBench::LookAtFrameTime);
+	TestEqual(TEXT("Overhead angle"), Single.GetAngleToTarget(0), 90.0f);
+	TestEqual(TEXT("Overhead body yaw"), Single.GetBodyYaw(0), 0.0f);
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRfsnLookAtParallelTest, "Rfsn.LookAt.ParallelEqualsSerial",
+                                 EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext |
+                                     EAutomationTestFlags::ProductFilter)
+
+bool FRfsnLookAtParallelTest::RunTest(const FString& Parameters)
+{
+	using namespace RfsnBench;
+	using namespace RfsnLookAtTests;
+
+	FLookAtScenario Scenario;
+	Scenario.Build(NpcCount);
+	FRfsnLookAtSolver Serial = Scenario.Solver;
+	FRfsnLookAtSolver Parallel = Scenario.Solver;
+	for (int32 Frame = 0; Frame < 60; Frame++)
+	{
+		const FVector Eyes = LookAtPlayerEyes(Frame);
+		for (int32 i = 0; i < NpcCount; i++)
+		{
+			Serial.SetTarget(i, Eyes);
+			Parallel.SetTarget(i, Eyes);
+		}
+		Serial.Solve(LookAtFrameTime);
+		Parallel.Solve(LookAtFrameTime, true, 16);
+	}
+
+	int32 ParallelErrors = 0;
+	for (int32 i = 0; i < NpcCount; i++)
+	{
+		ParallelErrors += Serial.GetBodyYaw(i) == Parallel.GetBodyYaw(i) &&
+		                          Serial.GetHeadYaw(i) == Parallel.GetHeadYaw(i) &&
+		                          Serial.GetHeadPitch(i) == Parallel.GetHeadPitch(i)
+		                      ? 0
+		                      : 1;
+	}
+	TestEqual(TEXT("NPCs solved differently in parallel"), ParallelErrors, 0);
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRfsnLookAtSleepTest, "Rfsn.LookAt.SettleAndRemove",
+                                 EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext |
+                                     EAutomationTestFlags::ProductFilter)
+
+bool FRfsnLookAtSleepTest::RunTest(const FString& Parameters)
+{
+	using namespace RfsnBench;
+	using namespace RfsnLookAtTests;
+
+	FLookAtScenario Scenario;
+	Scenario.Build(NpcCount);
+	FRfsnLookAtSolver& Solver = Scenario.Solver;
+	for (int32 Frame = 0; Frame < 60; Frame++)
+	{
+		const FVector Eyes = LookAtPlayerEyes(Frame);
+		for (int32 i = 0; i < NpcCount; i++)
+		{
+			Solver.SetTarget(i, Eyes);
+		}
+		Solver.Solve(LookAtFrameTime);
+	}
+
+	// Clearing targets: every head returns to centre and its entry sleeps within two seconds
+	for (int32 i = 0; i < NpcCount; i++)
+	{
+		Solver.ClearTarget(i);
+	}
+	int32 Awake = NpcCount;
+	for (int32 Frame = 0; Frame < 120 && Awake > 0; Frame++)
+	{
+		Solver.Solve(LookAtFrameTime);
+		Awake = 0;
+		for (int32 i = 0; i < NpcCount; i++)
+		{
+			Awake += Solver.IsSettled(i) ? 0 : 1;
+		}
+	}
+	TestEqual(TEXT("Heads still awake"), Awake, 0);
+
+	// Removing swaps the last entry in untouched
+	const int32 Last = NpcCount - 1;
+	const float LastYaw = Solver.GetBodyYaw(Last);
+	const float LastHead = Solver.GetHeadYaw(Last);
+	const bool bLastSettled = Solver.IsSettled(Last);
+	TestEqual(TEXT("Moved entry"), Solver.RemoveAtSwap(0), Last);
+	TestEqual(TEXT("Entries"), Solver.Num(), Last);
+	TestEqual(TEXT("Moved body yaw"), Solver.GetBodyYaw(0), LastYaw);
+	TestEqual(TEXT("Moved head yaw"), Solver.GetHeadYaw(0), LastHead);
+	TestEqual(TEXT("Moved sleep state"), Solver.IsSettled(0), bLastSettled);
+	TestEqual(TEXT("Removing the last moves nothing"), Solver.RemoveAtSwap(Solver.Num() - 1), INDEX_NONE);
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRfsnLookAtDisabledTest, "Rfsn.LookAt.DisabledSleeps",
+                                 EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext |
+                                     EAutomationTestFlags::ProductFilter)
+
+bool FRfsnLookAtDisabledTest::RunTest(const FString& Parameters)
+{
+	using namespace RfsnBench;
+
+	FRfsnTestWorld World;
+	URfsnNpcLookAt* LookAt = World.AddComponent<URfsnNpcLookAt>(World.SpawnActor(FVector::ZeroVector));
+	World.BeginPlay();
+	URfsnLookAtManager* Manager = World.GetSubsystem<URfsnLookAtManager>();
+	if (!TestNotNull(TEXT("Look-at manager"), Manager))
+	{
+		return false;
+	}
+
+	const FVector Target(1000.0f, 1000.0f, 0.0f);
+	LookAt->LookAtLocation(Target);
+	Manager->Tick(LookAtFrameTime);
+	TestEqual(TEXT("Awake while turning"), Manager->GetNumAwake(), 1);
+
+	// Disabled mid-turn: the next tick drops the target and frees the solver slot
+	LookAt->bEnabled = false;
+	Manager->Tick(LookAtFrameTime);
+	TestEqual(TEXT("Awake after disabling"), Manager->GetNumAwake(), 0);
+	TestEqual(TEXT("Disabled NPC still has a target"), LookAt->GetAngleToTarget(), 0.0f);
+
+	LookAt->bEnabled = true;
+	LookAt->LookAtLocation(Target);
+	TestEqual(TEXT("A new target wakes it"), Manager->GetNumAwake(), 1);
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,40 @@
+// RFSN Needs Fixtures Implementation
+
+#include "RfsnNeedsFixtures.h"
+#include "Algo/Sort.h"
+
+namespace RfsnBench
+{
+void MakeNeedsWorkload(int32 NpcCount, TArray<FLegacyNeeds>& OutNpcs, TArray<FNeedsEvent>& OutEvents)
+{
+	// Time scales keep one legacy update per tick, so both models sample the same instants
+	constexpr float TimeScales[] = {60.0f, 90.0f, 120.0f};
+
+	FRandomStream Stream(2468);
+	OutNpcs.SetNum(NpcCount);
+	OutEvents.Reset();
+	for (int32 i = 0; i < NpcCount; i++)
+	{
+		FLegacyNeeds& Npc = OutNpcs[i];
+		for (FRfsnNeed& Need : Npc.Needs)
+		{
+			Need.Value = Stream.FRandRange(20.0f, 100.0f);
+			Need.DecayRate = Stream.FRandRange(0.5f, 8.0f);
+		}
+		Npc.TimeScale = TimeScales[Stream.RandRange(0, static_cast<int32>(UE_ARRAY_COUNT(TimeScales)) - 1)];
+		Npc.State = URfsnNpcNeeds::CalculateState(Npc.Needs);
+		for (const int32 Need : {RfsnNeeds::Hunger, RfsnNeeds::Energy, RfsnNeeds::Social})
+		{
+			Npc.bCritical[Need] = Npc.Needs[Need].IsCritical();
+		}
+
+		for (int32 Second = Stream.RandRange(30, 600); Second < NeedsSeconds; Second += Stream.RandRange(60, 900))
+		{
+			const int32 Need = Stream.RandRange(0, RfsnNeeds::Num - 1);
+			const float Delta = Need == RfsnNeeds::Safety ? -30.0f : Stream.FRandRange(20.0f, 60.0f);
+			OutEvents.Add({Second, i, Need, Delta});
+		}
+	}
+	Algo::SortBy(OutEvents, &FNeedsEvent::Second);
+}
+} // namespace RfsnBench
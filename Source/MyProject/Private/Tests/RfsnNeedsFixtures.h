@@ -0,0 +1,62 @@
+// RFSN Needs Fixtures
+// URfsnNpcNeeds as it ticked once a second before the needs manager simulated it lazily
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "RfsnNpcNeeds.h"
+
+namespace RfsnBench
+{
+/** Real seconds simulated by the needs run, and its frame rate */
+constexpr int32 NeedsSeconds = 3600;
+constexpr int32 NeedsFramesPerSecond = 10;
+
+/** URfsnNpcNeeds as it ticked before the needs manager: once a second, decaying in game-minute chunks */
+struct FLegacyNeeds
+{
+	FRfsnNeed Needs[RfsnNeeds::Num];
+	float TimeScale = 60.0f;
+	float TimeAccumulator = 0.0f;
+	ERfsnNeedState State = ERfsnNeedState::Content;
+	bool bCritical[RfsnNeeds::Num] = {};
+
+	/** TickComponent + UpdateNeeds; returns the number of needs that became critical */
+	int32 Tick(float DeltaTime)
+	{
+		TimeAccumulator += DeltaTime * TimeScale;
+		if (TimeAccumulator / 60.0f < 1.0f)
+		{
+			return 0;
+		}
+
+		const float GameHours = TimeAccumulator / 3600.0f;
+		TimeAccumulator = 0.0f;
+		for (FRfsnNeed& Need : Needs)
+		{
+			Need.Decay(GameHours);
+		}
+
+		int32 NewlyCritical = 0;
+		for (const int32 Need : {RfsnNeeds::Hunger, RfsnNeeds::Energy, RfsnNeeds::Social})
+		{
+			NewlyCritical += Needs[Need].IsCritical() && !bCritical[Need] ? 1 : 0;
+			bCritical[Need] = Needs[Need].IsCritical();
+		}
+		State = URfsnNpcNeeds::CalculateState(Needs);
+		return NewlyCritical;
+	}
+};
+
+/** Scripted need change (Feed, Rest, FeelThreatened, ...) applied to both models */
+struct FNeedsEvent
+{
+	int32 Second;
+	int32 Npc;
+	int32 Need;
+	float Delta;
+};
+
+/** NpcCount NPCs with random needs and time scales, and their scripted changes over NeedsSeconds, in order */
+void MakeNeedsWorkload(int32 NpcCount, TArray<FLegacyNeeds>& OutNpcs, TArray<FNeedsEvent>& OutEvents);
+} // namespace RfsnBench
@@ -0,0 +1,192 @@
+// RFSN Needs Tests
+// The lazy needs simulation against the 1 Hz tick model it replaced, and the component's reads and edits
+
+#include "RfsnNeedsFixtures.h"
+#include "RfsnNeedsManager.h"
+#include "RfsnNpcNeeds.h"
+#include "RfsnTestWorld.h"
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace RfsnNeedsTests
+{
+constexpr int32 NpcCount = 300;
+} // namespace RfsnNeedsTests
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRfsnNeedsTickModelTest, "Rfsn.Needs.MatchesTickModel",
+                                 EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext |
+                                     EAutomationTestFlags::ProductFilter)
+
+bool FRfsnNeedsTickModelTest::RunTest(const FString& Parameters)
+{
+	using namespace RfsnBench;
+	using namespace RfsnNeedsTests;
+
+	TArray<FLegacyNeeds> Legacy;
+	TArray<FNeedsEvent> Events;
+	MakeNeedsWorkload(NpcCount, Legacy, Events);
+
+	// What URfsnNpcNeeds does on a threshold callback or after a change
+	FRfsnNeedsSimulation Simulation;
+	TArray<ERfsnNeedState> States;
+	TArray<bool> Critical;
+	States.SetNum(NpcCount);
+	Critical.Init(false, NpcCount * RfsnNeeds::Num);
+	int64 CriticalEntries = 0;
+	auto Evaluate = [&](int32 Npc, double Now)
+	{
+		FRfsnNeed Needs[RfsnNeeds::Num];
+		for (int32 Need = 0; Need < RfsnNeeds::Num; Need++)
+		{
+			Needs[Need] = Legacy[Npc].Needs[Need];
+			Needs[Need].Value = Simulation.GetValue(Npc, Need, Now);
+		}
+		for (const int32 Need : {RfsnNeeds::Hunger, RfsnNeeds::Energy, RfsnNeeds::Social})
+		{
+			bool& bWasCritical = Critical[Npc * RfsnNeeds::Num + Need];
+			CriticalEntries += Needs[Need].IsCritical() && !bWasCritical ? 1 : 0;
+			bWasCritical = Needs[Need].IsCritical();
+		}
+		States[Npc] = URfsnNpcNeeds::CalculateState(Needs);
+	};
+
+	for (int32 i = 0; i < NpcCount; i++)
+	{
+		Simulation.Add(Legacy[i].Needs, Legacy[i].TimeScale / 3600.0, 0.0);
+		Evaluate(i, 0.0);
+	}
+	CriticalEntries = 0;
+
+	TArray<ERfsnNeedState> PrevStates = States;
+	TArray<ERfsnNeedState> PrevLegacyStates;
+	for (const FLegacyNeeds& Npc : Legacy)
+	{
+		PrevLegacyStates.Add(Npc.State);
+	}
+
+	int64 LegacyCriticalEntries = 0;
+	int64 StateChanges = 0;
+	int64 LegacyStateChanges = 0;
+	int32 StateMismatches = 0;
+	float MaxValueError = 0.0f;
+	int32 NextEvent = 0;
+	TArray<int32> Due;
+
+	for (int32 Second = 1; Second <= NeedsSeconds; Second++)
+	{
+		// Scripted changes land between ticks; the simulation re-evaluates at once, legacy on its next tick
+		for (; NextEvent < Events.Num() && Events[NextEvent].Second == Second; NextEvent++)
+		{
+			const FNeedsEvent& Event = Events[NextEvent];
+			Legacy[Event.Npc].Needs[Event.Need].Satisfy(Event.Delta);
+			Simulation.Adjust(Event.Npc, Event.Need, Event.Delta, Second - 1);
+			Evaluate(Event.Npc, Second - 1);
+		}
+
+		for (int32 Frame = 1; Frame <= NeedsFramesPerSecond; Frame++)
+		{
+			const double Now = Second - 1 + static_cast<double>(Frame) / NeedsFramesPerSecond;
+			Due.Reset();
+			Simulation.PopDue(Now, Due);
+			for (const int32 Npc : Due)
+			{
+				Simulation.ScheduleNext(Npc, Now);
+				Evaluate(Npc, Now);
+			}
+		}
+
+		for (FLegacyNeeds& Npc : Legacy)
+		{
+			LegacyCriticalEntries += Npc.Tick(1.0f);
+		}
+
+		// Same values; same state, allowing either model to see a crossing one tick before the other (two
+		// crossings inside one tick are a single change for the tick model, so change counts are only reported)
+		for (int32 i = 0; i < NpcCount; i++)
+		{
+			for (int32 Need = 0; Need < RfsnNeeds::Num; Need++)
+			{
+				const float Error = FMath::Abs(Legacy[i].Needs[Need].Value - Simulation.GetValue(i, Need, Second));
+				MaxValueError = FMath::Max(MaxValueError, Error);
+			}
+
+			const ERfsnNeedState Expected = Legacy[i].State;
+			if (Expected != States[i] && Expected != PrevStates[i] && States[i] != PrevLegacyStates[i])
+			{
+				StateMismatches++;
+			}
+			StateChanges += States[i] != PrevStates[i] ? 1 : 0;
+			LegacyStateChanges += Expected != PrevLegacyStates[i] ? 1 : 0;
+			PrevStates[i] = States[i];
+			PrevLegacyStates[i] = Expected;
+		}
+	}
+
+	AddInfo(FString::Printf(TEXT("%d NPCs, %d scripted changes: %lld state changes (tick model %lld), %lld critical "
+	                             "entries (tick model %lld), max value error %.4f"),
+	                        NpcCount, Events.Num(), StateChanges, LegacyStateChanges, CriticalEntries,
+	                        LegacyCriticalEntries, MaxValueError));
+
+	TestTrue(TEXT("Workload changes state"), LegacyStateChanges > 0);
+	TestTrue(TEXT("Workload reaches critical needs"), LegacyCriticalEntries > 0);
+	TestTrue(TEXT("Values match the tick model"), MaxValueError < 0.01f);
+	TestEqual(TEXT("States that differ from the tick model"), StateMismatches, 0);
+	TestEqual(TEXT("Needs that became critical"), CriticalEntries, LegacyCriticalEntries);
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRfsnNeedsComponentTest, "Rfsn.Needs.ComponentReadsAndEdits",
+                                 EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext |
+                                     EAutomationTestFlags::ProductFilter)
+
+bool FRfsnNeedsComponentTest::RunTest(const FString& Parameters)
+{
+	FRfsnTestWorld World;
+	AActor* Npc = World.SpawnActor(FVector::ZeroVector);
+	URfsnNpcNeeds* Needs = World.AddComponent<URfsnNpcNeeds>(Npc);
+	World.BeginPlay();
+
+	const URfsnNeedsManager* Manager = World.GetSubsystem<URfsnNeedsManager>();
+	if (!TestNotNull(TEXT("Needs manager"), Manager) ||
+	    !TestEqual(TEXT("Component registered"), Manager->GetNumRegistered(), 1))
+	{
+		return false;
+	}
+
+	// A game hour (a real minute at the default time scale) passes without crossing a threshold
+	for (int32 Frame = 0; Frame < 600; Frame++)
+	{
+		World.Tick(0.1f);
+	}
+	TestEqual(TEXT("Property keeps the last evaluated value"), Needs->Hunger.Value, 100.0f);
+	TestEqual(TEXT("Wellbeing property keeps the last evaluated value"), Needs->OverallWellbeing, 100.0f);
+	TestEqual(TEXT("GetNeedValue is current"), Needs->GetNeedValue(TEXT("Hunger")), 96.0f, 0.1f);
+	TestTrue(TEXT("GetOverallWellbeing is current"), Needs->GetOverallWellbeing() < 100.0f);
+
+	// A Blueprint write to a need property reaches the simulation on RefreshNeeds
+	Needs->Hunger.Value = 10.0f;
+	Needs->Energy.DecayRate = 0.0f;
+	Needs->RefreshNeeds();
+	TestEqual(TEXT("Written value is simulated"), Needs->GetNeedValue(TEXT("Hunger")), 10.0f, 0.01f);
+	TestTrue(TEXT("Written value is critical"), Needs->HasCriticalNeed());
+	TestTrue(TEXT("Written value sets the state"), Needs->CurrentState == ERfsnNeedState::Hungry);
+
+	const float Energy = Needs->GetNeedValue(TEXT("Energy"));
+	TestTrue(TEXT("Writing the decay rate keeps the simulated value"), Energy < 100.0f);
+	for (int32 Frame = 0; Frame < 100; Frame++)
+	{
+		World.Tick(0.1f);
+	}
+	TestEqual(TEXT("Written decay rate is simulated"), Needs->GetNeedValue(TEXT("Energy")), Energy, 0.001f);
+
+	// Changes through the API apply to the written value, not the stale simulated one
+	Needs->Hunger.Value = 40.0f;
+	Needs->Feed(20.0f);
+	TestEqual(TEXT("Feed adds to the written value"), Needs->GetNeedValue(TEXT("Hunger")), 60.0f, 0.01f);
+	TestEqual(TEXT("Property refreshed by the change"), Needs->Hunger.Value, Needs->GetNeedValue(TEXT("Hunger")),
+	          0.01f);
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,73 @@
+// RFSN Proximity Fixtures Implementation
+
+#include "RfsnProximityFixtures.h"
+#include "RfsnBenchFixtures.h"
+
+namespace RfsnBench
+{
+void FProximityWalk::Build(int32 NpcCount)
+{
+	const float Half = PerceptionArea * 0.5f;
+	Stream.Initialize(2468);
+	NpcLocations.SetNumUninitialized(NpcCount);
+	for (int32 i = 0; i < NpcCount; i++)
+	{
+		NpcLocations[i] = FVector(Stream.FRandRange(-Half, Half), Stream.FRandRange(-Half, Half), 0.0f);
+		for (const float Radius : ProximityRadii)
+		{
+			Zones.Add(Tracker.AddZone(NpcLocations[i], Radius));
+			Radii.Add(Radius);
+		}
+	}
+	Player = FVector(-Half, 0.0f, 0.0f);
+	Heading = FVector(1.0f, 0.0f, 0.0f);
+}
+
+bool FProximityWalk::Advance(int32 Step)
+{
+	const float Half = PerceptionArea * 0.5f;
+	const float NpcStep = 100.0f;
+	const float PlayerStep = 60.0f;
+
+	const float Yaw = Stream.FRandRange(-0.3f, 0.3f);
+	Heading = FVector(Heading.X * FMath::Cos(Yaw) - Heading.Y * FMath::Sin(Yaw),
+	                  Heading.X * FMath::Sin(Yaw) + Heading.Y * FMath::Cos(Yaw), 0.0f);
+	Player += Heading * PlayerStep;
+	Player.X = FMath::Clamp(Player.X, -Half, Half);
+	Player.Y = FMath::Clamp(Player.Y, -Half, Half);
+
+	if (Step % 5 != 0)
+	{
+		return false;
+	}
+	for (FVector& Location : NpcLocations)
+	{
+		Location += FVector(Stream.FRandRange(-NpcStep, NpcStep), Stream.FRandRange(-NpcStep, NpcStep), 0.0f);
+	}
+	return true;
+}
+
+void FProximityWalk::RefreshZones()
+{
+	const int32 NumRadii = UE_ARRAY_COUNT(ProximityRadii);
+	for (int32 z = 0; z < Zones.Num(); z++)
+	{
+		Tracker.SetZoneLocation(Zones[z], NpcLocations[z / NumRadii]);
+	}
+}
+
+void FProximityWalk::PollZones(TArray<bool>& Inside) const
+{
+	const int32 NumRadii = UE_ARRAY_COUNT(ProximityRadii);
+	Inside.SetNumZeroed(Zones.Num());
+	for (int32 z = 0; z < Zones.Num(); z++)
+	{
+		const float DistSq = FVector::DistSquared(NpcLocations[z / NumRadii], Player);
+		const float ExitRadius = Radii[z] + Tracker.Hysteresis;
+		if (Inside[z] ? DistSq > ExitRadius * ExitRadius : DistSq <= Radii[z] * Radii[z])
+		{
+			Inside[z] = !Inside[z];
+		}
+	}
+}
+} // namespace RfsnBench
@@ -0,0 +1,44 @@
+// RFSN Proximity Fixtures
+// The player walking through NPCs with proximity zones, and the per-zone polling rule it replaced
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "RfsnProximityManager.h"
+
+namespace RfsnBench
+{
+/** Player path length for the proximity run (10 Hz evaluation, one minute) */
+constexpr int32 ProximitySteps = 600;
+
+/** Component default radii per NPC: dialogue trigger, ambient chatter, barks */
+constexpr float ProximityRadii[] = {300.0f, 500.0f, 500.0f};
+
+/** NPCs scattered over the perception area with a tracker zone per default radius, and the player wandering
+ *  through them */
+struct FProximityWalk
+{
+	FRfsnProximityTracker Tracker;
+	TArray<FVector> NpcLocations;
+	TArray<int32> Zones;
+	TArray<float> Radii;
+	FVector Player = FVector::ZeroVector;
+
+	void Build(int32 NpcCount);
+
+	/** Move the player one step; true on the steps the NPCs shuffled too (every half second) */
+	bool Advance(int32 Step);
+
+	/** Move the tracker's zones to the NPCs, as the manager does when it re-reads them */
+	void RefreshZones();
+
+	/** The per-zone polling rule: every zone checked against the player with the tracker's hysteresis */
+	void PollZones(TArray<bool>& Inside) const;
+
+	int32 NumZones() const { return Zones.Num(); }
+
+private:
+	FRandomStream Stream;
+	FVector Heading = FVector::ZeroVector;
+};
+} // namespace RfsnBench
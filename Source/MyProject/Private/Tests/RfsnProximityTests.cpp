@@ -0,0 +1,106 @@
+// RFSN Proximity Tests
+// Enter/exit events from the proximity tracker against polling every zone every step
+
+#include "RfsnProximityFixtures.h"
+#include "RfsnProximityManager.h"
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace RfsnProximityTests
+{
+constexpr int32 NpcCount = 200;
+} // namespace RfsnProximityTests
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRfsnProximityPollingTest, "Rfsn.Proximity.MatchesPolling",
+                                 EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext |
+                                     EAutomationTestFlags::ProductFilter)
+
+bool FRfsnProximityPollingTest::RunTest(const FString& Parameters)
+{
+	using namespace RfsnBench;
+	using namespace RfsnProximityTests;
+
+	FProximityWalk Walk;
+	Walk.Build(NpcCount);
+
+	TArray<bool> PolledInside;
+	TArray<bool> WasInside;
+	WasInside.Init(false, Walk.NumZones());
+	TArray<FRfsnProximityEvent> Events;
+	int32 Transitions = 0;
+	int32 Mismatches = 0;
+	int32 BadEvents = 0;
+
+	for (int32 Step = 0; Step < ProximitySteps; Step++)
+	{
+		if (Walk.Advance(Step))
+		{
+			Walk.RefreshZones();
+		}
+		Walk.PollZones(PolledInside);
+
+		Events.Reset();
+		Walk.Tracker.Update(Walk.Player, Events);
+		Transitions += Events.Num();
+
+		// Every event reports a real change of state, and every changed zone has its event
+		TSet<int32> Changed;
+		for (const FRfsnProximityEvent& Event : Events)
+		{
+			const int32 z = Walk.Zones.IndexOfByKey(Event.Zone);
+			BadEvents += z != INDEX_NONE && !Changed.Contains(z) && Event.bEntered != WasInside[z] ? 0 : 1;
+			Changed.Add(z);
+		}
+		for (int32 z = 0; z < Walk.NumZones(); z++)
+		{
+			const bool bInside = Walk.Tracker.IsInside(Walk.Zones[z]);
+			Mismatches += bInside != PolledInside[z] ? 1 : 0;
+			BadEvents += bInside != WasInside[z] && !Changed.Contains(z) ? 1 : 0;
+			WasInside[z] = bInside;
+		}
+	}
+
+	TestTrue(TEXT("The walk crosses zones"), Transitions > 0);
+	TestEqual(TEXT("Zone states differing from polling"), Mismatches, 0);
+	TestEqual(TEXT("Events without a change, or changes without an event"), BadEvents, 0);
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRfsnProximityHysteresisTest, "Rfsn.Proximity.Hysteresis",
+                                 EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext |
+                                     EAutomationTestFlags::ProductFilter)
+
+bool FRfsnProximityHysteresisTest::RunTest(const FString& Parameters)
+{
+	FRfsnProximityTracker Tracker;
+	const int32 Zone = Tracker.AddZone(FVector::ZeroVector, 300.0f);
+	TArray<FRfsnProximityEvent> Events;
+
+	Tracker.Update(FVector(400.0f, 0.0f, 0.0f), Events);
+	TestEqual(TEXT("Outside the radius"), Events.Num(), 0);
+
+	Tracker.Update(FVector(300.0f, 0.0f, 0.0f), Events);
+	TestEqual(TEXT("Entered on the radius"), Events.Num(), 1);
+	TestTrue(TEXT("Entered"), Events.Num() == 1 && Events[0].Zone == Zone && Events[0].bEntered);
+
+	// Standing on the edge doesn't flicker
+	Events.Reset();
+	Tracker.Update(FVector(300.0f + Tracker.Hysteresis, 0.0f, 0.0f), Events);
+	TestEqual(TEXT("Still inside within the hysteresis"), Events.Num(), 0);
+	TestTrue(TEXT("Inside"), Tracker.IsInside(Zone));
+
+	Tracker.Update(FVector(301.0f + Tracker.Hysteresis, 0.0f, 0.0f), Events);
+	TestTrue(TEXT("Exited past the hysteresis"), Events.Num() == 1 && !Events[0].bEntered);
+
+	// A departing player exits every zone once
+	Events.Reset();
+	Tracker.Update(FVector::ZeroVector, Events);
+	Events.Reset();
+	Tracker.ExitAll(Events);
+	TestTrue(TEXT("Exited on ExitAll"), Events.Num() == 1 && !Events[0].bEntered);
+	TestFalse(TEXT("Nothing inside"), Tracker.IsInside(Zone));
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,110 @@
+// RFSN Quest Topics Fixtures Implementation
+
+#include "RfsnQuestTopicsFixtures.h"
+
+namespace RfsnBench
+{
+const TCHAR* const QuestAdjectives[] = {TEXT("Lost"),    TEXT("Silent"),    TEXT("Burning"), TEXT("Hidden"),
+                                        TEXT("Broken"),  TEXT("Crimson"),   TEXT("Forgotten"), TEXT("Hollow"),
+                                        TEXT("Sunken"),  TEXT("Iron")};
+const TCHAR* const QuestNouns[] = {TEXT("Amulet"), TEXT("Lighthouse"), TEXT("Harvest"), TEXT("Crown"), TEXT("Bridge"),
+                                   TEXT("Shrine"), TEXT("Letter"),     TEXT("Orchard"), TEXT("Mine"),  TEXT("Lantern")};
+const TCHAR* const QuestPlaces[] = {TEXT("Saltmarsh"), TEXT("Ashford"), TEXT("Greywater"), TEXT("the North Cove"),
+                                    TEXT("the Old Quarry")};
+
+TArray<FRfsnQuest> MakeQuests(int32 QuestCount)
+{
+	TArray<FRfsnQuest> Quests;
+	Quests.SetNum(QuestCount);
+	for (int32 i = 0; i < QuestCount; i++)
+	{
+		FRfsnQuest& Quest = Quests[i];
+		const int32 Noun = i % 10;
+		Quest.QuestId = FString::Printf(TEXT("q_%s_%04d"), *FString(QuestNouns[Noun]).ToLower(), i);
+		Quest.DisplayName = FString::Printf(TEXT("The %s %s of %s"), QuestAdjectives[i / 10 % 10], QuestNouns[Noun],
+		                                    QuestPlaces[i / 100 % 5]);
+		if (i >= 500)
+		{
+			Quest.DisplayName += FString::Printf(TEXT(" %d"), i / 500 + 1);
+		}
+		Quest.Description = FString::Printf(TEXT("Description of %s"), *Quest.DisplayName);
+		Quest.Status = i % 11 == 0 ? ERfsnQuestStatus::Completed
+		               : i % 7 == 0 ? ERfsnQuestStatus::Active
+		                            : ERfsnQuestStatus::Available;
+		for (int32 k = 0; k <= i % 3; k++)
+		{
+			FRfsnQuestObjective& Obj = Quest.Objectives.AddDefaulted_GetRef();
+			Obj.ObjectiveId = FString::Printf(TEXT("step%d"), k);
+			Obj.RequiredProgress = 3;
+			Obj.bOptional = k == 2;
+		}
+	}
+	return Quests;
+}
+
+TArray<FRfsnNpcQuestKnowledge> MakeQuestKnowledge(int32 Count)
+{
+	TArray<FRfsnNpcQuestKnowledge> Knowledge;
+	Knowledge.SetNum(Count);
+	for (int32 i = 0; i < Count; i++)
+	{
+		Knowledge[i].QuestId = FString::Printf(TEXT("rumor_%04d"), i);
+		Knowledge[i].bCanProvideInfo = i % 2 == 0;
+		Knowledge[i].DialogueHint = FString::Printf(TEXT("Heard something about rumour %d"), i);
+	}
+	return Knowledge;
+}
+
+TArray<FString> MakePlayerLines(const TArray<FRfsnQuest>& Quests, int32 Count)
+{
+	static const TCHAR* Fillers[] = {TEXT("hello there"), TEXT("the weather is nice"), TEXT("I saw wolves"),
+	                                 TEXT("tell me about"), TEXT("what news of"),      TEXT("anything new in"),
+	                                 TEXT("my sword is dull"), TEXT("have you heard of")};
+	static const TCHAR* Keywords[] = {TEXT("any work? a JOB maybe"), TEXT("I need coin"), TEXT("I'm looking for"),
+	                                  TEXT("Can I help"), TEXT("retrieved it")};
+
+	FRandomStream Stream(24680);
+	TArray<FString> Lines;
+	Lines.Reserve(Count);
+	for (int32 i = 0; i < Count; i++)
+	{
+		FString Line = Fillers[Stream.RandRange(0, UE_ARRAY_COUNT(Fillers) - 1)];
+		if (Stream.FRand() < 0.3f)
+		{
+			Line += TEXT(" ");
+			Line += Keywords[Stream.RandRange(0, UE_ARRAY_COUNT(Keywords) - 1)];
+		}
+
+		const int32 Mentions = Stream.RandRange(0, 2);
+		for (int32 m = 0; m < Mentions; m++)
+		{
+			const FRfsnQuest& Quest = Quests[Stream.RandRange(0, Quests.Num() - 1)];
+			const float Kind = Stream.FRand();
+			FString Mention = Kind < 0.5f   ? Quest.DisplayName
+			                  : Kind < 0.7f ? Quest.QuestId
+			                                : Quest.DisplayName.Left(Quest.DisplayName.Len() - 2);
+			Line += TEXT(" ");
+			Line += Stream.FRand() < 0.3f ? Mention.ToUpper() : Mention;
+		}
+		Lines.Add(Line);
+	}
+	return Lines;
+}
+
+TArray<FString> MakeQuestLookupIds(const URfsnQuestIntegration& Quests)
+{
+	TArray<FString> Ids;
+	for (const FRfsnQuest& Quest : Quests.OfferedQuests)
+	{
+		Ids.Add(Quest.QuestId);
+		Ids.Add(Quest.QuestId.ToUpper());
+	}
+	for (const FRfsnNpcQuestKnowledge& Knowledge : Quests.QuestKnowledge)
+	{
+		Ids.Add(Knowledge.QuestId);
+	}
+	Ids.Add(TEXT("q_unknown_9999"));
+	Ids.Add(FString());
+	return Ids;
+}
+} // namespace RfsnBench
@@ -0,0 +1,135 @@
+// RFSN Quest Topics Fixtures
+// URfsnQuestIntegration's linear scans before the quest index, and synthetic quests and player lines
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "RfsnQuestIntegration.h"
+
+namespace RfsnBench
+{
+/** URfsnQuestIntegration's old linear scans over the same arrays */
+struct FLegacyQuests
+{
+	const TArray<FRfsnQuest>& OfferedQuests;
+	const TArray<FRfsnNpcQuestKnowledge>& QuestKnowledge;
+
+	const FRfsnQuest* FindQuest(const FString& QuestId) const
+	{
+		return OfferedQuests.FindByPredicate([&QuestId](const FRfsnQuest& Quest)
+		                                     { return Quest.QuestId.Equals(QuestId, ESearchCase::IgnoreCase); });
+	}
+
+	const FRfsnNpcQuestKnowledge* FindQuestKnowledge(const FString& QuestId) const
+	{
+		return QuestKnowledge.FindByPredicate([&QuestId](const FRfsnNpcQuestKnowledge& Knowledge)
+		                                      { return Knowledge.QuestId.Equals(QuestId, ESearchCase::IgnoreCase); });
+	}
+
+	FString GetQuestInfo(const FString& QuestId) const
+	{
+		if (const FRfsnQuest* Quest = FindQuest(QuestId))
+		{
+			return Quest->Description;
+		}
+		const FRfsnNpcQuestKnowledge* Knowledge = FindQuestKnowledge(QuestId);
+		return Knowledge && Knowledge->bCanProvideInfo ? Knowledge->DialogueHint : FString();
+	}
+
+	TArray<FString> DetectQuestTopics(const FString& PlayerDialogue) const
+	{
+		TArray<FString> Topics;
+		FString Lower = PlayerDialogue.ToLower();
+
+		static TArray<FString> QuestKeywords = {TEXT("quest"),   TEXT("mission"),     TEXT("task"),    TEXT("job"),
+		                                        TEXT("help"),    TEXT("need"),        TEXT("looking for"),
+		                                        TEXT("find"),    TEXT("deliver"),     TEXT("kill"),
+		                                        TEXT("collect"), TEXT("retrieve")};
+		for (const FString& Keyword : QuestKeywords)
+		{
+			if (Lower.Contains(Keyword))
+			{
+				Topics.AddUnique(TEXT("Quest"));
+				break;
+			}
+		}
+
+		for (const FRfsnQuest& Quest : OfferedQuests)
+		{
+			if (Lower.Contains(Quest.DisplayName.ToLower()) || Lower.Contains(Quest.QuestId.ToLower()))
+			{
+				Topics.AddUnique(Quest.QuestId);
+			}
+		}
+		return Topics;
+	}
+
+	FString GetQuestContext() const
+	{
+		FString Context;
+
+		TArray<FRfsnQuest> Available;
+		TArray<FRfsnQuest> Active;
+		for (const FRfsnQuest& Quest : OfferedQuests)
+		{
+			if (Quest.Status == ERfsnQuestStatus::Available || Quest.Status == ERfsnQuestStatus::Unknown)
+			{
+				Available.Add(Quest);
+			}
+			else if (Quest.Status == ERfsnQuestStatus::Active)
+			{
+				Active.Add(Quest);
+			}
+		}
+
+		if (Available.Num() > 0)
+		{
+			Context += TEXT("NPC can offer quests: ");
+			for (const FRfsnQuest& Quest : Available)
+			{
+				Context += FString::Printf(TEXT("[%s] "), *Quest.DisplayName);
+			}
+		}
+
+		if (Active.Num() > 0)
+		{
+			Context += TEXT("Active quests from this NPC: ");
+			for (const FRfsnQuest& Quest : Active)
+			{
+				int32 Complete = 0, Total = 0;
+				for (const FRfsnQuestObjective& Obj : Quest.Objectives)
+				{
+					if (!Obj.bOptional)
+					{
+						Total++;
+						Complete += Obj.IsComplete() ? 1 : 0;
+					}
+				}
+				Context += FString::Printf(TEXT("[%s: %d/%d objectives] "), *Quest.DisplayName, Complete, Total);
+			}
+		}
+
+		for (const FRfsnNpcQuestKnowledge& Knowledge : QuestKnowledge)
+		{
+			if (Knowledge.bCanProvideInfo && !Knowledge.DialogueHint.IsEmpty())
+			{
+				Context += FString::Printf(TEXT("Knows about quest '%s'. "), *Knowledge.QuestId);
+			}
+		}
+		return Context;
+	}
+};
+
+
+/** Quests named "The <adjective> <noun> of <place>", a mix of available, active and completed */
+TArray<FRfsnQuest> MakeQuests(int32 QuestCount);
+
+/** Rumours of other NPCs' quests; half of them can be shared */
+TArray<FRfsnNpcQuestKnowledge> MakeQuestKnowledge(int32 Count);
+
+/** Player lines mixing small talk, quest keywords, quest names and IDs (in any case) and near misses */
+TArray<FString> MakePlayerLines(const TArray<FRfsnQuest>& Quests, int32 Count);
+
+/** Every quest ID offered or known (offered ones also upper-cased), an unknown ID and an empty one */
+TArray<FString> MakeQuestLookupIds(const URfsnQuestIntegration& Quests);
+} // namespace RfsnBench
@@ -0,0 +1,164 @@
+// RFSN Quest Topics Tests
+// The indexed quest lookups and Aho-Corasick topic detection against the linear scans they replaced
+
+#include "RfsnQuestIntegration.h"
+#include "RfsnQuestTopicsFixtures.h"
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace RfsnQuestTopicsTests
+{
+/** No world, so the component indexes into its own FRfsnQuestIndex */
+URfsnQuestIntegration* MakeQuests()
+{
+	URfsnQuestIntegration* Quests = NewObject<URfsnQuestIntegration>(GetTransientPackage());
+	Quests->OfferedQuests = RfsnBench::MakeQuests(200);
+	Quests->QuestKnowledge = RfsnBench::MakeQuestKnowledge(100);
+	Quests->RefreshQuests();
+	return Quests;
+}
+} // namespace RfsnQuestTopicsTests
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRfsnQuestMatcherTest, "Rfsn.QuestTopics.Matcher",
+                                 EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext |
+                                     EAutomationTestFlags::ProductFilter)
+
+bool FRfsnQuestMatcherTest::RunTest(const FString& Parameters)
+{
+	// Overlapping and nested patterns are all reported, case-insensitively
+	FRfsnQuestMatcher Matcher;
+	Matcher.Add(TEXT("he"), 0);
+	Matcher.Add(TEXT("SHE"), 1);
+	Matcher.Add(TEXT("his"), 2);
+	Matcher.Add(TEXT("hers"), 3);
+	Matcher.Build();
+	TArray<int32> Found;
+	Matcher.Match(TEXT("UsHers"), Found);
+	TestEqual(TEXT("Matches"), Found, TArray<int32>({1, 0, 3}));
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRfsnQuestScanTest, "Rfsn.QuestTopics.MatchesScans",
+                                 EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext |
+                                     EAutomationTestFlags::ProductFilter)
+
+bool FRfsnQuestScanTest::RunTest(const FString& Parameters)
+{
+	using namespace RfsnBench;
+
+	URfsnQuestIntegration* Quests = RfsnQuestTopicsTests::MakeQuests();
+	const FLegacyQuests Legacy{Quests->OfferedQuests, Quests->QuestKnowledge};
+
+	int32 TopicErrors = 0;
+	int32 Mentions = 0;
+	for (const FString& Line : MakePlayerLines(Quests->OfferedQuests, 2000))
+	{
+		const TArray<FString> Topics = Quests->DetectQuestTopics(Line);
+		TopicErrors += Topics == Legacy.DetectQuestTopics(Line) ? 0 : 1;
+		Mentions += Topics.Num();
+	}
+	TestEqual(TEXT("Lines with different topics"), TopicErrors, 0);
+	TestTrue(TEXT("Lines mention quests"), Mentions > 0);
+
+	int32 StatusErrors = 0;
+	int32 InfoErrors = 0;
+	int32 KnowsErrors = 0;
+	for (const FString& Id : MakeQuestLookupIds(*Quests))
+	{
+		const FRfsnQuest* Quest = Legacy.FindQuest(Id);
+		StatusErrors += Quests->GetQuestStatus(Id) == (Quest ? Quest->Status : ERfsnQuestStatus::Unknown) ? 0 : 1;
+		InfoErrors += Quests->GetQuestInfo(Id) == Legacy.GetQuestInfo(Id) ? 0 : 1;
+		KnowsErrors += Quests->KnowsAboutQuest(Id) == (Quest || Legacy.FindQuestKnowledge(Id)) ? 0 : 1;
+	}
+	TestEqual(TEXT("Status lookups that differ"), StatusErrors, 0);
+	TestEqual(TEXT("Info lookups that differ"), InfoErrors, 0);
+	TestEqual(TEXT("Knowledge lookups that differ"), KnowsErrors, 0);
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRfsnQuestContextTest, "Rfsn.QuestTopics.ContextCache",
+                                 EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext |
+                                     EAutomationTestFlags::ProductFilter)
+
+bool FRfsnQuestContextTest::RunTest(const FString& Parameters)
+{
+	using namespace RfsnBench;
+
+	// The context string is cached, and rebuilt after status and objective changes
+	URfsnQuestIntegration* Quests = RfsnQuestTopicsTests::MakeQuests();
+	const FLegacyQuests Legacy{Quests->OfferedQuests, Quests->QuestKnowledge};
+	TestEqual(TEXT("Initial context"), Quests->GetQuestContext(), Legacy.GetQuestContext());
+
+	const FString Before = Quests->GetQuestContext();
+	const FString StartedId = Quests->OfferedQuests[1].QuestId;
+	TestTrue(TEXT("Started"), Quests->StartQuest(StartedId));
+	TestNotEqual(TEXT("Context changed on start"), Quests->GetQuestContext(), Before);
+	TestEqual(TEXT("Context after start"), Quests->GetQuestContext(), Legacy.GetQuestContext());
+	TestTrue(TEXT("Objective updated"), Quests->UpdateObjective(StartedId, TEXT("step0")));
+	TestEqual(TEXT("Context after objective"), Quests->GetQuestContext(), Legacy.GetQuestContext());
+	TestTrue(TEXT("Failed"), Quests->FailQuest(StartedId));
+	TestEqual(TEXT("Context after failing"), Quests->GetQuestContext(), Legacy.GetQuestContext());
+
+	// Appending a quest without RefreshQuests is picked up on the next call
+	FRfsnQuest& Added = Quests->OfferedQuests.AddDefaulted_GetRef();
+	Added.QuestId = TEXT("q_added");
+	Added.DisplayName = TEXT("The Late Addition");
+	TestEqual(TEXT("Context after appending"), Quests->GetQuestContext(), Legacy.GetQuestContext());
+	TestEqual(TEXT("Topics after appending"), Quests->DetectQuestTopics(TEXT("about the late addition")),
+	          Legacy.DetectQuestTopics(TEXT("about the late addition")));
+
+	// In-place Blueprint writes keep the sizes: a status change, and a rename to an ID the index has never seen
+	Quests->OfferedQuests[2].Status = ERfsnQuestStatus::Active;
+	TestEqual(TEXT("Context after writing a status"), Quests->GetQuestContext(), Legacy.GetQuestContext());
+	const FString OldId = Quests->OfferedQuests[3].QuestId;
+	Quests->OfferedQuests[3].QuestId = TEXT("q_renamed_in_place");
+	TestEqual(TEXT("Renamed quest found"), Quests->GetQuestStatus(TEXT("q_renamed_in_place")),
+	          Quests->OfferedQuests[3].Status);
+	TestTrue(TEXT("Renamed quest started"), Quests->StartQuest(TEXT("q_renamed_in_place")));
+	TestEqual(TEXT("Old ID after the rename"), Quests->GetQuestInfo(OldId), Legacy.GetQuestInfo(OldId));
+	TestEqual(TEXT("Context after the rename"), Quests->GetQuestContext(), Legacy.GetQuestContext());
+	Quests->QuestKnowledge[0].QuestId = TEXT("q_known_in_place");
+	TestEqual(TEXT("Renamed knowledge found"), Quests->GetQuestInfo(TEXT("q_known_in_place")),
+	          Legacy.GetQuestInfo(TEXT("q_known_in_place")));
+	TestEqual(TEXT("Context after renaming knowledge"), Quests->GetQuestContext(), Legacy.GetQuestContext());
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRfsnQuestIndexTest, "Rfsn.QuestTopics.SharedIndex",
+                                 EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext |
+                                     EAutomationTestFlags::ProductFilter)
+
+bool FRfsnQuestIndexTest::RunTest(const FString& Parameters)
+{
+	// A shared index compiles once per change to its sources
+	FRfsnQuestIndex Index;
+	const int32 SourceA = Index.AddSource();
+	const int32 SourceB = Index.AddSource();
+	Index.SetPatterns(SourceA, {Index.Intern(TEXT("The Sunken Crown"))});
+	Index.SetPatterns(SourceB, {Index.Intern(TEXT("Old Mill")), Index.Intern(TEXT("q_mill"))});
+	TArray<int32> Matched;
+	bool bKeyword = false;
+	for (int32 i = 0; i < 10; i++)
+	{
+		Matched.Reset();
+		Index.Detect(TEXT("Any JOB at the old mill or the sunken crown?"), Matched, bKeyword);
+	}
+	TestEqual(TEXT("Sources matched"), Matched.Num(), 2);
+	TestTrue(TEXT("Keyword matched"), bKeyword);
+	TestEqual(TEXT("Builds"), Index.GetNumBuilds(), 1);
+
+	// Re-setting the same patterns, found case-insensitively, needs no rebuild
+	Index.SetPatterns(SourceA, {Index.Find(TEXT("the sunken CROWN"))});
+	TestFalse(TEXT("Unchanged patterns need a build"), Index.NeedsBuild());
+
+	Index.RemoveSource(SourceB);
+	Matched.Reset();
+	Index.Detect(TEXT("the old mill"), Matched, bKeyword);
+	TestEqual(TEXT("Removed source matched"), Matched.Num(), 0);
+	TestFalse(TEXT("Keyword matched after removal"), bKeyword);
+	TestEqual(TEXT("Builds after removal"), Index.GetNumBuilds(), 2);
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,33 @@
+// RFSN Relationship Decay Fixtures Implementation
+
+#include "RfsnRelationshipDecayFixtures.h"
+
+namespace RfsnBench
+{
+TArray<FLegacyRelationship> MakeRelationships(int32 NpcCount)
+{
+	FRandomStream Stream(97531);
+	TArray<FLegacyRelationship> Npcs;
+	Npcs.SetNum(NpcCount);
+	for (int32 i = 0; i < NpcCount; i++)
+	{
+		FLegacyRelationship& Npc = Npcs[i];
+		Npc.Params.DecayRatePerDay = Stream.FRandRange(1.0f, 4.0f);
+		Npc.Params.GracePeriodHours = 6.0f * Stream.RandRange(2, 12);
+		Npc.bIsLocked = i % 20 == 19;
+		Npc.CurrentValue = Npc.bIsLocked ? 100.0f : Stream.FRandRange(-100.0f, 99.0f);
+		Npc.UpdateTier();
+	}
+	return Npcs;
+}
+
+FRfsnRelationshipLedger MakeLedger(const TArray<FLegacyRelationship>& Npcs)
+{
+	FRfsnRelationshipLedger Ledger;
+	for (const FLegacyRelationship& Npc : Npcs)
+	{
+		Ledger.Add(Npc.Params, Npc.CurrentValue, Npc.bIsLocked, 0.0, 0.0);
+	}
+	return Ledger;
+}
+} // namespace RfsnBench
@@ -0,0 +1,100 @@
+// RFSN Relationship Decay Fixtures
+// URfsnRelationshipDecay's stepped decay before the ledger, and NPCs across every tier
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "RfsnRelationshipDecay.h"
+#include "RfsnRelationshipDecayManager.h"
+
+namespace RfsnBench
+{
+/**
+ * URfsnRelationshipDecay's old stepped TickDecay for one NPC. The old component only refreshed its tier on
+ * steps that moved the value a whole point, so small steps kept decaying at a stale tier's rate; this copy
+ * refreshes the tier every step, which is the rule the closed form follows.
+ */
+struct FLegacyRelationship
+{
+	float CurrentValue = 0.0f;
+	ERfsnRelationshipTier CurrentTier = ERfsnRelationshipTier::Neutral;
+	float HoursSinceInteraction = 0.0f;
+	bool bIsLocked = false;
+	FRfsnRelationshipDecayParams Params;
+
+	float CalculateDecayRate() const
+	{
+		float Rate = Params.DecayRatePerDay;
+		if (CurrentValue > 0)
+		{
+			Rate *= Params.PositiveMultiplier;
+		}
+		else if (CurrentValue < 0)
+		{
+			Rate *= Params.NegativeMultiplier;
+		}
+
+		switch (CurrentTier)
+		{
+		case ERfsnRelationshipTier::Trusted:
+			Rate *= 0.5f;
+			break;
+		case ERfsnRelationshipTier::Friendly:
+			Rate *= 0.75f;
+			break;
+		default:
+			break;
+		}
+		return Rate;
+	}
+
+	/** Returns whether the tier changed */
+	bool UpdateTier()
+	{
+		const ERfsnRelationshipTier NewTier = URfsnRelationshipDecay::ValueToTier(CurrentValue);
+		const bool bChanged = NewTier != CurrentTier;
+		CurrentTier = NewTier;
+		return bChanged;
+	}
+
+	bool TickDecay(float GameHoursElapsed)
+	{
+		if (bIsLocked)
+		{
+			return false;
+		}
+
+		HoursSinceInteraction += GameHoursElapsed;
+		if (HoursSinceInteraction < Params.GracePeriodHours)
+		{
+			return false;
+		}
+
+		const float DecayAmount = CalculateDecayRate() * GameHoursElapsed / 24.0f;
+		if (CurrentValue > 0)
+		{
+			CurrentValue = FMath::Max(0.0f, CurrentValue - DecayAmount);
+		}
+		else if (CurrentValue < 0)
+		{
+			CurrentValue = FMath::Min(0.0f, CurrentValue + DecayAmount);
+		}
+		return UpdateTier();
+	}
+
+	/** ModifyRelationship then RecordInteraction */
+	bool Interact(float Amount)
+	{
+		CurrentValue = FMath::Clamp(CurrentValue + Amount, -100.0f, 100.0f);
+		bIsLocked |= CurrentValue >= 100.0f;
+		HoursSinceInteraction = 0.0f;
+		return UpdateTier();
+	}
+};
+
+/** NPCs across every tier with varied rates and grace periods; every twentieth is a locked best friend */
+TArray<FLegacyRelationship> MakeRelationships(int32 NpcCount);
+
+/** The same NPCs in a ledger, all last touched at hour 0 */
+FRfsnRelationshipLedger MakeLedger(const TArray<FLegacyRelationship>& Npcs);
+} // namespace RfsnBench
@@ -0,0 +1,307 @@
+// RFSN Relationship Decay Tests
+// The closed-form decay ledger against the stepped per-NPC ticks it replaced, its event heap, and the component
+
+#include "RfsnRelationshipDecayFixtures.h"
+#include "RfsnGameClock.h"
+#include "RfsnRelationshipDecay.h"
+#include "RfsnRelationshipDecayManager.h"
+#include "RfsnTestWorld.h"
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace RfsnRelationshipDecayTests
+{
+constexpr int32 NpcCount = 500;
+
+struct FStepRun
+{
+	float MaxError = 0.0f;
+	int32 Mismatches = 0;
+};
+
+/** Sixty days with daily interactions, stepped at Step hours against the ledger */
+FStepRun RunSteps(const TArray<RfsnBench::FLegacyRelationship>& Initial, float Step)
+{
+	using namespace RfsnBench;
+
+	constexpr int32 Days = 60;
+	const int32 Count = Initial.Num();
+	const int32 StepsPerDay = FMath::RoundToInt(24.0f / Step);
+	TArray<FLegacyRelationship> Legacy = Initial;
+	FRfsnRelationshipLedger Ledger = MakeLedger(Initial);
+
+	// Tiers each NPC has passed through, as the stepped model and as the ledger's crossings report them
+	TArray<TArray<ERfsnRelationshipTier>> LegacyTiers;
+	TArray<TArray<ERfsnRelationshipTier>> LedgerTiers;
+	for (const FLegacyRelationship& Npc : Initial)
+	{
+		LegacyTiers.Add({Npc.CurrentTier});
+		LedgerTiers.Add({Npc.CurrentTier});
+	}
+	auto NoteLedgerTier = [&Ledger, &LedgerTiers](int32 Npc, double Now)
+	{
+		const ERfsnRelationshipTier Tier = URfsnRelationshipDecay::ValueToTier(Ledger.GetValue(Npc, Now));
+		if (Tier != LedgerTiers[Npc].Last())
+		{
+			LedgerTiers[Npc].Add(Tier);
+		}
+	};
+
+	FStepRun Run;
+	FRandomStream Interactions(1111);
+	TArray<int32> Due;
+	for (int32 StepIndex = 1; StepIndex <= Days * StepsPerDay; StepIndex++)
+	{
+		const double Now = StepIndex * static_cast<double>(Step);
+		for (int32 i = 0; i < Count; i++)
+		{
+			if (Legacy[i].TickDecay(Step))
+			{
+				LegacyTiers[i].Add(Legacy[i].CurrentTier);
+			}
+		}
+
+		Due.Reset();
+		Ledger.PopDue(Now, Due);
+		for (const int32 Npc : Due)
+		{
+			Ledger.ScheduleNext(Npc, Now);
+			NoteLedgerTier(Npc, Now);
+		}
+
+		for (int32 i = 0; i < Count; i++)
+		{
+			Run.MaxError = FMath::Max(Run.MaxError, FMath::Abs(Legacy[i].CurrentValue - Ledger.GetValue(i, Now)));
+		}
+
+		// Once a day a few NPCs are talked to, given gifts or insulted
+		if (StepIndex % StepsPerDay == 0)
+		{
+			for (int32 k = 0; k < Count / 20; k++)
+			{
+				const int32 Npc = Interactions.RandRange(0, Count - 1);
+				const float Amount = Interactions.FRandRange(-30.0f, 30.0f);
+				if (Legacy[Npc].Interact(Amount))
+				{
+					LegacyTiers[Npc].Add(Legacy[Npc].CurrentTier);
+				}
+
+				const float Value = FMath::Clamp(Ledger.GetValue(Npc, Now) + Amount, -100.0f, 100.0f);
+				Ledger.SetValue(Npc, Value, Ledger.IsLocked(Npc) || Value >= 100.0f, Now);
+				Ledger.RecordInteraction(Npc, Now);
+				NoteLedgerTier(Npc, Now);
+			}
+		}
+	}
+
+	for (int32 i = 0; i < Count; i++)
+	{
+		Run.Mismatches += LegacyTiers[i] == LedgerTiers[i] ? 0 : 1;
+	}
+	return Run;
+}
+} // namespace RfsnRelationshipDecayTests
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRfsnDecayClosedFormTest, "Rfsn.RelationshipDecay.ClosedForm",
+                                 EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext |
+                                     EAutomationTestFlags::ProductFilter)
+
+bool FRfsnDecayClosedFormTest::RunTest(const FString& Parameters)
+{
+	using namespace RfsnBench;
+	using namespace RfsnRelationshipDecayTests;
+
+	// Decaying in two spans equals one, and HoursToReach inverts Decay
+	const TArray<FLegacyRelationship> Initial = MakeRelationships(NpcCount);
+	FRandomStream Stream(8642);
+	int32 ComposeErrors = 0;
+	int32 InverseErrors = 0;
+	for (int32 i = 0; i < 1000; i++)
+	{
+		const FRfsnRelationshipDecayParams& Params = Initial[i % NpcCount].Params;
+		const float Value = Stream.FRandRange(-100.0f, 100.0f);
+		const double A = Stream.FRandRange(0.0f, 2000.0f);
+		const double B = Stream.FRandRange(0.0f, 2000.0f);
+		const float Whole = FRfsnRelationshipLedger::Decay(Value, A + B, Params);
+		const float Split = FRfsnRelationshipLedger::Decay(FRfsnRelationshipLedger::Decay(Value, A, Params), B, Params);
+		ComposeErrors += FMath::Abs(Whole - Split) < 1e-3f ? 0 : 1;
+
+		const float Target = Value > 0 ? Stream.FRandRange(0.0f, Value) : Stream.FRandRange(Value, 0.0f);
+		const double Hours = FRfsnRelationshipLedger::HoursToReach(Value, Target, Params);
+		InverseErrors += FMath::Abs(FRfsnRelationshipLedger::Decay(Value, Hours, Params) - Target) < 1e-3f ? 0 : 1;
+	}
+	TestEqual(TEXT("Split decays that differ"), ComposeErrors, 0);
+	TestEqual(TEXT("Inverses that miss"), InverseErrors, 0);
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRfsnDecaySteppedTest, "Rfsn.RelationshipDecay.MatchesSteppedTicks",
+                                 EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext |
+                                     EAutomationTestFlags::ProductFilter)
+
+bool FRfsnDecaySteppedTest::RunTest(const FString& Parameters)
+{
+	using namespace RfsnBench;
+	using namespace RfsnRelationshipDecayTests;
+
+	const TArray<FLegacyRelationship> Initial = MakeRelationships(NpcCount);
+	const FStepRun Coarse = RunSteps(Initial, 6.0f);
+	const FStepRun Hourly = RunSteps(Initial, 1.0f);
+	const FStepRun Fine = RunSteps(Initial, 0.25f);
+
+	// Stepping starts decay up to a step early after every interaction and holds each tier's rate for a whole
+	// step, so its error is proportional to the step
+	TestTrue(TEXT("Error shrinks with the step"), Fine.MaxError < Hourly.MaxError && Hourly.MaxError < Coarse.MaxError);
+	TestTrue(TEXT("Error proportional to the step"), Fine.MaxError <= 1.5f * Coarse.MaxError * 0.25f / 6.0f);
+	TestTrue(TEXT("Same tiers crossed"), Fine.Mismatches <= NpcCount / 100 && Fine.Mismatches <= Coarse.Mismatches);
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRfsnDecaySkipTest, "Rfsn.RelationshipDecay.TimeSkip",
+                                 EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext |
+                                     EAutomationTestFlags::ProductFilter)
+
+bool FRfsnDecaySkipTest::RunTest(const FString& Parameters)
+{
+	using namespace RfsnBench;
+	using namespace RfsnRelationshipDecayTests;
+
+	const TArray<FLegacyRelationship> Initial = MakeRelationships(NpcCount);
+
+	// Fastest decay of any NPC: negative values at the top rate
+	float MaxRatePerHour = 0.0f;
+	for (const FLegacyRelationship& Npc : Initial)
+	{
+		MaxRatePerHour = FMath::Max(MaxRatePerHour, Npc.Params.DecayRatePerDay * Npc.Params.NegativeMultiplier / 24.0f);
+	}
+
+	// A 30-day skip: hourly ticks against the lazy ledger and per-NPC fast-forwards
+	constexpr double SkipHours = 30.0 * 24.0;
+	TArray<FLegacyRelationship> Legacy = Initial;
+	FRfsnRelationshipLedger Ledger = MakeLedger(Initial);
+	FRfsnRelationshipLedger Forwarded = Ledger;
+	for (int32 Hour = 0; Hour < static_cast<int32>(SkipHours); Hour++)
+	{
+		for (FLegacyRelationship& Npc : Legacy)
+		{
+			Npc.TickDecay(1.0f);
+		}
+	}
+	TArray<int32> Due;
+	Ledger.PopDue(SkipHours, Due);
+	for (const int32 Npc : Due)
+	{
+		Ledger.ScheduleNext(Npc, SkipHours);
+	}
+	for (int32 i = 0; i < NpcCount; i++)
+	{
+		Forwarded.FastForward(i, SkipHours, 0.0);
+	}
+
+	float SkipError = 0.0f;
+	float ForwardError = 0.0f;
+	int32 LockErrors = 0;
+	for (int32 i = 0; i < NpcCount; i++)
+	{
+		const float Value = Ledger.GetValue(i, SkipHours);
+		SkipError = FMath::Max(SkipError, FMath::Abs(Value - Legacy[i].CurrentValue));
+		ForwardError = FMath::Max(ForwardError, FMath::Abs(Value - Forwarded.GetValue(i, 0.0)));
+		LockErrors += !Initial[i].bIsLocked || Value == 100.0f ? 0 : 1;
+	}
+	TestTrue(TEXT("Skip matches hourly ticks"), SkipError <= 2.0f * MaxRatePerHour);
+	TestTrue(TEXT("Fast-forward matches the skip"), ForwardError < 1e-4f);
+	TestTrue(TEXT("Fast-forward reschedules"), Forwarded.GetQueuedEvents() > 0);
+	TestEqual(TEXT("Locked NPCs that decayed"), LockErrors, 0);
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRfsnDecayGraceTest, "Rfsn.RelationshipDecay.Grace",
+                                 EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext |
+                                     EAutomationTestFlags::ProductFilter)
+
+bool FRfsnDecayGraceTest::RunTest(const FString& Parameters)
+{
+	using namespace RfsnBench;
+	using namespace RfsnRelationshipDecayTests;
+
+	// Nothing decays inside the grace period
+	const TArray<FLegacyRelationship> Initial = MakeRelationships(NpcCount);
+	FRfsnRelationshipLedger Grace = MakeLedger(Initial);
+	int32 GraceErrors = 0;
+	int32 SinceErrors = 0;
+	for (int32 i = 0; i < NpcCount; i++)
+	{
+		Grace.RecordInteraction(i, 100.0);
+		const float Held = Grace.GetValue(i, 100.0);
+		GraceErrors += Grace.GetValue(i, 100.0 + Initial[i].Params.GracePeriodHours) == Held ? 0 : 1;
+		SinceErrors += Grace.GetHoursSinceInteraction(i, 130.0) == 30.0 ? 0 : 1;
+	}
+	TestEqual(TEXT("NPCs that decayed in grace"), GraceErrors, 0);
+	TestEqual(TEXT("Wrong hours since interaction"), SinceErrors, 0);
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRfsnDecayCompactTest, "Rfsn.RelationshipDecay.CompactsStaleEvents",
+                                 EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext |
+                                     EAutomationTestFlags::ProductFilter)
+
+bool FRfsnDecayCompactTest::RunTest(const FString& Parameters)
+{
+	// An NPC talked to every hour queues a new crossing each time, each superseding the last
+	FRfsnRelationshipLedger Ledger;
+	const int32 Npc = Ledger.Add(FRfsnRelationshipDecayParams(), 50.0f, false, 0.0, 0.0);
+	constexpr int32 Interactions = 10000;
+	for (int32 Hour = 1; Hour <= Interactions; Hour++)
+	{
+		Ledger.RecordInteraction(Npc, Hour);
+	}
+	TestTrue(TEXT("Stale events are compacted away"), Ledger.GetQueuedEvents() <= RfsnRelationship::MinEventsToCompact);
+
+	TArray<int32> Due;
+	Ledger.PopDue(TNumericLimits<double>::Max(), Due);
+	TestTrue(TEXT("The live crossing survives compaction, once"), Due.Num() == 1 && Due[0] == Npc);
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRfsnDecayComponentTest, "Rfsn.RelationshipDecay.Component",
+                                 EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext |
+                                     EAutomationTestFlags::ProductFilter)
+
+bool FRfsnDecayComponentTest::RunTest(const FString& Parameters)
+{
+	FRfsnTestWorld World;
+	AActor* Npc = World.SpawnActor(FVector::ZeroVector);
+	URfsnRelationshipDecay* Relationship = World.AddComponent<URfsnRelationshipDecay>(Npc);
+	World.BeginPlay();
+
+	URfsnRelationshipDecayManager* Manager = World.GetSubsystem<URfsnRelationshipDecayManager>();
+	const URfsnGameClock* Clock = World.GetSubsystem<URfsnGameClock>();
+	if (!TestNotNull(TEXT("Decay manager"), Manager) || !TestNotNull(TEXT("Game clock"), Clock))
+	{
+		return false;
+	}
+
+	// Blueprints read the bonuses as an array, oldest first, holding the latest 10
+	for (int32 i = 0; i < 12; i++)
+	{
+		Relationship->ModifyRelationship(1.0f, FString::Printf(TEXT("bonus %d"), i));
+	}
+	if (TestEqual(TEXT("Bonuses kept"), Relationship->RecentBonuses.Num(), 10))
+	{
+		TestEqual(TEXT("Oldest bonus"), Relationship->RecentBonuses[0].Reason, FString(TEXT("bonus 2")));
+		TestEqual(TEXT("Latest bonus"), Relationship->RecentBonuses.Last().Reason, FString(TEXT("bonus 11")));
+	}
+
+	// Skipping a month ages the relationship alone; the clock, and everything it times, stays put
+	const double Minutes = Clock->GetGameMinutes();
+	const float Value = Relationship->GetCurrentValue();
+	Manager->SkipTime(30.0f * 24.0f);
+	TestEqual(TEXT("Clock after the skip"), Clock->GetGameMinutes(), Minutes);
+	TestTrue(TEXT("Hours since interaction after the skip"), Relationship->GetHoursSinceInteraction() >= 720.0f);
+	TestTrue(TEXT("Relationship decayed"), Relationship->GetCurrentValue() < Value);
+	TestEqual(TEXT("Property refreshed by the skip"), Relationship->CurrentValue, Relationship->GetCurrentValue());
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
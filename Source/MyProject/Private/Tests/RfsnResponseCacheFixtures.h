@@ -0,0 +1,52 @@
+// RFSN Response Cache Fixtures
+// Repeated player phrasings and a paced stand-in for the orchestrator
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "RfsnBenchFixtures.h"
+#include "RfsnNpcClientComponent.h"
+#include "RfsnResponseCache.h"
+
+namespace RfsnBench
+{
+/** What players keep asking, with the variations they type */
+const TCHAR* const CachePhrases[] = {
+    TEXT("hello"), TEXT("Hello!"), TEXT("hello friend"), TEXT("hello friends"),
+    TEXT("who are you"), TEXT("Who are you?"), TEXT("who are you there"), TEXT("what's going on"),
+    TEXT("whats going on?"), TEXT("what's going on here"), TEXT("where is the radio tower"),
+    TEXT("where's the radio tower"), TEXT("can you help me"), TEXT("can you help me out"),
+    TEXT("what do you sell"), TEXT("tell me about the tower"), TEXT("tell me about the towers"),
+    TEXT("do you trust me"),
+};
+
+/** Stand-in for the orchestrator: a fixed reply per utterance at streaming pace, counting round-trips */
+struct FMockOrchestrator
+{
+	int32 Calls = 0;
+	double WaitMs = 0.0;
+
+	FRfsnCachedResponse Respond(const FString& NpcId, uint32 Context, const FString& Utterance)
+	{
+		Calls++;
+		WaitMs += MockFirstSentenceMs;
+
+		FRfsnCachedResponse Response;
+		Response.NpcId = NpcId;
+		Response.Context = Context;
+		Response.Utterance = Utterance;
+		Response.bHasMeta = true;
+		Response.Meta.NpcAction = Utterance.Contains(TEXT("hello")) ? ERfsnNpcAction::Greet : ERfsnNpcAction::Answer;
+
+		const int32 NumSentences = 2 + Utterance.Len() % 3;
+		for (int32 i = 0; i < NumSentences; i++)
+		{
+			FRfsnSentence& Sentence = Response.Sentences.AddDefaulted_GetRef();
+			Sentence.Sentence = FString::Printf(TEXT("%s: reply %d of %d."), *NpcId, i + 1, NumSentences);
+			Sentence.bIsFinal = i == NumSentences - 1;
+			Response.SentenceOffsetsMs.Add(MockFirstSentenceMs + i * MockSentenceGapMs);
+		}
+		return Response;
+	}
+};
+} // namespace RfsnBench
@@ -0,0 +1,147 @@
+// RFSN Response Cache Tests
+// Matching, expiry, the entry limit and the on-disk copy of the response cache
+
+#include "RfsnResponseCache.h"
+#include "RfsnResponseCacheFixtures.h"
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace RfsnResponseCacheTests
+{
+const FDateTime Start(2026, 1, 1);
+const TCHAR* const Npc = TEXT("npc_merchant");
+constexpr uint32 Calm = 0x1234;
+} // namespace RfsnResponseCacheTests
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRfsnResponseCacheMatchTest, "Rfsn.ResponseCache.Matching",
+                                 EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext |
+                                     EAutomationTestFlags::ProductFilter)
+
+bool FRfsnResponseCacheMatchTest::RunTest(const FString& Parameters)
+{
+	using namespace RfsnResponseCacheTests;
+
+	RfsnBench::FMockOrchestrator Mock;
+	FRfsnResponseCacheStore Cache;
+	Cache.Add(Mock.Respond(Npc, Calm, TEXT("Where is the radio tower?")), Start);
+	Cache.Add(Mock.Respond(Npc, Calm, TEXT("Do you trust me?")), Start);
+
+	TestEqual(TEXT("Normalized utterance"), FRfsnResponseCacheStore::NormalizeUtterance(TEXT("  What's going ON?!")),
+	          FString(TEXT("whats going on")));
+
+	ERfsnCacheMatch Match;
+	const FRfsnCachedResponse* Hit = Cache.Find(Npc, Calm, TEXT("where is the radio tower"), Start, &Match);
+	if (TestNotNull(TEXT("Exact hit"), Hit))
+	{
+		TestTrue(TEXT("Exact match"), Match == ERfsnCacheMatch::Exact);
+		TestTrue(TEXT("Cached action"), Hit->Meta.NpcAction == ERfsnNpcAction::Answer);
+	}
+
+	Hit = Cache.Find(Npc, Calm, TEXT("Where's the radio tower"), Start, &Match);
+	if (TestNotNull(TEXT("Approximate hit"), Hit))
+	{
+		TestTrue(TEXT("Approximate match"), Match == ERfsnCacheMatch::Approximate);
+	}
+
+	TestNull(TEXT("Different place asks again"), Cache.Find(Npc, Calm, TEXT("where is the water tower"), Start));
+	TestNull(TEXT("Negation asks again"), Cache.Find(Npc, Calm, TEXT("do you not trust me"), Start));
+	TestNull(TEXT("Other context"), Cache.Find(Npc, Calm + 1, TEXT("where is the radio tower"), Start));
+	TestNull(TEXT("Other NPC"), Cache.Find(TEXT("npc_guard"), Calm, TEXT("where is the radio tower"), Start));
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRfsnResponseCacheLimitsTest, "Rfsn.ResponseCache.Limits",
+                                 EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext |
+                                     EAutomationTestFlags::ProductFilter)
+
+bool FRfsnResponseCacheLimitsTest::RunTest(const FString& Parameters)
+{
+	using namespace RfsnResponseCacheTests;
+
+	RfsnBench::FMockOrchestrator Mock;
+	FRfsnResponseCacheStore Cache;
+	Cache.Add(Mock.Respond(Npc, Calm, TEXT("Where is the radio tower?")), Start);
+	Cache.Add(Mock.Respond(Npc, Calm, TEXT("Do you trust me?")), Start);
+
+	const FDateTime Late = Start + Cache.TimeToLive + FTimespan::FromSeconds(1.0);
+	TestNull(TEXT("Expired after the TTL"), Cache.Find(Npc, Calm, TEXT("where is the radio tower"), Late));
+	TestEqual(TEXT("Expired entries"), Cache.GetStats().Expired, 2);
+
+	// The entry asked about every time survives the evictions
+	FRfsnResponseCacheStore Small;
+	Small.MaxEntries = 8;
+	for (int32 i = 0; i < 20; i++)
+	{
+		const FDateTime Now = Start + FTimespan::FromSeconds(i);
+		Small.Add(Mock.Respond(Npc, Calm, FString::Printf(TEXT("question number %d"), i)), Now);
+		Small.Find(Npc, Calm, TEXT("question number 0"), Now);
+	}
+	TestEqual(TEXT("Entries"), Small.Num(), 8);
+	TestEqual(TEXT("Evicted"), Small.GetStats().Evicted, 12);
+	TestNotNull(TEXT("Recently used entry kept"), Small.Find(Npc, Calm, TEXT("question number 0"), Start));
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRfsnResponseCacheJsonTest, "Rfsn.ResponseCache.JsonRoundTrip",
+                                 EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext |
+                                     EAutomationTestFlags::ProductFilter)
+
+bool FRfsnResponseCacheJsonTest::RunTest(const FString& Parameters)
+{
+	using namespace RfsnResponseCacheTests;
+
+	RfsnBench::FMockOrchestrator Mock;
+	FRfsnResponseCacheStore Cache;
+	for (int32 i = 0; i < 8; i++)
+	{
+		Cache.Add(Mock.Respond(Npc, Calm, FString::Printf(TEXT("question number %d"), i)), Start);
+	}
+
+	FRfsnResponseCacheStore Loaded;
+	TestTrue(TEXT("Parsed"), Loaded.FromJson(Cache.ToJson(), Start + FTimespan::FromMinutes(1.0)));
+	TestEqual(TEXT("Entries"), Loaded.Num(), Cache.Num());
+
+	const FRfsnCachedResponse* Original = Cache.Find(Npc, Calm, TEXT("question number 7"), Start);
+	const FRfsnCachedResponse* Restored = Loaded.Find(Npc, Calm, TEXT("question number 7"), Start);
+	if (TestNotNull(TEXT("Original"), Original) && TestNotNull(TEXT("Restored"), Restored))
+	{
+		TestEqual(TEXT("Sentences"), Restored->Sentences.Num(), Original->Sentences.Num());
+		TestTrue(TEXT("Sentence offsets"), Restored->SentenceOffsetsMs == Original->SentenceOffsetsMs);
+		TestEqual(TEXT("Last sentence"), Restored->Sentences.Last().Sentence, Original->Sentences.Last().Sentence);
+		TestTrue(TEXT("Action"), Restored->Meta.NpcAction == Original->Meta.NpcAction);
+	}
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRfsnResponseCacheStatsTest, "Rfsn.ResponseCache.Stats",
+                                 EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext |
+                                     EAutomationTestFlags::ProductFilter)
+
+bool FRfsnResponseCacheStatsTest::RunTest(const FString& Parameters)
+{
+	using namespace RfsnResponseCacheTests;
+
+	// Every request either hits or costs exactly one round-trip
+	RfsnBench::FMockOrchestrator Mock;
+	FRfsnResponseCacheStore Cache;
+	FRandomStream Stream(2718);
+	const int32 Requests = 500;
+	for (int32 i = 0; i < Requests; i++)
+	{
+		const FDateTime Now = Start + FTimespan::FromSeconds(i * 2.0);
+		const FString Utterance = RfsnBench::CachePhrases[Stream.RandHelper(UE_ARRAY_COUNT(RfsnBench::CachePhrases))];
+		if (!Cache.Find(Npc, Calm, Utterance, Now))
+		{
+			Cache.Add(Mock.Respond(Npc, Calm, Utterance), Now);
+		}
+	}
+
+	const FRfsnResponseCacheStats& Stats = Cache.GetStats();
+	TestEqual(TEXT("Round-trips are misses"), Mock.Calls, Stats.Misses);
+	TestEqual(TEXT("Hits and misses"), Stats.ExactHits + Stats.ApproximateHits + Stats.Misses, Requests);
+	TestTrue(TEXT("Repeated questions hit"), Stats.ExactHits + Stats.ApproximateHits > Requests / 2);
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,41 @@
+// RFSN Schedule Fixtures Implementation
+
+#include "RfsnScheduleFixtures.h"
+#include "RfsnGameClock.h"
+
+namespace RfsnBench
+{
+TArray<FRfsnScheduleEntry> MakeRandomSchedule(FRandomStream& Stream)
+{
+	TArray<FRfsnScheduleEntry> Schedule;
+
+	FRfsnScheduleEntry& Work = Schedule.AddDefaulted_GetRef();
+	Work.Activity = ERfsnActivityType::Work;
+	Work.StartHour = Stream.FRandRange(5.0f, 10.0f);
+	Work.EndHour = Work.StartHour + Stream.FRandRange(4.0f, 10.0f);
+
+	FRfsnScheduleEntry& Sleep = Schedule.AddDefaulted_GetRef();
+	Sleep.Activity = ERfsnActivityType::Sleep;
+	Sleep.StartHour = Stream.FRandRange(20.0f, 23.9f);
+	Sleep.EndHour = Stream.FRandRange(4.0f, 8.0f);
+
+	const int32 Extra = Stream.RandRange(1, 4);
+	for (int32 i = 0; i < Extra; i++)
+	{
+		FRfsnScheduleEntry& Entry = Schedule.AddDefaulted_GetRef();
+		const int32 LastActivity = static_cast<int32>(ERfsnActivityType::Custom);
+		Entry.Activity = static_cast<ERfsnActivityType>(Stream.RandRange(0, LastActivity));
+		Entry.StartHour = Stream.FRandRange(0.0f, 24.0f);
+		Entry.EndHour = FMath::Fmod(Entry.StartHour + Stream.FRandRange(0.1f, 6.0f), 24.0f);
+		Entry.Priority = Stream.RandRange(0, 10);
+
+		const int32 NumDays = Stream.RandRange(0, 3);
+		for (int32 d = 0; d < NumDays; d++)
+		{
+			Entry.ActiveDays.AddUnique(Stream.RandRange(0, URfsnGameClock::DaysPerWeek - 1));
+		}
+	}
+
+	return Schedule;
+}
+} // namespace RfsnBench
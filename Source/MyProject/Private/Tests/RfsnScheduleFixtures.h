@@ -0,0 +1,32 @@
+// RFSN Schedule Fixtures
+// Random daily routines and the clock phases schedules are driven through
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "RfsnNpcSchedule.h"
+
+namespace RfsnBench
+{
+/** Random daily routine: a day block, an overnight sleep, and a few weekday-only or short entries */
+TArray<FRfsnScheduleEntry> MakeRandomSchedule(FRandomStream& Stream);
+
+/** Time-scale phases for the schedule run (seconds per game hour, game hours); a negative scale rewinds */
+struct FClockPhase
+{
+	float SecondsPerGameHour;
+	float GameHours;
+};
+
+constexpr FClockPhase SchedulePhases[] = {
+    {60.0f, 30.0f}, // default rate across the first midnight
+    {600.0f, 1.0f}, // slowed down: many frames per game minute
+    {2.0f, 50.0f},  // fast: about a minute per frame
+    {0.25f, 60.0f}, // very fast: several minutes per frame
+    {-1.0f, 36.0f}, // rewind a day and a half
+    {1.0f, 80.0f},  // past the end of the week
+};
+
+/** Simulated frame rate for the schedule run */
+constexpr float ScheduleFrameSeconds = 0.1f;
+} // namespace RfsnBench
@@ -0,0 +1,237 @@
+// RFSN Schedule Tests
+// Compiled schedules against the linear scan they replaced, and the game clock's entry-boundary callbacks
+
+#include "RfsnScheduleFixtures.h"
+#include "RfsnGameClock.h"
+#include "RfsnNpcSchedule.h"
+#include "RfsnTestWorld.h"
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace RfsnScheduleTests
+{
+constexpr int32 NpcCount = 200;
+
+/** Work 9-17 every day, sleep 22-06 across midnight, and a higher-priority trade hour on Mondays only */
+TArray<FRfsnScheduleEntry> MakeWeekSchedule()
+{
+	TArray<FRfsnScheduleEntry> Schedule;
+	Schedule.AddDefaulted(3);
+	Schedule[0].Activity = ERfsnActivityType::Work;
+	Schedule[0].StartHour = 9.0f;
+	Schedule[0].EndHour = 17.0f;
+	Schedule[1].Activity = ERfsnActivityType::Sleep;
+	Schedule[1].StartHour = 22.0f;
+	Schedule[1].EndHour = 6.0f;
+	Schedule[2].Activity = ERfsnActivityType::Trade;
+	Schedule[2].StartHour = 12.0f;
+	Schedule[2].EndHour = 13.0f;
+	Schedule[2].Priority = 8;
+	Schedule[2].ActiveDays = {1};
+	return Schedule;
+}
+
+/** One boundary callback: the game minute it was armed for, the clock when it fired, and the entry it found */
+struct FBoundary
+{
+	double Armed;
+	double Fired;
+	int32 Entry;
+};
+
+/** URfsnNpcSchedule's clock handling (arm the next boundary, re-evaluate when it fires), recording each callback */
+struct FBoundaryRecorder
+{
+	URfsnGameClock* Clock = nullptr;
+	FRfsnCompiledSchedule Compiled;
+	int32 Timer = INDEX_NONE;
+	double Armed = 0.0;
+	int32 Entry = INDEX_NONE;
+	TArray<FBoundary> Fired;
+
+	void Arm()
+	{
+		Clock->CancelTimer(Timer);
+		Armed = Compiled.GetNextTransition(Clock->GetGameMinutes(), Clock->GetDayOfWeek());
+		Timer = Clock->ScheduleAt(Armed, FRfsnGameClockCallback::CreateLambda([this]() { HandleBoundary(); }));
+	}
+
+	void Evaluate() { Entry = Compiled.FindEntry(Clock->GetDayOfWeek(), Clock->GetGameHour()); }
+
+	void HandleBoundary()
+	{
+		Timer = INDEX_NONE;
+		Evaluate();
+		Fired.Add({Armed, Clock->GetGameMinutes(), Entry});
+		Arm();
+	}
+};
+
+/** Run the clock at SecondsPerGameHour for Frames frames of FrameSeconds */
+void RunClock(URfsnGameClock& Clock, float SecondsPerGameHour, float FrameSeconds, int32 Frames)
+{
+	Clock.SetTimeScale(SecondsPerGameHour);
+	for (int32 Frame = 0; Frame < Frames; Frame++)
+	{
+		Clock.Tick(FrameSeconds);
+	}
+}
+} // namespace RfsnScheduleTests
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRfsnScheduleCompileTest, "Rfsn.Schedule.MatchesLinearScan",
+                                 EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext |
+                                     EAutomationTestFlags::ProductFilter)
+
+bool FRfsnScheduleCompileTest::RunTest(const FString& Parameters)
+{
+	using namespace RfsnBench;
+	using namespace RfsnScheduleTests;
+
+	constexpr int32 MinutesPerWeek = URfsnGameClock::MinutesPerDay * URfsnGameClock::DaysPerWeek;
+	FRandomStream Stream(1357);
+	int32 EntryMismatches = 0;
+	int32 MissedTransitions = 0;
+	int32 Transitions = 0;
+	for (int32 Npc = 0; Npc < NpcCount; Npc++)
+	{
+		const TArray<FRfsnScheduleEntry> Schedule = MakeRandomSchedule(Stream);
+		FRfsnCompiledSchedule Compiled;
+		Compiled.Compile(Schedule);
+
+		// Every minute of a week, and the next boundary from each: nothing may change before it (boundaries are float
+		// hours, so one may land a float step after the minute whose hour already reaches it)
+		constexpr double BoundaryTolerance = 0.001;
+		int32 Previous = INDEX_NONE;
+		double NextTransition = 0.0;
+		for (int32 Minute = 0; Minute < MinutesPerWeek; Minute++)
+		{
+			const int32 Day = Minute / URfsnGameClock::MinutesPerDay;
+			const float Hour = static_cast<float>(Minute % URfsnGameClock::MinutesPerDay) / 60.0f;
+			const int32 Entry = Compiled.FindEntry(Day, Hour);
+			EntryMismatches += Entry != FRfsnCompiledSchedule::FindEntryForTime(Schedule, Hour, Day) ? 1 : 0;
+
+			if (Minute > 0 && Entry != Previous)
+			{
+				Transitions++;
+				MissedTransitions += Minute < NextTransition - BoundaryTolerance ? 1 : 0;
+			}
+			if (Minute >= NextTransition)
+			{
+				NextTransition = Compiled.GetNextTransition(Minute, Day);
+			}
+			Previous = Entry;
+		}
+	}
+
+	AddInfo(FString::Printf(TEXT("%d schedules over a week: %d transitions"), NpcCount, Transitions));
+	TestTrue(TEXT("Schedules change entries"), Transitions > 0);
+	TestEqual(TEXT("Minutes where the compiled entry differs from the linear scan"), EntryMismatches, 0);
+	TestEqual(TEXT("Entry changes before the next transition"), MissedTransitions, 0);
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRfsnScheduleClockTest, "Rfsn.Schedule.ClockBoundaries",
+                                 EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext |
+                                     EAutomationTestFlags::ProductFilter)
+
+bool FRfsnScheduleClockTest::RunTest(const FString& Parameters)
+{
+	using namespace RfsnScheduleTests;
+
+	FRfsnTestWorld World;
+	URfsnGameClock* Clock = World.GetSubsystem<URfsnGameClock>();
+	if (!TestNotNull(TEXT("Game clock"), Clock))
+	{
+		return false;
+	}
+
+	// Day 0 is a Sunday; start at 20:00 so the first boundary is bedtime
+	const TArray<FRfsnScheduleEntry> Schedule = MakeWeekSchedule();
+	Clock->SetGameTime(0, 20.0f);
+	AActor* Npc = World.SpawnActor(FVector::ZeroVector);
+	URfsnNpcSchedule* Component =
+	    World.AddComponent<URfsnNpcSchedule>(Npc, [&Schedule](URfsnNpcSchedule& Added) { Added.Schedule = Schedule; });
+	World.BeginPlay();
+
+	FBoundaryRecorder Recorder;
+	Recorder.Clock = Clock;
+	Recorder.Compiled.Compile(Schedule);
+	Recorder.Evaluate();
+	Recorder.Arm();
+
+	// Boundaries are whole hours and every frame below advances the clock by an exact binary fraction of a minute,
+	// so callbacks fire on the frame that reaches their minute unless a frame steps past it
+	constexpr int32 Work = 0;
+	constexpr int32 Sleep = 1;
+	constexpr int32 Trade = 2;
+	constexpr int32 None = INDEX_NONE;
+	const TArray<FBoundary> Expected = {
+	    // 60 s per game hour, half-minute frames, Sunday 20:00 to Monday 02:00: bedtime, then midnight in bed
+	    {1320.0, 1320.0, Sleep},
+	    {1440.0, 1440.0, Sleep},
+	    // Slowed to 480 s per game hour, 02:00 to 07:00: the pending wake-up keeps its game time
+	    {1800.0, 1800.0, None},
+	    // 2 s per game hour, 15-minute frames, Monday 07:00 to Tuesday 07:00: Monday's trade hour, then Tuesday
+	    {1980.0, 1980.0, Work},
+	    {2160.0, 2160.0, Trade},
+	    {2220.0, 2220.0, Work},
+	    {2460.0, 2460.0, None},
+	    {2760.0, 2760.0, Sleep},
+	    {2880.0, 2880.0, Sleep},
+	    {3240.0, 3240.0, None},
+	    // 0.25 s per game hour, 2-hour frames, Tuesday 07:00 to Wednesday 01:00: no trade hour on Tuesday, and the
+	    // 22:00 and midnight boundaries fire on the first frames past them
+	    {3420.0, 3420.0, Work},
+	    {3900.0, 3900.0, None},
+	    {4200.0, 4260.0, Sleep},
+	    {4320.0, 4380.0, Sleep},
+	    // After the rewind to Monday 10:00, at 2 s per game hour to 14:00: the trade hour fires again, and the
+	    // Wednesday 06:00 timer armed before the rewind never does
+	    {2160.0, 2160.0, Trade},
+	    {2220.0, 2220.0, Work},
+	};
+
+	RunClock(*Clock, 60.0f, 0.5f, 720);
+	TestEqual(TEXT("Midnight reaches Monday"), Clock->GetDay(), 1);
+	TestEqual(TEXT("Component asleep after midnight"), Component->CurrentScheduleIndex, Recorder.Entry);
+	RunClock(*Clock, 480.0f, 2.0f, 1200);
+	TestEqual(TEXT("Component awake after the slow phase"), Component->CurrentScheduleIndex, Recorder.Entry);
+	RunClock(*Clock, 2.0f, 0.5f, 96);
+	TestEqual(TEXT("Fast phase reaches Tuesday"), Clock->GetDay(), 2);
+	TestEqual(TEXT("Component after the fast phase"), Component->CurrentScheduleIndex, Recorder.Entry);
+	RunClock(*Clock, 0.25f, 0.5f, 9);
+	TestEqual(TEXT("Very fast phase reaches Wednesday"), Clock->GetDay(), 3);
+	TestEqual(TEXT("Component after the very fast phase"), Component->CurrentScheduleIndex, Recorder.Entry);
+
+	// Rewinding keeps pending timers, so the schedule drops its own and re-arms, as HandleClockJumped does
+	const int32 FiredBeforeRewind = Recorder.Fired.Num();
+	Clock->SetGameTime(1, 10.0f);
+	Recorder.Evaluate();
+	Recorder.Arm();
+	TestEqual(TEXT("Rewind fires no boundary"), Recorder.Fired.Num(), FiredBeforeRewind);
+	TestEqual(TEXT("Rewound to work"), Recorder.Entry, Work);
+	TestEqual(TEXT("Component re-evaluated on the rewind"), Component->CurrentScheduleIndex, Work);
+	RunClock(*Clock, 2.0f, 0.5f, 16);
+	TestEqual(TEXT("Component after the rewind"), Component->CurrentScheduleIndex, Recorder.Entry);
+
+	if (!TestEqual(TEXT("Boundary callbacks"), Recorder.Fired.Num(), Expected.Num()))
+	{
+		for (const FBoundary& Boundary : Recorder.Fired)
+		{
+			AddInfo(FString::Printf(TEXT("armed %.0f, fired %.2f, entry %d"), Boundary.Armed, Boundary.Fired,
+			                        Boundary.Entry));
+		}
+		return true;
+	}
+	for (int32 i = 0; i < Expected.Num(); i++)
+	{
+		const FString What = FString::Printf(TEXT("Callback %d"), i);
+		TestEqual(What + TEXT(" armed for"), Recorder.Fired[i].Armed, Expected[i].Armed);
+		TestEqual(What + TEXT(" fired at"), Recorder.Fired[i].Fired, Expected[i].Fired);
+		TestEqual(What + TEXT(" entry"), Recorder.Fired[i].Entry, Expected[i].Entry);
+	}
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
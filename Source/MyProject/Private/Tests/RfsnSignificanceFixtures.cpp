@@ -0,0 +1,84 @@
+// RFSN Significance Fixtures Implementation
+
+#include "RfsnSignificanceFixtures.h"
+#include "RfsnBenchFixtures.h"
+#include "RfsnNpcAwareness.h"
+#include "GameFramework/PlayerController.h"
+
+namespace RfsnBench
+{
+void FSignificanceWorld::Build(int32 NpcCount, TFunctionRef<void(URfsnSignificanceManager&)> Configure)
+{
+	UWorld* World = TestWorld.GetWorld();
+	Manager = TestWorld.GetSubsystem<URfsnSignificanceManager>();
+	Configure(*Manager);
+
+	// GetPlayerPawn finds the pawn through its controller, as it would in a game
+	APlayerController* Controller = World->SpawnActor<APlayerController>();
+	Player = World->SpawnActor<APawn>();
+	USceneComponent* PlayerRoot = NewObject<USceneComponent>(Player, TEXT("Root"));
+	Player->SetRootComponent(PlayerRoot);
+	PlayerRoot->RegisterComponent();
+	Controller->Possess(Player);
+
+	const float Half = PerceptionArea * 0.5f;
+	for (int32 i = 0; i < NpcCount; i++)
+	{
+		const FVector Location(Stream.FRandRange(-Half, Half), Stream.FRandRange(-Half, Half), 0.0f);
+		AActor* Npc = TestWorld.SpawnActor(Location);
+		for (const FRfsnSignificanceTickRow& Row : Manager->TickTable)
+		{
+			if (!Row.ComponentClass)
+			{
+				continue;
+			}
+
+			UActorComponent* Component = NewObject<UActorComponent>(Npc, Row.ComponentClass.Get());
+			if (URfsnNpcAwareness* Awareness = Cast<URfsnNpcAwareness>(Component))
+			{
+				// Batched awareness switches its own tick off; the unbatched path is what the table throttles
+				Awareness->bUseBatchedPerception = false;
+			}
+			Npc->AddInstanceComponent(Component);
+			Component->RegisterComponent();
+			Components.Add(Component);
+		}
+		Manager->RegisterNpc(Npc);
+		Npcs.Add(Npc);
+	}
+
+	LastTickTimes.Init(-1.0f, Components.Num());
+	Buckets.Init(ERfsnSignificanceBucket::Critical, Npcs.Num());
+}
+
+void FSignificanceWorld::Step()
+{
+	const float Half = PerceptionArea * 0.5f;
+	const float Yaw = Stream.FRandRange(-0.02f, 0.02f);
+	Heading = FVector(Heading.X * FMath::Cos(Yaw) - Heading.Y * FMath::Sin(Yaw),
+	                  Heading.X * FMath::Sin(Yaw) + Heading.Y * FMath::Cos(Yaw), 0.0f);
+	FVector Location = Player->GetActorLocation() + Heading * (400.0f * SignificanceFrameTime);
+	if (FMath::Abs(Location.X) > Half || FMath::Abs(Location.Y) > Half)
+	{
+		Heading = -Heading;
+		Location.X = FMath::Clamp(Location.X, -Half, Half);
+		Location.Y = FMath::Clamp(Location.Y, -Half, Half);
+	}
+	Player->SetActorLocation(Location);
+
+	TestWorld.Tick(SignificanceFrameTime);
+
+	for (int32 i = 0; i < Components.Num(); i++)
+	{
+		const float LastTick = Components[i]->PrimaryComponentTick.GetLastTickGameTime();
+		Ticks += LastTick != LastTickTimes[i] ? 1 : 0;
+		LastTickTimes[i] = LastTick;
+	}
+	for (int32 i = 0; i < Npcs.Num(); i++)
+	{
+		const ERfsnSignificanceBucket Bucket = Manager->GetBucket(Npcs[i]);
+		Changes += Bucket != Buckets[i] ? 1 : 0;
+		Buckets[i] = Bucket;
+	}
+}
+} // namespace RfsnBench
@@ -0,0 +1,51 @@
+// RFSN Significance Fixtures
+// Spawned NPCs carrying every throttled component, and a player walking through them
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "RfsnSignificanceManager.h"
+#include "RfsnTestWorld.h"
+#include "GameFramework/Pawn.h"
+
+namespace RfsnBench
+{
+/** Length of the significance run (seconds at 60 fps) */
+constexpr float SignificanceSeconds = 60.0f;
+constexpr float SignificanceFrameTime = 1.0f / 60.0f;
+
+/**
+ * NPCs spread over the perception area, each carrying a component for every row of the significance manager's
+ * tick table, and a possessed pawn for the player walking through them. Ticks are counted from the components'
+ * tick functions, so they are the ticks the world actually ran.
+ */
+struct FSignificanceWorld
+{
+	FRfsnTestWorld TestWorld;
+	URfsnSignificanceManager* Manager = nullptr;
+	APawn* Player = nullptr;
+	TArray<AActor*> Npcs;
+
+	/** Component ticks and NPC bucket changes so far */
+	int64 Ticks = 0;
+	int32 Changes = 0;
+
+	/** NpcCount NPCs registered with the manager once Configure has set it up */
+	void Build(int32 NpcCount, TFunctionRef<void(URfsnSignificanceManager&)> Configure);
+
+	void BeginPlay() { TestWorld.BeginPlay(); }
+
+	/** Walk the player one frame, tick the world and count what ticked */
+	void Step();
+
+	/** Every component the manager may throttle */
+	const TArray<UActorComponent*>& GetComponents() const { return Components; }
+
+private:
+	TArray<UActorComponent*> Components;
+	TArray<float> LastTickTimes;
+	TArray<ERfsnSignificanceBucket> Buckets;
+	FVector Heading = FVector(1.0f, 0.0f, 0.0f);
+	FRandomStream Stream = FRandomStream(8642);
+};
+} // namespace RfsnBench
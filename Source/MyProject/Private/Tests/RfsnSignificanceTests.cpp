@@ -0,0 +1,171 @@
+// RFSN Significance Tests
+// Bucket selection with hysteresis, and the component ticks the manager saves on 300 spawned NPCs
+
+#include "RfsnSignificanceFixtures.h"
+#include "RfsnSignificanceManager.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace RfsnSignificanceTests
+{
+constexpr int32 NpcCount = 300;
+
+/** Ten seconds of the player's walk */
+constexpr int32 Frames = 600;
+
+/** Seconds to run Frames of World */
+double Run(RfsnBench::FSignificanceWorld& World)
+{
+	World.BeginPlay();
+	const double Start = FPlatformTime::Seconds();
+	for (int32 Frame = 0; Frame < Frames; Frame++)
+	{
+		World.Step();
+	}
+	return FPlatformTime::Seconds() - Start;
+}
+} // namespace RfsnSignificanceTests
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRfsnSignificanceBucketTest, "Rfsn.Significance.Buckets",
+                                 EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext |
+                                     EAutomationTestFlags::ProductFilter)
+
+bool FRfsnSignificanceBucketTest::RunTest(const FString& Parameters)
+{
+	const FRfsnSignificanceSettings Settings;
+
+	FRfsnSignificanceInputs Inputs;
+	Inputs.Distance = Settings.MaxDistance * 2.0f;
+	TestEqual(TEXT("Out of range, unseen and unaware scores 0"), Settings.Score(Inputs), 0.0f);
+	Inputs.bInDialogue = true;
+	TestEqual(TEXT("Dialogue scores 1"), Settings.Score(Inputs), 1.0f);
+
+	const float Held = Settings.MinDemotionDelay * 2.0f;
+	TestEqual(TEXT("Promotion is immediate"),
+	          Settings.SelectBucket(Settings.CriticalScore, ERfsnSignificanceBucket::Dormant, 0.0f),
+	          ERfsnSignificanceBucket::Critical);
+	TestEqual(TEXT("Demotion waits for the delay"),
+	          Settings.SelectBucket(0.0f, ERfsnSignificanceBucket::Critical, Settings.MinDemotionDelay * 0.5f),
+	          ERfsnSignificanceBucket::Critical);
+	TestEqual(TEXT("Demotion waits for the score to clear the hysteresis band"),
+	          Settings.SelectBucket(Settings.HighScore - Settings.Hysteresis * 0.5f, ERfsnSignificanceBucket::High,
+	                                Held),
+	          ERfsnSignificanceBucket::High);
+	TestEqual(TEXT("Demotion lands in the bucket the score falls in"),
+	          Settings.SelectBucket(Settings.MediumScore, ERfsnSignificanceBucket::High, Held),
+	          ERfsnSignificanceBucket::Medium);
+	TestEqual(TEXT("Below Low is Dormant"), Settings.SelectBucket(0.0f, ERfsnSignificanceBucket::High, Held),
+	          ERfsnSignificanceBucket::Dormant);
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRfsnSignificanceTicksTest, "Rfsn.Significance.ComponentTicks",
+                                 EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext |
+                                     EAutomationTestFlags::ProductFilter)
+
+bool FRfsnSignificanceTicksTest::RunTest(const FString& Parameters)
+{
+	using namespace RfsnBench;
+	using namespace RfsnSignificanceTests;
+
+	FSignificanceWorld Fixed;
+	Fixed.Build(NpcCount, [](URfsnSignificanceManager& Manager) { Manager.bEnabled = false; });
+	const double FixedSeconds = Run(Fixed);
+
+	FSignificanceWorld Managed;
+	Managed.Build(NpcCount, [](URfsnSignificanceManager&) {});
+	const double ManagedSeconds = Run(Managed);
+
+	AddInfo(FString::Printf(TEXT("%d NPCs, %d components: %lld ticks in %.1f ms at fixed rates, %lld in %.1f ms "
+	                             "with significance"),
+	                        NpcCount, Managed.GetComponents().Num(), Fixed.Ticks, FixedSeconds * 1e3, Managed.Ticks,
+	                        ManagedSeconds * 1e3));
+	TestEqual(TEXT("Disabled manager leaves every NPC Critical"), Fixed.Changes, 0);
+	TestTrue(TEXT("Significance ticks fewer components"), Managed.Ticks < Fixed.Ticks);
+
+	// Each component runs at its row's interval for its NPC's bucket, or is off where the row allows dormancy
+	URfsnSignificanceManager* Manager = Managed.Manager;
+	int32 Dormant = 0;
+	int32 Mismatches = 0;
+	for (AActor* Npc : Managed.Npcs)
+	{
+		const ERfsnSignificanceBucket Bucket = Manager->GetBucket(Npc);
+		Dormant += Bucket == ERfsnSignificanceBucket::Dormant ? 1 : 0;
+
+		TInlineComponentArray<UActorComponent*> Components(Npc);
+		for (const UActorComponent* Component : Components)
+		{
+			const FRfsnSignificanceTickRow* Row = Manager->FindRow(Component->GetClass());
+			if (!Row)
+			{
+				continue;
+			}
+			const bool bOff = Bucket == ERfsnSignificanceBucket::Dormant && Row->bAllowDormant;
+			const bool bExpected = bOff ? !Component->IsComponentTickEnabled()
+			                            : Component->IsComponentTickEnabled() &&
+			                                  Component->GetComponentTickInterval() == Row->GetInterval(Bucket);
+			Mismatches += bExpected ? 0 : 1;
+		}
+	}
+	TestTrue(TEXT("NPCs far from the player are dormant"), Dormant > 0);
+	TestEqual(TEXT("Components off their row's rate"), Mismatches, 0);
+
+	// Unregistering hands every component back at its own rate
+	for (AActor* Npc : Managed.Npcs)
+	{
+		Manager->UnregisterNpc(Npc);
+	}
+	const TArray<UActorComponent*>& Restored = Managed.GetComponents();
+	const TArray<UActorComponent*>& Defaults = Fixed.GetComponents();
+	int32 NotRestored = 0;
+	for (int32 i = 0; i < Restored.Num(); i++)
+	{
+		NotRestored += Restored[i]->IsComponentTickEnabled() &&
+		                       Restored[i]->GetComponentTickInterval() == Defaults[i]->GetComponentTickInterval()
+		                   ? 0
+		                   : 1;
+	}
+	TestEqual(TEXT("Components not restored on unregister"), NotRestored, 0);
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRfsnSignificanceLateIntervalTest, "Rfsn.Significance.LateIntervals",
+                                 EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext |
+                                     EAutomationTestFlags::ProductFilter)
+
+bool FRfsnSignificanceLateIntervalTest::RunTest(const FString& Parameters)
+{
+	using namespace RfsnBench;
+	using namespace RfsnSignificanceTests;
+
+	// The client registers its NPC in its own BeginPlay, before siblings later in the actor set their intervals
+	FSignificanceWorld World;
+	World.Build(20, [](URfsnSignificanceManager&) {});
+	TArray<float> Late;
+	for (UActorComponent* Component : World.GetComponents())
+	{
+		Component->SetComponentTickInterval(Component->GetComponentTickInterval() + 0.25f);
+		Late.Add(Component->GetComponentTickInterval());
+	}
+	Run(World);
+
+	for (AActor* Npc : World.Npcs)
+	{
+		World.Manager->UnregisterNpc(Npc);
+	}
+	const TArray<UActorComponent*>& Restored = World.GetComponents();
+	int32 NotRestored = 0;
+	for (int32 i = 0; i < Restored.Num(); i++)
+	{
+		NotRestored += Restored[i]->IsComponentTickEnabled() && Restored[i]->GetComponentTickInterval() == Late[i]
+		                   ? 0
+		                   : 1;
+	}
+	TestTrue(TEXT("NPCs changed bucket"), World.Changes > 0);
+	TestEqual(TEXT("Components not restored to the interval set after registration"), NotRestored, 0);
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,128 @@
+// RFSN Stream Replay Fixtures Implementation
+
+#include "RfsnStreamReplayFixtures.h"
+
+namespace RfsnBench
+{
+/** Words for synthetic stream sentences; several are multi-byte in UTF-8 so chunk cuts land inside characters */
+const TCHAR* const StreamWords[] = {TEXT("the"),    TEXT("café"),  TEXT("tower"), TEXT("naïve"), TEXT("—"),
+                                    TEXT("wolves"), TEXT("radio"), TEXT("日本"),  TEXT("north"), TEXT("☃"),
+                                    TEXT("camp"),   TEXT("mañana"), TEXT("stranger")};
+
+const TCHAR* const StreamActions[] = {TEXT("greet"), TEXT("warn"), TEXT("trade"), TEXT("answer"), TEXT("threaten")};
+
+FRfsnStreamSession MakeStreamSession(int32 Dialogues, int32 SplitSeed, int32 MaxChunk)
+{
+	FRandomStream Content(1357);
+	FRandomStream Splits(SplitSeed);
+	FRfsnStreamSession Session;
+	Session.NpcId = TEXT("npc_replay");
+	int64 TimeUs = 0;
+
+	TArray<uint8> Bytes;
+	auto Append = [&Bytes](const FString& Text)
+	{
+		const FTCHARToUTF8 Utf8(*Text);
+		Bytes.Append(reinterpret_cast<const uint8*>(Utf8.Get()), Utf8.Length());
+	};
+	auto AddChunks = [&](int32 Begin, int32 End)
+	{
+		while (Begin < End)
+		{
+			const int32 Size = FMath::Min(Splits.RandRange(1, MaxChunk), End - Begin);
+			TimeUs += Splits.RandRange(500, 40000);
+			Session.Add(ERfsnSessionEvent::Chunk, TimeUs, Bytes.GetData() + Begin, Size);
+			Begin += Size;
+		}
+	};
+
+	for (int32 d = 0; d < Dialogues; d++)
+	{
+		TimeUs += 2000000;
+		Session.Add(ERfsnSessionEvent::Request, TimeUs,
+		            FString::Printf(TEXT("{\"user_input\":\"line %d\",\"npc_state\":{\"npc_id\":\"npc_replay\"}}"), d));
+		Bytes.Reset();
+
+		// 10% server errors, 10% dropped connections, 10% cancelled, the rest complete
+		const float Ending = Content.FRand();
+		if (Ending < 0.1f)
+		{
+			Append(TEXT("{\"detail\":\"orchestrator overloaded\"}"));
+			AddChunks(0, Bytes.Num());
+			Session.Add(ERfsnSessionEvent::Failed, TimeUs, nullptr, 0, 503);
+			Session.Tally.Errors++;
+			continue;
+		}
+		const bool bComplete = Ending >= 0.3f;
+
+		// Lines the client counts, as the number of bytes needed to have received them whole
+		const int32 NoMeta = MAX_int32;
+		int32 MetaEnd = NoMeta;
+		TArray<int32> SentenceEnds;
+
+		Append(TEXT(": keep-alive\n\n"));
+		if (Content.FRand() < 0.8f)
+		{
+			Append(TEXT("event: meta\n"));
+			Append(FString::Printf(TEXT("data: {\"player_signal\":\"greet\",\"bandit_key\":\"k%d\",\"npc_action\":"
+			                            "\"%s\",\"action_mode\":\"talk\",\"instant_bark\":\"Hmm\"}\n"),
+			                       d, StreamActions[Content.RandRange(0, UE_ARRAY_COUNT(StreamActions) - 1)]));
+			MetaEnd = Bytes.Num();
+			Append(TEXT("\n"));
+		}
+
+		const int32 NumSentences = Content.RandRange(1, 6);
+		for (int32 i = 0; i < NumSentences; i++)
+		{
+			FString Text;
+			const int32 NumWords = Content.RandRange(3, 10);
+			for (int32 w = 0; w < NumWords; w++)
+			{
+				Text += w > 0 ? TEXT(" ") : TEXT("");
+				Text += StreamWords[Content.RandRange(0, UE_ARRAY_COUNT(StreamWords) - 1)];
+			}
+			const bool bFinal = i == NumSentences - 1;
+			Append(FString::Printf(TEXT("data: {\"sentence\":\"%s.\",\"is_final\":%s,\"latency_ms\":%d}"), *Text,
+			                       bFinal ? TEXT("true") : TEXT("false"), Content.RandRange(20, 400)));
+
+			// A completed stream may end without a newline; the client still parses that last line
+			const bool bTerminated = !(bFinal && bComplete && Content.FRand() < 0.3f);
+			Append(bTerminated ? TEXT("\n") : TEXT(""));
+			SentenceEnds.Add(Bytes.Num());
+			Append(bTerminated ? TEXT("\n") : TEXT(""));
+		}
+
+		if (bComplete)
+		{
+			AddChunks(0, Bytes.Num());
+			Session.Add(ERfsnSessionEvent::Complete, TimeUs, nullptr, 0, 200);
+			Session.Add(ERfsnSessionEvent::TtsRequest, TimeUs, FString::Printf(TEXT("{\"text\":\"line %d\"}"), d));
+			Session.Add(ERfsnSessionEvent::TtsResponse, TimeUs + 80000, FString::Printf(TEXT("tts/%d.wav"), d), 200);
+			Session.Tally.Dialogues++;
+			Session.Tally.Metas += MetaEnd != NoMeta ? 1 : 0;
+			Session.Tally.Sentences += NumSentences;
+			continue;
+		}
+
+		// Only lines whose newline arrived before the cut are parsed
+		const int32 Cut = Content.RandRange(1, Bytes.Num() - 1);
+		AddChunks(0, Cut);
+		Session.Tally.Metas += MetaEnd <= Cut ? 1 : 0;
+		for (const int32 End : SentenceEnds)
+		{
+			Session.Tally.Sentences += End <= Cut ? 1 : 0;
+		}
+
+		if (Ending < 0.2f)
+		{
+			Session.Add(ERfsnSessionEvent::Failed, TimeUs, nullptr, 0, 0);
+			Session.Tally.Errors++;
+		}
+		else
+		{
+			Session.Add(ERfsnSessionEvent::Cancel, TimeUs, nullptr, 0);
+		}
+	}
+	return Session;
+}
+} // namespace RfsnBench
@@ -0,0 +1,18 @@
+// RFSN Stream Replay Fixtures
+// Synthetic recorded sessions with known tallies
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "RfsnStreamSession.h"
+
+namespace RfsnBench
+{
+/**
+ * A recorded session as URfsnNpcClientComponent would capture it: each dialogue's SSE bytes cut into chunks of up
+ * to MaxChunk bytes (mid-line and mid-character), most completing, some failing, dropping or cancelled part way.
+ * The content depends only on Dialogues, the chunk cuts and timing on SplitSeed; Tally is what a faithful client
+ * parses from it.
+ */
+FRfsnStreamSession MakeStreamSession(int32 Dialogues, int32 SplitSeed, int32 MaxChunk);
+} // namespace RfsnBench
@@ -0,0 +1,200 @@
+// RFSN Stream Replay Tests
+// Session files and headless playback of recorded dialogue streams through the NPC client
+
+#include "RfsnLoadTest.h"
+#include "RfsnNpcClientComponent.h"
+#include "RfsnStreamReplayFixtures.h"
+#include "RfsnStreamSession.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/AutomationTest.h"
+#include "Misc/Paths.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace RfsnStreamReplayTests
+{
+constexpr int32 Dialogues = 20;
+
+/**
+ * Checked-in recording of six dialogues: completed replies with and without meta, a last line missing its
+ * newline, chunk splits inside multi-byte characters, a TTS round trip, a 503, a dropped connection and a cancel
+ */
+FString GetFixturePath()
+{
+	return FPaths::GameSourceDir() / TEXT("MyProject/Private/Tests/Fixtures/StreamReplay.rfsnsession");
+}
+
+/** What the client must make of the fixture */
+FRfsnSessionTally GetFixtureTally()
+{
+	FRfsnSessionTally Tally;
+	Tally.Dialogues = 3;
+	Tally.Metas = 3;
+	Tally.Sentences = 11;
+	Tally.Errors = 2;
+	return Tally;
+}
+} // namespace RfsnStreamReplayTests
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRfsnStreamReplayFileTest, "Rfsn.StreamReplay.File",
+                                 EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext |
+                                     EAutomationTestFlags::ProductFilter)
+
+bool FRfsnStreamReplayFileTest::RunTest(const FString& Parameters)
+{
+	using namespace RfsnStreamReplayTests;
+
+	const FRfsnStreamSession Recorded = RfsnBench::MakeStreamSession(Dialogues, 11, 64);
+	const TArray<uint8> File = Recorded.ToBytes();
+	TestTrue(TEXT("File smaller than payload"), File.Num() < Recorded.GetPayloadBytes());
+
+	FRfsnStreamSession Loaded;
+	TestTrue(TEXT("Loaded"), Loaded.FromBytes(File));
+	TestEqual(TEXT("NPC"), Loaded.NpcId, Recorded.NpcId);
+	TestTrue(TEXT("Events"), Loaded.Events == Recorded.Events);
+	TestTrue(TEXT("Tally"), Loaded.Tally == Recorded.Tally);
+
+	// Damaged files are rejected and leave the session empty
+	TArray<uint8> Corrupt = File;
+	Corrupt[Corrupt.Num() / 2] ^= 0x5A;
+	TArray<uint8> Truncated = File;
+	Truncated.SetNum(File.Num() - 7);
+	FRfsnStreamSession Rejected;
+	TestFalse(TEXT("Corrupt file loaded"), Rejected.FromBytes(Corrupt));
+	TestTrue(TEXT("Empty after corrupt file"), Rejected.IsEmpty());
+	TestFalse(TEXT("Truncated file loaded"), Rejected.FromBytes(Truncated));
+	TestTrue(TEXT("Empty after truncated file"), Rejected.IsEmpty());
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRfsnStreamReplayPlaybackTest, "Rfsn.StreamReplay.Playback",
+                                 EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext |
+                                     EAutomationTestFlags::ProductFilter)
+
+bool FRfsnStreamReplayPlaybackTest::RunTest(const FString& Parameters)
+{
+	using namespace RfsnStreamReplayTests;
+
+	const TSharedPtr<const FRfsnStreamSession> Session =
+	    MakeShared<FRfsnStreamSession>(RfsnBench::MakeStreamSession(Dialogues, 11, 64));
+	URfsnNpcClientComponent* Client = NewObject<URfsnNpcClientComponent>(GetTransientPackage());
+	Client->PlaySession(Session, 0.0f);
+	TestFalse(TEXT("Still playing"), Client->IsPlayingSession());
+	TestTrue(TEXT("Playback matches recording"), Client->GetPlaybackTally() == Session->Tally);
+
+	// The same traffic cut into 1-3 byte chunks must parse identically
+	const TSharedPtr<const FRfsnStreamSession> Rechunked =
+	    MakeShared<FRfsnStreamSession>(RfsnBench::MakeStreamSession(Dialogues, 97, 3));
+	Client->PlaySession(Rechunked, 0.0f);
+	TestTrue(TEXT("Rechunked playback matches"), Client->GetPlaybackTally() == Session->Tally);
+
+	Client->PlaySession(Session, 0.0f);
+	TestTrue(TEXT("Repeat playback matches"), Client->GetPlaybackTally() == Session->Tally);
+	TestFalse(TEXT("Dialogue left active"), Client->IsDialogueActive());
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRfsnStreamReplayFixtureTest, "Rfsn.StreamReplay.Fixture",
+                                 EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext |
+                                     EAutomationTestFlags::ProductFilter)
+
+bool FRfsnStreamReplayFixtureTest::RunTest(const FString& Parameters)
+{
+	using namespace RfsnStreamReplayTests;
+
+	const TSharedPtr<FRfsnStreamSession> Session = MakeShared<FRfsnStreamSession>();
+	if (!TestTrue(TEXT("Fixture loaded"), Session->LoadFromFile(GetFixturePath())))
+	{
+		return false;
+	}
+	const FRfsnSessionTally Expected = GetFixtureTally();
+	TestEqual(TEXT("NPC"), Session->NpcId, FString(TEXT("npc_fixture")));
+	TestEqual(TEXT("Recorded dialogues"), Session->Tally.Dialogues, Expected.Dialogues);
+	TestEqual(TEXT("Recorded metas"), Session->Tally.Metas, Expected.Metas);
+	TestEqual(TEXT("Recorded sentences"), Session->Tally.Sentences, Expected.Sentences);
+	TestEqual(TEXT("Recorded errors"), Session->Tally.Errors, Expected.Errors);
+
+	URfsnNpcClientComponent* Client = NewObject<URfsnNpcClientComponent>(GetTransientPackage());
+	Client->PlaySession(Session, 0.0f);
+	const FRfsnSessionTally Played = Client->GetPlaybackTally();
+	TestFalse(TEXT("Still playing"), Client->IsPlayingSession());
+	TestEqual(TEXT("Played dialogues"), Played.Dialogues, Expected.Dialogues);
+	TestEqual(TEXT("Played metas"), Played.Metas, Expected.Metas);
+	TestEqual(TEXT("Played sentences"), Played.Sentences, Expected.Sentences);
+	TestEqual(TEXT("Played errors"), Played.Errors, Expected.Errors);
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRfsnStreamReplayBudgetTest, "Rfsn.StreamReplay.Budgets",
+                                 EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext |
+                                     EAutomationTestFlags::ProductFilter)
+
+bool FRfsnStreamReplayBudgetTest::RunTest(const FString& Parameters)
+{
+	using namespace RfsnStreamReplayTests;
+
+	const TSharedPtr<FRfsnStreamSession> Session = MakeShared<FRfsnStreamSession>();
+	if (!TestTrue(TEXT("Fixture loaded"), Session->LoadFromFile(GetFixturePath())))
+	{
+		return false;
+	}
+
+	// A crowd that receives the whole fixture in one frame, every frame: far more traffic than a real frame
+	// carries, so a regression in the parsing path shows against the load test's own budgets
+	constexpr int32 Crowd = 100;
+	constexpr int32 Frames = 20;
+	const URfsnLoadTest* Budgets = GetDefault<URfsnLoadTest>();
+	TArray<URfsnNpcClientComponent*> Clients;
+	for (int32 i = 0; i < Crowd; i++)
+	{
+		Clients.Add(NewObject<URfsnNpcClientComponent>(GetTransientPackage()));
+	}
+
+	// The client logs every sentence; quieted so the frames measure parsing
+#if !NO_LOGGING
+	const ELogVerbosity::Type TempVerbosity = LogTemp.GetVerbosity();
+	LogTemp.SetVerbosity(ELogVerbosity::Fatal);
+#endif
+
+	// The allocation budget is approximate: the engine doesn't count allocations per system, so resident-memory
+	// growth over the run stands in for it. Other threads and allocator caching move this number too, so it only
+	// catches gross regressions such as sessions or tallies that are never freed
+	const uint64 StartMemory = FPlatformMemory::GetStats().UsedPhysical;
+	TArray<float> FrameMs;
+	int32 Mismatches = 0;
+	for (int32 Frame = 0; Frame < Frames; Frame++)
+	{
+		const double Start = FPlatformTime::Seconds();
+		for (URfsnNpcClientComponent* Client : Clients)
+		{
+			Client->PlaySession(Session, 0.0f);
+		}
+		FrameMs.Add(static_cast<float>((FPlatformTime::Seconds() - Start) * 1000.0));
+
+		for (const URfsnNpcClientComponent* Client : Clients)
+		{
+			Mismatches += Client->GetPlaybackTally() == GetFixtureTally() ? 0 : 1;
+		}
+	}
+	const uint64 EndMemory = FPlatformMemory::GetStats().UsedPhysical;
+
+#if !NO_LOGGING
+	LogTemp.SetVerbosity(TempVerbosity);
+#endif
+
+	FrameMs.Sort();
+	const float FrameMsP95 = FrameMs[FMath::Min(FrameMs.Num() * 95 / 100, FrameMs.Num() - 1)];
+	const double MemoryDeltaMb =
+	    (static_cast<double>(EndMemory) - static_cast<double>(StartMemory)) / (1024.0 * 1024.0);
+	AddInfo(FString::Printf(TEXT("%d NPCs: frame p95 %.2f ms (budget %.1f), memory %+.2f MB (budget %.1f)"), Crowd,
+	                        FrameMsP95, Budgets->FrameMsBudgetP95, MemoryDeltaMb, Budgets->MemoryBudgetMb));
+
+	TestEqual(TEXT("Playbacks that differ from the recording"), Mismatches, 0);
+	TestTrue(TEXT("Frame time p95 within budget"),
+	         Budgets->FrameMsBudgetP95 <= 0.0f || FrameMsP95 <= Budgets->FrameMsBudgetP95);
+	TestTrue(TEXT("Memory growth within budget"),
+	         Budgets->MemoryBudgetMb <= 0.0f || MemoryDeltaMb <= Budgets->MemoryBudgetMb);
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
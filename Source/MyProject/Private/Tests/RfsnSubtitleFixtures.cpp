@@ -0,0 +1,85 @@
+// RFSN Subtitle Fixtures Implementation
+
+#include "RfsnSubtitleFixtures.h"
+
+namespace RfsnBench
+{
+float MeasureSubtitleRun(const FString& Text, int32 Start, int32 End)
+{
+	float Width = 0.0f;
+	for (int32 Index = Start; Index < End; Index++)
+	{
+		Width += 6.0f + Text[Index] % 7;
+	}
+	return Width;
+}
+
+FRfsnSubtitleStream MakeSubtitleStream()
+{
+	FRfsnSubtitleStream Stream;
+	Stream.RevealSpeed = SubtitleRevealSpeed;
+	Stream.Layout.MaxWidth = SubtitleWidth;
+	Stream.Layout.MeasureRun = &MeasureSubtitleRun;
+	return Stream;
+}
+
+void TokenizeReply(const FString& Text, TArray<FString>& OutTokens)
+{
+	TArray<FString> Words;
+	Text.ParseIntoArray(Words, TEXT(" "));
+	OutTokens.Reset(Words.Num());
+	for (int32 Index = 0; Index < Words.Num(); Index++)
+	{
+		OutTokens.Add(Index > 0 ? TEXT(" ") + Words[Index] : Words[Index]);
+	}
+}
+
+double SimulateSubtitles(FRfsnSubtitleStream& Stream, const TArray<FString>& Tokens, bool bPerToken,
+                         TArray<FString>& OutLines)
+{
+	double Now = 0.0;
+	double FirstCharacterMs = -1.0;
+	int32 Next = 0;
+	FString Pending;
+
+	for (int32 Frame = 0; Frame < 100000 && (Next < Tokens.Num() || Stream.IsShowing()); Frame++)
+	{
+		Now += SubtitleFrameMs;
+		while (Next < Tokens.Num() && SubtitleFirstTokenMs + Next * SubtitleTokenGapMs <= Now)
+		{
+			const bool bLast = Next == Tokens.Num() - 1;
+			if (bPerToken)
+			{
+				Stream.Append(Tokens[Next], bLast);
+			}
+			else
+			{
+				Pending += Tokens[Next];
+				if (bLast || FRfsnSubtitleStream::EndsSentence(Tokens[Next]))
+				{
+					Stream.Append(Pending, bLast);
+					Pending.Reset();
+				}
+			}
+			Next++;
+		}
+
+		Stream.Reveal(static_cast<float>(SubtitleFrameMs / 1000.0));
+		if (FirstCharacterMs < 0.0 && !Stream.GetDisplayText().IsEmpty())
+		{
+			FirstCharacterMs = Now;
+		}
+
+		// Lines are taken as soon as they are done; the display duration doesn't matter here
+		if (Stream.IsShowing() && !Stream.IsCurrentOpen() && Stream.IsFullyRevealed())
+		{
+			OutLines.Add(Stream.GetFullText());
+			if (!Stream.ShowNext())
+			{
+				Stream.Reset();
+			}
+		}
+	}
+	return FirstCharacterMs;
+}
+} // namespace RfsnBench
@@ -0,0 +1,73 @@
+// RFSN Subtitle Fixtures
+// Token-paced replies on a simulated clock, and the sentence-queue widget the subtitle stream replaced
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "RfsnDialogueWidget.h"
+
+namespace RfsnBench
+{
+/** mock_server.py default pacing: first token after 0.3 s, then 20 tokens per second; 60 fps display */
+constexpr double SubtitleFirstTokenMs = 300.0;
+constexpr double SubtitleTokenGapMs = 50.0;
+constexpr double SubtitleFrameMs = 1000.0 / 60.0;
+constexpr float SubtitleRevealSpeed = 40.0f;
+constexpr float SubtitleWidth = 400.0f;
+
+const TCHAR* const SubtitleReplies[] = {
+    TEXT("The radio tower is past the old quarry. Keep to the road after dark! Nobody comes back from the "
+         "marsh, and I mean nobody."),
+    TEXT("I sell rope, lamp oil and tinned fish. Fair prices, mostly. Ask the fisherman if you want bait."),
+    TEXT("Trust is earned out here... You helped Mara, so I'll listen. Don't make me regret it?"),
+};
+
+/** Glyph widths that only depend on the character, so any split of a string measures the same */
+float MeasureSubtitleRun(const FString& Text, int32 Start, int32 End);
+
+/** A subtitle stream at the benchmark's reveal speed, width and glyph widths */
+FRfsnSubtitleStream MakeSubtitleStream();
+
+/** Split like mock_server.tokenize: one token per word, the separating space on the token after it */
+void TokenizeReply(const FString& Text, TArray<FString>& OutTokens);
+
+/**
+ * Plays a reply into the stream on a simulated clock, one token event per token or one per finished sentence,
+ * and collects each line once it is closed and fully revealed. Returns when the first character showed (ms).
+ */
+double SimulateSubtitles(FRfsnSubtitleStream& Stream, const TArray<FString>& Tokens, bool bPerToken,
+                         TArray<FString>& OutLines);
+
+/** The old widget: sentences queued in an array, display rebuilt with Left() and laid out again each step */
+struct FLegacySubtitles
+{
+	TArray<FString> Queue;
+	FString Full;
+	FString Display;
+	float Progress = 0.0f;
+	FRfsnSubtitleLayout Layout;
+	int32 MeasuredChars = 0;
+
+	bool Next()
+	{
+		if (Queue.Num() == 0)
+		{
+			return false;
+		}
+		Full = Queue[0];
+		Queue.RemoveAt(0);
+		Display.Reset();
+		Progress = 0.0f;
+		return true;
+	}
+
+	void Step(float DeltaTime)
+	{
+		Progress += DeltaTime * SubtitleRevealSpeed;
+		Display = Full.Left(FMath::Min(FMath::FloorToInt(Progress), Full.Len()));
+		Layout.Reset();
+		Layout.Append(Display);
+		MeasuredChars += Layout.GetMeasuredChars();
+	}
+};
+} // namespace RfsnBench
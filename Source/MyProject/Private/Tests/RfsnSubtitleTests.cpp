@@ -0,0 +1,188 @@
+// RFSN Subtitle Tests
+// Streaming subtitles: line order, interruption, incremental wrapping and the ring queue
+
+#include "RfsnDialogueWidget.h"
+#include "RfsnSubtitleFixtures.h"
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRfsnSubtitleOrderTest, "Rfsn.Subtitles.LineOrder",
+                                 EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext |
+                                     EAutomationTestFlags::ProductFilter)
+
+bool FRfsnSubtitleOrderTest::RunTest(const FString& Parameters)
+{
+	using namespace RfsnBench;
+
+	// Every reply comes out as its sentences, in order, whether streamed per token or per sentence
+	for (const TCHAR* Reply : SubtitleReplies)
+	{
+		TArray<FString> Tokens;
+		TokenizeReply(Reply, Tokens);
+
+		TArray<FString> TokenLines;
+		TArray<FString> SentenceLines;
+		FRfsnSubtitleStream PerToken = MakeSubtitleStream();
+		FRfsnSubtitleStream PerSentence = MakeSubtitleStream();
+		const double TokenFirstMs = SimulateSubtitles(PerToken, Tokens, true, TokenLines);
+		const double SentenceFirstMs = SimulateSubtitles(PerSentence, Tokens, false, SentenceLines);
+
+		TestEqual(TEXT("Per-token lines rejoin into the reply"), FString::Join(TokenLines, TEXT(" ")), FString(Reply));
+		TestTrue(TEXT("Per-token and per-sentence lines agree"), TokenLines == SentenceLines);
+		TestTrue(TEXT("Per-token shows text no later"), TokenFirstMs <= SentenceFirstMs);
+	}
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRfsnSubtitleInterruptTest, "Rfsn.Subtitles.Interruption",
+                                 EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext |
+                                     EAutomationTestFlags::ProductFilter)
+
+bool FRfsnSubtitleInterruptTest::RunTest(const FString& Parameters)
+{
+	using namespace RfsnBench;
+
+	// A new turn mid-line drops the open line and the queue
+	FRfsnSubtitleStream Interrupted = MakeSubtitleStream();
+	TArray<FString> Tokens;
+	TokenizeReply(SubtitleReplies[0], Tokens);
+	for (const FString& Token : Tokens)
+	{
+		Interrupted.Append(Token, false);
+	}
+	Interrupted.Reveal(0.1f);
+	TestTrue(TEXT("Lines queued"), Interrupted.NumQueued() > 0);
+	TestFalse(TEXT("First line showing"), Interrupted.GetDisplayText().IsEmpty());
+
+	Interrupted.Reset();
+	TestFalse(TEXT("Nothing showing after reset"), Interrupted.IsShowing());
+	TestEqual(TEXT("Queue dropped"), Interrupted.NumQueued(), 0);
+
+	Interrupted.Append(TEXT("Wait,"), false);
+	Interrupted.Append(TEXT(" listen."), true);
+	Interrupted.Reveal(1.0f);
+	TestEqual(TEXT("New turn shown"), Interrupted.GetDisplayText(), FString(TEXT("Wait, listen.")));
+	TestFalse(TEXT("Nothing after the new turn"), Interrupted.ShowNext());
+
+	// Tokens still streaming into the newest queued line follow it on screen
+	FRfsnSubtitleStream Tail = MakeSubtitleStream();
+	Tail.Append(TEXT("One."), false);
+	Tail.Append(TEXT(" Two"), false);
+	TestTrue(TEXT("Open line shown"), Tail.ShowNext() && Tail.IsCurrentOpen());
+	Tail.Append(TEXT(" three."), false);
+	TestFalse(TEXT("Line closed by its full stop"), Tail.IsCurrentOpen());
+	TestEqual(TEXT("Open line kept streaming"), Tail.GetFullText(), FString(TEXT("Two three.")));
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRfsnSubtitleLayoutTest, "Rfsn.Subtitles.IncrementalLayout",
+                                 EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext |
+                                     EAutomationTestFlags::ProductFilter)
+
+bool FRfsnSubtitleLayoutTest::RunTest(const FString& Parameters)
+{
+	using namespace RfsnBench;
+
+	// Revealing a character at a time wraps exactly like laying out the whole line
+	const FString LongLine = FString::Join(TArray<FString>{SubtitleReplies[0], SubtitleReplies[1]}, TEXT(" "));
+	FRfsnSubtitleStream Revealed = MakeSubtitleStream();
+	Revealed.Append(LongLine, true);
+	while (!Revealed.IsFullyRevealed())
+	{
+		Revealed.Reveal(1.0f / SubtitleRevealSpeed);
+	}
+
+	FRfsnSubtitleLayout Whole;
+	Whole.MaxWidth = SubtitleWidth;
+	Whole.MeasureRun = &MeasureSubtitleRun;
+	Whole.Append(LongLine);
+	TestTrue(TEXT("Same line breaks as a full pass"), Revealed.Layout.GetLineBreaks() == Whole.GetLineBreaks());
+	TestEqual(TEXT("Each glyph measured once"), Revealed.Layout.GetMeasuredChars(), LongLine.Len());
+
+	TArray<FString> Lines;
+	Revealed.Layout.GetLines(Revealed.GetDisplayText(), Lines);
+	TestTrue(TEXT("Wrapped"), Lines.Num() > 1);
+	for (const FString& Line : Lines)
+	{
+		TestTrue(TEXT("Line fits"), MeasureSubtitleRun(Line, 0, Line.Len()) <= SubtitleWidth);
+	}
+
+	// The old widget shows the same text for a burst of streamed lines
+	TArray<FString> Burst;
+	for (const TCHAR* Reply : SubtitleReplies)
+	{
+		TArray<FString> Tokens;
+		TokenizeReply(Reply, Tokens);
+		FRfsnSubtitleStream Streamed = MakeSubtitleStream();
+		SimulateSubtitles(Streamed, Tokens, true, Burst);
+	}
+
+	FLegacySubtitles Legacy;
+	Legacy.Layout.MaxWidth = SubtitleWidth;
+	Legacy.Layout.MeasureRun = &MeasureSubtitleRun;
+	Legacy.Queue = Burst;
+	FRfsnSubtitleStream Current = MakeSubtitleStream();
+	for (const FString& Sentence : Burst)
+	{
+		Current.Append(Sentence, false);
+	}
+
+	const float FrameSeconds = static_cast<float>(SubtitleFrameMs / 1000.0);
+	TArray<FString> LegacyShown;
+	while (Legacy.Next())
+	{
+		while (Legacy.Display.Len() < Legacy.Full.Len())
+		{
+			Legacy.Step(FrameSeconds);
+		}
+		LegacyShown.Add(Legacy.Display);
+	}
+
+	TArray<FString> CurrentShown;
+	do
+	{
+		while (!Current.IsFullyRevealed())
+		{
+			Current.Reveal(FrameSeconds);
+		}
+		CurrentShown.Add(Current.GetDisplayText());
+	} while (Current.ShowNext());
+	TestTrue(TEXT("Same text as the old widget"), LegacyShown == CurrentShown);
+	TestEqual(TEXT("Every line shown"), CurrentShown.Num(), Burst.Num());
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRfsnSubtitleQueueTest, "Rfsn.Subtitles.RingQueue",
+                                 EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext |
+                                     EAutomationTestFlags::ProductFilter)
+
+bool FRfsnSubtitleQueueTest::RunTest(const FString& Parameters)
+{
+	// Order survives wrapping and growth
+	FRfsnSubtitleQueue Ring;
+	int32 Pushed = 0;
+	int32 Popped = 0;
+	int32 OutOfOrder = 0;
+	FString Line;
+	for (int32 Round = 0; Round < 4; Round++)
+	{
+		for (int32 Index = 0; Index < 5 + Round * 7; Index++)
+		{
+			Ring.Push(FString::FromInt(Pushed++));
+		}
+		while (Ring.Num() > Round && Ring.Pop(Line))
+		{
+			OutOfOrder += Line == FString::FromInt(Popped++) ? 0 : 1;
+		}
+	}
+	while (Ring.Pop(Line))
+	{
+		OutOfOrder += Line == FString::FromInt(Popped++) ? 0 : 1;
+	}
+	TestEqual(TEXT("Lines out of order"), OutOfOrder, 0);
+	TestEqual(TEXT("Every line popped"), Popped, Pushed);
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,24 @@
+// RFSN Token Decoder Fixtures Implementation
+
+#include "RfsnTokenDecoderFixtures.h"
+
+namespace RfsnBench
+{
+ERfsnNpcAction LegacyParseAction(const FString& ActionString)
+{
+	const FString Upper = ActionString.ToUpper();
+	static const TCHAR* const Names[] = {
+	    TEXT("GREET"), TEXT("WARN"), TEXT("IDLE"), TEXT("FLEE"), TEXT("ATTACK"),
+	    TEXT("TRADE"), TEXT("OFFER"), TEXT("TALK"), TEXT("APOLOGIZE"), TEXT("THREATEN"),
+	    TEXT("EXPLAIN"), TEXT("ANSWER"), TEXT("INQUIRE"), TEXT("HELP"), TEXT("REQUEST"),
+	    TEXT("AGREE"), TEXT("DISAGREE"), TEXT("ACCEPT"), TEXT("REFUSE"), TEXT("IGNORE")};
+	for (int32 i = 0; i < static_cast<int32>(UE_ARRAY_COUNT(Names)); i++)
+	{
+		if (Upper == Names[i])
+		{
+			return static_cast<ERfsnNpcAction>(i);
+		}
+	}
+	return ERfsnNpcAction::Talk;
+}
+} // namespace RfsnBench
@@ -0,0 +1,36 @@
+// RFSN Token Decoder Fixtures
+// The if-chain action parser the token decoder replaced, and decode round-trip helpers
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "RfsnNpcClientComponent.h"
+
+namespace RfsnBench
+{
+/** A meta event as the orchestrator streams it */
+constexpr const char* TokenMetaEvent =
+    R"({"player_signal": "greet", "bandit_key": "merchant_friendly", "action_mode": "social", )"
+    R"("npc_action": "Greet", "instant_bark": "Well met, traveller!", "bark_duration_ms": 1200})";
+
+/** ParseNpcAction as it was before the token decoder: an upper-cased copy and an if-chain */
+ERfsnNpcAction LegacyParseAction(const FString& ActionString);
+
+/** Decodes Name in its own case, upper and lower case, as TCHAR and UTF-8; true if every form gives Expected */
+template <typename EnumType, typename DecodeFn>
+bool RoundTrips(const FString& Name, EnumType Expected, DecodeFn&& Decode)
+{
+	for (const FString& Form : {Name, Name.ToUpper(), Name.ToLower()})
+	{
+		EnumType Wide = Expected;
+		EnumType Narrow = Expected;
+		const FTCHARToUTF8 Utf8(*Form);
+		const FUtf8StringView Utf8View(reinterpret_cast<const UTF8CHAR*>(Utf8.Get()), Utf8.Length());
+		if (!Decode(FStringView(Form), Wide) || Wide != Expected || !Decode(Utf8View, Narrow) || Narrow != Expected)
+		{
+			return false;
+		}
+	}
+	return true;
+}
+} // namespace RfsnBench
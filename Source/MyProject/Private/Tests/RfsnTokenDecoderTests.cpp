@@ -0,0 +1,85 @@
+// RFSN Token Decoder Tests
+// Action and emotion names, mood phrases and meta-event fields decoded by the perfect hash and UTF-8 scan
+
+#include "RfsnTokenDecoder.h"
+#include "RfsnTokenDecoderFixtures.h"
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRfsnTokenRoundTripTest, "Rfsn.Tokens.RoundTrip",
+                                 EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext |
+                                     EAutomationTestFlags::ProductFilter)
+
+bool FRfsnTokenRoundTripTest::RunTest(const FString& Parameters)
+{
+	using namespace RfsnBench;
+
+	auto DecodeAction = [](auto Name, ERfsnNpcAction& Out) { return FRfsnTokenDecoder::TryDecodeAction(Name, Out); };
+	auto DecodeEmotion = [](auto Name, ERfsnCoreEmotion& Out)
+	{ return FRfsnTokenDecoder::TryDecodeEmotion(Name, Out); };
+
+	// Every name in every case, from TCHAR and UTF-8, agreeing with the old if-chain; near misses rejected
+	for (int32 i = 0; i < static_cast<int32>(UE_ARRAY_COUNT(RfsnTokens::ActionKeywords)); i++)
+	{
+		const ERfsnNpcAction Action = static_cast<ERfsnNpcAction>(i);
+		const FString Name = FRfsnTokenDecoder::GetActionName(Action);
+		TestTrue(FString::Printf(TEXT("%s round-trips"), *Name), RoundTrips(Name, Action, DecodeAction));
+		TestTrue(FString::Printf(TEXT("%s matches the if-chain"), *Name),
+		         FRfsnTokenDecoder::DecodeAction(FStringView(Name)) == LegacyParseAction(Name));
+
+		ERfsnNpcAction Ignored;
+		TestFalse(FString::Printf(TEXT("%s truncated"), *Name), DecodeAction(FStringView(Name.LeftChop(1)), Ignored));
+		TestFalse(FString::Printf(TEXT("%s extended"), *Name), DecodeAction(FStringView(Name + TEXT("s")), Ignored));
+		TestFalse(FString::Printf(TEXT("%s misspelt"), *Name),
+		          DecodeAction(FStringView(TEXT("x") + Name.RightChop(1)), Ignored));
+	}
+
+	for (const RfsnTokens::FKeyword& Keyword : RfsnTokens::EmotionKeywords)
+	{
+		const ERfsnCoreEmotion Emotion = static_cast<ERfsnCoreEmotion>(Keyword.Value);
+		const FString Name(ANSI_TO_TCHAR(Keyword.Name));
+		TestTrue(FString::Printf(TEXT("%s round-trips"), *Name), RoundTrips(Name, Emotion, DecodeEmotion));
+		TestTrue(FString::Printf(TEXT("%s canonical name round-trips"), *Name),
+		         RoundTrips(FRfsnTokenDecoder::GetEmotionName(Emotion), Emotion, DecodeEmotion));
+
+		ERfsnCoreEmotion Ignored;
+		TestFalse(FString::Printf(TEXT("%s extended"), *Name), DecodeEmotion(FStringView(Name + TEXT("y")), Ignored));
+	}
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRfsnTokenMoodTest, "Rfsn.Tokens.Mood",
+                                 EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext |
+                                     EAutomationTestFlags::ProductFilter)
+
+bool FRfsnTokenMoodTest::RunTest(const FString& Parameters)
+{
+	const FRfsnMoodToken Mixed = FRfsnTokenDecoder::DecodeMood(TEXT("Cautious, but friendly"));
+	TestTrue(TEXT("Mood words"), Mixed.Flags == (ERfsnMoodFlags::Cautious | ERfsnMoodFlags::Friendly));
+
+	const FRfsnMoodToken Intense = FRfsnTokenDecoder::DecodeMood(TEXT("Intensely Anger"));
+	TestTrue(TEXT("Mood emotion"), Intense.Emotion == ERfsnCoreEmotion::Anger);
+
+	const FRfsnMoodToken Unfriendly = FRfsnTokenDecoder::DecodeMood(TEXT("Unfriendly"));
+	TestTrue(TEXT("Whole words only"), Unfriendly.Flags == ERfsnMoodFlags::None);
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRfsnTokenMetaFieldTest, "Rfsn.Tokens.MetaField",
+                                 EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext |
+                                     EAutomationTestFlags::ProductFilter)
+
+bool FRfsnTokenMetaFieldTest::RunTest(const FString& Parameters)
+{
+	const FUtf8StringView Meta(reinterpret_cast<const UTF8CHAR*>(RfsnBench::TokenMetaEvent));
+	FUtf8StringView Field;
+	if (TestTrue(TEXT("npc_action found"), FRfsnTokenDecoder::FindJsonString(Meta, UTF8TEXT("npc_action"), Field)))
+	{
+		TestTrue(TEXT("npc_action decodes"), FRfsnTokenDecoder::DecodeAction(Field) == ERfsnNpcAction::Greet);
+	}
+	TestFalse(TEXT("Missing key"), FRfsnTokenDecoder::FindJsonString(Meta, UTF8TEXT("action"), Field));
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,48 @@
+// RFSN Trace Fixtures Implementation
+
+#include "RfsnTraceFixtures.h"
+#include "RfsnEmotionBlend.h"
+#include "RfsnNpcMemory.h"
+#include "RfsnTrace.h"
+#include "HAL/PlatformTime.h"
+#include "UObject/Package.h"
+
+namespace RfsnBench
+{
+double TimeTraceScopes(int32 Iterations)
+{
+	volatile int32 Sink = 0;
+	const double Start = FPlatformTime::Seconds();
+	for (int32 i = 0; i < Iterations; i++)
+	{
+		RFSN_TRACE_SCOPE(RfsnBench_Scope);
+		Sink = Sink + 1;
+	}
+	return (FPlatformTime::Seconds() - Start) / FMath::Max(Iterations, 1);
+}
+
+void TraceMemoryAndEmotion()
+{
+	URfsnNpcMemory* Memory = NewObject<URfsnNpcMemory>(GetTransientPackage());
+	Memory->bAutoSave = false;
+	URfsnEmotionBlend* Emotion = NewObject<URfsnEmotionBlend>(GetTransientPackage());
+
+	RFSN_TRACE_BOOKMARK(TEXT("RFSN bench start"));
+	const TCHAR* Topics[] = {TEXT("trade"), TEXT("weapon"), TEXT("the tower"), TEXT("the storm"), TEXT("a friend")};
+	for (int32 i = 0; i < 50; i++)
+	{
+		Memory->CreateMemory(ERfsnMemoryType::Conversation,
+		                     FString::Printf(TEXT("Talked about %s"), Topics[i % UE_ARRAY_COUNT(Topics)]),
+		                     i % 2 ? 0.5f : -0.5f, 0.5f);
+		Memory->RecallByTopic(Topics[i % UE_ARRAY_COUNT(Topics)]);
+		Memory->GetMemoryContext();
+		Emotion->ApplyStimulus(i % 2 ? TEXT("Joy") : TEXT("Fear"), 0.3f);
+		Emotion->GetMorphTargetWeights();
+	}
+	Memory->DecayMemories(24.0f);
+	RFSN_TRACE_BOOKMARK(TEXT("RFSN bench end"));
+
+	Memory->MarkAsGarbage();
+	Emotion->MarkAsGarbage();
+}
+} // namespace RfsnBench
@@ -0,0 +1,15 @@
+// RFSN Trace Fixtures
+// Workloads that run the RFSN paths under their trace scopes
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+namespace RfsnBench
+{
+/** Seconds per RFSN_TRACE_SCOPE over Iterations empty scopes */
+double TimeTraceScopes(int32 Iterations);
+
+/** Runs the NPC memory and emotion paths under their trace scopes, between two bookmarks */
+void TraceMemoryAndEmotion();
+} // namespace RfsnBench
@@ -0,0 +1,119 @@
+// RFSN Trace Tests
+// A file capture of the RFSN paths, read back with trace analysis: the scope and counter names Insights will show
+
+#include "RfsnHttpPool.h"
+#include "RfsnTrace.h"
+#include "RfsnTraceFixtures.h"
+#include "HAL/FileManager.h"
+#include "Misc/AutomationTest.h"
+#include "Misc/Paths.h"
+#include "ProfilingDebugging/TraceAuxiliary.h"
+#include "UObject/Package.h"
+
+#if WITH_DEV_AUTOMATION_TESTS && WITH_EDITOR
+
+#include "Trace/Analysis.h"
+#include "Trace/Analyzer.h"
+#include "Trace/DataStream.h"
+
+namespace RfsnTraceTests
+{
+/** Collects the names of every CPU scope and counter a capture declares */
+class FNameCollector : public UE::Trace::IAnalyzer
+{
+public:
+	TSet<FString> Scopes;
+	TSet<FString> Counters;
+
+	virtual void OnAnalysisBegin(const FOnAnalysisContext& Context) override
+	{
+		Context.InterfaceBuilder.RouteEvent(RouteId_Scope, "CpuProfiler", "EventSpec");
+		Context.InterfaceBuilder.RouteEvent(RouteId_Counter, "Counters", "Spec");
+	}
+
+	virtual bool OnEvent(uint16 RouteId, EStyle Style, const FOnEventContext& Context) override
+	{
+		FString Name;
+		if (Context.EventData.GetString("Name", Name))
+		{
+			(RouteId == RouteId_Scope ? Scopes : Counters).Add(Name);
+		}
+		return true;
+	}
+
+private:
+	enum : uint16
+	{
+		RouteId_Scope,
+		RouteId_Counter,
+	};
+};
+} // namespace RfsnTraceTests
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRfsnTraceCaptureTest, "Rfsn.Trace.Capture",
+                                 EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext |
+                                     EAutomationTestFlags::ProductFilter)
+
+bool FRfsnTraceCaptureTest::RunTest(const FString& Parameters)
+{
+	using namespace RfsnTraceTests;
+
+	if (FTraceAuxiliary::IsConnected())
+	{
+		AddWarning(TEXT("A trace session is already being recorded; stop it to run this test"));
+		return true;
+	}
+
+	const bool bWasEnabled = RfsnChannel.IsEnabled();
+	const FString TracePath = FPaths::AutomationTransientDir() / TEXT("RfsnTraceTest.utrace");
+	if (!TestTrue(TEXT("Capture started"), FTraceAuxiliary::Start(FTraceAuxiliary::EConnectionType::File, *TracePath,
+	                                                              TEXT("cpu,counters,bookmark,rfsn"))))
+	{
+		return false;
+	}
+
+	RfsnBench::TraceMemoryAndEmotion();
+
+	// A request that is created, started and completed without going on the wire moves both HTTP counters
+	URfsnHttpPool* Pool = NewObject<URfsnHttpPool>(GetTransientPackage());
+	Pool->CreateGetRequest(TEXT("/health"));
+	Pool->OnRequestStarted();
+	Pool->OnRequestCompleted(true, 10.0f, 0);
+	Pool->MarkAsGarbage();
+
+	FTraceAuxiliary::Stop();
+	UE::Trace::ToggleChannel(TEXT("Rfsn"), bWasEnabled);
+
+	// The stream holds the file open until it goes out of scope
+	FNameCollector Collector;
+	{
+		UE::Trace::FFileDataStream Stream;
+		if (!TestTrue(TEXT("Capture opened"), Stream.Open(*TracePath)))
+		{
+			return false;
+		}
+		UE::Trace::FAnalysisContext Analysis;
+		Analysis.AddAnalyzer(Collector);
+		Analysis.Process(Stream).Wait();
+	}
+
+	const TCHAR* const Scopes[] = {TEXT("RfsnMemory_CreateMemory"),       TEXT("RfsnMemory_RecallByTopic"),
+	                               TEXT("RfsnMemory_GetMemoryContext"),   TEXT("RfsnMemory_DecayMemories"),
+	                               TEXT("RfsnEmotion_ApplyStimulus"),     TEXT("RfsnEmotion_GetMorphTargetWeights"),
+	                               TEXT("RfsnHttpPool_CreateGetRequest"), TEXT("RfsnHttpPool_OnRequestCompleted")};
+	for (const TCHAR* Scope : Scopes)
+	{
+		TestTrue(FString::Printf(TEXT("Scope %s captured"), Scope), Collector.Scopes.Contains(Scope));
+	}
+
+	const TCHAR* const Counters[] = {TEXT("Rfsn/PooledRequests"), TEXT("Rfsn/InFlightRequests")};
+	for (const TCHAR* Counter : Counters)
+	{
+		TestTrue(FString::Printf(TEXT("Counter %s captured"), Counter), Collector.Counters.Contains(Counter));
+	}
+
+	IFileManager::Get().Delete(*TracePath);
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS && WITH_EDITOR
@@ -0,0 +1,33 @@
+// RFSN Turn Taking Fixtures Implementation
+
+#include "RfsnTurnTakingFixtures.h"
+
+namespace RfsnBench
+{
+void AddTurnCandidates(FRfsnTurnScheduler& Scheduler)
+{
+	const TCHAR* const Names[] = {TEXT("Mara"), TEXT("Old Tom"), TEXT("Bren"), TEXT("Ives")};
+	for (const TCHAR* Name : Names)
+	{
+		FRfsnTurnCandidate Candidate;
+		Candidate.Name = Name;
+		Scheduler.AddCandidate(Candidate);
+	}
+}
+
+FTurnGapRun RunTurnGaps(int32 Turns, bool bPrefetch, int32 PlayerEvery)
+{
+	FRfsnTurnScheduler Scheduler;
+	Scheduler.bPrefetch = bPrefetch;
+	FMockLineBackend Backend;
+	Backend.PlayerEvery = PlayerEvery;
+	Backend.Bind(Scheduler);
+	AddTurnCandidates(Scheduler);
+	Backend.Run(Scheduler, Turns);
+
+	FTurnGapRun Run;
+	Run.Stats = Scheduler.GetStats();
+	Run.Seconds = Backend.Now;
+	return Run;
+}
+} // namespace RfsnBench
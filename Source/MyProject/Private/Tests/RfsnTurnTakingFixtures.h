@@ -0,0 +1,134 @@
+// RFSN Turn Taking Fixtures
+// A paced mock line backend for the turn scheduler, on a simulated clock
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "RfsnBenchFixtures.h"
+#include "RfsnGroupConversation.h"
+
+namespace RfsnBench
+{
+/**
+ * Local stand-in for the orchestrator behind a group conversation, on a simulated clock: a line request is
+ * answered once its reply would have finished streaming, and a spoken line holds the floor for as long as
+ * URfsnGroupConversation would time it (3 s minimum, 65 ms a character, 0.25 s pause).
+ */
+struct FMockLineBackend
+{
+	enum class EEvent : uint8
+	{
+		LineReady,
+		LineOver,
+		PlayerSpeaks,
+	};
+
+	struct FEvent
+	{
+		double Time = 0.0;
+		EEvent Kind = EEvent::LineReady;
+		/** Request id, or the turn that ends for LineOver */
+		int32 Request = 0;
+		int32 Speaker = INDEX_NONE;
+	};
+
+	double Now = 0.0;
+	bool bInstant = false;
+	FRandomStream Random{45};
+	TArray<FEvent> Events;
+
+	/** Names in speaking order */
+	TArray<FString> Spoken;
+
+	/** Text of a participant's line; a plain line by default */
+	TFunction<FString(int32 Speaker)> MakeLine;
+
+	/** The player speaks this long into every Nth line, naming a random participant (0 = never) */
+	int32 PlayerEvery = 0;
+
+	void Bind(FRfsnTurnScheduler& Scheduler)
+	{
+		Scheduler.Clock = [this]() { return Now; };
+		Scheduler.RequestLine = [this](int32 Speaker, int32 Request)
+		{
+			const double Latency = (MockFirstSentenceMs + Random.RandRange(1, 3) * MockSentenceGapMs) / 1000.0;
+			Events.Add({Now + (bInstant ? 0.0 : Latency * Random.FRandRange(0.7f, 1.3f)), EEvent::LineReady, Request,
+			            Speaker});
+		};
+		Scheduler.SpeakLine = [this, &Scheduler](int32 Speaker, const FString& Line)
+		{
+			Spoken.Add(Scheduler.GetCandidate(Speaker).Name);
+			Events.Add({Now + FMath::Max(3.0, Line.Len() * 0.065) + 0.25, EEvent::LineOver, Spoken.Num()});
+			if (PlayerEvery > 0 && Spoken.Num() % PlayerEvery == 0)
+			{
+				Events.Add({Now + 1.0, EEvent::PlayerSpeaks});
+			}
+		};
+	}
+
+	/** Deliver the earliest event; false once there are none */
+	bool Step(FRfsnTurnScheduler& Scheduler)
+	{
+		if (Events.Num() == 0)
+		{
+			return false;
+		}
+
+		int32 First = 0;
+		for (int32 Index = 1; Index < Events.Num(); Index++)
+		{
+			First = Events[Index].Time < Events[First].Time ? Index : First;
+		}
+		const FEvent Event = Events[First];
+		Events.RemoveAt(First);
+		Now = FMath::Max(Now, Event.Time);
+
+		switch (Event.Kind)
+		{
+		case EEvent::LineReady:
+			Scheduler.OnLineReady(Event.Request,
+			                      MakeLine ? MakeLine(Event.Speaker)
+			                               : FString::Printf(TEXT("Line %d, about as long as the usual reply."),
+			                                                 Event.Request));
+			break;
+		case EEvent::LineOver:
+			// Unless the line was cut short and someone else has spoken since
+			if (Event.Request == Spoken.Num())
+			{
+				Scheduler.Advance();
+			}
+			break;
+		case EEvent::PlayerSpeaks:
+			Scheduler.OnInterjection(Random.RandRange(0, Scheduler.NumCandidates() - 1));
+			break;
+		}
+		return true;
+	}
+
+	/** Run until Turns lines have been spoken, starting the conversation if it hasn't started */
+	void Run(FRfsnTurnScheduler& Scheduler, int32 Turns)
+	{
+		if (Spoken.Num() == 0 && Events.Num() == 0)
+		{
+			Scheduler.Advance();
+		}
+		while (Spoken.Num() < Turns && Step(Scheduler))
+		{
+		}
+	}
+};
+
+/** A scheduler over four NPCs with equal standing */
+void AddTurnCandidates(FRfsnTurnScheduler& Scheduler);
+
+/** Turn statistics of a conversation among the four NPCs against the paced mock backend */
+struct FTurnGapRun
+{
+	FRfsnTurnStats Stats;
+	/** Simulated seconds the conversation took */
+	double Seconds = 0.0;
+};
+
+/** Turns lines with or without prefetching, the player cutting in every PlayerEvery lines (0 = never) */
+FTurnGapRun RunTurnGaps(int32 Turns, bool bPrefetch, int32 PlayerEvery);
+} // namespace RfsnBench
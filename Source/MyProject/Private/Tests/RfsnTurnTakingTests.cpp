@@ -0,0 +1,180 @@
+// RFSN Turn Taking Tests
+// Group conversation speaker rotation, addressing, the player cutting in, NPCs leaving and line prefetching
+
+#include "RfsnGroupConversation.h"
+#include "RfsnTurnTakingFixtures.h"
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace RfsnTurnTakingTests
+{
+constexpr int32 Turns = 200;
+
+/** Four equal NPCs against a backend that answers at once */
+struct FInstantConversation
+{
+	FRfsnTurnScheduler Scheduler;
+	RfsnBench::FMockLineBackend Backend;
+
+	FInstantConversation()
+	{
+		Backend.bInstant = true;
+		Backend.Bind(Scheduler);
+		RfsnBench::AddTurnCandidates(Scheduler);
+	}
+};
+} // namespace RfsnTurnTakingTests
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRfsnTurnRotationTest, "Rfsn.TurnTaking.Rotation",
+                                 EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext |
+                                     EAutomationTestFlags::ProductFilter)
+
+bool FRfsnTurnRotationTest::RunTest(const FString& Parameters)
+{
+	using namespace RfsnTurnTakingTests;
+
+	// Equals take turns in order
+	{
+		FInstantConversation Conversation;
+		Conversation.Backend.Run(Conversation.Scheduler, Turns);
+		const TArray<FString>& Spoken = Conversation.Backend.Spoken;
+		TestEqual(TEXT("Lines spoken"), Spoken.Num(), Turns);
+
+		int32 OutOfTurn = 0;
+		for (int32 Turn = 0; Turn < Spoken.Num(); Turn++)
+		{
+			OutOfTurn += Spoken[Turn] == Conversation.Scheduler.GetCandidate(Turn % 4).Name ? 0 : 1;
+		}
+		TestEqual(TEXT("Lines out of turn"), OutOfTurn, 0);
+	}
+
+	// Mixed weights still rotate: nobody speaks twice running or waits long, and the chatty one leads
+	{
+		FInstantConversation Conversation;
+		FRfsnTurnScheduler& Scheduler = Conversation.Scheduler;
+		Scheduler.GetCandidate(0).Interruptiveness = 0.9f;
+		Scheduler.GetCandidate(1).Interruptiveness = 0.1f;
+		Scheduler.GetCandidate(2).Affinity = 0.8f;
+		Scheduler.GetCandidate(3).Affinity = -0.8f;
+		Conversation.Backend.Run(Scheduler, Turns);
+
+		const TArray<FString>& Spoken = Conversation.Backend.Spoken;
+		int32 Repeats = 0;
+		int32 LongestWait = 0;
+		TMap<FString, int32> LastTurn;
+		for (int32 Turn = 0; Turn < Spoken.Num(); Turn++)
+		{
+			Repeats += Turn > 0 && Spoken[Turn] == Spoken[Turn - 1] ? 1 : 0;
+			const int32* Last = LastTurn.Find(Spoken[Turn]);
+			LongestWait = FMath::Max(LongestWait, Turn - (Last ? *Last : -1));
+			LastTurn.Add(Spoken[Turn], Turn);
+		}
+		TestEqual(TEXT("Same speaker twice running"), Repeats, 0);
+		TestEqual(TEXT("Everyone spoke"), LastTurn.Num(), 4);
+		TestTrue(TEXT("Longest wait"), LongestWait <= 8);
+		TestTrue(TEXT("Chatty NPC leads"), Scheduler.GetCandidate(0).TurnCount >= Scheduler.GetCandidate(1).TurnCount);
+	}
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRfsnTurnAddressingTest, "Rfsn.TurnTaking.Addressing",
+                                 EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext |
+                                     EAutomationTestFlags::ProductFilter)
+
+bool FRfsnTurnAddressingTest::RunTest(const FString& Parameters)
+{
+	using namespace RfsnTurnTakingTests;
+
+	// An NPC named in a line answers next
+	{
+		FInstantConversation Conversation;
+		Conversation.Backend.MakeLine = [](int32 Speaker)
+		{ return Speaker == 0 ? FString(TEXT("What do you make of it, bren?")) : FString(TEXT("Hard to say.")); };
+		Conversation.Backend.Run(Conversation.Scheduler, Turns);
+
+		const TArray<FString>& Spoken = Conversation.Backend.Spoken;
+		int32 Unanswered = 0;
+		for (int32 Turn = 0; Turn + 1 < Spoken.Num(); Turn++)
+		{
+			Unanswered += Spoken[Turn] == TEXT("Mara") && Spoken[Turn + 1] != TEXT("Bren") ? 1 : 0;
+		}
+		TestEqual(TEXT("Questions to Bren not answered by Bren"), Unanswered, 0);
+	}
+
+	// Mara holds the floor with Old Tom's line prefetched; the player asks Ives instead
+	{
+		FInstantConversation Conversation;
+		FRfsnTurnScheduler& Scheduler = Conversation.Scheduler;
+		Conversation.Backend.Run(Scheduler, 1);
+		TestTrue(TEXT("Speaking"), Scheduler.IsSpeaking());
+		TestEqual(TEXT("Next speaker prefetched"), Scheduler.GetPendingSpeaker(), 1);
+
+		Scheduler.OnInterjection(3);
+		TestEqual(TEXT("Player's choice pending"), Scheduler.GetPendingSpeaker(), 3);
+		TestEqual(TEXT("Prefetched line discarded"), Scheduler.GetStats().Discarded, 1);
+
+		Conversation.Backend.Run(Scheduler, 2);
+		TestEqual(TEXT("Addressed NPC spoke"), Conversation.Backend.Spoken.Last(), FString(TEXT("Ives")));
+	}
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRfsnTurnLeavingTest, "Rfsn.TurnTaking.UnavailableAndLeaving",
+                                 EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext |
+                                     EAutomationTestFlags::ProductFilter)
+
+bool FRfsnTurnLeavingTest::RunTest(const FString& Parameters)
+{
+	using namespace RfsnTurnTakingTests;
+
+	FInstantConversation Conversation;
+	FRfsnTurnScheduler& Scheduler = Conversation.Scheduler;
+	TArray<FString>& Spoken = Conversation.Backend.Spoken;
+	Scheduler.GetCandidate(1).bAvailable = false;
+	Conversation.Backend.Run(Scheduler, 5);
+	TestFalse(TEXT("Unavailable NPC skipped"), Spoken.Contains(TEXT("Old Tom")));
+
+	// Bren leaves in the middle of a line, which is cut short as URfsnGroupConversation does
+	TestEqual(TEXT("Bren speaking"), Scheduler.GetCurrentSpeaker(), 2);
+	TestEqual(TEXT("Bren's line"), Spoken.Last(), FString(TEXT("Bren")));
+	Scheduler.RemoveCandidate(2);
+	Scheduler.Advance();
+
+	const int32 Before = Spoken.Num();
+	Conversation.Backend.Run(Scheduler, Before + 12);
+	TestEqual(TEXT("Candidates left"), Scheduler.NumCandidates(), 3);
+	TestEqual(TEXT("Conversation carried on"), Spoken.Num(), Before + 12);
+	for (int32 Turn = Before; Turn < Spoken.Num(); Turn++)
+	{
+		TestTrue(TEXT("Neither Bren nor Old Tom"), Spoken[Turn] != TEXT("Bren") && Spoken[Turn] != TEXT("Old Tom"));
+	}
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRfsnTurnPrefetchTest, "Rfsn.TurnTaking.Prefetch",
+                                 EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext |
+                                     EAutomationTestFlags::ProductFilter)
+
+bool FRfsnTurnPrefetchTest::RunTest(const FString& Parameters)
+{
+	using namespace RfsnTurnTakingTests;
+
+	const RfsnBench::FTurnGapRun Sequential = RfsnBench::RunTurnGaps(Turns, false, 0);
+	const RfsnBench::FTurnGapRun Prefetched = RfsnBench::RunTurnGaps(Turns, true, 0);
+	const RfsnBench::FTurnGapRun Interrupted = RfsnBench::RunTurnGaps(Turns, true, 5);
+
+	// Only the opening line, with nothing voiced before it, has to wait
+	TestEqual(TEXT("Prefetch hits"), Prefetched.Stats.PrefetchHits, Turns - 1);
+	TestTrue(TEXT("No gap after the opening line"),
+	         Prefetched.Stats.TotalGapSeconds - Prefetched.Stats.MaxGapSeconds < 0.001);
+	TestTrue(TEXT("Asking when the floor frees waits"), Sequential.Stats.GetAverageGapSeconds() > 0.5);
+
+	// Player cut-ins discard prefetched lines and re-request, still beating the sequential gaps
+	TestTrue(TEXT("Cut-ins discard"), Interrupted.Stats.Discarded > 0);
+	TestTrue(TEXT("Cut-ins still faster"),
+	         Interrupted.Stats.GetAverageGapSeconds() < Sequential.Stats.GetAverageGapSeconds());
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,88 @@
+// RFSN Weather Reaction Fixtures Implementation
+
+#include "RfsnWeatherReactionFixtures.h"
+
+namespace RfsnBench
+{
+TArray<TArray<FRfsnWeatherPreference>> MakeWeatherPresets()
+{
+	TArray<TArray<FRfsnWeatherPreference>> Presets;
+	// URfsnWeatherReactions' defaults
+	Presets.Add({{ERfsnWeatherType::Rain, -0.3f, TEXT("I hope this rain stops soon.")},
+	             {ERfsnWeatherType::Storm, -0.8f, TEXT("This storm is dangerous!")},
+	             {ERfsnWeatherType::Clear, 0.5f, TEXT("Beautiful day, isn't it?")},
+	             {ERfsnWeatherType::Cold, -0.4f, TEXT("It's freezing out here.")}});
+	// Farmer
+	Presets.Add({{ERfsnWeatherType::Rain, 0.6f, TEXT("The fields needed this.")},
+	             {ERfsnWeatherType::Hot, -0.7f, TEXT("The crops will wilt.")},
+	             {ERfsnWeatherType::Windy, -0.25f, FString()}});
+	// Fisher
+	Presets.Add({{ERfsnWeatherType::Fog, 0.4f, TEXT("Fish bite in the fog.")},
+	             {ERfsnWeatherType::Storm, -1.0f, TEXT("No boats out today.")},
+	             {ERfsnWeatherType::Windy, -0.6f, TEXT("The swell's too high.")}});
+	// Child
+	Presets.Add({{ERfsnWeatherType::Snow, 0.9f, TEXT("Snow!")},
+	             {ERfsnWeatherType::Rain, 0.35f, TEXT("Puddles!")},
+	             {ERfsnWeatherType::Cloudy, -0.1f, FString()}});
+	// Hermit with a messy list
+	Presets.Add({{ERfsnWeatherType::Cold, -0.55f, FString()},
+	             {ERfsnWeatherType::Clear, 0.2f, TEXT("Hm.")},
+	             {ERfsnWeatherType::Cold, 0.8f, TEXT("Bitter, like me.")},
+	             {ERfsnWeatherType::Clear, -0.9f, TEXT("Too bright.")}});
+	Presets.AddDefaulted();
+	return Presets;
+}
+
+bool FWeatherScenario::Build(int32 NpcCount)
+{
+	bool bSlotsInOrder = true;
+	Legacy.SetNum(NpcCount);
+	for (int32 i = 0; i < NpcCount; i++)
+	{
+		const int32 Preset = Stream.RandRange(0, Presets.Num() - 1);
+		UsedPresets.Add(Preset);
+
+		FLegacyWeatherNpc& Npc = Legacy[i];
+		Npc.Preferences = Presets[Preset];
+		Npc.bSeeksShelter = Stream.FRand() < 0.7f;
+		Npc.bIsIndoors = Stream.FRand() < 0.3f;
+		Npc.UpdateReaction();
+
+		const int32 Archetype = Batch.FindOrAddArchetype(FRfsnWeatherArchetype::FromPreferences(Npc.Preferences));
+		bSlotsInOrder &= Batch.Add(Archetype, Npc.bIsIndoors, Npc.bSeeksShelter) == i;
+	}
+	return bSlotsInOrder;
+}
+
+bool FWeatherScenario::Matches(int32 Npc) const
+{
+	return Batch.GetReaction(Npc) == Legacy[Npc].CurrentReaction &&
+	       Batch.GetShouldSeekShelter(Npc) == Legacy[Npc].bShouldSeekShelter;
+}
+
+TArray<ERfsnWeatherType> MakeWeatherSequence()
+{
+	TArray<ERfsnWeatherType> Sequence;
+	ERfsnWeatherType Current = ERfsnWeatherType::Clear;
+	auto Push = [&Sequence, &Current](int32 Weather)
+	{
+		if (static_cast<ERfsnWeatherType>(Weather) != Current)
+		{
+			Current = static_cast<ERfsnWeatherType>(Weather);
+			Sequence.Add(Current);
+		}
+	};
+	for (int32 From = 0; From < RfsnWeather::NumTypes; From++)
+	{
+		for (int32 To = 0; To < RfsnWeather::NumTypes; To++)
+		{
+			if (To != From)
+			{
+				Push(From);
+				Push(To);
+			}
+		}
+	}
+	return Sequence;
+}
+} // namespace RfsnBench
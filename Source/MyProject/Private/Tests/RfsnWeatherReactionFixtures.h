@@ -0,0 +1,151 @@
+// RFSN Weather Reaction Fixtures
+// URfsnWeatherReactions as it ticked per component before the world environment batched it
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "RfsnWeatherReactions.h"
+#include "RfsnWorldEnvironment.h"
+
+namespace RfsnBench
+{
+/** Legacy tick interval of URfsnWeatherReactions */
+constexpr float WeatherTickSeconds = 5.0f;
+
+/** URfsnWeatherReactions before the world environment: a linear preference scan and a tick per component */
+struct FLegacyWeatherNpc
+{
+	TArray<FRfsnWeatherPreference> Preferences;
+	bool bSeeksShelter = true;
+	bool bIsIndoors = false;
+
+	ERfsnWeatherType CurrentWeather = ERfsnWeatherType::Clear;
+	ERfsnTimeOfDay CurrentTimeOfDay = ERfsnTimeOfDay::Morning;
+	float CurrentHour = 12.0f;
+	ERfsnWeatherReaction CurrentReaction = ERfsnWeatherReaction::Neutral;
+	bool bShouldSeekShelter = false;
+	int32 Broadcasts = 0;
+
+	float GetPreference(ERfsnWeatherType Weather) const
+	{
+		for (const FRfsnWeatherPreference& Pref : Preferences)
+		{
+			if (Pref.Weather == Weather)
+			{
+				return Pref.Preference;
+			}
+		}
+		return 0.0f;
+	}
+
+	static ERfsnTimeOfDay TimeOfDayAt(float Hour)
+	{
+		if (Hour >= 0 && Hour < 3)
+			return ERfsnTimeOfDay::Midnight;
+		if (Hour >= 3 && Hour < 5)
+			return ERfsnTimeOfDay::Night;
+		if (Hour >= 5 && Hour < 7)
+			return ERfsnTimeOfDay::Dawn;
+		if (Hour >= 7 && Hour < 12)
+			return ERfsnTimeOfDay::Morning;
+		if (Hour >= 12 && Hour < 14)
+			return ERfsnTimeOfDay::Noon;
+		if (Hour >= 14 && Hour < 18)
+			return ERfsnTimeOfDay::Afternoon;
+		if (Hour >= 18 && Hour < 21)
+			return ERfsnTimeOfDay::Evening;
+		return ERfsnTimeOfDay::Night;
+	}
+
+	void UpdateTimeOfDay()
+	{
+		const ERfsnTimeOfDay NewTime = TimeOfDayAt(CurrentHour);
+		if (NewTime != CurrentTimeOfDay)
+		{
+			CurrentTimeOfDay = NewTime;
+			Broadcasts++;
+		}
+	}
+
+	void UpdateReaction()
+	{
+		const float Feeling = GetPreference(CurrentWeather);
+		ERfsnWeatherReaction NewReaction;
+		if (CurrentWeather == ERfsnWeatherType::Storm && !bIsIndoors)
+		{
+			NewReaction = ERfsnWeatherReaction::SeekShelter;
+			bShouldSeekShelter = true;
+		}
+		else if (CurrentWeather == ERfsnWeatherType::Rain && !bIsIndoors && bSeeksShelter)
+		{
+			NewReaction = ERfsnWeatherReaction::SeekShelter;
+			bShouldSeekShelter = true;
+		}
+		else if (Feeling < -0.5f)
+		{
+			NewReaction = ERfsnWeatherReaction::Uncomfortable;
+			bShouldSeekShelter = bSeeksShelter && !bIsIndoors;
+		}
+		else if (Feeling < -0.2f)
+		{
+			NewReaction = ERfsnWeatherReaction::Worried;
+			bShouldSeekShelter = false;
+		}
+		else if (Feeling > 0.3f)
+		{
+			NewReaction = ERfsnWeatherReaction::Enjoying;
+			bShouldSeekShelter = false;
+		}
+		else
+		{
+			NewReaction = ERfsnWeatherReaction::Neutral;
+			bShouldSeekShelter = false;
+		}
+
+		if (NewReaction != CurrentReaction)
+		{
+			CurrentReaction = NewReaction;
+			Broadcasts++;
+		}
+	}
+
+	/** SetWeather on one component (without its log line) */
+	void SetWeather(ERfsnWeatherType NewWeather)
+	{
+		if (NewWeather != CurrentWeather)
+		{
+			CurrentWeather = NewWeather;
+			Broadcasts++;
+			UpdateReaction();
+		}
+	}
+
+	void Tick()
+	{
+		UpdateTimeOfDay();
+		UpdateReaction();
+	}
+};
+
+/** Preference presets NPCs are configured from; the last repeats weathers to exercise first-match-wins */
+TArray<TArray<FRfsnWeatherPreference>> MakeWeatherPresets();
+
+/** NPCs on random presets, some sheltering, some indoors, both as old components and in one batch */
+struct FWeatherScenario
+{
+	TArray<TArray<FRfsnWeatherPreference>> Presets = MakeWeatherPresets();
+	FRandomStream Stream{1357};
+	TArray<FLegacyWeatherNpc> Legacy;
+	FRfsnWeatherReactionBatch Batch;
+	TSet<int32> UsedPresets;
+
+	/** Adds the NPCs; returns false if a batch slot came back out of order */
+	bool Build(int32 NpcCount);
+
+	/** The batch reacts like the old component */
+	bool Matches(int32 Npc) const;
+};
+
+/** Every weather following every other, with no weather repeated back to back */
+TArray<ERfsnWeatherType> MakeWeatherSequence();
+} // namespace RfsnBench
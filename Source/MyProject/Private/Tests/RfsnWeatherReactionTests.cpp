@@ -0,0 +1,236 @@
+// RFSN Weather Reaction Tests
+// The batched archetype tables against the per-component preference scan they replaced, and NPC time requests
+
+#include "RfsnGameClock.h"
+#include "RfsnTestWorld.h"
+#include "RfsnWeatherReactionFixtures.h"
+#include "RfsnWeatherReactions.h"
+#include "RfsnWorldEnvironment.h"
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace RfsnWeatherReactionTests
+{
+constexpr int32 NpcCount = 500;
+} // namespace RfsnWeatherReactionTests
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRfsnWeatherArchetypeTest, "Rfsn.WeatherReactions.Archetypes",
+                                 EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext |
+                                     EAutomationTestFlags::ProductFilter)
+
+bool FRfsnWeatherArchetypeTest::RunTest(const FString& Parameters)
+{
+	using namespace RfsnBench;
+	using namespace RfsnWeatherReactionTests;
+
+	FWeatherScenario Scenario;
+	TestTrue(TEXT("Slots handed out in order"), Scenario.Build(NpcCount));
+	TestEqual(TEXT("One archetype per preset"), Scenario.Batch.NumArchetypes(), Scenario.UsedPresets.Num());
+
+	int32 WrongPreferences = 0;
+	for (int32 i = 0; i < NpcCount; i++)
+	{
+		const FRfsnWeatherArchetype& Archetype = Scenario.Batch.GetArchetype(Scenario.Batch.GetArchetypeOf(i));
+		for (int32 Weather = 0; Weather < RfsnWeather::NumTypes; Weather++)
+		{
+			WrongPreferences += Archetype.Preferences[Weather] ==
+			                            Scenario.Legacy[i].GetPreference(static_cast<ERfsnWeatherType>(Weather))
+			                        ? 0
+			                        : 1;
+		}
+	}
+	TestEqual(TEXT("Preferences differing from the scan"), WrongPreferences, 0);
+
+	// The first preference listed for a weather wins, comment included
+	const FRfsnWeatherArchetype& Hermit = Scenario.Batch.GetArchetype(
+	    Scenario.Batch.FindOrAddArchetype(FRfsnWeatherArchetype::FromPreferences(Scenario.Presets[4])));
+	TestEqual(TEXT("First cold comment"), Hermit.Comments[static_cast<int32>(ERfsnWeatherType::Cold)],
+	          FString(TEXT("Bitter, like me.")));
+	TestEqual(TEXT("First clear comment"), Hermit.Comments[static_cast<int32>(ERfsnWeatherType::Clear)],
+	          FString(TEXT("Hm.")));
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRfsnWeatherChangeTest, "Rfsn.WeatherReactions.WeatherChanges",
+                                 EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext |
+                                     EAutomationTestFlags::ProductFilter)
+
+bool FRfsnWeatherChangeTest::RunTest(const FString& Parameters)
+{
+	using namespace RfsnBench;
+	using namespace RfsnWeatherReactionTests;
+
+	FWeatherScenario Scenario;
+	Scenario.Build(NpcCount);
+
+	// Every weather from every other: same reactions as the scan, and exactly the NPCs that changed are reported
+	int32 Mismatches = 0;
+	int32 ChangedListErrors = 0;
+	int32 ReactionChanges = 0;
+	TArray<TPair<ERfsnWeatherReaction, bool>> Before;
+	TArray<int32> Changed;
+	for (const ERfsnWeatherType Weather : MakeWeatherSequence())
+	{
+		Before.Reset();
+		for (FLegacyWeatherNpc& Npc : Scenario.Legacy)
+		{
+			Before.Add({Npc.CurrentReaction, Npc.bShouldSeekShelter});
+			Npc.SetWeather(Weather);
+		}
+		Changed.Reset();
+		Scenario.Batch.Evaluate(Weather, Changed);
+
+		auto HasChanged = [&Scenario, &Before](int32 Npc)
+		{
+			return Scenario.Legacy[Npc].CurrentReaction != Before[Npc].Key ||
+			       Scenario.Legacy[Npc].bShouldSeekShelter != Before[Npc].Value;
+		};
+		int32 Expected = 0;
+		for (int32 i = 0; i < NpcCount; i++)
+		{
+			Mismatches += Scenario.Matches(i) ? 0 : 1;
+			Expected += HasChanged(i) ? 1 : 0;
+		}
+		for (const int32 Npc : Changed)
+		{
+			ChangedListErrors += HasChanged(Npc) ? 0 : 1;
+		}
+		ChangedListErrors += Changed.Num() != Expected ? 1 : 0;
+		ReactionChanges += Changed.Num();
+	}
+	TestEqual(TEXT("Reactions differing from the scan"), Mismatches, 0);
+	TestEqual(TEXT("Changed list errors"), ChangedListErrors, 0);
+	TestTrue(TEXT("Reactions changed"), ReactionChanges > 0);
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRfsnWeatherUpdateTest, "Rfsn.WeatherReactions.IndoorsAndRejoin",
+                                 EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext |
+                                     EAutomationTestFlags::ProductFilter)
+
+bool FRfsnWeatherUpdateTest::RunTest(const FString& Parameters)
+{
+	using namespace RfsnBench;
+	using namespace RfsnWeatherReactionTests;
+
+	FWeatherScenario Scenario;
+	Scenario.Build(NpcCount);
+	FRfsnWeatherReactionBatch& Batch = Scenario.Batch;
+
+	// Moving indoors and out reports a change exactly when the old component's reaction changed
+	TArray<int32> Changed;
+	int32 UpdateErrors = 0;
+	for (const ERfsnWeatherType Weather : {ERfsnWeatherType::Storm, ERfsnWeatherType::Rain, ERfsnWeatherType::Cold})
+	{
+		for (FLegacyWeatherNpc& Npc : Scenario.Legacy)
+		{
+			Npc.SetWeather(Weather);
+		}
+		Changed.Reset();
+		Batch.Evaluate(Weather, Changed);
+
+		for (int32 i = 0; i < NpcCount; i += 7)
+		{
+			FLegacyWeatherNpc& Npc = Scenario.Legacy[i];
+			const ERfsnWeatherReaction Old = Npc.CurrentReaction;
+			const bool bOldShelter = Npc.bShouldSeekShelter;
+			Npc.bIsIndoors = !Npc.bIsIndoors;
+			Npc.UpdateReaction();
+			const bool bExpected = Npc.CurrentReaction != Old || Npc.bShouldSeekShelter != bOldShelter;
+			const bool bChanged = Batch.Update(i, Batch.GetArchetypeOf(i), Npc.bIsIndoors, Npc.bSeeksShelter);
+			UpdateErrors += Scenario.Matches(i) && bChanged == bExpected ? 0 : 1;
+		}
+	}
+	TestEqual(TEXT("Indoor updates differing from the component"), UpdateErrors, 0);
+
+	// Leaving frees the slot and rejoining takes it back with the current weather applied
+	const int32 Rejoined = 3;
+	Batch.Remove(Rejoined);
+	TestFalse(TEXT("Slot freed"), Batch.IsValid(Rejoined));
+	TestEqual(TEXT("NPCs after leaving"), Batch.Num(), NpcCount - 1);
+
+	const FLegacyWeatherNpc& Npc = Scenario.Legacy[Rejoined];
+	const int32 Slot = Batch.Add(Batch.FindOrAddArchetype(FRfsnWeatherArchetype::FromPreferences(Npc.Preferences)),
+	                             Npc.bIsIndoors, Npc.bSeeksShelter);
+	TestEqual(TEXT("Freed slot reused"), Slot, Rejoined);
+	TestTrue(TEXT("Rejoined NPC reacts like the component"), Scenario.Matches(Slot));
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRfsnTimeOfDayTest, "Rfsn.WeatherReactions.TimeOfDay",
+                                 EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext |
+                                     EAutomationTestFlags::ProductFilter)
+
+bool FRfsnTimeOfDayTest::RunTest(const FString& Parameters)
+{
+	using namespace RfsnBench;
+
+	// Every minute of the day maps to the same period, which lasts exactly until its end hour
+	FRandomStream Stream(1357);
+	int32 TimeErrors = 0;
+	int32 BoundaryErrors = 0;
+	for (int32 Step = 0; Step < 24 * 60; Step++)
+	{
+		const float Hour = Step / 60.0f + Stream.FRand() / 60.0f;
+		const ERfsnTimeOfDay Time = FRfsnWeatherReactionBatch::GetTimeOfDay(Hour);
+		const float End = FRfsnWeatherReactionBatch::GetPeriodEndHour(Hour);
+		TimeErrors += Time == FLegacyWeatherNpc::TimeOfDayAt(Hour) ? 0 : 1;
+		BoundaryErrors += End > Hour && End <= 24.0f && FLegacyWeatherNpc::TimeOfDayAt(End - 0.001f) == Time ? 0 : 1;
+		BoundaryErrors += End == 24.0f || FLegacyWeatherNpc::TimeOfDayAt(End) != Time ? 0 : 1;
+	}
+	TestEqual(TEXT("Hours mapped differently"), TimeErrors, 0);
+	TestEqual(TEXT("Period ends misplaced"), BoundaryErrors, 0);
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRfsnAdvanceToHourTest, "Rfsn.WeatherReactions.AdvanceToHour",
+                                 EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext |
+                                     EAutomationTestFlags::ProductFilter)
+
+bool FRfsnAdvanceToHourTest::RunTest(const FString& Parameters)
+{
+	FRfsnTestWorld World;
+	AActor* Npc = World.SpawnActor(FVector::ZeroVector);
+	URfsnWeatherReactions* Reactions = World.AddComponent<URfsnWeatherReactions>(Npc);
+	World.BeginPlay();
+
+	URfsnGameClock* Clock = World.GetSubsystem<URfsnGameClock>();
+	if (!TestNotNull(TEXT("Game clock"), Clock))
+	{
+		return false;
+	}
+	Clock->SetGameTime(2, 10.0f);
+
+	// A later hour moves the clock forward within the day
+	Reactions->SetGameTime(14.0f);
+	TestEqual(TEXT("Later hour stays on the same day"), Clock->GetDay(), 2);
+	TestEqual(TEXT("Later hour is set"), Clock->GetGameHour(), 14.0f);
+
+	// A driver lagging the ticking clock by a moment leaves it alone instead of skipping a day
+	Clock->SetGameTime(2, 14.1f);
+	Reactions->SetGameTime(14.0f);
+	TestEqual(TEXT("Lagging hour keeps the day"), Clock->GetDay(), 2);
+	TestEqual(TEXT("Lagging hour keeps the time"), Clock->GetGameHour(), 14.1f);
+
+	// Also across midnight: 23:55 just after the clock wrapped is lag, not a jump to 23:55 of the new day
+	Clock->SetGameTime(3, 0.05f);
+	Reactions->SetGameTime(23.95f);
+	TestEqual(TEXT("Lag across midnight keeps the day"), Clock->GetDay(), 3);
+	TestEqual(TEXT("Lag across midnight keeps the time"), Clock->GetGameHour(), 0.05f);
+
+	// An hour well behind is ignored (and logged) rather than advancing a whole day
+	Clock->SetGameTime(3, 10.0f);
+	AddExpectedError(TEXT("not skipping to the next day"), EAutomationExpectedErrorFlags::Contains, 1);
+	Reactions->SetGameTime(8.0f);
+	TestEqual(TEXT("Earlier hour keeps the day"), Clock->GetDay(), 3);
+	TestEqual(TEXT("Earlier hour keeps the time"), Clock->GetGameHour(), 10.0f);
+
+	// Rewinding stays available at world level
+	World.GetSubsystem<URfsnWorldEnvironment>()->SetGameTime(6.0f);
+	TestEqual(TEXT("World-level SetGameTime keeps the day"), Clock->GetDay(), 3);
+	TestEqual(TEXT("World-level SetGameTime rewinds"), Clock->GetGameHour(), 6.0f);
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
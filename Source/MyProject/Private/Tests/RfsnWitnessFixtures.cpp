@@ -0,0 +1,103 @@
+// RFSN Witness Fixtures Implementation
+
+#include "RfsnWitnessFixtures.h"
+
+namespace RfsnBench
+{
+int32 LegacyRumorTick(TArray<FLegacyKnowledgeMap>& Knowledge, const TArray<FVector>& Locations,
+                      const TBitArray<>& Active, float Radius, float Chance, float GossipChance, float Decay,
+                      FRandomStream& Random)
+{
+	TArray<TPair<int32, int32>> Pairs;
+	for (int32 A = 0; A < Locations.Num(); A++)
+	{
+		for (int32 B = 0; B < Locations.Num(); B++)
+		{
+			if (A != B && FVector::Dist(Locations[A], Locations[B]) < Radius)
+			{
+				Pairs.Add({A, B});
+			}
+		}
+	}
+
+	int32 Spread = 0;
+	for (const TPair<int32, int32>& Pair : Pairs)
+	{
+		if (Random.FRand() > Chance)
+		{
+			continue;
+		}
+
+		for (TPair<int32, FLegacyKnowledge>& Known : Knowledge[Pair.Key])
+		{
+			if (!Active[Known.Key] || !Known.Value.bWillGossip || Knowledge[Pair.Value].Contains(Known.Key))
+			{
+				continue;
+			}
+
+			Known.Value.ShareCount++;
+			FLegacyKnowledge Heard;
+			Heard.Accuracy = FMath::Max(0.1f, Known.Value.Accuracy - Decay);
+			Heard.SourceNpc = Pair.Key;
+			Heard.bWillGossip = Random.FRand() < GossipChance;
+			Knowledge[Pair.Value].Add(Known.Key, Heard);
+			Spread++;
+			break;
+		}
+	}
+	return Spread;
+}
+
+void FWitnessScenario::AddNpcs(int32 NpcCount, float ContactRadius)
+{
+	Matrix.ContactRadius = ContactRadius;
+	Matrix.MaxRumorsPerContact = 1;
+	for (int32 i = 0; i < NpcCount; i++)
+	{
+		Locations.Add(FVector(Stream.FRandRange(0.0f, WitnessArea), Stream.FRandRange(0.0f, WitnessArea), 0.0f));
+	}
+	for (int32 i = 0; i < NpcCount; i++)
+	{
+		Matrix.AddNpc();
+		Matrix.SetNpcLocation(i, Locations[i]);
+	}
+	Legacy.SetNum(NpcCount);
+}
+
+void FWitnessScenario::Witness(float WitnessRadius, float GossipChance)
+{
+	FRandomStream WitnessRandom(1187);
+	TArray<int32> Witnesses;
+	for (int32 e = 0; e < WitnessEvents; e++)
+	{
+		const int32 Event = Matrix.AddEvent();
+		const FVector Where(Stream.FRandRange(0.0f, WitnessArea), Stream.FRandRange(0.0f, WitnessArea), 0.0f);
+
+		Witnesses.Reset();
+		Matrix.QueryNpcs(Where, WitnessRadius, [&Witnesses](int32 Npc) { Witnesses.Add(Npc); });
+		Witnesses.Sort();
+		for (const int32 Npc : Witnesses)
+		{
+			FLegacyKnowledge Saw;
+			Saw.bWillGossip = WitnessRandom.FRand() < GossipChance;
+			Matrix.Learn(Npc, Event, FRfsnKnowledgeMatrix::FCell(), Saw.bWillGossip);
+			Legacy[Npc].Add(Event, Saw);
+		}
+
+		Active.Add(Event % 7 != 0);
+		Matrix.SetEventActive(Event, Active[Event]);
+	}
+}
+
+void FWitnessScenario::Walk()
+{
+	for (int32 Npc = 0; Npc < Locations.Num(); Npc++)
+	{
+		if (Stream.FRand() < 0.3f)
+		{
+			Locations[Npc] += FVector(Stream.FRandRange(-300.0f, 300.0f), Stream.FRandRange(-300.0f, 300.0f), 0.0f);
+			Matrix.SetNpcLocation(Npc, Locations[Npc]);
+		}
+	}
+}
+} // namespace RfsnBench
@@ -0,0 +1,55 @@
+// RFSN Witness Fixtures
+// Per-NPC knowledge maps and rumor ticks as they were before the knowledge matrix
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "RfsnWitnessSystem.h"
+#include "Containers/SortedMap.h"
+
+namespace RfsnBench
+{
+/** Square the witness benchmark scatters NPCs and events over (cm), and how long it gossips */
+constexpr float WitnessArea = 20000.0f;
+constexpr int32 WitnessEvents = 2000;
+constexpr int32 WitnessTicks = 10;
+
+/** What one NPC knew of one event before the knowledge matrix */
+struct FLegacyKnowledge
+{
+	float Accuracy = 1.0f;
+	int32 SourceNpc = INDEX_NONE;
+	int32 ShareCount = 0;
+	bool bWillGossip = false;
+};
+
+/** Per-NPC knowledge maps, iterated in event order */
+using FLegacyKnowledgeMap = TSortedMap<int32, FLegacyKnowledge>;
+
+/**
+ * TickRumorSpreading as it was: every pair of NPCs closer than Radius, then per pair a Chance roll and the
+ * first active event the teller will gossip and the listener lacks. Returns the rumors spread.
+ */
+int32 LegacyRumorTick(TArray<FLegacyKnowledgeMap>& Knowledge, const TArray<FVector>& Locations,
+                      const TBitArray<>& Active, float Radius, float Chance, float GossipChance, float Decay,
+                      FRandomStream& Random);
+
+/** NPCs scattered over WitnessArea who saw WitnessEvents events, held in both knowledge models */
+struct FWitnessScenario
+{
+	FRandomStream Stream{5309};
+	TArray<FVector> Locations;
+	FRfsnKnowledgeMatrix Matrix;
+	TArray<FLegacyKnowledgeMap> Legacy;
+	TBitArray<> Active;
+
+	/** Places the NPCs; contacts are left for the caller to build */
+	void AddNpcs(int32 NpcCount, float ContactRadius);
+
+	/** The same witnesses and gossip rolls for both models; every seventh event has expired */
+	void Witness(float WitnessRadius, float GossipChance);
+
+	/** Moves about a third of the NPCs a few metres */
+	void Walk();
+};
+} // namespace RfsnBench
@@ -0,0 +1,103 @@
+// RFSN Witness Tests
+// The knowledge matrix against the per-NPC maps it replaced: rumor spread and incremental contact lists
+
+#include "RfsnWitnessFixtures.h"
+#include "RfsnWitnessSystem.h"
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRfsnWitnessSpreadTest, "Rfsn.Witness.SpreadMatchesMaps",
+                                 EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext |
+                                     EAutomationTestFlags::ProductFilter)
+
+bool FRfsnWitnessSpreadTest::RunTest(const FString& Parameters)
+{
+	using namespace RfsnBench;
+
+	const URfsnWitnessSystem* Defaults = GetDefault<URfsnWitnessSystem>();
+	const int32 NpcCount = 200;
+
+	FWitnessScenario Scenario;
+	Scenario.AddNpcs(NpcCount, Defaults->ConversationDistance);
+	Scenario.Matrix.UpdateContacts();
+	Scenario.Witness(Defaults->WitnessRadius, Defaults->GossipChance);
+
+	FRandomStream LegacyRandom(77);
+	FRandomStream MatrixRandom(77);
+	int32 LegacySpread = 0;
+	TArray<FRfsnRumorSpread> Spreads;
+	for (int32 Tick = 0; Tick < WitnessTicks; Tick++)
+	{
+		LegacySpread += LegacyRumorTick(Scenario.Legacy, Scenario.Locations, Scenario.Active,
+		                                Defaults->ConversationDistance, Defaults->RumorSpreadChance,
+		                                Defaults->GossipChance, Defaults->AccuracyDecayPerHop, LegacyRandom);
+		Scenario.Matrix.TickSpread(MatrixRandom, Defaults->RumorSpreadChance, Defaults->GossipChance,
+		                           Defaults->AccuracyDecayPerHop, Spreads);
+	}
+	TestEqual(TEXT("Rumors spread"), Spreads.Num(), LegacySpread);
+	TestTrue(TEXT("Some rumors spread"), LegacySpread > 0);
+
+	int32 Mismatches = 0;
+	for (int32 Npc = 0; Npc < NpcCount; Npc++)
+	{
+		for (int32 Event = 0; Event < WitnessEvents; Event++)
+		{
+			const FLegacyKnowledge* Expected = Scenario.Legacy[Npc].Find(Event);
+			const FRfsnKnowledgeMatrix::FCell* Cell = Scenario.Matrix.FindCell(Npc, Event);
+			if (!Expected || !Cell)
+			{
+				Mismatches += (Expected != nullptr) != Scenario.Matrix.Knows(Npc, Event) ? 1 : 0;
+				continue;
+			}
+
+			const bool bSame = Cell->Accuracy == Expected->Accuracy && Cell->SourceNpc == Expected->SourceNpc &&
+			                   Cell->ShareCount == Expected->ShareCount &&
+			                   Scenario.Matrix.WillGossip(Npc, Event) == Expected->bWillGossip;
+			Mismatches += bSame ? 0 : 1;
+		}
+	}
+	TestEqual(TEXT("Knowledge differing from the maps"), Mismatches, 0);
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRfsnWitnessContactsTest, "Rfsn.Witness.IncrementalContacts",
+                                 EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext |
+                                     EAutomationTestFlags::ProductFilter)
+
+bool FRfsnWitnessContactsTest::RunTest(const FString& Parameters)
+{
+	using namespace RfsnBench;
+
+	const float Radius = GetDefault<URfsnWitnessSystem>()->ConversationDistance;
+	const int32 NpcCount = 200;
+
+	FWitnessScenario Scenario;
+	Scenario.AddNpcs(NpcCount, Radius);
+	Scenario.Matrix.UpdateContacts();
+
+	// With no slack every contact list equals an all-pairs rebuild
+	Scenario.Matrix.ContactSlack = 0.0f;
+	int32 WrongContacts = 0;
+	for (int32 Step = 0; Step < 20; Step++)
+	{
+		Scenario.Walk();
+		Scenario.Matrix.UpdateContacts();
+		for (int32 A = 0; A < NpcCount; A++)
+		{
+			TArray<int32> Expected;
+			for (int32 B = 0; B < NpcCount; B++)
+			{
+				if (A != B && FVector::Dist(Scenario.Locations[A], Scenario.Locations[B]) < Radius)
+				{
+					Expected.Add(B);
+				}
+			}
+			WrongContacts += Scenario.Matrix.GetContacts(A) == Expected ? 0 : 1;
+		}
+	}
+	TestEqual(TEXT("Contact lists differing from a rebuild"), WrongContacts, 0);
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
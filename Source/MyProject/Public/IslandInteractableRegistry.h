@@ -0,0 +1,73 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "Components/SceneComponent.h"
+#include "RfsnSpatialHash.h"
+#include "IslandInteractableRegistry.generated.h"
+
+/**
+ * Every IIslandInteractableInterface actor in the world, bucketed by location so the interactor
+ * can tell cheaply whether anything interactable is in front of the camera before tracing.
+ * Actors are picked up when the world begins play, when a streamed level is added and when spawned, and dropped
+ * when they end play (destroyed or streamed out); movable ones are re-bucketed when their root component moves.
+ * Bounds are measured on the first query after an actor registers, once its components are set up.
+ */
+UCLASS()
+class MYPROJECT_API UIslandInteractableRegistry : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	// Add an interactable (actors not implementing the interface are ignored)
+	void Register(AActor* Actor);
+	void Unregister(AActor* Actor);
+
+	// True if any interactable's bounding sphere overlaps the view cone
+	bool AnyInCone(const FVector& Origin, const FVector& Direction, float Range, float HalfAngleDegrees);
+
+	UFUNCTION(BlueprintPure, Category="Interact")
+	int32 GetNumRegistered() const { return Entries.Num(); }
+
+	// Sphere vs cone (apex Origin, unit Direction, length Range) overlap; conservative near the cone's rim
+	static bool SphereInCone(const FVector& Origin, const FVector& Direction, float Range, float HalfAngleRadians,
+	                         const FVector& Center, float Radius);
+
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Deinitialize() override;
+	virtual void OnWorldBeginPlay(UWorld& InWorld) override;
+
+private:
+	struct FEntry
+	{
+		TWeakObjectPtr<AActor> Actor;
+		FVector Location = FVector::ZeroVector;
+		// Bounds radius plus the bounds' offset from the actor origin, so rotation never hides it
+		float Radius = 0.0f;
+		FDelegateHandle MovedHandle;
+	};
+
+	TSparseArray<FEntry> Entries;
+	TMap<TWeakObjectPtr<AActor>, int32> EntryIndices;
+
+	// Entries whose bounds haven't been measured; they sit in the grid as points until then
+	TArray<int32> PendingBounds;
+	FRfsnSpatialHashGrid Grid{500.0f};
+
+	// Largest radius registered; queries widen by it since entries are bucketed by origin
+	float MaxRadius = 0.0f;
+
+	FDelegateHandle SpawnedHandle;
+	FDelegateHandle LevelAddedHandle;
+
+	void HandleActorSpawned(AActor* Actor);
+	void HandleLevelAdded(ULevel* Level, UWorld* World);
+	void HandleRootMoved(USceneComponent* Root, EUpdateTransformFlags Flags, ETeleportType Teleport);
+	void ResolvePendingBounds();
+
+	UFUNCTION()
+	void HandleActorDestroyed(AActor* Actor);
+
+	UFUNCTION()
+	void HandleActorEndPlay(AActor* Actor, EEndPlayReason::Type EndPlayReason);
+};
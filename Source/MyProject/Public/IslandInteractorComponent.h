@@ -2,9 +2,27 @@
 
 #include "CoreMinimal.h"
 #include "Components/ActorComponent.h"
+#include "Engine/EngineTypes.h"
+#include "WorldCollision.h"
 #include "IslandInteractableInterface.h"
 #include "IslandInteractorComponent.generated.h"
 
+class UIslandInteractableRegistry;
+
+// Camera transform a focus trace was issued from
+struct FIslandFocusView
+{
+	FVector Location = FVector::ZeroVector;
+	FRotator Rotation = FRotator::ZeroRotator;
+
+	// Moved or turned past the thresholds since Other (cm, degrees)
+	bool DiffersFrom(const FIslandFocusView& Other, float MoveThreshold, float RotateThreshold) const
+	{
+		return FVector::DistSquared(Location, Other.Location) > FMath::Square(MoveThreshold) ||
+		       !Rotation.Equals(Other.Rotation, RotateThreshold);
+	}
+};
+
 UCLASS(ClassGroup=(Island), meta=(BlueprintSpawnableComponent))
 class MYPROJECT_API UIslandInteractorComponent : public UActorComponent
 {
@@ -19,6 +37,33 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Interact")
 	TEnumAsByte<ECollisionChannel> TraceChannel = ECC_Visibility;
 
+	// Skip the focus trace while the camera has moved less than this since the last one (cm)
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Interact|Performance", meta=(ClampMin="0.0"))
+	float FocusMoveThreshold = 1.0f;
+
+	// Skip the focus trace while the camera has turned less than this since the last one (degrees)
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Interact|Performance", meta=(ClampMin="0.0"))
+	float FocusRotateThreshold = 0.2f;
+
+	// Trace at least this often while still, for things moving into view (seconds, 0 = only when the view changes)
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Interact|Performance", meta=(ClampMin="0.0"))
+	float FocusRefreshInterval = 0.25f;
+
+	// Trace asynchronously; the result is applied next frame
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Interact|Performance")
+	bool bAsyncFocusTrace = false;
+
+	// Only trace when a registered interactable is inside the view cone (UIslandInteractableRegistry).
+	// Off by default: the registry sizes each interactable from its collision bounds once, so one whose
+	// collision grows afterwards can be missed while this is on.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Interact|Performance")
+	bool bUseConePrefilter = false;
+
+	// Half angle of the pre-filter cone (degrees)
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Interact|Performance",
+		meta=(ClampMin="1.0", ClampMax="90.0", EditCondition="bUseConePrefilter"))
+	float PrefilterConeAngle = 15.0f;
+
 	// Last focused interactable (for UI)
 	UPROPERTY(BlueprintReadOnly, Category="Interact")
 	TObjectPtr<AActor> FocusedActor = nullptr;
@@ -30,10 +75,42 @@ public:
 	UFUNCTION(BlueprintCallable, Category="Interact")
 	bool TryInteract();
 
+	// Trace on the next tick even if the camera hasn't moved (e.g. after opening a door)
+	UFUNCTION(BlueprintCallable, Category="Interact")
+	void InvalidateFocus() { bFocusDirty = true; }
+
+	// Trace from this view instead of the player's camera (replays, benchmarks)
+	void SetViewOverride(const FIslandFocusView& View) { ViewOverride = View; }
+	void ClearViewOverride() { ViewOverride.Reset(); }
+
+	// Focus traces issued, and traces the cone pre-filter skipped, since BeginPlay
+	int32 GetNumFocusTraces() const { return NumFocusTraces; }
+	int32 GetNumPrefilteredTraces() const { return NumPrefilteredTraces; }
+
 protected:
 	virtual void BeginPlay() override;
 	virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
 
 private:
-	bool UpdateFocus(FIslandInteractContext& OutCtx, FHitResult& OutHit);
+	FIslandFocusView LastTraceView;
+	double LastTraceTime = 0.0;
+	bool bFocusDirty = true;
+
+	TOptional<FIslandFocusView> ViewOverride;
+	int32 NumFocusTraces = 0;
+	int32 NumPrefilteredTraces = 0;
+
+	FVector FocusHitLocation = FVector::ZeroVector;
+
+	FTraceHandle PendingTrace;
+	FTraceDelegate FocusTraceDelegate;
+
+	UPROPERTY()
+	TObjectPtr<UIslandInteractableRegistry> Registry;
+
+	bool GetView(FIslandFocusView& OutView) const;
+	void TraceFocus(const FIslandFocusView& View);
+	void OnFocusTraceDone(const FTraceHandle& Handle, FTraceDatum& Datum);
+	void ApplyFocus(const FHitResult* Hit);
+	void RefreshPrompt();
 };
@@ -118,6 +118,7 @@ public:
 
 protected:
 	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 	virtual void TickComponent(float DeltaTime, ELevelTick TickType,
 	                           FActorComponentTickFunction* ThisTickFunction) override;
 
@@ -125,6 +126,11 @@ private:
 	float IdleTimer = 0.0f;
 	float NextIdleTime = 0.0f;
 	bool bIdleChatterActive = false;
+	float PlayerCheckTimer = 0.0f;
+
+	/** Player nearby state pushed by URfsnProximityManager */
+	int32 ProximityZone = INDEX_NONE;
+	bool bPlayerNearby = false;
 
 	FString SelectRandomLine(ERfsnChatterTrigger Trigger);
 	void ResetIdleTimer();
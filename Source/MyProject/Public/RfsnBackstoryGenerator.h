@@ -130,6 +130,14 @@ struct FRfsnBackstoryRequest
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnBackstoryGenerated, const FRfsnNpcBackstory&, Backstory);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnBackstoryError, const FString&, Error);
 
+class URfsnBackstoryGenerator;
+
+/** Native completion hook (C++ only) - fires after every request, success or fallback */
+DECLARE_MULTICAST_DELEGATE_TwoParams(FOnBackstoryRequestFinished, URfsnBackstoryGenerator*, bool /*bSuccess*/);
+
+/** Native request hook (C++ only) - receives the request JSON in place of the HTTP POST */
+DECLARE_DELEGATE_TwoParams(FRfsnBackstoryRequestHandler, URfsnBackstoryGenerator*, const FString& /*JsonPayload*/);
+
 /**
  * Procedural backstory generation component
  * Generates NPC backstories on first interaction using LLM
@@ -198,6 +206,13 @@ public:
 	UPROPERTY(BlueprintAssignable, Category = "Backstory|Events")
 	FOnBackstoryError OnBackstoryError;
 
+	/** Called when any generation request finishes (used by URfsnBackstoryPregenerator) */
+	FOnBackstoryRequestFinished OnRequestFinished;
+
+	/** When bound, requests go here instead of BackstoryEndpoint and are answered through CompleteRequest
+	 *  (mock backends in tests) */
+	FRfsnBackstoryRequestHandler RequestHandler;
+
 	// ─────────────────────────────────────────────────────────────
 	// API
 	// ─────────────────────────────────────────────────────────────
@@ -206,10 +221,17 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Backstory")
 	void GenerateBackstory();
 
+	/** Finish the request in flight with a backend response (empty or unparsable falls back to the template) */
+	void CompleteRequest(bool bSuccess, const FString& Response);
+
 	/** Mark that first interaction has occurred (triggers generation if no backstory) */
 	UFUNCTION(BlueprintCallable, Category = "Backstory")
 	void OnFirstInteraction();
 
+	/** Check if a generation request is in flight */
+	UFUNCTION(BlueprintPure, Category = "Backstory")
+	bool IsGenerating() const { return bIsGenerating; }
+
 	/** Check if backstory exists */
 	UFUNCTION(BlueprintPure, Category = "Backstory")
 	bool HasBackstory() const { return CachedBackstory.IsValid(); }
@@ -274,6 +296,9 @@ private:
 	/** Get save slot name for this NPC */
 	FString GetSaveSlotName() const;
 
+	/** Full path of the backstory save file for this NPC */
+	FString GetSavePath() const;
+
 	/** HTTP request callback */
 	void OnBackstoryRequestComplete(bool bSuccess, const FString& Response);
 };
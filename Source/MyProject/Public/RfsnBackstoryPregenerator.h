@@ -0,0 +1,123 @@
+// RFSN Backstory Pregenerator
+// Generates missing NPC backstories at level load so first interactions hit the cache
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "RfsnBackstoryPregenerator.generated.h"
+
+class URfsnBackstoryGenerator;
+
+USTRUCT(BlueprintType)
+struct FRfsnBackstoryPregenStats
+{
+	GENERATED_BODY()
+
+	/** NPCs found without a saved backstory */
+	UPROPERTY(BlueprintReadOnly, Category = "Stats")
+	int32 Queued = 0;
+
+	/** Requests that produced an LLM backstory */
+	UPROPERTY(BlueprintReadOnly, Category = "Stats")
+	int32 Completed = 0;
+
+	/** Requests that fell back to the local template */
+	UPROPERTY(BlueprintReadOnly, Category = "Stats")
+	int32 Failed = 0;
+
+	/** NPCs skipped because they were generated lazily or destroyed first */
+	UPROPERTY(BlueprintReadOnly, Category = "Stats")
+	int32 Skipped = 0;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Stats")
+	float AverageLatencyMs = 0.0f;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Stats")
+	float TotalSeconds = 0.0f;
+};
+
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnBackstoryPregenComplete, const FRfsnBackstoryPregenStats&, Stats);
+
+/**
+ * World Subsystem that pregenerates backstories for every NPC without a save.
+ * Runs once after level load, nearest-to-spawn first, with a bounded number of
+ * requests in flight. Results are persisted through URfsnBackstoryGenerator.
+ */
+UCLASS()
+class MYPROJECT_API URfsnBackstoryPregenerator : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	// ─────────────────────────────────────────────────────────────
+	// Configuration
+	// ─────────────────────────────────────────────────────────────
+
+	/** Start a pregeneration pass automatically when the world begins play */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "RFSN|Backstory")
+	bool bPregenerateOnLevelLoad = true;
+
+	/** Maximum generation requests in flight at once */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "RFSN|Backstory", meta = (ClampMin = "1"))
+	int32 MaxConcurrentRequests = 4;
+
+	/** Maximum NPCs queued per pass (0 = no limit) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "RFSN|Backstory", meta = (ClampMin = "0"))
+	int32 MaxQueuedNpcs = 64;
+
+	/** Abort the rest of the pass when a request fails (backend likely down) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "RFSN|Backstory")
+	bool bAbortOnFailure = true;
+
+	// ─────────────────────────────────────────────────────────────
+	// Events
+	// ─────────────────────────────────────────────────────────────
+
+	UPROPERTY(BlueprintAssignable, Category = "RFSN|Events")
+	FOnBackstoryPregenComplete OnPregenerationComplete;
+
+	// ─────────────────────────────────────────────────────────────
+	// API
+	// ─────────────────────────────────────────────────────────────
+
+	/** Scan the world and queue every NPC without a backstory */
+	UFUNCTION(BlueprintCallable, Category = "RFSN|Backstory")
+	void StartPregeneration();
+
+	/** Drop queued NPCs (in-flight requests still complete) */
+	UFUNCTION(BlueprintCallable, Category = "RFSN|Backstory")
+	void CancelPregeneration();
+
+	/** Is a pass running */
+	UFUNCTION(BlueprintPure, Category = "RFSN|Backstory")
+	bool IsPregenerating() const { return PendingQueue.Num() > 0 || InFlight.Num() > 0; }
+
+	/** Stats for the current or last pass */
+	UFUNCTION(BlueprintPure, Category = "RFSN|Backstory")
+	FRfsnBackstoryPregenStats GetStats() const { return Stats; }
+
+protected:
+	virtual void Deinitialize() override;
+	virtual void OnWorldBeginPlay(UWorld& InWorld) override;
+
+private:
+	/** NPCs waiting for a request slot, nearest first */
+	TArray<TWeakObjectPtr<URfsnBackstoryGenerator>> PendingQueue;
+
+	/** In-flight requests and their start time */
+	TMap<TWeakObjectPtr<URfsnBackstoryGenerator>, double> InFlight;
+
+	/** Re-pumps the queue while requests are in flight, so slots held by destroyed NPCs are released */
+	FTimerHandle InFlightCheckTimer;
+
+	FRfsnBackstoryPregenStats Stats;
+	double PassStartTime = 0.0;
+	float LatencySumMs = 0.0f;
+
+	FVector GetPriorityOrigin() const;
+	void PumpQueue();
+	void SetInFlightCheck(bool bEnable);
+	void HandleRequestFinished(URfsnBackstoryGenerator* Generator, bool bSuccess);
+	void FinishPass();
+};
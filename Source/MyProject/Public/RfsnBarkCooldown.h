@@ -0,0 +1,63 @@
+// RFSN Bark Cooldown State
+// Per-NPC cooldown tracking over a shared, immutable FRfsnNpcBarkSet
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+enum class ERfsnBarkTrigger : uint8;
+class FRfsnNpcBarkSet;
+
+/**
+ * Per-NPC bark availability.
+ * Each trigger bucket keeps its bark indices partitioned into [available | cooling],
+ * so taking or releasing a bark is a single swap. Cooling barks sit in a hashed
+ * timing wheel (intrusive lists, one slot per WheelResolution seconds) and return
+ * to the available partition when their slot is swept. Storage is allocated on first use.
+ */
+struct MYPROJECT_API FRfsnBarkCooldownState
+{
+	static constexpr int32 NumWheelSlots = 64;
+	static constexpr float WheelResolution = 0.5f;
+
+	/** Pick a bark index for a trigger, weighted by priority. INDEX_NONE if none are off cooldown. */
+	int32 Pick(const FRfsnNpcBarkSet& Set, ERfsnBarkTrigger Trigger, float Now);
+
+	/** Pick uniformly among available barks (no priority weighting) */
+	int32 PickUniform(const FRfsnNpcBarkSet& Set, ERfsnBarkTrigger Trigger, float Now);
+
+	/** Is a specific bark off cooldown */
+	bool IsAvailable(const FRfsnNpcBarkSet& Set, int32 BarkIndex, float Now);
+
+	/** Start a bark's cooldown */
+	void MarkUsed(const FRfsnNpcBarkSet& Set, int32 BarkIndex, float Now);
+
+	/** Forget all cooldowns (call when the bark set changes) */
+	void Reset();
+
+	SIZE_T GetAllocatedSize() const;
+
+private:
+	/** Bark indices, partitioned per bucket: available first, cooling after */
+	TArray<uint16> Order;
+
+	/** Position of each bark in Order */
+	TArray<uint16> Position;
+
+	/** Available count per trigger bucket */
+	TArray<uint16> AvailableCount;
+
+	/** Wheel: head of each slot's intrusive list, next link and expiry tick per bark */
+	TArray<uint16> SlotHead;
+	TArray<uint16> NextInSlot;
+	TArray<int32> ExpiryTick;
+
+	int32 WheelTick = 0;
+
+	static constexpr uint16 InvalidLink = MAX_uint16;
+
+	void EnsureInitialized(const FRfsnNpcBarkSet& Set, float Now);
+	void Advance(const FRfsnNpcBarkSet& Set, float Now);
+	void Release(const FRfsnNpcBarkSet& Set, int32 BarkIndex);
+	void Unlink(int32 BarkIndex);
+};
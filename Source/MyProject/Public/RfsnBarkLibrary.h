@@ -0,0 +1,116 @@
+// RFSN Shared Bark Libraries
+// Immutable, ref-counted bark content shared by every NPC of the same archetype.
+// Per-NPC state is reduced to round-robin cursors and a cooldown wheel (RfsnBarkCooldown.h).
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "RfsnInstantBark.h"
+#include "RfsnNpcBarks.h"
+#include "RfsnBarkCooldown.h"
+
+/**
+ * Immutable instant bark content, bucketed by ERfsnBarkCategory
+ */
+class MYPROJECT_API FRfsnInstantBarkSet
+{
+public:
+	static constexpr int32 NumCategories = static_cast<int32>(ERfsnBarkCategory::Grateful) + 1;
+
+	explicit FRfsnInstantBarkSet(const FRfsnBarkLibrary& Source);
+
+	const TArray<FRfsnInstantBarkEntry>& GetBucket(ERfsnBarkCategory Category) const
+	{
+		return Buckets[static_cast<int32>(Category)];
+	}
+
+	SIZE_T GetAllocatedSize() const;
+
+private:
+	TArray<FRfsnInstantBarkEntry> Buckets[NumCategories];
+};
+
+/**
+ * Immutable NPC bark definition (no per-instance usage state)
+ */
+struct FRfsnBarkDef
+{
+	ERfsnBarkTrigger Trigger = ERfsnBarkTrigger::Idle;
+	FString Text;
+	FString CustomTag;
+	int32 Priority = 5;
+	float Cooldown = 30.0f;
+};
+
+/**
+ * Immutable NPC bark content, stored contiguously and sorted by trigger
+ */
+class MYPROJECT_API FRfsnNpcBarkSet
+{
+public:
+	static constexpr int32 NumTriggers = static_cast<int32>(ERfsnBarkTrigger::Custom) + 1;
+
+	explicit FRfsnNpcBarkSet(const TArray<FRfsnBark>& Source);
+
+	int32 Num() const { return Defs.Num(); }
+	const FRfsnBarkDef& GetDef(int32 Index) const { return Defs[Index]; }
+
+	/** First bark index for a trigger; bucket is [GetBucketStart, GetBucketStart + GetBucketSize) */
+	int32 GetBucketStart(ERfsnBarkTrigger Trigger) const { return BucketStart[static_cast<int32>(Trigger)]; }
+	int32 GetBucketSize(ERfsnBarkTrigger Trigger) const
+	{
+		return BucketStart[static_cast<int32>(Trigger) + 1] - BucketStart[static_cast<int32>(Trigger)];
+	}
+
+	/** Highest priority in a bucket (bounds the rejection-sampling roll) */
+	int32 GetMaxPriority(ERfsnBarkTrigger Trigger) const { return MaxPriority[static_cast<int32>(Trigger)]; }
+
+	/** Indices of Custom barks with a given tag, in authoring order */
+	const TArray<uint16>* FindCustomTag(const FString& CustomTag) const;
+
+	/** Convert back to the authoring representation (for runtime edits) */
+	void ToBarks(TArray<FRfsnBark>& OutBarks) const;
+
+	SIZE_T GetAllocatedSize() const;
+
+private:
+	TArray<FRfsnBarkDef> Defs;
+	int32 BucketStart[NumTriggers + 1];
+	int32 MaxPriority[NumTriggers];
+	TMap<FString, TArray<uint16>> CustomTagIndex;
+};
+
+using FRfsnInstantBarkSetRef = TSharedRef<const FRfsnInstantBarkSet, ESPMode::ThreadSafe>;
+using FRfsnNpcBarkSetRef = TSharedRef<const FRfsnNpcBarkSet, ESPMode::ThreadSafe>;
+
+/**
+ * Registry of shared bark sets, keyed by content hash.
+ * Components with identical authored barks (e.g. every instance of one Blueprint)
+ * share one set; an empty authored library maps to the built-in defaults.
+ * Sets are held weakly and freed when the last NPC using them is destroyed.
+ */
+class MYPROJECT_API FRfsnBarkLibraryRegistry
+{
+public:
+	static FRfsnInstantBarkSetRef AcquireInstantBarks(const FRfsnBarkLibrary& Authored);
+	static FRfsnNpcBarkSetRef AcquireNpcBarks(const TArray<FRfsnBark>& Authored);
+
+	/** Built-in default content (authoring form) */
+	static const FRfsnBarkLibrary& GetDefaultInstantBarks();
+	static const TArray<FRfsnBark>& GetDefaultNpcBarks();
+
+	/** Is the authored library empty (falls back to defaults) */
+	static bool IsEmpty(const FRfsnBarkLibrary& Library);
+
+	/** Category -> field mapping for the authoring struct */
+	static const TArray<FRfsnInstantBarkEntry>& GetLibraryBucket(const FRfsnBarkLibrary& Library,
+	                                                             ERfsnBarkCategory Category);
+	static TArray<FRfsnInstantBarkEntry>& GetLibraryBucket(FRfsnBarkLibrary& Library, ERfsnBarkCategory Category);
+
+	/** Number of live shared sets (for stats) */
+	static int32 GetNumLiveSets();
+
+private:
+	static uint64 HashLibrary(const FRfsnBarkLibrary& Library);
+	static uint64 HashBarks(const TArray<FRfsnBark>& Barks);
+};
@@ -0,0 +1,104 @@
+// RFSN Benchmarks
+// Synthetic micro-benchmarks for RFSN runtime systems, run from the console (RfsnBench)
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Console-driven benchmarks.
+ * Each benchmark compares the current implementation against an emulation of the
+ * previous one at a given NPC count and logs memory and timing to LogRfsn.
+ * Correctness is covered by the Rfsn.* automation tests. Each feature's workload and legacy emulation sits beside
+ * its test in Private/Tests/Rfsn<Feature>Fixtures.h; RfsnBenchFixtures.h holds the few pieces they share.
+ */
+class MYPROJECT_API FRfsnBenchmarks
+{
+public:
+	/** Run a benchmark by name (case-insensitive). Returns false if the name is unknown. */
+	static bool Run(const FString& Name, int32 Count);
+
+	/** Names accepted by Run */
+	static TArray<FString> GetBenchmarkNames();
+
+	/** Bark library memory and selection cost: per-NPC copies vs shared sets */
+	static void RunBarks(int32 NpcCount);
+
+	/** Lip sync on synthetic PCM: analysis cost and morph writes per second */
+	static void RunLipSync(int32 Iterations);
+
+	/** Awareness cost against NPC count: per-NPC Acos checks vs the batched cull, hearing broadcast, LOS traces */
+	static void RunPerception(int32 NpcCount);
+
+	/** Proximity tracker cost vs per-zone polling */
+	static void RunProximity(int32 NpcCount);
+
+	/** Schedule transitions from the game-clock timing wheel vs per-NPC polling, across midnights, weekdays,
+	 *  time-scale changes and a rewind */
+	static void RunSchedule(int32 NpcCount);
+
+	/** Lazy needs simulation against the 1 Hz tick model: values, state changes and critical events,
+	 *  with scripted feeding and threats */
+	static void RunNeeds(int32 NpcCount);
+
+	/** Shop-screen pricing of a large inventory: linear string scans vs the item index and price cache */
+	static void RunPricing(int32 ItemCount);
+
+	/** Faction relation queries: string map and list search vs the string API and indexed bit matrices,
+	 *  including ally-of-ally reachability */
+	static void RunFactions(int32 FactionCount);
+
+	/** UIslandInteractorComponent over a scripted camera path: frame cost and traces per tick vs the movement
+	 *  throttle, the cone pre-filter and async traces */
+	static void RunFocus(int32 Frames);
+
+	/** RFSN trace channel: times RFSN_TRACE_SCOPE with the channel off and on, and captures a short .utrace of
+	 *  the memory and emotion paths for Unreal Insights (Rfsn.Trace.Capture checks what a capture contains) */
+	static void RunTrace(int32 Iterations);
+
+	/** NPC significance over a minute of play in a spawned world: component ticks and frame time at fixed rates
+	 *  vs significance buckets, and bucket changes with and without hysteresis */
+	static void RunSignificance(int32 NpcCount);
+
+	/** Token decoding: the perfect hash against the old if-chain, and the meta event's action against a full
+	 *  JSON parse */
+	static void RunTokens(int32 Iterations);
+
+	/** Witness knowledge for NpcCount NPCs and 2000 events: the knowledge matrix and contact graph against the
+	 *  old per-NPC maps */
+	static void RunWitness(int32 NpcCount);
+
+	/** Response cache against a mock orchestrator: replays a workload of repeated utterances and reports the hit
+	 *  rate, round-trips saved and lookup cost */
+	static void RunResponseCache(int32 Requests);
+
+	/** Streaming subtitles on a mock token stream: time to first character and typing out a burst of sentences
+	 *  against the old queue and full re-layout */
+	static void RunSubtitles(int32 Sentences);
+
+	/** Conversation log over Messages entries: logging, search and export against the old array log */
+	static void RunConversationLog(int32 Messages);
+
+	/** Group conversation turn taking over Turns turns: turn gaps against a mock backend with and without
+	 *  prefetching */
+	static void RunTurnTaking(int32 Turns);
+
+	/** Weather reactions of NpcCount NPCs: a weather change and a minute of steady state through the batched
+	 *  archetype tables against the old 5 s component ticks */
+	static void RunWeatherReactions(int32 NpcCount);
+
+	/** Look-at for NpcCount NPCs following a walking player: a frame of the batched solve, serial and parallel,
+	 *  against the old ticks on every NPC, and how long cleared NPCs take to sleep */
+	static void RunLookAt(int32 NpcCount);
+
+	/** Relationship decay for NpcCount NPCs: a 30-day skip stepped hourly against the lazy ledger and per-NPC
+	 *  fast-forwards */
+	static void RunRelationshipDecay(int32 NpcCount);
+
+	/** Quest topics for one NPC offering QuestCount quests: topic detection, lookups and the context string
+	 *  against the old per-quest scans, and matcher compile */
+	static void RunQuestTopics(int32 QuestCount);
+
+	/** Record-and-replay of Dialogues dialogue streams: file size, playback through the client, save and load */
+	static void RunStreamReplay(int32 Dialogues);
+};
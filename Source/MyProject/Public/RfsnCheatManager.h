@@ -61,6 +61,42 @@ public:
 	UFUNCTION(Exec)
 	virtual void RfsnDumpLog();
 
+	/** Search this session's conversation transcript (e.g. "RfsnSearchLog radio tower") */
+	UFUNCTION(Exec)
+	virtual void RfsnSearchLog(const FString& Query);
+
+	/** Run a backstory pregeneration pass, or print stats if one is running */
+	UFUNCTION(Exec)
+	virtual void RfsnPregenBackstories();
+
+	/** Run a named benchmark (e.g. "RfsnBench Barks 500") */
+	UFUNCTION(Exec)
+	virtual void RfsnBench(const FString& Name, int32 Count);
+
+	/** Spawn a crowd and load test dialogue against the orchestrator (e.g. "RfsnLoadTest 100 60") */
+	UFUNCTION(Exec)
+	virtual void RfsnLoadTest(int32 NpcCount, float DurationSeconds);
+
+	/** Start recording every NPC's dialogue streams; run again to save them to Saved/Profiling/RfsnSessions */
+	UFUNCTION(Exec)
+	virtual void RfsnRecord();
+
+	/** Load test looping a recorded session on every NPC (e.g. "RfsnReplayTest npc_001 100 60 1"; speed -1 = max) */
+	UFUNCTION(Exec)
+	virtual void RfsnReplayTest(const FString& Session, int32 NpcCount, float DurationSeconds, float Speed);
+
+	/** Director bridge over the push channel, then polling, against the orchestrator (e.g. "RfsnDirectorTest 60") */
+	UFUNCTION(Exec)
+	virtual void RfsnDirectorTest(float DurationSeconds);
+
+	/** Jump the game clock (e.g. "RfsnSetTime 2 21.5" = day 2, 21:30) */
+	UFUNCTION(Exec)
+	virtual void RfsnSetTime(int32 Day, float Hour);
+
+	/** Set real seconds per game hour (default 60) */
+	UFUNCTION(Exec)
+	virtual void RfsnTimeScale(float SecondsPerGameHour);
+
 private:
 	bool bMockModeEnabled = false;
 };
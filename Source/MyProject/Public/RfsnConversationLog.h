@@ -5,6 +5,8 @@
 
 #include "Components/ActorComponent.h"
 #include "CoreMinimal.h"
+#include "Async/Future.h"
+#include "HAL/CriticalSection.h"
 #include "RfsnNpcClientComponent.h"
 #include "RfsnConversationLog.generated.h"
 
@@ -27,10 +29,187 @@ struct FRfsnConversationEntry
 };
 
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnConversationUpdated, const FRfsnConversationEntry&, Entry);
+DECLARE_DYNAMIC_DELEGATE_OneParam(FOnTranscriptSearched, const TArray<FRfsnConversationEntry>&, Results);
+
+/**
+ * Fixed-capacity ring of the latest conversation entries. Speaker names are interned once per log, so an
+ * entry holds a small index instead of its own copy of the name. Every entry gets a serial number, counting
+ * from 0 for the first entry ever logged, that stays valid after the ring has wrapped past it.
+ */
+struct MYPROJECT_API FRfsnConversationRing
+{
+	/** Append an entry, overwriting the oldest once full; returns its serial */
+	int32 Add(const FString& Speaker, const FString& Message, const FDateTime& Timestamp, bool bIsPlayer);
+
+	/** Change how many entries are kept, keeping the newest */
+	void SetCapacity(int32 NewCapacity);
+
+	/** Forget the entries (serials keep counting; interned names stay) */
+	void Reset();
+
+	int32 Num() const { return Count; }
+	int32 GetCapacity() const { return Slots.Num(); }
+	int32 GetNumSpeakers() const { return Speakers.Num(); }
+
+	/** Serial of the oldest entry still held, and of the next entry to be logged */
+	int32 GetOldestSerial() const { return NextSerial - Count; }
+	int32 GetNextSerial() const { return NextSerial; }
+
+	/** Entry by age, 0 being the oldest held */
+	FRfsnConversationEntry Get(int32 Index) const;
+
+	/** Entry by serial; false once it has been overwritten */
+	bool FindBySerial(int32 Serial, FRfsnConversationEntry& OutEntry) const;
+
+	/** Visit the last MaxCount entries (all of them by default), oldest first, without copying */
+	void ForEach(TFunctionRef<void(const FString& Speaker, const FString& Message, const FDateTime& Timestamp,
+	                               bool bIsPlayer)> Visitor,
+	             int32 MaxCount = MAX_int32) const;
+
+private:
+	struct FSlot
+	{
+		FString Message;
+		FDateTime Timestamp;
+		uint16 Speaker = 0;
+		bool bIsPlayer = false;
+	};
+
+	TArray<FSlot> Slots;
+	/** Slot of the oldest entry */
+	int32 Head = 0;
+	int32 Count = 0;
+	int32 NextSerial = 0;
+
+	TArray<FString> Speakers;
+	TMap<FString, uint16> SpeakerIds;
+
+	uint16 Intern(const FString& Speaker);
+	const FSlot& SlotAt(int32 Index) const { return Slots[(Head + Index) % Slots.Num()]; }
+};
+
+/**
+ * Inverted word index of a session transcript: each lower-cased word maps to the ascending serials of the
+ * entries that contain it, so a query intersects a few short lists instead of scanning every message.
+ */
+struct MYPROJECT_API FRfsnTranscriptIndex
+{
+	/** Index a message; serials must be added in increasing order */
+	void Add(int32 Serial, FStringView Message);
+
+	/** Serials of the entries that contain every word of the query, newest first */
+	void Search(FStringView Query, int32 MaxResults, TArray<int32>& OutSerials) const;
+
+	/** Forget every serial below Serial; words left with no entries are dropped */
+	void RemoveBefore(int32 Serial);
+
+	void Reset();
+
+	int32 NumWords() const { return Postings.Num(); }
+
+	/** Serials the index spans, from the oldest kept to the newest added */
+	int32 NumEntries() const { return NextSerial - FirstSerial; }
+	SIZE_T GetAllocatedSize() const;
+
+	/** Lower-cased runs of letters, digits and apostrophes: "Don't GO there!" -> don't, go, there */
+	static void Tokenize(FStringView Text, TArray<FString>& OutWords);
+
+private:
+	TMap<FString, TArray<int32>> Postings;
+	int32 FirstSerial = 0;
+	int32 NextSerial = 0;
+};
+
+/** Running totals of a transcript exporter */
+struct FRfsnTranscriptExportStats
+{
+	int32 ChunksWritten = 0;
+	int32 EntriesWritten = 0;
+	int64 RawBytes = 0;
+	int64 CompressedBytes = 0;
+	int32 Failures = 0;
+};
+
+/**
+ * Writes a session transcript as numbered, zlib-compressed chunk files. Entries are collected on the calling
+ * thread; each full chunk is serialized there and compressed and written on the thread pool. Every chunk
+ * starts with a header (magic, version, first serial, count, sizes, CRC32 of the uncompressed payload) so a
+ * reader can reject a truncated or corrupted file.
+ */
+struct MYPROJECT_API FRfsnTranscriptExporter
+{
+	/** Entries per chunk file */
+	int32 ChunkEntries = 64;
+
+	~FRfsnTranscriptExporter();
+
+	/** Start a session writing into Directory (created if missing); finishes any previous session first */
+	void Begin(const FString& InDirectory);
+
+	/** Queue an entry; writes the chunk once ChunkEntries have been queued */
+	void Add(int32 Serial, const FRfsnConversationEntry& Entry);
+
+	/** Write whatever is queued as a (short) chunk */
+	void FlushChunk();
+
+	/** Flush and block until every chunk is on disk */
+	void Finish();
+
+	bool IsActive() const { return !Directory.IsEmpty(); }
+	const FString& GetDirectory() const { return Directory; }
+	FRfsnTranscriptExportStats GetStats() const;
+
+	/**
+	 * Entries by serial from the queued chunk and the files written so far; serials never exported are left out.
+	 * Chunks still being written are answered from memory and finished files are read on the thread pool, so
+	 * neither the caller nor a pool thread ever waits on a write.
+	 */
+	TFuture<TMap<int32, FRfsnConversationEntry>> FindBySerialsAsync(const TArray<int32>& Serials) const;
+
+	/** Decode one chunk file; false if it is missing, truncated or fails its CRC */
+	static bool ReadChunk(const FString& Path, int32& OutFirstSerial, TArray<FRfsnConversationEntry>& OutEntries);
+
+	/** Every chunk in Directory in serial order; false if any of them fails to decode */
+	static bool ReadTranscript(const FString& InDirectory, TArray<FRfsnConversationEntry>& OutEntries);
+
+private:
+	struct FChunkInfo
+	{
+		int32 FirstSerial = 0;
+		int32 Count = 0;
+		FString Path;
+		/** Set once the file is on disk (true) or failed to write */
+		TSharedFuture<bool> Written;
+		/** The chunk's entries until its file is on disk (kept if the write failed) */
+		TArray<FRfsnConversationEntry> Entries;
+	};
+
+	FString Directory;
+	int32 PendingFirstSerial = 0;
+	TArray<FRfsnConversationEntry> Pending;
+	TArray<FChunkInfo> Chunks;
+
+	/** Written by the pool threads */
+	struct FSharedStats
+	{
+		FCriticalSection Lock;
+		FRfsnTranscriptExportStats Stats;
+	};
+	TSharedRef<FSharedStats, ESPMode::ThreadSafe> Shared = MakeShared<FSharedStats, ESPMode::ThreadSafe>();
+
+	void WaitForWrites();
+
+	/** Drop the in-memory entries of chunks whose files are now on disk */
+	void ReleaseWrittenChunks();
+};
 
 /**
  * Component that logs conversation history with NPCs.
  * Can be attached to player or used globally.
+ * The latest MaxEntries are kept in a ring for display. With bExportTranscript the session is written to
+ * Saved/Conversations/<session> in compressed chunks off the game thread and its latest MaxIndexedEntries are
+ * indexed by word, so SearchTranscript can find entries the ring has long dropped; without it only the ring is
+ * searched.
  */
 UCLASS(ClassGroup = (Custom), meta = (BlueprintSpawnableComponent))
 class MYPROJECT_API URfsnConversationLog : public UActorComponent
@@ -48,6 +227,18 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Conversation")
 	int32 MaxEntries = 50;
 
+	/** Write the session transcript to Saved/Conversations and index it for SearchTranscript (read at BeginPlay) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Conversation")
+	bool bExportTranscript = false;
+
+	/** Exported entries SearchTranscript can find; older ones stay in the transcript files (0 = unbounded) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Conversation", meta = (ClampMin = "0"))
+	int32 MaxIndexedEntries = 20000;
+
+	/** Entries per compressed transcript chunk */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Conversation", meta = (ClampMin = "1"))
+	int32 ExportChunkEntries = 64;
+
 	// ─────────────────────────────────────────────────────────────
 	// Events
 	// ─────────────────────────────────────────────────────────────
@@ -67,15 +258,44 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Conversation")
 	void LogNpcMessage(const FString& NpcName, const FString& Message);
 
-	/** Get all conversation entries */
+	/** Get all conversation entries, oldest first */
 	UFUNCTION(BlueprintPure, Category = "Conversation")
-	const TArray<FRfsnConversationEntry>& GetEntries() const { return Entries; }
+	TArray<FRfsnConversationEntry> GetEntries() const { return GetRecentEntries(Ring.Num()); }
 
 	/** Get last N entries */
 	UFUNCTION(BlueprintCallable, Category = "Conversation")
 	TArray<FRfsnConversationEntry> GetRecentEntries(int32 Count) const;
 
-	/** Clear conversation log */
+	/** Number of entries held */
+	UFUNCTION(BlueprintPure, Category = "Conversation")
+	int32 GetNumEntries() const { return Ring.Num(); }
+
+	/** Visit the last Count entries (all by default), oldest first, without copying them */
+	void ForEachEntry(TFunctionRef<void(const FString& Speaker, const FString& Message, const FDateTime& Timestamp,
+	                                    bool bIsPlayer)> Visitor,
+	                  int32 Count = MAX_int32) const
+	{
+		Ring.ForEach(Visitor, Count);
+	}
+
+	/**
+	 * Entries containing every word of Query, newest first, passed to OnResults on the game thread. Entries the
+	 * ring dropped are read back from the exported transcript off the game thread.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Conversation")
+	void SearchTranscript(const FString& Query, int32 MaxResults, const FOnTranscriptSearched& OnResults);
+
+	/** SearchTranscript for C++; completes on a pool thread when entries have to be read from disk */
+	TFuture<TArray<FRfsnConversationEntry>> SearchTranscriptAsync(const FString& Query, int32 MaxResults = 20);
+
+	/** Where this session's transcript is written; empty while not exporting */
+	const FString& GetTranscriptDirectory() const { return Exporter.GetDirectory(); }
+
+	/** Write the queued transcript entries now instead of waiting for a full chunk */
+	UFUNCTION(BlueprintCallable, Category = "Conversation")
+	void FlushTranscript();
+
+	/** Clear conversation log and its search index (chunks already exported stay on disk) */
 	UFUNCTION(BlueprintCallable, Category = "Conversation")
 	void ClearLog();
 
@@ -84,12 +304,18 @@ public:
 	void BindToRfsnClient(URfsnNpcClientComponent* Client);
 
 protected:
-	UPROPERTY()
-	TArray<FRfsnConversationEntry> Entries;
+	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 
 private:
 	UFUNCTION()
 	void OnRfsnSentence(const FRfsnSentence& Sentence);
 
+	void LogEntry(const FString& Speaker, const FString& Message, bool bIsPlayer);
+
 	FString BoundNpcName;
+
+	FRfsnConversationRing Ring;
+	FRfsnTranscriptIndex Index;
+	FRfsnTranscriptExporter Exporter;
 };
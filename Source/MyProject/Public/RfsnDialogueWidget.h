@@ -5,6 +5,7 @@
 
 #include "CoreMinimal.h"
 #include "Components/ActorComponent.h"
+#include "Fonts/SlateFontInfo.h"
 #include "RfsnNpcClientComponent.h"
 #include "RfsnDialogueWidget.generated.h"
 
@@ -13,9 +14,134 @@ class UWidgetComponent;
 
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnDialogueDisplayed, const FString&, NpcName, const FString&, Sentence);
 
+/**
+ * Word wrap of a growing subtitle line that only measures what was appended.
+ * Each Append lays out the characters added since the last call: every run of spaces or non-spaces is measured
+ * once, kerned against the character before it, and a word that crosses MaxWidth moves to a new line without
+ * the text before it being laid out again.
+ */
+struct MYPROJECT_API FRfsnSubtitleLayout
+{
+	/** Width of Text[Start, End), kerned against Text[Start - 1] */
+	using FMeasureRun = TFunction<float(const FString& Text, int32 Start, int32 End)>;
+
+	float MaxWidth = 400.0f;
+
+	FMeasureRun MeasureRun;
+
+	/** Lay out the end of Text past what was laid out before; Text must extend the text already laid out */
+	void Append(const FString& Text);
+
+	void Reset();
+
+	/** Index in the text of the first character of every line after the first */
+	const TArray<int32>& GetLineBreaks() const { return LineBreaks; }
+
+	/** Text split at the line breaks, without the spaces each break swallowed */
+	void GetLines(const FString& Text, TArray<FString>& OutLines) const;
+
+	/** Characters handed to MeasureRun since the last Reset */
+	int32 GetMeasuredChars() const { return MeasuredChars; }
+
+private:
+	TArray<int32> LineBreaks;
+	int32 LaidOut = 0;
+	int32 LineStart = 0;
+	/** Start of the last word, which a wrap would move */
+	int32 WordStart = 0;
+	/** Width of the open line up to WordStart, spaces included */
+	float LineWidth = 0.0f;
+	float WordWidth = 0.0f;
+	int32 MeasuredChars = 0;
+};
+
+/** FIFO of subtitle lines waiting for the screen: a ring over a power-of-two array, so popping never shifts */
+struct MYPROJECT_API FRfsnSubtitleQueue
+{
+	void Push(FString&& Line);
+
+	/** Take the oldest line; false if empty */
+	bool Pop(FString& OutLine);
+
+	/** Newest line, for text still streaming into it */
+	FString& Last();
+
+	void Reset();
+
+	int32 Num() const { return Count; }
+	bool IsEmpty() const { return Count == 0; }
+
+private:
+	TArray<FString> Slots;
+	int32 Head = 0;
+	int32 Count = 0;
+};
+
+/**
+ * World-independent core of URfsnDialogueWidget: streamed text in, revealed subtitle text out.
+ * Fragments (whole sentences from the orchestrator and mock_server.py, or single tokens from a token stream) are
+ * appended verbatim to the newest line, which closes at sentence-ending punctuation or the end of the turn.
+ * The line on screen keeps growing while it is open and later lines wait in the queue. The typewriter appends the
+ * newly revealed characters to the display text and the layout instead of rebuilding either.
+ */
+struct MYPROJECT_API FRfsnSubtitleStream
+{
+	FRfsnSubtitleLayout Layout;
+
+	/** Characters revealed per second; 0 shows text as soon as it arrives */
+	float RevealSpeed = 40.0f;
+
+	/** Add streamed text; bEndsTurn closes the line it lands in. Returns true if a line went on screen. */
+	bool Append(FStringView Fragment, bool bEndsTurn);
+
+	/** Replace the line on screen with a closed one, keeping the queue */
+	void Show(FStringView Line);
+
+	/** Close the newest line (the turn ended without closing punctuation) */
+	void CloseOpenLine();
+
+	/** Put the oldest queued line on screen; false if there is none */
+	bool ShowNext();
+
+	/** Advance the typewriter; returns how many characters were revealed */
+	int32 Reveal(float DeltaTime);
+
+	/** Drop the line on screen and everything queued */
+	void Reset();
+
+	bool IsShowing() const { return bShowing; }
+	bool IsCurrentOpen() const { return bShowing && bCurrentOpen; }
+	bool IsFullyRevealed() const { return DisplayText.Len() == FullText.Len(); }
+	const FString& GetFullText() const { return FullText; }
+	const FString& GetDisplayText() const { return DisplayText; }
+	int32 NumQueued() const { return Queue.Num(); }
+
+	/** Lines put on screen so far, so callers can tell one line from the next */
+	int32 GetLinesShown() const { return LinesShown; }
+
+	/** Ends in . ! ? or an ellipsis, ignoring trailing spaces, quotes and brackets */
+	static bool EndsSentence(FStringView Text);
+
+private:
+	FString FullText;
+	FString DisplayText;
+	float RevealProgress = 0.0f;
+	bool bShowing = false;
+	bool bCurrentOpen = false;
+	/** The newest queued line is still receiving text */
+	bool bTailOpen = false;
+	int32 LinesShown = 0;
+	FRfsnSubtitleQueue Queue;
+
+	void ShowLine(FString&& Line, bool bOpen);
+	void RevealTo(int32 NumChars);
+};
+
 /**
  * Component that manages dialogue display for RFSN NPCs.
  * Can render dialogue as 3D world widget or screen-space UI.
+ * Text is shown as it streams in, so the first characters appear before the sentence is complete; the time
+ * from the player's utterance to the first character is recorded in URfsnMetrics.
  */
 UCLASS(ClassGroup = (Custom), meta = (BlueprintSpawnableComponent))
 class MYPROJECT_API URfsnDialogueWidget : public UActorComponent
@@ -49,6 +175,10 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Dialogue|Display")
 	float MaxTextWidth = 400.0f;
 
+	/** Font the subtitle is drawn in, used to measure where lines wrap */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Dialogue|Display")
+	FSlateFontInfo SubtitleFont;
+
 	// ─────────────────────────────────────────────────────────────
 	// Events
 	// ─────────────────────────────────────────────────────────────
@@ -75,11 +205,15 @@ public:
 
 	/** Get currently displayed text */
 	UFUNCTION(BlueprintPure, Category = "Dialogue")
-	FString GetCurrentText() const { return CurrentDisplayText; }
+	FString GetCurrentText() const { return Stream.GetDisplayText(); }
+
+	/** Currently displayed text wrapped to MaxTextWidth */
+	UFUNCTION(BlueprintPure, Category = "Dialogue")
+	TArray<FString> GetCurrentLines() const;
 
 	/** Check if dialogue is currently showing */
 	UFUNCTION(BlueprintPure, Category = "Dialogue")
-	bool IsShowingDialogue() const { return bIsShowingDialogue; }
+	bool IsShowingDialogue() const { return Stream.IsShowing(); }
 
 protected:
 	virtual void BeginPlay() override;
@@ -89,19 +223,25 @@ protected:
 
 private:
 	FString CurrentNpcName;
-	FString CurrentFullText;
-	FString CurrentDisplayText;
-	bool bIsShowingDialogue = false;
-	float TypewriterProgress = 0.0f;
+	FRfsnSubtitleStream Stream;
 	FTimerHandle ClearTimer;
 
-	TArray<FString> SentenceQueue;
-	bool bIsProcessingQueue = false;
+	TWeakObjectPtr<URfsnNpcClientComponent> BoundClient;
+	/** Client dialogue start time of the turn on screen; text from a newer turn interrupts it */
+	double TurnStartTime = 0.0;
+	bool bAwaitingFirstCharacter = false;
+	/** Stream line last announced through OnDialogueDisplayed */
+	int32 AnnouncedLine = 0;
 
 	UFUNCTION()
 	void OnRfsnSentenceReceived(const FRfsnSentence& Sentence);
 
-	void ProcessNextSentence();
-	void UpdateTypewriter(float DeltaTime);
+	UFUNCTION()
+	void OnRfsnDialogueComplete();
+
+	/** Copy the display settings into the stream */
+	void ApplySettings();
+	/** Announce a line once it is on screen and closed, record the first character and start or stop ticking */
+	void OnStreamChanged();
 	void OnSentenceTimeout();
 };
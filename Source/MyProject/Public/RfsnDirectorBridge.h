@@ -9,11 +9,19 @@
 #include "RfsnNpcClientComponent.h"
 #include "RfsnDirectorBridge.generated.h"
 
+class FJsonObject;
 class UIslandDirectorSubsystem;
 
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnRfsnDirectorCommand, const FString&, CommandName);
+
 /**
  * Bridges the RFSN Orchestrator with the Island Director system.
  * Allows RFSN to influence game pacing, spawning, and intensity.
+ *
+ * By default commands arrive over a push channel: game state is sent once,
+ * then only as deltas when it changes, and a long-poll request is kept open
+ * for commands. While the channel is down the bridge falls back to polling
+ * DirectorUrl and keeps trying to reopen the channel.
  */
 UCLASS(ClassGroup = (Custom), meta = (BlueprintSpawnableComponent))
 class MYPROJECT_API URfsnDirectorBridge : public UActorComponent
@@ -40,6 +48,42 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "RFSN|Director")
 	bool bAutoPolling = false;
 
+	/** Receive commands over the push channel, polling only while it is down */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "RFSN|Director|Channel")
+	bool bUsePushChannel = true;
+
+	/** Base URL of the push channel (open, state and commands endpoints) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "RFSN|Director|Channel")
+	FString ChannelUrl = TEXT("http://127.0.0.1:8000/api/director/channel");
+
+	/** How long the server may hold a command request open (seconds) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "RFSN|Director|Channel",
+	          meta = (ClampMin = "1.0", ClampMax = "60.0"))
+	float LongPollTimeout = 25.0f;
+
+	/** How often game state is checked for changes worth sending (seconds) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "RFSN|Director|Channel",
+	          meta = (ClampMin = "0.1", ClampMax = "5.0"))
+	float StateCheckInterval = 0.5f;
+
+	/** Alert level change that is sent as a delta */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "RFSN|Director|Channel",
+	          meta = (ClampMin = "0.0"))
+	float AlertDeltaThreshold = 2.0f;
+
+	/** Seconds between attempts to reopen a dropped channel */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "RFSN|Director|Channel",
+	          meta = (ClampMin = "1.0"))
+	float ReconnectInterval = 10.0f;
+
+	// ─────────────────────────────────────────────────────────────
+	// Events
+	// ─────────────────────────────────────────────────────────────
+
+	/** Called for each named command applied, from the channel or a poll */
+	UPROPERTY(BlueprintAssignable, Category = "RFSN|Director")
+	FOnRfsnDirectorCommand OnDirectorCommand;
+
 	// ─────────────────────────────────────────────────────────────
 	// API
 	// ─────────────────────────────────────────────────────────────
@@ -52,27 +96,69 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "RFSN|Director")
 	void ApplyNpcActionToDirector(ERfsnNpcAction Action);
 
-	/** Start automatic polling */
+	/** Start receiving director commands (push channel, or polling when disabled or down) */
 	UFUNCTION(BlueprintCallable, Category = "RFSN|Director")
 	void StartPolling();
 
-	/** Stop automatic polling */
+	/** Stop receiving director commands */
 	UFUNCTION(BlueprintCallable, Category = "RFSN|Director")
 	void StopPolling();
 
+	/** Is the push channel currently delivering commands? */
+	UFUNCTION(BlueprintPure, Category = "RFSN|Director")
+	bool IsChannelOpen() const { return bChannelOpen; }
+
+	/** Request bytes (URL and body) sent to the director since BeginPlay */
+	UFUNCTION(BlueprintPure, Category = "RFSN|Director")
+	int64 GetBytesSent() const { return BytesSent; }
+
 protected:
 	virtual void BeginPlay() override;
 	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 
 private:
 	FTimerHandle PollTimer;
+	FTimerHandle StateTimer;
+	FTimerHandle ReconnectTimer;
 
 	UPROPERTY()
 	TObjectPtr<UIslandDirectorSubsystem> DirectorSubsystem;
 
+	/** StartPolling was called and StopPolling wasn't */
+	bool bActive = false;
+
+	bool bChannelOpen = false;
+	FString ChannelSession;
+	int32 LastCommandId = 0;
+
+	/** Game state as last sent over the channel */
+	TSharedPtr<FJsonObject> SentState;
+
+	/** Outstanding long-poll, so stale completions can be told apart */
+	TSharedPtr<IHttpRequest, ESPMode::ThreadSafe> CommandRequest;
+
+	int64 BytesSent = 0;
+
 	void OnPollTick();
 	void OnDirectorResponse(FHttpRequestPtr Request, FHttpResponsePtr Response, bool bSuccess);
 
+	TSharedPtr<FJsonObject> BuildGameState() const;
+	void ApplyDirectorCommand(const FJsonObject& Command);
+	TSharedRef<IHttpRequest, ESPMode::ThreadSafe> CreateRequest(const FString& Url, const FString& Verb,
+	                                                             const TSharedPtr<FJsonObject>& Body);
+
+	void StartTimerPolling();
+	void OpenChannel();
+	void OnChannelOpened(FHttpRequestPtr Request, FHttpResponsePtr Response, bool bSuccess);
+	void SendStateDelta();
+	void OnStateSent(FHttpRequestPtr Request, FHttpResponsePtr Response, bool bSuccess);
+	void RequestCommands();
+	void OnCommandsReceived(FHttpRequestPtr Request, FHttpResponsePtr Response, bool bSuccess);
+	void CloseChannel();
+
+	/** Fall back to polling and schedule a reconnect */
+	void OnChannelDropped();
+
 	/** Map NPC actions to alert level modifications */
 	float GetAlertModifierForAction(ERfsnNpcAction Action) const;
 };
@@ -80,8 +80,8 @@ struct FRfsnPriceModifier
 	UPROPERTY(BlueprintReadWrite, Category = "Modifier")
 	float Duration = -1.0f;
 
-	/** Time remaining */
-	float TimeRemaining = 0.0f;
+	/** Expiry on the owning component's modifier clock (game hours), for timed modifiers */
+	double ExpiresAt = 0.0;
 };
 
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnPriceChanged, const FString&, ItemId, float, NewPrice);
@@ -89,7 +89,9 @@ DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnStockChanged, const FString&, It
 
 /**
  * Dynamic Pricing Component
- * Manages merchant prices with reputation and supply/demand
+ * Manages merchant prices with reputation and supply/demand.
+ * Item lookups go through an FName index and prices are memoized per item until the stock, base price or
+ * modifiers change. Call RefreshInventory after editing Inventory or LowStockPriceIncrease directly.
  */
 UCLASS(ClassGroup = (Custom), meta = (BlueprintSpawnableComponent))
 class MYPROJECT_API URfsnDynamicPricing : public UActorComponent
@@ -202,6 +204,10 @@ public:
 	UFUNCTION(BlueprintPure, Category = "Pricing")
 	bool HasStock(const FString& ItemId, int32 Quantity = 1) const;
 
+	/** Final prices for every inventory item, in inventory order (one reputation lookup for the whole shop) */
+	UFUNCTION(BlueprintPure, Category = "Pricing")
+	TArray<float> GetAllPrices() const;
+
 	/** Get price context for LLM (e.g., "Prices are high today") */
 	UFUNCTION(BlueprintPure, Category = "Pricing")
 	FString GetPricingContext() const;
@@ -210,14 +216,83 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Pricing")
 	void TickModifiers(float GameHoursElapsed);
 
+	/** Rebuild the item index and price cache after Inventory was edited directly */
+	UFUNCTION(BlueprintCallable, Category = "Pricing")
+	void RefreshInventory();
+
 protected:
 	virtual void BeginPlay() override;
 
 private:
+	/** Memoized price factors for one inventory slot; valid while stock, base price and modifiers match */
+	struct FCachedPrice
+	{
+		float BasePrice = 0.0f;
+		int32 Stock = INDEX_NONE;
+		uint32 ModifierVersion = 0;
+		float StockModifier = 1.0f;
+		float ModifierMultiplier = 1.0f;
+	};
+
+	/** Modifier naming both an item and a category (applies once if either matches) */
+	struct FDualModifier
+	{
+		FName ItemId;
+		FName Category;
+		float Multiplier = 1.0f;
+	};
+
+	struct FModifierExpiry
+	{
+		double ExpiresAt = 0.0;
+		FString Name;
+
+		bool operator<(const FModifierExpiry& Other) const { return ExpiresAt < Other.ExpiresAt; }
+	};
+
+	// Inventory index: interned IDs per slot and the first slot for each item ID
+	mutable TMap<FName, int32> ItemIndex;
+	mutable TArray<FName> ItemNames;
+	mutable TArray<FName> ItemCategories;
+	mutable TArray<FCachedPrice> PriceCache;
+	mutable int32 IndexedCount = INDEX_NONE;
+	mutable int32 LowStockCount = 0;
+
+	// Modifier index, rebuilt whenever ActiveModifiers changes
+	float GlobalModifier = 1.0f;
+	TMap<FName, float> CategoryModifiers;
+	TMap<FName, float> ItemModifiers;
+	TArray<FDualModifier> DualModifiers;
+	uint32 ModifierVersion = 1;
+
+	/** First modifier worth mentioning in GetPricingContext */
+	int32 ContextModifier = INDEX_NONE;
+
+	/** Timed modifiers ordered by expiry (min-heap; entries for removed modifiers are skipped) */
+	TArray<FModifierExpiry> ModifierExpiries;
+
+	/** Game hours passed to TickModifiers so far */
+	double ModifierClock = 0.0;
+
 	/** Find item in inventory */
 	FRfsnItemPrice* FindItem(const FString& ItemId);
 	const FRfsnItemPrice* FindItem(const FString& ItemId) const;
+	int32 FindItemIndex(const FString& ItemId) const;
+
+	void RebuildInventoryIndex() const;
+	void RebuildModifierIndex();
+
+	/** Cached factors for an inventory slot, recomputed if stale */
+	const FCachedPrice& GetCachedPrice(int32 Index) const;
+
+	/** Final price of an inventory slot */
+	float CalculatePrice(int32 Index, float ReputationModifier) const;
+
+	float CalculateStockModifier(const FRfsnItemPrice& Item) const;
 
 	/** Get all applicable modifiers for an item */
-	float CalculateModifierMultiplier(const FString& ItemId, const FString& Category) const;
+	float CalculateModifierMultiplier(FName ItemId, FName Category) const;
+
+	/** Change stock through here so the low-stock count stays current */
+	void SetStock(int32 Index, int32 NewStock);
 };
@@ -37,11 +37,54 @@ struct FRfsnFaction
 	TArray<FString> Enemies;
 };
 
+/**
+ * Square bit matrix over compact faction indices; row A holds the factions A is related to.
+ * Rows are packed into 64-bit words so closure and row operations work a word at a time.
+ */
+struct MYPROJECT_API FRfsnFactionRelationMatrix
+{
+	/** Clear to Num x Num with no relations */
+	void Init(int32 InNum);
+
+	int32 Num() const { return NumFactions; }
+
+	void Set(int32 A, int32 B) { Words[A * WordsPerRow + (B >> 6)] |= uint64(1) << (B & 63); }
+
+	bool Test(int32 A, int32 B) const
+	{
+		return ((Words[A * WordsPerRow + (B >> 6)] >> (B & 63)) & 1) != 0;
+	}
+
+	/** Replace the matrix with its transitive closure (Warshall, row-wise) */
+	void Close();
+
+	/** Call Func(B) for every B related to A, in index order */
+	template <typename FuncType>
+	void ForEachInRow(int32 A, FuncType&& Func) const
+	{
+		for (int32 Word = 0; Word < WordsPerRow; Word++)
+		{
+			for (uint64 Bits = Words[A * WordsPerRow + Word]; Bits != 0; Bits &= Bits - 1)
+			{
+				Func(Word * 64 + static_cast<int32>(FMath::CountTrailingZeros64(Bits)));
+			}
+		}
+	}
+
+private:
+	int32 NumFactions = 0;
+	int32 WordsPerRow = 0;
+	TArray<uint64> Words;
+};
+
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnFactionReputationChanged, const FString&, FactionId, float,
                                              NewReputation);
 
 /**
  * Game Instance Subsystem for managing factions and group reputation.
+ * Factions get compact indices on registration. Reputation lives in a flat array, and ally/enemy
+ * relations plus the ally-of-ally closure are bit matrices rebuilt whenever a faction is registered.
+ * The string API resolves IDs to indices and forwards to the indexed queries.
  */
 UCLASS()
 class MYPROJECT_API URfsnFactionSystem : public UGameInstanceSubsystem
@@ -110,14 +153,66 @@ public:
 	UFUNCTION(BlueprintPure, Category = "Faction")
 	bool AreFactionsHostile(const FString& FactionA, const FString& FactionB) const;
 
+	/** Check if FactionB can be reached from FactionA through ally links (an ally of an ally, ...) */
+	UFUNCTION(BlueprintPure, Category = "Faction")
+	bool AreFactionsIndirectlyAllied(const FString& FactionA, const FString& FactionB) const;
+
 	/** Get effective NPC affinity based on faction reputation */
 	UFUNCTION(BlueprintPure, Category = "Faction")
 	float GetNpcAffinityFromFaction(const FString& FactionId) const;
 
+	// ─────────────────────────────────────────────────────────────
+	// Indexed API (resolve IDs once, then query without string work)
+	// ─────────────────────────────────────────────────────────────
+
+	/** Compact index of a faction, or INDEX_NONE */
+	int32 GetFactionIndex(const FString& FactionId) const;
+	int32 GetFactionIndex(FName FactionId) const;
+
+	int32 GetNumFactions() const { return Factions.Num(); }
+
+	float GetReputationByIndex(int32 Faction) const
+	{
+		return Reputations.IsValidIndex(Faction) ? Reputations[Faction] : 0.0f;
+	}
+
+	bool AreAllied(int32 FactionA, int32 FactionB) const
+	{
+		return IsValidPair(FactionA, FactionB) && Allies.Test(FactionA, FactionB);
+	}
+
+	bool AreHostile(int32 FactionA, int32 FactionB) const
+	{
+		return IsValidPair(FactionA, FactionB) && Enemies.Test(FactionA, FactionB);
+	}
+
+	bool AreIndirectlyAllied(int32 FactionA, int32 FactionB) const
+	{
+		return IsValidPair(FactionA, FactionB) && AllyClosure.Test(FactionA, FactionB);
+	}
+
 protected:
+	/** Registered factions by index. Reputation is kept in Reputations; the struct copy is filled on read. */
 	UPROPERTY()
-	TMap<FString, FRfsnFaction> Factions;
+	TArray<FRfsnFaction> Factions;
 
 private:
+	TMap<FName, int32> FactionIndices;
+	TArray<float> Reputations;
+
+	FRfsnFactionRelationMatrix Allies;
+	FRfsnFactionRelationMatrix Enemies;
+	FRfsnFactionRelationMatrix AllyClosure;
+
+	bool IsValidPair(int32 FactionA, int32 FactionB) const
+	{
+		return Factions.IsValidIndex(FactionA) && Factions.IsValidIndex(FactionB);
+	}
+
+	/** Resolve every faction's Allies/Enemies lists into the matrices and recompute the closure */
+	void RebuildRelations();
+
+	void SetReputationByIndex(int32 Faction, float Value);
+
 	void CreateDefaultFactions();
 };
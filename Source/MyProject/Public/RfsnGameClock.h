@@ -0,0 +1,178 @@
+// RFSN Game Clock
+// Shared day/hour game time and a hierarchical timing wheel for game-time callbacks
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "RfsnGameClock.generated.h"
+
+/**
+ * Hierarchical timing wheel keyed on whole ticks (the game clock uses one tick per game minute).
+ * Five levels of 64 slots: timers land in the coarsest level that still resolves them and
+ * cascade down as their slot comes round, so adding, cancelling and advancing are O(1) per timer
+ * regardless of how many are pending or how far out they are.
+ */
+struct MYPROJECT_API FRfsnTimingWheel
+{
+	static constexpr int32 SlotBits = 6;
+	static constexpr int32 NumSlots = 1 << SlotBits;
+	static constexpr int32 NumLevels = 5;
+
+	/** Furthest a timer may be scheduled ahead (about 2000 game years at a tick per minute) */
+	static constexpr uint64 MaxDelta = (uint64(1) << (SlotBits * NumLevels)) - 1;
+
+	uint64 GetCurrentTick() const { return CurrentTick; }
+	int32 Num() const { return Timers.Num(); }
+	bool IsValid(int32 Handle) const { return Timers.IsValidIndex(Handle); }
+	uint64 GetDueTick(int32 Handle) const { return Timers.IsValidIndex(Handle) ? Timers[Handle].DueTick : 0; }
+
+	/** Schedule a timer. Due ticks at or before the current tick expire on the next Advance. */
+	int32 Add(uint64 DueTick);
+
+	/** Cancel a pending timer (no-op for expired or invalid handles) */
+	void Remove(int32 Handle);
+
+	/** Step to ToTick, appending expired handles in due order. Expired handles are released. */
+	void Advance(uint64 ToTick, TArray<int32>& OutExpired);
+
+	/** Move the wheel to an earlier tick, keeping every pending timer's due tick */
+	void Rewind(uint64 ToTick);
+
+	/** Drop every timer */
+	void Reset(uint64 Tick = 0);
+
+private:
+	struct FTimer
+	{
+		uint64 DueTick = 0;
+		int8 Level = INDEX_NONE;
+		uint8 Slot = 0;
+	};
+
+	TSparseArray<FTimer> Timers;
+	TArray<int32> Slots[NumLevels][NumSlots];
+
+	/** Timers added at or before the current tick */
+	TArray<int32> Overdue;
+
+	uint64 CurrentTick = 0;
+
+	void Insert(int32 Handle);
+	void Cascade(int32 Level);
+};
+
+/** Fired when a game-time timer comes due */
+DECLARE_DELEGATE(FRfsnGameClockCallback);
+
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnRfsnGameDayChanged, int32, Day);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE(FOnRfsnGameTimeJumped);
+
+/**
+ * World Subsystem that owns game time (days and hours) for every RFSN system.
+ * Components schedule callbacks at game times instead of ticking to watch the clock;
+ * because timers are kept in game minutes, changing the time scale needs no rescheduling.
+ */
+UCLASS()
+class MYPROJECT_API URfsnGameClock : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	static constexpr int32 MinutesPerDay = 24 * 60;
+	static constexpr int32 DaysPerWeek = 7;
+
+	// ─────────────────────────────────────────────────────────────
+	// Configuration
+	// ─────────────────────────────────────────────────────────────
+
+	/** Real seconds per game hour (60 = one game day every 24 real minutes) */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "RFSN|Clock", meta = (ClampMin = "0.01"))
+	float SecondsPerGameHour = 60.0f;
+
+	/** Hour of day when the world starts */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "RFSN|Clock", meta = (ClampMin = "0", ClampMax = "24"))
+	float StartHour = 0.0f;
+
+	/** Day of week when the world starts (0 = Sunday) */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "RFSN|Clock", meta = (ClampMin = "0", ClampMax = "6"))
+	int32 StartDayOfWeek = 0;
+
+	// ─────────────────────────────────────────────────────────────
+	// Events
+	// ─────────────────────────────────────────────────────────────
+
+	/** Called at midnight with the new day number */
+	UPROPERTY(BlueprintAssignable, Category = "RFSN|Events")
+	FOnRfsnGameDayChanged OnDayChanged;
+
+	/** Called after SetGameTime moved the clock backwards (pending timers keep their game times) */
+	UPROPERTY(BlueprintAssignable, Category = "RFSN|Events")
+	FOnRfsnGameTimeJumped OnTimeJumped;
+
+	// ─────────────────────────────────────────────────────────────
+	// Time
+	// ─────────────────────────────────────────────────────────────
+
+	/** Game minutes since midnight of day 0 */
+	double GetGameMinutes() const { return GameMinutes; }
+
+	/** Hour of the current day (0-24) */
+	UFUNCTION(BlueprintPure, Category = "RFSN|Clock")
+	float GetGameHour() const;
+
+	/** Days elapsed since day 0 */
+	UFUNCTION(BlueprintPure, Category = "RFSN|Clock")
+	int32 GetDay() const;
+
+	/** 0 = Sunday ... 6 = Saturday */
+	UFUNCTION(BlueprintPure, Category = "RFSN|Clock")
+	int32 GetDayOfWeek() const;
+
+	/** Change how fast game time runs. Pending timers keep their game times. */
+	UFUNCTION(BlueprintCallable, Category = "RFSN|Clock")
+	void SetTimeScale(float InSecondsPerGameHour);
+
+	/** Jump to a day and hour. Forward jumps fire every timer passed; backward jumps broadcast OnTimeJumped. */
+	UFUNCTION(BlueprintCallable, Category = "RFSN|Clock")
+	void SetGameTime(int32 Day, float Hour);
+
+	UFUNCTION(BlueprintCallable, Category = "RFSN|Clock")
+	void SetPaused(bool bInPaused) { bPaused = bInPaused; }
+
+	UFUNCTION(BlueprintPure, Category = "RFSN|Clock")
+	bool IsPaused() const { return bPaused; }
+
+	// ─────────────────────────────────────────────────────────────
+	// Timers
+	// ─────────────────────────────────────────────────────────────
+
+	/** Call back once the clock reaches GameMinute (resolution is one game minute). Returns a handle. */
+	int32 ScheduleAt(double GameMinute, FRfsnGameClockCallback Callback);
+
+	void CancelTimer(int32 Handle);
+
+	UFUNCTION(BlueprintPure, Category = "RFSN|Clock")
+	int32 GetNumTimers() const { return Wheel.Num(); }
+
+	// UTickableWorldSubsystem
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+protected:
+	virtual void Deinitialize() override;
+
+private:
+	double GameMinutes = 0.0;
+	bool bPaused = false;
+	int32 DayTimer = INDEX_NONE;
+
+	FRfsnTimingWheel Wheel;
+	TMap<int32, FRfsnGameClockCallback> Callbacks;
+	TArray<int32> Expired;
+
+	void AdvanceTo(double NewGameMinutes);
+	void ScheduleDayTimer();
+	void HandleDayChanged();
+};
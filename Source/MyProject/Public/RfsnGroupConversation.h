@@ -6,6 +6,7 @@
 
 #include "CoreMinimal.h"
 #include "Components/ActorComponent.h"
+#include "Interfaces/IHttpRequest.h"
 #include "RfsnGroupConversation.generated.h"
 
 class URfsnNpcClientComponent;
@@ -41,6 +42,10 @@ struct FRfsnConversationParticipant
 	/** Turn count this conversation */
 	UPROPERTY(BlueprintReadWrite, Category = "Conversation")
 	int32 TurnCount = 0;
+
+	/** How readily this participant cuts in (0-1) */
+	UPROPERTY(BlueprintReadWrite, Category = "Conversation", meta = (ClampMin = "0.0", ClampMax = "1.0"))
+	float Interruptiveness = 0.2f;
 };
 
 /**
@@ -100,6 +105,152 @@ struct FRfsnConversationTopic
 	bool IsExhausted() const { return ExchangeCount >= 3; }
 };
 
+/** What the turn scheduler knows about one participant */
+struct FRfsnTurnCandidate
+{
+	FString Name;
+
+	/** Affinity toward the player (-1 to 1) */
+	float Affinity = 0.0f;
+
+	/** How readily they cut in (0-1) */
+	float Interruptiveness = 0.2f;
+
+	/** False while they can't take the floor */
+	bool bAvailable = true;
+
+	int32 TurnCount = 0;
+
+	/** Turn number of their last line, INDEX_NONE before their first */
+	int32 LastTurn = INDEX_NONE;
+};
+
+/** Running totals of a turn scheduler */
+struct FRfsnTurnStats
+{
+	int32 Turns = 0;
+	int32 Requests = 0;
+
+	/** Turns whose line was requested while the previous line was being voiced */
+	int32 PrefetchHits = 0;
+
+	/** Requests thrown away because the floor went to someone else or the conversation moved on */
+	int32 Discarded = 0;
+
+	/** Waits between the floor coming free and the next line starting */
+	int32 Gaps = 0;
+	double TotalGapSeconds = 0.0;
+	double MaxGapSeconds = 0.0;
+
+	double GetAverageGapSeconds() const { return Gaps > 0 ? TotalGapSeconds / Gaps : 0.0; }
+};
+
+/**
+ * Event-driven turn taking for a group conversation.
+ *
+ * The next speaker is the best score of: being named in the last line, affinity toward the player (weighted
+ * up right after the player speaks), how readily they cut in, and how many turns they have waited. While a
+ * line is being voiced, the line of the speaker predicted to follow is already requested, so the floor
+ * changes hands when the line ends rather than a round-trip later.
+ *
+ * Nothing polls: the owner supplies the backend and the voice through RequestLine and SpeakLine, and reports
+ * back through OnLineReady and Advance.
+ */
+struct MYPROJECT_API FRfsnTurnScheduler
+{
+	float AddressedWeight = 4.0f;
+	float RelationshipWeight = 1.0f;
+	float InterruptWeight = 1.0f;
+
+	/** Score per turn since a participant last spoke */
+	float WaitWeight = 0.5f;
+
+	/** Request the predicted next speaker's line while the current one is being voiced */
+	bool bPrefetch = true;
+
+	/** Ask the backend for a participant's line; answer through OnLineReady with the same request */
+	TFunction<void(int32 Speaker, int32 Request)> RequestLine;
+
+	/** Start voicing a line; call Advance once it is over */
+	TFunction<void(int32 Speaker, const FString& Line)> SpeakLine;
+
+	/** Seconds, for the gap statistics */
+	TFunction<double()> Clock = []() { return FPlatformTime::Seconds(); };
+
+	void AddCandidate(const FRfsnTurnCandidate& Candidate);
+	void RemoveCandidate(int32 Index);
+	FRfsnTurnCandidate& GetCandidate(int32 Index) { return Candidates[Index]; }
+	int32 NumCandidates() const { return Candidates.Num(); }
+
+	/** Forget candidates, requests and stats */
+	void Reset();
+
+	/** Drop the pending line and leave the floor empty until the next Advance; stats are kept */
+	void Stop();
+
+	/** The floor is free (the line ended or was cut short, or the conversation starts): pass it on */
+	void Advance();
+
+	/** A line came back; answers to requests that have since been replaced are ignored */
+	void OnLineReady(int32 Request, const FString& Line);
+
+	/** Someone outside the rotation (the player) spoke, naming Addressed or INDEX_NONE */
+	void OnInterjection(int32 Addressed);
+
+	/** Best participant to take the floor next, INDEX_NONE if nobody can */
+	int32 PickNext() const;
+	float Score(int32 Index) const;
+
+	/** Participant other than Speaker named earliest in Text (whole words, any case), or INDEX_NONE */
+	int32 FindAddressed(FStringView Text, int32 Speaker) const;
+
+	int32 GetCurrentSpeaker() const { return CurrentSpeaker; }
+	int32 GetPendingSpeaker() const { return Pending.Speaker; }
+	bool IsSpeaking() const { return bSpeaking; }
+	const FRfsnTurnStats& GetStats() const { return Stats; }
+
+private:
+	/** The line for the next turn, prefetched or asked for once the floor came free */
+	struct FPendingLine
+	{
+		int32 Request = 0;
+		int32 Speaker = INDEX_NONE;
+		FString Line;
+		bool bReady = false;
+		bool bPrefetched = false;
+	};
+
+	TArray<FRfsnTurnCandidate> Candidates;
+	FPendingLine Pending;
+	int32 CurrentSpeaker = INDEX_NONE;
+	int32 TurnNumber = 0;
+	int32 NextRequest = 1;
+
+	/** Named by the latest line, and whether the player has spoken since the last NPC line */
+	int32 Addressed = INDEX_NONE;
+	bool bAfterPlayer = false;
+
+	bool bSpeaking = false;
+
+	/** Clock() when the floor came free; negative while it is held or before the first Advance */
+	double FloorFreeSince = -1.0;
+
+	FRfsnTurnStats Stats;
+
+	void Request(int32 Speaker, bool bPrefetched);
+	void Prefetch();
+	void Discard();
+	void Speak();
+};
+
+/** Lines of one speaker that have left a group conversation's history window */
+struct FRfsnGroupSpeakerSummary
+{
+	FString Name;
+	int32 Lines = 0;
+	FString LastLine;
+};
+
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnGroupDialogue, const FString&, SpeakerId, const FString&, Text);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnParticipantJoined, const FString&, NpcId);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnParticipantLeft, const FString&, NpcId);
@@ -108,6 +259,9 @@ DECLARE_DYNAMIC_MULTICAST_DELEGATE(FOnConversationEnded);
 /**
  * Group Conversation Component
  * Manages multi-NPC dialogue sessions
+ * Turns are event-driven (FRfsnTurnScheduler): each NPC line is requested from that NPC's orchestrator
+ * endpoint, usually while the previous line is still being voiced, and the component only wakes up when a
+ * line arrives or finishes.
  */
 UCLASS(ClassGroup = (Custom), meta = (BlueprintSpawnableComponent))
 class MYPROJECT_API URfsnGroupConversation : public UActorComponent
@@ -125,10 +279,38 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Conversation|Config")
 	int32 MaxParticipants = 4;
 
-	/** Time between NPC turns (seconds) */
+	/** Minimum time an NPC line holds the floor (seconds) */
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Conversation|Config")
 	float TurnDelay = 3.0f;
 
+	/** Speaking time per character, for lines longer than TurnDelay */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Conversation|Config")
+	float SecondsPerCharacter = 0.065f;
+
+	/** Pause after a line before the next speaker starts (seconds) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Conversation|Config")
+	float TurnGap = 0.25f;
+
+	/** Request the next speaker's line while the current one is being voiced */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Conversation|Config")
+	bool bPrefetchLines = true;
+
+	/**
+	 * Ask each NPC's orchestrator for its lines; placeholder lines otherwise. Off by default: the orchestrator
+	 * has no group endpoint, so the request goes through the dialogue endpoint, which stores the group prompt
+	 * in the NPC's memory as a player turn and synthesizes speech for the line.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Conversation|Config")
+	bool bRequestLinesFromServer = false;
+
+	/** Lines kept word for word in DialogueHistory; older ones are folded into the summary */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Conversation|Config", meta = (ClampMin = "1"))
+	int32 HistoryWindow = 8;
+
+	/** The conversation ends after this many lines */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Conversation|Config")
+	int32 MaxLines = 20;
+
 	/** Maximum conversation duration (seconds) */
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Conversation|Config")
 	float MaxDuration = 120.0f;
@@ -149,10 +331,14 @@ public:
 	UPROPERTY(BlueprintReadOnly, Category = "Conversation|State")
 	TArray<FRfsnConversationParticipant> Participants;
 
-	/** Dialogue history */
+	/** Latest HistoryWindow lines, oldest first */
 	UPROPERTY(BlueprintReadOnly, Category = "Conversation|State")
 	TArray<FRfsnGroupDialogueLine> DialogueHistory;
 
+	/** Lines spoken this conversation, including those summarized out of DialogueHistory */
+	UPROPERTY(BlueprintReadOnly, Category = "Conversation|State")
+	int32 TotalLines = 0;
+
 	/** Current topic */
 	UPROPERTY(BlueprintReadOnly, Category = "Conversation|State")
 	FString CurrentTopic;
@@ -165,7 +351,7 @@ public:
 	UPROPERTY(BlueprintReadOnly, Category = "Conversation|State")
 	bool bPlayerParticipating = false;
 
-	/** Current speaker index */
+	/** Index into Participants of the latest speaker; INDEX_NONE once they have left */
 	UPROPERTY(BlueprintReadOnly, Category = "Conversation|State")
 	int32 CurrentSpeakerIndex = 0;
 
@@ -221,7 +407,7 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Conversation")
 	void PlayerSpeak(const FString& Text);
 
-	/** Trigger next NPC to speak */
+	/** Cut the current line short and pass the floor on */
 	UFUNCTION(BlueprintCallable, Category = "Conversation")
 	void TriggerNextSpeaker();
 
@@ -233,6 +419,10 @@ public:
 	UFUNCTION(BlueprintPure, Category = "Conversation")
 	FString GetRecentDialogue(int32 LineCount = 5) const;
 
+	/** Who said how much before the history window, with each speaker's latest line */
+	UFUNCTION(BlueprintPure, Category = "Conversation")
+	FString GetHistorySummary() const;
+
 	/** Get participant names as string */
 	UFUNCTION(BlueprintPure, Category = "Conversation")
 	FString GetParticipantNames() const;
@@ -241,25 +431,42 @@ public:
 	UFUNCTION(BlueprintPure, Category = "Conversation")
 	bool IsParticipating(const FString& NpcId) const;
 
+	/** Turns, prefetch hits and gaps of the current (or last) conversation */
+	const FRfsnTurnStats& GetTurnStats() const { return Scheduler.GetStats(); }
+
 protected:
 	virtual void BeginPlay() override;
-	virtual void TickComponent(float DeltaTime, ELevelTick TickType,
-	                           FActorComponentTickFunction* ThisTickFunction) override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 
 private:
-	/** Turn timer */
-	float TurnTimer = 0.0f;
+	FRfsnTurnScheduler Scheduler;
+	TArray<FRfsnGroupSpeakerSummary> SpeakerSummaries;
+
+	FTimerHandle LineTimer;
+	FTimerHandle DurationTimer;
+	TSharedPtr<IHttpRequest, ESPMode::ThreadSafe> LineRequest;
 
 	/** Find NPC component by ID */
 	URfsnNpcClientComponent* FindNpcComponent(const FString& NpcId) const;
 
-	/** Select next speaker */
-	int32 SelectNextSpeaker() const;
+	void AddParticipantComponent(const FString& NpcId, URfsnNpcClientComponent* NpcComp);
+
+	/** Scheduler callbacks */
+	void RequestLine(int32 SpeakerIndex, int32 Request);
+	void SpeakLine(int32 SpeakerIndex, const FString& Line);
+
+	/** The current line has been voiced */
+	void FinishLine();
+
+	/** Copy participants' current affinity into the scheduler */
+	void RefreshCandidates();
+
+	/** Prompt asking a participant for their next line */
+	FString BuildLinePrompt(int32 SpeakerIndex) const;
 
-	/** Generate NPC response */
-	void GenerateNpcResponse(int32 SpeakerIndex);
+	void StopTurns();
 
-	/** Add line to history */
+	/** Add line to history, folding lines past the window into the summary */
 	void AddDialogueLine(const FString& SpeakerId, const FString& Name, const FString& Text, bool bIsPlayer = false);
 
 	/** Check for conversation end conditions */
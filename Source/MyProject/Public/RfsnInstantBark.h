@@ -12,6 +12,7 @@
 
 class URfsnNpcClientComponent;
 class URfsnVoiceRouter;
+class FRfsnInstantBarkSet;
 
 /**
  * Bark category - maps to NPC actions
@@ -132,7 +133,7 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "InstantBark|Audio", meta = (ClampMin = "0", ClampMax = "2"))
 	float VolumeMultiplier = 1.0f;
 
-	/** NPC-specific bark library */
+	/** NPC-specific bark library (leave empty to share the default library) */
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "InstantBark|Barks")
 	FRfsnBarkLibrary BarkLibrary;
 
@@ -172,6 +173,9 @@ public:
 	UFUNCTION(BlueprintPure, Category = "InstantBark")
 	TArray<FRfsnInstantBarkEntry> GetBarksForCategory(ERfsnBarkCategory Category) const;
 
+	/** Get barks for category without copying (C++ only) */
+	const TArray<FRfsnInstantBarkEntry>& GetBarkBucket(ERfsnBarkCategory Category) const;
+
 	/** Stop current bark */
 	UFUNCTION(BlueprintCallable, Category = "InstantBark")
 	void StopBark();
@@ -184,10 +188,14 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "InstantBark")
 	void BindToRfsnClient(URfsnNpcClientComponent* Client);
 
-	/** Setup default barks */
+	/** Copy the default barks into BarkLibrary for editing */
 	UFUNCTION(BlueprintCallable, Category = "InstantBark")
 	void SetupDefaultBarks();
 
+	/** Re-acquire the shared library after BarkLibrary was edited at runtime */
+	UFUNCTION(BlueprintCallable, Category = "InstantBark")
+	void RefreshBarkLibrary();
+
 protected:
 	virtual void BeginPlay() override;
 	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
@@ -197,8 +205,11 @@ private:
 	UPROPERTY()
 	UAudioComponent* AudioComponent = nullptr;
 
-	/** Current bark index per category (round-robin) */
-	TMap<ERfsnBarkCategory, int32> BarkIndices;
+	/** Shared immutable bark content for this archetype */
+	TSharedPtr<const FRfsnInstantBarkSet, ESPMode::ThreadSafe> SharedBarks;
+
+	/** Round-robin cursor per category */
+	int32 BarkCursors[static_cast<int32>(ERfsnBarkCategory::Grateful) + 1] = {};
 
 	/** Timer handle for bark completion */
 	FTimerHandle BarkCompletionTimer;
@@ -211,7 +222,7 @@ private:
 	void OnRfsnMetaReceived(const struct FRfsnDialogueMeta& Meta);
 
 	/** Get next bark for category (round-robin) */
-	FRfsnInstantBarkEntry GetNextBark(ERfsnBarkCategory Category);
+	const FRfsnInstantBarkEntry& GetNextBark(ERfsnBarkCategory Category);
 
 	/** Handle audio completion */
 	void OnAudioFinished();
@@ -6,6 +6,7 @@
 
 #include "CoreMinimal.h"
 #include "Components/ActorComponent.h"
+#include "RfsnLipSyncAnalysis.h"
 #include "RfsnLipSync.generated.h"
 
 class UAudioComponent;
@@ -139,6 +140,10 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "LipSync|Config", meta = (ClampMin = "1", ClampMax = "30"))
 	float VisemeChangeSpeed = 12.0f;
 
+	/** Morph targets are only written when their weight changes by more than this */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "LipSync|Config", meta = (ClampMin = "0", ClampMax = "0.1"))
+	float MorphUpdateEpsilon = 0.01f;
+
 	// ─────────────────────────────────────────────────────────────
 	// State
 	// ─────────────────────────────────────────────────────────────
@@ -191,6 +196,14 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "LipSync")
 	void SetupDefaultMappings();
 
+	/** Rebuild morph channels after editing VisemeMappings or morph names at runtime */
+	UFUNCTION(BlueprintCallable, Category = "LipSync")
+	void RefreshMorphTargets();
+
+	/** Morph target writes per second over the last second */
+	UFUNCTION(BlueprintPure, Category = "LipSync")
+	float GetMorphUpdatesPerSecond() const { return MorphUpdatesPerSecond; }
+
 protected:
 	virtual void BeginPlay() override;
 	virtual void TickComponent(float DeltaTime, ELevelTick TickType,
@@ -205,12 +218,36 @@ private:
 	UPROPERTY()
 	URfsnTtsAudioComponent* TtsComponent;
 
+	static constexpr int32 NumVisemes = static_cast<int32>(ERfsnViseme::WQ) + 1;
+
 	/** Previous viseme weights for blending */
-	TMap<ERfsnViseme, float> VisemeWeights;
+	float VisemeWeights[NumVisemes] = {};
+
+	/** Morph writes, applied in one pass per tick when changed */
+	FRfsnMorphTargetBatch MorphBatch;
+
+	/** Batch channel per mapping (parallel to VisemeMappings) */
+	TArray<int32> MappingChannels;
+
+	int32 JawChannel = INDEX_NONE;
+	int32 MouthOpenChannel = INDEX_NONE;
+	int32 SimpleAAChannel = INDEX_NONE;
+
+	/** Morph update rate tracking */
+	int32 MorphUpdatesThisWindow = 0;
+	float MorphWindowTime = 0.0f;
+	float MorphUpdatesPerSecond = 0.0f;
+
+	/** Viseme sampled from the TTS clip's analysis track this tick */
+	ERfsnViseme TrackViseme = ERfsnViseme::Silence;
+	bool bHasTrackSample = false;
 
 	/** Update amplitude from audio */
 	void UpdateAmplitude();
 
+	/** Sample the analyzed TTS clip; false when none is playing or its analysis is not ready */
+	bool SampleTtsTrack();
+
 	/** Generate pseudo-viseme from amplitude pattern */
 	ERfsnViseme GeneratePseudoViseme() const;
 
@@ -0,0 +1,112 @@
+// RFSN Lip Sync Analysis
+// Offline PCM analysis into an amplitude envelope and coarse viseme track,
+// plus change-gated morph target batching for URfsnLipSync
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+enum class ERfsnViseme : uint8;
+
+/**
+ * Per-clip lip sync track, built once per TTS clip and sampled by playback time.
+ * Immutable after analysis, so it can be shared between the worker and game thread.
+ */
+struct MYPROJECT_API FRfsnLipSyncTrack
+{
+	/** Analysis frames per second */
+	float FrameRate = 100.0f;
+
+	/** Clip length in seconds */
+	float Duration = 0.0f;
+
+	/** Normalized, attack/release smoothed amplitude per frame (0-1) */
+	TArray<float> Envelope;
+
+	/** Coarse viseme per frame */
+	TArray<ERfsnViseme> Visemes;
+
+	int32 NumFrames() const { return Envelope.Num(); }
+
+	/** Sample envelope (interpolated) and viseme (nearest frame) at a playback time */
+	void Sample(float Time, float& OutAmplitude, ERfsnViseme& OutViseme) const;
+};
+
+/**
+ * PCM analysis for lip sync.
+ * Per 10ms frame: RMS energy and zero-crossing rate. Silence, fricatives and vowel groups
+ * are classified from those, short gaps between sounds become closures, and each viseme
+ * is held for a minimum duration to avoid flicker.
+ */
+class MYPROJECT_API FRfsnLipSyncAnalyzer
+{
+public:
+	/** Analyze 16-bit signed mono PCM (safe to call from any thread) */
+	static FRfsnLipSyncTrack Analyze(const int16* Samples, int32 NumSamples, int32 SampleRate);
+
+	/** Analyze raw little-endian PCM bytes as delivered to URfsnTtsAudioComponent */
+	static FRfsnLipSyncTrack AnalyzeBytes(const TArray<uint8>& PCMData, int32 SampleRate);
+
+	/** Frames quieter than this (after normalization) are silence */
+	static constexpr float SilenceThreshold = 0.08f;
+
+	/** Minimum frames a viseme is held before switching */
+	static constexpr int32 MinHoldFrames = 3;
+};
+
+/**
+ * Morph target weights applied in one pass, skipping channels that moved less than an epsilon.
+ * Channels are deduplicated by name so several sources (jaw, simple mode, visemes)
+ * can write the same morph without fighting.
+ */
+struct MYPROJECT_API FRfsnMorphTargetBatch
+{
+	/** Drop all channels */
+	void Reset();
+
+	/** Add (or find) a channel for a morph target */
+	int32 AddChannel(FName MorphTarget);
+
+	int32 Num() const { return Names.Num(); }
+
+	/** Zero every pending weight (start of a frame) */
+	void ClearTargets();
+
+	/** Set a pending weight; multiple writers keep the largest */
+	void MaxTarget(int32 Channel, float Weight)
+	{
+		if (Pending.IsValidIndex(Channel))
+		{
+			Pending[Channel] = FMath::Max(Pending[Channel], Weight);
+		}
+	}
+
+	/** Force every channel to be re-applied on the next flush */
+	void Invalidate();
+
+	/**
+	 * Apply pending weights that changed by more than Epsilon since they were last applied.
+	 * Weights below Epsilon snap to zero. Returns the number of morph targets written.
+	 */
+	template <typename ApplyFunc>
+	int32 Flush(float Epsilon, ApplyFunc&& Apply)
+	{
+		int32 Updates = 0;
+		for (int32 i = 0; i < Names.Num(); i++)
+		{
+			const float Weight = Pending[i] < Epsilon ? 0.0f : Pending[i];
+			if (FMath::Abs(Weight - Applied[i]) > Epsilon || (Weight == 0.0f && Applied[i] != 0.0f))
+			{
+				Apply(Names[i], Weight);
+				Applied[i] = Weight;
+				Updates++;
+			}
+		}
+		return Updates;
+	}
+
+private:
+	TArray<FName> Names;
+	TArray<float> Pending;
+	TArray<float> Applied;
+};
@@ -0,0 +1,341 @@
+// RFSN Load Test
+// Headless crowd load test for the RFSN client stack against the local mock orchestrator or a recorded session
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "RfsnNpcClientComponent.h"
+#include "RfsnLoadTest.generated.h"
+
+class UIslandDirectorSubsystem;
+class URfsnDirectorBridge;
+class URfsnLoadTest;
+
+USTRUCT(BlueprintType)
+struct FRfsnLoadTestReport
+{
+	GENERATED_BODY()
+
+	UPROPERTY(BlueprintReadOnly, Category = "Stats")
+	int32 NpcCount = 0;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Stats")
+	float DurationSeconds = 0.0f;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Stats")
+	int32 Frames = 0;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Stats")
+	float FrameMsP50 = 0.0f;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Stats")
+	float FrameMsP95 = 0.0f;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Stats")
+	float FrameMsP99 = 0.0f;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Stats")
+	float FrameMsMax = 0.0f;
+
+	/** Utterances sent / streams completed / streams that errored */
+	UPROPERTY(BlueprintReadOnly, Category = "Stats")
+	int32 Turns = 0;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Stats")
+	int32 Completed = 0;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Stats")
+	int32 Errors = 0;
+
+	/** Utterance sent -> first sentence event */
+	UPROPERTY(BlueprintReadOnly, Category = "Stats")
+	float FirstTokenMsP50 = 0.0f;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Stats")
+	float FirstTokenMsP95 = 0.0f;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Stats")
+	float FirstTokenMsP99 = 0.0f;
+
+	/** Utterance sent -> stream complete */
+	UPROPERTY(BlueprintReadOnly, Category = "Stats")
+	float TurnMsP50 = 0.0f;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Stats")
+	float TurnMsP95 = 0.0f;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Stats")
+	float TurnMsP99 = 0.0f;
+
+	/** Health requests issued through URfsnHttpPool */
+	UPROPERTY(BlueprintReadOnly, Category = "Stats")
+	float PoolMsP50 = 0.0f;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Stats")
+	float PoolMsP95 = 0.0f;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Stats")
+	int32 PoolErrors = 0;
+
+	/** Resident memory growth over the run, and the process peak */
+	UPROPERTY(BlueprintReadOnly, Category = "Stats")
+	float MemoryDeltaMb = 0.0f;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Stats")
+	float PeakMemoryMb = 0.0f;
+
+	/** Session file replayed; empty for runs against the orchestrator */
+	UPROPERTY(BlueprintReadOnly, Category = "Stats")
+	FString Session;
+
+	/** Session playbacks finished, and those whose parsed output differed from the recording */
+	UPROPERTY(BlueprintReadOnly, Category = "Stats")
+	int32 Playbacks = 0;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Stats")
+	int32 ReplayMismatches = 0;
+
+	/** Director runs: request bytes (URL and body) per minute with the push channel and with polling */
+	UPROPERTY(BlueprintReadOnly, Category = "Stats")
+	float DirectorChannelBytesPerMin = 0.0f;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Stats")
+	float DirectorPollBytesPerMin = 0.0f;
+
+	/** Director runs: ms from the director going Overwhelmed to its respite command arriving (-1 = never arrived) */
+	UPROPERTY(BlueprintReadOnly, Category = "Stats")
+	float DirectorChannelLatencyMs = 0.0f;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Stats")
+	float DirectorPollLatencyMs = 0.0f;
+
+	/** Frame p95 and memory growth stayed within the load test's budgets; for director runs, the channel's respite
+	 *  arrived within its latency budget, sooner than polling's, and the channel sent fewer bytes per minute */
+	UPROPERTY(BlueprintReadOnly, Category = "Stats")
+	bool bWithinBudget = true;
+};
+
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnRfsnLoadTestComplete, const FRfsnLoadTestReport&, Report);
+
+/**
+ * Per-NPC listener for the client component's dynamic delegates.
+ */
+UCLASS()
+class MYPROJECT_API URfsnLoadTestProbe : public UObject
+{
+	GENERATED_BODY()
+
+public:
+	TWeakObjectPtr<URfsnLoadTest> Owner;
+	TWeakObjectPtr<URfsnNpcClientComponent> Client;
+
+	double SendTime = 0.0;
+	double NextSendTime = 0.0;
+	bool bInFlight = false;
+	bool bGotFirstToken = false;
+
+	/** Replay run: the client plays a session rather than being sent utterances */
+	bool bReplay = false;
+	int32 Playbacks = 0;
+
+	/** Take up the dialogue a played session has started, if it is a new one */
+	void SyncReplayTurn();
+
+	UFUNCTION()
+	void HandleSentence(const FRfsnSentence& Sentence);
+
+	UFUNCTION()
+	void HandleComplete();
+
+	UFUNCTION()
+	void HandleError(const FString& ErrorMessage);
+};
+
+/**
+ * World Subsystem that spawns a crowd of NPCs carrying the full RFSN component set,
+ * drives dialogue turns against the orchestrator (normally RFSN_NPC_AI/Python/mock_server.py)
+ * and reports frame-time, latency and memory percentiles.
+ *
+ * Headless:  UnrealEditor-Cmd MyProject -game -nullrhi -unattended -RfsnLoadTestExit -ExecCmds="RfsnLoadTest 100 60"
+ * The report is logged and written to Saved/Profiling/RfsnLoadTest.json.
+ *
+ * Replay runs need no orchestrator: every NPC loops a session recorded with bRecordSession (RfsnRecord), so the
+ * same traffic is parsed run after run and frame-time or memory regressions show up deterministically:
+ *   -ExecCmds="RfsnReplayTest Saved/Profiling/RfsnSessions/npc_001.rfsnsession 100 60 1"
+ * Source/MyProject/Private/Tests/Fixtures/StreamReplay.rfsnsession is a small checked-in session the
+ * Rfsn.StreamReplay automation tests replay against these budgets.
+ * Director runs drive one URfsnDirectorBridge against the director endpoints, first over the push channel and then
+ * polling, and compare command latency and bytes per minute: -ExecCmds="RfsnDirectorTest 60"
+ * With -RfsnLoadTestExit the process exits with status 1 when a budget is exceeded or a playback mismatches its
+ * recording; -RfsnFrameBudgetMs= and -RfsnMemoryBudgetMb= override the budgets.
+ */
+UCLASS()
+class MYPROJECT_API URfsnLoadTest : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	URfsnLoadTest();
+
+	// ─────────────────────────────────────────────────────────────
+	// Configuration
+	// ─────────────────────────────────────────────────────────────
+
+	/** Actor spawned per NPC (components below are added if it doesn't already have them) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "RFSN|LoadTest")
+	TSubclassOf<AActor> NpcClass;
+
+	/** Components every load-test NPC carries */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "RFSN|LoadTest")
+	TArray<TSubclassOf<UActorComponent>> ComponentClasses;
+
+	/** Orchestrator stream endpoint (empty = component default) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "RFSN|LoadTest")
+	FString OrchestratorUrl;
+
+	/** Seconds between turns for each NPC (first turns are staggered across this window) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "RFSN|LoadTest", meta = (ClampMin = "0.1"))
+	float UtteranceInterval = 5.0f;
+
+	/** NPCs are scattered over a square this wide around the world origin */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "RFSN|LoadTest", meta = (ClampMin = "0.0"))
+	float SpawnArea = 10000.0f;
+
+	/** Seconds between health requests issued through URfsnHttpPool */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "RFSN|LoadTest", meta = (ClampMin = "0.05"))
+	float PoolRequestInterval = 0.25f;
+
+	/** Frame-time p95 a run must stay under (0 = unchecked) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "RFSN|LoadTest", meta = (ClampMin = "0.0"))
+	float FrameMsBudgetP95 = 33.3f;
+
+	/** Resident memory growth a run must stay under (0 = unchecked) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "RFSN|LoadTest", meta = (ClampMin = "0.0"))
+	float MemoryBudgetMb = 64.0f;
+
+	/** Director runs: how soon the push channel must deliver the respite command (0 = unchecked) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "RFSN|LoadTest", meta = (ClampMin = "0.0"))
+	float DirectorLatencyBudgetMs = 1000.0f;
+
+	// ─────────────────────────────────────────────────────────────
+	// Events
+	// ─────────────────────────────────────────────────────────────
+
+	UPROPERTY(BlueprintAssignable, Category = "RFSN|Events")
+	FOnRfsnLoadTestComplete OnLoadTestComplete;
+
+	// ─────────────────────────────────────────────────────────────
+	// API
+	// ─────────────────────────────────────────────────────────────
+
+	/** Spawn NpcCount NPCs and run for DurationSeconds. Returns false if a run is already active. */
+	UFUNCTION(BlueprintCallable, Category = "RFSN|LoadTest")
+	bool StartLoadTest(int32 NpcCount, float DurationSeconds);
+
+	/**
+	 * Spawn NpcCount NPCs that each loop the session in SessionPath at Speed (0 = as fast as possible) for
+	 * DurationSeconds. Returns false if a run is active or the session can't be loaded.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "RFSN|LoadTest")
+	bool StartReplayTest(const FString& SessionPath, int32 NpcCount, float DurationSeconds, float Speed = 1.0f);
+
+	/**
+	 * Run a URfsnDirectorBridge against the director endpoints (normally mock_server.py) for DurationSeconds over the
+	 * push channel, then as long again polling. Midway through each, the director is pushed to Overwhelmed and the
+	 * wait for its respite command is timed. Returns false if a run is active or there is no director subsystem.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "RFSN|LoadTest")
+	bool StartDirectorTest(float DurationSeconds);
+
+	/** End the run early and report what was collected */
+	UFUNCTION(BlueprintCallable, Category = "RFSN|LoadTest")
+	void StopLoadTest();
+
+	UFUNCTION(BlueprintPure, Category = "RFSN|LoadTest")
+	bool IsRunning() const { return bRunning; }
+
+	UFUNCTION(BlueprintPure, Category = "RFSN|LoadTest")
+	FRfsnLoadTestReport GetLastReport() const { return LastReport; }
+
+	// Called by probes
+	void RecordFirstToken(double LatencyMs) { FirstTokenSamples.Add(static_cast<float>(LatencyMs)); }
+	void RecordTurn(double LatencyMs, bool bSuccess);
+	void RecordTurnStart() { Turns++; }
+
+	// UTickableWorldSubsystem
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+protected:
+	virtual void Deinitialize() override;
+
+private:
+	bool bRunning = false;
+	double StartTime = 0.0;
+	double EndTime = 0.0;
+	double NextPoolRequestTime = 0.0;
+	uint64 StartMemory = 0;
+	int32 Turns = 0;
+	int32 Completed = 0;
+	int32 Errors = 0;
+	int32 PoolErrors = 0;
+	int32 Playbacks = 0;
+	int32 ReplayMismatches = 0;
+
+	/** Session every NPC loops in a replay run */
+	TSharedPtr<const FRfsnStreamSession> ReplaySession;
+	FString ReplaySessionPath;
+	float ReplaySpeed = 1.0f;
+
+	UPROPERTY()
+	TArray<TObjectPtr<AActor>> SpawnedNpcs;
+
+	UPROPERTY()
+	TArray<TObjectPtr<URfsnLoadTestProbe>> Probes;
+
+	TArray<float> FrameSamples;
+	TArray<float> FirstTokenSamples;
+	TArray<float> TurnSamples;
+	TArray<float> PoolSamples;
+
+	/** Director run: the bridge under test, the phase it is in, and when the director was overwhelmed */
+	UPROPERTY()
+	TObjectPtr<URfsnDirectorBridge> DirectorBridge;
+
+	UPROPERTY()
+	TObjectPtr<UIslandDirectorSubsystem> Director;
+
+	bool bDirectorPolling = false;
+	bool bDirectorOverwhelmed = false;
+	float DirectorDuration = 0.0f;
+	float SavedAlertDecayRate = 0.0f;
+	double PhaseStartTime = 0.0;
+	double OverwhelmTime = 0.0;
+	int64 PhaseStartBytes = 0;
+
+	/** Per phase: [0] push channel, [1] polling */
+	float DirectorLatencyMs[2] = {};
+	float DirectorBytesPerMin[2] = {};
+
+	FRfsnLoadTestReport LastReport;
+
+	bool BeginRun(int32 NpcCount, float DurationSeconds);
+	AActor* SpawnNpc(int32 Index);
+	/** Start or restart playback on every replaying NPC that has finished */
+	void TickReplay(double Now);
+	void IssuePoolRequest();
+	void FinishLoadTest();
+	void DestroyNpcs();
+
+	/** Restart the bridge in the next mode with the director back at its baseline alert */
+	void BeginDirectorPhase(bool bPolling, double Now);
+	void TickDirector(double Now);
+	void FinishDirectorTest();
+
+	UFUNCTION()
+	void HandleDirectorCommand(const FString& CommandName);
+
+	/** Write the report for CI, broadcast it and honour -RfsnLoadTestExit */
+	void PublishReport(const FRfsnLoadTestReport& Report);
+};
@@ -0,0 +1,197 @@
+// RFSN Look-At Manager
+// Solves body turn and head aim for every looking NPC in one pass, replacing per-component ticks
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "RfsnLookAtManager.generated.h"
+
+class URfsnDialogueManager;
+class URfsnNpcLookAt;
+
+/** How one NPC turns toward its target */
+struct FRfsnLookAtParams
+{
+	/** Body interp speed (RInterpTo speed, RotationSpeed / 90) */
+	float TurnSpeed = 2.0f;
+
+	/** Targets within this yaw are followed by the head alone; it is also the head's yaw limit */
+	float HeadOnlyAngle = 45.0f;
+
+	float MaxHeadPitch = 30.0f;
+
+	/** Head interp speed (FInterpTo speed) */
+	float HeadSpeed = 8.0f;
+
+	bool bRotateBody = true;
+};
+
+/**
+ * World-independent core of the look-at manager.
+ * Entries are kept densely, structure-of-arrays, so a solve is one straight pass over plain floats. The body
+ * turns (yaw only) once the target is more than HeadOnlyAngle off its facing, exactly as URfsnNpcLookAt did
+ * per tick; the head then takes the remaining yaw and the pitch, clamped and smoothed, for the animation
+ * blueprint. An entry without a target eases its head back to centre and reports itself settled.
+ */
+struct MYPROJECT_API FRfsnLookAtSolver
+{
+	/** Add an entry with its head centred; returns its index */
+	int32 Add(const FRfsnLookAtParams& Params);
+
+	/** Remove by moving the last entry into Index; returns the old index of the moved entry (INDEX_NONE if none) */
+	int32 RemoveAtSwap(int32 Index);
+
+	int32 Num() const { return BodyYaw.Num(); }
+
+	void SetParams(int32 Index, const FRfsnLookAtParams& Params);
+
+	/** Frame inputs: where the NPC stands, which way it faces and what it looks at */
+	void SetPose(int32 Index, const FVector& Origin, float InBodyYaw);
+	void SetTarget(int32 Index, const FVector& Target);
+	void ClearTarget(int32 Index);
+	bool HasTarget(int32 Index) const { return (Flags[Index] & FlagHasTarget) != 0; }
+
+	/** Solve every entry, split over worker threads in batches of at least MinBatch when bParallel */
+	void Solve(float DeltaTime, bool bParallel = false, int32 MinBatch = 64);
+
+	/** Solve entries [Begin, End) */
+	void SolveRange(int32 Begin, int32 End, float DeltaTime);
+
+	// Results
+	float GetBodyYaw(int32 Index) const { return BodyYaw[Index]; }
+	bool IsTurningBody(int32 Index) const { return (Flags[Index] & FlagTurning) != 0; }
+	float GetHeadYaw(int32 Index) const { return HeadYaw[Index]; }
+	float GetHeadPitch(int32 Index) const { return HeadPitch[Index]; }
+	float GetAngleToTarget(int32 Index) const { return AngleToTarget[Index]; }
+
+	/** No target and the head is back at centre: nothing left to solve */
+	bool IsSettled(int32 Index) const { return (Flags[Index] & FlagSettled) != 0; }
+
+private:
+	static constexpr uint8 FlagHasTarget = 1 << 0;
+	static constexpr uint8 FlagRotateBody = 1 << 1;
+	static constexpr uint8 FlagTurning = 1 << 2;
+	static constexpr uint8 FlagSettled = 1 << 3;
+
+	// Inputs
+	TArray<float> OriginX;
+	TArray<float> OriginY;
+	TArray<float> OriginZ;
+	TArray<float> TargetX;
+	TArray<float> TargetY;
+	TArray<float> TargetZ;
+	TArray<float> TurnSpeed;
+	TArray<float> HeadOnlyAngle;
+	TArray<float> MaxHeadPitch;
+	TArray<float> HeadSpeed;
+
+	// Inputs and results
+	TArray<float> BodyYaw;
+	TArray<float> HeadYaw;
+	TArray<float> HeadPitch;
+	TArray<float> AngleToTarget;
+	TArray<uint8> Flags;
+};
+
+/**
+ * World Subsystem that turns every URfsnNpcLookAt toward its target in one batch per frame.
+ * Components register in BeginPlay and never tick. An NPC only joins the solve once it is given a target,
+ * and leaves it again once its head has returned to centre after the target is cleared, so idle NPCs cost
+ * nothing. The subsystem itself only ticks while someone is looking. Dialogue start and end come from
+ * URfsnDialogueManager's events instead of every component polling it.
+ */
+UCLASS()
+class MYPROJECT_API URfsnLookAtManager : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	// ─────────────────────────────────────────────────────────────
+	// Configuration
+	// ─────────────────────────────────────────────────────────────
+
+	/** Solve on worker threads when enough NPCs are looking */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "RFSN|LookAt")
+	bool bSolveInParallel = true;
+
+	/** Fewest NPCs per worker batch */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "RFSN|LookAt", meta = (ClampMin = "1"))
+	int32 ParallelBatchSize = 64;
+
+	// ─────────────────────────────────────────────────────────────
+	// API
+	// ─────────────────────────────────────────────────────────────
+
+	/** Register a component (asleep until it gets a target). Returns a handle. */
+	int32 Register(URfsnNpcLookAt* LookAt);
+	void Unregister(int32 Handle);
+
+	/** Look at an actor's eyes, a fixed location or the player's eyes; wakes the NPC */
+	void SetTargetActor(int32 Handle, AActor* Target);
+	void SetTargetLocation(int32 Handle, const FVector& Location);
+	void SetTargetPlayer(int32 Handle);
+
+	/** Stop looking; the NPC sleeps once its head is back at centre */
+	void ClearTarget(int32 Handle);
+
+	UFUNCTION(BlueprintPure, Category = "RFSN|LookAt")
+	int32 GetNumRegistered() const { return Entries.Num(); }
+
+	/** NPCs in the solve this frame */
+	UFUNCTION(BlueprintPure, Category = "RFSN|LookAt")
+	int32 GetNumAwake() const { return Solver.Num(); }
+
+	// UTickableWorldSubsystem
+	virtual void OnWorldBeginPlay(UWorld& InWorld) override;
+	virtual void Tick(float DeltaTime) override;
+	virtual bool IsTickable() const override { return Solver.Num() > 0; }
+	virtual TStatId GetStatId() const override;
+
+protected:
+	virtual void Deinitialize() override;
+
+private:
+	enum class ETarget : uint8
+	{
+		None,
+		Location,
+		Actor,
+		Player
+	};
+
+	struct FEntry
+	{
+		TWeakObjectPtr<URfsnNpcLookAt> Component;
+		TWeakObjectPtr<AActor> TargetActor;
+		FVector TargetLocation = FVector::ZeroVector;
+		ETarget Target = ETarget::None;
+
+		/** Index in the solver while awake */
+		int32 Awake = INDEX_NONE;
+	};
+
+	TSparseArray<FEntry> Entries;
+
+	FRfsnLookAtSolver Solver;
+
+	/** Entry handle per solver index */
+	TArray<int32> AwakeHandles;
+
+	/** Solver indices whose owner is gone or disabled this frame */
+	TBitArray<> Skipped;
+
+	TWeakObjectPtr<URfsnDialogueManager> DialogueManager;
+
+	/** Looking at the player because its NPC is in dialogue */
+	TWeakObjectPtr<URfsnNpcLookAt> DialogueLookAt;
+
+	void Wake(int32 Handle);
+	void Sleep(int32 Handle);
+
+	UFUNCTION()
+	void HandleDialogueStarted(AActor* NpcActor);
+
+	UFUNCTION()
+	void HandleDialogueEnded();
+};
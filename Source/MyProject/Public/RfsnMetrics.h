@@ -42,6 +42,13 @@ struct FRfsnPerformanceMetrics
 	UPROPERTY(BlueprintReadOnly, Category = "Metrics")
 	float MaxDialogueLatencyMs = 0.0f;
 
+	/** Player utterance to the first subtitle character on screen */
+	UPROPERTY(BlueprintReadOnly, Category = "Metrics")
+	float AverageTimeToFirstCharacterMs = 0.0f;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Metrics")
+	float MaxTimeToFirstCharacterMs = 0.0f;
+
 	UPROPERTY(BlueprintReadOnly, Category = "Metrics")
 	float AverageTokensPerSecond = 0.0f;
 
@@ -96,6 +103,10 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Metrics")
 	void RecordDialogueLatency(float LatencyMs);
 
+	/** Record time from a player utterance to the first subtitle character shown */
+	UFUNCTION(BlueprintCallable, Category = "Metrics")
+	void RecordTimeToFirstCharacter(float LatencyMs);
+
 	/** Record sentence received */
 	UFUNCTION(BlueprintCallable, Category = "Metrics")
 	void RecordSentenceReceived();
@@ -124,9 +135,11 @@ private:
 	FRfsnComponentMetrics ComponentMetrics;
 	FRfsnPerformanceMetrics PerformanceMetrics;
 	TArray<float> LatencySamples;
+	TArray<float> FirstCharacterSamples;
 
 	FTimerHandle MetricsTimerHandle;
 
 	void CollectMetrics();
 	void UpdateLatencyStats();
+	void UpdateFirstCharacterStats();
 };
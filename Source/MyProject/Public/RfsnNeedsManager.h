@@ -0,0 +1,137 @@
+// RFSN Needs Manager
+// Lazy needs simulation for every URfsnNpcNeeds in the world
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "RfsnNpcNeeds.h"
+#include "RfsnNeedsManager.generated.h"
+
+/**
+ * Structure-of-arrays needs store with closed-form decay.
+ * Values are kept as (value, time) pairs and evaluated on demand as Value - Rate * Elapsed,
+ * so nothing is touched between changes. The next seek/critical threshold crossing of each
+ * NPC sits in a min-heap; entries are invalidated by bumping the NPC's generation.
+ */
+struct MYPROJECT_API FRfsnNeedsSimulation
+{
+	/** Add an NPC. DecayScale converts simulation seconds to game hours (URfsnNpcNeeds::TimeScale / 3600). */
+	int32 Add(const FRfsnNeed (&Needs)[RfsnNeeds::Num], double DecayScale, double Now);
+	void Remove(int32 Npc);
+
+	bool IsValid(int32 Npc) const { return Active.IsValidIndex(Npc) && Active[Npc]; }
+	int32 Num() const { return Active.Num() - FreeSlots.Num(); }
+
+	/** Need value at Now */
+	float GetValue(int32 Npc, int32 Need, double Now) const
+	{
+		const double Elapsed = FMath::Max(Now - BaseTimes[Npc], 0.0);
+		const double Decay = DecayRates[Need][Npc] * DecayScales[Npc] * Elapsed;
+		return FMath::Max(0.0f, BaseValues[Need][Npc] - static_cast<float>(Decay));
+	}
+
+	/** Add Delta to a need (clamped to 0-100) at Now */
+	void Adjust(int32 Npc, int32 Need, float Delta, double Now);
+
+	/** Replace a need's value, rate and thresholds from Now */
+	void Set(int32 Npc, int32 Need, const FRfsnNeed& Config, double Now);
+
+	/** Change the time scale (0 freezes decay) */
+	void SetDecayScale(int32 Npc, double DecayScale, double Now);
+
+	/** Remove every NPC whose next crossing is due at Now, appending each once */
+	void PopDue(double Now, TArray<int32>& OutNpcs);
+
+	/** Queue the NPC's next crossing after Now (invalidates any queued one) */
+	void ScheduleNext(int32 Npc, double Now);
+
+	/** Time of the earliest queued crossing (may be stale) */
+	double GetNextEventTime() const
+	{
+		return Events.Num() > 0 ? Events.HeapTop().Time : TNumericLimits<double>::Max();
+	}
+
+	int32 GetQueuedEvents() const { return Events.Num(); }
+
+private:
+	struct FEvent
+	{
+		double Time = 0.0;
+		int32 Npc = INDEX_NONE;
+		uint32 Generation = 0;
+
+		bool operator<(const FEvent& Other) const { return Time < Other.Time; }
+	};
+
+	// Per need, per NPC
+	TArray<float> BaseValues[RfsnNeeds::Num];
+	TArray<float> DecayRates[RfsnNeeds::Num];
+	TArray<float> SeekThresholds[RfsnNeeds::Num];
+	TArray<float> CriticalThresholds[RfsnNeeds::Num];
+
+	// Per NPC
+	TArray<double> BaseTimes;
+	TArray<double> DecayScales;
+	TArray<uint32> Generations;
+	TBitArray<> Active;
+	TArray<int32> FreeSlots;
+
+	TArray<FEvent> Events;
+
+	/** Fold elapsed decay into the base values so the rate or value can change from Now */
+	void Rebase(int32 Npc, double Now);
+};
+
+/**
+ * World Subsystem that simulates needs for all registered URfsnNpcNeeds components.
+ * Nothing runs per NPC per frame: values are computed when read, and components are called
+ * back only when a need crosses its seek or critical threshold, or once per second while a need is critical.
+ */
+UCLASS()
+class MYPROJECT_API URfsnNeedsManager : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	/** Register a component with its current needs, time scale and enabled state. Returns a slot. */
+	int32 Register(URfsnNpcNeeds* Needs);
+	void Unregister(int32 Slot);
+
+	float GetNeedValue(int32 Slot, int32 Need) const;
+	void AdjustNeed(int32 Slot, int32 Need, float Delta);
+
+	/** Replace a need with the component's edited property (value, rate and thresholds) */
+	void SetNeed(int32 Slot, int32 Need, const FRfsnNeed& Config);
+
+	/** Re-read the component's time scale and enabled flag */
+	void UpdateDecay(int32 Slot);
+
+	/** Mark a slot as having a critical need; critical slots get HandleCriticalUpdate once per second */
+	void SetCritical(int32 Slot, bool bCritical);
+
+	UFUNCTION(BlueprintPure, Category = "RFSN|Needs")
+	int32 GetNumRegistered() const { return Simulation.Num(); }
+
+	// UTickableWorldSubsystem
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+protected:
+	virtual void Deinitialize() override;
+
+private:
+	FRfsnNeedsSimulation Simulation;
+
+	/** Owner per slot */
+	TArray<TWeakObjectPtr<URfsnNpcNeeds>> Components;
+
+	TArray<int32> DueSlots;
+
+	/** Slots with a critical need, and time since they were last updated */
+	TArray<int32> CriticalSlots;
+	TArray<int32> CriticalUpdateSlots;
+	float TimeSinceCriticalUpdate = 0.0f;
+
+	double GetNow() const;
+};
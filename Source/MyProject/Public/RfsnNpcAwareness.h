@@ -128,6 +128,10 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Awareness|Detection")
 	float AlertDuration = 10.0f;
 
+	/** Let URfsnPerceptionManager drive this component instead of ticking it individually */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Awareness|Detection")
+	bool bUseBatchedPerception = true;
+
 	// ─────────────────────────────────────────────────────────────
 	// State
 	// ─────────────────────────────────────────────────────────────
@@ -184,10 +188,16 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Awareness")
 	bool CanHearSound(FVector SoundLocation, float SoundLoudness = 1.0f);
 
-	/** Report a sound for this NPC to potentially hear */
+	/** Report a sound for this NPC to potentially hear (use URfsnPerceptionManager::ReportSound for everyone) */
 	UFUNCTION(BlueprintCallable, Category = "Awareness")
 	void ReportSound(FVector SoundLocation, float Loudness, AActor* Source = nullptr);
 
+	/** React to a sound already known to be in hearing range */
+	void ReceiveSound(FVector SoundLocation, float Loudness, AActor* Source);
+
+	/** Advance awareness with sight results computed elsewhere (called by URfsnPerceptionManager) */
+	void ApplyPerception(float DeltaTime, bool bSeesTarget, float Visibility);
+
 	/** Immediately alert to target */
 	UFUNCTION(BlueprintCallable, Category = "Awareness")
 	void AlertToTarget(AActor* Target);
@@ -218,13 +228,17 @@ public:
 
 protected:
 	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 	virtual void TickComponent(float DeltaTime, ELevelTick TickType,
 	                           FActorComponentTickFunction* ThisTickFunction) override;
 
 private:
-	/** Recent detection events */
+	/** Recent detection events (oldest first) */
 	TArray<FRfsnDetectionEvent> RecentEvents;
 
+	/** Registered with the world perception manager */
+	bool bRegisteredWithManager = false;
+
 	/** Update visual detection */
 	void UpdateVisualDetection(float DeltaTime);
 
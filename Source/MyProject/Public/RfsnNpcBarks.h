@@ -6,6 +6,7 @@
 
 #include "CoreMinimal.h"
 #include "Components/ActorComponent.h"
+#include "RfsnBarkCooldown.h"
 #include "RfsnNpcBarks.generated.h"
 
 /**
@@ -59,12 +60,6 @@ struct FRfsnBark
 	/** Cooldown between uses (seconds) */
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Bark")
 	float Cooldown = 30.0f;
-
-	/** Last time this bark was used */
-	float LastUsedTime = -1000.0f;
-
-	/** Can use this bark? */
-	bool IsAvailable(float CurrentTime) const { return CurrentTime - LastUsedTime >= Cooldown; }
 };
 
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnBarkTriggered, ERfsnBarkTrigger, Trigger, const FString&, Text);
@@ -85,7 +80,7 @@ public:
 	// Configuration
 	// ─────────────────────────────────────────────────────────────
 
-	/** All available barks */
+	/** NPC-specific barks (leave empty to share the default library; GetActiveBarks lists the barks in use) */
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Barks|Config")
 	TArray<FRfsnBark> Barks;
 
@@ -168,12 +163,24 @@ public:
 	UFUNCTION(BlueprintPure, Category = "Barks")
 	bool IsPlayerInRange() const;
 
-	/** Setup default barks */
+	/** Barks in use: Barks, or the shared defaults while Barks is empty (valid after BeginPlay) */
+	UFUNCTION(BlueprintPure, Category = "Barks")
+	TArray<FRfsnBark> GetActiveBarks() const;
+
+	/** Copy the default barks into Barks for editing */
 	UFUNCTION(BlueprintCallable, Category = "Barks")
 	void SetupDefaultBarks();
 
+	/** Re-acquire the shared library after Barks was edited at runtime (resets cooldowns) */
+	UFUNCTION(BlueprintCallable, Category = "Barks")
+	void RefreshBarkLibrary();
+
+	/** Shared bark content (valid after BeginPlay) */
+	const FRfsnNpcBarkSet* GetBarkSet() const { return SharedBarks.Get(); }
+
 protected:
 	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 	virtual void TickComponent(float DeltaTime, ELevelTick TickType,
 	                           FActorComponentTickFunction* ThisTickFunction) override;
 
@@ -181,6 +188,22 @@ private:
 	/** Idle bark timer */
 	float IdleTimer = 0.0f;
 
-	/** Select best bark from available */
-	FRfsnBark* SelectBark(ERfsnBarkTrigger Trigger);
+	/** Player in HearingRange, pushed by URfsnProximityManager */
+	int32 ProximityZone = INDEX_NONE;
+	bool bPlayerInRange = false;
+
+	/** Shared immutable bark content for this archetype */
+	TSharedPtr<const FRfsnNpcBarkSet, ESPMode::ThreadSafe> SharedBarks;
+
+	/** Per-NPC cooldowns over SharedBarks (advanced lazily, so also touched by const queries) */
+	mutable FRfsnBarkCooldownState CooldownState;
+
+	/** Copy the shared content into Barks if it is empty, before AddBark or ClearBarks edit it */
+	void MaterializeBarks();
+
+	/** Select best bark from available, INDEX_NONE if all are cooling */
+	int32 SelectBark(ERfsnBarkTrigger Trigger);
+
+	/** Mark a bark as spoken and broadcast it */
+	void PlayBark(int32 BarkIndex, float CurrentTime);
 };
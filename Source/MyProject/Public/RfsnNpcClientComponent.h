@@ -6,8 +6,12 @@
 #include "CoreMinimal.h"
 #include "Components/ActorComponent.h"
 #include "Interfaces/IHttpRequest.h"
+#include "RfsnStreamSession.h"
 #include "RfsnNpcClientComponent.generated.h"
 
+class URfsnResponseCache;
+struct FRfsnCachedResponse;
+
 UENUM(BlueprintType)
 enum class ERfsnNpcAction : uint8
 {
@@ -88,6 +92,7 @@ DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnRfsnSentenceReceived, const FRfsn
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnRfsnNpcActionReceived, ERfsnNpcAction, Action);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE(FOnRfsnDialogueComplete);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnRfsnError, const FString&, ErrorMessage);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE(FOnRfsnSessionPlaybackComplete);
 
 UCLASS(ClassGroup = (Custom), meta = (BlueprintSpawnableComponent))
 class MYPROJECT_API URfsnNpcClientComponent : public UActorComponent
@@ -129,6 +134,17 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "RFSN|Config")
 	FString TtsEngine = TEXT("piper");
 
+	/** Answer near-repeated utterances from URfsnResponseCache when the NPC's state hasn't changed */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "RFSN|Config")
+	bool bUseResponseCache = true;
+
+	/**
+	 * Record every dialogue stream (raw chunks with arrival times) and TTS exchange for SaveSessionRecording.
+	 * The response cache is bypassed while recording so the session holds real traffic.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "RFSN|Recording")
+	bool bRecordSession = false;
+
 	// ─────────────────────────────────────────────────────────────
 	// Events
 	// ─────────────────────────────────────────────────────────────
@@ -137,7 +153,7 @@ public:
 	UPROPERTY(BlueprintAssignable, Category = "RFSN|Events")
 	FOnRfsnMetaReceived OnMetaReceived;
 
-	/** Called for each sentence in the dialogue stream */
+	/** Called for each sentence in the dialogue stream (each token when the server streams per token) */
 	UPROPERTY(BlueprintAssignable, Category = "RFSN|Events")
 	FOnRfsnSentenceReceived OnSentenceReceived;
 
@@ -153,6 +169,10 @@ public:
 	UPROPERTY(BlueprintAssignable, Category = "RFSN|Events")
 	FOnRfsnError OnError;
 
+	/** Called when a recorded session has played to the end */
+	UPROPERTY(BlueprintAssignable, Category = "RFSN|Events")
+	FOnRfsnSessionPlaybackComplete OnSessionPlaybackComplete;
+
 	// ─────────────────────────────────────────────────────────────
 	// API
 	// ─────────────────────────────────────────────────────────────
@@ -169,6 +189,9 @@ public:
 	UFUNCTION(BlueprintPure, Category = "RFSN")
 	bool IsDialogueActive() const { return bIsStreaming; }
 
+	/** FPlatformTime::Seconds() when the current or last dialogue was sent, or its cached reply started */
+	double GetDialogueStartTime() const { return ReplyStartTime; }
+
 	/** Get the last received NPC action */
 	UFUNCTION(BlueprintPure, Category = "RFSN")
 	ERfsnNpcAction GetLastNpcAction() const { return LastNpcAction; }
@@ -177,6 +200,43 @@ public:
 	UFUNCTION(BlueprintPure, Category = "RFSN")
 	static ERfsnNpcAction ParseNpcAction(const FString& ActionString);
 
+	// ─────────────────────────────────────────────────────────────
+	// Session Recording & Playback
+	// ─────────────────────────────────────────────────────────────
+
+	/**
+	 * Save what was recorded since recording began or was last saved, then start afresh.
+	 * An empty path saves to FRfsnStreamSession::GetDefaultPath(NpcId).
+	 */
+	UFUNCTION(BlueprintCallable, Category = "RFSN|Recording")
+	bool SaveSessionRecording(const FString& FilePath);
+
+	/** Load a session file and play it back; see PlaySession */
+	UFUNCTION(BlueprintCallable, Category = "RFSN|Recording")
+	bool PlaySessionFile(const FString& FilePath, float Speed = 1.0f);
+
+	/**
+	 * Feed a recorded session through the same stream parsing and events as live traffic, with no orchestrator.
+	 * Speed scales the recorded timing (2 plays twice as fast); 0 plays everything at once. While a session plays,
+	 * SendPlayerUtterance and CancelDialogue are ignored. Several NPCs may share one session.
+	 */
+	void PlaySession(const TSharedPtr<const FRfsnStreamSession>& Session, float Speed = 1.0f);
+
+	UFUNCTION(BlueprintCallable, Category = "RFSN|Recording")
+	void StopSessionPlayback();
+
+	UFUNCTION(BlueprintPure, Category = "RFSN|Recording")
+	bool IsPlayingSession() const { return bPlayingSession; }
+
+	/** What the current or last playback produced; matches the session's Tally when the replay was faithful */
+	const FRfsnSessionTally& GetPlaybackTally() const { return PlaybackTally; }
+
+	/** The session being recorded, if any */
+	const FRfsnStreamSession* GetSessionRecording() const { return Recording.Get(); }
+
+	/** Add an exchange to the recording when recording (the voice router records TTS through this) */
+	void RecordSessionEvent(ERfsnSessionEvent Type, const FString& Body, int32 Code = 0);
+
 protected:
 	virtual void BeginPlay() override;
 	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
@@ -185,12 +245,64 @@ private:
 	TSharedPtr<IHttpRequest, ESPMode::ThreadSafe> CurrentRequest;
 	bool bIsStreaming = false;
 	bool bGotMeta = false;
+	bool bGotSentence = false;
 	ERfsnNpcAction LastNpcAction = ERfsnNpcAction::Talk;
-	FString StreamBuffer;
+
+	/** Response bytes already split into SSE lines; each progress callback only looks past this */
+	int32 ProcessedBytes = 0;
+
+	/** The live reply being recorded for the response cache, or the cached one being replayed */
+	TSharedPtr<FRfsnCachedResponse> Reply;
+	bool bReplaying = false;
+	int32 ReplayIndex = 0;
+	double ReplyStartTime = 0.0;
+	FTimerHandle ReplayTimer;
+
+	/** Session being recorded; created by the first event recorded */
+	TSharedPtr<FRfsnStreamSession> Recording;
+	double RecordingStartTime = 0.0;
+
+	/** Response bytes of the live stream already recorded */
+	int32 RecordedBytes = 0;
+
+	TSharedPtr<const FRfsnStreamSession> PlaybackSession;
+	bool bPlayingSession = false;
+	int32 PlaybackIndex = 0;
+	float PlaybackSpeed = 1.0f;
+	double PlaybackStartTime = 0.0;
+	FTimerHandle PlaybackTimer;
+	FRfsnSessionTally PlaybackTally;
+
+	/** The played stream's bytes so far, standing in for the HTTP response content */
+	TArray<uint8> PlaybackContent;
 
 	void OnStreamProgress(FHttpRequestPtr Request, uint64 BytesSent, uint64 BytesReceived);
 	void OnStreamComplete(FHttpRequestPtr Request, FHttpResponsePtr Response, bool bSuccess);
-	void ProcessSSELine(const FString& Line);
-	void ParseMetaEvent(const FString& JsonData);
-	void ParseSentenceEvent(const FString& JsonData);
+	/** Reset per-stream state for a dialogue that is starting, live or played back */
+	void BeginStream();
+	/** Finish the stream: Content is the whole response, null when there was none */
+	void EndStream(bool bSucceeded, int32 Code, const TArray<uint8>* Content);
+	/** Drop the stream in progress without completing it */
+	void CancelStream();
+	/** Process complete lines after ProcessedBytes (and the trailing partial line once the stream is over) */
+	void ConsumeStream(const TArray<uint8>& Content, bool bStreamEnded);
+	void ProcessSSELine(FUtf8StringView Line);
+	void ParseMetaEvent(FUtf8StringView JsonData);
+	void ParseSentenceEvent(FUtf8StringView JsonData);
+	/** Apply and broadcast a sentence, live or replayed */
+	void EmitSentence(const FRfsnSentence& Sentence);
+
+	URfsnResponseCache* GetResponseCache() const;
+	void StartReplay(const FRfsnCachedResponse& Cached);
+	/** Broadcast every replayed sentence that is due, then wait for the next or complete */
+	void ReplayDueSentences();
+
+	void RecordSessionBytes(ERfsnSessionEvent Type, const uint8* Data, int32 Size, int32 Code = 0);
+	/** Record the bytes a live response gained since last recorded */
+	void RecordStreamBytes(const TArray<uint8>& Content);
+	/** Tally being counted: the playback's, the recording's, or none */
+	FRfsnSessionTally* GetSessionTally();
+	/** Play every session event that is due, then wait for the next or finish */
+	void PlayDueSessionEvents();
+	void PlaySessionEvent(const FRfsnSessionEvent& Event);
 };
@@ -97,6 +97,7 @@ public:
 
 protected:
   virtual void BeginPlay() override;
+  virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
   virtual void
   TickComponent(float DeltaTime, ELevelTick TickType,
                 FActorComponentTickFunction *ThisTickFunction) override;
@@ -106,9 +107,13 @@ private:
   bool bProximityTriggered = false;
   float LastTriggerTime = -999.0f;
 
+  /** Zone in URfsnProximityManager (INDEX_NONE = polling fallback) */
+  int32 ProximityZone = INDEX_NONE;
+
   TObjectPtr<APawn> PlayerPawn;
 
   void FindComponents();
   void CheckProximity();
+  void SetPlayerInProximity(bool bInProximity);
   bool CanTrigger() const;
 };
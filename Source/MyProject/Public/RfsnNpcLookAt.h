@@ -7,11 +7,13 @@
 #include "Components/ActorComponent.h"
 #include "RfsnNpcLookAt.generated.h"
 
-class URfsnDialogueManager;
+class URfsnLookAtManager;
 
 /**
  * Component that makes NPCs look at the player during dialogue.
  * Smoothly rotates NPC to face the player and can trigger head/eye look.
+ * URfsnLookAtManager solves every looking NPC in one batch; the component doesn't tick, and an NPC without
+ * a target costs nothing per frame.
  */
 UCLASS(ClassGroup = (Custom), meta = (BlueprintSpawnableComponent))
 class MYPROJECT_API URfsnNpcLookAt : public UActorComponent
@@ -45,6 +47,14 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "LookAt")
 	float HeadOnlyAngle = 45.0f;
 
+	/** Maximum head pitch up or down */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "LookAt|Animation", meta = (ClampMin = "0", ClampMax = "90"))
+	float MaxHeadPitch = 30.0f;
+
+	/** Head aim interp speed */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "LookAt|Animation", meta = (ClampMin = "0"))
+	float HeadInterpSpeed = 8.0f;
+
 	/** Bone name for head look (if using skeletal mesh) */
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "LookAt|Animation")
 	FName HeadBoneName = TEXT("head");
@@ -65,6 +75,14 @@ public:
 	UPROPERTY(BlueprintReadOnly, Category = "LookAt")
 	bool bIsLookingAtPlayer = false;
 
+	/** Head yaw relative to the body (degrees, within HeadOnlyAngle), for the animation blueprint */
+	UPROPERTY(BlueprintReadOnly, Category = "LookAt|Animation")
+	float HeadYaw = 0.0f;
+
+	/** Head pitch (degrees, within MaxHeadPitch), for the animation blueprint */
+	UPROPERTY(BlueprintReadOnly, Category = "LookAt|Animation")
+	float HeadPitch = 0.0f;
+
 	// ─────────────────────────────────────────────────────────────
 	// API
 	// ─────────────────────────────────────────────────────────────
@@ -77,6 +95,10 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "LookAt")
 	void LookAtLocation(FVector Location);
 
+	/** Start looking at the player's eyes, following them as they move */
+	UFUNCTION(BlueprintCallable, Category = "LookAt")
+	void LookAtPlayer();
+
 	/** Stop looking and return to default */
 	UFUNCTION(BlueprintCallable, Category = "LookAt")
 	void StopLooking();
@@ -85,18 +107,23 @@ public:
 	UFUNCTION(BlueprintPure, Category = "LookAt")
 	float GetAngleToTarget() const;
 
+	/** Head aim relative to the body, for the animation blueprint */
+	UFUNCTION(BlueprintPure, Category = "LookAt|Animation")
+	FRotator GetHeadAimRotation() const { return FRotator(HeadPitch, HeadYaw, 0.0f); }
+
+	/** Called by URfsnLookAtManager after each solve */
+	void HandleSolved(const FVector& Target, float InHeadYaw, float InHeadPitch);
+
 protected:
 	virtual void BeginPlay() override;
-	virtual void TickComponent(float DeltaTime, ELevelTick TickType,
-	                           FActorComponentTickFunction* ThisTickFunction) override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 
 private:
 	UPROPERTY()
 	TWeakObjectPtr<AActor> CurrentTarget;
 
-	FRotator TargetRotation;
 	bool bHasTarget = false;
 
-	void UpdateLookAt(float DeltaTime);
-	FVector GetPlayerEyeLocation() const;
+	TWeakObjectPtr<URfsnLookAtManager> Manager;
+	int32 ManagerHandle = INDEX_NONE;
 };
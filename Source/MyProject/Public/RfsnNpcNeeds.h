@@ -8,6 +8,22 @@
 #include "Components/ActorComponent.h"
 #include "RfsnNpcNeeds.generated.h"
 
+class URfsnNeedsManager;
+
+namespace RfsnNeeds
+{
+	/** Need indices, in declaration order of the component's need properties */
+	enum EIndex : int32
+	{
+		Hunger,
+		Energy,
+		Social,
+		Safety,
+		Purpose,
+		Num
+	};
+} // namespace RfsnNeeds
+
 /**
  * Individual need status
  */
@@ -64,7 +80,12 @@ DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnNeedCritical, FName, NeedName);
 
 /**
  * NPC Needs Component
- * Tracks and manages NPC physiological and psychological needs
+ * Tracks and manages NPC physiological and psychological needs.
+ * Decay is simulated by URfsnNeedsManager; the need properties are refreshed whenever a threshold
+ * is crossed, a need is changed through this API, or RefreshNeeds is called.
+ * Between those evaluations the need Values and OverallWellbeing are stale; GetNeedValue and
+ * GetOverallWellbeing are always current. Blueprint writes to a need property are picked up by the next
+ * evaluation (call RefreshNeeds to apply them at once).
  */
 UCLASS(ClassGroup = (Custom), meta = (BlueprintSpawnableComponent))
 class MYPROJECT_API URfsnNpcNeeds : public UActorComponent
@@ -118,7 +139,7 @@ public:
 	UPROPERTY(BlueprintReadOnly, Category = "Needs|State")
 	ERfsnNeedState CurrentState = ERfsnNeedState::Content;
 
-	/** Overall wellbeing (0-100 average of all needs) */
+	/** Overall wellbeing (0-100 average of all needs) as of the last evaluation (GetOverallWellbeing is current) */
 	UPROPERTY(BlueprintReadOnly, Category = "Needs|State")
 	float OverallWellbeing = 100.0f;
 
@@ -130,10 +151,14 @@ public:
 	UPROPERTY(BlueprintAssignable, Category = "Needs|Events")
 	FOnNeedStateChanged OnNeedStateChanged;
 
-	/** Called when a need becomes critical */
+	/** Called for each critical need on every update (once per second) while it stays critical */
 	UPROPERTY(BlueprintAssignable, Category = "Needs|Events")
 	FOnNeedCritical OnNeedCritical;
 
+	/** Called once when a need becomes critical */
+	UPROPERTY(BlueprintAssignable, Category = "Needs|Events")
+	FOnNeedCritical OnNeedBecameCritical;
+
 	// ─────────────────────────────────────────────────────────────
 	// API
 	// ─────────────────────────────────────────────────────────────
@@ -166,6 +191,10 @@ public:
 	UFUNCTION(BlueprintPure, Category = "Needs")
 	float GetNeedValue(FName NeedName) const;
 
+	/** Overall wellbeing (0-100 average of all needs) now */
+	UFUNCTION(BlueprintPure, Category = "Needs")
+	float GetOverallWellbeing() const;
+
 	/** Check if any need is critical */
 	UFUNCTION(BlueprintPure, Category = "Needs")
 	bool HasCriticalNeed() const;
@@ -190,20 +219,63 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Needs")
 	void ApplyToEmotionBlend();
 
+	/** Apply Blueprint edits to the need properties, copy the current values into them and re-read TimeScale */
+	UFUNCTION(BlueprintCallable, Category = "Needs")
+	void RefreshNeeds();
+
+	/** Pause or resume decay */
+	UFUNCTION(BlueprintCallable, Category = "Needs")
+	void SetNeedsEnabled(bool bNewEnabled);
+
+	/** Needs with their current values, indexed by RfsnNeeds::EIndex */
+	void GetCurrentNeeds(FRfsnNeed (&OutNeeds)[RfsnNeeds::Num]) const;
+
+	/** Calculate overall state from needs */
+	static ERfsnNeedState CalculateState(const FRfsnNeed (&Needs)[RfsnNeeds::Num]);
+
+	/** Called by URfsnNeedsManager when a need crosses its seek or critical threshold */
+	void HandleThresholdCrossed();
+
+	/** Called by URfsnNeedsManager once per second while a need is critical */
+	void HandleCriticalUpdate();
+
+	/** Seconds between the updates that repeat OnNeedCritical (the old tick interval) */
+	static constexpr float CriticalUpdateInterval = 1.0f;
+
 protected:
 	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 	virtual void TickComponent(float DeltaTime, ELevelTick TickType,
 	                           FActorComponentTickFunction* ThisTickFunction) override;
 
 private:
-	/** Time accumulator for decay */
+	/** Time accumulator for decay (unmanaged fallback only) */
 	float TimeAccumulator = 0.0f;
 
-	/** Update needs based on elapsed time */
+	TWeakObjectPtr<URfsnNeedsManager> Manager;
+	int32 ManagedSlot = INDEX_NONE;
+
+	/** Critical flags from the last evaluation, so OnNeedBecameCritical fires once per episode */
+	bool bWasCritical[RfsnNeeds::Num] = {};
+
+	/** Need properties as the last evaluation wrote them, to spot edits made since */
+	FRfsnNeed SyncedNeeds[RfsnNeeds::Num];
+
+	FRfsnNeed& GetNeedByIndex(int32 Need);
+	const FRfsnNeed& GetNeedByIndex(int32 Need) const;
+
+	/** Add Delta to a need and re-evaluate */
+	void AdjustNeed(int32 Need, float Delta);
+
+	/** Hand need properties edited since the last evaluation to the manager */
+	void ApplyEditedNeeds();
+
+	/** Update needs based on elapsed time (unmanaged fallback only) */
 	void UpdateNeeds(float GameHours);
 
-	/** Calculate overall state from needs */
-	ERfsnNeedState CalculateState() const;
+	/** Refresh values, broadcast critical needs and state changes. bUpdate marks a decay update, which repeats
+	 *  OnNeedCritical; direct changes only report needs that just became critical. */
+	void EvaluateNeeds(bool bUpdate = false);
 
 	/** Calculate wellbeing */
 	void UpdateWellbeing();
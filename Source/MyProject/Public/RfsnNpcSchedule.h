@@ -8,6 +8,8 @@
 #include "Components/ActorComponent.h"
 #include "RfsnNpcSchedule.generated.h"
 
+class URfsnGameClock;
+
 /**
  * Activity types for scheduled behaviors
  */
@@ -132,6 +134,37 @@ struct FRfsnPatrolRoute
 	bool bPingPong = false;
 };
 
+/**
+ * A schedule flattened into per-weekday segments.
+ * Every entry start/end is a boundary, so the winning entry is constant within a segment and
+ * lookups are a binary search instead of a scan; the next boundary is where the game clock
+ * should call back.
+ */
+struct MYPROJECT_API FRfsnCompiledSchedule
+{
+	struct FSegment
+	{
+		float StartHour = 0.0f;
+		int32 EntryIndex = INDEX_NONE;
+	};
+
+	static constexpr int32 NumDays = 7;
+
+	/** Segments per day of week (0 = Sunday), each starting at hour 0 */
+	TArray<FSegment> Days[NumDays];
+
+	void Compile(const TArray<FRfsnScheduleEntry>& Schedule);
+
+	/** Entry active at Hour on DayOfWeek (INDEX_NONE = default activity) */
+	int32 FindEntry(int32 DayOfWeek, float Hour) const;
+
+	/** Game minute of the first boundary after GameMinutes (midnight counts), given the weekday it falls on */
+	double GetNextTransition(double GameMinutes, int32 DayOfWeek) const;
+
+	/** Highest-priority entry containing Hour on DayOfWeek, by linear scan */
+	static int32 FindEntryForTime(const TArray<FRfsnScheduleEntry>& Schedule, float Hour, int32 DayOfWeek);
+};
+
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnActivityChanged, ERfsnActivityType, NewActivity, ERfsnActivityType,
                                              PreviousActivity);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnScheduleLocationReached, FVector, Location);
@@ -139,7 +172,9 @@ DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnPatrolWaypointReached, int32, Way
 
 /**
  * NPC Schedule Component
- * Manages time-based NPC behaviors and routines
+ * Manages time-based NPC behaviors and routines.
+ * With a URfsnGameClock in the world the schedule is event-driven: the clock calls back at each
+ * entry boundary and the component only ticks while patrolling.
  */
 UCLASS(ClassGroup = (Custom), meta = (BlueprintSpawnableComponent))
 class MYPROJECT_API URfsnNpcSchedule : public UActorComponent
@@ -193,7 +228,7 @@ public:
 	UPROPERTY(BlueprintReadOnly, Category = "Schedule|State")
 	int32 CurrentPatrolIndex = 0;
 
-	/** Is NPC at target location? */
+	/** Is NPC at target location? (refreshed every tick while patrolling, or always without a game clock) */
 	UPROPERTY(BlueprintReadOnly, Category = "Schedule|State")
 	bool bAtTargetLocation = false;
 
@@ -261,8 +296,13 @@ public:
 	UFUNCTION(BlueprintPure, Category = "Schedule")
 	FString GetScheduleContext() const;
 
+	/** Recompile after editing Schedule at runtime */
+	UFUNCTION(BlueprintCallable, Category = "Schedule")
+	void RebuildSchedule();
+
 protected:
 	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 	virtual void TickComponent(float DeltaTime, ELevelTick TickType,
 	                           FActorComponentTickFunction* ThisTickFunction) override;
 
@@ -270,8 +310,16 @@ private:
 	/** Is currently interrupted? */
 	bool bIsInterrupted = false;
 
-	/** Interrupt timer */
-	float InterruptTimer = 0.0f;
+	/** Ends the interrupt */
+	FTimerHandle InterruptTimerHandle;
+
+	/** Shared clock driving transitions (null = poll once per second) */
+	TWeakObjectPtr<URfsnGameClock> Clock;
+
+	/** Pending clock callback for the next schedule boundary */
+	int32 TransitionTimer = INDEX_NONE;
+
+	FRfsnCompiledSchedule CompiledSchedule;
 
 	/** Interrupt activity */
 	ERfsnActivityType InterruptActivity = ERfsnActivityType::Idle;
@@ -282,8 +330,24 @@ private:
 	/** Update current activity from schedule */
 	void UpdateActivityFromSchedule();
 
-	/** Find matching schedule entry for current time */
-	int32 FindScheduleEntryForTime(float Hour) const;
+	/** Find matching schedule entry for a time */
+	int32 FindScheduleEntryForTime(float Hour, int32 DayOfWeek) const;
+
+	/** Current day of week from the game clock (0 without one) */
+	int32 GetCurrentDayOfWeek() const;
+
+	/** Arm the clock callback for the next boundary */
+	void ScheduleNextTransition();
+
+	/** Clock callback at a schedule boundary */
+	void HandleTransition();
+
+	/** Clock rewound: re-evaluate and re-arm */
+	UFUNCTION()
+	void HandleClockJumped();
+
+	/** Tick only where the clock doesn't cover it */
+	void UpdateTickEnabled();
 
 	/** Check if at target location */
 	bool CheckAtTargetLocation() const;
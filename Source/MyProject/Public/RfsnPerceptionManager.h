@@ -0,0 +1,176 @@
+// RFSN Perception Manager
+// Batched sight and hearing for every URfsnNpcAwareness in the world
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "WorldCollision.h"
+#include "RfsnSpatialHash.h"
+#include "RfsnPerceptionManager.generated.h"
+
+class URfsnNpcAwareness;
+
+/**
+ * Structure-of-arrays batch of observer -> target pairs for one culling pass.
+ * Cull() is a single branch-free loop over plain float arrays so the compiler can vectorize it.
+ */
+struct MYPROJECT_API FRfsnPerceptionBatch
+{
+	// Inputs
+	TArray<float> EyeX, EyeY, EyeZ;
+	TArray<float> ForwardX, ForwardY, ForwardZ;
+	TArray<float> TargetX, TargetY, TargetZ;
+	TArray<float> SightRangeSq;
+	TArray<float> InvSightRange;
+	TArray<float> CosHalfFov;
+	TArray<float> CosHalfPeripheral;
+
+	/** Output: 0 if out of range or cone, otherwise distance factor x central/peripheral factor */
+	TArray<float> Visibility;
+
+	int32 Num() const { return EyeX.Num(); }
+
+	void Reset();
+
+	/** Add a pair. Cosines are of half the central and peripheral cone angles. */
+	int32 Add(const FVector& Eye, const FVector& Forward, const FVector& Target, float SightRange, float InCosHalfFov,
+	          float InCosHalfPeripheral);
+
+	/** Cosine of half a cone angle in degrees */
+	static float HalfAngleCos(float ConeDegrees) { return FMath::Cos(FMath::DegreesToRadians(ConeDegrees * 0.5f)); }
+
+	/** Range and cone tests for every pair (dot products against precomputed cosines, no Acos) */
+	void Cull();
+};
+
+USTRUCT(BlueprintType)
+struct FRfsnPerceptionStats
+{
+	GENERATED_BODY()
+
+	/** Registered observers */
+	UPROPERTY(BlueprintReadOnly, Category = "Stats")
+	int32 Observers = 0;
+
+	/** Observer-target pairs tested in the last pass */
+	UPROPERTY(BlueprintReadOnly, Category = "Stats")
+	int32 PairsTested = 0;
+
+	/** Pairs inside range and cone in the last pass (need line of sight) */
+	UPROPERTY(BlueprintReadOnly, Category = "Stats")
+	int32 PairsInCone = 0;
+
+	/** Async traces issued over the last second */
+	UPROPERTY(BlueprintReadOnly, Category = "Stats")
+	int32 TracesPerSecond = 0;
+
+	/** Cost of the last gather + cull + apply pass */
+	UPROPERTY(BlueprintReadOnly, Category = "Stats")
+	float LastPassMs = 0.0f;
+};
+
+/**
+ * World Subsystem that runs perception for all registered URfsnNpcAwareness components.
+ * Every UpdateInterval it gathers observer-target pairs, culls them in one pass and applies
+ * the results. Line-of-sight for pairs that survive the cull is refreshed with async traces,
+ * at most MaxTracesPerFrame per frame, so trace cost is flat regardless of NPC count.
+ * Sounds are broadcast through a spatial hash instead of being tested against every listener.
+ */
+UCLASS()
+class MYPROJECT_API URfsnPerceptionManager : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	// ─────────────────────────────────────────────────────────────
+	// Configuration
+	// ─────────────────────────────────────────────────────────────
+
+	/** Seconds between perception passes */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "RFSN|Perception", meta = (ClampMin = "0.0"))
+	float UpdateInterval = 0.1f;
+
+	/** Async line-of-sight traces issued per frame */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "RFSN|Perception", meta = (ClampMin = "1"))
+	int32 MaxTracesPerFrame = 16;
+
+	/** Line-of-sight results are refreshed once they are older than this */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "RFSN|Perception", meta = (ClampMin = "0.0"))
+	float LineOfSightMaxAge = 0.2f;
+
+	/** Cell size for the hearing grid */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "RFSN|Perception", meta = (ClampMin = "100.0"))
+	float HearingCellSize = 1000.0f;
+
+	// ─────────────────────────────────────────────────────────────
+	// API
+	// ─────────────────────────────────────────────────────────────
+
+	void RegisterObserver(URfsnNpcAwareness* Awareness);
+	void UnregisterObserver(URfsnNpcAwareness* Awareness);
+
+	/** Broadcast a sound to every observer in hearing range. Returns the number that heard it. */
+	UFUNCTION(BlueprintCallable, Category = "RFSN|Perception")
+	int32 ReportSound(FVector Location, float Loudness, AActor* Source = nullptr);
+
+	UFUNCTION(BlueprintPure, Category = "RFSN|Perception")
+	FRfsnPerceptionStats GetStats() const { return Stats; }
+
+	// UTickableWorldSubsystem
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+protected:
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Deinitialize() override;
+
+private:
+	struct FObserverSlot
+	{
+		TWeakObjectPtr<URfsnNpcAwareness> Awareness;
+
+		/** Target the cached line-of-sight result refers to */
+		TWeakObjectPtr<AActor> LosTarget;
+		bool bLosVisible = false;
+		double LosTime = -1.0;
+		FTraceHandle PendingTrace;
+
+		/** In range and cone on the last pass, and the visibility factor from the cull */
+		bool bInCone = false;
+		float Visibility = 0.0f;
+
+		/** Cone cosines, recomputed only when the observer's FOV settings change */
+		float CachedFov = -1.0f;
+		float CachedPeripheralFov = -1.0f;
+		float CosHalfFov = 0.0f;
+		float CosHalfPeripheral = 0.0f;
+	};
+
+	/** Stable slots (indices are carried through async trace user data) */
+	TArray<FObserverSlot> Slots;
+	TArray<int32> FreeSlots;
+	TMap<TWeakObjectPtr<URfsnNpcAwareness>, int32> SlotLookup;
+
+	FRfsnPerceptionBatch Batch;
+	TArray<int32> BatchSlots;
+
+	FRfsnSpatialHashGrid HearingGrid;
+
+	/** Largest HearingRange x HearingSensitivity among observers (bounds grid queries) */
+	float MaxHearingReach = 0.0f;
+	bool bHearingGridValid = false;
+
+	float TimeSinceUpdate = 0.0f;
+	int32 TraceCursor = 0;
+	int32 TracesThisWindow = 0;
+	float TraceWindowTime = 0.0f;
+
+	FTraceDelegate TraceDelegate;
+	FRfsnPerceptionStats Stats;
+
+	void RunPass(float DeltaTime);
+	void RebuildHearingGrid();
+	void IssueTraces();
+	void OnTraceComplete(const FTraceHandle& Handle, FTraceDatum& Datum);
+};
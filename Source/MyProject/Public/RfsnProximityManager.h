@@ -0,0 +1,149 @@
+// RFSN Proximity Manager
+// Player enter/exit events for NPC trigger radii, replacing per-component distance polling
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "RfsnSpatialHash.h"
+#include "RfsnProximityManager.generated.h"
+
+struct FRfsnProximityEvent
+{
+	int32 Zone = INDEX_NONE;
+	bool bEntered = false;
+};
+
+/**
+ * World-independent core of the proximity manager.
+ * Zones are circles (in 3D distance) around NPCs. A zone is entered when the player comes within
+ * Radius and exited only once the player is beyond Radius + Hysteresis, so standing on the edge
+ * doesn't flicker. Entry candidates come from a spatial hash; exits only check zones already inside.
+ */
+struct MYPROJECT_API FRfsnProximityTracker
+{
+	/** Extra distance beyond the radius before an exit fires */
+	float Hysteresis = 50.0f;
+
+	/** How far a zone may move from its grid position before it is re-bucketed */
+	float GridSlack = 300.0f;
+
+	/** Hash grid cell size */
+	float CellSize = 1000.0f;
+
+	int32 AddZone(const FVector& Location, float Radius);
+	void RemoveZone(int32 Zone);
+
+	bool IsValidZone(int32 Zone) const { return Zones.IsValidIndex(Zone); }
+	bool IsInside(int32 Zone) const { return Zones.IsValidIndex(Zone) && Zones[Zone].bInside; }
+	int32 Num() const { return Zones.Num(); }
+	const TArray<int32>& GetInsideZones() const { return InsideZones; }
+
+	/** Returns true if the zone moved (callers use this to decide whether to re-evaluate) */
+	bool SetZoneLocation(int32 Zone, const FVector& Location);
+	void SetZoneRadius(int32 Zone, float Radius);
+
+	/** Compare the player position against every zone that could have changed state */
+	void Update(const FVector& PlayerLocation, TArray<FRfsnProximityEvent>& OutEvents);
+
+	/** Player gone: exit every zone */
+	void ExitAll(TArray<FRfsnProximityEvent>& OutEvents);
+
+	/** Zones tested for entry on the last update */
+	int32 GetLastCandidates() const { return LastCandidates; }
+
+private:
+	struct FZone
+	{
+		FVector Location = FVector::ZeroVector;
+		FVector GridLocation = FVector::ZeroVector;
+		float Radius = 0.0f;
+		bool bInside = false;
+	};
+
+	TSparseArray<FZone> Zones;
+	TArray<int32> InsideZones;
+	FRfsnSpatialHashGrid Grid;
+	float MaxRadius = 0.0f;
+	bool bGridDirty = true;
+	int32 LastCandidates = 0;
+
+	void RebuildGrid();
+};
+
+/** Fired with true on enter and false on exit */
+DECLARE_DELEGATE_OneParam(FRfsnProximityChanged, bool /* bInside */);
+
+/**
+ * World Subsystem that turns player movement into enter/exit events for NPC trigger radii.
+ * Components register a radius and a callback instead of ticking to measure distance.
+ * Evaluation runs only when the player or a zone actually moved.
+ */
+UCLASS()
+class MYPROJECT_API URfsnProximityManager : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	// ─────────────────────────────────────────────────────────────
+	// Configuration
+	// ─────────────────────────────────────────────────────────────
+
+	/** Seconds between evaluations (matches the old per-component tick) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "RFSN|Proximity", meta = (ClampMin = "0.0"))
+	float EvaluationInterval = 0.1f;
+
+	/** Seconds between re-reading NPC positions (zones the player is inside are re-read every evaluation) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "RFSN|Proximity", meta = (ClampMin = "0.0"))
+	float ZoneRefreshInterval = 0.5f;
+
+	/** Player movement below this is ignored */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "RFSN|Proximity", meta = (ClampMin = "0.0"))
+	float PlayerMoveThreshold = 10.0f;
+
+	/** Extra distance beyond a radius before an exit fires */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "RFSN|Proximity", meta = (ClampMin = "0.0"))
+	float Hysteresis = 50.0f;
+
+	// ─────────────────────────────────────────────────────────────
+	// API
+	// ─────────────────────────────────────────────────────────────
+
+	/** Register a radius around Owner. Returns a zone handle (INDEX_NONE on failure). */
+	int32 RegisterZone(AActor* Owner, float Radius, FRfsnProximityChanged OnChanged);
+	void UnregisterZone(int32 Zone);
+	void SetZoneRadius(int32 Zone, float Radius);
+
+	/** Current state of a zone (false for invalid handles) */
+	bool IsPlayerInside(int32 Zone) const { return Tracker.IsInside(Zone); }
+
+	UFUNCTION(BlueprintPure, Category = "RFSN|Proximity")
+	int32 GetNumZones() const { return Tracker.Num(); }
+
+	// UTickableWorldSubsystem
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+protected:
+	virtual void Deinitialize() override;
+
+private:
+	struct FZoneListener
+	{
+		TWeakObjectPtr<AActor> Owner;
+		FRfsnProximityChanged OnChanged;
+	};
+
+	FRfsnProximityTracker Tracker;
+	TMap<int32, FZoneListener> Listeners;
+	TArray<FRfsnProximityEvent> PendingEvents;
+
+	FVector LastPlayerLocation = FVector::ZeroVector;
+	bool bHadPlayer = false;
+	bool bNeedsEvaluation = true;
+	float TimeSinceEvaluation = 0.0f;
+	float TimeSinceZoneRefresh = 0.0f;
+
+	void RefreshZoneLocations();
+	void DispatchEvents();
+};
@@ -6,6 +6,7 @@
 
 #include "CoreMinimal.h"
 #include "Components/ActorComponent.h"
+#include "RfsnQuestRegistry.h"
 #include "RfsnQuestIntegration.generated.h"
 
 /**
@@ -148,7 +149,9 @@ DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnObjectiveProgress, const FString
 
 /**
  * Quest Integration Component
- * Connects NPC dialogue with quest system
+ * Connects NPC dialogue with quest system.
+ * Quests and knowledge are looked up through IDs interned by URfsnQuestRegistry, and topic detection runs
+ * the registry's shared matcher. Call RefreshQuests after editing OfferedQuests or QuestKnowledge directly.
  */
 UCLASS(ClassGroup = (Custom), meta = (BlueprintSpawnableComponent))
 class MYPROJECT_API URfsnQuestIntegration : public UActorComponent
@@ -208,6 +211,10 @@ public:
 	UFUNCTION(BlueprintPure, Category = "Quest")
 	FRfsnQuest GetQuest(const FString& QuestId) const;
 
+	/** Re-index OfferedQuests and QuestKnowledge after editing them directly */
+	UFUNCTION(BlueprintCallable, Category = "Quest")
+	void RefreshQuests();
+
 	/** Get available quests from this NPC */
 	UFUNCTION(BlueprintPure, Category = "Quest")
 	TArray<FRfsnQuest> GetAvailableQuests() const;
@@ -220,7 +227,7 @@ public:
 	// API - Dialogue Integration
 	// ─────────────────────────────────────────────────────────────
 
-	/** Get quest context for LLM prompt */
+	/** Get quest context for LLM prompt (cached until a quest changes) */
 	UFUNCTION(BlueprintPure, Category = "Quest")
 	FString GetQuestContext() const;
 
@@ -250,8 +257,53 @@ public:
 
 protected:
 	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 
 private:
+	TWeakObjectPtr<URfsnQuestRegistry> Registry;
+
+	/** Index used when there is no registry (no world) */
+	mutable FRfsnQuestIndex LocalIndex;
+
+	// Lookups into OfferedQuests and QuestKnowledge, rebuilt when their sizes change, on RefreshQuests, or when a
+	// lookup finds them stale after an in-place edit
+
+	/** This component's pattern source in the index */
+	mutable int32 PatternSource = INDEX_NONE;
+
+	/** Interned quest ID -> first offered quest with it */
+	mutable TMap<int32, int32> QuestsById;
+
+	/** Interned quest ID or display name -> offered quests it names */
+	mutable TMultiMap<int32, int32> QuestsByPattern;
+
+	/** Interned quest ID -> first knowledge entry for it */
+	mutable TMap<int32, int32> KnowledgeById;
+
+	/** Index the lookups were built against, and the array sizes then */
+	mutable const FRfsnQuestIndex* IndexedIn = nullptr;
+	mutable int32 IndexedQuests = INDEX_NONE;
+	mutable int32 IndexedKnowledge = INDEX_NONE;
+
+	/** Last GetQuestContext result, and HashQuestContext when it was built */
+	mutable FString CachedContext;
+	mutable uint32 CachedContextKey = 0;
+	mutable bool bContextCached = false;
+
+	FRfsnQuestIndex& GetIndex() const;
+
+	/** Rebuild the lookups and this component's patterns */
+	void IndexQuests() const;
+	void EnsureIndexed() const;
+
+	/** Leave the current index (before switching to another, or at EndPlay) */
+	void ReleaseIndex();
+
+	void InvalidateQuestContext() { bContextCached = false; }
+
+	/** Hash of the statuses, names, objective progress and knowledge the quest context is built from */
+	uint32 HashQuestContext() const;
+
 	/** Find quest in offered quests */
 	FRfsnQuest* FindQuest(const FString& QuestId);
 	const FRfsnQuest* FindQuest(const FString& QuestId) const;
@@ -0,0 +1,142 @@
+// RFSN Quest Registry
+// Interned quest IDs and one precompiled topic matcher shared by every URfsnQuestIntegration
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "RfsnQuestRegistry.generated.h"
+
+/**
+ * Aho-Corasick automaton over lowercase patterns.
+ * Built once from all patterns, after which matching a text is one table step per character however many
+ * patterns there are, plus one step per match. Characters are folded into classes (one per character used by
+ * any pattern, and one for everything else) so the transition table stays dense and small.
+ */
+struct MYPROJECT_API FRfsnQuestMatcher
+{
+	/** Queue a pattern for the next Build; matched ignoring case. Empty patterns are ignored. */
+	void Add(const FString& Pattern, int32 Value);
+
+	/** Compile the queued patterns */
+	void Build();
+
+	/** Drop every pattern */
+	void Reset();
+
+	/** Append the value of every pattern occurrence in Text, in the order the occurrences end */
+	void Match(const FString& Text, TArray<int32>& OutValues) const;
+
+	int32 NumPatterns() const { return Patterns.Num(); }
+	int32 NumStates() const { return NumClasses > 0 ? Transitions.Num() / NumClasses : 0; }
+
+private:
+	struct FPattern
+	{
+		FString Text;
+		int32 Value = INDEX_NONE;
+	};
+
+	TArray<FPattern> Patterns;
+
+	/** Class per lowercase ASCII character; 0 is "in no pattern" */
+	uint16 AsciiClasses[128] = {};
+	TMap<TCHAR, uint16> OtherClasses;
+	int32 NumClasses = 0;
+
+	/** State * NumClasses + class -> next state; state 0 is the root */
+	TArray<int32> Transitions;
+
+	/** First entry of each state's own values in Values (INDEX_NONE if none) */
+	TArray<int32> FirstValue;
+
+	/** Nearest state along the failure chain that has values of its own (0 if none) */
+	TArray<int32> OutputLinks;
+
+	TArray<int32> Values;
+	TArray<int32> NextValue;
+
+	uint16 GetClass(TCHAR Char) const;
+};
+
+/**
+ * Case-insensitive string interning plus the quest topic matcher.
+ * Quest IDs and display names are interned to dense ids so lookups hash once and compare ints. Each source
+ * (one URfsnQuestIntegration) lists the interned strings it wants found in dialogue; the matcher over the quest
+ * keywords and every source's patterns is rebuilt only when some source's list changes.
+ */
+struct MYPROJECT_API FRfsnQuestIndex
+{
+	/** Id of Text ignoring case, added if new; ids are never reused */
+	int32 Intern(const FString& Text);
+
+	/** Id of Text ignoring case, INDEX_NONE if it was never interned */
+	int32 Find(const FString& Text) const;
+
+	/** Lowercase text of an id */
+	const FString& GetString(int32 Id) const { return Strings[Id]; }
+	int32 NumStrings() const { return Strings.Num(); }
+
+	/** Add a source with no patterns; returns its handle */
+	int32 AddSource();
+	void RemoveSource(int32 Source);
+
+	/** Replace the interned strings a source wants matched */
+	void SetPatterns(int32 Source, const TArray<int32>& PatternIds);
+
+	/**
+	 * Find the quest keywords and every source's patterns in Text. Appends each matched pattern id once and
+	 * sets bOutKeyword if any keyword occurs. Rebuilds the matcher first if patterns changed.
+	 */
+	void Detect(const FString& Text, TArray<int32>& OutIds, bool& bOutKeyword);
+
+	/** Compile the matcher now rather than on the next Detect */
+	void Build();
+
+	bool NeedsBuild() const { return bDirty; }
+	int32 GetNumBuilds() const { return NumBuilds; }
+	const FRfsnQuestMatcher& GetMatcher() const { return Matcher; }
+
+private:
+	struct FKeyFuncs : TDefaultMapKeyFuncs<FString, int32, false>
+	{
+		static bool Matches(const FString& A, const FString& B) { return A.Equals(B, ESearchCase::IgnoreCase); }
+		static uint32 GetKeyHash(const FString& Key);
+	};
+
+	TMap<FString, int32, FDefaultSetAllocator, FKeyFuncs> Ids;
+	TArray<FString> Strings;
+
+	TSparseArray<TArray<int32>> Sources;
+
+	FRfsnQuestMatcher Matcher;
+	bool bDirty = true;
+	int32 NumBuilds = 0;
+
+	TArray<int32> Matches;
+};
+
+/**
+ * World Subsystem holding the quest index shared by all URfsnQuestIntegration components.
+ * One matcher covers every NPC's quests, so it is compiled once per change to the world's quest set
+ * rather than per NPC, and each component keeps only the matches that belong to its own quests.
+ */
+UCLASS()
+class MYPROJECT_API URfsnQuestRegistry : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	FRfsnQuestIndex& GetIndex() { return Index; }
+
+	/** Quest IDs and names interned so far */
+	UFUNCTION(BlueprintPure, Category = "RFSN|Quest")
+	int32 GetNumInterned() const { return Index.NumStrings(); }
+
+	/** Patterns in the compiled matcher */
+	UFUNCTION(BlueprintPure, Category = "RFSN|Quest")
+	int32 GetNumPatterns() const { return Index.GetMatcher().NumPatterns(); }
+
+private:
+	FRfsnQuestIndex Index;
+};
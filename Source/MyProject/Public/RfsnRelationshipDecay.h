@@ -9,6 +9,7 @@
 #include "RfsnRelationshipDecay.generated.h"
 
 class URfsnNpcClientComponent;
+class URfsnRelationshipDecayManager;
 
 /**
  * Relationship standing level
@@ -51,7 +52,9 @@ DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnRelationshipTierChanged, ERfsnRe
 
 /**
  * Relationship Decay Component
- * Manages relationship degradation over time
+ * Manages relationship degradation over time.
+ * Decay is evaluated lazily by URfsnRelationshipDecayManager from the value and time of the last change;
+ * the state properties are refreshed on every change and whenever the value decays into another tier.
  */
 UCLASS(ClassGroup = (Custom), meta = (BlueprintSpawnableComponent))
 class MYPROJECT_API URfsnRelationshipDecay : public UActorComponent
@@ -97,7 +100,7 @@ public:
 	// State
 	// ─────────────────────────────────────────────────────────────
 
-	/** Current relationship value */
+	/** Relationship value as of the last change or tier crossing (GetCurrentValue is exact) */
 	UPROPERTY(BlueprintReadOnly, Category = "Decay|State")
 	float CurrentValue = 0.0f;
 
@@ -105,7 +108,7 @@ public:
 	UPROPERTY(BlueprintReadOnly, Category = "Decay|State")
 	ERfsnRelationshipTier CurrentTier = ERfsnRelationshipTier::Neutral;
 
-	/** Game hours since last interaction */
+	/** Game hours since last interaction, as of the last change (GetHoursSinceInteraction is exact) */
 	UPROPERTY(BlueprintReadOnly, Category = "Decay|State")
 	float HoursSinceInteraction = 0.0f;
 
@@ -113,7 +116,7 @@ public:
 	UPROPERTY(BlueprintReadOnly, Category = "Decay|State")
 	bool bIsLocked = false;
 
-	/** Recent bonuses */
+	/** The latest bonuses, oldest first */
 	UPROPERTY(BlueprintReadOnly, Category = "Decay|State")
 	TArray<FRfsnRelationshipBonus> RecentBonuses;
 
@@ -155,10 +158,22 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Decay")
 	void Betray(float Value = -50.0f);
 
-	/** Tick decay (call with game hours elapsed) */
+	/** Decay this relationship alone by game hours elapsed (game clock time decays every NPC on its own) */
 	UFUNCTION(BlueprintCallable, Category = "Decay")
 	void TickDecay(float GameHoursElapsed);
 
+	/** Current relationship value */
+	UFUNCTION(BlueprintPure, Category = "Decay")
+	float GetCurrentValue() const;
+
+	/** Game hours since last interaction */
+	UFUNCTION(BlueprintPure, Category = "Decay")
+	float GetHoursSinceInteraction() const;
+
+	/** Re-read the decay config after changing it at runtime */
+	UFUNCTION(BlueprintCallable, Category = "Decay")
+	void RefreshDecaySettings();
+
 	/** Get current tier */
 	UFUNCTION(BlueprintPure, Category = "Decay")
 	ERfsnRelationshipTier GetTier() const { return CurrentTier; }
@@ -183,13 +198,25 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Decay")
 	void SetInitialValue(float Value);
 
+	/** Called by URfsnRelationshipDecayManager when the value decays into another tier */
+	void HandleTierCrossed();
+
 protected:
 	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 
 private:
+	static constexpr int32 MaxRecentBonuses = 10;
+
+	TWeakObjectPtr<URfsnRelationshipDecayManager> Manager;
+	int32 ManagedSlot = INDEX_NONE;
+
 	/** Update tier from current value */
 	void UpdateTier();
 
-	/** Calculate effective decay rate */
-	float CalculateDecayRate() const;
+	/** Set the value (and current lock) here and in the manager */
+	void CommitValue(float Value);
+
+	/** Pull the decayed value and hours from the manager */
+	void RefreshFromManager();
 };
@@ -0,0 +1,220 @@
+// RFSN Relationship Decay Manager
+// Lazy closed-form relationship decay for every URfsnRelationshipDecay in the world
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "RfsnRelationshipDecay.h"
+#include "RfsnRelationshipDecayManager.generated.h"
+
+class URfsnGameClock;
+
+namespace RfsnRelationship
+{
+/** Tier boundaries of URfsnRelationshipDecay::ValueToTier, plus neutral (0) where decay stops */
+constexpr float Stops[] = {-60.0f, -20.0f, 0.0f, 20.0f, 60.0f, 100.0f};
+constexpr int32 NumStops = UE_ARRAY_COUNT(Stops);
+
+/** Tier crossings are queued a game minute past the boundary so the value read then is past it */
+constexpr double CrossingSlackHours = 1.0 / 60.0;
+
+/** Stale heap entries are dropped once the heap holds this many and more than twice the NPC count */
+constexpr int32 MinEventsToCompact = 256;
+} // namespace RfsnRelationship
+
+/** The decay settings of one NPC (see URfsnRelationshipDecay) */
+struct FRfsnRelationshipDecayParams
+{
+	float DecayRatePerDay = 2.0f;
+	float GracePeriodHours = 48.0f;
+	float PositiveMultiplier = 0.5f;
+	float NegativeMultiplier = 1.5f;
+};
+
+namespace RfsnRelationship
+{
+/** The decay settings of a component */
+MYPROJECT_API FRfsnRelationshipDecayParams MakeParams(const URfsnRelationshipDecay* Relationship);
+} // namespace RfsnRelationship
+
+/**
+ * Structure-of-arrays relationship store with closed-form decay, in game hours.
+ * Each NPC keeps its value at its last change and the time of its last interaction. Decay starts once the
+ * grace period after the interaction is over and runs toward neutral at the rate of the tier the value is
+ * passing through, so the value at any later time is a walk over at most a few linear segments. Nothing is
+ * touched between changes, and skipping any amount of time is O(1) per NPC. The next tier crossing of each
+ * NPC sits in a min-heap; entries are invalidated by bumping the NPC's generation.
+ */
+struct MYPROJECT_API FRfsnRelationshipLedger
+{
+	/** Add an NPC with Value at Now, last interacted with HoursSinceInteraction earlier. Returns its slot. */
+	int32 Add(const FRfsnRelationshipDecayParams& Params, float Value, bool bLocked, double HoursSinceInteraction,
+	          double Now);
+	void Remove(int32 Npc);
+
+	bool IsValid(int32 Npc) const { return Active.IsValidIndex(Npc) && Active[Npc]; }
+	int32 Num() const { return Active.Num() - FreeSlots.Num(); }
+
+	/** Value at Now */
+	float GetValue(int32 Npc, double Now) const;
+
+	double GetHoursSinceInteraction(int32 Npc, double Now) const
+	{
+		return FMath::Max(Now - InteractionHours[Npc], 0.0);
+	}
+
+	bool IsLocked(int32 Npc) const { return Locked[Npc]; }
+
+	/** Replace the value and lock at Now; the time since the last interaction carries on */
+	void SetValue(int32 Npc, float Value, bool bLocked, double Now);
+
+	/** Restart the grace period at Now */
+	void RecordInteraction(int32 Npc, double Now);
+
+	/** Let Hours more pass for this NPC alone, as if it had last been touched Hours earlier */
+	void FastForward(int32 Npc, double Hours, double Now);
+
+	void SetParams(int32 Npc, const FRfsnRelationshipDecayParams& Params, double Now);
+
+	/** The clock went back to Now: move every NPC's times so none lies ahead, keeping its value */
+	void Rewind(double Now);
+
+	/** Remove every NPC whose next tier crossing is due at Now, appending each once */
+	void PopDue(double Now, TArray<int32>& OutNpcs);
+
+	/** Queue the NPC's next tier crossing after Now (invalidates any queued one) */
+	void ScheduleNext(int32 Npc, double Now);
+
+	/** Time of the earliest queued crossing (may be stale) */
+	double GetNextEventTime() const
+	{
+		return Events.Num() > 0 ? Events.HeapTop().Time : TNumericLimits<double>::Max();
+	}
+
+	int32 GetQueuedEvents() const { return Events.Num(); }
+
+	/** Value after Hours of decay (no grace period, not locked) */
+	static float Decay(float Value, double Hours, const FRfsnRelationshipDecayParams& Params);
+
+	/** Hours of decay to take Value to Target, which must lie between Value and 0 (Max if it never gets there) */
+	static double HoursToReach(float Value, float Target, const FRfsnRelationshipDecayParams& Params);
+
+	/** Decay per game day at Value (URfsnRelationshipDecay's rate for Value's tier) */
+	static float GetDecayRatePerDay(float Value, const FRfsnRelationshipDecayParams& Params);
+
+private:
+	struct FEvent
+	{
+		double Time = 0.0;
+		int32 Npc = INDEX_NONE;
+		uint32 Generation = 0;
+
+		bool operator<(const FEvent& Other) const { return Time < Other.Time; }
+	};
+
+	// Per NPC
+	TArray<float> BaseValues;
+	TArray<double> BaseHours;
+	TArray<double> InteractionHours;
+	TArray<FRfsnRelationshipDecayParams> Params;
+	TBitArray<> Locked;
+	TArray<uint32> Generations;
+	TBitArray<> Active;
+	TArray<int32> FreeSlots;
+
+	TArray<FEvent> Events;
+
+	/** False once the NPC changed or was removed after the event was queued */
+	bool IsLive(const FEvent& Event) const
+	{
+		return IsValid(Event.Npc) && Generations[Event.Npc] == Event.Generation;
+	}
+
+	/** When decay starts (or started) for the NPC's base value */
+	double GetDecayStart(int32 Npc) const
+	{
+		return FMath::Max(BaseHours[Npc], InteractionHours[Npc] + Params[Npc].GracePeriodHours);
+	}
+
+	/** Fold elapsed decay into the base value so the value or times can change from Now */
+	void Rebase(int32 Npc, double Now);
+
+	/** Drop the events whose NPC changed or left since they were queued, and rebuild the heap */
+	void CompactEvents();
+
+	/** The stop of RfsnRelationship::Stops next reached when decaying from Value toward neutral */
+	static float GetNextStop(float Value);
+};
+
+/**
+ * World Subsystem that decays the relationships of all registered URfsnRelationshipDecay components.
+ * Nothing runs per NPC as time passes: values are computed when read, and components are called back only
+ * when their value decays into another tier. Time comes from URfsnGameClock (the next crossing is one clock
+ * timer), so game-time skips cost nothing until a crossing comes due.
+ */
+UCLASS()
+class MYPROJECT_API URfsnRelationshipDecayManager : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	/** Register a component with its current value, lock and settings. Returns a slot. */
+	int32 Register(URfsnRelationshipDecay* Relationship);
+	void Unregister(int32 Slot);
+
+	float GetValue(int32 Slot) const;
+	float GetHoursSinceInteraction(int32 Slot) const;
+
+	void SetValue(int32 Slot, float Value, bool bLocked);
+	void RecordInteraction(int32 Slot);
+
+	/** Decay one NPC by Hours without moving the clock */
+	void FastForward(int32 Slot, float Hours);
+
+	/** Re-read the component's decay settings */
+	void UpdateDecay(int32 Slot);
+
+	/**
+	 * Let Hours pass for every relationship, as TickDecay does for one. Only the relationships age: the game clock
+	 * and the schedules and needs timed by it are not moved (use URfsnGameClock::SetGameTime for that).
+	 */
+	UFUNCTION(BlueprintCallable, Category = "RFSN|Relationships")
+	void SkipTime(float Hours);
+
+	/** Current time in game hours */
+	double GetNow() const;
+
+	UFUNCTION(BlueprintPure, Category = "RFSN|Relationships")
+	int32 GetNumRegistered() const { return Ledger.Num(); }
+
+	// UWorldSubsystem
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void OnWorldBeginPlay(UWorld& InWorld) override;
+
+protected:
+	virtual void Deinitialize() override;
+
+private:
+	FRfsnRelationshipLedger Ledger;
+
+	/** Owner per slot */
+	TArray<TWeakObjectPtr<URfsnRelationshipDecay>> Components;
+
+	TArray<int32> DueSlots;
+
+	/** Game hours when there is no game clock (fixed; relationships then age only through FastForward) */
+	double LocalHours = 0.0;
+
+	TWeakObjectPtr<URfsnGameClock> Clock;
+	int32 EventTimer = INDEX_NONE;
+	double EventTimerHours = TNumericLimits<double>::Max();
+
+	/** Make sure the clock calls back by the earliest queued crossing */
+	void UpdateEventTimer();
+	void HandleEventTimer();
+	void ProcessDue();
+
+	UFUNCTION()
+	void HandleClockJumped();
+};
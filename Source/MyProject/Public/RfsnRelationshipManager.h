@@ -73,6 +73,10 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "RFSN|Relationships")
 	void UnregisterNpcClient(URfsnNpcClientComponent* Client);
 
+	/** Registered client with this NPC ID, or nullptr */
+	UFUNCTION(BlueprintPure, Category = "RFSN|Relationships")
+	URfsnNpcClientComponent* FindNpcClient(const FString& NpcId) const;
+
 	/** Modify affinity by delta (clamped -1 to 1) */
 	UFUNCTION(BlueprintCallable, Category = "RFSN|Relationships")
 	void ModifyAffinity(const FString& NpcId, float Delta);
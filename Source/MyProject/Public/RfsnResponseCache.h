@@ -0,0 +1,230 @@
+// RFSN Response Cache
+// Replays stored orchestrator replies for repeated utterances under the same NPC state
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/GameInstanceSubsystem.h"
+#include "RfsnNpcClientComponent.h"
+#include "RfsnResponseCache.generated.h"
+
+/** How a lookup was answered */
+enum class ERfsnCacheMatch : uint8
+{
+	None,
+	/** Same normalized utterance */
+	Exact,
+	/** Similar enough utterance (trigram overlap at or above the threshold) */
+	Approximate
+};
+
+USTRUCT(BlueprintType)
+struct FRfsnResponseCacheStats
+{
+	GENERATED_BODY()
+
+	UPROPERTY(BlueprintReadOnly, Category = "RFSN|Cache")
+	int32 Lookups = 0;
+
+	UPROPERTY(BlueprintReadOnly, Category = "RFSN|Cache")
+	int32 ExactHits = 0;
+
+	UPROPERTY(BlueprintReadOnly, Category = "RFSN|Cache")
+	int32 ApproximateHits = 0;
+
+	UPROPERTY(BlueprintReadOnly, Category = "RFSN|Cache")
+	int32 Misses = 0;
+
+	UPROPERTY(BlueprintReadOnly, Category = "RFSN|Cache")
+	int32 Stored = 0;
+
+	/** Dropped to stay under the entry limit, least recently used first */
+	UPROPERTY(BlueprintReadOnly, Category = "RFSN|Cache")
+	int32 Evicted = 0;
+
+	/** Dropped for outliving the time to live */
+	UPROPERTY(BlueprintReadOnly, Category = "RFSN|Cache")
+	int32 Expired = 0;
+
+	UPROPERTY(BlueprintReadOnly, Category = "RFSN|Cache")
+	int32 Entries = 0;
+
+	/** (ExactHits + ApproximateHits) / Lookups */
+	UPROPERTY(BlueprintReadOnly, Category = "RFSN|Cache")
+	float HitRate = 0.0f;
+};
+
+/** A reply as the orchestrator streamed it */
+struct FRfsnCachedResponse
+{
+	FString NpcId;
+	/** URfsnResponseCache::MakeContext of the NPC when it was asked */
+	uint32 Context = 0;
+	/** Normalized player utterance */
+	FString Utterance;
+
+	bool bHasMeta = false;
+	FRfsnDialogueMeta Meta;
+	TArray<FRfsnSentence> Sentences;
+	/** When each sentence arrived, in ms after the request was sent, so replays keep the pace */
+	TArray<float> SentenceOffsetsMs;
+
+	FDateTime StoredAt;
+	FDateTime LastUsedAt;
+	int32 Hits = 0;
+};
+
+/**
+ * World-independent core of the response cache.
+ * Entries are keyed by NPC, context fingerprint and normalized utterance. A lookup tries the exact key
+ * first, then compares character trigrams against the other utterances stored under the same NPC and
+ * context. Expired entries are dropped as they are found; past MaxEntries the least recently used go.
+ */
+struct MYPROJECT_API FRfsnResponseCacheStore
+{
+	/** Lowest trigram similarity (Dice coefficient, 0-1) an approximate match needs; 1 allows exact only */
+	float SimilarityThreshold = 0.85f;
+
+	FTimespan TimeToLive = FTimespan::FromHours(1.0);
+
+	int32 MaxEntries = 512;
+
+	/** Lower case, letters and digits only, single spaces: "What's going on?!" -> "whats going on" */
+	static FString NormalizeUtterance(FStringView Utterance);
+
+	/** Dice coefficient of the two normalized strings' character trigrams */
+	static float Similarity(FStringView A, FStringView B);
+
+	/**
+	 * Best stored reply for the utterance, or null; counts a hit or miss and refreshes the entry's use time.
+	 * The reply is only valid until the cache next changes.
+	 */
+	const FRfsnCachedResponse* Find(const FString& NpcId, uint32 Context, FStringView Utterance, FDateTime Now,
+	                                ERfsnCacheMatch* OutMatch = nullptr);
+
+	/** Store a reply (Utterance may be raw; it is normalized here), replacing one under the same key */
+	void Add(FRfsnCachedResponse&& Response, FDateTime Now);
+
+	/** Drop every entry older than TimeToLive; returns how many went */
+	int32 RemoveExpired(FDateTime Now);
+
+	void Reset();
+	void ResetStats();
+
+	int32 Num() const { return Entries.Num(); }
+	const FRfsnResponseCacheStats& GetStats() const { return Stats; }
+
+	/** Entries as JSON, for the on-disk copy */
+	FString ToJson() const;
+
+	/** Adds the entries in Json that haven't expired by Now; false if it doesn't parse */
+	bool FromJson(const FString& Json, FDateTime Now);
+
+private:
+	struct FEntry
+	{
+		FRfsnCachedResponse Response;
+		/** Sorted, unique trigrams of Response.Utterance */
+		TArray<uint64> Trigrams;
+	};
+
+	/** Entries by NPC, context and utterance */
+	TMap<FString, FEntry> Entries;
+	/** Keys of the entries under each NPC and context, for approximate matching */
+	TMap<uint32, TArray<FString>> Buckets;
+	FRfsnResponseCacheStats Stats;
+
+	static FString MakeKey(const FString& NpcId, uint32 Context, const FString& Utterance);
+	static uint32 MakeBucket(const FString& NpcId, uint32 Context);
+	static void MakeTrigrams(FStringView Normalized, TArray<uint64>& OutTrigrams);
+	static float Dice(const TArray<uint64>& A, const TArray<uint64>& B);
+
+	/** Add or replace without counting it as stored */
+	void Insert(FRfsnCachedResponse&& Response);
+	void RemoveEntry(const FString& Key);
+	bool IsExpired(const FEntry& Entry, FDateTime Now) const;
+	void EvictToLimit();
+	void UpdateDerivedStats();
+};
+
+/**
+ * Game Instance Subsystem that lets NPC clients answer near-repeated utterances ("hello", "who are you")
+ * from earlier replies instead of a full orchestrator round-trip. Replies are stored per NPC under a
+ * quantized fingerprint of mood, relationship tier, awareness and quest state, so a change in any of them
+ * asks the orchestrator again. The cache is kept in memory and, with bPersistToDisk, saved to
+ * Saved/ResponseCache between runs.
+ * Off by default: a cached turn never reaches the orchestrator, so its conversation memory misses that turn and
+ * the fingerprint doesn't cover the history the reply was written for. Enable it for NPCs whose small talk
+ * doesn't depend on what was said before, in [/Script/MyProject.RfsnResponseCache] in DefaultGame.ini.
+ */
+UCLASS(Config = Game)
+class MYPROJECT_API URfsnResponseCache : public UGameInstanceSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Deinitialize() override;
+
+	// ─────────────────────────────────────────────────────────────
+	// Configuration
+	// ─────────────────────────────────────────────────────────────
+
+	/** Serve and store replies at all */
+	UPROPERTY(Config, EditAnywhere, BlueprintReadWrite, Category = "RFSN|Cache")
+	bool bEnabled = false;
+
+	/** Lowest utterance similarity (0-1) that counts as a repeat; 1 = identical after normalizing only */
+	UPROPERTY(Config, EditAnywhere, BlueprintReadWrite, Category = "RFSN|Cache",
+	          meta = (ClampMin = "0.5", ClampMax = "1.0"))
+	float SimilarityThreshold = 0.85f;
+
+	/** Replies older than this are asked for again */
+	UPROPERTY(Config, EditAnywhere, BlueprintReadWrite, Category = "RFSN|Cache", meta = (ClampMin = "1.0"))
+	float TimeToLiveMinutes = 60.0f;
+
+	/** Most replies kept (least recently used go first) */
+	UPROPERTY(Config, EditAnywhere, BlueprintReadWrite, Category = "RFSN|Cache", meta = (ClampMin = "1"))
+	int32 MaxEntries = 512;
+
+	/** Load the cache on startup and save it on shutdown, so replies outlive the session they were given in */
+	UPROPERTY(Config, EditAnywhere, BlueprintReadWrite, Category = "RFSN|Cache")
+	bool bPersistToDisk = false;
+
+	// ─────────────────────────────────────────────────────────────
+	// API
+	// ─────────────────────────────────────────────────────────────
+
+	/** Quantized state of the NPC that shapes its replies */
+	static uint32 MakeContext(const URfsnNpcClientComponent* Client);
+
+	/** Stored reply for what the player said, or null; copy it before the cache changes again */
+	const FRfsnCachedResponse* Find(const FString& NpcId, uint32 Context, const FString& PlayerText);
+
+	/** Keep a reply the orchestrator streamed in full */
+	void Store(FRfsnCachedResponse&& Response);
+
+	UFUNCTION(BlueprintPure, Category = "RFSN|Cache")
+	FRfsnResponseCacheStats GetStats() const { return Cache.GetStats(); }
+
+	/** Hit rate and counts for display */
+	UFUNCTION(BlueprintPure, Category = "RFSN|Cache")
+	FString GetStatsString() const;
+
+	/** Forget every stored reply */
+	UFUNCTION(BlueprintCallable, Category = "RFSN|Cache")
+	void ClearCache();
+
+	UFUNCTION(BlueprintCallable, Category = "RFSN|Cache")
+	void SaveToDisk() const;
+
+	UFUNCTION(BlueprintCallable, Category = "RFSN|Cache")
+	bool LoadFromDisk();
+
+private:
+	FRfsnResponseCacheStore Cache;
+
+	/** Copy the configuration into the store */
+	void ApplySettings();
+	static FString GetSavePath();
+};
@@ -0,0 +1,231 @@
+// RFSN Significance Manager
+// Scales RFSN component tick rates by how relevant each NPC is to the player
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "Components/ActorComponent.h"
+#include "RfsnSignificanceManager.generated.h"
+
+/** Tick buckets, most to least relevant */
+UENUM(BlueprintType)
+enum class ERfsnSignificanceBucket : uint8
+{
+	Critical UMETA(DisplayName = "Critical"), // In dialogue or right next to the player
+	High UMETA(DisplayName = "High"),
+	Medium UMETA(DisplayName = "Medium"),
+	Low UMETA(DisplayName = "Low"),
+	Dormant UMETA(DisplayName = "Dormant") // Ticks off where the table allows it
+};
+
+/** What a score is built from */
+struct FRfsnSignificanceInputs
+{
+	float Distance = 0.0f;
+	bool bVisible = false;
+	bool bInDialogue = false;
+	/** 0 = unaware, 1 = hostile */
+	float Threat = 0.0f;
+};
+
+/** How scores are built and cut into buckets */
+USTRUCT(BlueprintType)
+struct FRfsnSignificanceSettings
+{
+	GENERATED_BODY()
+
+	/** Distance at which proximity stops contributing (cm) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Significance", meta = (ClampMin = "1.0"))
+	float MaxDistance = 5000.0f;
+
+	/** Score from proximity, scaled from 1 at the player to 0 at MaxDistance */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Significance", meta = (ClampMin = "0.0"))
+	float DistanceWeight = 0.6f;
+
+	/** Score for having been rendered recently */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Significance", meta = (ClampMin = "0.0"))
+	float VisibleWeight = 0.3f;
+
+	/** Score at full threat (awareness value, or hostile) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Significance", meta = (ClampMin = "0.0"))
+	float ThreatWeight = 0.4f;
+
+	/** Lowest score for Critical, High, Medium and Low; anything below Low is Dormant */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Significance")
+	float CriticalScore = 0.8f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Significance")
+	float HighScore = 0.55f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Significance")
+	float MediumScore = 0.3f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Significance")
+	float LowScore = 0.1f;
+
+	/** A bucket is left for a lower one only once the score is this far below its threshold */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Significance", meta = (ClampMin = "0.0"))
+	float Hysteresis = 0.05f;
+
+	/** Seconds a bucket is held before it may be left for a lower one (rides out visibility flicker) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Significance", meta = (ClampMin = "0.0"))
+	float MinDemotionDelay = 1.0f;
+
+	/** Score in [0, 1+]; dialogue always scores 1 */
+	float Score(const FRfsnSignificanceInputs& Inputs) const;
+
+	/** Bucket for Score. Promotions are immediate; Current is held until the score clears its threshold by
+	 *  Hysteresis and TimeInBucket reaches MinDemotionDelay. */
+	ERfsnSignificanceBucket SelectBucket(float Score, ERfsnSignificanceBucket Current, float TimeInBucket) const;
+
+	float GetThreshold(ERfsnSignificanceBucket Bucket) const;
+};
+
+/** Tick intervals one component class gets in each bucket */
+USTRUCT(BlueprintType)
+struct FRfsnSignificanceTickRow
+{
+	GENERATED_BODY()
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Significance")
+	TSubclassOf<UActorComponent> ComponentClass;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Significance", meta = (ClampMin = "0.0"))
+	float CriticalInterval = 0.016f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Significance", meta = (ClampMin = "0.0"))
+	float HighInterval = 0.033f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Significance", meta = (ClampMin = "0.0"))
+	float MediumInterval = 0.1f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Significance", meta = (ClampMin = "0.0"))
+	float LowInterval = 0.25f;
+
+	/** Turn the tick off in the Dormant bucket; otherwise it keeps LowInterval */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Significance")
+	bool bAllowDormant = true;
+
+	/** Interval for a non-dormant bucket */
+	float GetInterval(ERfsnSignificanceBucket Bucket) const;
+};
+
+USTRUCT(BlueprintType)
+struct FRfsnSignificanceStats
+{
+	GENERATED_BODY()
+
+	UPROPERTY(BlueprintReadOnly, Category = "Stats")
+	int32 Npcs = 0;
+
+	/** Managed components per bucket, indexed by ERfsnSignificanceBucket */
+	UPROPERTY(BlueprintReadOnly, Category = "Stats")
+	TArray<int32> ComponentsInBucket;
+
+	/** NPC bucket changes over the last second */
+	UPROPERTY(BlueprintReadOnly, Category = "Stats")
+	int32 ChangesPerSecond = 0;
+
+	/** Cost of the last scoring pass */
+	UPROPERTY(BlueprintReadOnly, Category = "Stats")
+	float LastPassMs = 0.0f;
+};
+
+/**
+ * World Subsystem that scores NPCs by distance to the player, visibility, dialogue and threat, and sets
+ * each RFSN component's tick interval from TickTable by the NPC's bucket. NPCs register through
+ * URfsnNpcClientComponent; every component on the actor whose class has a row is managed.
+ * Components that switched their own tick off are left off. "stat RfsnSignificance" shows the buckets.
+ * The configuration is read from [/Script/MyProject.RfsnSignificanceManager] in DefaultGame.ini; an
+ * ini TickTable replaces the built-in rows.
+ */
+UCLASS(Config = Game)
+class MYPROJECT_API URfsnSignificanceManager : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	URfsnSignificanceManager();
+
+	// ─────────────────────────────────────────────────────────────
+	// Configuration
+	// ─────────────────────────────────────────────────────────────
+
+	UPROPERTY(Config, EditAnywhere, BlueprintReadWrite, Category = "RFSN|Significance")
+	bool bEnabled = true;
+
+	/** Seconds between scoring passes */
+	UPROPERTY(Config, EditAnywhere, BlueprintReadWrite, Category = "RFSN|Significance", meta = (ClampMin = "0.0"))
+	float UpdateInterval = 0.25f;
+
+	/** Rendered within this many seconds counts as visible */
+	UPROPERTY(Config, EditAnywhere, BlueprintReadWrite, Category = "RFSN|Significance", meta = (ClampMin = "0.0"))
+	float VisibleTolerance = 0.2f;
+
+	UPROPERTY(Config, EditAnywhere, BlueprintReadWrite, Category = "RFSN|Significance")
+	FRfsnSignificanceSettings Settings;
+
+	/** Intervals per component class; the first row the component IsA wins */
+	UPROPERTY(Config, EditAnywhere, BlueprintReadWrite, Category = "RFSN|Significance")
+	TArray<FRfsnSignificanceTickRow> TickTable;
+
+	// ─────────────────────────────────────────────────────────────
+	// API
+	// ─────────────────────────────────────────────────────────────
+
+	void RegisterNpc(AActor* Npc);
+	void UnregisterNpc(AActor* Npc);
+
+	/** Current bucket of a registered NPC (Critical for unknown actors, so nothing is throttled by mistake) */
+	UFUNCTION(BlueprintPure, Category = "RFSN|Significance")
+	ERfsnSignificanceBucket GetBucket(AActor* Npc) const;
+
+	UFUNCTION(BlueprintPure, Category = "RFSN|Significance")
+	FRfsnSignificanceStats GetStats() const { return Stats; }
+
+	/** Row for a component class, or nullptr */
+	const FRfsnSignificanceTickRow* FindRow(const UClass* ComponentClass) const;
+
+	// UTickableWorldSubsystem
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+protected:
+	virtual void Deinitialize() override;
+
+private:
+	struct FManagedComponent
+	{
+		TWeakObjectPtr<UActorComponent> Component;
+		int32 Row = INDEX_NONE;
+		/** The component's own interval, read the first time a bucket is applied: at registration its BeginPlay
+		 *  may not have run yet */
+		float DefaultInterval = 0.0f;
+		bool bHasDefaultInterval = false;
+		/** Tick switched off by the manager (as opposed to by the component itself) */
+		bool bMadeDormant = false;
+	};
+
+	struct FNpc
+	{
+		TWeakObjectPtr<AActor> Actor;
+		TArray<FManagedComponent> Components;
+		ERfsnSignificanceBucket Bucket = ERfsnSignificanceBucket::Critical;
+		float Score = 1.0f;
+		double BucketSince = 0.0;
+	};
+
+	TMap<TWeakObjectPtr<AActor>, FNpc> Npcs;
+	FRfsnSignificanceStats Stats;
+
+	float TimeSinceUpdate = 0.0f;
+	float TimeSinceStatsReset = 0.0f;
+	int32 ChangesThisSecond = 0;
+
+	void EvaluateAll();
+	FRfsnSignificanceInputs GatherInputs(const AActor* Npc, const FVector& PlayerLocation) const;
+	void ApplyBucket(FNpc& Npc, ERfsnSignificanceBucket Bucket);
+	void Restore(FNpc& Npc);
+	void UpdateStats();
+};
@@ -0,0 +1,92 @@
+// RFSN Spatial Hash
+// Uniform 2D grid for broad-phase range queries over many NPCs
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Uniform XY hash grid of integer ids.
+ * Rebuilt from positions when they change; queries return candidates from every
+ * cell overlapping a circle, and the caller does the exact distance test.
+ */
+struct MYPROJECT_API FRfsnSpatialHashGrid
+{
+	explicit FRfsnSpatialHashGrid(float InCellSize = 1000.0f) { Reset(InCellSize); }
+
+	/** Remove all entries (keeps cell allocations when the size is unchanged) */
+	void Reset(float InCellSize);
+
+	/** Insert an id at a location */
+	void Add(int32 Id, const FVector& Location)
+	{
+		Cells.FindOrAdd(CellOf(Location)).Add(Id);
+		NumEntries++;
+	}
+
+	/** Remove an id previously added at Location */
+	void Remove(int32 Id, const FVector& Location);
+
+	/** Re-bucket an id that moved from From to To (no-op while it stays in the same cell) */
+	void Move(int32 Id, const FVector& From, const FVector& To)
+	{
+		if (CellOf(From) != CellOf(To))
+		{
+			Remove(Id, From);
+			Add(Id, To);
+		}
+	}
+
+	int32 Num() const { return NumEntries; }
+	float GetCellSize() const { return CellSize; }
+
+	/** Call Visitor(Id) for every entry in cells overlapping the circle around Center */
+	template <typename VisitorType>
+	void Query(const FVector& Center, float Radius, VisitorType&& Visitor) const
+	{
+		const FIntPoint Min = CellOf(Center - FVector(Radius, Radius, 0.0f));
+		const FIntPoint Max = CellOf(Center + FVector(Radius, Radius, 0.0f));
+		const int64 CellsInRange = static_cast<int64>(Max.X - Min.X + 1) * (Max.Y - Min.Y + 1);
+
+		// Huge radius: walking the occupied cells is cheaper than the covered ones
+		if (CellsInRange > Cells.Num())
+		{
+			for (const auto& Pair : Cells)
+			{
+				if (Pair.Key.X >= Min.X && Pair.Key.X <= Max.X && Pair.Key.Y >= Min.Y && Pair.Key.Y <= Max.Y)
+				{
+					for (const int32 Id : Pair.Value)
+					{
+						Visitor(Id);
+					}
+				}
+			}
+			return;
+		}
+
+		for (int32 Y = Min.Y; Y <= Max.Y; Y++)
+		{
+			for (int32 X = Min.X; X <= Max.X; X++)
+			{
+				if (const TArray<int32, TInlineAllocator<8>>* Cell = Cells.Find(FIntPoint(X, Y)))
+				{
+					for (const int32 Id : *Cell)
+					{
+						Visitor(Id);
+					}
+				}
+			}
+		}
+	}
+
+private:
+	float CellSize = 1000.0f;
+	float InvCellSize = 0.001f;
+	int32 NumEntries = 0;
+	TMap<FIntPoint, TArray<int32, TInlineAllocator<8>>> Cells;
+
+	FIntPoint CellOf(const FVector& Location) const
+	{
+		return FIntPoint(FMath::FloorToInt(Location.X * InvCellSize), FMath::FloorToInt(Location.Y * InvCellSize));
+	}
+};
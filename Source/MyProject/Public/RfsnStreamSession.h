@@ -0,0 +1,97 @@
+// RFSN Stream Session
+// Recorded dialogue traffic of one NPC (raw stream chunks with arrival times, HTTP and TTS payloads) for replay
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/** One recorded step of an NPC's dialogue traffic */
+enum class ERfsnSessionEvent : uint8
+{
+	/** Dialogue request sent; the payload is its JSON body */
+	Request,
+
+	/** Stream bytes that arrived in one progress callback */
+	Chunk,
+
+	/** Stream finished; the code is the HTTP status */
+	Complete,
+
+	/** Stream failed; the code is the HTTP status, 0 when there was no response */
+	Failed,
+
+	/** Stream cancelled before it finished */
+	Cancel,
+
+	/** TTS request sent; the payload is its JSON body */
+	TtsRequest,
+
+	/** TTS reply; the code is the HTTP status, the payload its body */
+	TtsResponse,
+
+	Num
+};
+
+struct FRfsnSessionEvent
+{
+	ERfsnSessionEvent Type = ERfsnSessionEvent::Chunk;
+
+	/** Microseconds since the recording started */
+	int64 TimeUs = 0;
+
+	int32 Code = 0;
+	TArray<uint8> Payload;
+
+	bool operator==(const FRfsnSessionEvent& Other) const
+	{
+		return Type == Other.Type && TimeUs == Other.TimeUs && Code == Other.Code && Payload == Other.Payload;
+	}
+};
+
+/** What the client made of a session's streams; recorded live and compared after playback */
+struct FRfsnSessionTally
+{
+	int32 Dialogues = 0;
+	int32 Metas = 0;
+	int32 Sentences = 0;
+	int32 Errors = 0;
+
+	bool operator==(const FRfsnSessionTally& Other) const
+	{
+		return Dialogues == Other.Dialogues && Metas == Other.Metas && Sentences == Other.Sentences &&
+		       Errors == Other.Errors;
+	}
+};
+
+/**
+ * A recorded session, replayable by URfsnNpcClientComponent without an orchestrator.
+ * Files are compact: event times and sizes are stored as packed deltas and the whole session is zlib-compressed
+ * behind a header carrying its size and CRC.
+ */
+struct MYPROJECT_API FRfsnStreamSession
+{
+	FString NpcId;
+	TArray<FRfsnSessionEvent> Events;
+	FRfsnSessionTally Tally;
+
+	void Add(ERfsnSessionEvent Type, int64 TimeUs, const uint8* Data, int32 Size, int32 Code = 0);
+
+	/** Add with Text as the UTF-8 payload */
+	void Add(ERfsnSessionEvent Type, int64 TimeUs, const FString& Text, int32 Code = 0);
+
+	bool IsEmpty() const { return Events.Num() == 0; }
+	int64 GetDurationUs() const { return Events.Num() > 0 ? Events.Last().TimeUs : 0; }
+	int64 GetPayloadBytes() const;
+
+	/** File image of the session; empty if compression failed */
+	TArray<uint8> ToBytes() const;
+
+	/** Replace this session with a file image; false (and left empty) if it is not a valid session */
+	bool FromBytes(const TArray<uint8>& Bytes);
+
+	bool SaveToFile(const FString& Path) const;
+	bool LoadFromFile(const FString& Path);
+
+	/** Saved/Profiling/RfsnSessions/<Name>.rfsnsession */
+	static FString GetDefaultPath(const FString& Name);
+};
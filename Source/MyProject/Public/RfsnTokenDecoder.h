@@ -0,0 +1,238 @@
+// RFSN Token Decoder
+// Perfect-hash decoding of NPC action names, emotion labels and mood words, from TCHAR or UTF-8 text
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "RfsnEmotionBlend.h"
+#include "RfsnNpcClientComponent.h"
+
+/** Mood words the action lattice reacts to */
+enum class ERfsnMoodFlags : uint8
+{
+	None = 0,
+	Hostile = 1 << 0,
+	Angry = 1 << 1,
+	Fearful = 1 << 2,
+	Cautious = 1 << 3,
+	Friendly = 1 << 4
+};
+ENUM_CLASS_FLAGS(ERfsnMoodFlags);
+
+/** A mood string ("Intensely Anger", "Friendly", "Cautious but friendly") decoded word by word */
+struct FRfsnMoodToken
+{
+	/** First word that names an emotion (Neutral if none does) */
+	ERfsnCoreEmotion Emotion = ERfsnCoreEmotion::Neutral;
+	ERfsnMoodFlags Flags = ERfsnMoodFlags::None;
+
+	bool Has(ERfsnMoodFlags Flag) const { return EnumHasAnyFlags(Flags, Flag); }
+};
+
+namespace RfsnTokens
+{
+/** A keyword, stored lower case; matching is ASCII case-insensitive */
+struct FKeyword
+{
+	const char* Name;
+	int32 Len;
+	uint8 Value;
+};
+
+constexpr int32 ConstLen(const char* Name)
+{
+	int32 Len = 0;
+	while (Name[Len])
+	{
+		Len++;
+	}
+	return Len;
+}
+
+template <typename EnumType> constexpr FKeyword Keyword(const char* Name, EnumType Value)
+{
+	return {Name, ConstLen(Name), static_cast<uint8>(Value)};
+}
+
+template <typename CharType> constexpr uint32 Fold(CharType C)
+{
+	const uint32 Code = static_cast<uint32>(C);
+	return Code >= 'A' && Code <= 'Z' ? Code + ('a' - 'A') : Code;
+}
+
+/** Length plus first, middle and last character; the seed is picked at compile time so no two keywords collide */
+template <typename CharType> constexpr uint32 Hash(const CharType* Text, int32 Len, uint32 Seed)
+{
+	uint32 H = Seed ^ (static_cast<uint32>(Len) * 0x9E3779B1u);
+	H = (H ^ Fold(Text[0])) * 0x01000193u;
+	H = (H ^ Fold(Text[Len / 2])) * 0x01000193u;
+	H = (H ^ Fold(Text[Len - 1])) * 0x01000193u;
+	return H ^ (H >> 15);
+}
+
+/** Keyword table with a collision-free slot per keyword */
+template <int32 NumKeywords, int32 NumSlots> struct TPerfectHash
+{
+	static_assert((NumSlots & (NumSlots - 1)) == 0, "NumSlots must be a power of two");
+	static_assert(NumKeywords < 255, "Slots hold keyword indices as uint8");
+
+	FKeyword Keywords[NumKeywords] = {};
+	uint8 Slots[NumSlots] = {};
+	uint32 Seed = 0;
+	int32 MaxLen = 0;
+	bool bValid = false;
+
+	constexpr explicit TPerfectHash(const FKeyword (&InKeywords)[NumKeywords])
+	{
+		for (int32 i = 0; i < NumKeywords; i++)
+		{
+			Keywords[i] = InKeywords[i];
+			MaxLen = Keywords[i].Len > MaxLen ? Keywords[i].Len : MaxLen;
+		}
+
+		for (uint32 Candidate = 1; Candidate < 4096 && !bValid; Candidate++)
+		{
+			for (uint8& Slot : Slots)
+			{
+				Slot = 0xFF;
+			}
+
+			bValid = true;
+			for (int32 i = 0; i < NumKeywords && bValid; i++)
+			{
+				uint8& Slot = Slots[Hash(Keywords[i].Name, Keywords[i].Len, Candidate) & (NumSlots - 1)];
+				bValid = Slot == 0xFF;
+				Slot = static_cast<uint8>(i);
+			}
+			Seed = Candidate;
+		}
+	}
+
+	/** Index of the keyword Text spells (any ASCII case), or INDEX_NONE: one hash and one compare */
+	template <typename CharType> constexpr int32 Find(const CharType* Text, int32 Len) const
+	{
+		if (Len <= 0 || Len > MaxLen)
+		{
+			return INDEX_NONE;
+		}
+
+		const uint8 Slot = Slots[Hash(Text, Len, Seed) & (NumSlots - 1)];
+		if (Slot == 0xFF || Keywords[Slot].Len != Len)
+		{
+			return INDEX_NONE;
+		}
+
+		for (int32 i = 0; i < Len; i++)
+		{
+			if (Fold(Text[i]) != static_cast<uint32>(Keywords[Slot].Name[i]))
+			{
+				return INDEX_NONE;
+			}
+		}
+		return Slot;
+	}
+};
+
+template <int32 NumSlots, int32 NumKeywords>
+constexpr TPerfectHash<NumKeywords, NumSlots> MakePerfectHash(const FKeyword (&Keywords)[NumKeywords])
+{
+	return TPerfectHash<NumKeywords, NumSlots>(Keywords);
+}
+
+// Every ERfsnNpcAction by name, as the orchestrator sends them
+constexpr FKeyword ActionKeywords[] = {
+    Keyword("greet", ERfsnNpcAction::Greet),         Keyword("warn", ERfsnNpcAction::Warn),
+    Keyword("idle", ERfsnNpcAction::Idle),           Keyword("flee", ERfsnNpcAction::Flee),
+    Keyword("attack", ERfsnNpcAction::Attack),       Keyword("trade", ERfsnNpcAction::Trade),
+    Keyword("offer", ERfsnNpcAction::Offer),         Keyword("talk", ERfsnNpcAction::Talk),
+    Keyword("apologize", ERfsnNpcAction::Apologize), Keyword("threaten", ERfsnNpcAction::Threaten),
+    Keyword("explain", ERfsnNpcAction::Explain),     Keyword("answer", ERfsnNpcAction::Answer),
+    Keyword("inquire", ERfsnNpcAction::Inquire),     Keyword("help", ERfsnNpcAction::Help),
+    Keyword("request", ERfsnNpcAction::Request),     Keyword("agree", ERfsnNpcAction::Agree),
+    Keyword("disagree", ERfsnNpcAction::Disagree),   Keyword("accept", ERfsnNpcAction::Accept),
+    Keyword("refuse", ERfsnNpcAction::Refuse),       Keyword("ignore", ERfsnNpcAction::Ignore),
+};
+
+// Core emotion labels and the synonyms URfsnEmotionBlend has always accepted
+constexpr FKeyword EmotionKeywords[] = {
+    Keyword("joy", ERfsnCoreEmotion::Joy),
+    Keyword("happy", ERfsnCoreEmotion::Joy),
+    Keyword("happiness", ERfsnCoreEmotion::Joy),
+    Keyword("trust", ERfsnCoreEmotion::Trust),
+    Keyword("calm", ERfsnCoreEmotion::Trust),
+    Keyword("fear", ERfsnCoreEmotion::Fear),
+    Keyword("scared", ERfsnCoreEmotion::Fear),
+    Keyword("afraid", ERfsnCoreEmotion::Fear),
+    Keyword("surprise", ERfsnCoreEmotion::Surprise),
+    Keyword("surprised", ERfsnCoreEmotion::Surprise),
+    Keyword("shock", ERfsnCoreEmotion::Surprise),
+    Keyword("sadness", ERfsnCoreEmotion::Sadness),
+    Keyword("sad", ERfsnCoreEmotion::Sadness),
+    Keyword("sorrow", ERfsnCoreEmotion::Sadness),
+    Keyword("disgust", ERfsnCoreEmotion::Disgust),
+    Keyword("disgusted", ERfsnCoreEmotion::Disgust),
+    Keyword("anger", ERfsnCoreEmotion::Anger),
+    Keyword("angry", ERfsnCoreEmotion::Anger),
+    Keyword("rage", ERfsnCoreEmotion::Anger),
+    Keyword("anticipation", ERfsnCoreEmotion::Anticipation),
+    Keyword("excited", ERfsnCoreEmotion::Anticipation),
+    Keyword("eager", ERfsnCoreEmotion::Anticipation),
+    Keyword("neutral", ERfsnCoreEmotion::Neutral),
+};
+
+constexpr FKeyword MoodKeywords[] = {
+    Keyword("hostile", ERfsnMoodFlags::Hostile),   Keyword("angry", ERfsnMoodFlags::Angry),
+    Keyword("fearful", ERfsnMoodFlags::Fearful),   Keyword("cautious", ERfsnMoodFlags::Cautious),
+    Keyword("friendly", ERfsnMoodFlags::Friendly),
+};
+
+constexpr auto ActionTable = MakePerfectHash<64>(ActionKeywords);
+constexpr auto EmotionTable = MakePerfectHash<64>(EmotionKeywords);
+constexpr auto MoodTable = MakePerfectHash<16>(MoodKeywords);
+
+static_assert(ActionTable.bValid && EmotionTable.bValid && MoodTable.bValid, "No collision-free seed found");
+} // namespace RfsnTokens
+
+/**
+ * Decoders for the dialogue stream's tokens, shared by the NPC client, URfsnReplicatedDialogue,
+ * URfsnActionLattice and URfsnEmotionBlend. Names resolve with one hash and one compare, case-insensitively,
+ * straight from TCHAR or UTF-8 text, so nothing is lowered or copied first.
+ */
+struct MYPROJECT_API FRfsnTokenDecoder
+{
+	static bool TryDecodeAction(FStringView Name, ERfsnNpcAction& OutAction);
+	static bool TryDecodeAction(FUtf8StringView Name, ERfsnNpcAction& OutAction);
+
+	/** Unknown names are Talk, as the orchestrator's fallback action */
+	template <typename CharType> static ERfsnNpcAction DecodeAction(TStringView<CharType> Name)
+	{
+		ERfsnNpcAction Action = ERfsnNpcAction::Talk;
+		TryDecodeAction(Name, Action);
+		return Action;
+	}
+
+	static bool TryDecodeEmotion(FStringView Name, ERfsnCoreEmotion& OutEmotion);
+	static bool TryDecodeEmotion(FUtf8StringView Name, ERfsnCoreEmotion& OutEmotion);
+
+	/** Unknown names are Neutral */
+	template <typename CharType> static ERfsnCoreEmotion DecodeEmotion(TStringView<CharType> Name)
+	{
+		ERfsnCoreEmotion Emotion = ERfsnCoreEmotion::Neutral;
+		TryDecodeEmotion(Name, Emotion);
+		return Emotion;
+	}
+
+	/** Splits on anything that isn't a letter and decodes each word */
+	static FRfsnMoodToken DecodeMood(FStringView Mood);
+
+	/** Display names ("Greet", "Anger") */
+	static const TCHAR* GetActionName(ERfsnNpcAction Action);
+	static const TCHAR* GetEmotionName(ERfsnCoreEmotion Emotion);
+
+	/**
+	 * Raw value of the first "Key": "value" pair in UTF-8 JSON, found without parsing the rest. Escapes are
+	 * left as they are, so this is for flat events and token values, not free text. False if the key is
+	 * missing or its value isn't a string.
+	 */
+	static bool FindJsonString(FUtf8StringView Json, FUtf8StringView Key, FUtf8StringView& OutValue);
+};
@@ -0,0 +1,59 @@
+// RFSN Trace
+// Unreal Insights channel, CPU scopes, counters and bookmarks for the RFSN client stack
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Trace/Trace.h"
+#include "ProfilingDebugging/CountersTrace.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+#include "ProfilingDebugging/MiscTrace.h"
+
+// ─────────────────────────────────────────────────────────────
+// Channel
+// Enable with -trace=cpu,counters,bookmark,rfsn (or Trace.Enable Rfsn at runtime).
+// Scopes and bookmarks cost one branch while the channel is off.
+// ─────────────────────────────────────────────────────────────
+
+UE_TRACE_CHANNEL_EXTERN(RfsnChannel, MYPROJECT_API);
+
+// ─────────────────────────────────────────────────────────────
+// Counters (shown under Rfsn/ in the Insights counters panel)
+// ─────────────────────────────────────────────────────────────
+
+// HTTP requests started through URfsnHttpPool and not yet completed
+TRACE_DECLARE_INT_COUNTER_EXTERN(RfsnInFlightRequests);
+
+// Requests created by URfsnHttpPool since startup
+TRACE_DECLARE_INT_COUNTER_EXTERN(RfsnPooledRequests);
+
+// Dialogue SSE streams currently open
+TRACE_DECLARE_INT_COUNTER_EXTERN(RfsnActiveStreams);
+
+// Sentences received and waiting to be shown by a URfsnDialogueWidget
+TRACE_DECLARE_INT_COUNTER_EXTERN(RfsnQueuedSentences);
+
+// Witnessed events alive in URfsnWitnessSystem
+TRACE_DECLARE_INT_COUNTER_EXTERN(RfsnWitnessEvents);
+
+// ─────────────────────────────────────────────────────────────
+// Macros
+// ─────────────────────────────────────────────────────────────
+
+// CPU scope on the RFSN channel; Name is an identifier (RFSN_TRACE_SCOPE(RfsnClient_StreamProgress))
+#define RFSN_TRACE_SCOPE(Name) TRACE_CPUPROFILER_EVENT_SCOPE_ON_CHANNEL(Name, RfsnChannel)
+
+// Counter updates (counters have their own channel, so these are free while it is off)
+#define RFSN_TRACE_COUNTER_SET(Counter, Value) TRACE_COUNTER_SET(Counter, Value)
+#define RFSN_TRACE_COUNTER_ADD(Counter, Amount) TRACE_COUNTER_ADD(Counter, Amount)
+#define RFSN_TRACE_COUNTER_SUBTRACT(Counter, Amount) TRACE_COUNTER_SUBTRACT(Counter, Amount)
+
+// Bookmark for dialogue lifecycle events, only while the RFSN channel is on
+#define RFSN_TRACE_BOOKMARK(Format, ...)                                                                               \
+	do                                                                                                                 \
+	{                                                                                                                  \
+		if (UE_TRACE_CHANNELEXPR_IS_ENABLED(RfsnChannel))                                                              \
+		{                                                                                                              \
+			TRACE_BOOKMARK(Format, ##__VA_ARGS__);                                                                     \
+		}                                                                                                              \
+	} while (0)
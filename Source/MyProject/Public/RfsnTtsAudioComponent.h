@@ -10,6 +10,8 @@
 
 class UAudioComponent;
 class USoundWaveProcedural;
+struct FRfsnLipSyncTrack;
+enum class ERfsnViseme : uint8;
 
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnTtsAudioStarted, const FString&, Sentence);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE(FOnTtsAudioFinished);
@@ -47,6 +49,10 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "TTS|Audio")
 	bool bEnableQueue = true;
 
+	/** Analyze each clip's PCM for lip sync (only when the owner has a URfsnLipSync) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "TTS|Audio")
+	bool bAnalyzeForLipSync = true;
+
 	// ─────────────────────────────────────────────────────────────
 	// Events
 	// ─────────────────────────────────────────────────────────────
@@ -77,6 +83,13 @@ public:
 	UFUNCTION(BlueprintPure, Category = "TTS")
 	bool IsPlaying() const;
 
+	/** Seconds since the current clip started */
+	UFUNCTION(BlueprintPure, Category = "TTS")
+	float GetPlaybackTime() const;
+
+	/** Sample the current clip's lip sync track. False until analysis has finished. */
+	bool SampleLipSync(float& OutAmplitude, ERfsnViseme& OutViseme) const;
+
 protected:
 	virtual void BeginPlay() override;
 	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
@@ -88,6 +101,17 @@ private:
 	TArray<TPair<FString, TArray<uint8>>> AudioQueue;
 	bool bIsPlaying = false;
 
+	/** Lip sync analysis of the current clip (built on a worker thread) */
+	TSharedPtr<const FRfsnLipSyncTrack, ESPMode::ThreadSafe> LipSyncTrack;
+
+	/** Audio time the current clip started */
+	double PlaybackStartTime = 0.0;
+
+	/** Incremented per clip so late analysis results for older clips are dropped */
+	uint32 ClipSerial = 0;
+
+	void StartLipSyncAnalysis(const TArray<uint8>& PCMData, int32 SampleRate);
+
 	UFUNCTION()
 	void OnRfsnSentence(const FRfsnSentence& Sentence);
 
@@ -230,6 +230,9 @@ public:
 	UFUNCTION(BlueprintPure, Category = "Router")
 	FString GetUsageStats() const;
 
+	/** Deliver a TTS backend reply, live or played back from a recorded session; Code 0 means no response */
+	void HandleTtsResponse(int32 Code, const FString& Body);
+
 protected:
 	virtual void BeginPlay() override;
 
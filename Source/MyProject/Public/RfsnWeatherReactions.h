@@ -80,9 +80,13 @@ DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnWeatherChanged, ERfsnWeatherType
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnTimeOfDayChanged, ERfsnTimeOfDay, NewTime, ERfsnTimeOfDay, OldTime);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnWeatherReaction, ERfsnWeatherReaction, Reaction);
 
+class URfsnWorldEnvironment;
+
 /**
  * Weather Reactions Component
  * NPCs react to environmental conditions
+ * Weather and time of day come from URfsnWorldEnvironment, which evaluates every NPC's reaction in one batch
+ * when they change; the component doesn't tick.
  */
 UCLASS(ClassGroup = (Custom), meta = (BlueprintSpawnableComponent))
 class MYPROJECT_API URfsnWeatherReactions : public UActorComponent
@@ -104,8 +108,8 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Weather|Config")
 	bool bSeeksShelter = true;
 
-	/** Is this NPC currently indoors? */
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Weather|Config")
+	/** Is this NPC currently indoors? Read-only at runtime: change it with SetIndoors so the reaction updates. */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Weather|Config")
 	bool bIsIndoors = false;
 
 	/** Shelter location (if seeking shelter) */
@@ -128,7 +132,7 @@ public:
 	UPROPERTY(BlueprintReadOnly, Category = "Weather|State")
 	ERfsnTimeOfDay CurrentTimeOfDay = ERfsnTimeOfDay::Morning;
 
-	/** Current game hour (0-24) */
+	/** Game hour (0-24) at the last time-of-day update */
 	UPROPERTY(BlueprintReadOnly, Category = "Weather|State")
 	float CurrentHour = 12.0f;
 
@@ -157,14 +161,28 @@ public:
 	// API
 	// ─────────────────────────────────────────────────────────────
 
-	/** Set current weather (usually called by game weather system) */
+	/**
+	 * Set the weather for the whole world, not just this NPC: every NPC's reaction changes. Same as
+	 * URfsnWorldEnvironment::SetWeather; the NPC only keeps its own weather when there is no environment subsystem
+	 */
 	UFUNCTION(BlueprintCallable, Category = "Weather")
 	void SetWeather(ERfsnWeatherType NewWeather);
 
-	/** Set current game time */
+	/**
+	 * Advance the whole world's game time, not just this NPC's, to Hour of the current day; see
+	 * URfsnWorldEnvironment::AdvanceToHour. An hour already passed is ignored, never a jump to tomorrow
+	 */
 	UFUNCTION(BlueprintCallable, Category = "Weather")
 	void SetGameTime(float Hour);
 
+	/** Move the NPC indoors or outdoors and update its reaction */
+	UFUNCTION(BlueprintCallable, Category = "Weather")
+	void SetIndoors(bool bInIndoors);
+
+	/** Re-read Preferences and bSeeksShelter after changing them at runtime */
+	UFUNCTION(BlueprintCallable, Category = "Weather")
+	void RefreshPreferences();
+
 	/** Get NPC's feeling about current weather */
 	UFUNCTION(BlueprintPure, Category = "Weather")
 	float GetWeatherFeeling() const;
@@ -197,16 +215,20 @@ public:
 	UFUNCTION(BlueprintPure, Category = "Weather")
 	static FString TimeOfDayToString(ERfsnTimeOfDay Time);
 
+	/** Called by URfsnWorldEnvironment */
+	void HandleWeatherChanged(ERfsnWeatherType NewWeather);
+	void HandleTimeChanged(float Hour, ERfsnTimeOfDay NewTime);
+	void HandleReaction(ERfsnWeatherReaction NewReaction, bool bNewShouldSeekShelter);
+
 protected:
 	virtual void BeginPlay() override;
-	virtual void TickComponent(float DeltaTime, ELevelTick TickType,
-	                           FActorComponentTickFunction* ThisTickFunction) override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 
 private:
-	/** Update time of day from hour */
-	void UpdateTimeOfDay();
+	TWeakObjectPtr<URfsnWorldEnvironment> Environment;
+	int32 EnvironmentSlot = INDEX_NONE;
 
-	/** Calculate current reaction */
+	/** Calculate current reaction (without a world environment) */
 	void UpdateReaction();
 
 	/** Get preference for weather type */
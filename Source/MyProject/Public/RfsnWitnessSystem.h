@@ -6,6 +6,7 @@
 
 #include "CoreMinimal.h"
 #include "Subsystems/GameInstanceSubsystem.h"
+#include "RfsnSpatialHash.h"
 #include "RfsnWitnessSystem.generated.h"
 
 class URfsnNpcClientComponent;
@@ -133,6 +134,155 @@ struct FRfsnEventKnowledge
 	int32 ShareCount = 0;
 };
 
+/** A rumor passed along one contact during FRfsnKnowledgeMatrix::TickSpread */
+struct FRfsnRumorSpread
+{
+	int32 FromNpc = INDEX_NONE;
+	int32 ToNpc = INDEX_NONE;
+	int32 Event = INDEX_NONE;
+};
+
+/**
+ * World-independent core of the witness system.
+ * What NPCs know is a dense NPC x event bitset (a row of 64-bit words per NPC), with a second bitset for
+ * what each NPC is willing to pass on; accuracy, opinion and share counts live in a sparse per-cell map.
+ * NPCs within ContactRadius of each other form a contact graph, recomputed only around NPCs that moved,
+ * and rumors travel along its edges a word of events at a time.
+ */
+struct MYPROJECT_API FRfsnKnowledgeMatrix
+{
+	/** What one NPC knows about one event */
+	struct FCell
+	{
+		/** 1.0 = saw it, less with every hop */
+		float Accuracy = 1.0f;
+		float Opinion = 0.0f;
+		/** NPC it was heard from, INDEX_NONE if witnessed */
+		int32 SourceNpc = INDEX_NONE;
+		int32 ShareCount = 0;
+	};
+
+	/** Distance within which two NPCs talk (cm) */
+	float ContactRadius = 500.0f;
+
+	/** How far an NPC may move before its contacts are recomputed (cm) */
+	float ContactSlack = 50.0f;
+
+	/** Rumors an NPC passes along one contact per spread (0 = everything it will gossip) */
+	int32 MaxRumorsPerContact = 1;
+
+	int32 AddNpc();
+	int32 NumNpcs() const { return Npcs.Num(); }
+
+	/** New event column (freed columns are reused) */
+	int32 AddEvent();
+	/** Forget an event everywhere and free its column */
+	void RemoveEvent(int32 Event);
+	/** Inactive (expired) events stay known but are no longer listed or spread */
+	void SetEventActive(int32 Event, bool bActive);
+	bool IsEventActive(int32 Event) const { return TestBit(ActiveBits, 0, Event); }
+	/** Columns in use or free; valid events are below this */
+	int32 NumEventColumns() const { return NumColumns; }
+
+	bool Knows(int32 Npc, int32 Event) const { return TestBit(KnownBits, Npc * WordsPerRow, Event); }
+	bool WillGossip(int32 Npc, int32 Event) const { return TestBit(GossipBits, Npc * WordsPerRow, Event); }
+	const FCell* FindCell(int32 Npc, int32 Event) const { return Cells.Find(CellKey(Npc, Event)); }
+	FCell* FindCell(int32 Npc, int32 Event) { return Cells.Find(CellKey(Npc, Event)); }
+
+	/** Npc now knows Event; false (and nothing changes) if it already did */
+	bool Learn(int32 Npc, int32 Event, const FCell& Cell, bool bWillGossip);
+
+	/** Visitor(Event) for every active event Npc knows, in column order */
+	template <typename VisitorType> void ForEachKnown(int32 Npc, VisitorType&& Visitor) const
+	{
+		const uint64* Row = KnownBits.GetData() + Npc * WordsPerRow;
+		for (int32 Word = 0; Word < WordsPerRow; Word++)
+		{
+			for (uint64 Bits = Row[Word] & ActiveBits[Word]; Bits; Bits &= Bits - 1)
+			{
+				Visitor(Word * 64 + static_cast<int32>(FMath::CountTrailingZeros64(Bits)));
+			}
+		}
+	}
+
+	/** Place an NPC; its contacts are recomputed on the next UpdateContacts once it moved past ContactSlack */
+	void SetNpcLocation(int32 Npc, const FVector& Location);
+	/** Take an NPC out of the contact graph (it keeps what it knows) */
+	void ClearNpcLocation(int32 Npc);
+	bool HasLocation(int32 Npc) const { return Npcs[Npc].bPlaced; }
+
+	/** Recompute the contacts of every NPC that moved */
+	void UpdateContacts();
+	/** Contacts of an NPC, sorted */
+	const TArray<int32>& GetContacts(int32 Npc) const { return Npcs[Npc].Contacts; }
+
+	/** Visitor(Npc) for every placed NPC within Radius of Center */
+	template <typename VisitorType> void QueryNpcs(const FVector& Center, float Radius, VisitorType&& Visitor) const
+	{
+		Grid.Query(Center, Radius + ContactSlack,
+		           [this, &Center, Radius, &Visitor](int32 Npc)
+		           {
+			           if (FVector::DistSquared(Npcs[Npc].Location, Center) <= Radius * Radius)
+			           {
+				           Visitor(Npc);
+			           }
+		           });
+	}
+
+	/**
+	 * One round of gossip. Each NPC, in order, talks to each contact with probability Chance and passes on
+	 * up to MaxRumorsPerContact active events it will gossip and the contact doesn't know, oldest column
+	 * first. The listener learns at the teller's accuracy less AccuracyDecay (at least 0.1) and will gossip
+	 * it on with probability GossipChance.
+	 */
+	void TickSpread(FRandomStream& Random, float Chance, float GossipChance, float AccuracyDecay,
+	                TArray<FRfsnRumorSpread>& OutSpreads);
+
+	/** Bytes held by the bitsets, cells and contact graph */
+	SIZE_T GetAllocatedSize() const;
+
+private:
+	struct FNpc
+	{
+		FVector Location = FVector::ZeroVector;
+		/** Where the contacts (and grid cell) were last computed */
+		FVector ContactLocation = FVector::ZeroVector;
+		TArray<int32> Contacts;
+		bool bPlaced = false;
+		bool bDirty = false;
+	};
+
+	TArray<FNpc> Npcs;
+	TArray<int32> DirtyNpcs;
+	FRfsnSpatialHashGrid Grid;
+
+	int32 WordsPerRow = 0;
+	int32 NumColumns = 0;
+	TArray<int32> FreeColumns;
+	TArray<uint64> KnownBits;
+	TArray<uint64> GossipBits;
+	TArray<uint64> ActiveBits;
+	TMap<uint64, FCell> Cells;
+
+	static uint64 CellKey(int32 Npc, int32 Event)
+	{
+		return static_cast<uint64>(Npc) << 32 | static_cast<uint32>(Event);
+	}
+
+	bool TestBit(const TArray<uint64>& Bits, int32 RowStart, int32 Bit) const
+	{
+		return Bit >= 0 && Bit < NumColumns && (Bits[RowStart + Bit / 64] >> (Bit % 64) & 1) != 0;
+	}
+
+	/** ContactRadius the current edges were built with */
+	float LinkedRadius = -1.0f;
+
+	void GrowColumns();
+	void MarkDirty(int32 Npc);
+	void Unlink(int32 Npc);
+	void Link(int32 Npc);
+};
+
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnEventWitnessed, const FRfsnWitnessEvent&, Event, const FString&,
                                              WitnessNpcId);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_ThreeParams(FOnRumorSpread, const FGuid&, EventId, const FString&, FromNpc,
@@ -140,7 +290,8 @@ DECLARE_DYNAMIC_MULTICAST_DELEGATE_ThreeParams(FOnRumorSpread, const FGuid&, Eve
 
 /**
  * Witness System Subsystem
- * Tracks player actions witnessed by NPCs and manages rumor spreading
+ * Tracks player actions witnessed by NPCs and manages rumor spreading.
+ * NPC clients register themselves; knowledge and the contact graph live in an FRfsnKnowledgeMatrix.
  */
 UCLASS()
 class MYPROJECT_API URfsnWitnessSystem : public UGameInstanceSubsystem
@@ -163,6 +314,18 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Witness|Config")
 	float RumorSpreadChance = 0.1f;
 
+	/** NPCs closer than this can pass rumors to each other */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Witness|Config")
+	float ConversationDistance = 500.0f;
+
+	/** Rumors one NPC passes to one contact per tick (0 = everything it will gossip) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Witness|Config", meta = (ClampMin = "0"))
+	int32 RumorsPerContact = 1;
+
+	/** Chance an NPC who learns of an event will pass it on (0-1) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Witness|Config")
+	float GossipChance = 0.7f;
+
 	/** How much accuracy degrades per rumor hop */
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Witness|Config")
 	float AccuracyDecayPerHop = 0.15f;
@@ -191,6 +354,11 @@ public:
 	// API
 	// ─────────────────────────────────────────────────────────────
 
+	/** Make an NPC a possible witness and gossip (done by URfsnNpcClientComponent) */
+	void RegisterNpcClient(URfsnNpcClientComponent* Client);
+	/** The NPC stops witnessing and gossiping but keeps what it knows */
+	void UnregisterNpcClient(URfsnNpcClientComponent* Client);
+
 	/** Record a player action that can be witnessed */
 	UFUNCTION(BlueprintCallable, Category = "Witness")
 	FGuid RecordPlayerAction(ERfsnWitnessEventType EventType, const FString& Description, FVector Location,
@@ -241,12 +409,49 @@ private:
 	UPROPERTY()
 	TArray<FRfsnWitnessEvent> AllEvents;
 
-	/** NPC knowledge map: NpcId -> (EventId -> Knowledge) */
-	TMap<FString, TMap<FGuid, FRfsnEventKnowledge>> NpcKnowledge;
+	/** Who knows what, and who talks to whom */
+	FRfsnKnowledgeMatrix Knowledge;
+
+	/** Knowledge row per NPC id, and back */
+	TMap<FString, int32> NpcRows;
+	TArray<FString> RowNpcIds;
+	TArray<TWeakObjectPtr<AActor>> RowActors;
+
+	/** Knowledge column per event, and the AllEvents index per column (INDEX_NONE when free) */
+	TMap<FGuid, int32> EventColumns;
+	TArray<int32> ColumnEvents;
 
-	/** Register NPC as witness to event */
-	void RegisterWitness(const FGuid& EventId, const FString& NpcId, float Accuracy = 1.0f,
-	                     const FString& Source = TEXT("witnessed"));
+	FRandomStream RumorRandom;
+
+	int32 FindOrAddNpcRow(const FString& NpcId);
+	const int32* FindNpcRow(const FString& NpcId) const { return NpcRows.Find(NpcId); }
+
+	/** Copy registered NPC positions into the contact graph */
+	void RefreshNpcLocations();
+
+	/** Free the knowledge column of an event about to leave AllEvents */
+	void ForgetEvent(const FGuid& EventId);
+
+	/** Rebuild ColumnEvents after AllEvents shrank */
+	void ReindexEvents();
+
+	/** Register NPC as witness to event (or rumor from SourceRow) */
+	void RegisterWitness(int32 Column, int32 NpcRow, float Accuracy = 1.0f, int32 SourceRow = INDEX_NONE);
+
+	/** Public view of one knowledge cell */
+	FRfsnEventKnowledge MakeKnowledge(int32 NpcRow, int32 Column) const;
+
+	/** Event in a knowledge column, or nullptr for a free column */
+	FRfsnWitnessEvent* GetColumnEvent(int32 Column)
+	{
+		return ColumnEvents.IsValidIndex(Column) && ColumnEvents[Column] != INDEX_NONE
+		           ? &AllEvents[ColumnEvents[Column]]
+		           : nullptr;
+	}
+	const FRfsnWitnessEvent* GetColumnEvent(int32 Column) const
+	{
+		return const_cast<URfsnWitnessSystem*>(this)->GetColumnEvent(Column);
+	}
 
 	/** Get event by ID */
 	FRfsnWitnessEvent* FindEvent(const FGuid& EventId);
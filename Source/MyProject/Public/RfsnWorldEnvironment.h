@@ -0,0 +1,203 @@
+// RFSN World Environment
+// World-level weather and time of day, with NPC weather reactions evaluated in one batch
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "RfsnWeatherReactions.h"
+#include "RfsnWorldEnvironment.generated.h"
+
+class URfsnGameClock;
+
+namespace RfsnWeather
+{
+/** Entries in ERfsnWeatherType */
+constexpr int32 NumTypes = static_cast<int32>(ERfsnWeatherType::Cold) + 1;
+
+/** Indoors / seeks-shelter combinations, the only per-NPC inputs to a reaction besides preference */
+constexpr int32 NumFlagSets = 4;
+constexpr uint8 FlagIndoors = 1 << 0;
+constexpr uint8 FlagSeeksShelter = 1 << 1;
+
+/** How far (hours) AdvanceToHour may be behind the clock, e.g. a driver that lags a tick, before it is logged */
+constexpr float AdvanceLagHours = 0.25f;
+} // namespace RfsnWeather
+
+/**
+ * An NPC preference list flattened into tables indexed by ERfsnWeatherType.
+ * NPCs configured alike share one archetype.
+ */
+struct FRfsnWeatherArchetype
+{
+	float Preferences[RfsnWeather::NumTypes] = {};
+	FString Comments[RfsnWeather::NumTypes];
+
+	/** Same answers as scanning the list: the first preference and the first non-empty comment per weather win */
+	static FRfsnWeatherArchetype FromPreferences(const TArray<FRfsnWeatherPreference>& InPreferences);
+
+	bool operator==(const FRfsnWeatherArchetype& Other) const;
+	friend uint32 GetTypeHash(const FRfsnWeatherArchetype& Archetype);
+};
+
+/**
+ * Weather reactions of many NPCs. A reaction only depends on the weather, the NPC's archetype and its two
+ * flags, so each weather change evaluates archetypes x 4 flag sets once and every NPC reads its result from
+ * that table.
+ */
+struct MYPROJECT_API FRfsnWeatherReactionBatch
+{
+	/** Archetype equal to Archetype, added if new */
+	int32 FindOrAddArchetype(const FRfsnWeatherArchetype& Archetype);
+	const FRfsnWeatherArchetype& GetArchetype(int32 Archetype) const { return Archetypes[Archetype]; }
+	int32 NumArchetypes() const { return Archetypes.Num(); }
+
+	/** Add an NPC with its reaction under the current weather; returns its slot */
+	int32 Add(int32 Archetype, bool bIsIndoors, bool bSeeksShelter);
+	void Remove(int32 Npc);
+
+	/** Change an NPC's archetype or flags; true if its reaction or shelter flag changed */
+	bool Update(int32 Npc, int32 Archetype, bool bIsIndoors, bool bSeeksShelter);
+
+	bool IsValid(int32 Npc) const { return Active.IsValidIndex(Npc) && Active[Npc]; }
+	int32 Num() const { return Active.Num() - FreeSlots.Num(); }
+	int32 GetArchetypeOf(int32 Npc) const { return NpcArchetypes[Npc]; }
+
+	/** Re-evaluate every NPC for NewWeather, appending those whose reaction or shelter flag changed */
+	void Evaluate(ERfsnWeatherType NewWeather, TArray<int32>& OutChanged);
+
+	ERfsnWeatherType GetWeather() const { return Weather; }
+	ERfsnWeatherReaction GetReaction(int32 Npc) const
+	{
+		return static_cast<ERfsnWeatherReaction>(NpcResults[Npc] & ~ShelterBit);
+	}
+	bool GetShouldSeekShelter(int32 Npc) const { return (NpcResults[Npc] & ShelterBit) != 0; }
+
+	/** The reaction rule for one NPC */
+	static ERfsnWeatherReaction React(ERfsnWeatherType InWeather, float Feeling, bool bIsIndoors, bool bSeeksShelter,
+	                                  bool& bOutShouldSeekShelter);
+
+	static ERfsnTimeOfDay GetTimeOfDay(float Hour);
+
+	/** Hour (0-24] at which the period containing Hour ends */
+	static float GetPeriodEndHour(float Hour);
+
+private:
+	static constexpr uint8 ShelterBit = 0x80;
+
+	TArray<FRfsnWeatherArchetype> Archetypes;
+	TMap<uint32, TArray<int32>> ArchetypesByHash;
+
+	/** Archetype * NumFlagSets + flags -> reaction | ShelterBit, for Weather */
+	TArray<uint8> Results;
+	ERfsnWeatherType Weather = ERfsnWeatherType::Clear;
+
+	// Per NPC
+	TArray<uint16> NpcArchetypes;
+	TArray<uint8> NpcFlags;
+	TArray<uint8> NpcResults;
+	TBitArray<> Active;
+	TArray<int32> FreeSlots;
+
+	static uint8 MakeFlags(bool bIsIndoors, bool bSeeksShelter);
+	void EvaluateArchetype(int32 Archetype);
+};
+
+/**
+ * World Subsystem that owns the weather and the time of day for every URfsnWeatherReactions.
+ * Changes are broadcast once here and pushed to the components, whose reactions come from one batch
+ * evaluation; components no longer tick. With a URfsnGameClock the time of day follows the clock through a
+ * timer at the end of each period.
+ */
+UCLASS()
+class MYPROJECT_API URfsnWorldEnvironment : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	// ─────────────────────────────────────────────────────────────
+	// Events
+	// ─────────────────────────────────────────────────────────────
+
+	UPROPERTY(BlueprintAssignable, Category = "RFSN|Environment")
+	FOnWeatherChanged OnWeatherChanged;
+
+	UPROPERTY(BlueprintAssignable, Category = "RFSN|Environment")
+	FOnTimeOfDayChanged OnTimeOfDayChanged;
+
+	// ─────────────────────────────────────────────────────────────
+	// API
+	// ─────────────────────────────────────────────────────────────
+
+	UFUNCTION(BlueprintCallable, Category = "RFSN|Environment")
+	void SetWeather(ERfsnWeatherType NewWeather);
+
+	UFUNCTION(BlueprintPure, Category = "RFSN|Environment")
+	ERfsnWeatherType GetWeather() const { return Batch.GetWeather(); }
+
+	/** Set the hour (0-24); with a game clock this moves the clock to that hour of the current day */
+	UFUNCTION(BlueprintCallable, Category = "RFSN|Environment")
+	void SetGameTime(float Hour);
+
+	/**
+	 * Move time forward to Hour (0-24) of the current day. An hour the clock has already passed leaves it where it
+	 * is, so a driver that lags behind the ticking clock never skips a day; use SetGameTime to rewind
+	 */
+	UFUNCTION(BlueprintCallable, Category = "RFSN|Environment")
+	void AdvanceToHour(float Hour);
+
+	/** Current hour (0-24), read from the game clock when there is one */
+	UFUNCTION(BlueprintPure, Category = "RFSN|Environment")
+	float GetGameHour() const;
+
+	UFUNCTION(BlueprintPure, Category = "RFSN|Environment")
+	ERfsnTimeOfDay GetTimeOfDay() const { return TimeOfDay; }
+
+	UFUNCTION(BlueprintPure, Category = "RFSN|Environment")
+	int32 GetNumRegistered() const { return Batch.Num(); }
+
+	UFUNCTION(BlueprintPure, Category = "RFSN|Environment")
+	int32 GetNumArchetypes() const { return Batch.NumArchetypes(); }
+
+	/** Register a component and push the current weather, time and its reaction to it. Returns a slot. */
+	int32 Register(URfsnWeatherReactions* Reactions);
+	void Unregister(int32 Slot);
+
+	/** Re-read a component's preferences and flags */
+	void UpdateNpc(int32 Slot);
+
+	/** Preference and custom comment from the slot's archetype */
+	float GetPreference(int32 Slot, ERfsnWeatherType Weather) const;
+	const FString& GetComment(int32 Slot, ERfsnWeatherType Weather) const;
+
+	// UWorldSubsystem
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void OnWorldBeginPlay(UWorld& InWorld) override;
+
+protected:
+	virtual void Deinitialize() override;
+
+private:
+	FRfsnWeatherReactionBatch Batch;
+
+	/** Owner per slot */
+	TArray<TWeakObjectPtr<URfsnWeatherReactions>> Components;
+
+	TArray<int32> Changed;
+
+	/** Hour when there is no game clock */
+	float LocalHour = 12.0f;
+	ERfsnTimeOfDay TimeOfDay = ERfsnTimeOfDay::Noon;
+
+	TWeakObjectPtr<URfsnGameClock> Clock;
+	int32 PeriodTimer = INDEX_NONE;
+
+	void UpdateTimeOfDay();
+	void SchedulePeriodEnd();
+	void HandlePeriodEnd();
+
+	UFUNCTION()
+	void HandleClockJumped();
+
+	int32 ReadArchetype(const URfsnWeatherReactions* Reactions);
+};